@@ -0,0 +1,79 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "adpcm.h"
+
+static const int16_t s_step[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+    337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+static const int8_t s_index_adjust[16] = {
+    -1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+/* one nibble, the shift and add form of the IMA reference, without branches on the code */
+static inline int32_t adpcm_nibble(int32_t predictor, int32_t *index, uint32_t code)
+{
+    int32_t step = s_step[*index];
+    int32_t diff = (step >> 3) + (step & -(int32_t)(code >> 2 & 1)) + (step >> 1 & -(int32_t)(code >> 1 & 1))
+                   + (step >> 2 & -(int32_t)(code & 1));
+    int32_t sign = -(int32_t)(code >> 3);
+
+    predictor += (diff ^ sign) - sign;
+    predictor = predictor > INT16_MAX ? INT16_MAX : predictor < INT16_MIN ? INT16_MIN : predictor;
+    *index += s_index_adjust[code];
+    *index = *index < 0 ? 0 : *index > 88 ? 88 : *index;
+    return predictor;
+}
+
+int16_t adpcm_block_start(adpcm_state_t *state, const uint8_t *block)
+{
+    state->predictor = (int16_t)(block[0] | block[1] << 8);
+    state->index = block[2] > 88 ? 88 : block[2];
+    return state->predictor;
+}
+
+void adpcm_decode(adpcm_state_t *state, const uint8_t *data, size_t first, int16_t *out, size_t n)
+{
+    int32_t predictor = state->predictor;
+    int32_t index = state->index;
+    const uint8_t *p = data + first / 2;
+    int16_t *end = out + n;
+
+    if (first & 1 && out < end) {
+        predictor = adpcm_nibble(predictor, &index, *p++ >> 4);
+        *out++ = predictor;
+    }
+    /* whole bytes, two samples each */
+    while (end - out >= 2) {
+        uint32_t byte = *p++;
+        predictor = adpcm_nibble(predictor, &index, byte & 0x0F);
+        out[0] = predictor;
+        predictor = adpcm_nibble(predictor, &index, byte >> 4);
+        out[1] = predictor;
+        out += 2;
+    }
+    if (out < end) {
+        predictor = adpcm_nibble(predictor, &index, *p & 0x0F);
+        *out = predictor;
+    }
+    state->predictor = predictor;
+    state->index = index;
+}
+
+size_t adpcm_decode_block(const uint8_t *block, size_t block_align, int16_t *out)
+{
+    adpcm_state_t state;
+    size_t n = adpcm_block_samples(block_align);
+
+    out[0] = adpcm_block_start(&state, block);
+    adpcm_decode(&state, block + ADPCM_HEADER_SIZE, 0, out + 1, n - 1);
+    return n;
+}
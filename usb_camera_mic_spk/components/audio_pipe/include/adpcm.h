@@ -0,0 +1,81 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * IMA ADPCM decoder
+ *
+ * 4 bits per 16-bit sample, in the mono block layout of WAV format 0x11: a
+ * block starts with a 4 byte header holding the first sample and the step
+ * index, followed by two samples per byte, low nibble first. A block of
+ * block_align bytes thus holds (block_align - 4) * 2 + 1 samples and can be
+ * decoded without any other block.
+ *
+ * The decoder keeps its state between calls, so a block can be decoded in
+ * pieces of any size straight into the caller's buffer.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ADPCM_HEADER_SIZE   4
+
+/**
+ * @brief Decoder state
+ */
+typedef struct {
+    int32_t predictor;          /*!< Last sample */
+    int32_t index;              /*!< Step table index, 0 to 88 */
+} adpcm_state_t;
+
+/**
+ * @brief Samples in a block of block_align bytes.
+ */
+static inline size_t adpcm_block_samples(size_t block_align)
+{
+    return (block_align - ADPCM_HEADER_SIZE) * 2 + 1;
+}
+
+/**
+ * @brief Start a block: load its header into the state.
+ *
+ * @param state Decoder state
+ * @param block Block, at least ADPCM_HEADER_SIZE bytes
+ *
+ * @return the first sample of the block
+ */
+int16_t adpcm_block_start(adpcm_state_t *state, const uint8_t *block);
+
+/**
+ * @brief Decode samples from the nibbles of a block.
+ *
+ * @param state Decoder state, left at the last sample decoded
+ * @param data  Nibbles of the block, past the header
+ * @param first Nibble to start with, the sample index in the block minus one
+ * @param out   Samples
+ * @param n     Number of samples
+ */
+void adpcm_decode(adpcm_state_t *state, const uint8_t *data, size_t first, int16_t *out, size_t n);
+
+/**
+ * @brief Decode a whole block.
+ *
+ * @param block       Block
+ * @param block_align Block size in bytes
+ * @param out         adpcm_block_samples(block_align) samples
+ *
+ * @return number of samples decoded
+ */
+size_t adpcm_decode_block(const uint8_t *block, size_t block_align, int16_t *out);
+
+#ifdef __cplusplus
+}
+#endif
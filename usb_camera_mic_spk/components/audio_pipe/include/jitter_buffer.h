@@ -0,0 +1,150 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Adaptive jitter buffer
+ *
+ * Holds 16-bit mono samples that arrive in packets at irregular times and
+ * hands them out at the steady pace of the player. Playback starts once the
+ * buffer holds its target depth.
+ *
+ * The target follows the arrival jitter. Every packet's delay is measured
+ * against the media clock, the time since the first packet minus the
+ * duration of the samples received, and the jitter is how much later than
+ * the earliest packet of the last few seconds it came. The target is the
+ * largest jitter of that window plus a margin, between the configured
+ * minimum and maximum. A late packet needs the buffer to hold as much as it
+ * was late, so the level the control loop looks at is the depth a packet
+ * found on arrival plus its lateness, smoothed: the depth the buffer would
+ * have if every packet came on time. When that level is above the target
+ * one sample in JITTER_ADJUST_INTERVAL is dropped, below it one is added,
+ * each time as the mean of two neighbours so the waveform stays smooth; far
+ * above the target, after an outage, it catches up faster.
+ *
+ * When the buffer runs dry the last pitch period is repeated, found by
+ * autocorrelation over the samples played last, and faded out within
+ * JITTER_CONCEAL_MS; after that it is silent. Playback resumes once the
+ * target depth is back, cross-faded from the concealment. A stream that was
+ * ended plays what is left without waiting for the target.
+ *
+ * Not thread safe, the caller serializes jitter_buffer_push() and
+ * jitter_buffer_pull().
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define JITTER_WINDOWS          8       /*!< Windows the jitter peak is kept over */
+#define JITTER_WINDOW_MS        500     /*!< Length of one window */
+#define JITTER_ADJUST_INTERVAL  64      /*!< Samples played per sample dropped or added */
+#define JITTER_CONCEAL_MS       40      /*!< Fade out of the concealment */
+#define JITTER_FADE_MS          5       /*!< Cross-fade back to the stream */
+
+/**
+ * @brief Buffer settings
+ */
+typedef struct {
+    uint32_t sample_rate;       /*!< Stream rate in Hz */
+    uint32_t min_ms;            /*!< Lowest target depth */
+    uint32_t max_ms;            /*!< Highest target depth, the capacity adds the margin and some headroom */
+    uint32_t start_ms;          /*!< Target until a full jitter history was seen */
+    uint32_t margin_ms;         /*!< Added to the measured jitter, covers the player taking a period at once */
+} jitter_buffer_config_t;
+
+/**
+ * @brief Buffer statistics
+ */
+typedef struct {
+    uint32_t target_ms;         /*!< Target depth now */
+    uint32_t depth_ms;          /*!< Samples buffered now */
+    uint32_t jitter_ms;         /*!< Largest arrival jitter in the window */
+    uint32_t latency_ms;        /*!< Depth a packet finds behind it, smoothed: the latency the buffer adds */
+    uint32_t packets;           /*!< Packets pushed */
+    uint32_t underruns;         /*!< Times the buffer ran dry while playing */
+    uint32_t concealed;         /*!< Samples played that were not received: concealment and silence */
+    uint32_t dropped;           /*!< Samples lost to a full buffer */
+    uint32_t adjusted;          /*!< Samples dropped or added to follow the target */
+} jitter_buffer_stats_t;
+
+typedef struct jitter_buffer jitter_buffer_t;
+
+/**
+ * @brief Allocate a jitter buffer.
+ *
+ * @param config Settings
+ * @param ret    Set to the buffer
+ *
+ * @return
+ *     - ESP_OK on success
+ *     - ESP_ERR_INVALID_ARG if the rate is 0 or the depths are inconsistent
+ *     - ESP_ERR_NO_MEM if the buffer could not be allocated
+ */
+esp_err_t jitter_buffer_create(const jitter_buffer_config_t *config, jitter_buffer_t **ret);
+
+/**
+ * @brief Free a jitter buffer.
+ *
+ * @param jb Buffer, NULL is ignored
+ */
+void jitter_buffer_delete(jitter_buffer_t *jb);
+
+/**
+ * @brief Add a packet.
+ *
+ * When the samples do not fit the oldest ones are dropped.
+ *
+ * @param jb      Buffer
+ * @param samples Samples
+ * @param n       Number of samples
+ * @param now_us  Arrival time in microseconds, from any clock that does not jump
+ */
+void jitter_buffer_push(jitter_buffer_t *jb, const int16_t *samples, size_t n, int64_t now_us);
+
+/**
+ * @brief Mark the end of the stream, what is buffered is played out.
+ *
+ * @param jb Buffer
+ */
+void jitter_buffer_end(jitter_buffer_t *jb);
+
+/**
+ * @brief Take samples for playback.
+ *
+ * @param jb  Buffer
+ * @param out Samples
+ * @param n   Samples wanted
+ *
+ * @return n while the stream plays, concealed samples included; 0 before it
+ *         starts and once it ended and was played out, fewer at that end
+ */
+size_t jitter_buffer_pull(jitter_buffer_t *jb, int16_t *out, size_t n);
+
+/**
+ * @brief Whether the stream ended and everything was played.
+ *
+ * @param jb Buffer
+ */
+bool jitter_buffer_done(const jitter_buffer_t *jb);
+
+/**
+ * @brief Read the statistics.
+ *
+ * @param jb    Buffer
+ * @param stats Filled with the current values
+ */
+void jitter_buffer_get_stats(const jitter_buffer_t *jb, jitter_buffer_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
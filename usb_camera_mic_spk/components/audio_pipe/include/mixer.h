@@ -0,0 +1,206 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Speaker mixer
+ *
+ * Sums any number of sources, up to MIXER_SOURCES_MAX, into signed 16-bit
+ * interleaved frames at one rate and channel count. The mixer pulls: each
+ * source is a read callback handing out frames already in the mixer's
+ * format (see mixer_sources.h for prompts and tones), and a source that has
+ * fewer frames than asked for, or none, is silent for the rest. Whoever
+ * drives the mixer asks for a period at a time, sized for the device it
+ * writes to.
+ *
+ * Every source has a gain, a ceiling its scaled samples are clipped to
+ * before they are added, and a ducking gain. While a source marked as
+ * ducking others plays, every other source is brought down to its ducking
+ * gain, and back up once it stops. Gain changes, ducking included, are
+ * ramped sample by sample, down within the attack time and up within the
+ * release time, so they never click.
+ *
+ * The work is integer only and done in blocks of MIXER_BLOCK_SAMPLES: a
+ * source fills a block, it is scaled into a 32-bit accumulator, and the sum
+ * is saturated to 16 bits once all sources are in. Sources that duck others
+ * are read first in every block, so ducking follows them without a block of
+ * delay.
+ *
+ * The mixer holds a lock while it mixes, sources may be added, removed and
+ * changed from any task. Read callbacks are called with the lock held and
+ * must not call the mixer.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MIXER_SOURCES_MAX       8       /*!< Sources mixed at the same time */
+#define MIXER_BLOCK_SAMPLES     256     /*!< Samples of all channels mixed in one pass */
+#define MIXER_GAIN_UNITY        32768   /*!< Gain of 1, gains are Q15 */
+#define MIXER_GAIN_MAX          65536   /*!< Highest gain, +6 dB */
+#define MIXER_LIMIT_NONE        32768   /*!< Ceiling that clips nothing a gain up to unity can give */
+
+/**
+ * @brief Read frames from a source.
+ *
+ * @param ctx    Source context
+ * @param out    Frames in the mixer's format, 16-bit with the mixer's channels interleaved
+ * @param frames Frames wanted, at most MIXER_BLOCK_SAMPLES / channels
+ *
+ * @return frames read, the rest of the block is silent
+ */
+typedef size_t (*mixer_read_t)(void *ctx, int16_t *out, size_t frames);
+
+/**
+ * @brief Mixer format and ramp times
+ */
+typedef struct {
+    uint32_t sample_rate;       /*!< Rate of all sources, in Hz */
+    uint32_t channels;          /*!< Interleaved channels, 1 to 8 */
+    uint32_t attack_ms;         /*!< Time a gain takes to fall from unity to 0 */
+    uint32_t release_ms;        /*!< Time a gain takes to rise from 0 to unity */
+} mixer_config_t;
+
+/**
+ * @brief Source settings
+ */
+typedef struct {
+    const char *name;           /*!< Name in the statistics, kept by reference */
+    mixer_read_t read;          /*!< Read callback */
+    void *ctx;                  /*!< Passed to the callback */
+    int32_t gain;               /*!< Q15, 0 to MIXER_GAIN_MAX */
+    int32_t duck_gain;          /*!< Q15 gain on top of gain while a ducking source plays, MIXER_GAIN_UNITY for none */
+    int32_t limit;              /*!< Scaled samples are clipped to +-limit, 1 to MIXER_LIMIT_NONE */
+    bool ducks;                 /*!< Duck the other sources while this one plays */
+} mixer_source_config_t;
+
+/**
+ * @brief Source settings at unity gain, not ducked, not clipped
+ */
+#define MIXER_SOURCE_CONFIG_DEFAULT() {     \
+    .gain = MIXER_GAIN_UNITY,               \
+    .duck_gain = MIXER_GAIN_UNITY,          \
+    .limit = MIXER_LIMIT_NONE,              \
+}
+
+/**
+ * @brief Statistics of one source
+ */
+typedef struct {
+    const char *name;           /*!< Source name, NULL for an unused slot */
+    uint32_t frames;            /*!< Frames read */
+    uint32_t clipped;           /*!< Samples clipped to the source's limit */
+    int32_t level;              /*!< Gain applied now, Q15, ducking included */
+    bool ducked;                /*!< A ducking source played in the last block */
+} mixer_source_stats_t;
+
+/**
+ * @brief Mixer statistics
+ */
+typedef struct {
+    uint32_t frames;            /*!< Frames mixed */
+    uint32_t clipped;           /*!< Samples of the sum clipped to 16 bits */
+    mixer_source_stats_t sources[MIXER_SOURCES_MAX];
+} mixer_stats_t;
+
+typedef struct mixer mixer_t;
+typedef struct mixer_source mixer_source_t;
+
+/**
+ * @brief Convert decibels to a gain.
+ *
+ * @param db Decibels, -INFINITY for 0
+ *
+ * @return Q15 gain, at most MIXER_GAIN_MAX
+ */
+int32_t mixer_gain_from_db(float db);
+
+/**
+ * @brief Allocate a mixer.
+ *
+ * @param config Format and ramp times
+ * @param ret    Set to the mixer
+ *
+ * @return
+ *     - ESP_OK on success
+ *     - ESP_ERR_INVALID_ARG if the rate is 0 or the channels out of range
+ *     - ESP_ERR_NO_MEM if the mixer could not be allocated
+ */
+esp_err_t mixer_create(const mixer_config_t *config, mixer_t **ret);
+
+/**
+ * @brief Free a mixer, its sources are dropped but not freed.
+ *
+ * @param mixer Mixer, NULL is ignored
+ */
+void mixer_delete(mixer_t *mixer);
+
+/**
+ * @brief Add a source, it is mixed from the next block on.
+ *
+ * The source starts at its gain, without a ramp.
+ *
+ * @param mixer  Mixer
+ * @param config Settings, copied
+ * @param ret    Set to the source handle, may be NULL
+ *
+ * @return
+ *     - ESP_OK on success
+ *     - ESP_ERR_INVALID_ARG if there is no callback or a gain or the limit is out of range
+ *     - ESP_ERR_NO_MEM if MIXER_SOURCES_MAX sources are mixed already
+ */
+esp_err_t mixer_add_source(mixer_t *mixer, const mixer_source_config_t *config, mixer_source_t **ret);
+
+/**
+ * @brief Remove a source, its callback is not called once this returns.
+ *
+ * @param mixer  Mixer
+ * @param source Source handle, NULL is ignored
+ */
+void mixer_remove_source(mixer_t *mixer, mixer_source_t *source);
+
+/**
+ * @brief Change the gain of a source, ramped.
+ *
+ * @param mixer  Mixer
+ * @param source Source handle
+ * @param gain   Q15, 0 to MIXER_GAIN_MAX
+ *
+ * @return
+ *     - ESP_OK on success
+ *     - ESP_ERR_INVALID_ARG if the gain is out of range
+ */
+esp_err_t mixer_set_gain(mixer_t *mixer, mixer_source_t *source, int32_t gain);
+
+/**
+ * @brief Mix frames of all sources.
+ *
+ * @param mixer  Mixer
+ * @param out    Mixed frames, 16-bit interleaved
+ * @param frames Number of frames
+ *
+ * @return number of sources that gave at least one frame
+ */
+size_t mixer_mix(mixer_t *mixer, int16_t *out, size_t frames);
+
+/**
+ * @brief Read the mixer statistics.
+ *
+ * @param mixer Mixer
+ * @param stats Filled with the current values
+ */
+void mixer_get_stats(mixer_t *mixer, mixer_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Sources for the speaker mixer
+ *
+ * A tone generator, a sine from a 256 point table with linear
+ * interpolation, and a prompt player that decodes a stored prompt, converts
+ * it to the mixer rate and spreads it over the mixer channels. Both are read
+ * through a mixer_read_t callback, see mixer.h.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "prompt_store.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Sine tone generator
+ */
+typedef struct {
+    uint32_t phase;             /*!< Position in the period, 2^32 per period */
+    uint32_t step;              /*!< Phase advance per frame */
+    int32_t amplitude;          /*!< Peak, 0 to 32767 */
+    uint32_t channels;          /*!< Same tone on every channel */
+} mixer_tone_t;
+
+/**
+ * @brief Set up a tone generator.
+ *
+ * @param tone        Generator
+ * @param sample_rate Mixer rate in Hz
+ * @param channels    Mixer channels
+ * @param freq        Tone frequency in Hz, below half the rate
+ * @param amplitude   Peak, 0 to 32767
+ */
+void mixer_tone_init(mixer_tone_t *tone, uint32_t sample_rate, uint32_t channels, uint32_t freq, int32_t amplitude);
+
+/**
+ * @brief mixer_read_t of a tone generator, it never runs out.
+ */
+size_t mixer_tone_read(void *ctx, int16_t *out, size_t frames);
+
+/**
+ * @brief Prompt player settings
+ */
+typedef struct {
+    const prompt_t *prompt;     /*!< Prompt played, from prompt_store_find() */
+    uint32_t sample_rate;       /*!< Mixer rate in Hz */
+    uint32_t channels;          /*!< Mixer channels, the prompt goes to all of them */
+    bool loop;                  /*!< Start over once played, else stay silent */
+    uint32_t gap_ms;            /*!< Silence between two loops */
+} mixer_prompt_config_t;
+
+typedef struct mixer_prompt mixer_prompt_t;
+
+/**
+ * @brief Allocate a prompt player, with a resampler when the prompt is at another rate.
+ *
+ * @param config Settings
+ * @param ret    Set to the player
+ *
+ * @return
+ *     - ESP_OK on success
+ *     - ESP_ERR_INVALID_ARG if there is no prompt or the channels are out of range
+ *     - ESP_ERR_NO_MEM if the player could not be allocated
+ */
+esp_err_t mixer_prompt_create(const mixer_prompt_config_t *config, mixer_prompt_t **ret);
+
+/**
+ * @brief Free a prompt player, remove it from the mixer first.
+ *
+ * @param player Player, NULL is ignored
+ */
+void mixer_prompt_delete(mixer_prompt_t *player);
+
+/**
+ * @brief mixer_read_t of a prompt player, gives nothing between loops and once played.
+ */
+size_t mixer_prompt_read(void *ctx, int16_t *out, size_t frames);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,171 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * PCM sample format conversion
+ *
+ * Interleaved little endian PCM of 8, 16, 24 (packed in 3 bytes) or 32 bits,
+ * signed or unsigned (offset binary, as WAV stores 8-bit samples), is
+ * converted through signed 16-bit, the format the rest of the audio path
+ * works in. Narrowing to fewer bits truncates, or adds triangular (TPDF)
+ * dither of +-1 LSB of the narrower format and rounds, which turns the
+ * truncation distortion into a flat noise floor.
+ *
+ * Every kernel has a plain per-sample reference version, the *_ref
+ * functions. The others move 32-bit words at a time, four samples per step,
+ * on word aligned buffers, and fall back to the reference where that gains
+ * nothing; both give identical output, dither included. pcm_convert() ties
+ * the kernels together for whole frames.
+ *
+ * Frames of up to PCM_CHANNELS_MAX channels are rearranged through a channel
+ * map, one entry per output channel naming the input channel it takes, or
+ * PCM_CHANNEL_MIX for the average of all of them. Spreading mono over any
+ * number of channels and moving whole left and right pairs are done a word
+ * per pair, so a stereo speaker costs no more per sample than a mono one.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PCM_CHANNELS_MAX    8       /*!< Most channels in a frame */
+#define PCM_CHANNEL_MIX     0xFF    /*!< Channel map entry for the average of all input channels */
+
+/**
+ * @brief Layout of an interleaved PCM buffer
+ */
+typedef struct {
+    uint32_t bits;              /*!< 8, 16, 24 or 32 bits per sample */
+    uint32_t channels;          /*!< 1 to PCM_CHANNELS_MAX, interleaved */
+    bool is_unsigned;           /*!< Offset binary instead of two's complement */
+} pcm_format_t;
+
+/**
+ * @brief Dither noise generator
+ */
+typedef struct {
+    uint32_t state;             /*!< xorshift32 state, never 0 */
+} pcm_dither_t;
+
+/**
+ * @brief Seed a dither generator.
+ *
+ * @param dither Generator
+ * @param seed   Any value, 0 is replaced
+ */
+void pcm_dither_init(pcm_dither_t *dither, uint32_t seed);
+
+/**
+ * @brief Bytes of one frame, all channels of one sample period.
+ *
+ * @param format Layout
+ *
+ * @return frame size in bytes
+ */
+static inline size_t pcm_frame_bytes(const pcm_format_t *format)
+{
+    return format->bits / 8 * format->channels;
+}
+
+/**
+ * @brief Fill in the default channel map.
+ *
+ * The same number of channels maps each channel to itself, and one output
+ * channel takes the average of all inputs. Otherwise output channel c takes
+ * input channel c modulo in_ch: mono goes to every channel, stereo to every
+ * left and right pair, and inputs past the last output are dropped.
+ *
+ * @param in_ch  Input channels, 1 to PCM_CHANNELS_MAX
+ * @param out_ch Output channels, 1 to PCM_CHANNELS_MAX
+ * @param map    out_ch entries
+ */
+void pcm_channel_map_default(uint32_t in_ch, uint32_t out_ch, uint8_t *map);
+
+/**
+ * @brief Convert whole frames, changing sample width, signedness and channels.
+ *
+ * Channels follow the default map, see pcm_channel_map_default(). Unsigned
+ * 16, 24 and 32-bit formats take an extra pass over the data.
+ *
+ * @param in      Input frames
+ * @param in_fmt  Input layout
+ * @param out     Output frames, must not overlap the input
+ * @param out_fmt Output layout
+ * @param frames  Number of frames
+ * @param dither  Dither generator used when narrowing, NULL to truncate
+ *
+ * @return
+ *     - ESP_OK on success
+ *     - ESP_ERR_NOT_SUPPORTED if a layout is not one of the above
+ */
+esp_err_t pcm_convert(const void *in, const pcm_format_t *in_fmt, void *out, const pcm_format_t *out_fmt,
+                      size_t frames, pcm_dither_t *dither);
+
+/**
+ * @brief Convert whole frames like pcm_convert(), with a channel map of one's own.
+ *
+ * @param in      Input frames
+ * @param in_fmt  Input layout
+ * @param out     Output frames, must not overlap the input
+ * @param out_fmt Output layout
+ * @param map     out_fmt->channels entries, an input channel or PCM_CHANNEL_MIX; NULL for the default
+ * @param frames  Number of frames
+ * @param dither  Dither generator used when narrowing, NULL to truncate
+ *
+ * @return
+ *     - ESP_OK on success
+ *     - ESP_ERR_NOT_SUPPORTED if a layout is not one of the above
+ *     - ESP_ERR_INVALID_ARG if a map entry names no input channel
+ */
+esp_err_t pcm_convert_map(const void *in, const pcm_format_t *in_fmt, void *out, const pcm_format_t *out_fmt,
+                          const uint8_t *map, size_t frames, pcm_dither_t *dither);
+
+/**
+ * @brief Toggle between signed and unsigned samples in place.
+ *
+ * @param buf     Samples
+ * @param bits    8, 16, 24 or 32
+ * @param samples Number of samples
+ */
+void pcm_flip_sign(void *buf, uint32_t bits, size_t samples);
+
+/* Kernels, n counts samples or for the channel mixers frames. dither may be NULL. */
+void pcm_decode_8(const uint8_t *in, int16_t *out, size_t n, bool is_unsigned);
+void pcm_decode_24(const uint8_t *in, int16_t *out, size_t n, pcm_dither_t *dither);
+void pcm_decode_32(const int32_t *in, int16_t *out, size_t n, pcm_dither_t *dither);
+void pcm_encode_8(const int16_t *in, uint8_t *out, size_t n, bool is_unsigned, pcm_dither_t *dither);
+void pcm_encode_24(const int16_t *in, uint8_t *out, size_t n);
+void pcm_encode_32(const int16_t *in, int32_t *out, size_t n);
+void pcm_mono_to_stereo(const int16_t *in, int16_t *out, size_t n);
+void pcm_stereo_to_mono(const int16_t *in, int16_t *out, size_t n);
+void pcm_mono_to_multi(const int16_t *in, int16_t *out, uint32_t channels, size_t n);
+void pcm_multi_to_mono(const int16_t *in, int16_t *out, uint32_t channels, size_t n);
+void pcm_remap(const int16_t *in, uint32_t in_ch, int16_t *out, uint32_t out_ch, const uint8_t *map, size_t n);
+
+/* Reference versions of the kernels, for tests and benchmarks */
+void pcm_flip_sign_ref(void *buf, uint32_t bits, size_t samples);
+void pcm_decode_8_ref(const uint8_t *in, int16_t *out, size_t n, bool is_unsigned);
+void pcm_decode_24_ref(const uint8_t *in, int16_t *out, size_t n, pcm_dither_t *dither);
+void pcm_decode_32_ref(const int32_t *in, int16_t *out, size_t n, pcm_dither_t *dither);
+void pcm_encode_8_ref(const int16_t *in, uint8_t *out, size_t n, bool is_unsigned, pcm_dither_t *dither);
+void pcm_encode_24_ref(const int16_t *in, uint8_t *out, size_t n);
+void pcm_encode_32_ref(const int16_t *in, int32_t *out, size_t n);
+void pcm_mono_to_stereo_ref(const int16_t *in, int16_t *out, size_t n);
+void pcm_stereo_to_mono_ref(const int16_t *in, int16_t *out, size_t n);
+void pcm_mono_to_multi_ref(const int16_t *in, int16_t *out, uint32_t channels, size_t n);
+void pcm_multi_to_mono_ref(const int16_t *in, int16_t *out, uint32_t channels, size_t n);
+void pcm_remap_ref(const int16_t *in, uint32_t in_ch, int16_t *out, uint32_t out_ch, const uint8_t *map, size_t n);
+
+#ifdef __cplusplus
+}
+#endif
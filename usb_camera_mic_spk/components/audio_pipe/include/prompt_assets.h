@@ -0,0 +1,93 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Voice prompts in a flash data partition
+ *
+ * An assets image packs prompt WAV files (see prompt_store.h) behind an index,
+ * all fields little-endian:
+ *
+ *   header   magic "PRMT", version, count, image size in bytes
+ *   index    count entries of a NUL-terminated name and the offset and
+ *            length of its WAV file from the start of the image
+ *   files    the WAV files, each starting on a 4 byte boundary
+ *
+ * Build one with main/prompts/mkassets.py and write it to the partition.
+ *
+ * The image is mapped into the data address space with esp_partition_mmap()
+ * and each file is added to the prompt store where it lies, names included:
+ * readers decode from the mapped flash and nothing is copied to RAM. The
+ * mapping is kept for as long as the application runs.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PROMPT_ASSETS_MAGIC         0x544D5250  /*!< "PRMT" */
+#define PROMPT_ASSETS_VERSION       1
+#define PROMPT_ASSETS_NAME_LEN      24          /*!< Name field, NUL included */
+
+/**
+ * @brief Image header
+ */
+typedef struct {
+    uint32_t magic;             /*!< PROMPT_ASSETS_MAGIC */
+    uint16_t version;           /*!< PROMPT_ASSETS_VERSION */
+    uint16_t count;             /*!< Index entries */
+    uint32_t size;              /*!< Image size in bytes, header included */
+    uint32_t reserved;          /*!< 0 */
+} prompt_assets_header_t;
+
+/**
+ * @brief Index entry
+ */
+typedef struct {
+    char name[PROMPT_ASSETS_NAME_LEN];  /*!< Prompt name */
+    uint32_t offset;                    /*!< WAV file offset in the image */
+    uint32_t length;                    /*!< WAV file length in bytes */
+} prompt_assets_entry_t;
+
+/**
+ * @brief Add the prompts of an image already in the address space.
+ *
+ * Entries that are not valid prompts are logged and skipped.
+ *
+ * @param image  Image, kept by reference
+ * @param len    Bytes available at image
+ * @param added  Number of prompts added, may be NULL
+ *
+ * @return
+ *     - ESP_OK on success
+ *     - ESP_ERR_NOT_FOUND if there is no image, as in an erased partition
+ *     - ESP_ERR_INVALID_VERSION if the image is of another version
+ *     - ESP_ERR_INVALID_SIZE if the index does not fit in the image
+ */
+esp_err_t prompt_assets_add(const uint8_t *image, size_t len, size_t *added);
+
+/**
+ * @brief Map a data partition and add the prompts of the image it holds.
+ *
+ * @param label  Partition label
+ * @param added  Number of prompts added, may be NULL
+ *
+ * @return
+ *     - ESP_OK on success
+ *     - ESP_ERR_NOT_FOUND if there is no such partition or no image in it
+ *     - ESP_ERR_INVALID_SIZE if the image does not fit in the partition
+ *     - the errors of esp_partition_mmap() and prompt_assets_add()
+ */
+esp_err_t prompt_assets_load(const char *label, size_t *added);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,112 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Store of voice prompts
+ *
+ * Prompts are mono IMA ADPCM WAV files (see adpcm.h), a quarter of the size
+ * of 16-bit PCM, that stay where they are linked or mapped; the store only
+ * keeps a table of names and where each one's blocks are. Encode them with
+ * main/prompts/wav_to_adpcm.py.
+ *
+ * A prompt is played through a reader, which decodes block after block
+ * straight into the caller's buffer. Nothing is decoded ahead and no clip is
+ * ever held as PCM, a reader is a few words of state.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "adpcm.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PROMPT_STORE_MAX    32      /*!< Prompts the store can hold */
+
+/**
+ * @brief A stored prompt
+ */
+typedef struct {
+    const char *name;           /*!< Name it is found by */
+    uint32_t sample_rate;       /*!< Sample rate in Hz */
+    uint32_t samples;           /*!< Length in samples */
+    uint32_t block_align;       /*!< Bytes per ADPCM block */
+    uint32_t block_samples;     /*!< Samples per ADPCM block */
+    const uint8_t *data;        /*!< First block */
+} prompt_t;
+
+/**
+ * @brief Position in a prompt being played
+ */
+typedef struct {
+    const prompt_t *prompt;     /*!< Prompt played */
+    uint32_t sample;            /*!< Next sample to decode */
+    adpcm_state_t state;        /*!< Decoder state inside the current block */
+} prompt_reader_t;
+
+/**
+ * @brief Add a prompt.
+ *
+ * @param name Name, kept by reference
+ * @param wav  IMA ADPCM WAV file, kept by reference
+ * @param len  File length in bytes
+ *
+ * @return
+ *     - ESP_OK on success
+ *     - ESP_ERR_INVALID_ARG if the file is not a mono IMA ADPCM WAV file
+ *     - ESP_ERR_NO_MEM if PROMPT_STORE_MAX prompts are stored already
+ */
+esp_err_t prompt_store_add(const char *name, const uint8_t *wav, size_t len);
+
+/**
+ * @brief Look a prompt up by name.
+ *
+ * @param name Name
+ *
+ * @return the prompt, or NULL if there is none of that name
+ */
+const prompt_t *prompt_store_find(const char *name);
+
+/**
+ * @brief Number of stored prompts.
+ */
+size_t prompt_store_count(void);
+
+/**
+ * @brief Prompt by position, in the order they were added.
+ *
+ * @param i Position
+ *
+ * @return the prompt, or NULL if i is out of range
+ */
+const prompt_t *prompt_store_get(size_t i);
+
+/**
+ * @brief Start playing a prompt from its beginning.
+ *
+ * @param reader Reader
+ * @param prompt Prompt
+ */
+void prompt_reader_init(prompt_reader_t *reader, const prompt_t *prompt);
+
+/**
+ * @brief Decode the next samples.
+ *
+ * @param reader Reader
+ * @param out    Samples, 16-bit mono
+ * @param n      Most samples to decode
+ *
+ * @return number of samples decoded, 0 once the prompt has been played
+ */
+size_t prompt_read(prompt_reader_t *reader, int16_t *out, size_t n);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Polyphase sample rate converter
+ *
+ * Converts 16-bit mono PCM between any two rates with a Kaiser windowed sinc
+ * low pass, cut at the lower of the two Nyquist frequencies. The ratio is
+ * reduced to out/in = L/M and the filter is split into L phases, each output
+ * sample is one dot product of RESAMPLER_TAPS inputs with one phase. When L
+ * is larger than RESAMPLER_MAX_PHASES (44.1 kHz from 32 kHz needs 441) the
+ * table holds RESAMPLER_MAX_PHASES phases and the two nearest ones are
+ * interpolated. The input position is tracked as an exact fraction, so the
+ * output never drifts from the ratio. When downsampling the filter gets
+ * longer in proportion, up to RESAMPLER_MAX_TAPS.
+ *
+ * Coefficients are Q15 and designed once, in resampler_create(); processing
+ * is integer only. The converter keeps its own history, input can be fed in
+ * pieces of any size.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RESAMPLER_TAPS          32      /*!< Taps per phase when upsampling */
+#define RESAMPLER_MAX_TAPS      128     /*!< Taps per phase when downsampling, 4:1 and beyond */
+#define RESAMPLER_MAX_PHASES    128     /*!< Phases stored, more are interpolated */
+
+typedef struct resampler resampler_t;
+
+/**
+ * @brief Design the filter for a rate pair and allocate the converter.
+ *
+ * @param in_rate  Input rate in Hz
+ * @param out_rate Output rate in Hz
+ * @param ret      Set to the converter
+ *
+ * @return
+ *     - ESP_OK on success
+ *     - ESP_ERR_INVALID_ARG if a rate is 0
+ *     - ESP_ERR_NO_MEM if the converter could not be allocated
+ */
+esp_err_t resampler_create(uint32_t in_rate, uint32_t out_rate, resampler_t **ret);
+
+/**
+ * @brief Free a converter.
+ *
+ * @param rs Converter, NULL is ignored
+ */
+void resampler_delete(resampler_t *rs);
+
+/**
+ * @brief Forget the history, the next input starts a new signal.
+ *
+ * @param rs Converter
+ */
+void resampler_reset(resampler_t *rs);
+
+/**
+ * @brief Convert until the input is used up or the output is full.
+ *
+ * @param rs      Converter
+ * @param in      Input samples
+ * @param in_len  Number of input samples, set to the number consumed
+ * @param out     Output samples
+ * @param out_len Room in out, in samples
+ *
+ * @return number of samples written to out
+ */
+size_t resampler_process(resampler_t *rs, const int16_t *in, size_t *in_len, int16_t *out, size_t out_len);
+
+/**
+ * @brief Most output samples in_len input samples can produce.
+ *
+ * @param rs     Converter
+ * @param in_len Number of input samples
+ *
+ * @return output samples, at most one more than in_len * out_rate / in_rate
+ */
+size_t resampler_out_len(const resampler_t *rs, size_t in_len);
+
+#ifdef __cplusplus
+}
+#endif
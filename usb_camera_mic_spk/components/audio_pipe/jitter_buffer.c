@@ -0,0 +1,400 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include "jitter_buffer.h"
+
+#define JITTER_HISTORY_MS       20      /* samples kept for the pitch search */
+#define JITTER_MATCH_MS         5       /* samples compared with one period earlier */
+#define JITTER_PITCH_MIN_US     2500    /* shortest period, 400 Hz */
+#define JITTER_PITCH_MAX_MS     15      /* longest period, 67 Hz */
+#define JITTER_SEARCH_RATE      8000    /* the period is searched at this rate, then refined */
+#define JITTER_HYSTERESIS_MS    10      /* the player takes a period at a time, the depth moves by that much */
+#define JITTER_LEVEL_SHIFT      4       /* level and latency smoothed over 16 packets */
+#define JITTER_CATCHUP          4       /* adjusts this much more often over half the capacity above the target */
+
+typedef enum {
+    JITTER_WAITING,             /* filling up to the target before playback */
+    JITTER_PLAYING,
+    JITTER_STALLED,             /* ran dry, concealing until the target is back */
+    JITTER_DONE,                /* ended and played out */
+} jitter_state_t;
+
+struct jitter_buffer {
+    uint32_t rate;
+    uint32_t size;              /* capacity in samples */
+    uint32_t min;               /* target bounds and margin, in samples */
+    uint32_t max;
+    uint32_t start;
+    uint32_t margin;
+    uint32_t hysteresis;
+    int16_t *ring;
+    uint32_t rd;
+    uint32_t wr;
+    uint32_t count;             /* samples buffered */
+    jitter_state_t state;
+    bool ended;
+
+    /* arrival delay against the media clock, the minimum and maximum of each window, in us */
+    bool started;
+    int64_t start_us;
+    uint64_t received;
+    int64_t win_start_us;
+    uint32_t win;
+    uint32_t wins_seen;
+    int64_t win_min[JITTER_WINDOWS];
+    int64_t win_max[JITTER_WINDOWS];
+    uint32_t jitter;            /* largest jitter in the windows, in samples */
+    uint32_t target;
+    int32_t level;              /* depth on an on-time arrival, samples << JITTER_LEVEL_SHIFT */
+    int32_t latency;            /* depth after a packet, samples << JITTER_LEVEL_SHIFT */
+    uint32_t since_adjust;
+    int16_t last;               /* stream sample played last */
+
+    /* concealment, the history is a ring of the samples played last */
+    int16_t *hist;
+    int16_t *linear;            /* the history in order, for the pitch search */
+    uint32_t hist_len;
+    uint32_t hist_pos;
+    int16_t *period;
+    uint32_t period_len;
+    uint32_t period_pos;
+    uint32_t conceal_len;
+    uint32_t conceal_pos;
+    uint32_t fade_len;
+    uint32_t fade_pos;
+
+    uint32_t packets;
+    uint32_t underruns;
+    uint32_t concealed;
+    uint32_t dropped;
+    uint32_t adjusted;
+};
+
+static uint32_t ms_to_samples(uint32_t ms, uint32_t rate)
+{
+    return (uint64_t)ms * rate / 1000;
+}
+
+static uint32_t samples_to_ms(uint32_t samples, uint32_t rate)
+{
+    return (uint64_t)samples * 1000 / rate;
+}
+
+esp_err_t jitter_buffer_create(const jitter_buffer_config_t *config, jitter_buffer_t **ret)
+{
+    if (!config->sample_rate || config->min_ms > config->max_ms || !config->max_ms) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    jitter_buffer_t *jb = (jitter_buffer_t *)calloc(1, sizeof(jitter_buffer_t));
+    if (!jb) {
+        return ESP_ERR_NO_MEM;
+    }
+    jb->rate = config->sample_rate;
+    jb->min = ms_to_samples(config->min_ms, jb->rate);
+    jb->max = ms_to_samples(config->max_ms, jb->rate);
+    jb->start = ms_to_samples(config->start_ms, jb->rate);
+    jb->margin = ms_to_samples(config->margin_ms, jb->rate);
+    jb->hysteresis = ms_to_samples(JITTER_HYSTERESIS_MS, jb->rate);
+    jb->start = jb->start < jb->min ? jb->min : jb->start > jb->max ? jb->max : jb->start;
+    jb->target = jb->start;
+    jb->size = jb->max + jb->hysteresis + jb->margin;
+    jb->hist_len = ms_to_samples(JITTER_HISTORY_MS, jb->rate);
+    jb->conceal_len = ms_to_samples(JITTER_CONCEAL_MS, jb->rate);
+    jb->fade_len = ms_to_samples(JITTER_FADE_MS, jb->rate);
+    jb->fade_pos = jb->fade_len;
+
+    jb->ring = (int16_t *)malloc(jb->size * sizeof(int16_t));
+    jb->hist = (int16_t *)calloc(2 * jb->hist_len + ms_to_samples(JITTER_PITCH_MAX_MS, jb->rate), sizeof(int16_t));
+    if (!jb->ring || !jb->hist || !jb->hist_len) {
+        jitter_buffer_delete(jb);
+        return ESP_ERR_NO_MEM;
+    }
+    /* one allocation for the history, its copy in order and the period repeated */
+    jb->linear = jb->hist + jb->hist_len;
+    jb->period = jb->linear + jb->hist_len;
+
+    *ret = jb;
+    return ESP_OK;
+}
+
+void jitter_buffer_delete(jitter_buffer_t *jb)
+{
+    if (jb) {
+        free(jb->ring);
+        free(jb->hist);
+        free(jb);
+    }
+}
+
+/* move to the window now falls in, a window not seen is empty */
+static void jitter_window_advance(jitter_buffer_t *jb, int64_t now_us)
+{
+    for (uint32_t i = 0; i < JITTER_WINDOWS && now_us - jb->win_start_us >= JITTER_WINDOW_MS * 1000LL; i++) {
+        jb->win = (jb->win + 1) % JITTER_WINDOWS;
+        jb->win_start_us += JITTER_WINDOW_MS * 1000LL;
+        jb->win_min[jb->win] = INT64_MAX;
+        jb->win_max[jb->win] = INT64_MIN;
+        jb->wins_seen++;
+    }
+    if (now_us - jb->win_start_us >= JITTER_WINDOW_MS * 1000LL) {
+        /* a gap longer than all windows */
+        jb->win_start_us = now_us;
+    }
+}
+
+static void jitter_target_update(jitter_buffer_t *jb)
+{
+    int64_t lo = INT64_MAX;
+    int64_t hi = INT64_MIN;
+
+    for (uint32_t i = 0; i < JITTER_WINDOWS; i++) {
+        lo = jb->win_min[i] < lo ? jb->win_min[i] : lo;
+        hi = jb->win_max[i] > hi ? jb->win_max[i] : hi;
+    }
+    jb->jitter = (uint64_t)(hi - lo) * jb->rate / 1000000;
+
+    uint64_t target = (uint64_t)jb->jitter + jb->margin;
+    if (jb->wins_seen < JITTER_WINDOWS && target < jb->start) {
+        target = jb->start;
+    }
+    jb->target = target < jb->min ? jb->min : target > jb->max ? jb->max : target;
+}
+
+void jitter_buffer_push(jitter_buffer_t *jb, const int16_t *samples, size_t n, int64_t now_us)
+{
+    if (!n) {
+        return;
+    }
+    if (!jb->started) {
+        jb->started = true;
+        jb->start_us = now_us;
+        jb->win_start_us = now_us;
+        for (uint32_t i = 0; i < JITTER_WINDOWS; i++) {
+            jb->win_min[i] = INT64_MAX;
+            jb->win_max[i] = INT64_MIN;
+        }
+        jb->level = (int32_t)jb->target << JITTER_LEVEL_SHIFT;
+    }
+    jb->received += n;
+    jb->packets++;
+
+    /* how late the packet is against the media clock, and against the earliest one of the windows */
+    int64_t delay = now_us - jb->start_us - (int64_t)(jb->received * 1000000 / jb->rate);
+    jitter_window_advance(jb, now_us);
+    if (delay < jb->win_min[jb->win]) {
+        jb->win_min[jb->win] = delay;
+    }
+    if (delay > jb->win_max[jb->win]) {
+        jb->win_max[jb->win] = delay;
+    }
+    int64_t earliest = INT64_MAX;
+    for (uint32_t i = 0; i < JITTER_WINDOWS; i++) {
+        earliest = jb->win_min[i] < earliest ? jb->win_min[i] : earliest;
+    }
+    jitter_target_update(jb);
+
+    /* what the depth would be had the packet come on time */
+    int64_t late = (delay - earliest) * jb->rate / 1000000;
+    int64_t level = ((int64_t)jb->count + late) << JITTER_LEVEL_SHIFT;
+    jb->level += (int32_t)((level - jb->level) >> JITTER_LEVEL_SHIFT);
+
+    /* keep the newest samples when they do not fit */
+    if (n > jb->size) {
+        jb->dropped += n - jb->size;
+        samples += n - jb->size;
+        n = jb->size;
+    }
+    if (jb->count + n > jb->size) {
+        uint32_t drop = jb->count + n - jb->size;
+        jb->rd = (jb->rd + drop) % jb->size;
+        jb->count -= drop;
+        jb->dropped += drop;
+    }
+    size_t first = n < jb->size - jb->wr ? n : jb->size - jb->wr;
+    memcpy(jb->ring + jb->wr, samples, first * sizeof(int16_t));
+    memcpy(jb->ring, samples + first, (n - first) * sizeof(int16_t));
+    jb->wr = (jb->wr + n) % jb->size;
+    jb->count += n;
+
+    jb->latency += (int32_t)((((int32_t)jb->count << JITTER_LEVEL_SHIFT) - jb->latency) >> JITTER_LEVEL_SHIFT);
+}
+
+void jitter_buffer_end(jitter_buffer_t *jb)
+{
+    jb->ended = true;
+}
+
+/* correlation of the last match samples with those lag earlier, over every step-th sample */
+static float jitter_match(const int16_t *x, uint32_t len, uint32_t match, uint32_t lag, uint32_t step)
+{
+    int64_t corr = 0;
+    int64_t energy = 0;
+
+    for (uint32_t k = len - match; k < len; k += step) {
+        corr += x[k] * x[k - lag];
+        energy += x[k - lag] * x[k - lag];
+    }
+    return corr > 0 ? (float)corr / sqrtf((float)energy + 1.0f) : 0.0f;
+}
+
+/* pick the pitch period of the samples played last, searched coarsely, then refined */
+static void jitter_conceal_start(jitter_buffer_t *jb)
+{
+    uint32_t len = jb->hist_len;
+    int16_t *x = jb->linear;
+    uint32_t match = ms_to_samples(JITTER_MATCH_MS, jb->rate);
+    uint32_t lo = (uint64_t)JITTER_PITCH_MIN_US * jb->rate / 1000000;
+    uint32_t hi = ms_to_samples(JITTER_PITCH_MAX_MS, jb->rate);
+    uint32_t step = jb->rate > JITTER_SEARCH_RATE ? jb->rate / JITTER_SEARCH_RATE : 1;
+
+    memcpy(x, jb->hist + jb->hist_pos, (len - jb->hist_pos) * sizeof(int16_t));
+    memcpy(x + len - jb->hist_pos, jb->hist, jb->hist_pos * sizeof(int16_t));
+    lo = lo ? lo : 1;
+    hi = hi + match < len ? hi : len - match;
+
+    uint32_t best = lo;
+    float best_score = 0.0f;
+    for (uint32_t lag = lo; lag <= hi; lag += step) {
+        float score = jitter_match(x, len, match, lag, step);
+        if (score > best_score) {
+            best_score = score;
+            best = lag;
+        }
+    }
+    uint32_t from = best > lo + step ? best - step : lo;
+    uint32_t to = best + step < hi ? best + step : hi;
+    for (uint32_t lag = from; lag <= to && step > 1; lag++) {
+        float score = jitter_match(x, len, match, lag, 1);
+        if (score > best_score) {
+            best_score = score;
+            best = lag;
+        }
+    }
+
+    memcpy(jb->period, x + len - best, best * sizeof(int16_t));
+    jb->period_len = best;
+    jb->period_pos = 0;
+    jb->conceal_pos = 0;
+}
+
+/* the next concealed sample, the last period over and over, fading out */
+static int32_t jitter_conceal_next(jitter_buffer_t *jb)
+{
+    if (jb->conceal_pos >= jb->conceal_len) {
+        return 0;
+    }
+    int32_t v = (int32_t)((int64_t)jb->period[jb->period_pos] * (jb->conceal_len - jb->conceal_pos) / jb->conceal_len);
+    jb->conceal_pos++;
+    if (++jb->period_pos == jb->period_len) {
+        jb->period_pos = 0;
+    }
+    return v;
+}
+
+static inline int16_t jitter_take(jitter_buffer_t *jb)
+{
+    int16_t s = jb->ring[jb->rd];
+
+    jb->rd = jb->rd + 1 == jb->size ? 0 : jb->rd + 1;
+    jb->count--;
+    return s;
+}
+
+size_t jitter_buffer_pull(jitter_buffer_t *jb, int16_t *out, size_t n)
+{
+    size_t i = 0;
+
+    if (jb->state == JITTER_WAITING || jb->state == JITTER_STALLED) {
+        if (jb->ended && !jb->count) {
+            jb->state = JITTER_DONE;
+        } else if (jb->count && (jb->count >= jb->target || jb->ended)) {
+            /* after a stall, cross-fade from the concealment */
+            jb->fade_pos = jb->state == JITTER_STALLED ? 0 : jb->fade_len;
+            jb->state = JITTER_PLAYING;
+            jb->since_adjust = 0;
+            /* what the level saw while filling up says nothing about the depth now */
+            jb->level = (int32_t)jb->count << JITTER_LEVEL_SHIFT;
+        } else if (jb->state == JITTER_WAITING) {
+            return 0;
+        }
+    }
+    if (jb->state == JITTER_DONE) {
+        return 0;
+    }
+
+    while (i < n) {
+        if (jb->state == JITTER_STALLED) {
+            out[i++] = jitter_conceal_next(jb);
+            jb->concealed++;
+            continue;
+        }
+        if (!jb->count) {
+            if (jb->ended) {
+                jb->state = JITTER_DONE;
+                break;
+            }
+            jb->underruns++;
+            jitter_conceal_start(jb);
+            jb->state = JITTER_STALLED;
+            continue;
+        }
+
+        int32_t s = jitter_take(jb);
+        /* follow the target a sample at a time, as the mean of two neighbours */
+        int32_t target = (int32_t)jb->target << JITTER_LEVEL_SHIFT;
+        int32_t hysteresis = (int32_t)jb->hysteresis << JITTER_LEVEL_SHIFT;
+        int32_t catchup = target + ((int32_t)(jb->max >> 1) << JITTER_LEVEL_SHIFT);
+        uint32_t interval = jb->level > catchup ? JITTER_ADJUST_INTERVAL / JITTER_CATCHUP : JITTER_ADJUST_INTERVAL;
+        if (++jb->since_adjust >= interval) {
+            if (jb->level > target + hysteresis && jb->count) {
+                s = (s + jitter_take(jb)) >> 1;
+                jb->level -= 1 << JITTER_LEVEL_SHIFT;
+                jb->since_adjust = 0;
+                jb->adjusted++;
+            } else if (jb->level < target - hysteresis) {
+                /* play the mean of the last sample and this one, and this one next time */
+                jb->rd = jb->rd ? jb->rd - 1 : jb->size - 1;
+                jb->count++;
+                s = (jb->last + s) >> 1;
+                jb->level += 1 << JITTER_LEVEL_SHIFT;
+                jb->since_adjust = 0;
+                jb->adjusted++;
+            }
+        }
+        /* the neighbour of the next adjustment is the stream sample, not the cross-fade */
+        jb->last = s;
+        if (jb->fade_pos < jb->fade_len) {
+            s = (s * (int32_t)jb->fade_pos + jitter_conceal_next(jb) * (int32_t)(jb->fade_len - jb->fade_pos)) / (int32_t)jb->fade_len;
+            jb->fade_pos++;
+        }
+
+        out[i++] = s;
+        jb->hist[jb->hist_pos] = s;
+        jb->hist_pos = jb->hist_pos + 1 == jb->hist_len ? 0 : jb->hist_pos + 1;
+    }
+    return i;
+}
+
+bool jitter_buffer_done(const jitter_buffer_t *jb)
+{
+    return jb->state == JITTER_DONE;
+}
+
+void jitter_buffer_get_stats(const jitter_buffer_t *jb, jitter_buffer_stats_t *stats)
+{
+    stats->target_ms = samples_to_ms(jb->target, jb->rate);
+    stats->depth_ms = samples_to_ms(jb->count, jb->rate);
+    stats->jitter_ms = samples_to_ms(jb->jitter, jb->rate);
+    stats->latency_ms = samples_to_ms(jb->latency >> JITTER_LEVEL_SHIFT, jb->rate);
+    stats->packets = jb->packets;
+    stats->underruns = jb->underruns;
+    stats->concealed = jb->concealed;
+    stats->dropped = jb->dropped;
+    stats->adjusted = jb->adjusted;
+}
@@ -0,0 +1,292 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "mixer.h"
+
+static const char *TAG = "mixer";
+
+#define MIXER_RAMP_SHIFT    8       /* levels carry 8 bits below Q15, so a slow ramp still moves every frame */
+
+struct mixer_source {
+    mixer_source_config_t config;
+    bool used;
+    bool ducked;
+    int32_t level;              /* gain at the end of the last block, Q15 << MIXER_RAMP_SHIFT */
+    uint32_t frames;
+    uint32_t clipped;
+};
+
+struct mixer {
+    uint32_t channels;
+    uint32_t block_frames;
+    int32_t attack_step;        /* most a level falls in a frame */
+    int32_t release_step;       /* most a level rises in a frame */
+    SemaphoreHandle_t lock;
+    uint32_t frames;
+    uint32_t clipped;
+    mixer_source_t sources[MIXER_SOURCES_MAX];
+    int32_t acc[MIXER_BLOCK_SAMPLES];
+    int16_t block[MIXER_BLOCK_SAMPLES];
+};
+
+int32_t mixer_gain_from_db(float db)
+{
+    float gain = MIXER_GAIN_UNITY * powf(10.0f, db / 20.0f);
+    return gain < MIXER_GAIN_MAX ? (int32_t)lrintf(gain) : MIXER_GAIN_MAX;
+}
+
+/* level change per frame for a unity change in ms */
+static int32_t mixer_ramp_step(uint32_t ms, uint32_t rate)
+{
+    uint64_t frames = (uint64_t)ms * rate / 1000;
+    int32_t full = (int32_t)MIXER_GAIN_MAX << MIXER_RAMP_SHIFT;
+
+    if (!frames) {
+        return full;
+    }
+    int32_t step = ((int32_t)MIXER_GAIN_UNITY << MIXER_RAMP_SHIFT) / frames;
+    return step ? step : 1;
+}
+
+static bool mixer_gain_valid(int32_t gain)
+{
+    return gain >= 0 && gain <= MIXER_GAIN_MAX;
+}
+
+/* selects rather than branches, clipping is as likely as not in loud passages */
+static inline int32_t mixer_clamp(int32_t v, int32_t limit)
+{
+    return v > limit ? limit : v < -limit ? -limit : v;
+}
+
+/* add samples scaled by a constant gain, clipped to +-limit, returns the samples clipped */
+static uint32_t mixer_add(int32_t *acc, const int16_t *in, size_t n, int32_t gain, int32_t limit)
+{
+    uint32_t clipped = 0;
+
+    if (gain == MIXER_GAIN_UNITY && limit == MIXER_LIMIT_NONE) {
+        for (size_t i = 0; i < n; i++) {
+            acc[i] += in[i];
+        }
+    } else if (gain <= MIXER_GAIN_UNITY && limit == MIXER_LIMIT_NONE) {
+        /* at most unity nothing can pass the limit */
+        for (size_t i = 0; i < n; i++) {
+            acc[i] += in[i] * gain >> 15;
+        }
+    } else {
+        for (size_t i = 0; i < n; i++) {
+            int32_t v = in[i] * gain >> 15;
+            int32_t sat = mixer_clamp(v, limit);
+            clipped += sat != v;
+            acc[i] += sat;
+        }
+    }
+    return clipped;
+}
+
+/* add frames with the gain moving by step every frame */
+static uint32_t mixer_add_ramp(int32_t *acc, const int16_t *in, size_t frames, uint32_t channels,
+                               int32_t level, int32_t step, int32_t limit)
+{
+    uint32_t clipped = 0;
+
+    for (size_t f = 0; f < frames; f++) {
+        level += step;
+        int32_t gain = level >> MIXER_RAMP_SHIFT;
+        for (uint32_t c = 0; c < channels; c++) {
+            int32_t v = *in++ * gain >> 15;
+            int32_t sat = mixer_clamp(v, limit);
+            clipped += sat != v;
+            *acc++ += sat;
+        }
+    }
+    return clipped;
+}
+
+/* read one block of a source into the accumulator, returns whether it gave anything */
+static bool mixer_source_block(mixer_t *mixer, mixer_source_t *src, size_t frames, bool duck)
+{
+    size_t n = src->config.read(src->config.ctx, mixer->block, frames);
+    if (n > frames) {
+        n = frames;
+    }
+
+    /* the level follows the gain, ducked or not, even while the source is silent */
+    int64_t target = src->config.gain;
+    if (duck) {
+        target = target * src->config.duck_gain >> 15;
+    }
+    target <<= MIXER_RAMP_SHIFT;
+    int64_t level = src->level;
+    int64_t room = (int64_t)(target > level ? mixer->release_step : mixer->attack_step) * frames;
+    int64_t next = target > level + room ? level + room : target < level - room ? level - room : target;
+
+    if (n && next == level) {
+        int32_t gain = level >> MIXER_RAMP_SHIFT;
+        if (gain) {
+            src->clipped += mixer_add(mixer->acc, mixer->block, n * mixer->channels, gain, src->config.limit);
+        }
+    } else if (n) {
+        src->clipped += mixer_add_ramp(mixer->acc, mixer->block, n, mixer->channels, level,
+                                       (int32_t)((next - level) / (int64_t)frames), src->config.limit);
+    }
+    src->level = next;
+    src->ducked = duck;
+    src->frames += n;
+    return n > 0;
+}
+
+esp_err_t mixer_create(const mixer_config_t *config, mixer_t **ret)
+{
+    if (!config->sample_rate || config->channels < 1 || config->channels > 8) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    mixer_t *mixer = (mixer_t *)calloc(1, sizeof(mixer_t));
+    if (!mixer) {
+        return ESP_ERR_NO_MEM;
+    }
+    mixer->lock = xSemaphoreCreateMutex();
+    if (!mixer->lock) {
+        free(mixer);
+        return ESP_ERR_NO_MEM;
+    }
+    mixer->channels = config->channels;
+    mixer->block_frames = MIXER_BLOCK_SAMPLES / config->channels;
+    mixer->attack_step = mixer_ramp_step(config->attack_ms, config->sample_rate);
+    mixer->release_step = mixer_ramp_step(config->release_ms, config->sample_rate);
+
+    ESP_LOGI(TAG, "%lu Hz, %lu channels, %lu frames per block", config->sample_rate, mixer->channels, mixer->block_frames);
+    *ret = mixer;
+    return ESP_OK;
+}
+
+void mixer_delete(mixer_t *mixer)
+{
+    if (mixer) {
+        vSemaphoreDelete(mixer->lock);
+        free(mixer);
+    }
+}
+
+esp_err_t mixer_add_source(mixer_t *mixer, const mixer_source_config_t *config, mixer_source_t **ret)
+{
+    if (!config->read || !mixer_gain_valid(config->gain) || !mixer_gain_valid(config->duck_gain)
+            || config->limit < 1 || config->limit > MIXER_LIMIT_NONE) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_err_t err = ESP_ERR_NO_MEM;
+
+    xSemaphoreTake(mixer->lock, portMAX_DELAY);
+    for (size_t i = 0; i < MIXER_SOURCES_MAX; i++) {
+        mixer_source_t *src = &mixer->sources[i];
+        if (!src->used) {
+            memset(src, 0, sizeof(mixer_source_t));
+            src->config = *config;
+            src->level = config->gain << MIXER_RAMP_SHIFT;
+            src->used = true;
+            if (ret) {
+                *ret = src;
+            }
+            err = ESP_OK;
+            break;
+        }
+    }
+    xSemaphoreGive(mixer->lock);
+
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "no room for source %s", config->name ? config->name : "");
+    }
+    return err;
+}
+
+void mixer_remove_source(mixer_t *mixer, mixer_source_t *source)
+{
+    if (source) {
+        xSemaphoreTake(mixer->lock, portMAX_DELAY);
+        source->used = false;
+        xSemaphoreGive(mixer->lock);
+    }
+}
+
+esp_err_t mixer_set_gain(mixer_t *mixer, mixer_source_t *source, int32_t gain)
+{
+    if (!mixer_gain_valid(gain)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    xSemaphoreTake(mixer->lock, portMAX_DELAY);
+    source->config.gain = gain;
+    xSemaphoreGive(mixer->lock);
+    return ESP_OK;
+}
+
+size_t mixer_mix(mixer_t *mixer, int16_t *out, size_t frames)
+{
+    uint32_t played = 0;
+
+    xSemaphoreTake(mixer->lock, portMAX_DELAY);
+    while (frames) {
+        size_t n = frames < mixer->block_frames ? frames : mixer->block_frames;
+        size_t samples = n * mixer->channels;
+        memset(mixer->acc, 0, samples * sizeof(int32_t));
+
+        /* ducking sources first, whether one of them plays decides the gain of the others */
+        bool duck = false;
+        for (size_t i = 0; i < MIXER_SOURCES_MAX; i++) {
+            mixer_source_t *src = &mixer->sources[i];
+            if (src->used && src->config.ducks && mixer_source_block(mixer, src, n, false)) {
+                played |= 1 << i;
+                duck = true;
+            }
+        }
+        for (size_t i = 0; i < MIXER_SOURCES_MAX; i++) {
+            mixer_source_t *src = &mixer->sources[i];
+            if (src->used && !src->config.ducks && mixer_source_block(mixer, src, n, duck)) {
+                played |= 1 << i;
+            }
+        }
+
+        uint32_t clipped = 0;
+        for (size_t i = 0; i < samples; i++) {
+            int32_t v = mixer->acc[i];
+            int16_t sat = v > INT16_MAX ? INT16_MAX : v < INT16_MIN ? INT16_MIN : v;
+            clipped += sat != v;
+            out[i] = sat;
+        }
+        mixer->clipped += clipped;
+        out += samples;
+        frames -= n;
+        mixer->frames += n;
+    }
+    xSemaphoreGive(mixer->lock);
+
+    return __builtin_popcount(played);
+}
+
+void mixer_get_stats(mixer_t *mixer, mixer_stats_t *stats)
+{
+    memset(stats, 0, sizeof(mixer_stats_t));
+
+    xSemaphoreTake(mixer->lock, portMAX_DELAY);
+    stats->frames = mixer->frames;
+    stats->clipped = mixer->clipped;
+    for (size_t i = 0; i < MIXER_SOURCES_MAX; i++) {
+        mixer_source_t *src = &mixer->sources[i];
+        if (src->used) {
+            stats->sources[i].name = src->config.name ? src->config.name : "";
+            stats->sources[i].frames = src->frames;
+            stats->sources[i].clipped = src->clipped;
+            stats->sources[i].level = src->level >> MIXER_RAMP_SHIFT;
+            stats->sources[i].ducked = src->ducked;
+        }
+    }
+    xSemaphoreGive(mixer->lock);
+}
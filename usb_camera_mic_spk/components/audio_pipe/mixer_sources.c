@@ -0,0 +1,164 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include "resampler.h"
+#include "pcm_convert.h"
+#include "mixer.h"
+#include "mixer_sources.h"
+
+#define MIXER_SINE_BITS     8       /* 256 points per period */
+#define MIXER_PROMPT_DECODE 256     /* prompt samples decoded at a time when resampling */
+
+/* one period of a full scale sine, the first point repeated at the end */
+static int16_t s_sine[(1 << MIXER_SINE_BITS) + 1];
+
+void mixer_tone_init(mixer_tone_t *tone, uint32_t sample_rate, uint32_t channels, uint32_t freq, int32_t amplitude)
+{
+    /* the peak stays 0 until the table is filled */
+    if (!s_sine[1 << (MIXER_SINE_BITS - 2)]) {
+        for (int i = 0; i <= 1 << MIXER_SINE_BITS; i++) {
+            s_sine[i] = (int16_t)lrintf(32767.0f * sinf(2.0f * (float)M_PI * i / (1 << MIXER_SINE_BITS)));
+        }
+    }
+    tone->phase = 0;
+    tone->step = (uint32_t)(((uint64_t)freq << 32) / sample_rate);
+    tone->amplitude = amplitude;
+    tone->channels = channels;
+}
+
+size_t mixer_tone_read(void *ctx, int16_t *out, size_t frames)
+{
+    mixer_tone_t *tone = (mixer_tone_t *)ctx;
+    uint32_t phase = tone->phase;
+
+    for (size_t f = 0; f < frames; f++) {
+        uint32_t i = phase >> (32 - MIXER_SINE_BITS);
+        int32_t frac = (phase >> (16 - MIXER_SINE_BITS)) & 0xFFFF;
+        int32_t v = s_sine[i] + ((s_sine[i + 1] - s_sine[i]) * frac >> 16);
+        v = v * tone->amplitude >> 15;
+        for (uint32_t c = 0; c < tone->channels; c++) {
+            *out++ = v;
+        }
+        phase += tone->step;
+    }
+    tone->phase = phase;
+    return frames;
+}
+
+struct mixer_prompt {
+    const prompt_t *prompt;
+    prompt_reader_t reader;
+    resampler_t *rs;            /* NULL when the prompt is at the mixer rate */
+    uint32_t channels;
+    bool loop;
+    bool done;
+    uint32_t gap_frames;
+    uint32_t gap_left;          /* frames of silence before the next loop */
+    size_t len;                 /* samples in decoded */
+    size_t pos;                 /* of them fed to the resampler */
+    int16_t decoded[MIXER_PROMPT_DECODE];
+    int16_t mono[MIXER_BLOCK_SAMPLES];
+};
+
+static void mixer_prompt_rewind(mixer_prompt_t *player)
+{
+    prompt_reader_init(&player->reader, player->prompt);
+    if (player->rs) {
+        resampler_reset(player->rs);
+    }
+    player->len = 0;
+    player->pos = 0;
+}
+
+esp_err_t mixer_prompt_create(const mixer_prompt_config_t *config, mixer_prompt_t **ret)
+{
+    if (!config->prompt || config->channels < 1 || config->channels > PCM_CHANNELS_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    mixer_prompt_t *player = (mixer_prompt_t *)calloc(1, sizeof(mixer_prompt_t));
+    if (!player) {
+        return ESP_ERR_NO_MEM;
+    }
+    if (config->prompt->sample_rate != config->sample_rate) {
+        esp_err_t err = resampler_create(config->prompt->sample_rate, config->sample_rate, &player->rs);
+        if (err != ESP_OK) {
+            free(player);
+            return err;
+        }
+    }
+    player->prompt = config->prompt;
+    player->channels = config->channels;
+    player->loop = config->loop;
+    player->gap_frames = (uint64_t)config->gap_ms * config->sample_rate / 1000;
+    mixer_prompt_rewind(player);
+
+    *ret = player;
+    return ESP_OK;
+}
+
+void mixer_prompt_delete(mixer_prompt_t *player)
+{
+    if (player) {
+        resampler_delete(player->rs);
+        free(player);
+    }
+}
+
+size_t mixer_prompt_read(void *ctx, int16_t *out, size_t frames)
+{
+    mixer_prompt_t *player = (mixer_prompt_t *)ctx;
+
+    if (player->done) {
+        return 0;
+    }
+    if (player->gap_left) {
+        player->gap_left = frames < player->gap_left ? player->gap_left - frames : 0;
+        if (!player->gap_left) {
+            mixer_prompt_rewind(player);
+        }
+        return 0;
+    }
+    if (frames > MIXER_BLOCK_SAMPLES) {
+        frames = MIXER_BLOCK_SAMPLES;
+    }
+
+    /* decode, and resample if the rates differ; mono needs no spreading and goes straight out */
+    int16_t *mono = player->channels == 1 ? out : player->mono;
+    size_t n = 0;
+    if (!player->rs) {
+        n = prompt_read(&player->reader, mono, frames);
+    }
+    while (player->rs && n < frames) {
+        if (player->pos == player->len) {
+            player->len = prompt_read(&player->reader, player->decoded, MIXER_PROMPT_DECODE);
+            player->pos = 0;
+            if (!player->len) {
+                break;
+            }
+        }
+        size_t in_len = player->len - player->pos;
+        n += resampler_process(player->rs, player->decoded + player->pos, &in_len, mono + n, frames - n);
+        player->pos += in_len;
+    }
+
+    /* short of frames only at the end of the prompt */
+    if (n < frames) {
+        if (!player->loop) {
+            player->done = true;
+        } else if (player->gap_frames) {
+            player->gap_left = player->gap_frames;
+        } else {
+            mixer_prompt_rewind(player);
+        }
+    }
+    if (n && player->channels > 1) {
+        pcm_mono_to_multi(player->mono, out, player->channels, n);
+    }
+    return n;
+}
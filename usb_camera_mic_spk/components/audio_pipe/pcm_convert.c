@@ -0,0 +1,553 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "pcm_convert.h"
+
+#define PCM_BLOCK_SAMPLES   128     /* samples per pass through the scratch buffers, 64 stereo frames */
+
+/* word access to sample buffers of other types, only on word aligned addresses */
+typedef uint32_t __attribute__((may_alias)) pcm_word_t;
+
+static inline bool pcm_aligned(const void *a, const void *b)
+{
+    return !(((uintptr_t)a | (uintptr_t)b) & 3);
+}
+
+void pcm_dither_init(pcm_dither_t *dither, uint32_t seed)
+{
+    dither->state = seed ? seed : 0x2545F491;
+}
+
+/* triangular noise over +-1 LSB of the result plus half an LSB, so the shift rounds */
+static inline int32_t pcm_dither_noise(pcm_dither_t *dither, uint32_t shift)
+{
+    uint32_t x = dither->state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    dither->state = x;
+
+    int32_t mask = (1 << shift) - 1;
+    return (int32_t)(x & mask) + (int32_t)((x >> 16) & mask) - mask + (1 << (shift - 1));
+}
+
+/* drop shift bits, dithered if asked, without overflowing for 32-bit input */
+static inline int32_t pcm_narrow(int32_t x, uint32_t shift, pcm_dither_t *dither)
+{
+    if (!dither) {
+        return x >> shift;
+    }
+    int32_t low = (x & ((1 << shift) - 1)) + pcm_dither_noise(dither, shift);
+    return (x >> shift) + (low >> shift);
+}
+
+static inline int16_t pcm_sat16(int32_t x)
+{
+    return x > INT16_MAX ? INT16_MAX : x < INT16_MIN ? INT16_MIN : x;
+}
+
+static inline uint8_t pcm_sat8(int32_t x)
+{
+    return (uint8_t)(x > INT8_MAX ? INT8_MAX : x < INT8_MIN ? INT8_MIN : x);
+}
+
+/* 1/n in Q15, rounded up so that 1, 2 and 4 channels come out exact */
+static const int32_t s_mix_recip[PCM_CHANNELS_MAX + 1] = { 0, 32768, 16384, 10923, 8192, 6554, 5462, 4682, 4096 };
+
+/* average of the channels of a frame, the sum times the reciprocal stays below 2^31 */
+static inline int16_t pcm_mix(const int16_t *frame, uint32_t channels)
+{
+    int32_t sum = 0;
+
+    for (uint32_t c = 0; c < channels; c++) {
+        sum += frame[c];
+    }
+    return pcm_sat16(sum * s_mix_recip[channels] >> 15);
+}
+
+/* ------------------------------ reference ------------------------------ */
+
+void pcm_flip_sign_ref(void *buf, uint32_t bits, size_t samples)
+{
+    uint8_t *p = (uint8_t *)buf + bits / 8 - 1;
+
+    for (size_t i = 0; i < samples; i++) {
+        p[i * (bits / 8)] ^= 0x80;
+    }
+}
+
+void pcm_decode_8_ref(const uint8_t *in, int16_t *out, size_t n, bool is_unsigned)
+{
+    uint8_t flip = is_unsigned ? 0x80 : 0;
+
+    for (size_t i = 0; i < n; i++) {
+        out[i] = (int16_t)((in[i] ^ flip) << 8);
+    }
+}
+
+void pcm_decode_24_ref(const uint8_t *in, int16_t *out, size_t n, pcm_dither_t *dither)
+{
+    for (size_t i = 0; i < n; i++, in += 3) {
+        int32_t x = (int32_t)((uint32_t)in[0] << 8 | (uint32_t)in[1] << 16 | (uint32_t)in[2] << 24) >> 8;
+        out[i] = pcm_sat16(pcm_narrow(x, 8, dither));
+    }
+}
+
+void pcm_decode_32_ref(const int32_t *in, int16_t *out, size_t n, pcm_dither_t *dither)
+{
+    for (size_t i = 0; i < n; i++) {
+        out[i] = pcm_sat16(pcm_narrow(in[i], 16, dither));
+    }
+}
+
+void pcm_encode_8_ref(const int16_t *in, uint8_t *out, size_t n, bool is_unsigned, pcm_dither_t *dither)
+{
+    uint8_t flip = is_unsigned ? 0x80 : 0;
+
+    for (size_t i = 0; i < n; i++) {
+        out[i] = pcm_sat8(pcm_narrow(in[i], 8, dither)) ^ flip;
+    }
+}
+
+void pcm_encode_24_ref(const int16_t *in, uint8_t *out, size_t n)
+{
+    for (size_t i = 0; i < n; i++, out += 3) {
+        out[0] = 0;
+        out[1] = (uint8_t)in[i];
+        out[2] = (uint8_t)(in[i] >> 8);
+    }
+}
+
+void pcm_encode_32_ref(const int16_t *in, int32_t *out, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        out[i] = (int32_t)((uint32_t)(uint16_t)in[i] << 16);
+    }
+}
+
+void pcm_mono_to_stereo_ref(const int16_t *in, int16_t *out, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        out[2 * i] = in[i];
+        out[2 * i + 1] = in[i];
+    }
+}
+
+void pcm_stereo_to_mono_ref(const int16_t *in, int16_t *out, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        out[i] = (in[2 * i] + in[2 * i + 1]) >> 1;
+    }
+}
+
+void pcm_mono_to_multi_ref(const int16_t *in, int16_t *out, uint32_t channels, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        for (uint32_t c = 0; c < channels; c++) {
+            *out++ = in[i];
+        }
+    }
+}
+
+void pcm_multi_to_mono_ref(const int16_t *in, int16_t *out, uint32_t channels, size_t n)
+{
+    for (size_t i = 0; i < n; i++, in += channels) {
+        out[i] = pcm_mix(in, channels);
+    }
+}
+
+void pcm_remap_ref(const int16_t *in, uint32_t in_ch, int16_t *out, uint32_t out_ch, const uint8_t *map, size_t n)
+{
+    for (size_t i = 0; i < n; i++, in += in_ch) {
+        for (uint32_t c = 0; c < out_ch; c++) {
+            *out++ = map[c] == PCM_CHANNEL_MIX ? pcm_mix(in, in_ch) : in[map[c]];
+        }
+    }
+}
+
+/* ------------------------------ word at a time ------------------------------
+ * Four samples per step on word aligned buffers, the rest and unaligned
+ * buffers go to the reference version. Dither is drawn in sample order, so
+ * the output matches the reference bit for bit.
+ */
+
+void pcm_flip_sign(void *buf, uint32_t bits, size_t samples)
+{
+    size_t blocks = (uintptr_t)buf & 3 ? 0 : samples / 4;
+    pcm_word_t *w = (pcm_word_t *)buf;
+
+    switch (bits) {
+    case 8:
+        for (size_t i = 0; i < blocks; i++) {
+            w[i] ^= 0x80808080;
+        }
+        break;
+    case 16:
+        for (size_t i = 0; i < blocks; i++) {
+            w[2 * i] ^= 0x80008000;
+            w[2 * i + 1] ^= 0x80008000;
+        }
+        break;
+    case 24:
+        for (size_t i = 0; i < blocks; i++) {
+            w[3 * i] ^= 0x00800000;
+            w[3 * i + 1] ^= 0x00008000;
+            w[3 * i + 2] ^= 0x80000080;
+        }
+        break;
+    case 32:
+        for (size_t i = 0; i < blocks * 4; i++) {
+            w[i] ^= 0x80000000;
+        }
+        break;
+    default:
+        return;
+    }
+    pcm_flip_sign_ref((uint8_t *)buf + blocks * bits / 2, bits, samples - blocks * 4);
+}
+
+void pcm_decode_8(const uint8_t *in, int16_t *out, size_t n, bool is_unsigned)
+{
+    size_t blocks = pcm_aligned(in, out) ? n / 4 : 0;
+    const pcm_word_t *src = (const pcm_word_t *)in;
+    pcm_word_t *dst = (pcm_word_t *)out;
+    uint32_t flip = is_unsigned ? 0x80808080 : 0;
+
+    for (size_t i = 0; i < blocks; i++) {
+        uint32_t w = src[i] ^ flip;
+        dst[2 * i] = (w & 0xFF) << 8 | (w & 0xFF00) << 16;
+        dst[2 * i + 1] = (w & 0xFF0000) >> 8 | (w & 0xFF000000);
+    }
+    pcm_decode_8_ref(in + blocks * 4, out + blocks * 4, n - blocks * 4, is_unsigned);
+}
+
+void pcm_decode_24(const uint8_t *in, int16_t *out, size_t n, pcm_dither_t *dither)
+{
+    size_t blocks = pcm_aligned(in, out) ? n / 4 : 0;
+    const pcm_word_t *src = (const pcm_word_t *)in;
+    pcm_word_t *dst = (pcm_word_t *)out;
+
+    for (size_t i = 0; i < blocks; i++, src += 3, dst += 2) {
+        uint32_t w0 = src[0];
+        uint32_t w1 = src[1];
+        uint32_t w2 = src[2];
+        if (!dither) {
+            /* the upper two bytes of each three */
+            dst[0] = (w0 >> 8 & 0xFFFF) | w1 << 16;
+            dst[1] = (w1 >> 24 | (w2 & 0xFF) << 8) | (w2 & 0xFFFF0000);
+        } else {
+            int32_t x0 = (int32_t)(w0 << 8) >> 8;
+            int32_t x1 = (int32_t)((w0 >> 24 | w1 << 8) << 8) >> 8;
+            int32_t x2 = (int32_t)((w1 >> 16 | w2 << 16) << 8) >> 8;
+            int32_t x3 = (int32_t)w2 >> 8;
+            uint16_t s0 = pcm_sat16(pcm_narrow(x0, 8, dither));
+            uint16_t s1 = pcm_sat16(pcm_narrow(x1, 8, dither));
+            uint16_t s2 = pcm_sat16(pcm_narrow(x2, 8, dither));
+            uint16_t s3 = pcm_sat16(pcm_narrow(x3, 8, dither));
+            dst[0] = s0 | (uint32_t)s1 << 16;
+            dst[1] = s2 | (uint32_t)s3 << 16;
+        }
+    }
+    pcm_decode_24_ref(in + blocks * 12, out + blocks * 4, n - blocks * 4, dither);
+}
+
+void pcm_decode_32(const int32_t *in, int16_t *out, size_t n, pcm_dither_t *dither)
+{
+    size_t blocks = pcm_aligned(in, out) ? n / 4 : 0;
+    const pcm_word_t *src = (const pcm_word_t *)in;
+    pcm_word_t *dst = (pcm_word_t *)out;
+
+    for (size_t i = 0; i < blocks; i++, src += 4, dst += 2) {
+        if (!dither) {
+            dst[0] = src[0] >> 16 | (src[1] & 0xFFFF0000);
+            dst[1] = src[2] >> 16 | (src[3] & 0xFFFF0000);
+        } else {
+            uint16_t s0 = pcm_sat16(pcm_narrow((int32_t)src[0], 16, dither));
+            uint16_t s1 = pcm_sat16(pcm_narrow((int32_t)src[1], 16, dither));
+            uint16_t s2 = pcm_sat16(pcm_narrow((int32_t)src[2], 16, dither));
+            uint16_t s3 = pcm_sat16(pcm_narrow((int32_t)src[3], 16, dither));
+            dst[0] = s0 | (uint32_t)s1 << 16;
+            dst[1] = s2 | (uint32_t)s3 << 16;
+        }
+    }
+    pcm_decode_32_ref(in + blocks * 4, out + blocks * 4, n - blocks * 4, dither);
+}
+
+void pcm_encode_8(const int16_t *in, uint8_t *out, size_t n, bool is_unsigned, pcm_dither_t *dither)
+{
+    /* dithered, the noise generator is the bottleneck and word access does not pay */
+    size_t blocks = !dither && pcm_aligned(in, out) ? n / 4 : 0;
+    const pcm_word_t *src = (const pcm_word_t *)in;
+    pcm_word_t *dst = (pcm_word_t *)out;
+    uint32_t flip = is_unsigned ? 0x80808080 : 0;
+
+    for (size_t i = 0; i < blocks; i++, src += 2) {
+        /* the upper byte of each sample */
+        dst[i] = ((src[0] >> 8 & 0xFF) | (src[0] >> 16 & 0xFF00) | (src[1] << 8 & 0xFF0000) | (src[1] & 0xFF000000)) ^ flip;
+    }
+    pcm_encode_8_ref(in + blocks * 4, out + blocks * 4, n - blocks * 4, is_unsigned, dither);
+}
+
+void pcm_encode_24(const int16_t *in, uint8_t *out, size_t n)
+{
+    size_t blocks = pcm_aligned(in, out) ? n / 4 : 0;
+    const pcm_word_t *src = (const pcm_word_t *)in;
+    pcm_word_t *dst = (pcm_word_t *)out;
+
+    for (size_t i = 0; i < blocks; i++, src += 2, dst += 3) {
+        uint32_t w0 = src[0];
+        uint32_t w1 = src[1];
+        dst[0] = (w0 & 0xFFFF) << 8;
+        dst[1] = w0 >> 16 | w1 << 24;
+        dst[2] = (w1 >> 8 & 0xFF) | (w1 & 0xFFFF0000);
+    }
+    pcm_encode_24_ref(in + blocks * 4, out + blocks * 12, n - blocks * 4);
+}
+
+void pcm_encode_32(const int16_t *in, int32_t *out, size_t n)
+{
+    size_t blocks = pcm_aligned(in, out) ? n / 4 : 0;
+    const pcm_word_t *src = (const pcm_word_t *)in;
+    pcm_word_t *dst = (pcm_word_t *)out;
+
+    for (size_t i = 0; i < blocks; i++, src += 2, dst += 4) {
+        uint32_t w0 = src[0];
+        uint32_t w1 = src[1];
+        dst[0] = w0 << 16;
+        dst[1] = w0 & 0xFFFF0000;
+        dst[2] = w1 << 16;
+        dst[3] = w1 & 0xFFFF0000;
+    }
+    pcm_encode_32_ref(in + blocks * 4, out + blocks * 4, n - blocks * 4);
+}
+
+void pcm_mono_to_stereo(const int16_t *in, int16_t *out, size_t n)
+{
+    size_t blocks = pcm_aligned(in, out) ? n / 4 : 0;
+    const pcm_word_t *src = (const pcm_word_t *)in;
+    pcm_word_t *dst = (pcm_word_t *)out;
+
+    for (size_t i = 0; i < blocks; i++, src += 2, dst += 4) {
+        uint32_t w0 = src[0];
+        uint32_t w1 = src[1];
+        dst[0] = (w0 & 0xFFFF) * 0x10001;
+        dst[1] = (w0 >> 16) * 0x10001;
+        dst[2] = (w1 & 0xFFFF) * 0x10001;
+        dst[3] = (w1 >> 16) * 0x10001;
+    }
+    pcm_mono_to_stereo_ref(in + blocks * 4, out + blocks * 8, n - blocks * 4);
+}
+
+void pcm_stereo_to_mono(const int16_t *in, int16_t *out, size_t n)
+{
+    /* the two halves of a word do not add lane by lane, gathering them costs more than it saves */
+    pcm_stereo_to_mono_ref(in, out, n);
+}
+
+void pcm_mono_to_multi(const int16_t *in, int16_t *out, uint32_t channels, size_t n)
+{
+    /* with an even number of channels a frame is whole words of one sample twice */
+    size_t blocks = pcm_aligned(in, out) && !(channels & 1) ? n / 2 : 0;
+    const pcm_word_t *src = (const pcm_word_t *)in;
+    pcm_word_t *dst = (pcm_word_t *)out;
+    uint32_t pairs = channels / 2;
+
+    if (channels == 2) {
+        pcm_mono_to_stereo(in, out, n);
+        return;
+    }
+    for (size_t i = 0; i < blocks; i++) {
+        uint32_t w = src[i];
+        uint32_t lo = (w & 0xFFFF) * 0x10001;
+        uint32_t hi = (w >> 16) * 0x10001;
+        for (uint32_t k = 0; k < pairs; k++) {
+            dst[k] = lo;
+            dst[pairs + k] = hi;
+        }
+        dst += channels;
+    }
+    pcm_mono_to_multi_ref(in + blocks * 2, out + blocks * 2 * channels, channels, n - blocks * 2);
+}
+
+void pcm_multi_to_mono(const int16_t *in, int16_t *out, uint32_t channels, size_t n)
+{
+    /* like stereo, the channels of a frame do not add lane by lane */
+    if (channels == 2) {
+        pcm_stereo_to_mono(in, out, n);
+    } else {
+        pcm_multi_to_mono_ref(in, out, channels, n);
+    }
+}
+
+void pcm_remap(const int16_t *in, uint32_t in_ch, int16_t *out, uint32_t out_ch, const uint8_t *map, size_t n)
+{
+    /* one word per output pair when each pair is an input pair or one input channel twice */
+    uint8_t from[PCM_CHANNELS_MAX / 2];
+    bool dup[PCM_CHANNELS_MAX / 2];
+    uint32_t pairs = out_ch / 2;
+    bool words = pcm_aligned(in, out) && !((in_ch | out_ch) & 1);
+
+    for (uint32_t k = 0; k < pairs && words; k++) {
+        uint8_t l = map[2 * k];
+        uint8_t r = map[2 * k + 1];
+        from[k] = l;
+        dup[k] = l == r;
+        words = l != PCM_CHANNEL_MIX && (l == r || (!(l & 1) && r == l + 1));
+    }
+    if (!words) {
+        pcm_remap_ref(in, in_ch, out, out_ch, map, n);
+        return;
+    }
+
+    const pcm_word_t *src = (const pcm_word_t *)in;
+    pcm_word_t *dst = (pcm_word_t *)out;
+    for (size_t i = 0; i < n; i++, in += in_ch, src += in_ch / 2, dst += pairs) {
+        for (uint32_t k = 0; k < pairs; k++) {
+            dst[k] = dup[k] ? (uint32_t)(uint16_t)in[from[k]] * 0x10001 : src[from[k] / 2];
+        }
+    }
+}
+
+/* ------------------------------ frames ------------------------------ */
+
+static bool pcm_format_valid(const pcm_format_t *format)
+{
+    return (format->bits == 8 || format->bits == 16 || format->bits == 24 || format->bits == 32)
+           && format->channels >= 1 && format->channels <= PCM_CHANNELS_MAX;
+}
+
+void pcm_channel_map_default(uint32_t in_ch, uint32_t out_ch, uint8_t *map)
+{
+    for (uint32_t c = 0; c < out_ch; c++) {
+        map[c] = in_ch == out_ch ? c : out_ch == 1 ? PCM_CHANNEL_MIX : c % in_ch;
+    }
+}
+
+typedef enum {
+    PCM_LAYOUT_SAME,            /* channel to channel */
+    PCM_LAYOUT_SPREAD,          /* mono to every channel */
+    PCM_LAYOUT_MIX,             /* all channels averaged to mono */
+    PCM_LAYOUT_REMAP,           /* anything else */
+} pcm_layout_t;
+
+static pcm_layout_t pcm_layout(uint32_t in_ch, uint32_t out_ch, const uint8_t *map)
+{
+    bool same = in_ch == out_ch;
+    bool spread = in_ch == 1;
+
+    for (uint32_t c = 0; c < out_ch; c++) {
+        same = same && map[c] == c;
+        /* the average of one channel is that channel */
+        spread = spread && (map[c] == 0 || map[c] == PCM_CHANNEL_MIX);
+    }
+    if (same) {
+        return PCM_LAYOUT_SAME;
+    }
+    if (spread) {
+        return PCM_LAYOUT_SPREAD;
+    }
+    return out_ch == 1 && map[0] == PCM_CHANNEL_MIX ? PCM_LAYOUT_MIX : PCM_LAYOUT_REMAP;
+}
+
+esp_err_t pcm_convert(const void *in, const pcm_format_t *in_fmt, void *out, const pcm_format_t *out_fmt,
+                      size_t frames, pcm_dither_t *dither)
+{
+    return pcm_convert_map(in, in_fmt, out, out_fmt, NULL, frames, dither);
+}
+
+esp_err_t pcm_convert_map(const void *in, const pcm_format_t *in_fmt, void *out, const pcm_format_t *out_fmt,
+                          const uint8_t *map, size_t frames, pcm_dither_t *dither)
+{
+    int16_t a[PCM_BLOCK_SAMPLES] __attribute__((aligned(4)));
+    int16_t b[PCM_BLOCK_SAMPLES] __attribute__((aligned(4)));
+    uint8_t default_map[PCM_CHANNELS_MAX];
+    const uint8_t *src = (const uint8_t *)in;
+    uint8_t *dst = (uint8_t *)out;
+
+    if (!pcm_format_valid(in_fmt) || !pcm_format_valid(out_fmt)) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    uint32_t in_ch = in_fmt->channels;
+    uint32_t out_ch = out_fmt->channels;
+    if (!map) {
+        pcm_channel_map_default(in_ch, out_ch, default_map);
+        map = default_map;
+    }
+    for (uint32_t c = 0; c < out_ch; c++) {
+        if (map[c] >= in_ch && map[c] != PCM_CHANNEL_MIX) {
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+    pcm_layout_t layout = pcm_layout(in_ch, out_ch, map);
+    size_t block = PCM_BLOCK_SAMPLES / (in_ch > out_ch ? in_ch : out_ch);
+
+    while (frames) {
+        size_t n = frames < block ? frames : block;
+        size_t in_samples = n * in_ch;
+        size_t out_samples = n * out_ch;
+
+        /* to signed 16-bit */
+        switch (in_fmt->bits) {
+        case 8:
+            pcm_decode_8(src, a, in_samples, in_fmt->is_unsigned);
+            break;
+        case 16:
+            memcpy(a, src, in_samples * 2);
+            break;
+        case 24:
+            pcm_decode_24(src, a, in_samples, dither);
+            break;
+        default:
+            pcm_decode_32((const int32_t *)src, a, in_samples, dither);
+            break;
+        }
+        if (in_fmt->is_unsigned && in_fmt->bits != 8) {
+            pcm_flip_sign(a, 16, in_samples);
+        }
+
+        /* channels */
+        const int16_t *s = b;
+        switch (layout) {
+        case PCM_LAYOUT_SAME:
+            s = a;
+            break;
+        case PCM_LAYOUT_SPREAD:
+            pcm_mono_to_multi(a, b, out_ch, n);
+            break;
+        case PCM_LAYOUT_MIX:
+            pcm_multi_to_mono(a, b, in_ch, n);
+            break;
+        default:
+            pcm_remap(a, in_ch, b, out_ch, map, n);
+            break;
+        }
+
+        /* to the output width */
+        switch (out_fmt->bits) {
+        case 8:
+            pcm_encode_8(s, dst, out_samples, out_fmt->is_unsigned, dither);
+            break;
+        case 16:
+            memcpy(dst, s, out_samples * 2);
+            break;
+        case 24:
+            pcm_encode_24(s, dst, out_samples);
+            break;
+        default:
+            pcm_encode_32(s, (int32_t *)dst, out_samples);
+            break;
+        }
+        if (out_fmt->is_unsigned && out_fmt->bits != 8) {
+            pcm_flip_sign(dst, out_fmt->bits, out_samples);
+        }
+
+        src += n * pcm_frame_bytes(in_fmt);
+        dst += n * pcm_frame_bytes(out_fmt);
+        frames -= n;
+    }
+    return ESP_OK;
+}
@@ -0,0 +1,116 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "prompt_store.h"
+#include "prompt_assets.h"
+
+static const char *TAG = "prompt_assets";
+
+esp_err_t prompt_assets_add(const uint8_t *image, size_t len, size_t *added)
+{
+    prompt_assets_header_t header;
+    size_t count = 0;
+
+    if (added) {
+        *added = 0;
+    }
+    if (len < sizeof(header)) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    memcpy(&header, image, sizeof(header));
+    if (header.magic != PROMPT_ASSETS_MAGIC) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    if (header.version != PROMPT_ASSETS_VERSION) {
+        return ESP_ERR_INVALID_VERSION;
+    }
+    if (header.size < sizeof(header) || header.size > len || (header.size - sizeof(header)) / sizeof(prompt_assets_entry_t) < header.count) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    for (size_t i = 0; i < header.count; i++) {
+        /* the name is used where it lies, the numbers are copied out */
+        const uint8_t *field = image + sizeof(header) + i * sizeof(prompt_assets_entry_t);
+        const char *name = (const char *)field;
+        prompt_assets_entry_t entry;
+        memcpy(&entry, field, sizeof(entry));
+
+        if (!memchr(entry.name, '\0', sizeof(entry.name))) {
+            ESP_LOGE(TAG, "entry %u: name is not terminated", i);
+            continue;
+        }
+        if (entry.offset > header.size || entry.length > header.size - entry.offset) {
+            ESP_LOGE(TAG, "%s: out of the image", name);
+            continue;
+        }
+        esp_err_t ret = prompt_store_add(name, image + entry.offset, entry.length);
+        if (ret == ESP_ERR_NO_MEM) {
+            ESP_LOGW(TAG, "prompt store full, %u prompts left out", header.count - i);
+            break;
+        }
+        if (ret == ESP_OK) {
+            count++;
+        }
+    }
+    if (added) {
+        *added = count;
+    }
+    return ESP_OK;
+}
+
+esp_err_t prompt_assets_load(const char *label, size_t *added)
+{
+    prompt_assets_header_t header;
+    const void *image = NULL;
+    esp_partition_mmap_handle_t handle;
+
+    if (added) {
+        *added = 0;
+    }
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+    if (!part) {
+        ESP_LOGW(TAG, "no partition %s", label);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    /* map only what the image spans, an MMU page is 64 KB */
+    esp_err_t ret = esp_partition_read(part, 0, &header, sizeof(header));
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    if (header.magic != PROMPT_ASSETS_MAGIC) {
+        ESP_LOGW(TAG, "no prompts in partition %s", label);
+        return ESP_ERR_NOT_FOUND;
+    }
+    if (header.size < sizeof(header) || header.size > part->size) {
+        ESP_LOGE(TAG, "image of %lu bytes in partition %s of %lu", header.size, label, part->size);
+        return ESP_ERR_INVALID_SIZE;
+    }
+    ret = esp_partition_mmap(part, 0, header.size, ESP_PARTITION_MMAP_DATA, &image, &handle);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "mapping partition %s failed: %s", label, esp_err_to_name(ret));
+        return ret;
+    }
+
+    size_t count = 0;
+    ret = prompt_assets_add(image, header.size, &count);
+    if (ret != ESP_OK || !count) {
+        /* nothing refers to the mapping */
+        esp_partition_munmap(handle);
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "bad image in partition %s: %s", label, esp_err_to_name(ret));
+        return ret;
+    }
+    if (added) {
+        *added = count;
+    }
+    ESP_LOGI(TAG, "%u prompts mapped from partition %s, %lu bytes", count, label, header.size);
+    return ESP_OK;
+}
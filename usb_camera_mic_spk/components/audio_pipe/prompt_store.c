@@ -0,0 +1,151 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "esp_log.h"
+#include "prompt_store.h"
+
+static const char *TAG = "prompt_store";
+
+#define WAV_FORMAT_IMA_ADPCM    0x11
+
+static prompt_t s_prompts[PROMPT_STORE_MAX];
+static size_t s_count;
+
+static uint32_t le16(const uint8_t *p)
+{
+    return p[0] | p[1] << 8;
+}
+
+static uint32_t le32(const uint8_t *p)
+{
+    return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+/* fill in a prompt from the fmt, fact and data chunks of a WAV file */
+static esp_err_t prompt_parse(const uint8_t *wav, size_t len, prompt_t *prompt)
+{
+    const uint8_t *fmt = NULL;
+    const uint8_t *data = NULL;
+    size_t data_len = 0;
+    uint32_t samples = UINT32_MAX;
+
+    if (len < 12 || memcmp(wav, "RIFF", 4) || memcmp(wav + 8, "WAVE", 4)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    for (size_t pos = 12; pos + 8 <= len;) {
+        const uint8_t *chunk = wav + pos;
+        size_t size = le32(chunk + 4);
+        if (size > len - pos - 8) {
+            size = len - pos - 8;
+        }
+        if (!memcmp(chunk, "fmt ", 4) && size >= 16) {
+            fmt = chunk + 8;
+        } else if (!memcmp(chunk, "fact", 4) && size >= 4) {
+            samples = le32(chunk + 8);
+        } else if (!memcmp(chunk, "data", 4)) {
+            data = chunk + 8;
+            data_len = size;
+        }
+        pos += 8 + size + (size & 1);
+    }
+    if (!fmt || !data || le16(fmt) != WAV_FORMAT_IMA_ADPCM || le16(fmt + 2) != 1 || le16(fmt + 14) != 4) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    uint32_t block_align = le16(fmt + 12);
+    if (block_align <= ADPCM_HEADER_SIZE) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    /* a short last block holds what its bytes hold */
+    uint32_t block_samples = adpcm_block_samples(block_align);
+    uint32_t rest = data_len % block_align;
+    uint32_t available = data_len / block_align * block_samples;
+    if (rest > ADPCM_HEADER_SIZE) {
+        available += adpcm_block_samples(rest);
+    } else if (rest) {
+        available += 1;
+    }
+
+    prompt->sample_rate = le32(fmt + 4);
+    prompt->samples = samples < available ? samples : available;
+    prompt->block_align = block_align;
+    prompt->block_samples = block_samples;
+    prompt->data = data;
+    return prompt->sample_rate ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t prompt_store_add(const char *name, const uint8_t *wav, size_t len)
+{
+    prompt_t prompt = { .name = name };
+
+    if (s_count == PROMPT_STORE_MAX) {
+        return ESP_ERR_NO_MEM;
+    }
+    esp_err_t ret = prompt_parse(wav, len, &prompt);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "%s is not a mono IMA ADPCM WAV file", name);
+        return ret;
+    }
+    s_prompts[s_count++] = prompt;
+    ESP_LOGI(TAG, "%s: %lu samples at %lu Hz, %u bytes", name, prompt.samples, prompt.sample_rate, len);
+    return ESP_OK;
+}
+
+const prompt_t *prompt_store_find(const char *name)
+{
+    for (size_t i = 0; i < s_count; i++) {
+        if (!strcmp(s_prompts[i].name, name)) {
+            return &s_prompts[i];
+        }
+    }
+    return NULL;
+}
+
+size_t prompt_store_count(void)
+{
+    return s_count;
+}
+
+const prompt_t *prompt_store_get(size_t i)
+{
+    return i < s_count ? &s_prompts[i] : NULL;
+}
+
+void prompt_reader_init(prompt_reader_t *reader, const prompt_t *prompt)
+{
+    reader->prompt = prompt;
+    reader->sample = 0;
+}
+
+size_t prompt_read(prompt_reader_t *reader, int16_t *out, size_t n)
+{
+    const prompt_t *prompt = reader->prompt;
+    size_t done = 0;
+
+    while (done < n && reader->sample < prompt->samples) {
+        uint32_t in_block = reader->sample % prompt->block_samples;
+        const uint8_t *block = prompt->data + reader->sample / prompt->block_samples * prompt->block_align;
+
+        if (!in_block) {
+            out[done++] = adpcm_block_start(&reader->state, block);
+            reader->sample++;
+            continue;
+        }
+        /* up to the end of the block, of the prompt or of the room left */
+        size_t count = prompt->block_samples - in_block;
+        if (count > prompt->samples - reader->sample) {
+            count = prompt->samples - reader->sample;
+        }
+        if (count > n - done) {
+            count = n - done;
+        }
+        adpcm_decode(&reader->state, block + ADPCM_HEADER_SIZE, in_block - 1, out + done, count);
+        done += count;
+        reader->sample += count;
+    }
+    return done;
+}
@@ -0,0 +1,195 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include "esp_log.h"
+#include "resampler.h"
+
+static const char *TAG = "resampler";
+
+#define RESAMPLER_CUTOFF    0.85f   /* of the lower Nyquist, the transition band ends close to it */
+#define RESAMPLER_BETA      8.0f    /* Kaiser window, about 80 dB stop band */
+#define RESAMPLER_Q         15
+
+struct resampler {
+    uint32_t l;                 /* reduced out_rate, output steps per input sample */
+    uint32_t m;                 /* reduced in_rate */
+    uint32_t phases;            /* phases in the table, l unless interpolated */
+    uint32_t taps;
+    uint64_t phase_scale;       /* phase to table position, Q32 */
+    uint32_t phase;             /* output position past the newest input in 1/l, l before the first input */
+    size_t pos;                 /* newest input in hist */
+    int16_t *coefs;             /* phases + 1 rows of taps, row k applies to the input k samples back */
+    int16_t hist[2 * RESAMPLER_MAX_TAPS];   /* every input twice, taps apart, so a window is contiguous */
+};
+
+static uint32_t gcd(uint32_t a, uint32_t b)
+{
+    while (b) {
+        uint32_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+static float bessel_i0(float x)
+{
+    float sum = 1.0f;
+    float term = 1.0f;
+
+    for (int k = 1; k < 50 && term > sum * 1e-9f; k++) {
+        float f = x / (2.0f * k);
+        term *= f * f;
+        sum += term;
+    }
+    return sum;
+}
+
+/* windowed sinc over phases * taps points, each phase normalized to unity gain */
+static void resampler_design(resampler_t *rs, float cutoff)
+{
+    float center = rs->phases * rs->taps / 2.0f;
+    float i0_beta = bessel_i0(RESAMPLER_BETA);
+    float h[RESAMPLER_MAX_TAPS];
+
+    for (uint32_t p = 0; p <= rs->phases; p++) {
+        int16_t *c = rs->coefs + p * rs->taps;
+        float sum = 0.0f;
+        for (uint32_t k = 0; k < rs->taps; k++) {
+            float t = p + k * rs->phases - center;
+            float x = cutoff * t / rs->phases;
+            float r = t / center;
+            float w = r < 1.0f ? bessel_i0(RESAMPLER_BETA * sqrtf(1.0f - r * r)) / i0_beta : 0.0f;
+            h[k] = cutoff * (x == 0.0f ? 1.0f : sinf((float)M_PI * x) / ((float)M_PI * x)) * w;
+            sum += h[k];
+        }
+
+        /* round, then put the rounding error on the largest tap so DC passes unchanged */
+        int32_t total = 0;
+        uint32_t peak = 0;
+        for (uint32_t k = 0; k < rs->taps; k++) {
+            c[k] = (int16_t)lrintf(h[k] / sum * (1 << RESAMPLER_Q));
+            total += c[k];
+            if (c[k] > c[peak]) {
+                peak = k;
+            }
+        }
+        c[peak] += (1 << RESAMPLER_Q) - total;
+    }
+}
+
+esp_err_t resampler_create(uint32_t in_rate, uint32_t out_rate, resampler_t **ret)
+{
+    if (!in_rate || !out_rate) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    resampler_t *rs = (resampler_t *)calloc(1, sizeof(resampler_t));
+    if (!rs) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    uint32_t g = gcd(in_rate, out_rate);
+    rs->l = out_rate / g;
+    rs->m = in_rate / g;
+    rs->phases = rs->l < RESAMPLER_MAX_PHASES ? rs->l : RESAMPLER_MAX_PHASES;
+    rs->phase_scale = ((uint64_t)rs->phases << 32) / rs->l;
+
+    /* when downsampling the pass band narrows, keep the transition band as wide in output samples */
+    float cutoff = RESAMPLER_CUTOFF;
+    rs->taps = RESAMPLER_TAPS;
+    if (out_rate < in_rate) {
+        cutoff = cutoff * out_rate / in_rate;
+        uint64_t taps = ((uint64_t)RESAMPLER_TAPS * in_rate + out_rate - 1) / out_rate;
+        taps = (taps + 1) & ~1ULL;
+        rs->taps = taps < RESAMPLER_MAX_TAPS ? taps : RESAMPLER_MAX_TAPS;
+    }
+
+    rs->coefs = (int16_t *)malloc((rs->phases + 1) * rs->taps * sizeof(int16_t));
+    if (!rs->coefs) {
+        free(rs);
+        return ESP_ERR_NO_MEM;
+    }
+    resampler_design(rs, cutoff);
+    resampler_reset(rs);
+
+    ESP_LOGI(TAG, "%lu -> %lu Hz, %lu/%lu, %lu phases%s of %lu taps", in_rate, out_rate, rs->l, rs->m,
+             rs->phases, rs->phases < rs->l ? " interpolated" : "", rs->taps);
+    *ret = rs;
+    return ESP_OK;
+}
+
+void resampler_delete(resampler_t *rs)
+{
+    if (rs) {
+        free(rs->coefs);
+        free(rs);
+    }
+}
+
+void resampler_reset(resampler_t *rs)
+{
+    memset(rs->hist, 0, sizeof(rs->hist));
+    rs->pos = 0;
+    rs->phase = rs->l;
+}
+
+static inline int32_t resampler_dot(const int16_t *x, const int16_t *c, uint32_t taps)
+{
+    /* each phase sums to 1.0 and its taps to well under 2.0 in magnitude, the sum fits */
+    int32_t acc = 0;
+
+    for (uint32_t k = 0; k < taps; k += 2) {
+        acc += x[k] * c[k];
+        acc += x[k + 1] * c[k + 1];
+    }
+    return acc;
+}
+
+size_t resampler_process(resampler_t *rs, const int16_t *in, size_t *in_len, int16_t *out, size_t out_len)
+{
+    size_t n_in = 0;
+    size_t n_out = 0;
+
+    while (n_out < out_len) {
+        while (rs->phase >= rs->l) {
+            if (n_in == *in_len) {
+                goto done;
+            }
+            rs->pos = rs->pos ? rs->pos - 1 : rs->taps - 1;
+            rs->hist[rs->pos] = rs->hist[rs->pos + rs->taps] = in[n_in++];
+            rs->phase -= rs->l;
+        }
+
+        const int16_t *x = &rs->hist[rs->pos];
+        int32_t acc;
+        if (rs->phases == rs->l) {
+            acc = resampler_dot(x, rs->coefs + rs->phase * rs->taps, rs->taps);
+        } else {
+            uint64_t at = rs->phase * rs->phase_scale;
+            uint32_t p = at >> 32;
+            int32_t frac = (at >> 16) & 0xFFFF;
+            int32_t a = resampler_dot(x, rs->coefs + p * rs->taps, rs->taps);
+            int32_t b = resampler_dot(x, rs->coefs + (p + 1) * rs->taps, rs->taps);
+            acc = a + (int32_t)((((int64_t)b - a) * frac) >> 16);
+        }
+
+        acc = (acc + (1 << (RESAMPLER_Q - 1))) >> RESAMPLER_Q;
+        out[n_out++] = acc > INT16_MAX ? INT16_MAX : acc < INT16_MIN ? INT16_MIN : acc;
+        rs->phase += rs->m;
+    }
+
+done:
+    *in_len = n_in;
+    return n_out;
+}
+
+size_t resampler_out_len(const resampler_t *rs, size_t in_len)
+{
+    return ((uint64_t)in_len * rs->l + rs->m - 1) / rs->m + 1;
+}
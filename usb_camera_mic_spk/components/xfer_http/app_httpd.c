@@ -5,9 +5,33 @@
  */
 
 #include "app_httpd.h"
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/select.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "freertos/queue.h"
 #include "esp_http_server.h"
 #include "esp_timer.h"
+#include "esp_system.h"
+#include "esp_random.h"
+#include "esp_heap_caps.h"
 #include "esp_camera.h"
+#include "frame_ring.h"
+#include "frame_trace.h"
+#include "stream_server.h"
+#include "lat_hist.h"
+#include "metrics.h"
+#include "ws_video.h"
+#include "speaker_ws.h"
+#include "jpeg_scale.h"
+#include "rtsp_server.h"
+#include "frame_history.h"
+#include "audio_http.h"
+#include "mic_ring.h"
 #include "sdkconfig.h"
 
 #if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
@@ -18,77 +42,140 @@
 static const char *TAG = "camera_httpd";
 #endif
 
-typedef struct {
-    httpd_req_t *req;
-    size_t len;
-} jpg_chunking_t;
-
-#define PART_BOUNDARY "123456789000000000000987654321"
-static const char *_STREAM_CONTENT_TYPE = "multipart/x-mixed-replace;boundary=" PART_BOUNDARY;
-static const char *_STREAM_BOUNDARY = "\r\n--" PART_BOUNDARY "\r\n";
-static const char *_STREAM_PART = "Content-Type: image/jpeg\r\nContent-Length: %u\r\nX-Timestamp: %d.%06d\r\n\r\n";
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
 
-httpd_handle_t stream_httpd = NULL;
 httpd_handle_t camera_httpd = NULL;
 
+static lat_hist_t s_capture_hist;
+static atomic_uint s_capture_frames;
+static atomic_uint s_capture_bytes;
+
+#define CAPTURE_WAIT_MAX        CONFIG_CAPTURE_LONG_POLL_MAX
+#define CAPTURE_WAIT_US         (CONFIG_CAPTURE_LONG_POLL_TIMEOUT_MS * 1000LL)
+#define CAPTURE_WAIT_TICK_MS    100
+#define CAPTURE_TASK_STACK      4096
+#define CAPTURE_TASK_PRIO       5
+#define CAPTURE_ETAG_SIZE       32
+#define CAPTURE_HEAD_SIZE       256
+#define CAPTURE_POLL_MS         5       /* wait for a full socket before looking for a new frame */
+#define CAPTURE_STALL_US        (CONFIG_STREAM_CLIENT_STALL_TIMEOUT_MS * 1000LL)
+#define HTTPD_REQUEST_SESSIONS  3
+#define HTTPD_304               "304 Not Modified"
+#define HTTPD_503               "503 Service Unavailable"
+
+/* a frame scaled once for all the long polls that asked for that scale */
 typedef struct {
-    size_t size;  //number of values used for filtering
-    size_t index; //current value index
-    size_t count; //value count
-    int sum;
-    int *values; //array to be filled with values
-} ra_filter_t;
+    int refs;                   /* taken and dropped by capture_wait_task only */
+    size_t len;
+    uint8_t data[];
+} capture_body_t;
 
-static ra_filter_t ra_filter;
+/* a /capture?after= request parked until a newer frame is pushed */
+typedef struct {
+    httpd_req_t *req;           /* async copy of the request, NULL when the entry is free */
+    uint32_t after;
+    uint32_t scale;
+    int64_t deadline_us;
+    /* the response in flight, head_len is 0 until it starts */
+    int fd;
+    camera_fb_t *fb;            /* frame being sent, pinned until written */
+    capture_body_t *body;       /* scaled frame being sent, NULL at scale 1 */
+    const uint8_t *data;
+    size_t len;
+    char head[CAPTURE_HEAD_SIZE];
+    size_t head_len;
+    size_t sent;                /* bytes of head and body written */
+    int64_t last_progress;      /* last time the socket took any data */
+    frame_trace_t trace;
+} capture_wait_t;
 
-static ra_filter_t *ra_filter_init(ra_filter_t *filter, size_t sample_size)
+static capture_wait_t s_capture_waits[CAPTURE_WAIT_MAX];
+static SemaphoreHandle_t s_capture_wait_lock;   /* entries, taken by capture_wait_task and the httpd task */
+static frame_ring_reader_t *s_capture_reader;
+static atomic_int s_capture_waiting;
+static atomic_uint s_capture_not_modified;
+static atomic_uint s_capture_wait_timeouts;
+static atomic_uint s_capture_wait_full;
+static atomic_uint s_capture_wait_stalled;
+static uint32_t s_etag_nonce;       /* sequences restart at boot, ETags must not */
+
+/* value of a query parameter, false if absent */
+static bool query_value(httpd_req_t *req, const char *key, char *value, size_t size)
 {
-    memset(filter, 0, sizeof(ra_filter_t));
+    char query[128];
 
-    filter->values = (int *)malloc(sample_size * sizeof(int));
+    return httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK
+           && httpd_query_key_value(query, key, value, size) == ESP_OK;
+}
 
-    if (!filter->values) {
-        return NULL;
-    }
+/* integer query parameter, fallback if absent */
+static int query_int(httpd_req_t *req, const char *key, int fallback)
+{
+    char value[8];
 
-    memset(filter->values, 0, sample_size * sizeof(int));
+    return query_value(req, key, value, sizeof(value)) ? atoi(value) : fallback;
+}
 
-    filter->size = sample_size;
-    return filter;
+/* scale=2|4|8 from the query string, 1 if absent or invalid */
+static uint32_t capture_scale(httpd_req_t *req)
+{
+    int scale = query_int(req, "scale", 1);
+    return scale == 2 || scale == 4 || scale == 8 ? scale : 1;
 }
 
-static int ra_filter_run(ra_filter_t *filter, int value)
+/* after=SEQ from the query string, false if absent */
+static bool capture_after(httpd_req_t *req, uint32_t *after)
 {
-    if (!filter->values) {
-        return value;
+    char value[12];
+
+    if (!query_value(req, "after", value, sizeof(value))) {
+        return false;
     }
+    *after = strtoul(value, NULL, 10);
+    return true;
+}
 
-    filter->sum -= filter->values[filter->index];
-    filter->values[filter->index] = value;
-    filter->sum += filter->values[filter->index];
-    filter->index++;
-    filter->index = filter->index % filter->size;
+/* camera sequence a is newer than b, across wrap-around */
+static bool sequence_newer(uint32_t a, uint32_t b)
+{
+    return (int32_t)(a - b) > 0;
+}
 
-    if (filter->count < filter->size) {
-        filter->count++;
+/* strong validator of a frame as served at a scale, in this boot */
+static void capture_etag(char *etag, size_t size, uint32_t sequence, uint32_t scale)
+{
+    if (scale > 1) {
+        snprintf(etag, size, "\"%08lx-%u-%lu\"", s_etag_nonce, sequence, scale);
+    } else {
+        snprintf(etag, size, "\"%08lx-%u\"", s_etag_nonce, sequence);
     }
-
-    return filter->sum / filter->count;
 }
 
-static esp_err_t capture_handler(httpd_req_t *req)
+static bool capture_match(httpd_req_t *req, const char *etag)
 {
-    camera_fb_t *fb = NULL;
-    esp_err_t res = ESP_OK;
-    int64_t fr_start = esp_timer_get_time();
+    char value[64];
 
-    fb = esp_camera_fb_get();
+    return httpd_req_get_hdr_value_str(req, "If-None-Match", value, sizeof(value)) == ESP_OK
+           && (strstr(value, etag) || !strcmp(value, "*"));
+}
 
-    if (!fb) {
-        ESP_LOGE(TAG, "Camera capture failed");
-        httpd_resp_send_500(req);
-        return ESP_FAIL;
-    }
+static esp_err_t capture_send_not_modified(httpd_req_t *req, const char *etag)
+{
+    httpd_resp_set_status(req, HTTPD_304);
+    httpd_resp_set_hdr(req, "ETag", etag);
+    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+    atomic_fetch_add(&s_capture_not_modified, 1);
+    return httpd_resp_send(req, NULL, 0);
+}
+
+/* send a pinned frame as the response, the caller returns it */
+static esp_err_t capture_send(httpd_req_t *req, camera_fb_t *fb, uint32_t scale)
+{
+    esp_err_t res = ESP_OK;
+    frame_trace_t trace;
+    frame_trace_handoff(&trace, fb);
 
     httpd_resp_set_type(req, "image/jpeg");
     httpd_resp_set_hdr(req, "Content-Disposition", "inline; filename=capture.jpg");
@@ -97,95 +184,730 @@ static esp_err_t capture_handler(httpd_req_t *req)
     char ts[32];
     snprintf(ts, 32, "%lld.%06ld", fb->timestamp.tv_sec, fb->timestamp.tv_usec);
     httpd_resp_set_hdr(req, "X-Timestamp", (const char *)ts);
+    char seq[12];
+    snprintf(seq, sizeof(seq), "%u", frame_ring_meta(fb)->sequence);
+    httpd_resp_set_hdr(req, "X-Sequence", (const char *)seq);
+    char etag[CAPTURE_ETAG_SIZE];
+    capture_etag(etag, sizeof(etag), frame_ring_meta(fb)->sequence, scale);
+    httpd_resp_set_hdr(req, "ETag", (const char *)etag);
 
     size_t fb_len = 0;
+    const uint8_t *jpg = fb->buf;
+    uint8_t *scaled = NULL;
     fb_len = fb->len;
-    res = httpd_resp_send(req, (const char *)fb->buf, fb->len);
-    esp_camera_fb_return(fb);
-    int64_t fr_end = esp_timer_get_time();
-    ESP_LOGI(TAG, "JPG: %luB %lums", (uint32_t)(fb_len), (uint32_t)((fr_end - fr_start) / 1000));
+    if (scale > 1) {
+        /* a scaled frame is smaller than the source, only its headers may not shrink */
+        size_t size = fb->len + 1024;
+        scaled = (uint8_t *)malloc(size);
+        res = scaled ? jpeg_scale(fb->buf, fb->len, scale, scaled, size, &fb_len) : ESP_ERR_NO_MEM;
+        if (res != ESP_OK) {
+            ESP_LOGE(TAG, "Scaling by %lu failed: %s", scale, esp_err_to_name(res));
+            free(scaled);
+            httpd_resp_send_500(req);
+            return ESP_FAIL;
+        }
+        jpg = scaled;
+    }
+    /* headers and body go out in one call, the first byte is stamped when it starts */
+    frame_trace_first_byte(&trace);
+    res = httpd_resp_send(req, (const char *)jpg, fb_len);
+    if (res == ESP_OK) {
+        frame_trace_last_byte(&trace);
+        atomic_fetch_add(&s_capture_frames, 1);
+        atomic_fetch_add(&s_capture_bytes, fb_len);
+    }
+    free(scaled);
+#if CONFIG_FRAME_LOG_ENABLE
+    ESP_LOGI(TAG, "JPG: %luB", (uint32_t)(fb_len));
+#endif
     return res;
 }
 
-static esp_err_t stream_handler(httpd_req_t *req)
+/*
+ * Park a long poll. The request leaves the server task as an async copy, so
+ * the server keeps answering others, and capture_wait_task completes it with
+ * the next frame or a 304 at the deadline. The newest frame is looked at again
+ * under the lock the task takes to find waiters for a frame, so one pushed
+ * since the handler looked is either found here or finds the waiter there.
+ * Returns that frame pinned, and the request is not parked, when it is newer
+ * than after.
+ */
+static camera_fb_t *capture_wait(httpd_req_t *req, uint32_t after, uint32_t scale, esp_err_t *res)
 {
-    camera_fb_t *fb = NULL;
-    struct timeval _timestamp;
-    esp_err_t res = ESP_OK;
-    size_t _jpg_buf_len = 0;
-    uint8_t *_jpg_buf = NULL;
-    char *part_buf[128];
+    capture_wait_t *w = NULL;
+    httpd_req_t *async = NULL;
+    camera_fb_t *fb;
+
+    *res = ESP_OK;
+    xSemaphoreTake(s_capture_wait_lock, portMAX_DELAY);
+    fb = frame_ring_get_latest();
+    if (fb && frame_ring_meta(fb)->sequence != after) {
+        xSemaphoreGive(s_capture_wait_lock);
+        return fb;
+    }
+    frame_ring_return(fb);
+    for (size_t i = 0; i < CAPTURE_WAIT_MAX; i++) {
+        if (!s_capture_waits[i].req) {
+            w = &s_capture_waits[i];
+            break;
+        }
+    }
+    if (w && httpd_req_async_handler_begin(req, &async) == ESP_OK) {
+        w->after = after;
+        w->scale = scale;
+        w->deadline_us = esp_timer_get_time() + CAPTURE_WAIT_US;
+        w->fd = httpd_req_to_sockfd(async);
+        w->head_len = 0;
+        w->req = async;
+        atomic_fetch_add(&s_capture_waiting, 1);
+    }
+    xSemaphoreGive(s_capture_wait_lock);
 
-    static int64_t last_frame = 0;
+    if (!async) {
+        atomic_fetch_add(&s_capture_wait_full, 1);
+        httpd_resp_set_status(req, HTTPD_503);
+        httpd_resp_set_hdr(req, "Retry-After", "1");
+        *res = httpd_resp_send(req, NULL, 0);
+    }
+    return NULL;
+}
 
-    if (!last_frame) {
-        last_frame = esp_timer_get_time();
+static void capture_body_put(capture_body_t *body)
+{
+    if (body && --body->refs == 0) {
+        free(body);
     }
+}
 
-    res = httpd_resp_set_type(req, _STREAM_CONTENT_TYPE);
+/* the frame scaled, shared by the waiters that take a reference, NULL if scaling failed */
+static capture_body_t *capture_body_make(camera_fb_t *fb, uint32_t scale)
+{
+    /* a scaled frame is smaller than the source, only its headers may not shrink */
+    size_t size = fb->len + 1024;
+    capture_body_t *body = (capture_body_t *)malloc(sizeof(capture_body_t) + size);
+    esp_err_t res = body ? jpeg_scale(fb->buf, fb->len, scale, body->data, size, &body->len) : ESP_ERR_NO_MEM;
 
     if (res != ESP_OK) {
-        return res;
+        ESP_LOGE(TAG, "Scaling by %lu failed: %s", scale, esp_err_to_name(res));
+        free(body);
+        return NULL;
     }
+    body->refs = 1;
+    return body;
+}
 
-    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
-    httpd_resp_set_hdr(req, "X-Framerate", "60");
+/* index of a scale of 2, 4 or 8 among the shared bodies */
+static size_t capture_body_index(uint32_t scale)
+{
+    return scale == 2 ? 0 : scale == 4 ? 1 : 2;
+}
 
-    while (true) {
-        fb = esp_camera_fb_get();
+/*
+ * Start the response to a waiter, with s_capture_wait_lock held: the frame at
+ * the waiter's scale, or a 304 when fb is NULL. The head is built here as
+ * httpd_resp_send() would and goes out with the body through
+ * capture_wait_flush(), which never blocks.
+ */
+static void capture_wait_start_response(capture_wait_t *w, camera_fb_t *fb, capture_body_t *body)
+{
+    char etag[CAPTURE_ETAG_SIZE];
+    int n;
 
-        if (!fb) {
-            ESP_LOGE(TAG, "Camera capture failed");
-            res = ESP_FAIL;
+    w->fb = NULL;
+    w->body = NULL;
+    w->data = NULL;
+    w->len = 0;
+    if (!fb) {
+        capture_etag(etag, sizeof(etag), w->after, w->scale);
+        n = snprintf(w->head, sizeof(w->head), "HTTP/1.1 %s\r\nContent-Length: 0\r\nETag: %s\r\n"
+                     "Access-Control-Allow-Origin: *\r\n\r\n", HTTPD_304, etag);
+        atomic_fetch_add(&s_capture_not_modified, 1);
+        atomic_fetch_add(&s_capture_wait_timeouts, 1);
+    } else if (w->scale > 1 && !body) {
+        n = snprintf(w->head, sizeof(w->head), "HTTP/1.1 %s\r\nContent-Length: 0\r\n\r\n", HTTPD_500);
+    } else {
+        w->fb = frame_ring_ref(fb);
+        if (body) {
+            body->refs++;
+            w->body = body;
+            w->data = body->data;
+            w->len = body->len;
         } else {
-            _timestamp.tv_sec = fb->timestamp.tv_sec;
-            _timestamp.tv_usec = fb->timestamp.tv_usec;
-            _jpg_buf_len = fb->len;
-            _jpg_buf = fb->buf;
+            w->data = fb->buf;
+            w->len = fb->len;
         }
+        frame_trace_handoff(&w->trace, fb);
+        capture_etag(etag, sizeof(etag), frame_ring_meta(fb)->sequence, w->scale);
+        n = snprintf(w->head, sizeof(w->head), "HTTP/1.1 200 OK\r\nContent-Type: image/jpeg\r\n"
+                     "Content-Length: %u\r\nContent-Disposition: inline; filename=capture.jpg\r\n"
+                     "Access-Control-Allow-Origin: *\r\nX-Timestamp: %lld.%06ld\r\nX-Sequence: %u\r\n"
+                     "ETag: %s\r\n\r\n", (unsigned)w->len, (long long)fb->timestamp.tv_sec,
+                     (long)fb->timestamp.tv_usec, frame_ring_meta(fb)->sequence, etag);
+    }
+    w->head_len = n;
+    w->sent = 0;
+    w->last_progress = esp_timer_get_time();
+}
+
+/*
+ * Write as much of the response as the socket takes without blocking, as
+ * ws_video.c does. Returns false on a failed send.
+ */
+static bool capture_wait_flush(capture_wait_t *w)
+{
+    size_t total = w->head_len + w->len;
+
+    while (w->sent < total) {
+        struct iovec iov[2];
+        struct msghdr msg = {
+            .msg_iov = iov,
+        };
+        if (w->sent < w->head_len) {
+            iov[0].iov_base = w->head + w->sent;
+            iov[0].iov_len = w->head_len - w->sent;
+            iov[1].iov_base = (void *)w->data;
+            iov[1].iov_len = w->len;
+            msg.msg_iovlen = w->len ? 2 : 1;
+        } else {
+            iov[0].iov_base = (void *)(w->data + (w->sent - w->head_len));
+            iov[0].iov_len = total - w->sent;
+            msg.msg_iovlen = 1;
+        }
+        ssize_t sent = sendmsg(w->fd, &msg, MSG_DONTWAIT | MSG_NOSIGNAL);
+        if (sent < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        }
+        if (sent > 0 && !w->sent && w->fb) {
+            frame_trace_first_byte(&w->trace);
+        }
+        w->sent += sent;
+        w->last_progress = esp_timer_get_time();
+    }
+    if (w->fb) {
+        frame_trace_last_byte(&w->trace);
+        atomic_fetch_add(&s_capture_frames, 1);
+        atomic_fetch_add(&s_capture_bytes, w->len);
+    }
+    return true;
+}
+
+/* hand the request back to the server and free the entry, with s_capture_wait_lock held */
+static void capture_wait_finish(capture_wait_t *w, bool close)
+{
+    frame_ring_return(w->fb);
+    w->fb = NULL;
+    capture_body_put(w->body);
+    w->body = NULL;
+    httpd_req_async_handler_complete(w->req);
+    if (close) {
+        httpd_sess_trigger_close(camera_httpd, w->fd);
+    }
+    w->req = NULL;
+    w->head_len = 0;
+    atomic_fetch_sub(&s_capture_waiting, 1);
+}
 
-        if (res == ESP_OK) {
-            res = httpd_resp_send_chunk(req, _STREAM_BOUNDARY, strlen(_STREAM_BOUNDARY));
+/*
+ * Start a response for each waiter the frame is newer for or whose deadline
+ * passed, and write what the sockets take. Each scale is encoded once per
+ * frame, outside the lock, for all the waiters that asked for it. Returns
+ * true while a response is still in flight.
+ */
+static bool capture_wait_service(camera_fb_t *fb)
+{
+    capture_body_t *bodies[3] = { NULL };
+    bool pending = false;
+    uint32_t scales = 0;
+
+    if (fb) {
+        xSemaphoreTake(s_capture_wait_lock, portMAX_DELAY);
+        for (size_t i = 0; i < CAPTURE_WAIT_MAX; i++) {
+            capture_wait_t *w = &s_capture_waits[i];
+            if (w->req && !w->head_len && w->scale > 1 && sequence_newer(frame_ring_meta(fb)->sequence, w->after)) {
+                scales |= w->scale;
+            }
         }
+        xSemaphoreGive(s_capture_wait_lock);
+        for (uint32_t scale = 2; scale <= 8; scale *= 2) {
+            if (scales & scale) {
+                bodies[capture_body_index(scale)] = capture_body_make(fb, scale);
+            }
+        }
+    }
 
-        if (res == ESP_OK) {
-            size_t hlen = snprintf((char *)part_buf, 128, _STREAM_PART, _jpg_buf_len, _timestamp.tv_sec, _timestamp.tv_usec);
-            res = httpd_resp_send_chunk(req, (const char *)part_buf, hlen);
+    int64_t now = esp_timer_get_time();
+    xSemaphoreTake(s_capture_wait_lock, portMAX_DELAY);
+    for (size_t i = 0; i < CAPTURE_WAIT_MAX && atomic_load(&s_capture_waiting); i++) {
+        capture_wait_t *w = &s_capture_waits[i];
+        if (!w->req) {
+            continue;
         }
+        if (!w->head_len) {
+            if (fb && sequence_newer(frame_ring_meta(fb)->sequence, w->after)) {
+                /* a waiter parked since the bodies were made has no body yet and waits for the next frame */
+                if (w->scale == 1 || scales & w->scale) {
+                    capture_wait_start_response(w, fb, w->scale > 1 ? bodies[capture_body_index(w->scale)] : NULL);
+                }
+            } else if (now >= w->deadline_us) {
+                capture_wait_start_response(w, NULL, NULL);
+            }
+            if (!w->head_len) {
+                continue;
+            }
+        }
+        if (!capture_wait_flush(w)) {
+            ESP_LOGW(TAG, "long poll %d: send failed, closing", w->fd);
+            capture_wait_finish(w, true);
+        } else if (w->sent == w->head_len + w->len) {
+            capture_wait_finish(w, false);
+        } else if (now - w->last_progress > CAPTURE_STALL_US) {
+            ESP_LOGW(TAG, "long poll %d stalled, closing", w->fd);
+            atomic_fetch_add(&s_capture_wait_stalled, 1);
+            capture_wait_finish(w, true);
+        } else {
+            pending = true;
+        }
+    }
+    xSemaphoreGive(s_capture_wait_lock);
+
+    for (size_t i = 0; i < 3; i++) {
+        capture_body_put(bodies[i]);
+    }
+    return pending;
+}
+
+/* wait until a socket with a response in flight can take more, or CAPTURE_POLL_MS passed */
+static void capture_wait_writable(void)
+{
+    fd_set wfds;
+    int max_fd = -1;
+    struct timeval tv = {
+        .tv_usec = CAPTURE_POLL_MS * 1000,
+    };
 
-        if (res == ESP_OK) {
-            res = httpd_resp_send_chunk(req, (const char *)_jpg_buf, _jpg_buf_len);
+    FD_ZERO(&wfds);
+    xSemaphoreTake(s_capture_wait_lock, portMAX_DELAY);
+    for (size_t i = 0; i < CAPTURE_WAIT_MAX; i++) {
+        capture_wait_t *w = &s_capture_waits[i];
+        if (w->req && w->head_len) {
+            FD_SET(w->fd, &wfds);
+            max_fd = w->fd > max_fd ? w->fd : max_fd;
         }
+    }
+    xSemaphoreGive(s_capture_wait_lock);
+    select(max_fd + 1, NULL, &wfds, NULL, &tv);
+}
 
-        if (fb) {
-            esp_camera_fb_return(fb);
-            fb = NULL;
-            _jpg_buf = NULL;
-        } else if (_jpg_buf) {
-            _jpg_buf = NULL;
+static void capture_wait_task(void *arg)
+{
+    bool pending = false;
+
+    while (true) {
+        if (pending) {
+            capture_wait_writable();
         }
+        camera_fb_t *fb = frame_ring_reader_get(s_capture_reader, pending ? 0 : pdMS_TO_TICKS(CAPTURE_WAIT_TICK_MS));
+        pending = capture_wait_service(fb);
+        frame_ring_return(fb);
+    }
+}
 
-        if (res != ESP_OK) {
-            break;
+static esp_err_t capture_wait_start(void)
+{
+    s_capture_wait_lock = xSemaphoreCreateMutex();
+    if (!s_capture_wait_lock) {
+        return ESP_ERR_NO_MEM;
+    }
+    s_capture_reader = frame_ring_reader_open();
+    if (!s_capture_reader) {
+        ESP_LOGE(TAG, "no frame reader for long polls");
+        return ESP_FAIL;
+    }
+    if (xTaskCreate(capture_wait_task, "capture_wait", CAPTURE_TASK_STACK, NULL, CAPTURE_TASK_PRIO, NULL) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+/*
+ * /capture sends a fresh frame. /capture?after=SEQ sends the newest frame if
+ * it is newer than SEQ and otherwise waits for one, so a polling client gets
+ * every frame once without asking twice. A SEQ ahead of the newest frame was
+ * seen before a reboot and gets the newest frame at once. Frames carry their
+ * sequence and a per-boot nonce as ETag, a matching If-None-Match gets 304
+ * without a body.
+ */
+static esp_err_t capture_handler(httpd_req_t *req)
+{
+    camera_fb_t *fb = NULL;
+    esp_err_t res = ESP_OK;
+    int64_t fr_start = esp_timer_get_time();
+    uint32_t scale = capture_scale(req);
+    uint32_t after;
+
+    if (capture_after(req, &after)) {
+        /* the newest frame whatever its age, no wait on the camera when the client is behind */
+        fb = frame_ring_get_latest();
+        if (!fb || frame_ring_meta(fb)->sequence == after) {
+            frame_ring_return(fb);
+            if (!s_capture_wait_lock) {
+                return httpd_resp_send_500(req);
+            }
+            fb = capture_wait(req, after, scale, &res);
+            if (!fb) {
+                return res;
+            }
         }
+    } else {
+        fb = esp_camera_fb_get();
+    }
+
+    if (!fb) {
+        ESP_LOGE(TAG, "Camera capture failed");
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+    }
 
-        int64_t fr_end = esp_timer_get_time();
-        int64_t frame_time = fr_end - last_frame;
-        last_frame = fr_end;
-        frame_time /= 1000;
-        uint32_t avg_frame_time = ra_filter_run(&ra_filter, frame_time);
-        ESP_LOGI(TAG, "MJPG: %luB %lums (%.1ffps), AVG: %lums (%.1ffps)"
-                 ,
-                 (uint32_t)(_jpg_buf_len),
-                 (uint32_t)frame_time, 1000.0 / (uint32_t)frame_time,
-                 avg_frame_time, 1000.0 / avg_frame_time
-                );
+    char etag[CAPTURE_ETAG_SIZE];
+    capture_etag(etag, sizeof(etag), frame_ring_meta(fb)->sequence, scale);
+    if (capture_match(req, etag)) {
+        res = capture_send_not_modified(req, etag);
+    } else {
+        res = capture_send(req, fb, scale);
     }
+    esp_camera_fb_return(fb);
+    lat_hist_record(&s_capture_hist, esp_timer_get_time() - fr_start);
+    return res;
+}
+
+#if CONFIG_FRAME_HISTORY_ENABLE
+#define HISTORY_BOUNDARY    "123456789000000000000987654321"
+#define HISTORY_CHUNK_SIZE  4096
+#define HISTORY_CLIP_S      10
+#define HISTORY_CLIP_MAX_S  600
+#define HISTORY_BURST_N     5
+#define HISTORY_QUEUE_LEN   2
+#define HISTORY_TASK_STACK  4096
+#define HISTORY_TASK_PRIO   5
+
+static const char *_HISTORY_BOUNDARY = "\r\n--" HISTORY_BOUNDARY "\r\n";
+static const char *_HISTORY_END = "\r\n--" HISTORY_BOUNDARY "--\r\n";
+static const char *_HISTORY_PART = "Content-Type: image/jpeg\r\nContent-Length: %u\r\nX-Timestamp: %d.%06d\r\nX-Sequence: %u\r\n\r\n";
+
+/* a /clip or /burst request handed to history_task */
+typedef struct {
+    httpd_req_t *req;           /* async copy of the request */
+    const char *type;
+    frame_history_info_t first;
+    uint32_t last_id;
+} history_request_t;
+
+static QueueHandle_t s_history_requests;
+
+/*
+ * Send the stored frames from info up to last_id as multipart parts, copied
+ * out of the history one chunk at a time. A frame evicted before its first
+ * chunk is skipped, one evicted while it is sent ends the response.
+ */
+static esp_err_t history_send(httpd_req_t *req, frame_history_info_t *info, uint32_t last_id)
+{
+    uint8_t *buf = (uint8_t *)malloc(HISTORY_CHUNK_SIZE);
+    char part[128];
+    esp_err_t res = ESP_OK;
+
+    if (!buf) {
+        return ESP_ERR_NO_MEM;
+    }
+    while (res == ESP_OK && (int32_t)(last_id - info->id) >= 0) {
+        size_t n = info->len < HISTORY_CHUNK_SIZE ? info->len : HISTORY_CHUNK_SIZE;
+        if (frame_history_read(info->id, 0, buf, n) == ESP_OK) {
+            size_t hlen = snprintf(part, sizeof(part), _HISTORY_PART, info->len,
+                                   (int)(info->captured_us / 1000000), (int)(info->captured_us % 1000000), info->sequence);
+            res = httpd_resp_send_chunk(req, _HISTORY_BOUNDARY, strlen(_HISTORY_BOUNDARY));
+            if (res == ESP_OK) {
+                res = httpd_resp_send_chunk(req, part, hlen);
+            }
+            for (size_t off = 0; res == ESP_OK; ) {
+                res = httpd_resp_send_chunk(req, (const char *)buf, n);
+                off += n;
+                if (off == info->len) {
+                    break;
+                }
+                n = info->len - off < HISTORY_CHUNK_SIZE ? info->len - off : HISTORY_CHUNK_SIZE;
+                if (res == ESP_OK && frame_history_read(info->id, off, buf, n) != ESP_OK) {
+                    ESP_LOGW(TAG, "History frame %lu evicted while sent", info->id);
+                    res = ESP_FAIL;
+                }
+            }
+        }
+        if (res == ESP_OK && frame_history_next(info->id, info) != ESP_OK) {
+            break;
+        }
+    }
+    free(buf);
 
-    last_frame = 0;
+    if (res == ESP_OK) {
+        res = httpd_resp_send_chunk(req, _HISTORY_END, strlen(_HISTORY_END));
+    }
+    if (res == ESP_OK) {
+        res = httpd_resp_send_chunk(req, NULL, 0);
+    }
     return res;
 }
 
+static void history_task(void *arg)
+{
+    history_request_t r;
+
+    while (true) {
+        xQueueReceive(s_history_requests, &r, portMAX_DELAY);
+        httpd_resp_set_type(r.req, r.type);
+        httpd_resp_set_hdr(r.req, "Access-Control-Allow-Origin", "*");
+        history_send(r.req, &r.first, r.last_id);
+        httpd_req_async_handler_complete(r.req);
+    }
+}
+
+/*
+ * A clip takes seconds to send, so the request leaves the server task as an
+ * async copy and history_task writes it, one at a time. The frames are chosen
+ * now; those evicted before history_task gets to them are skipped.
+ */
+static esp_err_t history_queue(httpd_req_t *req, const char *type, const frame_history_info_t *first, uint32_t last_id)
+{
+    history_request_t r = {
+        .type = type,
+        .first = *first,
+        .last_id = last_id,
+    };
+
+    if (!s_history_requests || !uxQueueSpacesAvailable(s_history_requests)) {
+        httpd_resp_set_status(req, HTTPD_503);
+        httpd_resp_set_hdr(req, "Retry-After", "1");
+        return httpd_resp_send(req, NULL, 0);
+    }
+    if (httpd_req_async_handler_begin(req, &r.req) != ESP_OK) {
+        return httpd_resp_send_500(req);
+    }
+    /* only the server task queues, the space seen above is still there */
+    xQueueSend(s_history_requests, &r, portMAX_DELAY);
+    return ESP_OK;
+}
+
+static esp_err_t history_start(void)
+{
+    if (frame_history_start(CONFIG_FRAME_HISTORY_SIZE, CONFIG_FRAME_HISTORY_MAX_FRAMES) != ESP_OK) {
+        return ESP_FAIL;
+    }
+    s_history_requests = xQueueCreate(HISTORY_QUEUE_LEN, sizeof(history_request_t));
+    if (!s_history_requests) {
+        return ESP_ERR_NO_MEM;
+    }
+    if (xTaskCreate(history_task, "history_http", HISTORY_TASK_STACK, NULL, HISTORY_TASK_PRIO, NULL) != pdPASS) {
+        vQueueDelete(s_history_requests);
+        s_history_requests = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t clip_handler(httpd_req_t *req)
+{
+    frame_history_info_t info;
+    frame_history_info_t newest;
+    int seconds = query_int(req, "seconds", HISTORY_CLIP_S);
+
+    if (seconds < 1) {
+        seconds = 1;
+    } else if (seconds > HISTORY_CLIP_MAX_S) {
+        seconds = HISTORY_CLIP_MAX_S;
+    }
+    /* the clip ends with the newest frame when the request came in */
+    if (frame_history_seek_back(1, &newest) != ESP_OK
+            || frame_history_seek_time(newest.captured_us - seconds * 1000000LL, &info) != ESP_OK) {
+        return httpd_resp_send_404(req);
+    }
+
+    return history_queue(req, "multipart/x-mixed-replace;boundary=" HISTORY_BOUNDARY, &info, newest.id);
+}
+
+static esp_err_t burst_handler(httpd_req_t *req)
+{
+    frame_history_info_t info;
+    frame_history_info_t newest;
+    int n = query_int(req, "n", HISTORY_BURST_N);
+
+    if (n < 1) {
+        n = 1;
+    }
+    if (frame_history_seek_back(1, &newest) != ESP_OK || frame_history_seek_back(n, &info) != ESP_OK) {
+        return httpd_resp_send_404(req);
+    }
+
+    return history_queue(req, "multipart/mixed;boundary=" HISTORY_BOUNDARY, &info, newest.id);
+}
+#endif
+
+static esp_err_t status_handler(httpd_req_t *req)
+{
+    frame_ring_stats_t stats;
+    stream_server_stats_t *server = (stream_server_stats_t *)malloc(sizeof(stream_server_stats_t));
+    char json[512];
+
+    if (!server) {
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+    }
+    frame_ring_get_stats(&stats);
+    stream_server_get_stats(server);
+
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+
+    snprintf(json, sizeof(json),
+             "{\"frames_in\":%u,\"pool_exhausted\":%u,\"frames_oversize\":%u,"
+             "\"readers_exhausted\":%u,\"get_timeouts\":%u,\"bad_returns\":%u,"
+             "\"pinned\":%u,\"pinned_max\":%u,"
+             "\"push_us_last\":%u,\"push_us_max\":%u,\"push_us_avg\":%u,"
+             "\"fresh_hits\":%u,\"fresh_waits\":%u,"
+             "\"capture_us\":{\"count\":%u,\"p50\":%u,\"p99\":%u,\"max\":%u},"
+             "\"frame_interval_us\":%u,\"evicted\":%u,",
+             stats.frames_in, stats.pool_exhausted, stats.frames_oversize,
+             stats.readers_exhausted, stats.get_timeouts, stats.bad_returns,
+             stats.pinned, stats.pinned_max,
+             stats.push_time_last_us, stats.push_time_max_us, stats.push_time_avg_us,
+             stats.fresh_hits, stats.fresh_waits,
+             atomic_load(&s_capture_hist.count), lat_hist_percentile(&s_capture_hist, 500),
+             lat_hist_percentile(&s_capture_hist, 990), atomic_load(&s_capture_hist.max),
+             server->frame_interval_us, server->evicted);
+    httpd_resp_sendstr_chunk(req, json);
+
+    for (frame_stage_t st = 0; st < FRAME_STAGE_MAX; st++) {
+        lat_hist_t *hist = frame_trace_hist(st);
+        snprintf(json, sizeof(json), "%s\"%s\":{\"count\":%u,\"p50\":%u,\"p99\":%u,\"max\":%u}",
+                 st ? "," : "\"latency_us\":{", frame_trace_stage_name(st), atomic_load(&hist->count),
+                 lat_hist_percentile(hist, 500), lat_hist_percentile(hist, 990), atomic_load(&hist->max));
+        httpd_resp_sendstr_chunk(req, json);
+    }
+    /* the share of the push time each listener takes in the UVC callback */
+    httpd_resp_sendstr_chunk(req, "},\"listener_us\":[");
+    for (size_t i = 0; i < stats.listener_num; i++) {
+        snprintf(json, sizeof(json), "%s{\"max\":%u,\"avg\":%u}", i ? "," : "",
+                 stats.listener_time_max_us[i], stats.listener_time_avg_us[i]);
+        httpd_resp_sendstr_chunk(req, json);
+    }
+    httpd_resp_sendstr_chunk(req, "],\"clients\":[");
+
+    for (size_t i = 0; i < server->client_num; i++) {
+        stream_client_stats_t *c = &server->clients[i];
+        snprintf(json, sizeof(json),
+                 "%s{\"fd\":%d,\"fps\":%.1f,\"sent\":%u,\"dropped\":%u,\"skip_ratio\":%u,"
+                 "\"queue_delay_us\":%u,\"drain_us\":%u,\"send_us\":%u,\"kbps\":%u,\"backlog\":%u,\"scale\":%u}",
+                 i ? "," : "", c->fd, c->fps, c->frames_sent, c->frames_dropped, c->skip_ratio,
+                 c->queue_delay_us, c->drain_us, c->send_us, c->bitrate_kbps, c->backlog, c->scale);
+        httpd_resp_sendstr_chunk(req, json);
+    }
+    free(server);
+    httpd_resp_sendstr_chunk(req, "]");
+
+#if CONFIG_FRAME_HISTORY_ENABLE
+    frame_history_stats_t history;
+    frame_history_get_stats(&history);
+    snprintf(json, sizeof(json),
+             ",\"history\":{\"size\":%u,\"used\":%u,\"frames\":%u,\"span_ms\":%u,"
+             "\"frames_in\":%u,\"evicted\":%u,\"dropped\":%u}",
+             history.size, history.used, history.frames, history.span_ms,
+             history.frames_in, history.evicted, history.dropped);
+    httpd_resp_sendstr_chunk(req, json);
+#endif
+
+    httpd_resp_sendstr_chunk(req, "}");
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+static esp_err_t metrics_chunk(void *ctx, const char *text)
+{
+    return httpd_resp_sendstr_chunk((httpd_req_t *)ctx, text);
+}
+
+static esp_err_t metrics_handler(httpd_req_t *req)
+{
+    stream_server_stats_t *server = (stream_server_stats_t *)malloc(sizeof(stream_server_stats_t));
+    char line[160];
+
+    if (!server) {
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+    }
+    stream_server_get_stats(server);
+
+    httpd_resp_set_type(req, "text/plain; version=0.0.4");
+    if (metrics_write(metrics_chunk, req) != ESP_OK) {
+        free(server);
+        return ESP_FAIL;
+    }
+
+    /* per client values, labelled by socket */
+    httpd_resp_sendstr_chunk(req, "# HELP stream_client_fps Frames per second delivered to a /stream client\n"
+                             "# TYPE stream_client_fps gauge\n");
+    for (size_t i = 0; i < server->client_num; i++) {
+        snprintf(line, sizeof(line), "stream_client_fps{fd=\"%d\"} %.1f\n", server->clients[i].fd, server->clients[i].fps);
+        httpd_resp_sendstr_chunk(req, line);
+    }
+    httpd_resp_sendstr_chunk(req, "# HELP stream_client_kbps Kilobits per second delivered to a /stream client\n"
+                             "# TYPE stream_client_kbps gauge\n");
+    for (size_t i = 0; i < server->client_num; i++) {
+        snprintf(line, sizeof(line), "stream_client_kbps{fd=\"%d\"} %u\n", server->clients[i].fd, server->clients[i].bitrate_kbps);
+        httpd_resp_sendstr_chunk(req, line);
+    }
+    free(server);
+
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+static int32_t heap_free(void)
+{
+    return esp_get_free_heap_size();
+}
+
+static int32_t heap_free_min(void)
+{
+    return esp_get_minimum_free_heap_size();
+}
+
+static int32_t heap_largest_block(void)
+{
+    return heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+}
+
+static void metrics_init(void)
+{
+    metrics_register_counter("capture_frames_total", "Frames sent by /capture", &s_capture_frames);
+    metrics_register_counter("capture_bytes_total", "JPEG bytes sent by /capture", &s_capture_bytes);
+    metrics_register_histogram("capture_us", "/capture request duration", &s_capture_hist);
+    metrics_register_counter("capture_not_modified_total", "/capture answers 304 Not Modified", &s_capture_not_modified);
+    metrics_register_gauge("capture_long_polls_waiting", "/capture?after= requests waiting for a frame", &s_capture_waiting);
+    metrics_register_counter("capture_long_poll_timeouts_total", "/capture?after= requests that saw no new frame in time", &s_capture_wait_timeouts);
+    metrics_register_counter("capture_long_polls_rejected_total", "/capture?after= requests refused because all wait slots were taken", &s_capture_wait_full);
+    metrics_register_counter("capture_long_polls_stalled_total", "/capture?after= answers closed because the client stopped reading", &s_capture_wait_stalled);
+    metrics_register_gauge_fn("heap_free_bytes", "Free heap", heap_free);
+    metrics_register_gauge_fn("heap_free_min_bytes", "Lowest free heap since boot", heap_free_min);
+    metrics_register_gauge_fn("heap_largest_block_bytes", "Largest free heap block", heap_largest_block);
+    frame_trace_register_metrics();
+}
+
+/* sessions are closed here, after the endpoints writing to sockets from their own tasks let go of them */
+static void httpd_close_session(httpd_handle_t hd, int sockfd)
+{
+#if CONFIG_HTTPD_WS_SUPPORT
+    ws_video_session_closed(sockfd);
+#endif
+    close(sockfd);
+}
+
 static esp_err_t index_handler(httpd_req_t *req)
 {
     extern const unsigned char index_uvc_html_gz_start[] asm("_binary_index_uvc_html_gz_start");
@@ -201,6 +923,21 @@ void app_httpd_main()
 {
     httpd_config_t config = HTTPD_DEFAULT_CONFIG();
     config.max_uri_handlers = 16;
+    /* long polls, /audio and WebSocket clients each hold a session, plus a few for plain requests */
+    config.max_open_sockets = HTTPD_REQUEST_SESSIONS + CAPTURE_WAIT_MAX + MIC_RING_MAX_READERS;
+#if CONFIG_HTTPD_WS_SUPPORT
+    config.max_open_sockets += CONFIG_WS_VIDEO_MAX_CLIENTS + 1;    /* /ws/speaker plays one stream */
+#endif
+    if (config.max_open_sockets > CONFIG_LWIP_MAX_SOCKETS - 3) {
+        ESP_LOGW(TAG, "%u sessions do not fit LWIP_MAX_SOCKETS, serving %d", config.max_open_sockets,
+                 CONFIG_LWIP_MAX_SOCKETS - 3);
+        config.max_open_sockets = CONFIG_LWIP_MAX_SOCKETS - 3;
+    }
+    /* when all are taken a new connection closes the least recently used one instead of being refused */
+    config.lru_purge_enable = true;
+    config.close_fn = httpd_close_session;
+
+    s_etag_nonce = esp_random();
 
     httpd_uri_t index_uri = {
         .uri = "/",
@@ -216,27 +953,79 @@ void app_httpd_main()
         .user_ctx = NULL
     };
 
-    httpd_uri_t stream_uri = {
-        .uri = "/stream",
+    httpd_uri_t status_uri = {
+        .uri = "/status",
+        .method = HTTP_GET,
+        .handler = status_handler,
+        .user_ctx = NULL
+    };
+
+    httpd_uri_t metrics_uri = {
+        .uri = "/metrics",
+        .method = HTTP_GET,
+        .handler = metrics_handler,
+        .user_ctx = NULL
+    };
+
+#if CONFIG_FRAME_HISTORY_ENABLE
+    httpd_uri_t clip_uri = {
+        .uri = "/clip",
+        .method = HTTP_GET,
+        .handler = clip_handler,
+        .user_ctx = NULL
+    };
+
+    httpd_uri_t burst_uri = {
+        .uri = "/burst",
         .method = HTTP_GET,
-        .handler = stream_handler,
+        .handler = burst_handler,
         .user_ctx = NULL
     };
 
-    ra_filter_init(&ra_filter, 20);
+    if (history_start() != ESP_OK) {
+        ESP_LOGE(TAG, "Frame history failed to start");
+    }
+#endif
+
+    if (capture_wait_start() != ESP_OK) {
+        ESP_LOGE(TAG, "Capture long polls failed to start");
+    }
+    metrics_init();
 
     ESP_LOGI(TAG, "Starting web server on port: '%d'", config.server_port);
 
     if (httpd_start(&camera_httpd, &config) == ESP_OK) {
         httpd_register_uri_handler(camera_httpd, &index_uri);
         httpd_register_uri_handler(camera_httpd, &capture_uri);
+        httpd_register_uri_handler(camera_httpd, &status_uri);
+        httpd_register_uri_handler(camera_httpd, &metrics_uri);
+#if CONFIG_FRAME_HISTORY_ENABLE
+        httpd_register_uri_handler(camera_httpd, &clip_uri);
+        httpd_register_uri_handler(camera_httpd, &burst_uri);
+#endif
+#if CONFIG_HTTPD_WS_SUPPORT
+        if (ws_video_register(camera_httpd) != ESP_OK) {
+            ESP_LOGE(TAG, "WebSocket video failed to start");
+        }
+        if (speaker_ws_register(camera_httpd) != ESP_OK) {
+            ESP_LOGE(TAG, "WebSocket speaker failed to start");
+        }
+#endif
+        if (audio_http_register(camera_httpd) != ESP_OK) {
+            ESP_LOGE(TAG, "Audio endpoint failed to start");
+        }
     }
 
     config.server_port += 1;
-    config.ctrl_port += 1;
     ESP_LOGI(TAG, "Starting stream server on port: '%d'", config.server_port);
 
-    if (httpd_start(&stream_httpd, &config) == ESP_OK) {
-        httpd_register_uri_handler(stream_httpd, &stream_uri);
+    if (stream_server_start(config.server_port) != ESP_OK) {
+        ESP_LOGE(TAG, "Stream server failed to start");
+    }
+
+#if CONFIG_RTSP_SERVER_ENABLE
+    if (rtsp_server_start() != ESP_OK) {
+        ESP_LOGE(TAG, "RTSP server failed to start");
     }
+#endif
 }
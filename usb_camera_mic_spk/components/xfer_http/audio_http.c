@@ -0,0 +1,232 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "metrics.h"
+#include "mic_ring.h"
+#include "pcm_convert.h"
+#include "audio_http.h"
+
+static const char *TAG = "audio_http";
+
+#define AUDIO_TASK_STACK    3072
+#define AUDIO_TASK_PRIO     5
+#define AUDIO_CHUNK_SIZE    2048    /* ~20 ms of 48 kHz 16-bit stereo per chunk */
+#define AUDIO_READ_MS       200
+#define AUDIO_STREAM_SIZE   0xFFFFFFFF
+
+/* canonical 44 byte WAV header, little endian */
+typedef struct __attribute__((packed)) {
+    char riff[4];
+    uint32_t riff_size;
+    char wave[4];
+    char fmt[4];
+    uint32_t fmt_size;
+    uint16_t format;
+    uint16_t channels;
+    uint32_t sample_rate;
+    uint32_t byte_rate;
+    uint16_t block_align;
+    uint16_t bits_per_sample;
+    char data[4];
+    uint32_t data_size;
+} wav_header_t;
+
+/* WAVE_FORMAT_EXTENSIBLE header, for more than two channels or 16 bits */
+typedef struct __attribute__((packed)) {
+    char riff[4];
+    uint32_t riff_size;
+    char wave[4];
+    char fmt[4];
+    uint32_t fmt_size;
+    uint16_t format;
+    uint16_t channels;
+    uint32_t sample_rate;
+    uint32_t byte_rate;
+    uint16_t block_align;
+    uint16_t bits_per_sample;
+    uint16_t ext_size;
+    uint16_t valid_bits;
+    uint32_t channel_mask;
+    uint8_t sub_format[16];
+    char data[4];
+    uint32_t data_size;
+} wav_ext_header_t;
+
+#define WAV_FORMAT_PCM          0x0001
+#define WAV_FORMAT_EXTENSIBLE   0xFFFE
+
+/* speaker positions of 1 to 8 channels, as Windows lays out mono to 7.1 */
+static const uint32_t s_channel_mask[9] = { 0, 0x4, 0x3, 0x7, 0x33, 0x37, 0x3F, 0x13F, 0x63F };
+
+/* KSDATAFORMAT_SUBTYPE_PCM */
+static const uint8_t s_sub_format_pcm[16] = {
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0xAA, 0x00, 0x38, 0x9B, 0x71
+};
+
+typedef struct {
+    httpd_req_t *req;           /* async copy of the request */
+    mic_ring_reader_t *reader;
+    uint8_t buf[AUDIO_CHUNK_SIZE];
+} audio_stream_t;
+
+static atomic_uint s_bytes_out;
+static atomic_uint s_streams;
+static atomic_int s_active;
+
+static bool format_equal(const mic_ring_format_t *a, const mic_ring_format_t *b)
+{
+    return a->samples_frequence == b->samples_frequence && a->bit_resolution == b->bit_resolution
+           && a->ch_num == b->ch_num;
+}
+
+static void audio_http_stream(httpd_req_t *req, mic_ring_reader_t *reader, uint8_t *buf)
+{
+    mic_ring_format_t format;
+    mic_ring_format_t now;
+    mic_ring_get_format(&format);
+
+    uint16_t block_align = format.bit_resolution / 8 * format.ch_num;
+    wav_header_t header = {
+        .riff = { 'R', 'I', 'F', 'F' },
+        .riff_size = AUDIO_STREAM_SIZE,
+        .wave = { 'W', 'A', 'V', 'E' },
+        .fmt = { 'f', 'm', 't', ' ' },
+        .fmt_size = 16,
+        .format = WAV_FORMAT_PCM,
+        .channels = format.ch_num,
+        .sample_rate = format.samples_frequence,
+        .byte_rate = format.samples_frequence * block_align,
+        .block_align = block_align,
+        .bits_per_sample = format.bit_resolution,
+        .data = { 'd', 'a', 't', 'a' },
+        .data_size = AUDIO_STREAM_SIZE,
+    };
+    wav_ext_header_t ext_header = {
+        .riff = { 'R', 'I', 'F', 'F' },
+        .riff_size = AUDIO_STREAM_SIZE,
+        .wave = { 'W', 'A', 'V', 'E' },
+        .fmt = { 'f', 'm', 't', ' ' },
+        .fmt_size = 40,
+        .format = WAV_FORMAT_EXTENSIBLE,
+        .channels = format.ch_num,
+        .sample_rate = format.samples_frequence,
+        .byte_rate = format.samples_frequence * block_align,
+        .block_align = block_align,
+        .bits_per_sample = format.bit_resolution,
+        .ext_size = 22,
+        .valid_bits = format.bit_resolution,
+        .channel_mask = format.ch_num < sizeof(s_channel_mask) / sizeof(s_channel_mask[0]) ? s_channel_mask[format.ch_num] : 0,
+        .data = { 'd', 'a', 't', 'a' },
+        .data_size = AUDIO_STREAM_SIZE,
+    };
+    memcpy(ext_header.sub_format, s_sub_format_pcm, sizeof(ext_header.sub_format));
+    bool extensible = format.ch_num > 2 || format.bit_resolution > 16;
+    size_t chunk = AUDIO_CHUNK_SIZE - AUDIO_CHUNK_SIZE % block_align;
+
+    httpd_resp_set_type(req, "audio/wav");
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+
+    esp_err_t res = extensible ? httpd_resp_send_chunk(req, (const char *)&ext_header, sizeof(ext_header))
+                    : httpd_resp_send_chunk(req, (const char *)&header, sizeof(header));
+    while (res == ESP_OK) {
+        size_t n = mic_ring_read(reader, buf, chunk, pdMS_TO_TICKS(AUDIO_READ_MS));
+        /* frames of a new format do not belong under this header */
+        mic_ring_get_format(&now);
+        if (!format_equal(&format, &now)) {
+            ESP_LOGI(TAG, "mic format changed, ending the stream");
+            break;
+        }
+        if (n) {
+            if (format.bit_resolution == 8) {
+                /* UAC carries signed 8-bit samples, WAV unsigned ones */
+                pcm_flip_sign(buf, 8, n);
+            }
+            res = httpd_resp_send_chunk(req, (const char *)buf, n);
+            atomic_fetch_add(&s_bytes_out, n);
+        }
+    }
+    if (res == ESP_OK) {
+        httpd_resp_send_chunk(req, NULL, 0);
+    }
+}
+
+static void audio_http_task(void *arg)
+{
+    audio_stream_t *stream = (audio_stream_t *)arg;
+
+    audio_http_stream(stream->req, stream->reader, stream->buf);
+    httpd_req_async_handler_complete(stream->req);
+    mic_ring_reader_close(stream->reader);
+    free(stream);
+    atomic_fetch_sub(&s_active, 1);
+    vTaskDelete(NULL);
+}
+
+static esp_err_t audio_handler(httpd_req_t *req)
+{
+    mic_ring_format_t format;
+
+    mic_ring_get_format(&format);
+    if (!format.samples_frequence || format.bit_resolution % 8 || !format.ch_num) {
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        return httpd_resp_sendstr(req, "No microphone");
+    }
+    audio_stream_t *stream = (audio_stream_t *)malloc(sizeof(audio_stream_t));
+    if (!stream) {
+        return httpd_resp_send_500(req);
+    }
+    /* the reader starts with the samples written from now on */
+    stream->reader = mic_ring_reader_open();
+    if (!stream->reader) {
+        free(stream);
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        httpd_resp_set_hdr(req, "Retry-After", "1");
+        return httpd_resp_sendstr(req, "No mic ring reader left");
+    }
+    if (httpd_req_async_handler_begin(req, &stream->req) != ESP_OK) {
+        mic_ring_reader_close(stream->reader);
+        free(stream);
+        return httpd_resp_send_500(req);
+    }
+    atomic_fetch_add(&s_active, 1);
+    if (xTaskCreate(audio_http_task, "audio_http", AUDIO_TASK_STACK, stream, AUDIO_TASK_PRIO, NULL) != pdPASS) {
+        atomic_fetch_sub(&s_active, 1);
+        httpd_resp_set_status(stream->req, "503 Service Unavailable");
+        httpd_resp_sendstr(stream->req, "Out of memory");
+        httpd_req_async_handler_complete(stream->req);
+        mic_ring_reader_close(stream->reader);
+        free(stream);
+        return ESP_OK;
+    }
+    atomic_fetch_add(&s_streams, 1);
+    return ESP_OK;
+}
+
+esp_err_t audio_http_register(httpd_handle_t server)
+{
+    httpd_uri_t audio_uri = {
+        .uri = "/audio",
+        .method = HTTP_GET,
+        .handler = audio_handler,
+        .user_ctx = NULL
+    };
+
+    if (httpd_register_uri_handler(server, &audio_uri) != ESP_OK) {
+        return ESP_FAIL;
+    }
+
+    metrics_register_counter("audio_bytes_out_total", "PCM bytes sent to /audio clients", &s_bytes_out);
+    metrics_register_counter("audio_streams_total", "/audio streams started", &s_streams);
+    metrics_register_gauge("audio_streams_active", "/audio streams being sent", &s_active);
+    return ESP_OK;
+}
@@ -0,0 +1,287 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "frame_ring.h"
+#include "metrics.h"
+#include "frame_history.h"
+
+static const char *TAG = "frame_history";
+
+#define HISTORY_TASK_STACK  3072
+#define HISTORY_TASK_PRIO   4           /* below the senders, a late copy only delays the history */
+#define HISTORY_GET_MS      1000
+#define HISTORY_ALIGN(len)  (((len) + 3) & ~(size_t)3)
+
+typedef struct {
+    size_t offset;              /* position in the arena */
+    frame_history_info_t info;
+} history_entry_t;
+
+static uint8_t *s_arena;
+static size_t s_size;
+static history_entry_t *s_index;        /* circular, oldest at s_first */
+static size_t s_max_frames;
+static size_t s_first;
+static size_t s_count;
+static size_t s_write;                  /* arena offset after the newest frame */
+static uint32_t s_next_id = 1;
+static SemaphoreHandle_t s_lock;
+static frame_ring_reader_t *s_reader;
+static atomic_int s_used;
+static atomic_int s_frames;
+static atomic_uint s_frames_in;
+static atomic_uint s_evicted;
+static atomic_uint s_dropped;
+
+static history_entry_t *entry_at(size_t n)
+{
+    return &s_index[(s_first + n) % s_max_frames];
+}
+
+/* entry of a stored frame, NULL if evicted or not stored yet; lock held */
+static history_entry_t *entry_find(uint32_t id)
+{
+    if (!s_count) {
+        return NULL;
+    }
+    uint32_t n = id - s_index[s_first].info.id;
+    return n < s_count ? entry_at(n) : NULL;
+}
+
+static void history_evict(void)
+{
+    history_entry_t *e = &s_index[s_first];
+    atomic_fetch_sub(&s_used, HISTORY_ALIGN(e->info.len));
+    s_first = (s_first + 1) % s_max_frames;
+    s_count--;
+    atomic_fetch_sub(&s_frames, 1);
+    atomic_fetch_add(&s_evicted, 1);
+}
+
+/* evict until len bytes fit after the newest frame or at the arena start; lock held */
+static size_t history_alloc(size_t len)
+{
+    while (true) {
+        if (!s_count) {
+            return 0;
+        }
+        if (s_count < s_max_frames) {
+            size_t oldest = s_index[s_first].offset;
+            if (s_write > oldest) {
+                if (s_size - s_write >= len) {
+                    return s_write;
+                }
+                if (oldest >= len) {
+                    return 0;
+                }
+            } else if (oldest - s_write >= len) {
+                /* equal offsets mean the arena is full */
+                return s_write;
+            }
+        }
+        history_evict();
+    }
+}
+
+static void history_store(const camera_fb_t *fb)
+{
+    size_t len = HISTORY_ALIGN(fb->len);
+    if (len > s_size) {
+        atomic_fetch_add(&s_dropped, 1);
+        return;
+    }
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    size_t offset = history_alloc(len);
+    xSemaphoreGive(s_lock);
+
+    /* the space belongs to no stored frame anymore, readers cannot see it while it is filled */
+    memcpy(s_arena + offset, fb->buf, fb->len);
+
+    const frame_ring_meta_t *meta = frame_ring_meta(fb);
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    history_entry_t *e = entry_at(s_count);
+    e->offset = offset;
+    e->info.id = s_next_id++;
+    e->info.sequence = meta->sequence;
+    e->info.captured_us = meta->captured_us;
+    e->info.len = fb->len;
+    e->info.width = fb->width;
+    e->info.height = fb->height;
+    s_count++;
+    s_write = offset + len;
+    xSemaphoreGive(s_lock);
+
+    atomic_fetch_add(&s_used, len);
+    atomic_fetch_add(&s_frames, 1);
+    atomic_fetch_add(&s_frames_in, 1);
+}
+
+static void frame_history_task(void *arg)
+{
+    while (true) {
+        camera_fb_t *fb = frame_ring_reader_get(s_reader, pdMS_TO_TICKS(HISTORY_GET_MS));
+        if (fb) {
+            history_store(fb);
+            frame_ring_return(fb);
+        }
+    }
+}
+
+static int32_t history_span_ms(void)
+{
+    frame_history_stats_t stats;
+    frame_history_get_stats(&stats);
+    return stats.span_ms;
+}
+
+esp_err_t frame_history_start(size_t size, size_t max_frames)
+{
+    s_arena = (uint8_t *)heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!s_arena) {
+        s_arena = (uint8_t *)heap_caps_malloc(size, MALLOC_CAP_8BIT);
+    }
+    s_index = (history_entry_t *)calloc(max_frames, sizeof(history_entry_t));
+    if (!s_arena || !s_index) {
+        ESP_LOGE(TAG, "no memory for a %u byte history", size);
+        free(s_index);
+        heap_caps_free(s_arena);
+        s_index = NULL;
+        s_arena = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+    s_size = size;
+    s_max_frames = max_frames;
+
+    s_reader = frame_ring_reader_open();
+    if (!s_reader) {
+        ESP_LOGE(TAG, "no frame reader");
+        return ESP_FAIL;
+    }
+    s_lock = xSemaphoreCreateMutex();
+    if (!s_lock) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    metrics_register_gauge("history_used_bytes", "Bytes of the history arena holding frames", &s_used);
+    metrics_register_gauge("history_frames", "Frames in the history", &s_frames);
+    metrics_register_gauge_fn("history_span_ms", "Capture time covered by the history", history_span_ms);
+    metrics_register_counter("history_evicted_total", "Frames evicted from the history to make room", &s_evicted);
+    metrics_register_counter("history_dropped_total", "Frames larger than the history arena", &s_dropped);
+
+    if (xTaskCreate(frame_history_task, "frame_hist", HISTORY_TASK_STACK, NULL, HISTORY_TASK_PRIO, NULL) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+    ESP_LOGI(TAG, "%u byte history, up to %u frames", size, max_frames);
+    return ESP_OK;
+}
+
+esp_err_t frame_history_seek_time(int64_t captured_us, frame_history_info_t *info)
+{
+    esp_err_t ret = ESP_ERR_NOT_FOUND;
+
+    if (!s_lock) {
+        return ret;
+    }
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    for (size_t n = 0; n < s_count; n++) {
+        history_entry_t *e = entry_at(n);
+        if (e->info.captured_us >= captured_us) {
+            *info = e->info;
+            ret = ESP_OK;
+            break;
+        }
+    }
+    xSemaphoreGive(s_lock);
+    return ret;
+}
+
+esp_err_t frame_history_seek_back(size_t n, frame_history_info_t *info)
+{
+    esp_err_t ret = ESP_ERR_NOT_FOUND;
+
+    if (!s_lock) {
+        return ret;
+    }
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    if (s_count) {
+        *info = entry_at(n && n < s_count ? s_count - n : 0)->info;
+        ret = ESP_OK;
+    }
+    xSemaphoreGive(s_lock);
+    return ret;
+}
+
+esp_err_t frame_history_next(uint32_t id, frame_history_info_t *info)
+{
+    esp_err_t ret = ESP_ERR_NOT_FOUND;
+
+    if (!s_lock) {
+        return ret;
+    }
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    if (s_count) {
+        history_entry_t *e = entry_find(id + 1);
+        if (!e && (int32_t)(s_index[s_first].info.id - id) > 0) {
+            /* the next one is gone already, continue with the oldest */
+            e = &s_index[s_first];
+        }
+        if (e) {
+            *info = e->info;
+            ret = ESP_OK;
+        }
+    }
+    xSemaphoreGive(s_lock);
+    return ret;
+}
+
+esp_err_t frame_history_read(uint32_t id, size_t offset, void *buf, size_t len)
+{
+    esp_err_t ret = ESP_ERR_NOT_FOUND;
+
+    if (!s_lock) {
+        return ret;
+    }
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    history_entry_t *e = entry_find(id);
+    if (e) {
+        if (offset > e->info.len || len > e->info.len - offset) {
+            ret = ESP_ERR_INVALID_SIZE;
+        } else {
+            memcpy(buf, s_arena + e->offset + offset, len);
+            ret = ESP_OK;
+        }
+    }
+    xSemaphoreGive(s_lock);
+    return ret;
+}
+
+void frame_history_get_stats(frame_history_stats_t *stats)
+{
+    memset(stats, 0, sizeof(*stats));
+    if (!s_lock) {
+        return;
+    }
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    stats->size = s_size;
+    stats->used = atomic_load(&s_used);
+    stats->frames = s_count;
+    if (s_count) {
+        stats->span_ms = (entry_at(s_count - 1)->info.captured_us - s_index[s_first].info.captured_us) / 1000;
+    }
+    xSemaphoreGive(s_lock);
+    stats->frames_in = atomic_load(&s_frames_in);
+    stats->evicted = atomic_load(&s_evicted);
+    stats->dropped = atomic_load(&s_dropped);
+}
@@ -0,0 +1,448 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <inttypes.h>
+#include <stdatomic.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "frame_ring.h"
+#include "metrics.h"
+
+static const char *TAG = "frame_ring";
+
+/*
+ * Each slot has an atomic pin count. The producer claims a free slot by moving
+ * it from 0 to SLOT_WRITING, readers pin a slot by incrementing a non-negative
+ * count. Neither side ever takes a lock, and the producer never claims the
+ * newest slot, so with three slots there is always one slot to write into while
+ * one is read and one holds the newest frame (a triple buffer).
+ */
+#define SLOT_WRITING (-1)
+
+#define FRAME_GET_TIMEOUT_MS 1000
+
+typedef struct {
+    camera_fb_t fb;             /* must stay first, frame_ring_return() casts back */
+    uint8_t *data;
+    size_t size;
+    uint32_t seq;               /* ring sequence, 0 means empty */
+    frame_ring_meta_t meta;
+    atomic_int pins;            /* readers holding the slot, SLOT_WRITING while filled */
+} frame_slot_t;
+
+struct frame_ring_reader {
+    atomic_bool used;
+    uint32_t cursor;            /* ring sequence of the last frame handed out */
+    SemaphoreHandle_t wake;
+};
+
+static frame_slot_t *s_slots;
+static size_t s_slot_num;
+static atomic_int s_latest = -1;
+static atomic_uint s_seq;
+static frame_ring_reader_t s_readers[FRAME_RING_MAX_READERS];
+static frame_ring_reader_t *s_fresh_reader;
+static SemaphoreHandle_t s_fresh_lock;
+static atomic_uint s_fresh_hits;
+static atomic_uint s_fresh_waits;
+static frame_ring_listener_t s_listeners[FRAME_RING_MAX_LISTENERS];
+static void *s_listener_args[FRAME_RING_MAX_LISTENERS];
+
+static atomic_uint s_bytes_in;
+static atomic_uint s_pool_exhausted;
+static atomic_uint s_frames_oversize;
+static atomic_uint s_readers_exhausted;
+static atomic_uint s_get_timeouts;
+static atomic_uint s_bad_returns;
+static atomic_uint s_pinned;
+static atomic_uint s_pinned_max;
+static uint32_t s_push_time_last;
+static uint32_t s_push_time_max;
+static uint32_t s_push_time_avg;
+static uint32_t s_listener_time_max[FRAME_RING_MAX_LISTENERS];
+static uint32_t s_listener_time_avg[FRAME_RING_MAX_LISTENERS];
+
+/* undo a frame_ring_init() that ran out of memory, nothing was published yet */
+static void ring_free(size_t slot_num)
+{
+    for (size_t i = 0; s_slots && i < slot_num; i++) {
+        heap_caps_free(s_slots[i].data);
+    }
+    free(s_slots);
+    s_slots = NULL;
+    for (size_t i = 0; i < FRAME_RING_MAX_READERS; i++) {
+        if (s_readers[i].wake) {
+            vSemaphoreDelete(s_readers[i].wake);
+            s_readers[i].wake = NULL;
+        }
+    }
+    if (s_fresh_lock) {
+        vSemaphoreDelete(s_fresh_lock);
+        s_fresh_lock = NULL;
+    }
+}
+
+esp_err_t frame_ring_init(size_t slot_num, size_t slot_size)
+{
+    if (slot_num < 3) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    s_slots = (frame_slot_t *)calloc(slot_num, sizeof(frame_slot_t));
+    if (!s_slots) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    for (size_t i = 0; i < slot_num; i++) {
+        /* PSRAM when there is some, internal RAM is what Wi-Fi and lwIP live on */
+        s_slots[i].data = (uint8_t *)heap_caps_malloc(slot_size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (!s_slots[i].data) {
+            s_slots[i].data = (uint8_t *)heap_caps_malloc(slot_size, MALLOC_CAP_8BIT);
+        }
+        if (!s_slots[i].data) {
+            ESP_LOGE(TAG, "slot %u of %u bytes alloc failed", i, slot_size);
+            ring_free(slot_num);
+            return ESP_ERR_NO_MEM;
+        }
+        s_slots[i].size = slot_size;
+        atomic_init(&s_slots[i].pins, 0);
+    }
+
+    for (size_t i = 0; i < FRAME_RING_MAX_READERS; i++) {
+        s_readers[i].wake = xSemaphoreCreateBinary();
+        if (!s_readers[i].wake) {
+            ring_free(slot_num);
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    s_fresh_lock = xSemaphoreCreateMutex();
+    if (!s_fresh_lock) {
+        ring_free(slot_num);
+        return ESP_ERR_NO_MEM;
+    }
+
+    metrics_register_counter("camera_frames_in_total", "Frames published to the ring", &s_seq);
+    metrics_register_counter("camera_bytes_in_total", "JPEG bytes published to the ring", &s_bytes_in);
+    metrics_register_counter("camera_frames_dropped_total", "Frames dropped because every slot was pinned", &s_pool_exhausted);
+    metrics_register_counter("camera_frames_oversize_total", "Frames dropped because they do not fit in a slot", &s_frames_oversize);
+
+    s_slot_num = slot_num;
+    ESP_LOGI(TAG, "%u slots of %u bytes", slot_num, slot_size);
+    return ESP_OK;
+}
+
+static bool slot_pin(frame_slot_t *slot)
+{
+    int pins = atomic_load(&slot->pins);
+    while (pins >= 0) {
+        if (atomic_compare_exchange_weak(&slot->pins, &pins, pins + 1)) {
+            uint32_t pinned = atomic_fetch_add(&s_pinned, 1) + 1;
+            /* pins are taken from every consumer task at once, a plain compare and store could lower it */
+            uint32_t max = atomic_load(&s_pinned_max);
+            while (pinned > max && !atomic_compare_exchange_weak(&s_pinned_max, &max, pinned)) {
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+static void slot_unpin(frame_slot_t *slot)
+{
+    atomic_fetch_sub(&slot->pins, 1);
+    atomic_fetch_sub(&s_pinned, 1);
+}
+
+static frame_slot_t *slot_claim(void)
+{
+    int latest = atomic_load(&s_latest);
+
+    for (size_t n = 1; n <= s_slot_num; n++) {
+        size_t i = (latest + n) % s_slot_num;
+        int expected = 0;
+        if ((int)i == latest) {
+            continue;
+        }
+        if (atomic_compare_exchange_strong(&s_slots[i].pins, &expected, SLOT_WRITING)) {
+            return &s_slots[i];
+        }
+    }
+    return NULL;
+}
+
+/* exponential average, 1/16 weight for the new sample */
+static uint32_t time_avg_update(uint32_t avg, uint32_t us)
+{
+    return avg ? avg - (avg >> 4) + (us >> 4) : us;
+}
+
+static void push_time_update(uint32_t us)
+{
+    s_push_time_last = us;
+    if (us > s_push_time_max) {
+        s_push_time_max = us;
+    }
+    s_push_time_avg = time_avg_update(s_push_time_avg, us);
+}
+
+esp_err_t frame_ring_push(const uint8_t *data, size_t len, size_t width, size_t height, uint32_t sequence, int64_t captured_us)
+{
+    int64_t start = esp_timer_get_time();
+    frame_slot_t *slot = NULL;
+
+    if (!s_slots) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (len > s_slots[0].size) {
+        atomic_fetch_add(&s_frames_oversize, 1);
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    slot = slot_claim();
+    if (!slot) {
+        atomic_fetch_add(&s_pool_exhausted, 1);
+        push_time_update(esp_timer_get_time() - start);
+        return ESP_ERR_NO_MEM;
+    }
+
+    memcpy(slot->data, data, len);
+    slot->fb.buf = slot->data;
+    slot->fb.len = len;
+    slot->fb.width = width;
+    slot->fb.height = height;
+    slot->fb.format = PIXFORMAT_JPEG;
+    slot->fb.timestamp.tv_sec = captured_us / 1000000;
+    slot->fb.timestamp.tv_usec = captured_us % 1000000;
+    slot->meta.sequence = sequence;
+    slot->meta.captured_us = captured_us;
+    slot->seq = atomic_fetch_add(&s_seq, 1) + 1;
+    slot->meta.published_us = esp_timer_get_time();
+    atomic_fetch_add(&s_bytes_in, len);
+
+    atomic_store(&slot->pins, 0);
+    atomic_store(&s_latest, (int)(slot - s_slots));
+
+    for (size_t i = 0; i < FRAME_RING_MAX_READERS; i++) {
+        if (atomic_load(&s_readers[i].used)) {
+            xSemaphoreGive(s_readers[i].wake);
+        }
+    }
+    for (size_t i = 0; i < FRAME_RING_MAX_LISTENERS && s_listeners[i]; i++) {
+        int64_t called = esp_timer_get_time();
+        s_listeners[i](s_listener_args[i]);
+        uint32_t us = esp_timer_get_time() - called;
+        if (us > s_listener_time_max[i]) {
+            s_listener_time_max[i] = us;
+        }
+        s_listener_time_avg[i] = time_avg_update(s_listener_time_avg[i], us);
+    }
+
+    push_time_update(esp_timer_get_time() - start);
+    return ESP_OK;
+}
+
+frame_ring_reader_t *frame_ring_reader_open(void)
+{
+    if (!s_slots) {
+        return NULL;
+    }
+
+    for (size_t i = 0; i < FRAME_RING_MAX_READERS; i++) {
+        bool expected = false;
+        if (atomic_compare_exchange_strong(&s_readers[i].used, &expected, true)) {
+            frame_ring_reader_t *reader = &s_readers[i];
+            reader->cursor = atomic_load(&s_seq);
+            /* drop a wake-up left over from the previous owner */
+            xSemaphoreTake(reader->wake, 0);
+            return reader;
+        }
+    }
+    atomic_fetch_add(&s_readers_exhausted, 1);
+    return NULL;
+}
+
+void frame_ring_reader_close(frame_ring_reader_t *reader)
+{
+    if (reader) {
+        atomic_store(&reader->used, false);
+    }
+}
+
+camera_fb_t *frame_ring_reader_get(frame_ring_reader_t *reader, TickType_t timeout)
+{
+    if (!reader) {
+        return NULL;
+    }
+
+    while (true) {
+        int latest = atomic_load(&s_latest);
+        if (latest >= 0) {
+            frame_slot_t *slot = &s_slots[latest];
+            if (!slot_pin(slot)) {
+                /* rewritten under us, s_latest has already moved on */
+                continue;
+            }
+            if (slot->seq > reader->cursor) {
+                reader->cursor = slot->seq;
+                return &slot->fb;
+            }
+            slot_unpin(slot);
+        }
+
+        if (xSemaphoreTake(reader->wake, timeout) != pdTRUE) {
+            atomic_fetch_add(&s_get_timeouts, 1);
+            return NULL;
+        }
+    }
+}
+
+void frame_ring_return(camera_fb_t *fb)
+{
+    frame_slot_t *slot = (frame_slot_t *)fb;
+
+    if (!fb) {
+        return;
+    }
+    /* a buffer that is not ours or not pinned would be recycled while still in use */
+    if (slot < s_slots || slot >= s_slots + s_slot_num || atomic_load(&slot->pins) <= 0) {
+        atomic_fetch_add(&s_bad_returns, 1);
+        ESP_LOGE(TAG, "return of unpinned frame buffer %p", fb);
+        return;
+    }
+    slot_unpin(slot);
+}
+
+esp_err_t frame_ring_add_listener(frame_ring_listener_t listener, void *arg)
+{
+    for (size_t i = 0; i < FRAME_RING_MAX_LISTENERS; i++) {
+        if (!s_listeners[i]) {
+            s_listener_args[i] = arg;
+            s_listeners[i] = listener;
+            return ESP_OK;
+        }
+    }
+    return ESP_ERR_NO_MEM;
+}
+
+camera_fb_t *frame_ring_ref(camera_fb_t *fb)
+{
+    frame_slot_t *slot = (frame_slot_t *)fb;
+
+    /* the caller already holds a pin, so the slot can not be claimed meanwhile */
+    if (!fb || !slot_pin(slot)) {
+        return NULL;
+    }
+    return fb;
+}
+
+const frame_ring_meta_t *frame_ring_meta(const camera_fb_t *fb)
+{
+    return &((const frame_slot_t *)fb)->meta;
+}
+
+void frame_ring_get_stats(frame_ring_stats_t *stats)
+{
+    stats->frames_in = atomic_load(&s_seq);
+    stats->pool_exhausted = atomic_load(&s_pool_exhausted);
+    stats->frames_oversize = atomic_load(&s_frames_oversize);
+    stats->readers_exhausted = atomic_load(&s_readers_exhausted);
+    stats->get_timeouts = atomic_load(&s_get_timeouts);
+    stats->bad_returns = atomic_load(&s_bad_returns);
+    stats->fresh_hits = atomic_load(&s_fresh_hits);
+    stats->fresh_waits = atomic_load(&s_fresh_waits);
+    stats->pinned = atomic_load(&s_pinned);
+    stats->pinned_max = atomic_load(&s_pinned_max);
+    stats->push_time_last_us = s_push_time_last;
+    stats->push_time_max_us = s_push_time_max;
+    stats->push_time_avg_us = s_push_time_avg;
+    stats->listener_num = 0;
+    for (size_t i = 0; i < FRAME_RING_MAX_LISTENERS && s_listeners[i]; i++) {
+        stats->listener_time_max_us[i] = s_listener_time_max[i];
+        stats->listener_time_avg_us[i] = s_listener_time_avg[i];
+        stats->listener_num++;
+    }
+}
+
+/* pin the newest frame if it is at most max_age_us old */
+static camera_fb_t *latest_pin_fresh(uint32_t max_age_us)
+{
+    while (true) {
+        int latest = atomic_load(&s_latest);
+        if (latest < 0) {
+            return NULL;
+        }
+        frame_slot_t *slot = &s_slots[latest];
+        if (!slot_pin(slot)) {
+            continue;
+        }
+        if (esp_timer_get_time() - slot->meta.published_us <= max_age_us) {
+            return &slot->fb;
+        }
+        slot_unpin(slot);
+        return NULL;
+    }
+}
+
+camera_fb_t *frame_ring_get_fresh(uint32_t max_age_us, TickType_t timeout)
+{
+    camera_fb_t *fb = NULL;
+
+    if (!s_slots) {
+        return NULL;
+    }
+
+    fb = latest_pin_fresh(max_age_us);
+    if (fb) {
+        atomic_fetch_add(&s_fresh_hits, 1);
+        return fb;
+    }
+
+    /*
+     * Only one caller waits on the ring, the others queue on the lock. When
+     * the waiter gets its frame the next one in line finds it fresh and
+     * returns right away, so a burst of requests costs a single frame wait.
+     */
+    if (xSemaphoreTake(s_fresh_lock, timeout) != pdTRUE) {
+        atomic_fetch_add(&s_get_timeouts, 1);
+        return NULL;
+    }
+    fb = latest_pin_fresh(max_age_us);
+    if (fb) {
+        atomic_fetch_add(&s_fresh_hits, 1);
+    } else {
+        if (!s_fresh_reader) {
+            s_fresh_reader = frame_ring_reader_open();
+        }
+        if (s_fresh_reader) {
+            atomic_fetch_add(&s_fresh_waits, 1);
+            s_fresh_reader->cursor = atomic_load(&s_seq);
+            xSemaphoreTake(s_fresh_reader->wake, 0);
+            fb = frame_ring_reader_get(s_fresh_reader, timeout);
+        }
+    }
+    xSemaphoreGive(s_fresh_lock);
+    return fb;
+}
+
+camera_fb_t *frame_ring_get_latest(void)
+{
+    return s_slots ? latest_pin_fresh(UINT32_MAX) : NULL;
+}
+
+camera_fb_t *esp_camera_fb_get()
+{
+    return frame_ring_get_fresh(CONFIG_CAPTURE_MAX_AGE_MS * 1000, pdMS_TO_TICKS(FRAME_GET_TIMEOUT_MS));
+}
+
+void esp_camera_fb_return(camera_fb_t *fb)
+{
+    frame_ring_return(fb);
+}
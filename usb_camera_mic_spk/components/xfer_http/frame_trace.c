@@ -0,0 +1,87 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "esp_timer.h"
+#include "frame_ring.h"
+#include "frame_trace.h"
+#include "metrics.h"
+
+static lat_hist_t s_hists[FRAME_STAGE_MAX];
+
+static const char *const s_stage_names[FRAME_STAGE_MAX] = {
+    [FRAME_STAGE_PUBLISH] = "publish",
+    [FRAME_STAGE_HANDOFF] = "handoff",
+    [FRAME_STAGE_FIRST_BYTE] = "first_byte",
+    [FRAME_STAGE_LAST_BYTE] = "last_byte",
+    [FRAME_STAGE_TOTAL] = "total",
+};
+
+static const char *const s_metric_names[FRAME_STAGE_MAX] = {
+    [FRAME_STAGE_PUBLISH] = "frame_publish_us",
+    [FRAME_STAGE_HANDOFF] = "frame_handoff_us",
+    [FRAME_STAGE_FIRST_BYTE] = "frame_first_byte_us",
+    [FRAME_STAGE_LAST_BYTE] = "frame_last_byte_us",
+    [FRAME_STAGE_TOTAL] = "frame_total_us",
+};
+
+static const char *const s_metric_helps[FRAME_STAGE_MAX] = {
+    [FRAME_STAGE_PUBLISH] = "USB completion to published in the ring",
+    [FRAME_STAGE_HANDOFF] = "Published to taken by the consumer",
+    [FRAME_STAGE_FIRST_BYTE] = "Taken by the consumer to first byte sent",
+    [FRAME_STAGE_LAST_BYTE] = "First byte sent to last byte sent",
+    [FRAME_STAGE_TOTAL] = "USB completion to last byte sent",
+};
+
+void frame_trace_register_metrics(void)
+{
+    for (size_t i = 0; i < FRAME_STAGE_MAX; i++) {
+        metrics_register_histogram(s_metric_names[i], s_metric_helps[i], &s_hists[i]);
+    }
+}
+
+static void stage_record(frame_stage_t stage, int64_t from, int64_t to)
+{
+    lat_hist_record(&s_hists[stage], to > from ? (uint32_t)(to - from) : 0);
+}
+
+void frame_trace_handoff(frame_trace_t *trace, const camera_fb_t *fb)
+{
+    const frame_ring_meta_t *meta = frame_ring_meta(fb);
+
+    trace->captured_us = meta->captured_us;
+    trace->published_us = meta->published_us;
+    trace->handoff_us = esp_timer_get_time();
+    trace->first_byte_us = 0;
+}
+
+void frame_trace_first_byte(frame_trace_t *trace)
+{
+    if (!trace->first_byte_us) {
+        trace->first_byte_us = esp_timer_get_time();
+    }
+}
+
+void frame_trace_last_byte(frame_trace_t *trace)
+{
+    int64_t now = esp_timer_get_time();
+
+    frame_trace_first_byte(trace);
+    stage_record(FRAME_STAGE_PUBLISH, trace->captured_us, trace->published_us);
+    stage_record(FRAME_STAGE_HANDOFF, trace->published_us, trace->handoff_us);
+    stage_record(FRAME_STAGE_FIRST_BYTE, trace->handoff_us, trace->first_byte_us);
+    stage_record(FRAME_STAGE_LAST_BYTE, trace->first_byte_us, now);
+    stage_record(FRAME_STAGE_TOTAL, trace->captured_us, now);
+}
+
+lat_hist_t *frame_trace_hist(frame_stage_t stage)
+{
+    return stage < FRAME_STAGE_MAX ? &s_hists[stage] : NULL;
+}
+
+const char *frame_trace_stage_name(frame_stage_t stage)
+{
+    return stage < FRAME_STAGE_MAX ? s_stage_names[stage] : "unknown";
+}
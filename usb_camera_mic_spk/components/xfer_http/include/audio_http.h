@@ -0,0 +1,45 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Live microphone endpoint
+ *
+ * /audio streams the microphone as a chunked WAV file of unknown length, in
+ * the format negotiated with the UAC device (see mic_ring.h). The header
+ * carries 0xFFFFFFFF as RIFF and data size, which players treat as a live
+ * stream. Playback starts with the samples written after the request came in.
+ *
+ * Each stream reads the mic ring through a reader of its own, so as many
+ * clients are served as there are readers left (MIC_RING_MAX_READERS in all,
+ * the speaker loopback holds one when enabled); others get 503. The response
+ * leaves the httpd task as an async request and is written by a task started
+ * for it, with a buffer of its own. It ends when the client goes away or the
+ * microphone is disconnected or renegotiated.
+ */
+
+#pragma once
+
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Register /audio.
+ *
+ * @param server Running HTTP server
+ *
+ * @return
+ *     - ESP_OK on success
+ *     - ESP_FAIL if the handler can not be registered
+ */
+esp_err_t audio_http_register(httpd_handle_t server);
+
+#ifdef __cplusplus
+}
+#endif
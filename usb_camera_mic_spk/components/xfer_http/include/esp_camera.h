@@ -40,7 +40,7 @@ typedef struct {
     size_t width;               /*!< Width of the buffer in pixels */
     size_t height;              /*!< Height of the buffer in pixels */
     pixformat_t format;         /*!< Format of the pixel data */
-    struct timeval timestamp;   /*!< Timestamp since boot of the first DMA buffer of the frame */
+    struct timeval timestamp;   /*!< Time since boot the USB transfer of the frame completed */
 } camera_fb_t;
 
 #define ESP_ERR_CAMERA_BASE 0x20000
@@ -49,16 +49,19 @@ typedef struct {
 #define ESP_ERR_CAMERA_FAILED_TO_SET_OUT_FORMAT (ESP_ERR_CAMERA_BASE + 3)
 #define ESP_ERR_CAMERA_NOT_SUPPORTED            (ESP_ERR_CAMERA_BASE + 4)
 
-/************************************** Functions user implement ************************************************/
+/************************************** Functions implemented by frame_ring.c ***********************************/
 /**
- * @brief Obtain pointer to a frame buffer.
+ * @brief Pin the newest frame, waiting for the next one if it is older than CONFIG_CAPTURE_MAX_AGE_MS.
  *
- * @return pointer to the frame buffer
+ * The buffer is reference counted, it stays valid and unchanged until
+ * esp_camera_fb_return() is called, however long the caller takes to send it.
+ *
+ * @return pointer to the frame buffer, or NULL if no frame arrived in time
  */
 camera_fb_t* esp_camera_fb_get();
 
 /**
- * @brief Return the frame buffer to be reused again.
+ * @brief Unpin the frame buffer so it can be reused again.
  *
  * @param fb    Pointer to the frame buffer
  */
@@ -0,0 +1,127 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Time-shift history of JPEG frames
+ *
+ * A task copies every frame of the frame ring into one preallocated arena,
+ * back to back, so the last seconds of video stay available after the ring
+ * slots are recycled. The arena is a byte ring: a new frame goes after the
+ * newest one, wrapping to the start when the end is too short, and the oldest
+ * frames are evicted until it fits. A fixed index of up to max_frames entries
+ * holds where each frame lives and when it was captured. Nothing is allocated
+ * per frame.
+ *
+ * Readers look frames up by id and copy them out piece by piece. A frame can
+ * be evicted between two pieces, frame_history_read() then fails and the
+ * reader gives up on it, the writer is never held back.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Where and when a stored frame was taken
+ */
+typedef struct {
+    uint32_t id;                /*!< History id, increasing by one per stored frame */
+    uint32_t sequence;          /*!< Camera sequence number */
+    int64_t captured_us;        /*!< esp_timer time the frame was captured */
+    uint32_t len;               /*!< JPEG length */
+    uint16_t width;
+    uint16_t height;
+} frame_history_info_t;
+
+/**
+ * @brief History statistics
+ */
+typedef struct {
+    size_t size;                /*!< Arena size */
+    size_t used;                /*!< Bytes held by stored frames */
+    uint32_t frames;            /*!< Frames stored */
+    uint32_t span_ms;           /*!< Capture time between the oldest and newest frame */
+    uint32_t frames_in;         /*!< Frames stored since start */
+    uint32_t evicted;           /*!< Frames evicted to make room */
+    uint32_t dropped;           /*!< Frames larger than the arena */
+} frame_history_stats_t;
+
+/**
+ * @brief Allocate the arena and start the task copying frames into it.
+ *
+ * The arena goes to PSRAM when the chip has it, internal RAM otherwise.
+ *
+ * @param size       Arena size in bytes
+ * @param max_frames Most frames kept at once
+ *
+ * @return
+ *     - ESP_OK on success
+ *     - ESP_ERR_NO_MEM if the arena, index or task could not be allocated
+ *     - ESP_FAIL if no frame reader is left
+ */
+esp_err_t frame_history_start(size_t size, size_t max_frames);
+
+/**
+ * @brief Find the oldest frame captured at or after a time.
+ *
+ * @param captured_us esp_timer time
+ * @param info        Filled with the frame
+ *
+ * @return ESP_OK, or ESP_ERR_NOT_FOUND if no stored frame is that recent
+ */
+esp_err_t frame_history_seek_time(int64_t captured_us, frame_history_info_t *info);
+
+/**
+ * @brief Find the n-th newest frame, or the oldest if fewer are stored.
+ *
+ * @param n    1 for the newest frame
+ * @param info Filled with the frame
+ *
+ * @return ESP_OK, or ESP_ERR_NOT_FOUND if the history is empty
+ */
+esp_err_t frame_history_seek_back(size_t n, frame_history_info_t *info);
+
+/**
+ * @brief Find the frame stored after a given one.
+ *
+ * @param id   History id of the previous frame
+ * @param info Filled with the oldest stored frame with a larger id
+ *
+ * @return ESP_OK, or ESP_ERR_NOT_FOUND if no newer frame is stored
+ */
+esp_err_t frame_history_next(uint32_t id, frame_history_info_t *info);
+
+/**
+ * @brief Copy part of a stored frame.
+ *
+ * @param id     History id of the frame
+ * @param offset Offset in the JPEG
+ * @param buf    Destination
+ * @param len    Bytes to copy, offset + len must not exceed the frame length
+ *
+ * @return
+ *     - ESP_OK on success
+ *     - ESP_ERR_NOT_FOUND if the frame was evicted
+ *     - ESP_ERR_INVALID_SIZE if the range is outside the frame
+ */
+esp_err_t frame_history_read(uint32_t id, size_t offset, void *buf, size_t len);
+
+/**
+ * @brief Read the history statistics.
+ *
+ * @param stats Filled with the current values, zero if the history is not started
+ */
+void frame_history_get_stats(frame_history_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
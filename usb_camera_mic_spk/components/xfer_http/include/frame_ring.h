@@ -0,0 +1,215 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Broadcast ring of JPEG frames
+ *
+ * The UVC frame callback pushes every frame into one of N slots. Any number of
+ * consumers (capture, stream clients) open a reader, each with its own read
+ * cursor, and get the newest frame they have not seen yet. Slots are reference
+ * counted camera_fb_t buffers: one handed out stays valid until it is returned,
+ * the producer only recycles slots nobody holds. esp_camera_fb_get() and
+ * esp_camera_fb_return() pin and unpin slots of the same pool.
+ *
+ * Pushing never blocks: when every slot is pinned the frame is dropped and
+ * counted, so a slow consumer can not stall the USB stream task.
+ */
+
+#pragma once
+
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "sdkconfig.h"
+#include "esp_camera.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FRAME_RING_MAX_READERS CONFIG_CAMERA_FB_MAX_READERS   /*!< Maximum number of readers opened at the same time */
+
+#define FRAME_RING_MAX_LISTENERS 4 /*!< Maximum number of push listeners */
+
+typedef struct frame_ring_reader frame_ring_reader_t;
+
+/**
+ * @brief Called from frame_ring_push() after a frame is published, must not block
+ */
+typedef void (*frame_ring_listener_t)(void *arg);
+
+/**
+ * @brief Where a frame came from, carried with every slot
+ */
+typedef struct {
+    uint32_t sequence;          /*!< Frame sequence number from the camera */
+    int64_t captured_us;        /*!< esp_timer time the USB transfer of the frame completed */
+    int64_t published_us;       /*!< esp_timer time the frame became visible to readers */
+} frame_ring_meta_t;
+
+/**
+ * @brief Pool statistics
+ */
+typedef struct {
+    uint32_t frames_in;         /*!< Frames published to readers */
+    uint32_t pool_exhausted;    /*!< Frames dropped because every slot was pinned */
+    uint32_t frames_oversize;   /*!< Frames dropped because they do not fit in a slot */
+    uint32_t readers_exhausted; /*!< frame_ring_reader_open() calls that found no free reader */
+    uint32_t get_timeouts;      /*!< frame_ring_reader_get() calls that timed out */
+    uint32_t bad_returns;       /*!< Returns of buffers that were not pinned, ignored */
+    uint32_t fresh_hits;        /*!< frame_ring_get_fresh() calls served from the newest frame */
+    uint32_t fresh_waits;       /*!< frame_ring_get_fresh() calls that had to wait for a frame */
+    uint32_t pinned;            /*!< Pins currently held by consumers */
+    uint32_t pinned_max;        /*!< Highest number of pins held at once */
+    uint32_t push_time_last_us; /*!< Time spent in the last frame_ring_push() */
+    uint32_t push_time_max_us;  /*!< Longest frame_ring_push() so far */
+    uint32_t push_time_avg_us;  /*!< Moving average of frame_ring_push() */
+    uint32_t listener_num;      /*!< Listeners registered, valid entries below */
+    uint32_t listener_time_max_us[FRAME_RING_MAX_LISTENERS]; /*!< Longest call of each listener, part of the push time */
+    uint32_t listener_time_avg_us[FRAME_RING_MAX_LISTENERS]; /*!< Moving average of each listener */
+} frame_ring_stats_t;
+
+/**
+ * @brief Allocate the ring slots.
+ *
+ * Slots are taken from PSRAM when there is some. On failure nothing stays
+ * allocated and the ring is left uninitialized: pushes are refused and
+ * readers get no frames, so the caller can carry on without the camera.
+ *
+ * @param slot_num  Number of slots, at least 3
+ * @param slot_size Size in bytes of each slot, larger frames are dropped
+ *
+ * @return
+ *     - ESP_OK on success
+ *     - ESP_ERR_INVALID_ARG if slot_num is too small
+ *     - ESP_ERR_NO_MEM if the slots could not be allocated
+ */
+esp_err_t frame_ring_init(size_t slot_num, size_t slot_size);
+
+/**
+ * @brief Copy a frame into the ring and wake up all readers.
+ *
+ * Lock-free, safe to call from the UVC frame callback. The frame timestamp is
+ * set to captured_us.
+ *
+ * @param data        JPEG data
+ * @param len         Length of the data in bytes
+ * @param width       Width of the frame in pixels
+ * @param height      Height of the frame in pixels
+ * @param sequence    Frame sequence number from the camera
+ * @param captured_us esp_timer time the USB transfer of the frame completed
+ *
+ * @return
+ *     - ESP_OK if the frame was published
+ *     - ESP_ERR_INVALID_STATE if frame_ring_init() did not succeed
+ *     - ESP_ERR_INVALID_SIZE if the frame does not fit in a slot
+ *     - ESP_ERR_NO_MEM if every slot is in use, the frame is dropped
+ */
+esp_err_t frame_ring_push(const uint8_t *data, size_t len, size_t width, size_t height, uint32_t sequence, int64_t captured_us);
+
+/**
+ * @brief Open a reader, positioned at the newest frame in the ring.
+ *
+ * The first frame returned by frame_ring_reader_get() is the next one pushed.
+ *
+ * @return reader handle, or NULL if FRAME_RING_MAX_READERS are already open
+ */
+frame_ring_reader_t *frame_ring_reader_open(void);
+
+/**
+ * @brief Close a reader. Frames obtained through it stay valid until returned.
+ *
+ * @param reader Reader handle
+ */
+void frame_ring_reader_close(frame_ring_reader_t *reader);
+
+/**
+ * @brief Get the newest frame the reader has not seen yet.
+ *
+ * Frames pushed while the reader was busy are skipped, only the newest one is
+ * returned.
+ *
+ * @param reader  Reader handle
+ * @param timeout Ticks to wait for a new frame
+ *
+ * @return pinned frame buffer, or NULL on timeout
+ */
+camera_fb_t *frame_ring_reader_get(frame_ring_reader_t *reader, TickType_t timeout);
+
+/**
+ * @brief Return a frame obtained by frame_ring_reader_get().
+ *
+ * @param fb Frame buffer
+ */
+void frame_ring_return(camera_fb_t *fb);
+
+/**
+ * @brief Get the newest frame if it is recent enough, otherwise wait for the next one.
+ *
+ * Concurrent callers that have to wait share a single wait on the ring.
+ * Release the frame with frame_ring_return().
+ *
+ * @param max_age_us Oldest acceptable frame, in microseconds since it was pushed
+ * @param timeout    Ticks to wait for a new frame
+ *
+ * @return pinned frame buffer, or NULL on timeout
+ */
+camera_fb_t *frame_ring_get_fresh(uint32_t max_age_us, TickType_t timeout);
+
+/**
+ * @brief Get the newest frame, however old, without waiting.
+ *
+ * Release the frame with frame_ring_return().
+ *
+ * @return pinned frame buffer, or NULL if no frame was pushed yet
+ */
+camera_fb_t *frame_ring_get_latest(void);
+
+/**
+ * @brief Take one more pin on a frame the caller already holds.
+ *
+ * Lets a single reader share one frame between several consumers, each of
+ * them calls frame_ring_return() when done.
+ *
+ * @param fb Frame buffer pinned by the caller
+ *
+ * @return fb, or NULL if fb is not pinned
+ */
+camera_fb_t *frame_ring_ref(camera_fb_t *fb);
+
+/**
+ * @brief Get the origin of a frame.
+ *
+ * @param fb Frame buffer pinned by the caller
+ *
+ * @return metadata of the frame, valid while fb is pinned
+ */
+const frame_ring_meta_t *frame_ring_meta(const camera_fb_t *fb);
+
+/**
+ * @brief Register a function called on every published frame.
+ *
+ * For consumers that can not wait on a reader, e.g. a select() loop.
+ * Listeners can not be removed.
+ *
+ * @param listener Function to call, runs in the UVC callback context
+ * @param arg      Argument passed to the listener
+ *
+ * @return
+ *     - ESP_OK on success
+ *     - ESP_ERR_NO_MEM if FRAME_RING_MAX_LISTENERS are already registered
+ */
+esp_err_t frame_ring_add_listener(frame_ring_listener_t listener, void *arg);
+
+/**
+ * @brief Read the pool statistics.
+ *
+ * @param stats Filled with the current values
+ */
+void frame_ring_get_stats(frame_ring_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,92 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Per-frame latency tracing
+ *
+ * Every frame delivered to an HTTP client is stamped when the USB transfer
+ * completed, when it was published to the ring, when the consumer took it,
+ * and when its first and last byte were handed to the socket. Each stage is
+ * summarized in a lat_hist, one sample per delivered frame.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "esp_camera.h"
+#include "lat_hist.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    FRAME_STAGE_PUBLISH = 0,    /*!< USB completion to published in the ring */
+    FRAME_STAGE_HANDOFF,        /*!< Published to taken by the consumer */
+    FRAME_STAGE_FIRST_BYTE,     /*!< Taken by the consumer to first byte sent */
+    FRAME_STAGE_LAST_BYTE,      /*!< First byte sent to last byte sent */
+    FRAME_STAGE_TOTAL,          /*!< USB completion to last byte sent */
+    FRAME_STAGE_MAX,
+} frame_stage_t;
+
+/**
+ * @brief Timestamps of one frame on its way to one client, esp_timer microseconds
+ */
+typedef struct {
+    int64_t captured_us;
+    int64_t published_us;
+    int64_t handoff_us;
+    int64_t first_byte_us;
+} frame_trace_t;
+
+/**
+ * @brief Register the stage histograms with the metrics registry.
+ */
+void frame_trace_register_metrics(void);
+
+/**
+ * @brief Start tracing a frame the consumer just took from the ring.
+ *
+ * @param trace Trace to fill
+ * @param fb    Pinned frame from the ring
+ */
+void frame_trace_handoff(frame_trace_t *trace, const camera_fb_t *fb);
+
+/**
+ * @brief Stamp the first byte sent, later calls for the same frame are ignored.
+ *
+ * @param trace Trace started by frame_trace_handoff()
+ */
+void frame_trace_first_byte(frame_trace_t *trace);
+
+/**
+ * @brief Stamp the last byte sent and record every stage in the histograms.
+ *
+ * @param trace Trace started by frame_trace_handoff()
+ */
+void frame_trace_last_byte(frame_trace_t *trace);
+
+/**
+ * @brief Get the histogram of one stage.
+ *
+ * @param stage Stage
+ *
+ * @return histogram, NULL if stage is out of range
+ */
+lat_hist_t *frame_trace_hist(frame_stage_t stage);
+
+/**
+ * @brief Get the name of a stage, as used in /status.
+ *
+ * @param stage Stage
+ *
+ * @return name, "unknown" if stage is out of range
+ */
+const char *frame_trace_stage_name(frame_stage_t stage);
+
+#ifdef __cplusplus
+}
+#endif
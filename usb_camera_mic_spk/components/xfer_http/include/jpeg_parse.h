@@ -0,0 +1,99 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Baseline JPEG header parser
+ *
+ * Reads the tables and frame layout of a single-scan baseline JPEG as sent by
+ * UVC cameras, up to the start of the entropy-coded data. MJPEG cameras often
+ * leave out DHT; the standard tables of ITU T.81 Annex K are filled in then.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define JPEG_MAX_COMPONENTS 3
+
+/**
+ * @brief Huffman table as stored in DHT
+ */
+typedef struct {
+    uint8_t bits[16];           /*!< Number of codes of each length 1..16 */
+    uint8_t vals[256];          /*!< Symbols in order of increasing code length */
+    bool defined;               /*!< Set when the table was found or filled in */
+    bool standard;              /*!< Table equals the Annex K one, sent or filled in */
+} jpeg_huff_table_t;
+
+/**
+ * @brief One image component
+ */
+typedef struct {
+    uint8_t id;                 /*!< Component identifier */
+    uint8_t h;                  /*!< Horizontal sampling factor */
+    uint8_t v;                  /*!< Vertical sampling factor */
+    uint8_t tq;                 /*!< Quantization table index */
+    uint8_t td;                 /*!< DC Huffman table index */
+    uint8_t ta;                 /*!< AC Huffman table index */
+} jpeg_component_t;
+
+/**
+ * @brief Everything needed to decode the scan
+ */
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    uint8_t num_components;
+    uint8_t h_max;              /*!< Largest horizontal sampling factor */
+    uint8_t v_max;              /*!< Largest vertical sampling factor */
+    jpeg_component_t comp[JPEG_MAX_COMPONENTS];
+    uint16_t qt[4][64];         /*!< Quantization tables, zigzag order */
+    uint8_t qt_mask;            /*!< Bit n set when table n was defined */
+    jpeg_huff_table_t dc[2];    /*!< DC Huffman tables */
+    jpeg_huff_table_t ac[2];    /*!< AC Huffman tables */
+    uint16_t restart_interval;  /*!< MCUs between RST markers, 0 for none */
+    const uint8_t *scan;        /*!< Entropy-coded data */
+    size_t scan_len;            /*!< Length of the scan data, EOI excluded */
+} jpeg_info_t;
+
+/**
+ * @brief Zigzag index to natural (row major) coefficient index
+ */
+extern const uint8_t jpeg_zigzag[64];
+
+/**
+ * @brief Fill in one of the standard Huffman tables of Annex K.3.
+ *
+ * @param table  Table to fill
+ * @param ac     AC table if true, DC table otherwise
+ * @param chroma Chrominance table if true, luminance table otherwise
+ */
+void jpeg_huff_std(jpeg_huff_table_t *table, bool ac, bool chroma);
+
+/**
+ * @brief Parse the headers of a baseline JPEG.
+ *
+ * @param data JPEG data, must stay valid while info->scan is used
+ * @param len  Length of the data
+ * @param info Filled with the parsed tables and layout
+ *
+ * @return
+ *     - ESP_OK on success
+ *     - ESP_ERR_INVALID_ARG if the data is not a well formed JPEG
+ *     - ESP_ERR_NOT_SUPPORTED for progressive, 12-bit, multi-scan or unusual sampling
+ */
+esp_err_t jpeg_parse(const uint8_t *data, size_t len, jpeg_info_t *info);
+
+#ifdef __cplusplus
+}
+#endif
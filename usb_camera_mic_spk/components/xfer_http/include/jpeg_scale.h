@@ -0,0 +1,50 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Compressed-domain JPEG downscaling
+ *
+ * Shrinks a baseline JPEG by 2, 4 or 8 without decoding it to full size. The
+ * entropy decoder keeps only the low-frequency (8/scale)^2 coefficients of
+ * each block, a reduced inverse DCT turns them into an (8/scale)^2 pixel
+ * block, and the reduced image is re-encoded one MCU row at a time with the
+ * source quantization tables and the standard Huffman tables. Sampling
+ * (4:4:4, 4:2:2, 4:2:0, grayscale) and restart intervals of the source are
+ * handled; the output has no restart markers.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Downscale a JPEG.
+ *
+ * @param src      Baseline JPEG
+ * @param src_len  Length of src
+ * @param scale    Divisor of width and height: 2, 4 or 8
+ * @param dst      Buffer for the scaled JPEG
+ * @param dst_size Size of dst
+ * @param dst_len  Length of the scaled JPEG on success
+ *
+ * @return
+ *     - ESP_OK on success
+ *     - ESP_ERR_INVALID_ARG if scale is not 2, 4 or 8 or src is not a valid JPEG
+ *     - ESP_ERR_NOT_SUPPORTED if src is not a baseline single-scan JPEG
+ *     - ESP_ERR_INVALID_SIZE if the result does not fit in dst
+ *     - ESP_ERR_NO_MEM if the working buffers could not be allocated
+ */
+esp_err_t jpeg_scale(const uint8_t *src, size_t src_len, uint32_t scale, uint8_t *dst, size_t dst_size, size_t *dst_len);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,58 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Lock-free latency histogram
+ *
+ * Log-linear buckets, four per power of two, so any percentile is known to
+ * within 12.5%. Recording is one atomic increment and safe from any task.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdatomic.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LAT_HIST_BUCKETS 124    /*!< Covers the full uint32_t range */
+
+typedef struct {
+    atomic_uint buckets[LAT_HIST_BUCKETS];
+    atomic_uint count;
+    atomic_uint max;
+} lat_hist_t;
+
+/**
+ * @brief Add one sample.
+ *
+ * @param hist Histogram, zero initialized
+ * @param us   Sample value, usually microseconds
+ */
+void lat_hist_record(lat_hist_t *hist, uint32_t us);
+
+/**
+ * @brief Estimate a percentile.
+ *
+ * @param hist     Histogram
+ * @param permille Percentile in 1/1000, e.g. 500 for p50, 990 for p99
+ *
+ * @return midpoint of the bucket holding the percentile, 0 if empty
+ */
+uint32_t lat_hist_percentile(lat_hist_t *hist, uint32_t permille);
+
+/**
+ * @brief Clear all samples.
+ *
+ * @param hist Histogram
+ */
+void lat_hist_reset(lat_hist_t *hist);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,104 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Metrics registry
+ *
+ * Modules register pointers to the atomic counters, gauges and latency
+ * histograms they already keep, so updating a metric on the hot path stays a
+ * single atomic operation and the registry never takes a lock. Registration
+ * is lock-free as well; metrics can not be removed. metrics_write() renders
+ * every registered metric in the Prometheus text format.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdatomic.h>
+#include "esp_err.h"
+#include "lat_hist.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define METRICS_MAX 64      /*!< Maximum number of registered metrics */
+
+/**
+ * @brief Reads a gauge that is computed on demand, e.g. free heap
+ */
+typedef int32_t (*metrics_read_t)(void);
+
+/**
+ * @brief Receives the rendered text, piece by piece
+ */
+typedef esp_err_t (*metrics_write_t)(void *ctx, const char *text);
+
+/**
+ * @brief Register a monotonically increasing counter.
+ *
+ * @param name  Metric name, must stay valid
+ * @param help  One line description, must stay valid
+ * @param value Counter owned by the caller
+ *
+ * @return
+ *     - ESP_OK on success
+ *     - ESP_ERR_NO_MEM if METRICS_MAX metrics are already registered
+ */
+esp_err_t metrics_register_counter(const char *name, const char *help, atomic_uint *value);
+
+/**
+ * @brief Register a gauge kept by the caller.
+ *
+ * @param name  Metric name, must stay valid
+ * @param help  One line description, must stay valid
+ * @param value Gauge owned by the caller
+ *
+ * @return
+ *     - ESP_OK on success
+ *     - ESP_ERR_NO_MEM if METRICS_MAX metrics are already registered
+ */
+esp_err_t metrics_register_gauge(const char *name, const char *help, atomic_int *value);
+
+/**
+ * @brief Register a gauge read through a function when rendered.
+ *
+ * @param name Metric name, must stay valid
+ * @param help One line description, must stay valid
+ * @param read Function returning the current value
+ *
+ * @return
+ *     - ESP_OK on success
+ *     - ESP_ERR_NO_MEM if METRICS_MAX metrics are already registered
+ */
+esp_err_t metrics_register_gauge_fn(const char *name, const char *help, metrics_read_t read);
+
+/**
+ * @brief Register a latency histogram, rendered as a summary in microseconds.
+ *
+ * @param name Metric name, must stay valid
+ * @param help One line description, must stay valid
+ * @param hist Histogram owned by the caller
+ *
+ * @return
+ *     - ESP_OK on success
+ *     - ESP_ERR_NO_MEM if METRICS_MAX metrics are already registered
+ */
+esp_err_t metrics_register_histogram(const char *name, const char *help, lat_hist_t *hist);
+
+/**
+ * @brief Render every registered metric.
+ *
+ * @param write Called with each rendered piece, stops on the first error
+ * @param ctx   Passed to write
+ *
+ * @return ESP_OK, or the first error returned by write
+ */
+esp_err_t metrics_write(metrics_write_t write, void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,156 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Ring of microphone samples
+ *
+ * The UAC mic callback writes every packet into a byte ring that any number
+ * of consumers (the /audio endpoint, the speaker loopback, ...) read through
+ * readers of their own, each with its own cursor. Single writer, many
+ * readers, no locks: the writer never looks at the readers, so opening
+ * another reader adds no work to the USB callback.
+ *
+ * The writer overwrites the oldest samples unconditionally. Before it copies
+ * a packet it announces how far it is about to write; a reader checks that
+ * mark after its copy and throws the copy away when the writer got there
+ * first. A reader that fell behind by more than the ring size loses what was
+ * overwritten, counts an overrun and continues with the newest samples. Data
+ * handed out is never torn.
+ *
+ * The writer wakes sleeping readers with one event group call, whatever the
+ * number of readers.
+ *
+ * Packets hold whole frames of interleaved channels, and reads hand out
+ * whole frames of the format last set: a read is cut to a multiple of the
+ * frame size, and data written before a format change is skipped, so a
+ * reader never starts in the middle of a frame whatever the channel count.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Sample format negotiated with the UAC microphone
+ */
+typedef struct {
+    uint32_t samples_frequence; /*!< Sample rate in Hz, 0 while no mic is connected */
+    uint32_t bit_resolution;    /*!< Bits per sample */
+    uint32_t ch_num;            /*!< Interleaved channels */
+} mic_ring_format_t;
+
+#define MIC_RING_MAX_READERS CONFIG_MIC_RING_MAX_READERS   /*!< Maximum number of readers opened at the same time */
+
+typedef struct mic_ring_reader mic_ring_reader_t;
+
+/**
+ * @brief Statistics of one reader
+ */
+typedef struct {
+    bool used;                  /*!< The reader is open */
+    size_t fill;                /*!< Bytes written the reader has not read yet */
+    uint32_t bytes_out;         /*!< Bytes read */
+    uint32_t overruns;          /*!< Times the writer overtook the reader */
+    uint32_t bytes_lost;        /*!< Bytes overwritten before the reader got them */
+    uint32_t underruns;         /*!< Reads that found nothing new */
+} mic_ring_reader_stats_t;
+
+/**
+ * @brief Ring statistics
+ */
+typedef struct {
+    size_t size;                /*!< Ring size in bytes */
+    uint32_t packets_in;        /*!< Packets written */
+    uint32_t bytes_in;          /*!< Bytes written */
+    uint32_t write_us_max;      /*!< Longest mic_ring_write() so far */
+    mic_ring_reader_stats_t readers[MIC_RING_MAX_READERS];
+} mic_ring_stats_t;
+
+/**
+ * @brief Allocate the ring.
+ *
+ * @param size Ring size in bytes
+ *
+ * @return
+ *     - ESP_OK on success
+ *     - ESP_ERR_NO_MEM if the ring could not be allocated
+ */
+esp_err_t mic_ring_init(size_t size);
+
+/**
+ * @brief Set the sample format of the data written from now on.
+ *
+ * Called when the microphone is connected, the reader picks it up with
+ * mic_ring_get_format() before it starts reading.
+ *
+ * @param format Negotiated format
+ */
+void mic_ring_set_format(const mic_ring_format_t *format);
+
+/**
+ * @brief Get the sample format last set.
+ *
+ * @param format Filled with the format, samples_frequence 0 if none was set
+ */
+void mic_ring_get_format(mic_ring_format_t *format);
+
+/**
+ * @brief Write one mic packet, never blocks.
+ *
+ * Producer side, call from the UAC mic callback only.
+ *
+ * @param data Frames
+ * @param len  Length in bytes, a whole number of frames no larger than the ring
+ */
+void mic_ring_write(const void *data, size_t len);
+
+/**
+ * @brief Open a reader, it starts with the samples written from now on.
+ *
+ * @return reader handle, or NULL if MIC_RING_MAX_READERS are open
+ */
+mic_ring_reader_t *mic_ring_reader_open(void);
+
+/**
+ * @brief Close a reader.
+ *
+ * @param reader Reader handle, NULL is ignored
+ */
+void mic_ring_reader_close(mic_ring_reader_t *reader);
+
+/**
+ * @brief Read samples, waiting for some if the reader is up to date.
+ *
+ * One reader must not be used by two tasks at once.
+ *
+ * @param reader  Reader handle
+ * @param buf     Destination
+ * @param len     Most bytes to read, cut to a whole number of frames
+ * @param timeout Ticks to wait when nothing new was written
+ *
+ * @return bytes read, a whole number of frames, 0 on timeout or if len is less than a frame
+ */
+size_t mic_ring_read(mic_ring_reader_t *reader, void *buf, size_t len, TickType_t timeout);
+
+/**
+ * @brief Read the ring statistics.
+ *
+ * @param stats Filled with the current values
+ */
+void mic_ring_get_stats(mic_ring_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,119 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Per-frame forward error correction for RTP
+ *
+ * After the K media packets of a frame, M parity packets are sent on a second
+ * SSRC of the same RTP session with payload type RTP_FEC_PAYLOAD_TYPE. Each
+ * media packet is protected as the symbol [length (16 bit), payload, zero
+ * padding], the payload being everything after the 12-byte RTP header. The RTP
+ * header of a lost packet follows from the frame: sequence base + index,
+ * timestamp of the parity packet, marker on index K - 1.
+ *
+ * XOR: parity j is the XOR of the media symbols i with i % M == j, which
+ * repairs one loss in each of the M interleaved groups, so a burst of up to M
+ * packets.
+ *
+ * Reed-Solomon: parity j is sum(C[j][i] * symbol i) over GF(2^8) (polynomial
+ * 0x11D) with the Cauchy matrix C[j][i] = 1 / ((128 + j) ^ i). Any K of the
+ * K + M packets rebuild the frame.
+ *
+ * Parity payload: base sequence (16), K (8), M (8), parity index (8),
+ * scheme (8), symbol length (16), then the parity symbol.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "rtp_jpeg.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RTP_FEC_PAYLOAD_TYPE    127
+#define RTP_FEC_HEADER_SIZE     8
+#define RTP_FEC_OVERHEAD        (RTP_FEC_HEADER_SIZE + 2)   /*!< Parity packets are this much larger than the largest media packet */
+#define RTP_FEC_MAX_MEDIA       128     /*!< Largest K that can be protected */
+
+/**
+ * @brief Parity scheme
+ */
+typedef enum {
+    RTP_FEC_NONE = 0,
+    RTP_FEC_XOR = 1,
+    RTP_FEC_RS = 2,
+} rtp_fec_scheme_t;
+
+/**
+ * @brief Parity of the frame being sent
+ */
+typedef struct {
+    rtp_fec_scheme_t scheme;
+    rtp_jpeg_stream_t stream;   /*!< SSRC and sequence of the parity packets */
+    uint8_t *parity;            /*!< max_parity symbols */
+    size_t symbol_max;          /*!< Size of each symbol in parity */
+    uint8_t max_parity;
+    uint16_t base;              /*!< Sequence number of the first media packet */
+    uint32_t timestamp;
+    uint8_t k;                  /*!< Media packets in the frame */
+    uint8_t m;                  /*!< Parity packets for the frame */
+    uint8_t index;              /*!< Media packets added so far */
+    size_t symbol_len;          /*!< Largest symbol added so far */
+} rtp_fec_t;
+
+/**
+ * @brief Allocate the parity buffers.
+ *
+ * @param fec         State to initialize
+ * @param scheme      Parity scheme
+ * @param packet_size Largest media packet, RTP header included
+ * @param max_parity  Most parity packets per frame
+ *
+ * @return
+ *     - ESP_OK on success
+ *     - ESP_ERR_INVALID_ARG if scheme or max_parity is out of range
+ *     - ESP_ERR_NO_MEM if the buffers could not be allocated
+ */
+esp_err_t rtp_fec_init(rtp_fec_t *fec, rtp_fec_scheme_t scheme, size_t packet_size, uint8_t max_parity);
+
+/**
+ * @brief Start the parity of a frame.
+ *
+ * @param fec       FEC state
+ * @param base      Sequence number the first media packet will get
+ * @param timestamp RTP timestamp of the frame
+ * @param k         Number of media packets of the frame
+ * @param m         Number of parity packets wanted, capped at max_parity
+ *
+ * @return
+ *     - ESP_OK on success
+ *     - ESP_ERR_NOT_SUPPORTED if k exceeds RTP_FEC_MAX_MEDIA, the frame goes out unprotected
+ */
+esp_err_t rtp_fec_begin(rtp_fec_t *fec, uint16_t base, uint32_t timestamp, uint8_t k, uint8_t m);
+
+/**
+ * @brief Add the next media packet of the frame, as passed to rtp_jpeg_packet_cb_t.
+ */
+void rtp_fec_add(rtp_fec_t *fec, const uint8_t *pkt, size_t len);
+
+/**
+ * @brief Emit the parity packets of the frame once all media packets were added.
+ *
+ * @param fec  FEC state
+ * @param buf  Scratch buffer the packets are built in
+ * @param size Size of buf, at least the largest media packet plus RTP_FEC_OVERHEAD
+ * @param cb   Called with each parity packet
+ * @param ctx  Passed to cb
+ */
+void rtp_fec_finish(rtp_fec_t *fec, uint8_t *buf, size_t size, rtp_jpeg_packet_cb_t cb, void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,81 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * RTP payload format for JPEG (RFC 2435)
+ *
+ * Cuts the scan of a baseline JPEG into RTP packets of at most a given size.
+ * Only the entropy-coded data travels: the receiver rebuilds the headers from
+ * the type, size and quantization tables in the packets and assumes the
+ * standard Huffman tables. Frames must therefore be YUV 4:2:2 or 4:2:0 with
+ * Annex K Huffman tables and a size that is a multiple of 8 up to 2040, which
+ * is what UVC cameras send. Quantization tables go in-band (Q = 255) in the
+ * first packet of every frame, restart intervals use types 64 and 65.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "jpeg_parse.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RTP_JPEG_PAYLOAD_TYPE   26      /*!< Static payload type of JPEG, 90 kHz clock */
+#define RTP_JPEG_CLOCK_RATE     90000
+
+/**
+ * @brief State of one RTP stream
+ */
+typedef struct {
+    uint32_t ssrc;              /*!< Synchronization source of the stream */
+    uint16_t sequence;          /*!< Sequence number of the next packet */
+} rtp_jpeg_stream_t;
+
+/**
+ * @brief Called for each packet of a frame, in order.
+ *
+ * @param ctx User context passed to rtp_jpeg_packetize()
+ * @param pkt RTP packet, header included
+ * @param len Length of the packet
+ */
+typedef void (*rtp_jpeg_packet_cb_t)(void *ctx, const uint8_t *pkt, size_t len);
+
+/**
+ * @brief Packetize one parsed JPEG frame.
+ *
+ * @param stream    Stream state, the sequence number is advanced
+ * @param info      Frame parsed by jpeg_parse()
+ * @param timestamp RTP timestamp of the frame, 90 kHz
+ * @param buf       Scratch buffer the packets are built in
+ * @param size      Size of buf, the largest packet produced
+ * @param cb        Called with each packet
+ * @param ctx       Passed to cb
+ *
+ * @return
+ *     - ESP_OK on success
+ *     - ESP_ERR_NOT_SUPPORTED if the frame cannot be carried by RFC 2435
+ *     - ESP_ERR_INVALID_SIZE if size leaves no room for payload
+ */
+esp_err_t rtp_jpeg_packetize(rtp_jpeg_stream_t *stream, const jpeg_info_t *info, uint32_t timestamp,
+                             uint8_t *buf, size_t size, rtp_jpeg_packet_cb_t cb, void *ctx);
+
+/**
+ * @brief Number of packets rtp_jpeg_packetize() will produce for a frame.
+ *
+ * @param info Frame parsed by jpeg_parse()
+ * @param size Largest packet, as passed to rtp_jpeg_packetize()
+ *
+ * @return Packet count, 0 if the frame cannot be packetized
+ */
+size_t rtp_jpeg_packet_count(const jpeg_info_t *info, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,45 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * RTSP server with RTP/UDP MJPEG delivery
+ *
+ * Serves rtsp://<ip>:CONFIG_RTSP_SERVER_PORT/ with a minimal RTSP 1.0 state
+ * machine (OPTIONS, DESCRIBE, SETUP, PLAY, TEARDOWN, GET_PARAMETER), unicast
+ * UDP transport only. A sender task takes every frame from the frame ring,
+ * packetizes it once per RFC 2435 (see rtp_jpeg.h) and sends the packets to
+ * every playing session. A lost packet costs one frame instead of stalling the
+ * connection as on /stream.
+ *
+ * With CONFIG_RTP_FEC_XOR or CONFIG_RTP_FEC_RS each frame is followed by
+ * parity packets on a second SSRC (see rtp_fec.h), announced in the SDP as
+ * payload type 127, so a receiver can repair lost packets without a
+ * retransmission.
+ *
+ * A session ends with TEARDOWN or when its RTSP connection closes.
+ */
+
+#pragma once
+
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Start the RTSP server and the RTP sender task.
+ *
+ * @return
+ *     - ESP_OK on success
+ *     - ESP_FAIL if a socket could not be set up or no frame reader is left
+ *     - ESP_ERR_NO_MEM if a task could not be created
+ */
+esp_err_t rtsp_server_start(void);
+
+#ifdef __cplusplus
+}
+#endif
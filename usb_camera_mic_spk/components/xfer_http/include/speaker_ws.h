@@ -0,0 +1,92 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Network audio to the speaker
+ *
+ * /ws/speaker?rate=R&channels=C takes 16-bit little endian PCM in binary
+ * WebSocket messages, whole frames of C channels at R Hz, sent in real time,
+ * e.g. every 20 ms. Rate and channels default to 16000 and 1. A text message
+ * "end" ends the stream and what is buffered is played out; a client that
+ * goes away ends it as well. One stream is played at a time, a second client
+ * is refused while the first is connected.
+ *
+ * Packets go into a jitter buffer (see jitter_buffer.h) at the stream rate,
+ * mixed down to mono. The speaker reads it as a mixer source through
+ * speaker_ws_read(), which converts it to the speaker rate and spreads it
+ * over the speaker channels. Streams are only accepted while the speaker
+ * plays, that is between speaker_ws_output_create() and
+ * speaker_ws_output_delete().
+ *
+ * esp_http_server does not decode chunked request bodies, so a chunked POST
+ * is not offered; WebSocket messages carry the same data with their own
+ * framing.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SPEAKER_WS_MSG_MAX      4096    /*!< Longest binary message, 21 ms of 48 kHz stereo */
+#define SPEAKER_WS_RATE_MIN     8000    /*!< Lowest stream rate */
+#define SPEAKER_WS_RATE_MAX     48000   /*!< Highest stream rate */
+
+typedef struct speaker_ws_output speaker_ws_output_t;
+
+/**
+ * @brief Register /ws/speaker.
+ *
+ * Needs CONFIG_HTTPD_WS_SUPPORT.
+ *
+ * @param server Running HTTP server
+ *
+ * @return
+ *     - ESP_OK on success
+ *     - ESP_ERR_NO_MEM if the lock could not be created
+ *     - ESP_FAIL if the handler can not be registered
+ */
+esp_err_t speaker_ws_register(httpd_handle_t server);
+
+/**
+ * @brief Start accepting streams for a speaker in this format.
+ *
+ * One output at a time, after speaker_ws_register(). Needs CONFIG_HTTPD_WS_SUPPORT
+ * like the functions below.
+ *
+ * @param sample_rate Speaker rate in Hz
+ * @param channels    Speaker channels, the stream goes to all of them
+ * @param ret         Set to the output, the ctx of speaker_ws_read()
+ *
+ * @return
+ *     - ESP_OK on success
+ *     - ESP_ERR_INVALID_ARG if the rate is 0 or the channels are out of range
+ *     - ESP_ERR_INVALID_STATE if /ws/speaker is not registered or there is an output already
+ *     - ESP_ERR_NO_MEM if the output could not be allocated
+ */
+esp_err_t speaker_ws_output_create(uint32_t sample_rate, uint32_t channels, speaker_ws_output_t **ret);
+
+/**
+ * @brief Stop the stream playing, if any, and free the output; remove it from the mixer first.
+ *
+ * @param out Output, NULL is ignored
+ */
+void speaker_ws_output_delete(speaker_ws_output_t *out);
+
+/**
+ * @brief mixer_read_t of the output, gives nothing while no stream plays.
+ */
+size_t speaker_ws_read(void *ctx, int16_t *out, size_t frames);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,89 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * MJPEG fan-out server
+ *
+ * One task serves every /stream client from a single select() loop over
+ * non-blocking sockets. Each new frame is pushed to all clients that are done
+ * with the previous one; a client still sending skips frames instead of
+ * holding back the others. Each part is written with one gathered sendmsg(),
+ * no chunked transfer encoding.
+ *
+ * Per client the server tracks how long a frame takes to drain and lets the
+ * matching number of frames pass after each delivered one, so every client
+ * gets the newest frame it can absorb. Clients whose socket takes no data for
+ * CONFIG_STREAM_CLIENT_STALL_TIMEOUT_MS are evicted, as are clients that have
+ * not sent a whole request that long after connecting.
+ *
+ * GET /stream?scale=2|4|8 streams the frames shrunk in the compressed domain
+ * (see jpeg_scale.h). Each frame is scaled once per scale in use and shared by
+ * every client asking for it.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Statistics of one streaming client
+ */
+typedef struct {
+    int fd;                     /*!< Socket of the client */
+    uint32_t frames_sent;       /*!< Frames fully written */
+    uint32_t frames_dropped;    /*!< Frames skipped because the client was busy or throttled */
+    float fps;                  /*!< Delivered frames per second, moving average */
+    uint32_t queue_delay_us;    /*!< Frame arrival to start of sending, moving average */
+    uint32_t drain_us;          /*!< Time to write one frame, moving average */
+    uint32_t send_us;           /*!< CPU time spent in sendmsg() per frame, moving average */
+    uint32_t bitrate_kbps;      /*!< Delivered kilobits per second, moving average */
+    uint32_t skip_ratio;        /*!< Frames currently let pass after each delivered one */
+    uint32_t scale;             /*!< Downscaling requested with ?scale=, 1 for full size */
+    uint32_t backlog;           /*!< Bytes queued but not yet taken by the socket */
+} stream_client_stats_t;
+
+/**
+ * @brief Statistics of the stream server
+ */
+typedef struct {
+    uint32_t evicted;           /*!< Clients closed because they stalled or sent no request */
+    uint32_t frame_interval_us; /*!< Interval between camera frames, moving average */
+    size_t client_num;          /*!< Number of valid entries in clients */
+    stream_client_stats_t clients[CONFIG_STREAM_SERVER_MAX_CLIENTS];
+} stream_server_stats_t;
+
+/**
+ * @brief Start the stream server task.
+ *
+ * New frames wake the select() loop through an eventfd, so the eventfd VFS
+ * is registered here unless it already is.
+ *
+ * @param port TCP port to listen on
+ *
+ * @return
+ *     - ESP_OK on success
+ *     - ESP_FAIL if a socket could not be set up
+ *     - ESP_ERR_NO_MEM if the task could not be created
+ */
+esp_err_t stream_server_start(uint16_t port);
+
+/**
+ * @brief Read the server statistics, refreshed on every pass of the select() loop.
+ *
+ * @param stats Filled with the current values
+ */
+void stream_server_get_stats(stream_server_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
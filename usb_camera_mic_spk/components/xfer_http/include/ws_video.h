@@ -0,0 +1,72 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * WebSocket video endpoint
+ *
+ * /ws/video sends every JPEG as one binary WebSocket message: a
+ * ws_video_header_t followed by the JPEG data. The server only sends while
+ * the client has credits. The client grants credits with text messages
+ * holding a decimal count, e.g. "2" right after connecting and "1" each time
+ * it has shown a frame. A client without credits skips frames, and gets the
+ * next new frame after it grants a credit again.
+ *
+ * Frames are written by a task of the endpoint with non-blocking sends, one
+ * frame in flight per client, so a slow client delays neither the others nor
+ * the port 80 server. A client that takes no data for
+ * STREAM_CLIENT_STALL_TIMEOUT_MS is closed like a stalled /stream client.
+ * The server's close_fn must call ws_video_session_closed() before it closes
+ * a socket, so the socket number is never written to once it is reused.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define WS_VIDEO_MAX_CREDITS 8      /*!< Credits a client can hold, larger grants are capped */
+
+/**
+ * @brief Header in front of each JPEG, little endian
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t sequence;          /*!< Frame sequence number from the camera */
+    uint32_t size;              /*!< JPEG size in bytes, the rest of the message */
+    int64_t captured_us;        /*!< Time since boot the USB transfer of the frame completed */
+} ws_video_header_t;
+
+/**
+ * @brief Register /ws/video and start the sender task.
+ *
+ * Needs CONFIG_HTTPD_WS_SUPPORT.
+ *
+ * @param server Running HTTP server
+ *
+ * @return
+ *     - ESP_OK on success
+ *     - ESP_FAIL if no frame reader is available or the handler can not be registered
+ *     - ESP_ERR_NO_MEM if the task could not be created
+ */
+esp_err_t ws_video_register(httpd_handle_t server);
+
+/**
+ * @brief Forget a client whose session is being closed.
+ *
+ * Call from the close_fn of the server, before the socket is closed. Sockets
+ * of other endpoints are ignored.
+ *
+ * @param fd Socket of the session
+ */
+void ws_video_session_closed(int fd);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,278 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "jpeg_parse.h"
+
+#define M_SOF0  0xC0
+#define M_SOF1  0xC1
+#define M_DHT   0xC4
+#define M_SOI   0xD8
+#define M_EOI   0xD9
+#define M_SOS   0xDA
+#define M_DQT   0xDB
+#define M_DRI   0xDD
+
+const uint8_t jpeg_zigzag[64] = {
+    0,  1,  8, 16,  9,  2,  3, 10,
+    17, 24, 32, 25, 18, 11,  4,  5,
+    12, 19, 26, 33, 40, 48, 41, 34,
+    27, 20, 13,  6,  7, 14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36,
+    29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46,
+    53, 60, 61, 54, 47, 55, 62, 63,
+};
+
+/* ITU T.81 Annex K.3, used when the camera sends no DHT */
+static const uint8_t s_dc_lum_bits[16] = { 0, 1, 5, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0 };
+static const uint8_t s_dc_chroma_bits[16] = { 0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0 };
+static const uint8_t s_dc_vals[12] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+
+static const uint8_t s_ac_lum_bits[16] = { 0, 2, 1, 3, 3, 2, 4, 3, 5, 5, 4, 4, 0, 0, 1, 0x7d };
+static const uint8_t s_ac_lum_vals[162] = {
+    0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07,
+    0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0,
+    0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+    0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
+    0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7,
+    0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5,
+    0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2,
+    0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8,
+    0xf9, 0xfa,
+};
+
+static const uint8_t s_ac_chroma_bits[16] = { 0, 2, 1, 2, 4, 4, 3, 4, 7, 5, 4, 4, 0, 1, 2, 0x77 };
+static const uint8_t s_ac_chroma_vals[162] = {
+    0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71,
+    0x13, 0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0,
+    0x15, 0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26,
+    0x27, 0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+    0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+    0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5,
+    0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3,
+    0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda,
+    0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8,
+    0xf9, 0xfa,
+};
+
+void jpeg_huff_std(jpeg_huff_table_t *table, bool ac, bool chroma)
+{
+    if (ac) {
+        memcpy(table->bits, chroma ? s_ac_chroma_bits : s_ac_lum_bits, sizeof(table->bits));
+        memcpy(table->vals, chroma ? s_ac_chroma_vals : s_ac_lum_vals, sizeof(s_ac_lum_vals));
+    } else {
+        memcpy(table->bits, chroma ? s_dc_chroma_bits : s_dc_lum_bits, sizeof(table->bits));
+        memcpy(table->vals, s_dc_vals, sizeof(s_dc_vals));
+    }
+    table->defined = true;
+    table->standard = true;
+}
+
+static uint16_t be16(const uint8_t *p)
+{
+    return (p[0] << 8) | p[1];
+}
+
+static esp_err_t parse_dqt(jpeg_info_t *info, const uint8_t *p, size_t len)
+{
+    while (len > 0) {
+        uint8_t pq = p[0] >> 4;
+        uint8_t tq = p[0] & 0x0F;
+        size_t size = 1 + 64 * (pq ? 2 : 1);
+        if (tq > 3 || pq > 1 || len < size) {
+            return ESP_ERR_INVALID_ARG;
+        }
+        for (int i = 0; i < 64; i++) {
+            info->qt[tq][i] = pq ? be16(p + 1 + 2 * i) : p[1 + i];
+        }
+        info->qt_mask |= 1 << tq;
+        p += size;
+        len -= size;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t parse_dht(jpeg_info_t *info, const uint8_t *p, size_t len)
+{
+    while (len >= 17) {
+        uint8_t tc = p[0] >> 4;
+        uint8_t th = p[0] & 0x0F;
+        size_t num = 0;
+        for (int i = 0; i < 16; i++) {
+            num += p[1 + i];
+        }
+        if (tc > 1 || th > 1 || num > 256 || len < 17 + num) {
+            return ESP_ERR_INVALID_ARG;
+        }
+        jpeg_huff_table_t *t = tc ? &info->ac[th] : &info->dc[th];
+        jpeg_huff_table_t std;
+        memcpy(t->bits, p + 1, 16);
+        memcpy(t->vals, p + 17, num);
+        t->defined = true;
+        /* most encoders send the Annex K tables anyway, table 1 being the chrominance one */
+        jpeg_huff_std(&std, tc, th);
+        t->standard = !memcmp(t->bits, std.bits, 16) && !memcmp(t->vals, std.vals, num);
+        p += 17 + num;
+        len -= 17 + num;
+    }
+    return len ? ESP_ERR_INVALID_ARG : ESP_OK;
+}
+
+static esp_err_t parse_sof(jpeg_info_t *info, const uint8_t *p, size_t len)
+{
+    if (len < 6 || p[0] != 8) {
+        return len < 6 ? ESP_ERR_INVALID_ARG : ESP_ERR_NOT_SUPPORTED;
+    }
+    info->height = be16(p + 1);
+    info->width = be16(p + 3);
+    info->num_components = p[5];
+    if (info->num_components != 1 && info->num_components != 3) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    if (len < 6 + 3 * info->num_components || !info->width || !info->height) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    info->h_max = 1;
+    info->v_max = 1;
+    for (int i = 0; i < info->num_components; i++) {
+        jpeg_component_t *c = &info->comp[i];
+        c->id = p[6 + 3 * i];
+        c->h = p[7 + 3 * i] >> 4;
+        c->v = p[7 + 3 * i] & 0x0F;
+        c->tq = p[8 + 3 * i];
+        if (info->num_components == 1) {
+            /* a single component scan is never interleaved, one block per MCU */
+            c->h = 1;
+            c->v = 1;
+        }
+        if (c->h < 1 || c->h > 2 || c->v < 1 || c->v > 2 || c->tq > 3) {
+            return ESP_ERR_NOT_SUPPORTED;
+        }
+        info->h_max = c->h > info->h_max ? c->h : info->h_max;
+        info->v_max = c->v > info->v_max ? c->v : info->v_max;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t parse_sos(jpeg_info_t *info, const uint8_t *p, size_t len)
+{
+    if (len < 1 || len < 1 + 2 * p[0] + 3) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (p[0] != info->num_components) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    for (int i = 0; i < p[0]; i++) {
+        jpeg_component_t *c = &info->comp[i];
+        if (p[1 + 2 * i] != c->id) {
+            return ESP_ERR_NOT_SUPPORTED;
+        }
+        c->td = p[2 + 2 * i] >> 4;
+        c->ta = p[2 + 2 * i] & 0x0F;
+        if (c->td > 1 || c->ta > 1) {
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t jpeg_parse(const uint8_t *data, size_t len, jpeg_info_t *info)
+{
+    const uint8_t *p = data;
+    const uint8_t *end = data + len;
+    bool have_sof = false;
+    esp_err_t ret = ESP_OK;
+
+    memset(info, 0, sizeof(*info));
+    if (len < 4 || p[0] != 0xFF || p[1] != M_SOI) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    p += 2;
+
+    while (true) {
+        /* fill bytes (FF FF ...) may precede a marker */
+        while (p < end && *p == 0xFF && p + 1 < end && p[1] == 0xFF) {
+            p++;
+        }
+        if (end - p < 4 || p[0] != 0xFF) {
+            return ESP_ERR_INVALID_ARG;
+        }
+        uint8_t marker = p[1];
+        size_t seg_len = be16(p + 2);
+        if (seg_len < 2 || (size_t)(end - p - 2) < seg_len) {
+            return ESP_ERR_INVALID_ARG;
+        }
+        const uint8_t *seg = p + 4;
+        seg_len -= 2;
+
+        switch (marker) {
+        case M_SOF0:
+        case M_SOF1:
+            ret = parse_sof(info, seg, seg_len);
+            have_sof = true;
+            break;
+        case M_DHT:
+            ret = parse_dht(info, seg, seg_len);
+            break;
+        case M_DQT:
+            ret = parse_dqt(info, seg, seg_len);
+            break;
+        case M_DRI:
+            ret = seg_len >= 2 ? ESP_OK : ESP_ERR_INVALID_ARG;
+            info->restart_interval = seg_len >= 2 ? be16(seg) : 0;
+            break;
+        case M_SOS:
+            if (!have_sof) {
+                return ESP_ERR_INVALID_ARG;
+            }
+            ret = parse_sos(info, seg, seg_len);
+            if (ret != ESP_OK) {
+                return ret;
+            }
+            info->scan = seg + seg_len;
+            info->scan_len = end - info->scan;
+            /* drop EOI and anything after it */
+            for (const uint8_t *q = end - 2; q >= info->scan; q--) {
+                if (q[0] == 0xFF && q[1] == M_EOI) {
+                    info->scan_len = q - info->scan;
+                    break;
+                }
+            }
+            goto scan;
+        default:
+            /* SOF2 and up: progressive, lossless, arithmetic */
+            if (marker >= 0xC2 && marker <= 0xCF && marker != M_DHT && marker != 0xC8 && marker != 0xCC) {
+                return ESP_ERR_NOT_SUPPORTED;
+            }
+            break;
+        }
+        if (ret != ESP_OK) {
+            return ret;
+        }
+        p = seg + seg_len;
+    }
+
+scan:
+    for (int i = 0; i < 2; i++) {
+        if (!info->dc[i].defined) {
+            jpeg_huff_std(&info->dc[i], false, i);
+        }
+        if (!info->ac[i].defined) {
+            jpeg_huff_std(&info->ac[i], true, i);
+        }
+    }
+    for (int i = 0; i < info->num_components; i++) {
+        if (!(info->qt_mask & (1 << info->comp[i].tq))) {
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+    return ESP_OK;
+}
@@ -0,0 +1,632 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <math.h>
+#include "jpeg_parse.h"
+#include "jpeg_scale.h"
+
+#define HUFF_FAST_BITS  9
+#define KEEP_NONE       0xFF
+#define FIX_BITS        13      /* fraction bits of the DCT tables */
+
+typedef struct {
+    uint16_t fast[1 << HUFF_FAST_BITS]; /* (length << 8) | symbol, 0 if the code is longer */
+    int32_t maxcode[17];        /* largest code of each length, -1 if none */
+    int32_t valptr[17];         /* index into vals of a code of each length, minus the code */
+    uint8_t vals[256];
+} huff_dec_t;
+
+typedef struct {
+    uint16_t code[256];
+    uint8_t size[256];
+} huff_enc_t;
+
+typedef struct {
+    const uint8_t *p;
+    const uint8_t *end;
+    uint32_t acc;               /* bits left aligned */
+    int bits;
+    bool marker;                /* stopped in front of a marker, feeding zeros */
+} bit_reader_t;
+
+typedef struct {
+    uint8_t *p;
+    uint8_t *end;
+    uint32_t acc;
+    int bits;
+    bool overflow;
+} bit_writer_t;
+
+typedef struct {
+    jpeg_info_t info;
+    huff_dec_t dc_dec[2];
+    huff_dec_t ac_dec[2];
+    huff_enc_t dc_enc[2];
+    huff_enc_t ac_enc[2];
+    jpeg_huff_table_t std[2][2];    /* [ac][chroma] tables of the output */
+    int scale;
+    int n;                      /* reduced block size, 8 / scale */
+    uint8_t keep[64];           /* zigzag index to reduced block index, KEEP_NONE if dropped */
+    int32_t idct[4][4];         /* reduced IDCT basis [x][u] */
+    int32_t fdct[8][8];         /* forward DCT basis [u][x] */
+    int32_t qdiv[4][64];        /* output quantizer, natural order, scaled to the FDCT output */
+    uint16_t out_w;
+    uint16_t out_h;
+    int mcux_in;
+    int mcuy_in;
+    int mcux_out;
+    int mcuy_out;
+    uint8_t *plane[JPEG_MAX_COMPONENTS];    /* one output MCU row per component */
+    size_t stride[JPEG_MAX_COMPONENTS];
+    int comp_w[JPEG_MAX_COMPONENTS];        /* samples of real image per component */
+    int comp_h[JPEG_MAX_COMPONENTS];
+} scale_ctx_t;
+
+static esp_err_t huff_dec_build(huff_dec_t *h, const jpeg_huff_table_t *t)
+{
+    uint32_t code = 0;
+    int k = 0;
+
+    memset(h->fast, 0, sizeof(h->fast));
+    for (int l = 1; l <= 16; l++) {
+        int cnt = t->bits[l - 1];
+        h->valptr[l] = k - (int32_t)code;
+        for (int i = 0; i < cnt; i++, k++, code++) {
+            if (k >= 256) {
+                return ESP_ERR_INVALID_ARG;
+            }
+            if (l <= HUFF_FAST_BITS) {
+                int shift = HUFF_FAST_BITS - l;
+                for (int j = 0; j < (1 << shift); j++) {
+                    h->fast[(code << shift) | j] = (l << 8) | t->vals[k];
+                }
+            }
+        }
+        h->maxcode[l] = cnt ? (int32_t)code - 1 : -1;
+        if (code > (1u << l)) {
+            return ESP_ERR_INVALID_ARG;
+        }
+        code <<= 1;
+    }
+    memcpy(h->vals, t->vals, sizeof(h->vals));
+    return ESP_OK;
+}
+
+static void huff_enc_build(huff_enc_t *e, const jpeg_huff_table_t *t)
+{
+    uint32_t code = 0;
+    int k = 0;
+
+    memset(e->size, 0, sizeof(e->size));
+    for (int l = 1; l <= 16; l++) {
+        for (int i = 0; i < t->bits[l - 1]; i++, k++, code++) {
+            e->code[t->vals[k]] = code;
+            e->size[t->vals[k]] = l;
+        }
+        code <<= 1;
+    }
+}
+
+static void br_fill(bit_reader_t *br)
+{
+    while (br->bits <= 24) {
+        uint32_t b = 0;
+        if (!br->marker && br->p < br->end) {
+            b = *br->p;
+            if (b == 0xFF) {
+                if (br->p + 1 < br->end && br->p[1] == 0x00) {
+                    br->p += 2;
+                } else {
+                    br->marker = true;
+                    b = 0;
+                }
+            } else {
+                br->p++;
+            }
+        }
+        br->acc |= b << (24 - br->bits);
+        br->bits += 8;
+    }
+}
+
+static inline uint32_t br_get(bit_reader_t *br, int n)
+{
+    uint32_t v = br->acc >> (32 - n);
+    br->acc <<= n;
+    br->bits -= n;
+    return v;
+}
+
+static inline int br_extend(uint32_t v, int n)
+{
+    return v < (1u << (n - 1)) ? (int)v - (1 << n) + 1 : (int)v;
+}
+
+static int huff_decode(bit_reader_t *br, const huff_dec_t *h)
+{
+    br_fill(br);
+    uint16_t e = h->fast[br->acc >> (32 - HUFF_FAST_BITS)];
+    if (e) {
+        br_get(br, e >> 8);
+        return e & 0xFF;
+    }
+    for (int l = HUFF_FAST_BITS + 1; l <= 16; l++) {
+        int32_t code = br->acc >> (32 - l);
+        if (code <= h->maxcode[l]) {
+            br_get(br, l);
+            return h->vals[(h->valptr[l] + code) & 0xFF];
+        }
+    }
+    return -1;
+}
+
+/* skip to the RST marker that ends a restart interval */
+static void br_restart(bit_reader_t *br)
+{
+    br->acc = 0;
+    br->bits = 0;
+    while (br->p + 1 < br->end && !(br->p[0] == 0xFF && (br->p[1] & 0xF8) == 0xD0)) {
+        br->p++;
+    }
+    if (br->p + 1 < br->end) {
+        br->p += 2;
+    }
+    br->marker = false;
+}
+
+/* entropy decode one block, keeping the dequantized low-frequency coefficients */
+static bool decode_block(const scale_ctx_t *ctx, bit_reader_t *br, const jpeg_component_t *c, int *pred, int32_t *red)
+{
+    const huff_dec_t *ac = &ctx->ac_dec[c->ta];
+    const uint16_t *q = ctx->info.qt[c->tq];
+
+    int s = huff_decode(br, &ctx->dc_dec[c->td]);
+    if (s < 0 || s > 11) {
+        return false;
+    }
+    if (s) {
+        br_fill(br);
+        *pred += br_extend(br_get(br, s), s);
+    }
+    memset(red, 0, ctx->n * ctx->n * sizeof(int32_t));
+    red[0] = *pred * q[0];
+
+    for (int k = 1; k < 64;) {
+        int rs = huff_decode(br, ac);
+        if (rs < 0) {
+            return false;
+        }
+        int run = rs >> 4;
+        int size = rs & 0x0F;
+        if (!size) {
+            if (run != 15) {
+                break;          /* EOB */
+            }
+            k += 16;
+            continue;
+        }
+        k += run;
+        if (k > 63) {
+            return false;
+        }
+        br_fill(br);
+        int v = br_extend(br_get(br, size), size);
+        if (ctx->keep[k] != KEEP_NONE) {
+            red[ctx->keep[k]] = v * q[k];
+        }
+        k++;
+    }
+    return true;
+}
+
+static inline uint8_t clamp_pixel(int32_t v)
+{
+    return v < 0 ? 0 : (v > 255 ? 255 : v);
+}
+
+/* n x n inverse DCT of the kept coefficients into n x n pixels */
+static void idct_reduced(const scale_ctx_t *ctx, const int32_t *in, uint8_t *out, size_t stride)
+{
+    const int n = ctx->n;
+    int32_t tmp[16];
+
+    for (int v = 0; v < n; v++) {
+        for (int x = 0; x < n; x++) {
+            int32_t s = 0;
+            for (int u = 0; u < n; u++) {
+                s += ctx->idct[x][u] * in[v * n + u];
+            }
+            tmp[v * n + x] = (s + (1 << (FIX_BITS - 1))) >> FIX_BITS;
+        }
+    }
+    for (int y = 0; y < n; y++) {
+        for (int x = 0; x < n; x++) {
+            int32_t s = 0;
+            for (int v = 0; v < n; v++) {
+                s += ctx->idct[y][v] * tmp[v * n + x];
+            }
+            out[y * stride + x] = clamp_pixel(((s + (1 << (FIX_BITS - 1))) >> FIX_BITS) + 128);
+        }
+    }
+}
+
+static void bw_byte(bit_writer_t *bw, uint8_t b)
+{
+    if (bw->p < bw->end) {
+        *bw->p++ = b;
+    } else {
+        bw->overflow = true;
+    }
+}
+
+static void bw_bytes(bit_writer_t *bw, const uint8_t *data, size_t len)
+{
+    for (size_t i = 0; i < len; i++) {
+        bw_byte(bw, data[i]);
+    }
+}
+
+static void bw_put(bit_writer_t *bw, uint32_t code, int size)
+{
+    bw->acc = (bw->acc << size) | (code & ((1u << size) - 1));
+    bw->bits += size;
+    while (bw->bits >= 8) {
+        uint8_t b = bw->acc >> (bw->bits - 8);
+        bw->bits -= 8;
+        bw_byte(bw, b);
+        if (b == 0xFF) {
+            bw_byte(bw, 0x00);
+        }
+    }
+}
+
+static void bw_flush(bit_writer_t *bw)
+{
+    if (bw->bits) {
+        bw_put(bw, 0x7F, 8 - bw->bits);
+    }
+}
+
+static inline int bit_length(int v)
+{
+    return v ? 32 - __builtin_clz(v < 0 ? -v : v) : 0;
+}
+
+/* forward DCT, quantize and entropy code one 8x8 block */
+static void encode_block(const scale_ctx_t *ctx, bit_writer_t *bw, const uint8_t *pix, size_t stride, int ci, int *pred)
+{
+    const huff_enc_t *dc = &ctx->dc_enc[ci ? 1 : 0];
+    const huff_enc_t *ac = &ctx->ac_enc[ci ? 1 : 0];
+    const int32_t *qdiv = ctx->qdiv[ctx->info.comp[ci].tq];
+    int32_t tmp[64];
+    int16_t coef[64];
+
+    for (int y = 0; y < 8; y++) {
+        const uint8_t *row = pix + y * stride;
+        for (int u = 0; u < 8; u++) {
+            int32_t s = 0;
+            for (int x = 0; x < 8; x++) {
+                s += ctx->fdct[u][x] * (row[x] - 128);
+            }
+            tmp[y * 8 + u] = (s + (1 << 10)) >> 11;
+        }
+    }
+    for (int v = 0; v < 8; v++) {
+        for (int u = 0; u < 8; u++) {
+            int32_t s = 0;
+            for (int y = 0; y < 8; y++) {
+                s += ctx->fdct[v][y] * tmp[y * 8 + u];
+            }
+            int32_t d = qdiv[v * 8 + u];
+            int32_t q = s >= 0 ? (s + d / 2) / d : -((-s + d / 2) / d);
+            coef[v * 8 + u] = q > 1023 ? 1023 : (q < -1023 ? -1023 : q);
+        }
+    }
+
+    int diff = coef[0] - *pred;
+    *pred = coef[0];
+    int nb = bit_length(diff);
+    bw_put(bw, dc->code[nb], dc->size[nb]);
+    if (nb) {
+        bw_put(bw, diff < 0 ? diff - 1 : diff, nb);
+    }
+
+    int run = 0;
+    for (int k = 1; k < 64; k++) {
+        int v = coef[jpeg_zigzag[k]];
+        if (!v) {
+            run++;
+            continue;
+        }
+        while (run > 15) {
+            bw_put(bw, ac->code[0xF0], ac->size[0xF0]);
+            run -= 16;
+        }
+        nb = bit_length(v);
+        int sym = (run << 4) | nb;
+        bw_put(bw, ac->code[sym], ac->size[sym]);
+        bw_put(bw, v < 0 ? v - 1 : v, nb);
+        run = 0;
+    }
+    if (run) {
+        bw_put(bw, ac->code[0x00], ac->size[0x00]);
+    }
+}
+
+static void put_be16(bit_writer_t *bw, uint16_t v)
+{
+    bw_byte(bw, v >> 8);
+    bw_byte(bw, v & 0xFF);
+}
+
+static void write_headers(const scale_ctx_t *ctx, bit_writer_t *bw)
+{
+    const jpeg_info_t *info = &ctx->info;
+    const int nc = info->num_components;
+    const int tables = nc > 1 ? 2 : 1;
+    bool wide = false;
+    uint8_t written = 0;
+
+    bw_byte(bw, 0xFF);
+    bw_byte(bw, 0xD8);
+
+    for (int i = 0; i < nc; i++) {
+        int tq = info->comp[i].tq;
+        if (written & (1 << tq)) {
+            continue;
+        }
+        written |= 1 << tq;
+        bool pq = false;
+        for (int k = 0; k < 64; k++) {
+            pq |= info->qt[tq][k] > 255;
+        }
+        wide |= pq;
+        bw_byte(bw, 0xFF);
+        bw_byte(bw, 0xDB);
+        put_be16(bw, 2 + 1 + 64 * (pq ? 2 : 1));
+        bw_byte(bw, (pq << 4) | tq);
+        for (int k = 0; k < 64; k++) {
+            if (pq) {
+                put_be16(bw, info->qt[tq][k]);
+            } else {
+                bw_byte(bw, info->qt[tq][k]);
+            }
+        }
+    }
+
+    /* 16-bit quantization tables are only allowed in extended sequential */
+    bw_byte(bw, 0xFF);
+    bw_byte(bw, wide ? 0xC1 : 0xC0);
+    put_be16(bw, 8 + 3 * nc);
+    bw_byte(bw, 8);
+    put_be16(bw, ctx->out_h);
+    put_be16(bw, ctx->out_w);
+    bw_byte(bw, nc);
+    for (int i = 0; i < nc; i++) {
+        bw_byte(bw, info->comp[i].id);
+        bw_byte(bw, (info->comp[i].h << 4) | info->comp[i].v);
+        bw_byte(bw, info->comp[i].tq);
+    }
+
+    for (int t = 0; t < tables; t++) {
+        for (int ac = 0; ac < 2; ac++) {
+            const jpeg_huff_table_t *ht = &ctx->std[ac][t];
+            size_t num = 0;
+            for (int l = 0; l < 16; l++) {
+                num += ht->bits[l];
+            }
+            bw_byte(bw, 0xFF);
+            bw_byte(bw, 0xC4);
+            put_be16(bw, 2 + 17 + num);
+            bw_byte(bw, (ac << 4) | t);
+            bw_bytes(bw, ht->bits, 16);
+            bw_bytes(bw, ht->vals, num);
+        }
+    }
+
+    bw_byte(bw, 0xFF);
+    bw_byte(bw, 0xDA);
+    put_be16(bw, 6 + 2 * nc);
+    bw_byte(bw, nc);
+    for (int i = 0; i < nc; i++) {
+        bw_byte(bw, info->comp[i].id);
+        bw_byte(bw, i ? 0x11 : 0x00);
+    }
+    bw_byte(bw, 0);
+    bw_byte(bw, 63);
+    bw_byte(bw, 0);
+}
+
+static esp_err_t ctx_init(scale_ctx_t *ctx, int scale)
+{
+    const jpeg_info_t *info = &ctx->info;
+    const int mcu_w = 8 * info->h_max;
+    const int mcu_h = 8 * info->v_max;
+    esp_err_t ret = ESP_OK;
+
+    ctx->scale = scale;
+    ctx->n = 8 / scale;
+    for (int i = 0; i < 2 && ret == ESP_OK; i++) {
+        ret = huff_dec_build(&ctx->dc_dec[i], &info->dc[i]);
+        if (ret == ESP_OK) {
+            ret = huff_dec_build(&ctx->ac_dec[i], &info->ac[i]);
+        }
+        for (int ac = 0; ac < 2; ac++) {
+            jpeg_huff_std(&ctx->std[ac][i], ac, i);
+        }
+        huff_enc_build(&ctx->dc_enc[i], &ctx->std[0][i]);
+        huff_enc_build(&ctx->ac_enc[i], &ctx->std[1][i]);
+    }
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    for (int k = 0; k < 64; k++) {
+        int row = jpeg_zigzag[k] / 8;
+        int col = jpeg_zigzag[k] % 8;
+        ctx->keep[k] = row < ctx->n && col < ctx->n ? row * ctx->n + col : KEEP_NONE;
+    }
+
+    /*
+     * Averaging scale x scale pixels samples each low-frequency cosine at the
+     * group centers, which is the n-point cosine of the same frequency.
+     */
+    for (int x = 0; x < ctx->n; x++) {
+        for (int u = 0; u < ctx->n; u++) {
+            double cu = u ? 0.5 : 0.5 * M_SQRT1_2;
+            ctx->idct[x][u] = lround(cu * cos((2 * x + 1) * u * M_PI / (2 * ctx->n)) * (1 << FIX_BITS));
+        }
+    }
+    for (int u = 0; u < 8; u++) {
+        for (int x = 0; x < 8; x++) {
+            double cu = u ? 0.5 : 0.5 * M_SQRT1_2;
+            ctx->fdct[u][x] = lround(cu * cos((2 * x + 1) * u * M_PI / 16) * (1 << FIX_BITS));
+        }
+    }
+    /* the FDCT leaves its result scaled by 2^(2 * FIX_BITS - 11) */
+    for (int t = 0; t < 4; t++) {
+        for (int k = 0; k < 64; k++) {
+            ctx->qdiv[t][jpeg_zigzag[k]] = (info->qt[t][k] ? info->qt[t][k] : 1) << (2 * FIX_BITS - 11);
+        }
+    }
+
+    ctx->out_w = (info->width + scale - 1) / scale;
+    ctx->out_h = (info->height + scale - 1) / scale;
+    ctx->mcux_in = (info->width + mcu_w - 1) / mcu_w;
+    ctx->mcuy_in = (info->height + mcu_h - 1) / mcu_h;
+    ctx->mcux_out = (ctx->out_w + mcu_w - 1) / mcu_w;
+    ctx->mcuy_out = (ctx->out_h + mcu_h - 1) / mcu_h;
+
+    for (int i = 0; i < info->num_components; i++) {
+        const jpeg_component_t *c = &info->comp[i];
+        int w_in = ctx->mcux_in * c->h * ctx->n;
+        int w_out = ctx->mcux_out * c->h * 8;
+        ctx->stride[i] = w_in > w_out ? w_in : w_out;
+        ctx->comp_w[i] = (ctx->out_w * c->h + info->h_max - 1) / info->h_max;
+        ctx->comp_h[i] = (ctx->out_h * c->v + info->v_max - 1) / info->v_max;
+        ctx->plane[i] = (uint8_t *)malloc(ctx->stride[i] * c->v * 8);
+        if (!ctx->plane[i]) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    return ESP_OK;
+}
+
+/* fill the samples right and below the real image by repeating the edge */
+static void strip_pad(scale_ctx_t *ctx, int row)
+{
+    for (int i = 0; i < ctx->info.num_components; i++) {
+        const int rows = ctx->info.comp[i].v * 8;
+        const int base = row * rows;
+        const size_t stride = ctx->stride[i];
+        uint8_t *plane = ctx->plane[i];
+
+        for (int y = 0; y < rows; y++) {
+            uint8_t *line = plane + y * stride;
+            if (base + y >= ctx->comp_h[i]) {
+                memcpy(line, plane + (ctx->comp_h[i] - 1 - base) * stride, stride);
+                continue;
+            }
+            memset(line + ctx->comp_w[i], line[ctx->comp_w[i] - 1], stride - ctx->comp_w[i]);
+        }
+    }
+}
+
+static esp_err_t scale_scan(scale_ctx_t *ctx, bit_writer_t *bw)
+{
+    const jpeg_info_t *info = &ctx->info;
+    bit_reader_t br = {
+        .p = info->scan,
+        .end = info->scan + info->scan_len,
+    };
+    int pred_in[JPEG_MAX_COMPONENTS] = { 0 };
+    int pred_out[JPEG_MAX_COMPONENTS] = { 0 };
+    uint32_t mcu = 0;
+    int32_t red[16];
+
+    for (int r = 0; r < ctx->mcuy_out; r++) {
+        for (int k = 0; k < ctx->scale && r * ctx->scale + k < ctx->mcuy_in; k++) {
+            for (int j = 0; j < ctx->mcux_in; j++, mcu++) {
+                if (info->restart_interval && mcu && mcu % info->restart_interval == 0) {
+                    br_restart(&br);
+                    memset(pred_in, 0, sizeof(pred_in));
+                }
+                for (int i = 0; i < info->num_components; i++) {
+                    const jpeg_component_t *c = &info->comp[i];
+                    for (int bv = 0; bv < c->v; bv++) {
+                        for (int bh = 0; bh < c->h; bh++) {
+                            if (!decode_block(ctx, &br, c, &pred_in[i], red)) {
+                                return ESP_ERR_INVALID_ARG;
+                            }
+                            size_t x = (j * c->h + bh) * ctx->n;
+                            size_t y = (k * c->v + bv) * ctx->n;
+                            idct_reduced(ctx, red, ctx->plane[i] + y * ctx->stride[i] + x, ctx->stride[i]);
+                        }
+                    }
+                }
+            }
+        }
+
+        strip_pad(ctx, r);
+
+        for (int j = 0; j < ctx->mcux_out; j++) {
+            for (int i = 0; i < info->num_components; i++) {
+                const jpeg_component_t *c = &info->comp[i];
+                for (int bv = 0; bv < c->v; bv++) {
+                    for (int bh = 0; bh < c->h; bh++) {
+                        const uint8_t *pix = ctx->plane[i] + bv * 8 * ctx->stride[i] + (j * c->h + bh) * 8;
+                        encode_block(ctx, bw, pix, ctx->stride[i], i, &pred_out[i]);
+                    }
+                }
+            }
+            if (bw->overflow) {
+                return ESP_ERR_INVALID_SIZE;
+            }
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t jpeg_scale(const uint8_t *src, size_t src_len, uint32_t scale, uint8_t *dst, size_t dst_size, size_t *dst_len)
+{
+    if (scale != 2 && scale != 4 && scale != 8) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    scale_ctx_t *ctx = (scale_ctx_t *)calloc(1, sizeof(scale_ctx_t));
+    if (!ctx) {
+        return ESP_ERR_NO_MEM;
+    }
+    bit_writer_t bw = {
+        .p = dst,
+        .end = dst + dst_size,
+    };
+
+    esp_err_t ret = jpeg_parse(src, src_len, &ctx->info);
+    if (ret == ESP_OK) {
+        ret = ctx_init(ctx, scale);
+    }
+    if (ret == ESP_OK) {
+        write_headers(ctx, &bw);
+        ret = scale_scan(ctx, &bw);
+    }
+    if (ret == ESP_OK) {
+        bw_flush(&bw);
+        bw_byte(&bw, 0xFF);
+        bw_byte(&bw, 0xD9);
+        ret = bw.overflow ? ESP_ERR_INVALID_SIZE : ESP_OK;
+        *dst_len = bw.p - dst;
+    }
+
+    for (int i = 0; i < JPEG_MAX_COMPONENTS; i++) {
+        free(ctx->plane[i]);
+    }
+    free(ctx);
+    return ret;
+}
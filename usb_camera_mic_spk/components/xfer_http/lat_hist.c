@@ -0,0 +1,66 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "lat_hist.h"
+
+/* values below 4 get their own bucket, above that 4 buckets per power of two */
+static uint32_t bucket_index(uint32_t v)
+{
+    if (v < 4) {
+        return v;
+    }
+    uint32_t msb = 31 - __builtin_clz(v);
+    return 4 * (msb - 1) + ((v >> (msb - 2)) & 3);
+}
+
+static uint32_t bucket_mid(uint32_t idx)
+{
+    if (idx < 4) {
+        return idx;
+    }
+    uint32_t msb = idx / 4 + 1;
+    uint32_t width = 1u << (msb - 2);
+    return (4 + idx % 4) * width + width / 2;
+}
+
+void lat_hist_record(lat_hist_t *hist, uint32_t us)
+{
+    atomic_fetch_add(&hist->buckets[bucket_index(us)], 1);
+    atomic_fetch_add(&hist->count, 1);
+
+    uint32_t max = atomic_load(&hist->max);
+    while (us > max && !atomic_compare_exchange_weak(&hist->max, &max, us)) {
+    }
+}
+
+uint32_t lat_hist_percentile(lat_hist_t *hist, uint32_t permille)
+{
+    uint32_t count = atomic_load(&hist->count);
+    uint32_t rank = (uint64_t)count * permille / 1000;
+    uint32_t seen = 0;
+
+    if (!count) {
+        return 0;
+    }
+    for (uint32_t i = 0; i < LAT_HIST_BUCKETS; i++) {
+        seen += atomic_load(&hist->buckets[i]);
+        if (seen > rank) {
+            uint32_t mid = bucket_mid(i);
+            uint32_t max = atomic_load(&hist->max);
+            return mid < max ? mid : max;
+        }
+    }
+    return atomic_load(&hist->max);
+}
+
+void lat_hist_reset(lat_hist_t *hist)
+{
+    for (uint32_t i = 0; i < LAT_HIST_BUCKETS; i++) {
+        atomic_store(&hist->buckets[i], 0);
+    }
+    atomic_store(&hist->count, 0);
+    atomic_store(&hist->max, 0);
+}
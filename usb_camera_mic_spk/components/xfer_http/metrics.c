@@ -0,0 +1,157 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <stdbool.h>
+#include "metrics.h"
+
+typedef enum {
+    METRIC_COUNTER,
+    METRIC_GAUGE,
+    METRIC_GAUGE_FN,
+    METRIC_HISTOGRAM,
+} metric_type_t;
+
+typedef struct {
+    const char *name;
+    const char *help;
+    metric_type_t type;
+    union {
+        atomic_uint *counter;
+        atomic_int *gauge;
+        metrics_read_t read;
+        lat_hist_t *hist;
+    };
+    atomic_bool ready;          /* set once the entry is filled in */
+} metric_t;
+
+static metric_t s_metrics[METRICS_MAX];
+static atomic_uint s_metric_num;
+
+static const struct {
+    uint32_t permille;
+    const char *label;
+} s_quantiles[] = {
+    { 500, "0.5" },
+    { 900, "0.9" },
+    { 990, "0.99" },
+};
+
+static metric_t *metric_add(const char *name, const char *help, metric_type_t type)
+{
+    uint32_t idx = atomic_fetch_add(&s_metric_num, 1);
+    if (idx >= METRICS_MAX) {
+        atomic_fetch_sub(&s_metric_num, 1);
+        return NULL;
+    }
+    s_metrics[idx].name = name;
+    s_metrics[idx].help = help;
+    s_metrics[idx].type = type;
+    return &s_metrics[idx];
+}
+
+esp_err_t metrics_register_counter(const char *name, const char *help, atomic_uint *value)
+{
+    metric_t *m = metric_add(name, help, METRIC_COUNTER);
+    if (!m) {
+        return ESP_ERR_NO_MEM;
+    }
+    m->counter = value;
+    atomic_store(&m->ready, true);
+    return ESP_OK;
+}
+
+esp_err_t metrics_register_gauge(const char *name, const char *help, atomic_int *value)
+{
+    metric_t *m = metric_add(name, help, METRIC_GAUGE);
+    if (!m) {
+        return ESP_ERR_NO_MEM;
+    }
+    m->gauge = value;
+    atomic_store(&m->ready, true);
+    return ESP_OK;
+}
+
+esp_err_t metrics_register_gauge_fn(const char *name, const char *help, metrics_read_t read)
+{
+    metric_t *m = metric_add(name, help, METRIC_GAUGE_FN);
+    if (!m) {
+        return ESP_ERR_NO_MEM;
+    }
+    m->read = read;
+    atomic_store(&m->ready, true);
+    return ESP_OK;
+}
+
+esp_err_t metrics_register_histogram(const char *name, const char *help, lat_hist_t *hist)
+{
+    metric_t *m = metric_add(name, help, METRIC_HISTOGRAM);
+    if (!m) {
+        return ESP_ERR_NO_MEM;
+    }
+    m->hist = hist;
+    atomic_store(&m->ready, true);
+    return ESP_OK;
+}
+
+static esp_err_t metric_write(const metric_t *m, metrics_write_t write, void *ctx)
+{
+    static const char *const type_names[] = {
+        [METRIC_COUNTER] = "counter",
+        [METRIC_GAUGE] = "gauge",
+        [METRIC_GAUGE_FN] = "gauge",
+        [METRIC_HISTOGRAM] = "summary",
+    };
+    char line[160];
+    esp_err_t ret;
+
+    snprintf(line, sizeof(line), "# HELP %s %s\n# TYPE %s %s\n", m->name, m->help, m->name, type_names[m->type]);
+    ret = write(ctx, line);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    switch (m->type) {
+    case METRIC_COUNTER:
+        snprintf(line, sizeof(line), "%s %u\n", m->name, atomic_load(m->counter));
+        break;
+    case METRIC_GAUGE:
+        snprintf(line, sizeof(line), "%s %d\n", m->name, atomic_load(m->gauge));
+        break;
+    case METRIC_GAUGE_FN:
+        snprintf(line, sizeof(line), "%s %d\n", m->name, m->read());
+        break;
+    case METRIC_HISTOGRAM:
+        for (size_t i = 0; i < sizeof(s_quantiles) / sizeof(s_quantiles[0]); i++) {
+            snprintf(line, sizeof(line), "%s{quantile=\"%s\"} %u\n", m->name, s_quantiles[i].label,
+                     lat_hist_percentile(m->hist, s_quantiles[i].permille));
+            ret = write(ctx, line);
+            if (ret != ESP_OK) {
+                return ret;
+            }
+        }
+        snprintf(line, sizeof(line), "%s{quantile=\"1\"} %u\n%s_count %u\n", m->name, atomic_load(&m->hist->max),
+                 m->name, atomic_load(&m->hist->count));
+        break;
+    }
+    return write(ctx, line);
+}
+
+esp_err_t metrics_write(metrics_write_t write, void *ctx)
+{
+    uint32_t num = atomic_load(&s_metric_num);
+
+    for (uint32_t i = 0; i < num && i < METRICS_MAX; i++) {
+        if (!atomic_load(&s_metrics[i].ready)) {
+            continue;
+        }
+        esp_err_t ret = metric_write(&s_metrics[i], write, ctx);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+    }
+    return ESP_OK;
+}
@@ -0,0 +1,264 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/event_groups.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "metrics.h"
+#include "mic_ring.h"
+
+static const char *TAG = "mic_ring";
+
+#define MIC_RING_WRITTEN (0x01 << 0)
+
+struct mic_ring_reader {
+    atomic_bool used;
+    atomic_uint cursor;         /* bytes read, moved by the owner only */
+    atomic_uint bytes_out;
+    atomic_uint overruns;
+    atomic_uint bytes_lost;
+    atomic_uint underruns;
+};
+
+static uint8_t *s_buf;
+static uint32_t s_mask;                 /* size - 1, the size is a power of two */
+static atomic_uint s_head;              /* bytes written */
+static atomic_uint s_reserve;           /* bytes written once the current write is done */
+static atomic_int s_waiting;            /* readers sleeping on s_wake */
+static EventGroupHandle_t s_wake;
+static mic_ring_reader_t s_readers[MIC_RING_MAX_READERS];
+
+/* the format with where its data starts, in two slots so that a reader copies
+ * one while the other is filled; the generation tells which is current and
+ * whether it changed during the copy */
+typedef struct {
+    mic_ring_format_t format;
+    uint32_t frame_bytes;
+    uint32_t start;             /* s_head when the format was set */
+} ring_format_t;
+
+static ring_format_t s_formats[2];
+static atomic_uint s_format_gen;
+
+static atomic_uint s_packets_in;
+static atomic_uint s_bytes_in;
+static atomic_uint s_overruns;
+static atomic_uint s_underruns;
+static atomic_int s_reader_num;
+static uint32_t s_write_us_max;
+
+esp_err_t mic_ring_init(size_t size)
+{
+    /* round down to a power of two so the free running counters wrap cleanly */
+    while (size & (size - 1)) {
+        size &= size - 1;
+    }
+    s_buf = (uint8_t *)malloc(size);
+    s_wake = xEventGroupCreate();
+    if (!s_buf || !s_wake) {
+        return ESP_ERR_NO_MEM;
+    }
+    s_mask = size - 1;
+
+    metrics_register_counter("mic_bytes_in_total", "Mic bytes written to the ring", &s_bytes_in);
+    metrics_register_counter("mic_overruns_total", "Times a mic ring reader was overtaken by the writer", &s_overruns);
+    metrics_register_counter("mic_underruns_total", "Mic ring reads that found nothing new", &s_underruns);
+    metrics_register_gauge("mic_ring_readers", "Open mic ring readers", &s_reader_num);
+
+    ESP_LOGI(TAG, "%u byte ring", size);
+    return ESP_OK;
+}
+
+void mic_ring_set_format(const mic_ring_format_t *format)
+{
+    uint32_t gen = atomic_load(&s_format_gen) + 1;
+    ring_format_t *slot = &s_formats[gen & 1];
+
+    slot->format = *format;
+    slot->frame_bytes = format->bit_resolution / 8 * format->ch_num;
+    slot->start = atomic_load(&s_head);
+    atomic_store(&s_format_gen, gen);
+}
+
+static void ring_format_get(ring_format_t *format)
+{
+    uint32_t gen;
+
+    do {
+        gen = atomic_load(&s_format_gen);
+        *format = s_formats[gen & 1];
+        atomic_thread_fence(memory_order_seq_cst);
+    } while (atomic_load(&s_format_gen) != gen);
+}
+
+void mic_ring_get_format(mic_ring_format_t *format)
+{
+    ring_format_t current;
+
+    ring_format_get(&current);
+    *format = current.format;
+}
+
+void mic_ring_write(const void *data, size_t len)
+{
+    int64_t start = esp_timer_get_time();
+
+    if (!s_buf || len > s_mask + 1) {
+        return;
+    }
+    uint32_t head = atomic_load_explicit(&s_head, memory_order_relaxed);
+
+    /* announce the bytes about to be overwritten before touching them */
+    atomic_store_explicit(&s_reserve, head + len, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+
+    size_t off = head & s_mask;
+    size_t first = len < s_mask + 1 - off ? len : s_mask + 1 - off;
+    memcpy(s_buf + off, data, first);
+    memcpy(s_buf, (const uint8_t *)data + first, len - first);
+    atomic_store(&s_head, head + len);
+    atomic_fetch_add(&s_packets_in, 1);
+    atomic_fetch_add(&s_bytes_in, len);
+
+    if (atomic_load(&s_waiting)) {
+        xEventGroupSetBits(s_wake, MIC_RING_WRITTEN);
+    }
+
+    uint32_t us = esp_timer_get_time() - start;
+    if (us > s_write_us_max) {
+        s_write_us_max = us;
+    }
+}
+
+mic_ring_reader_t *mic_ring_reader_open(void)
+{
+    if (!s_buf) {
+        return NULL;
+    }
+
+    for (size_t i = 0; i < MIC_RING_MAX_READERS; i++) {
+        bool expected = false;
+        if (atomic_compare_exchange_strong(&s_readers[i].used, &expected, true)) {
+            mic_ring_reader_t *reader = &s_readers[i];
+            atomic_store(&reader->cursor, atomic_load(&s_head));
+            atomic_store(&reader->bytes_out, 0);
+            atomic_store(&reader->overruns, 0);
+            atomic_store(&reader->bytes_lost, 0);
+            atomic_store(&reader->underruns, 0);
+            atomic_fetch_add(&s_reader_num, 1);
+            return reader;
+        }
+    }
+    return NULL;
+}
+
+void mic_ring_reader_close(mic_ring_reader_t *reader)
+{
+    if (reader) {
+        atomic_fetch_sub(&s_reader_num, 1);
+        atomic_store(&reader->used, false);
+    }
+}
+
+/* the writer overtook the reader, skip to the newest samples */
+static void reader_overrun(mic_ring_reader_t *reader, uint32_t cursor)
+{
+    uint32_t head = atomic_load(&s_head);
+    atomic_store(&reader->cursor, head);
+    atomic_fetch_add(&reader->overruns, 1);
+    atomic_fetch_add(&reader->bytes_lost, head - cursor);
+    atomic_fetch_add(&s_overruns, 1);
+}
+
+size_t mic_ring_read(mic_ring_reader_t *reader, void *buf, size_t len, TickType_t timeout)
+{
+    TickType_t start = xTaskGetTickCount();
+    bool waited = false;
+
+    if (!reader) {
+        return 0;
+    }
+    while (true) {
+        ring_format_t format;
+        ring_format_get(&format);
+        uint32_t cursor = atomic_load_explicit(&reader->cursor, memory_order_relaxed);
+        uint32_t head = atomic_load(&s_head);
+        size_t whole = format.frame_bytes ? len - len % format.frame_bytes : len;
+
+        /* frames of another format are not whole frames of this one */
+        if ((int32_t)(format.start - cursor) > 0) {
+            atomic_store_explicit(&reader->cursor, format.start, memory_order_relaxed);
+            continue;
+        }
+        if (!whole) {
+            return 0;
+        }
+        uint32_t avail = head - cursor;
+
+        if (avail > s_mask + 1) {
+            reader_overrun(reader, cursor);
+            continue;
+        }
+        if (avail) {
+            size_t n = avail < whole ? avail : whole;
+            size_t off = cursor & s_mask;
+            size_t first = n < s_mask + 1 - off ? n : s_mask + 1 - off;
+            memcpy(buf, s_buf + off, first);
+            memcpy((uint8_t *)buf + first, s_buf, n - first);
+
+            /* the copy is good unless the writer reached into it meanwhile */
+            atomic_thread_fence(memory_order_seq_cst);
+            if (atomic_load_explicit(&s_reserve, memory_order_relaxed) - cursor > s_mask + 1) {
+                reader_overrun(reader, cursor);
+                continue;
+            }
+            atomic_store_explicit(&reader->cursor, cursor + n, memory_order_relaxed);
+            atomic_fetch_add(&reader->bytes_out, n);
+            return n;
+        }
+
+        TickType_t elapsed = xTaskGetTickCount() - start;
+        if (elapsed >= timeout) {
+            return 0;
+        }
+        if (!waited) {
+            atomic_fetch_add(&reader->underruns, 1);
+            atomic_fetch_add(&s_underruns, 1);
+            waited = true;
+        }
+        /* announce the wait before checking again, a write in between leaves the bit set */
+        atomic_fetch_add(&s_waiting, 1);
+        if (atomic_load(&s_head) == head) {
+            xEventGroupWaitBits(s_wake, MIC_RING_WRITTEN, pdTRUE, pdFALSE, timeout - elapsed);
+        }
+        atomic_fetch_sub(&s_waiting, 1);
+    }
+}
+
+void mic_ring_get_stats(mic_ring_stats_t *stats)
+{
+    uint32_t head = atomic_load(&s_head);
+
+    stats->size = s_buf ? s_mask + 1 : 0;
+    stats->packets_in = atomic_load(&s_packets_in);
+    stats->bytes_in = atomic_load(&s_bytes_in);
+    stats->write_us_max = s_write_us_max;
+    for (size_t i = 0; i < MIC_RING_MAX_READERS; i++) {
+        mic_ring_reader_t *reader = &s_readers[i];
+        mic_ring_reader_stats_t *r = &stats->readers[i];
+        r->used = atomic_load(&reader->used);
+        r->fill = r->used ? head - atomic_load(&reader->cursor) : 0;
+        r->bytes_out = atomic_load(&reader->bytes_out);
+        r->overruns = atomic_load(&reader->overruns);
+        r->bytes_lost = atomic_load(&reader->bytes_lost);
+        r->underruns = atomic_load(&reader->underruns);
+    }
+}
@@ -0,0 +1,152 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "rtp_fec.h"
+
+#define RTP_HEADER_SIZE 12
+#define GF_POLY         0x11D
+#define CAUCHY_X        128     /* parity rows use 128 + j, media columns use i < 128 */
+
+static uint8_t s_gf_exp[512];
+static uint8_t s_gf_log[256];
+
+static void gf_init(void)
+{
+    if (s_gf_exp[0]) {
+        return;
+    }
+    uint32_t x = 1;
+    for (int i = 0; i < 255; i++) {
+        s_gf_exp[i] = x;
+        s_gf_exp[i + 255] = x;
+        s_gf_log[x] = i;
+        x <<= 1;
+        if (x & 0x100) {
+            x ^= GF_POLY;
+        }
+    }
+}
+
+static uint8_t fec_coef(const rtp_fec_t *fec, int i, int j)
+{
+    if (fec->scheme == RTP_FEC_XOR) {
+        return i % fec->m == j;
+    }
+    return s_gf_exp[255 - s_gf_log[(CAUCHY_X + j) ^ i]];
+}
+
+/* parity ^= coef * data */
+static void fec_accumulate(uint8_t *parity, const uint8_t *data, size_t len, uint8_t coef)
+{
+    if (coef == 1) {
+        for (size_t n = 0; n < len; n++) {
+            parity[n] ^= data[n];
+        }
+        return;
+    }
+    const uint8_t *exp = s_gf_exp + s_gf_log[coef];
+    for (size_t n = 0; n < len; n++) {
+        if (data[n]) {
+            parity[n] ^= exp[s_gf_log[data[n]]];
+        }
+    }
+}
+
+esp_err_t rtp_fec_init(rtp_fec_t *fec, rtp_fec_scheme_t scheme, size_t packet_size, uint8_t max_parity)
+{
+    memset(fec, 0, sizeof(*fec));
+    if (scheme != RTP_FEC_XOR && scheme != RTP_FEC_RS) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!max_parity || max_parity > 256 - CAUCHY_X || packet_size <= RTP_HEADER_SIZE) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    fec->symbol_max = packet_size - RTP_HEADER_SIZE + 2;
+    fec->parity = (uint8_t *)malloc(fec->symbol_max * max_parity);
+    if (!fec->parity) {
+        return ESP_ERR_NO_MEM;
+    }
+    fec->scheme = scheme;
+    fec->max_parity = max_parity;
+    gf_init();
+    return ESP_OK;
+}
+
+esp_err_t rtp_fec_begin(rtp_fec_t *fec, uint16_t base, uint32_t timestamp, uint8_t k, uint8_t m)
+{
+    fec->m = 0;
+    if (k > RTP_FEC_MAX_MEDIA) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    fec->base = base;
+    fec->timestamp = timestamp;
+    fec->k = k;
+    fec->m = m > fec->max_parity ? fec->max_parity : m;
+    fec->index = 0;
+    fec->symbol_len = 0;
+    memset(fec->parity, 0, fec->symbol_max * fec->m);
+    return ESP_OK;
+}
+
+void rtp_fec_add(rtp_fec_t *fec, const uint8_t *pkt, size_t len)
+{
+    if (!fec->m || fec->index >= fec->k || len < RTP_HEADER_SIZE || len - RTP_HEADER_SIZE + 2 > fec->symbol_max) {
+        return;
+    }
+    size_t payload_len = len - RTP_HEADER_SIZE;
+    uint8_t length[2] = { payload_len >> 8, payload_len & 0xFF };
+
+    if (payload_len + 2 > fec->symbol_len) {
+        fec->symbol_len = payload_len + 2;
+    }
+    for (int j = 0; j < fec->m; j++) {
+        uint8_t coef = fec_coef(fec, fec->index, j);
+        if (coef) {
+            uint8_t *parity = fec->parity + j * fec->symbol_max;
+            fec_accumulate(parity, length, 2, coef);
+            fec_accumulate(parity + 2, pkt + RTP_HEADER_SIZE, payload_len, coef);
+        }
+    }
+    fec->index++;
+}
+
+void rtp_fec_finish(rtp_fec_t *fec, uint8_t *buf, size_t size, rtp_jpeg_packet_cb_t cb, void *ctx)
+{
+    if (!fec->m || fec->index != fec->k || RTP_HEADER_SIZE + RTP_FEC_HEADER_SIZE + fec->symbol_len > size) {
+        return;
+    }
+
+    for (int j = 0; j < fec->m; j++) {
+        uint8_t *p = buf;
+        uint16_t sequence = fec->stream.sequence++;
+
+        *p++ = 0x80;
+        *p++ = (j == fec->m - 1 ? 0x80 : 0) | RTP_FEC_PAYLOAD_TYPE;
+        *p++ = sequence >> 8;
+        *p++ = sequence;
+        for (int b = 24; b >= 0; b -= 8) {
+            *p++ = fec->timestamp >> b;
+        }
+        for (int b = 24; b >= 0; b -= 8) {
+            *p++ = fec->stream.ssrc >> b;
+        }
+        *p++ = fec->base >> 8;
+        *p++ = fec->base;
+        *p++ = fec->k;
+        *p++ = fec->m;
+        *p++ = j;
+        *p++ = fec->scheme;
+        *p++ = fec->symbol_len >> 8;
+        *p++ = fec->symbol_len;
+        memcpy(p, fec->parity + j * fec->symbol_max, fec->symbol_len);
+        cb(ctx, buf, p - buf + fec->symbol_len);
+    }
+    fec->m = 0;
+}
@@ -0,0 +1,169 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <stdbool.h>
+#include "rtp_jpeg.h"
+
+#define RTP_HEADER_SIZE     12
+#define JPEG_HEADER_SIZE    8
+#define RESTART_HEADER_SIZE 4
+#define QTABLE_HEADER_SIZE  4
+#define JPEG_TYPE_422       0
+#define JPEG_TYPE_420       1
+#define JPEG_TYPE_RESTART   64
+#define JPEG_Q_IN_BAND      255
+
+static inline uint8_t *put_be16(uint8_t *p, uint16_t v)
+{
+    p[0] = v >> 8;
+    p[1] = v;
+    return p + 2;
+}
+
+static inline uint8_t *put_be32(uint8_t *p, uint32_t v)
+{
+    p[0] = v >> 24;
+    p[1] = v >> 16;
+    p[2] = v >> 8;
+    p[3] = v;
+    return p + 4;
+}
+
+/* RFC 2435 type of the frame, -1 if the receiver could not rebuild it */
+static int jpeg_type(const jpeg_info_t *info)
+{
+    const jpeg_component_t *c = info->comp;
+
+    if (info->num_components != 3 || c[0].h != 2 || c[1].h != 1 || c[1].v != 1
+            || c[2].h != 1 || c[2].v != 1 || c[1].tq != c[2].tq) {
+        return -1;
+    }
+    /* the receiver decodes component 0 with the luminance tables, the others with the chrominance ones */
+    if (c[0].td || c[0].ta || c[1].td != 1 || c[1].ta != 1 || c[2].td != 1 || c[2].ta != 1
+            || !info->dc[0].standard || !info->ac[0].standard || !info->dc[1].standard || !info->ac[1].standard) {
+        return -1;
+    }
+    if (info->width % 8 || info->height % 8 || info->width > 2040 || info->height > 2040) {
+        return -1;
+    }
+    int type = c[0].v == 1 ? JPEG_TYPE_422 : JPEG_TYPE_420;
+    return info->restart_interval ? type + JPEG_TYPE_RESTART : type;
+}
+
+static bool qt_wide(const uint16_t *qt)
+{
+    for (int i = 0; i < 64; i++) {
+        if (qt[i] > 255) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static size_t header_size(const jpeg_info_t *info)
+{
+    return RTP_HEADER_SIZE + JPEG_HEADER_SIZE + (info->restart_interval ? RESTART_HEADER_SIZE : 0);
+}
+
+static size_t qtables_size(const jpeg_info_t *info)
+{
+    return QTABLE_HEADER_SIZE + (qt_wide(info->qt[info->comp[0].tq]) ? 128 : 64)
+           + (qt_wide(info->qt[info->comp[1].tq]) ? 128 : 64);
+}
+
+/* quantization table header and the luminance and chrominance tables, zigzag order */
+static uint8_t *put_qtables(uint8_t *p, const jpeg_info_t *info)
+{
+    const uint16_t *qt[2] = { info->qt[info->comp[0].tq], info->qt[info->comp[1].tq] };
+    uint8_t precision = 0;
+    uint16_t length = 0;
+
+    for (int t = 0; t < 2; t++) {
+        bool wide = qt_wide(qt[t]);
+        precision |= wide << t;
+        length += wide ? 128 : 64;
+    }
+    *p++ = 0;
+    *p++ = precision;
+    p = put_be16(p, length);
+    for (int t = 0; t < 2; t++) {
+        for (int i = 0; i < 64; i++) {
+            if (precision & (1 << t)) {
+                p = put_be16(p, qt[t][i]);
+            } else {
+                *p++ = qt[t][i];
+            }
+        }
+    }
+    return p;
+}
+
+esp_err_t rtp_jpeg_packetize(rtp_jpeg_stream_t *stream, const jpeg_info_t *info, uint32_t timestamp,
+                             uint8_t *buf, size_t size, rtp_jpeg_packet_cb_t cb, void *ctx)
+{
+    int type = jpeg_type(info);
+    if (type < 0) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+
+    if (size <= header_size(info) + qtables_size(info)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    size_t offset = 0;
+    do {
+        uint8_t *p = buf + RTP_HEADER_SIZE;
+
+        /* main JPEG header: type-specific, fragment offset, type, Q, width / 8, height / 8 */
+        p = put_be32(p, offset & 0xFFFFFF);
+        *p++ = type;
+        *p++ = JPEG_Q_IN_BAND;
+        *p++ = info->width / 8;
+        *p++ = info->height / 8;
+        if (info->restart_interval) {
+            /* F and L set with count 0x3FFF: fragments need not end on restart intervals */
+            p = put_be16(p, info->restart_interval);
+            p = put_be16(p, 0xFFFF);
+        }
+        if (!offset) {
+            p = put_qtables(p, info);
+        }
+
+        size_t chunk = size - (p - buf);
+        if (chunk > info->scan_len - offset) {
+            chunk = info->scan_len - offset;
+        }
+        memcpy(p, info->scan + offset, chunk);
+        p += chunk;
+        offset += chunk;
+
+        bool last = offset == info->scan_len;
+        buf[0] = 0x80;                                  /* version 2, no padding, extension or CSRC */
+        buf[1] = (last ? 0x80 : 0) | RTP_JPEG_PAYLOAD_TYPE;   /* marker on the last packet of a frame */
+        put_be16(buf + 2, stream->sequence++);
+        put_be32(buf + 4, timestamp);
+        put_be32(buf + 8, stream->ssrc);
+        cb(ctx, buf, p - buf);
+    } while (offset < info->scan_len);
+
+    return ESP_OK;
+}
+
+size_t rtp_jpeg_packet_count(const jpeg_info_t *info, size_t size)
+{
+    size_t header = header_size(info);
+    size_t qtables = qtables_size(info);
+
+    if (jpeg_type(info) < 0 || size <= header + qtables) {
+        return 0;
+    }
+    size_t first = size - header - qtables;
+    if (info->scan_len <= first) {
+        return 1;
+    }
+    return 1 + (info->scan_len - first + size - header - 1) / (size - header);
+}
@@ -0,0 +1,510 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <errno.h>
+#include <unistd.h>
+#include <stdatomic.h>
+#include <sys/socket.h>
+#include <sys/select.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_random.h"
+#include "sdkconfig.h"
+#include "frame_ring.h"
+#include "frame_trace.h"
+#include "jpeg_parse.h"
+#include "rtp_jpeg.h"
+#include "rtp_fec.h"
+#include "metrics.h"
+#include "rtsp_server.h"
+
+#if CONFIG_RTSP_SERVER_ENABLE
+
+static const char *TAG = "rtsp_server";
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+#define RTSP_MAX_SESSIONS    CONFIG_RTSP_MAX_SESSIONS
+#define RTSP_REQ_BUF_SIZE    1024
+#define RTSP_RESP_BUF_SIZE   768
+#define RTSP_TASK_STACK      4096
+#define RTSP_TASK_PRIO       5
+#define RTSP_SELECT_MS       1000
+#define RTSP_SEND_TIMEOUT_MS 1000
+#define RTP_TASK_STACK       3072
+#define RTP_TASK_PRIO        5
+#define RTP_GET_MS           1000
+#define RTP_PACKET_SIZE      CONFIG_RTP_PACKET_SIZE
+
+#if CONFIG_RTP_FEC_XOR || CONFIG_RTP_FEC_RS
+#if CONFIG_RTP_FEC_XOR
+#define RTP_FEC_SCHEME       RTP_FEC_XOR
+#else
+#define RTP_FEC_SCHEME       RTP_FEC_RS
+#endif
+#define RTP_FEC_PERCENT      CONFIG_RTP_FEC_OVERHEAD_PERCENT
+#define RTP_FEC_MAX_PARITY   CONFIG_RTP_FEC_MAX_PARITY
+#define RTP_MEDIA_SIZE       (RTP_PACKET_SIZE - RTP_FEC_OVERHEAD)  /* parity packets carry a bit more */
+#define RTP_SDP_FEC_FORMAT   " 127"
+#define RTP_SDP_FEC_RTPMAP   "a=rtpmap:127 x-frame-fec/90000\r\n"
+#else
+#define RTP_FEC_SCHEME       RTP_FEC_NONE
+#define RTP_FEC_PERCENT      0
+#define RTP_FEC_MAX_PARITY   0
+#define RTP_MEDIA_SIZE       RTP_PACKET_SIZE
+#define RTP_SDP_FEC_FORMAT   ""
+#define RTP_SDP_FEC_RTPMAP   ""
+#endif
+
+static const char *_RTSP_PUBLIC = "Public: OPTIONS, DESCRIBE, SETUP, PLAY, TEARDOWN, GET_PARAMETER\r\n";
+static const char *_RTSP_SDP = "v=0\r\n"
+                               "o=- %lu 1 IN IP4 %s\r\n"
+                               "s=USB camera\r\n"
+                               "c=IN IP4 0.0.0.0\r\n"
+                               "t=0 0\r\n"
+                               "m=video 0 RTP/AVP %d" RTP_SDP_FEC_FORMAT "\r\n"
+                               "a=rtpmap:%d JPEG/%d\r\n"
+                               RTP_SDP_FEC_RTPMAP
+                               "a=control:track0\r\n";
+
+typedef struct {
+    int fd;                     /* RTSP connection, -1 when the slot is free */
+    char req[RTSP_REQ_BUF_SIZE];
+    size_t req_len;
+    uint32_t id;                /* session identifier, 0 before SETUP */
+    struct sockaddr_in rtp_addr;/* RTP port of the client */
+    atomic_bool playing;        /* read by the sender task */
+} rtsp_session_t;
+
+static rtsp_session_t s_sessions[RTSP_MAX_SESSIONS];
+static int s_listen_fd = -1;
+static int s_rtp_fd = -1;
+static frame_ring_reader_t *s_reader;
+static rtp_jpeg_stream_t s_stream;
+static rtp_fec_t s_fec;                 /* parity of the frame being sent, sender task only */
+static jpeg_info_t s_info;              /* frame being sent, sender task only */
+static uint8_t s_packet[RTP_PACKET_SIZE];
+static atomic_int s_playing_num;
+static atomic_uint s_frames_out;
+static atomic_uint s_packets_out;
+static atomic_uint s_bytes_out;
+static atomic_uint s_send_errors;
+static atomic_uint s_frames_unsupported;
+static atomic_uint s_fec_packets_out;
+
+/* runs on the sender task */
+static void rtp_send_packet(void *ctx, const uint8_t *pkt, size_t len)
+{
+    for (size_t i = 0; i < RTSP_MAX_SESSIONS; i++) {
+        rtsp_session_t *s = &s_sessions[i];
+        if (!atomic_load(&s->playing)) {
+            continue;
+        }
+        ssize_t ret = sendto(s_rtp_fd, pkt, len, 0, (struct sockaddr *)&s->rtp_addr, sizeof(s->rtp_addr));
+        if (ret < 0 && errno == ENOMEM) {
+            /* lwIP ran out of packet buffers, give the Wi-Fi driver a tick to drain them */
+            vTaskDelay(1);
+            ret = sendto(s_rtp_fd, pkt, len, 0, (struct sockaddr *)&s->rtp_addr, sizeof(s->rtp_addr));
+        }
+        if (ret < 0) {
+            atomic_fetch_add(&s_send_errors, 1);
+            continue;
+        }
+        atomic_fetch_add(&s_packets_out, 1);
+        atomic_fetch_add(&s_bytes_out, len);
+    }
+}
+
+static void rtp_send_media(void *ctx, const uint8_t *pkt, size_t len)
+{
+    rtp_fec_add(&s_fec, pkt, len);
+    rtp_send_packet(ctx, pkt, len);
+}
+
+static void rtp_send_parity(void *ctx, const uint8_t *pkt, size_t len)
+{
+    atomic_fetch_add(&s_fec_packets_out, 1);
+    rtp_send_packet(ctx, pkt, len);
+}
+
+static void rtp_send_frame(camera_fb_t *fb)
+{
+    frame_trace_t trace;
+    frame_trace_handoff(&trace, fb);
+
+    esp_err_t ret = jpeg_parse(fb->buf, fb->len, &s_info);
+    if (ret == ESP_OK) {
+        uint32_t timestamp = frame_ring_meta(fb)->captured_us * (RTP_JPEG_CLOCK_RATE / 1000) / 1000;
+        if (RTP_FEC_SCHEME != RTP_FEC_NONE) {
+            size_t k = rtp_jpeg_packet_count(&s_info, RTP_MEDIA_SIZE);
+            rtp_fec_begin(&s_fec, s_stream.sequence, timestamp, k, (k * RTP_FEC_PERCENT + 99) / 100);
+        }
+        frame_trace_first_byte(&trace);
+        ret = rtp_jpeg_packetize(&s_stream, &s_info, timestamp, s_packet, RTP_MEDIA_SIZE, rtp_send_media, NULL);
+    }
+    if (ret == ESP_OK) {
+        rtp_fec_finish(&s_fec, s_packet, sizeof(s_packet), rtp_send_parity, NULL);
+    }
+    if (ret != ESP_OK) {
+        if (atomic_fetch_add(&s_frames_unsupported, 1) == 0) {
+            ESP_LOGW(TAG, "%ux%u frame cannot be sent over RTP: %s", fb->width, fb->height, esp_err_to_name(ret));
+        }
+        return;
+    }
+    frame_trace_last_byte(&trace);
+    atomic_fetch_add(&s_frames_out, 1);
+}
+
+static void rtp_send_task(void *arg)
+{
+    while (true) {
+        camera_fb_t *fb = frame_ring_reader_get(s_reader, pdMS_TO_TICKS(RTP_GET_MS));
+        if (!fb) {
+            continue;
+        }
+        if (atomic_load(&s_playing_num) > 0) {
+            rtp_send_frame(fb);
+        }
+        frame_ring_return(fb);
+    }
+}
+
+/* value of a header of a NUL terminated request, NULL if absent */
+static const char *rtsp_header(const char *req, const char *name)
+{
+    size_t len = strlen(name);
+
+    for (const char *line = strstr(req, "\r\n"); line; line = strstr(line + 2, "\r\n")) {
+        if (!strncasecmp(line + 2, name, len) && line[2 + len] == ':') {
+            const char *value = line + 3 + len;
+            while (*value == ' ') {
+                value++;
+            }
+            return value;
+        }
+    }
+    return NULL;
+}
+
+static void rtsp_reply(rtsp_session_t *s, int cseq, const char *status, const char *headers, const char *body)
+{
+    char resp[RTSP_RESP_BUF_SIZE];
+    int len = snprintf(resp, sizeof(resp), "RTSP/1.0 %s\r\nCSeq: %d\r\n%s", status, cseq, headers ? headers : "");
+
+    if (body) {
+        len += snprintf(resp + len, sizeof(resp) - len, "Content-Length: %u\r\n\r\n%s", strlen(body), body);
+    } else {
+        len += snprintf(resp + len, sizeof(resp) - len, "\r\n");
+    }
+    if (len >= (int)sizeof(resp)) {
+        ESP_LOGE(TAG, "reply to %d truncated", s->fd);
+        len = sizeof(resp) - 1;
+    }
+    send(s->fd, resp, len, MSG_NOSIGNAL);
+}
+
+static void session_stop(rtsp_session_t *s)
+{
+    if (atomic_exchange(&s->playing, false)) {
+        atomic_fetch_sub(&s_playing_num, 1);
+    }
+}
+
+static void session_close(rtsp_session_t *s)
+{
+    ESP_LOGI(TAG, "connection %d closed", s->fd);
+    session_stop(s);
+    close(s->fd);
+    s->fd = -1;
+    s->id = 0;
+    s->req_len = 0;
+}
+
+static bool session_match(const rtsp_session_t *s, const char *req)
+{
+    const char *value = rtsp_header(req, "Session");
+    return s->id && value && strtoul(value, NULL, 16) == s->id;
+}
+
+static void rtsp_describe(rtsp_session_t *s, int cseq, const char *url)
+{
+    struct sockaddr_in local;
+    socklen_t addr_len = sizeof(local);
+    char sdp[256];
+    char headers[192];
+
+    getsockname(s->fd, (struct sockaddr *)&local, &addr_len);
+    snprintf(sdp, sizeof(sdp), _RTSP_SDP, esp_random(), inet_ntoa(local.sin_addr),
+             RTP_JPEG_PAYLOAD_TYPE, RTP_JPEG_PAYLOAD_TYPE, RTP_JPEG_CLOCK_RATE);
+    /* the control attribute is resolved against the base, which must end with a slash */
+    snprintf(headers, sizeof(headers), "Content-Base: %s%s\r\nContent-Type: application/sdp\r\n",
+             url, url[strlen(url) - 1] == '/' ? "" : "/");
+    rtsp_reply(s, cseq, "200 OK", headers, sdp);
+}
+
+static void rtsp_setup(rtsp_session_t *s, int cseq, const char *req)
+{
+    const char *transport = rtsp_header(req, "Transport");
+    const char *ports = transport ? strstr(transport, "client_port=") : NULL;
+    char headers[192];
+    int rtp_port = 0;
+
+    /* unicast UDP only, interleaved TCP would bring back head-of-line blocking */
+    if (!ports || strstr(transport, "RTP/AVP/TCP") || strstr(transport, "multicast")
+            || sscanf(ports, "client_port=%d", &rtp_port) != 1 || rtp_port <= 0 || rtp_port > 65535) {
+        rtsp_reply(s, cseq, "461 Unsupported Transport", NULL, NULL);
+        return;
+    }
+
+    socklen_t addr_len = sizeof(s->rtp_addr);
+    session_stop(s);
+    getpeername(s->fd, (struct sockaddr *)&s->rtp_addr, &addr_len);
+    s->rtp_addr.sin_port = htons(rtp_port);
+    if (!s->id) {
+        s->id = esp_random() | 1;
+    }
+
+    snprintf(headers, sizeof(headers),
+             "Transport: RTP/AVP;unicast;client_port=%d-%d;server_port=%d-%d;ssrc=%08lX\r\nSession: %08lX\r\n",
+             rtp_port, rtp_port + 1, CONFIG_RTP_SERVER_PORT, CONFIG_RTP_SERVER_PORT + 1, s_stream.ssrc, s->id);
+    rtsp_reply(s, cseq, "200 OK", headers, NULL);
+    ESP_LOGI(TAG, "connection %d: RTP to %s:%d", s->fd, inet_ntoa(s->rtp_addr.sin_addr), rtp_port);
+}
+
+static void rtsp_handle(rtsp_session_t *s, const char *req)
+{
+    char method[16];
+    char url[128];
+    char headers[64];
+    const char *value = rtsp_header(req, "CSeq");
+    int cseq = value ? atoi(value) : 0;
+
+    if (sscanf(req, "%15s %127s RTSP/1.0", method, url) != 2) {
+        rtsp_reply(s, cseq, "400 Bad Request", NULL, NULL);
+        return;
+    }
+    snprintf(headers, sizeof(headers), "Session: %08lX\r\n", s->id);
+
+    if (!strcmp(method, "OPTIONS")) {
+        rtsp_reply(s, cseq, "200 OK", _RTSP_PUBLIC, NULL);
+    } else if (!strcmp(method, "DESCRIBE")) {
+        rtsp_describe(s, cseq, url);
+    } else if (!strcmp(method, "SETUP")) {
+        rtsp_setup(s, cseq, req);
+    } else if (!strcmp(method, "PLAY")) {
+        if (!session_match(s, req)) {
+            rtsp_reply(s, cseq, "454 Session Not Found", NULL, NULL);
+            return;
+        }
+        if (!atomic_exchange(&s->playing, true)) {
+            atomic_fetch_add(&s_playing_num, 1);
+        }
+        snprintf(headers, sizeof(headers), "Session: %08lX\r\nRange: npt=0.000-\r\n", s->id);
+        rtsp_reply(s, cseq, "200 OK", headers, NULL);
+    } else if (!strcmp(method, "TEARDOWN")) {
+        if (!session_match(s, req)) {
+            rtsp_reply(s, cseq, "454 Session Not Found", NULL, NULL);
+            return;
+        }
+        session_stop(s);
+        s->id = 0;
+        rtsp_reply(s, cseq, "200 OK", headers, NULL);
+    } else if (!strcmp(method, "GET_PARAMETER")) {
+        /* keep-alive */
+        rtsp_reply(s, cseq, "200 OK", s->id ? headers : NULL, NULL);
+    } else {
+        rtsp_reply(s, cseq, "501 Not Implemented", _RTSP_PUBLIC, NULL);
+    }
+}
+
+static void session_read(rtsp_session_t *s)
+{
+    ssize_t len = recv(s->fd, s->req + s->req_len, sizeof(s->req) - 1 - s->req_len, MSG_DONTWAIT);
+    if (len == 0 || (len < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) {
+        session_close(s);
+        return;
+    }
+    if (len < 0) {
+        return;
+    }
+    s->req_len += len;
+    s->req[s->req_len] = '\0';
+
+    /* requests may be pipelined, handle every complete one */
+    while (s->req_len) {
+        char *end = strstr(s->req, "\r\n\r\n");
+        if (!end) {
+            if (s->req_len == sizeof(s->req) - 1) {
+                ESP_LOGW(TAG, "connection %d: request too long", s->fd);
+                session_close(s);
+            }
+            return;
+        }
+        size_t head = end + 4 - s->req;
+        end[2] = '\0';
+        const char *value = rtsp_header(s->req, "Content-Length");
+        size_t body = value ? strtoul(value, NULL, 10) : 0;
+        if (head + body > sizeof(s->req) - 1) {
+            ESP_LOGW(TAG, "connection %d: request too long", s->fd);
+            session_close(s);
+            return;
+        }
+        if (head + body > s->req_len) {
+            end[2] = '\r';
+            return;
+        }
+
+        rtsp_handle(s, s->req);
+        s->req_len -= head + body;
+        memmove(s->req, s->req + head + body, s->req_len + 1);
+    }
+}
+
+static void server_accept(void)
+{
+    struct sockaddr_in addr;
+    socklen_t addr_len = sizeof(addr);
+    int fd = accept(s_listen_fd, (struct sockaddr *)&addr, &addr_len);
+    if (fd < 0) {
+        return;
+    }
+
+    for (size_t i = 0; i < RTSP_MAX_SESSIONS; i++) {
+        rtsp_session_t *s = &s_sessions[i];
+        if (s->fd < 0) {
+            struct timeval tv = { .tv_sec = 0, .tv_usec = RTSP_SEND_TIMEOUT_MS * 1000 };
+            setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+            s->fd = fd;
+            ESP_LOGI(TAG, "connection %d from %s", fd, inet_ntoa(addr.sin_addr));
+            return;
+        }
+    }
+    ESP_LOGW(TAG, "too many sessions, rejecting");
+    close(fd);
+}
+
+static void rtsp_server_task(void *arg)
+{
+    while (true) {
+        fd_set rfds;
+        int max_fd = s_listen_fd;
+
+        FD_ZERO(&rfds);
+        FD_SET(s_listen_fd, &rfds);
+        for (size_t i = 0; i < RTSP_MAX_SESSIONS; i++) {
+            if (s_sessions[i].fd >= 0) {
+                FD_SET(s_sessions[i].fd, &rfds);
+                if (s_sessions[i].fd > max_fd) {
+                    max_fd = s_sessions[i].fd;
+                }
+            }
+        }
+
+        struct timeval tv = { .tv_sec = 0, .tv_usec = RTSP_SELECT_MS * 1000 };
+        int ready = select(max_fd + 1, &rfds, NULL, NULL, &tv);
+        if (ready < 0) {
+            if (errno != EINTR) {
+                ESP_LOGE(TAG, "select failed: %d", errno);
+                vTaskDelay(pdMS_TO_TICKS(100));
+            }
+            continue;
+        }
+
+        if (FD_ISSET(s_listen_fd, &rfds)) {
+            server_accept();
+        }
+        for (size_t i = 0; i < RTSP_MAX_SESSIONS; i++) {
+            rtsp_session_t *s = &s_sessions[i];
+            if (s->fd >= 0 && FD_ISSET(s->fd, &rfds)) {
+                session_read(s);
+            }
+        }
+    }
+}
+
+esp_err_t rtsp_server_start(void)
+{
+    struct sockaddr_in addr = {
+        .sin_family = AF_INET,
+        .sin_port = htons(CONFIG_RTSP_SERVER_PORT),
+        .sin_addr.s_addr = htonl(INADDR_ANY),
+    };
+    int reuse = 1;
+
+    for (size_t i = 0; i < RTSP_MAX_SESSIONS; i++) {
+        s_sessions[i].fd = -1;
+    }
+    s_stream.ssrc = esp_random();
+    s_stream.sequence = esp_random();
+    if (RTP_FEC_SCHEME != RTP_FEC_NONE) {
+        if (rtp_fec_init(&s_fec, RTP_FEC_SCHEME, RTP_MEDIA_SIZE, RTP_FEC_MAX_PARITY) != ESP_OK) {
+            return ESP_ERR_NO_MEM;
+        }
+        s_fec.stream.ssrc = esp_random();
+        s_fec.stream.sequence = esp_random();
+    }
+
+    s_reader = frame_ring_reader_open();
+    if (!s_reader) {
+        ESP_LOGE(TAG, "no frame reader");
+        return ESP_FAIL;
+    }
+
+    s_listen_fd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (s_listen_fd < 0) {
+        goto err;
+    }
+    setsockopt(s_listen_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    if (bind(s_listen_fd, (struct sockaddr *)&addr, sizeof(addr)) < 0
+            || listen(s_listen_fd, 2) < 0) {
+        ESP_LOGE(TAG, "listen on port %u failed: %d", CONFIG_RTSP_SERVER_PORT, errno);
+        goto err;
+    }
+
+    addr.sin_port = htons(CONFIG_RTP_SERVER_PORT);
+    s_rtp_fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (s_rtp_fd < 0 || bind(s_rtp_fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        ESP_LOGE(TAG, "RTP socket on port %u failed: %d", CONFIG_RTP_SERVER_PORT, errno);
+        goto err;
+    }
+
+    metrics_register_counter("rtp_frames_out_total", "Frames sent over RTP", &s_frames_out);
+    metrics_register_counter("rtp_packets_out_total", "RTP packets sent, counted per session", &s_packets_out);
+    metrics_register_counter("rtp_bytes_out_total", "RTP bytes sent, counted per session", &s_bytes_out);
+    metrics_register_counter("rtp_send_errors_total", "RTP packets the network stack refused", &s_send_errors);
+    metrics_register_counter("rtp_frames_unsupported_total", "Frames RFC 2435 cannot carry", &s_frames_unsupported);
+    metrics_register_counter("rtp_fec_packets_out_total", "RTP parity packets sent, counted once per frame", &s_fec_packets_out);
+    metrics_register_gauge("rtsp_sessions_playing", "RTSP sessions receiving RTP", &s_playing_num);
+
+    if (xTaskCreate(rtp_send_task, "rtp_send", RTP_TASK_STACK, NULL, RTP_TASK_PRIO, NULL) != pdPASS
+            || xTaskCreate(rtsp_server_task, "rtsp_srv", RTSP_TASK_STACK, NULL, RTSP_TASK_PRIO, NULL) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+    ESP_LOGI(TAG, "rtsp://<ip>:%u/ ready", CONFIG_RTSP_SERVER_PORT);
+    return ESP_OK;
+
+err:
+    if (s_listen_fd >= 0) {
+        close(s_listen_fd);
+    }
+    if (s_rtp_fd >= 0) {
+        close(s_rtp_fd);
+    }
+    s_listen_fd = s_rtp_fd = -1;
+    frame_ring_reader_close(s_reader);
+    return ESP_FAIL;
+}
+
+#endif /* CONFIG_RTSP_SERVER_ENABLE */
@@ -0,0 +1,349 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "sdkconfig.h"
+#include "jitter_buffer.h"
+#include "resampler.h"
+#include "pcm_convert.h"
+#include "mixer.h"
+#include "metrics.h"
+#include "speaker_ws.h"
+
+#if CONFIG_HTTPD_WS_SUPPORT
+
+static const char *TAG = "speaker_ws";
+
+#define SPEAKER_WS_START_MS     100     /* target until a few seconds of jitter were seen */
+#define SPEAKER_WS_MARGIN_MS    10      /* the mixer takes 10 ms at a time */
+#define SPEAKER_WS_PULL         256     /* stream samples taken from the jitter buffer at a time */
+#define SPEAKER_WS_END          "end"
+
+typedef struct {
+    int fd;                     /* -1 once the client ended the stream or went away */
+    uint32_t channels;          /* of the messages, the jitter buffer holds mono */
+    jitter_buffer_t *jb;        /* NULL while no stream plays */
+    resampler_t *rs;            /* NULL when the stream is at the speaker rate */
+    uint32_t gen;               /* counts streams, the reader starts over on a new one */
+    jitter_buffer_stats_t seen; /* statistics already added to the counters */
+} speaker_stream_t;
+
+struct speaker_ws_output {
+    uint32_t sample_rate;
+    uint32_t channels;
+    uint32_t gen;
+    size_t len;                 /* samples in pulled */
+    size_t pos;                 /* of them fed to the resampler */
+    int16_t pulled[SPEAKER_WS_PULL];
+    int16_t mono[MIXER_BLOCK_SAMPLES];
+};
+
+static httpd_handle_t s_server;
+static SemaphoreHandle_t s_lock;    /* guards s_stream and s_output */
+static speaker_stream_t s_stream = { .fd = -1 };
+static speaker_ws_output_t *s_output;
+static int16_t s_msg[SPEAKER_WS_MSG_MAX / sizeof(int16_t)];    /* only the httpd task receives */
+static atomic_uint s_streams;
+static atomic_uint s_packets;
+static atomic_uint s_underruns;
+static atomic_uint s_concealed;
+static atomic_uint s_dropped;
+static atomic_int s_target_ms;
+static atomic_int s_depth_ms;
+static atomic_int s_jitter_ms;
+static atomic_int s_latency_ms;
+
+/* add what the jitter buffer counted since last time, call with s_lock held */
+static void speaker_stream_sync(void)
+{
+    jitter_buffer_stats_t stats;
+    jitter_buffer_get_stats(s_stream.jb, &stats);
+
+    atomic_fetch_add(&s_packets, stats.packets - s_stream.seen.packets);
+    atomic_fetch_add(&s_underruns, stats.underruns - s_stream.seen.underruns);
+    atomic_fetch_add(&s_concealed, stats.concealed - s_stream.seen.concealed);
+    atomic_fetch_add(&s_dropped, stats.dropped - s_stream.seen.dropped);
+    atomic_store(&s_target_ms, stats.target_ms);
+    atomic_store(&s_depth_ms, stats.depth_ms);
+    atomic_store(&s_jitter_ms, stats.jitter_ms);
+    atomic_store(&s_latency_ms, stats.latency_ms);
+    s_stream.seen = stats;
+}
+
+/* free the stream, call with s_lock held */
+static void speaker_stream_free(void)
+{
+    if (s_stream.jb) {
+        speaker_stream_sync();
+        ESP_LOGI(TAG, "stream done: %lu packets, target %lu ms, latency %lu ms, %lu underruns, %lu samples concealed",
+                 s_stream.seen.packets, s_stream.seen.target_ms, s_stream.seen.latency_ms,
+                 s_stream.seen.underruns, s_stream.seen.concealed);
+    }
+    if (s_stream.fd >= 0) {
+        httpd_sess_trigger_close(s_server, s_stream.fd);
+    }
+    jitter_buffer_delete(s_stream.jb);
+    resampler_delete(s_stream.rs);
+    s_stream.jb = NULL;
+    s_stream.rs = NULL;
+    s_stream.fd = -1;
+    atomic_store(&s_depth_ms, 0);
+    atomic_store(&s_latency_ms, 0);
+}
+
+/* the client of the stream closed its socket, call with s_lock held */
+static bool speaker_stream_gone(void)
+{
+    return s_stream.fd >= 0 && httpd_ws_get_fd_info(s_server, s_stream.fd) != HTTPD_WS_CLIENT_WEBSOCKET;
+}
+
+static int query_int(httpd_req_t *req, const char *key, int fallback)
+{
+    char query[64];
+    char value[12];
+
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK
+            && httpd_query_key_value(query, key, value, sizeof(value)) == ESP_OK) {
+        return atoi(value);
+    }
+    return fallback;
+}
+
+/* handshake done, start a stream unless another client is playing */
+static esp_err_t speaker_ws_open(httpd_req_t *req, int fd)
+{
+    int rate = query_int(req, "rate", 16000);
+    int channels = query_int(req, "channels", 1);
+    if (rate < SPEAKER_WS_RATE_MIN || rate > SPEAKER_WS_RATE_MAX || channels < 1 || channels > PCM_CHANNELS_MAX) {
+        ESP_LOGW(TAG, "client %d: %d Hz, %d channels not supported", fd, rate, channels);
+        return ESP_FAIL;
+    }
+
+    esp_err_t err = ESP_OK;
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    if (!s_output) {
+        ESP_LOGW(TAG, "client %d: speaker not playing", fd);
+        err = ESP_ERR_INVALID_STATE;
+    } else if (s_stream.fd >= 0 && s_stream.fd != fd && !speaker_stream_gone()) {
+        ESP_LOGW(TAG, "client %d: busy with client %d", fd, s_stream.fd);
+        err = ESP_ERR_INVALID_STATE;
+    } else {
+        /* a stream that is still playing out is cut short */
+        s_stream.fd = -1;
+        speaker_stream_free();
+        jitter_buffer_config_t config = {
+            .sample_rate = rate,
+            .min_ms = CONFIG_SPEAKER_WS_MIN_MS,
+            .max_ms = CONFIG_SPEAKER_WS_MAX_MS,
+            .start_ms = SPEAKER_WS_START_MS,
+            .margin_ms = SPEAKER_WS_MARGIN_MS,
+        };
+        err = jitter_buffer_create(&config, &s_stream.jb);
+        if (err == ESP_OK && (uint32_t)rate != s_output->sample_rate) {
+            err = resampler_create(rate, s_output->sample_rate, &s_stream.rs);
+        }
+        if (err == ESP_OK) {
+            s_stream.fd = fd;
+            s_stream.channels = channels;
+            s_stream.gen++;
+            memset(&s_stream.seen, 0, sizeof(s_stream.seen));
+            atomic_fetch_add(&s_streams, 1);
+        } else {
+            speaker_stream_free();
+        }
+    }
+    xSemaphoreGive(s_lock);
+
+    if (err != ESP_OK) {
+        return ESP_FAIL;
+    }
+    ESP_LOGI(TAG, "client %d: %d Hz, %d channels", fd, rate, channels);
+    return ESP_OK;
+}
+
+static esp_err_t speaker_ws_handler(httpd_req_t *req)
+{
+    int fd = httpd_req_to_sockfd(req);
+
+    if (req->method == HTTP_GET) {
+        return speaker_ws_open(req, fd);
+    }
+
+    httpd_ws_frame_t pkt = {
+        .payload = (uint8_t *)s_msg,
+    };
+    esp_err_t ret = httpd_ws_recv_frame(req, &pkt, 0);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    if (pkt.len > SPEAKER_WS_MSG_MAX) {
+        ESP_LOGW(TAG, "client %d: message of %u bytes, at most %u", fd, pkt.len, SPEAKER_WS_MSG_MAX);
+        return ESP_FAIL;
+    }
+    ret = httpd_ws_recv_frame(req, &pkt, SPEAKER_WS_MSG_MAX);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    int64_t now_us = esp_timer_get_time();
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    if (s_stream.fd == fd && s_stream.jb) {
+        if (pkt.type == HTTPD_WS_TYPE_TEXT && pkt.len == strlen(SPEAKER_WS_END)
+                && !memcmp(pkt.payload, SPEAKER_WS_END, pkt.len)) {
+            jitter_buffer_end(s_stream.jb);
+            s_stream.fd = -1;
+        } else if (pkt.type == HTTPD_WS_TYPE_BINARY) {
+            /* a partial frame at the end is dropped, mono in place */
+            size_t frames = pkt.len / sizeof(int16_t) / s_stream.channels;
+            if (s_stream.channels > 1) {
+                pcm_multi_to_mono(s_msg, s_msg, s_stream.channels, frames);
+            }
+            jitter_buffer_push(s_stream.jb, s_msg, frames, now_us);
+            speaker_stream_sync();
+        }
+    }
+    xSemaphoreGive(s_lock);
+    return ESP_OK;
+}
+
+esp_err_t speaker_ws_register(httpd_handle_t server)
+{
+    httpd_uri_t ws_uri = {
+        .uri = "/ws/speaker",
+        .method = HTTP_GET,
+        .handler = speaker_ws_handler,
+        .user_ctx = NULL,
+        .is_websocket = true,
+    };
+
+    s_lock = xSemaphoreCreateMutex();
+    if (!s_lock) {
+        return ESP_ERR_NO_MEM;
+    }
+    s_server = server;
+    if (httpd_register_uri_handler(server, &ws_uri) != ESP_OK) {
+        return ESP_FAIL;
+    }
+
+    metrics_register_counter("speaker_net_streams_total", "Streams accepted on /ws/speaker", &s_streams);
+    metrics_register_counter("speaker_net_packets_total", "Messages of samples received on /ws/speaker", &s_packets);
+    metrics_register_counter("speaker_net_underruns_total", "Times the /ws/speaker jitter buffer ran dry", &s_underruns);
+    metrics_register_counter("speaker_net_concealed_total", "Samples played in place of missing /ws/speaker audio", &s_concealed);
+    metrics_register_counter("speaker_net_dropped_total", "/ws/speaker samples lost to a full jitter buffer", &s_dropped);
+    metrics_register_gauge("speaker_net_target_ms", "Depth the /ws/speaker jitter buffer aims for", &s_target_ms);
+    metrics_register_gauge("speaker_net_depth_ms", "Audio in the /ws/speaker jitter buffer", &s_depth_ms);
+    metrics_register_gauge("speaker_net_jitter_ms", "Largest /ws/speaker arrival jitter of the last seconds", &s_jitter_ms);
+    metrics_register_gauge("speaker_net_latency_ms", "Latency the /ws/speaker jitter buffer adds", &s_latency_ms);
+    return ESP_OK;
+}
+
+esp_err_t speaker_ws_output_create(uint32_t sample_rate, uint32_t channels, speaker_ws_output_t **ret)
+{
+    if (!sample_rate || channels < 1 || channels > PCM_CHANNELS_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_lock) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    speaker_ws_output_t *out = (speaker_ws_output_t *)calloc(1, sizeof(speaker_ws_output_t));
+    if (!out) {
+        return ESP_ERR_NO_MEM;
+    }
+    out->sample_rate = sample_rate;
+    out->channels = channels;
+
+    esp_err_t err = ESP_OK;
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    if (s_output) {
+        err = ESP_ERR_INVALID_STATE;
+    } else {
+        out->gen = s_stream.gen;
+        s_output = out;
+    }
+    xSemaphoreGive(s_lock);
+
+    if (err != ESP_OK) {
+        free(out);
+        return err;
+    }
+    *ret = out;
+    return ESP_OK;
+}
+
+void speaker_ws_output_delete(speaker_ws_output_t *out)
+{
+    if (out) {
+        /* the stream was converted for this output, it ends with it */
+        xSemaphoreTake(s_lock, portMAX_DELAY);
+        speaker_stream_free();
+        s_output = NULL;
+        xSemaphoreGive(s_lock);
+        free(out);
+    }
+}
+
+size_t speaker_ws_read(void *ctx, int16_t *out, size_t frames)
+{
+    speaker_ws_output_t *output = (speaker_ws_output_t *)ctx;
+    size_t n = 0;
+
+    if (frames > MIXER_BLOCK_SAMPLES) {
+        frames = MIXER_BLOCK_SAMPLES;
+    }
+    int16_t *mono = output->channels == 1 ? out : output->mono;
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    if (!s_stream.jb) {
+        xSemaphoreGive(s_lock);
+        return 0;
+    }
+    if (output->gen != s_stream.gen) {
+        output->gen = s_stream.gen;
+        output->len = 0;
+        output->pos = 0;
+    }
+    if (speaker_stream_gone()) {
+        ESP_LOGI(TAG, "client %d gone", s_stream.fd);
+        jitter_buffer_end(s_stream.jb);
+        s_stream.fd = -1;
+    }
+
+    /* like the prompt player: take stream samples a piece at a time and convert them */
+    if (!s_stream.rs) {
+        n = jitter_buffer_pull(s_stream.jb, mono, frames);
+    }
+    while (s_stream.rs && n < frames) {
+        if (output->pos == output->len) {
+            output->len = jitter_buffer_pull(s_stream.jb, output->pulled, SPEAKER_WS_PULL);
+            output->pos = 0;
+            if (!output->len) {
+                break;
+            }
+        }
+        size_t in_len = output->len - output->pos;
+        n += resampler_process(s_stream.rs, output->pulled + output->pos, &in_len, mono + n, frames - n);
+        output->pos += in_len;
+    }
+    if (jitter_buffer_done(s_stream.jb) && output->pos == output->len) {
+        speaker_stream_free();
+    } else {
+        speaker_stream_sync();
+    }
+    xSemaphoreGive(s_lock);
+
+    if (n && output->channels > 1) {
+        pcm_mono_to_multi(output->mono, out, output->channels, n);
+    }
+    return n;
+}
+
+#endif /* CONFIG_HTTPD_WS_SUPPORT */
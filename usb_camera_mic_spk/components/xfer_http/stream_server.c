@@ -0,0 +1,701 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/select.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_vfs_eventfd.h"
+#include "sdkconfig.h"
+#include "frame_ring.h"
+#include "frame_trace.h"
+#include "metrics.h"
+#include "lat_hist.h"
+#include "jpeg_scale.h"
+#include "stream_server.h"
+
+static const char *TAG = "stream_server";
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+#define PART_BOUNDARY "123456789000000000000987654321"
+static const char *_STREAM_HTTP_HEADER = "HTTP/1.1 200 OK\r\n"
+                                         "Content-Type: multipart/x-mixed-replace;boundary=" PART_BOUNDARY "\r\n"
+                                         "Access-Control-Allow-Origin: *\r\n"
+                                         "X-Framerate: 60\r\n"
+                                         "Connection: close\r\n\r\n";
+static const char *_STREAM_NOT_FOUND = "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+static const char *_STREAM_BOUNDARY = "\r\n--" PART_BOUNDARY "\r\n";
+static const char *_STREAM_PART = "Content-Type: image/jpeg\r\nContent-Length: %u\r\nX-Timestamp: %d.%06d\r\nX-Sequence: %u\r\n\r\n";
+
+#define STREAM_MAX_CLIENTS   CONFIG_STREAM_SERVER_MAX_CLIENTS
+#define STREAM_REQ_BUF_SIZE  256
+#define STREAM_TASK_STACK    4096
+#define STREAM_TASK_PRIO     5
+#define STREAM_MAX_SKIP      15         /* deliver at least one frame in 16 */
+#define STREAM_SELECT_MS     200
+#define STREAM_STALL_US      (CONFIG_STREAM_CLIENT_STALL_TIMEOUT_MS * 1000LL)
+#define STREAM_SCALES        3          /* 2, 4 and 8 */
+#define STREAM_SCALE_SLACK   1024       /* headers of a scaled frame */
+
+typedef enum {
+    CLIENT_FREE = 0,
+    CLIENT_REQUEST,             /* reading the HTTP request */
+    CLIENT_STREAMING,           /* response header sent or queued, sending parts */
+    CLIENT_CLOSING,             /* flush what is queued, then close */
+} client_state_t;
+
+/*
+ * A downscaled copy of the newest frame, built once for every client asking
+ * for that scale. Two per scale so one can be rebuilt while clients still send
+ * the other.
+ */
+typedef struct {
+    uint8_t *buf;
+    size_t size;
+    size_t len;                 /* 0 if scaling the frame failed */
+    uint32_t frame_id;          /* server frame counter of the frame it holds */
+    int users;                  /* clients sending it */
+} scaled_frame_t;
+
+typedef struct {
+    client_state_t state;
+    int fd;
+    char req[STREAM_REQ_BUF_SIZE];
+    size_t req_len;
+    camera_fb_t *fb;            /* frame being sent, pinned until fully written */
+    uint32_t scale;             /* requested downscaling, 1 for full size */
+    scaled_frame_t *scaled;     /* downscaled copy being sent instead of fb */
+    uint32_t frame_id;          /* server frame counter of the last frame started */
+    frame_trace_t trace;        /* latency stamps of the frame being sent */
+    char part[128];
+    struct iovec iov[3];
+    int iov_first;
+    int iov_cnt;
+    uint32_t frames_sent;
+    uint32_t frames_skipped;
+    uint64_t bytes_sent;
+    int64_t connected_at;
+    size_t backlog;             /* bytes queued but not yet taken by the socket */
+    uint32_t skip_ratio;        /* frames to let pass after each delivered one */
+    int64_t frame_started;      /* when the current frame was queued */
+    int64_t last_progress;      /* last time the socket took any data */
+    int64_t last_delivered;
+    uint32_t drain_avg_us;      /* time to write out one frame */
+    uint32_t queue_delay_avg_us;/* frame arrival to start of sending */
+    uint32_t deliver_avg_us;    /* interval between delivered frames */
+    uint32_t frame_send_us;     /* time spent in sendmsg() for the current frame */
+    uint32_t send_avg_us;       /* time spent in sendmsg() per frame */
+    uint32_t frame_bytes_avg;   /* bytes written per frame, part header included */
+} stream_client_t;
+
+static stream_client_t s_clients[STREAM_MAX_CLIENTS];
+static int s_listen_fd = -1;
+static int s_wake_fd = -1;              /* eventfd, written on every new frame */
+static frame_ring_reader_t *s_reader;
+static camera_fb_t *s_current;          /* newest frame, pinned by the server */
+static uint32_t s_current_id;
+static int64_t s_current_time;          /* when the newest frame reached the server */
+static uint32_t s_frame_interval_avg_us;
+static atomic_uint s_evicted;
+static atomic_uint s_frames_out;
+static atomic_uint s_bytes_out;
+static atomic_uint s_frames_skipped;
+static atomic_int s_client_num;
+static atomic_uint s_frames_scaled;
+static atomic_uint s_scale_failed;
+static lat_hist_t s_scale_hist;
+static scaled_frame_t s_scaled[STREAM_SCALES][2];
+static SemaphoreHandle_t s_stats_lock;
+static stream_server_stats_t s_stats;   /* snapshot for stream_server_get_stats() */
+
+/* moving average with 1/8 weight for the new sample */
+static uint32_t avg_update(uint32_t avg, uint32_t sample)
+{
+    return avg ? avg - (avg >> 3) + (sample >> 3) : sample;
+}
+
+static void set_nonblocking(int fd)
+{
+    int flags = fcntl(fd, F_GETFL, 0);
+    fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+}
+
+/*
+ * Runs in the UVC callback, must not block. An eventfd write only takes the
+ * eventfd's spinlock and triggers the select() of the server task, no lwIP
+ * call that would queue behind the tcpip thread.
+ */
+static void stream_server_wake(void *arg)
+{
+    uint64_t one = 1;
+    write(s_wake_fd, &one, sizeof(one));
+}
+
+static scaled_frame_t *scaled_pair(uint32_t scale)
+{
+    return s_scaled[scale == 2 ? 0 : (scale == 4 ? 1 : 2)];
+}
+
+static bool scaled_build(scaled_frame_t *sf, uint32_t scale)
+{
+    /* leave room for the headers and a frame that compresses worse than its size suggests */
+    size_t need = s_current->len / scale + s_current->len / 8 + STREAM_SCALE_SLACK;
+    esp_err_t ret = ESP_FAIL;
+
+    for (int attempt = 0; attempt < 2; attempt++) {
+        if (sf->size < need) {
+            free(sf->buf);
+            sf->buf = (uint8_t *)malloc(need);
+            sf->size = sf->buf ? need : 0;
+            if (!sf->buf) {
+                return false;
+            }
+        }
+        ret = jpeg_scale(s_current->buf, s_current->len, scale, sf->buf, sf->size, &sf->len);
+        if (ret != ESP_ERR_INVALID_SIZE) {
+            break;
+        }
+        need = s_current->len + STREAM_SCALE_SLACK;
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "scaling frame %lu by %lu failed: %s", s_current_id, scale, esp_err_to_name(ret));
+        return false;
+    }
+    return true;
+}
+
+/* the newest frame at the given scale, scaled on first use */
+static scaled_frame_t *scaled_get(uint32_t scale)
+{
+    scaled_frame_t *pair = scaled_pair(scale);
+    scaled_frame_t *sf = NULL;
+
+    for (int i = 0; i < 2; i++) {
+        if (pair[i].frame_id == s_current_id) {
+            return pair[i].len ? &pair[i] : NULL;
+        }
+        if (!pair[i].users) {
+            sf = &pair[i];
+        }
+    }
+    if (!sf) {
+        return NULL;
+    }
+
+    int64_t start = esp_timer_get_time();
+    sf->frame_id = s_current_id;
+    sf->len = 0;
+    if (!scaled_build(sf, scale)) {
+        sf->len = 0;
+        atomic_fetch_add(&s_scale_failed, 1);
+        return NULL;
+    }
+    lat_hist_record(&s_scale_hist, esp_timer_get_time() - start);
+    atomic_fetch_add(&s_frames_scaled, 1);
+    return sf;
+}
+
+/* give back the buffers of a scale no client streams at anymore */
+static void scaled_trim(uint32_t scale)
+{
+    for (size_t i = 0; i < STREAM_MAX_CLIENTS; i++) {
+        if (s_clients[i].state != CLIENT_FREE && s_clients[i].scale == scale) {
+            return;
+        }
+    }
+    scaled_frame_t *pair = scaled_pair(scale);
+    for (int i = 0; i < 2; i++) {
+        free(pair[i].buf);
+        memset(&pair[i], 0, sizeof(pair[i]));
+    }
+}
+
+static void client_release_frame(stream_client_t *c)
+{
+    if (c->scaled) {
+        c->scaled->users--;
+        c->scaled = NULL;
+    }
+    if (c->fb) {
+        frame_ring_return(c->fb);
+        c->fb = NULL;
+    }
+}
+
+static void client_close(stream_client_t *c)
+{
+    uint32_t scale = c->scale;
+
+    client_release_frame(c);
+    if (c->state == CLIENT_STREAMING || c->state == CLIENT_CLOSING) {
+        int64_t secs = (esp_timer_get_time() - c->connected_at) / 1000000;
+        ESP_LOGI(TAG, "client %d closed: %lu frames sent, %lu skipped, %llu bytes in %llds",
+                 c->fd, c->frames_sent, c->frames_skipped, c->bytes_sent, secs);
+    }
+    close(c->fd);
+    memset(c, 0, sizeof(*c));
+    c->fd = -1;
+    if (scale > 1) {
+        scaled_trim(scale);
+    }
+}
+
+static void client_queue(stream_client_t *c, const void *buf, size_t len)
+{
+    c->iov[c->iov_cnt].iov_base = (void *)buf;
+    c->iov[c->iov_cnt].iov_len = len;
+    c->iov_cnt++;
+    c->backlog += len;
+}
+
+/*
+ * A client that needs longer than one frame interval to drain a frame would
+ * miss the frames arriving meanwhile anyway. Skipping them up front means it
+ * starts on a frame as soon as it arrives instead of one that already waited.
+ */
+static void client_frame_done(stream_client_t *c)
+{
+    int64_t now = esp_timer_get_time();
+    size_t len = c->scaled ? c->scaled->len : c->fb->len;
+
+    c->frames_sent++;
+    atomic_fetch_add(&s_frames_out, 1);
+    c->drain_avg_us = avg_update(c->drain_avg_us, now - c->frame_started);
+    c->send_avg_us = avg_update(c->send_avg_us, c->frame_send_us);
+    c->frame_bytes_avg = avg_update(c->frame_bytes_avg, len + strlen(c->part) + strlen(_STREAM_BOUNDARY));
+    if (c->last_delivered) {
+        c->deliver_avg_us = avg_update(c->deliver_avg_us, now - c->last_delivered);
+    }
+    c->last_delivered = now;
+
+    if (s_frame_interval_avg_us) {
+        uint32_t skip = c->drain_avg_us / s_frame_interval_avg_us;
+        c->skip_ratio = skip > STREAM_MAX_SKIP ? STREAM_MAX_SKIP : skip;
+    }
+}
+
+/* returns 0 once everything queued is written, 1 if the socket is full, -1 on error */
+static int client_flush(stream_client_t *c)
+{
+    while (c->iov_first < c->iov_cnt) {
+        struct msghdr msg = {
+            .msg_iov = &c->iov[c->iov_first],
+            .msg_iovlen = c->iov_cnt - c->iov_first,
+        };
+        int64_t start = esp_timer_get_time();
+        ssize_t sent = sendmsg(c->fd, &msg, MSG_DONTWAIT | MSG_NOSIGNAL);
+        int64_t end = esp_timer_get_time();
+        c->frame_send_us += end - start;
+        if (sent > 0) {
+            c->last_progress = end;
+        }
+        if (sent < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                return 1;
+            }
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+        if (c->fb && sent > 0) {
+            frame_trace_first_byte(&c->trace);
+        }
+        c->bytes_sent += sent;
+        atomic_fetch_add(&s_bytes_out, sent);
+        c->backlog -= sent;
+        while (c->iov_first < c->iov_cnt && (size_t)sent >= c->iov[c->iov_first].iov_len) {
+            sent -= c->iov[c->iov_first].iov_len;
+            c->iov_first++;
+        }
+        if (c->iov_first < c->iov_cnt) {
+            c->iov[c->iov_first].iov_base = (uint8_t *)c->iov[c->iov_first].iov_base + sent;
+            c->iov[c->iov_first].iov_len -= sent;
+        }
+    }
+
+    c->iov_first = 0;
+    c->iov_cnt = 0;
+    if (c->fb) {
+        frame_trace_last_byte(&c->trace);
+        client_frame_done(c);
+        client_release_frame(c);
+    }
+    return 0;
+}
+
+static bool client_busy(const stream_client_t *c)
+{
+    return c->iov_first < c->iov_cnt;
+}
+
+/* start sending the newest frame if the client has not had it yet */
+static void client_start_frame(stream_client_t *c)
+{
+    if (!s_current || c->frame_id == s_current_id || client_busy(c)) {
+        return;
+    }
+    if (c->frame_id && s_current_id - c->frame_id <= c->skip_ratio) {
+        return;
+    }
+    scaled_frame_t *scaled = NULL;
+    if (c->scale > 1) {
+        scaled = scaled_get(c->scale);
+        if (!scaled) {
+            return;
+        }
+    }
+    if (!frame_ring_ref(s_current)) {
+        return;
+    }
+    if (c->frame_id) {
+        c->frames_skipped += s_current_id - c->frame_id - 1;
+        atomic_fetch_add(&s_frames_skipped, s_current_id - c->frame_id - 1);
+    }
+    c->fb = s_current;
+    c->scaled = scaled;
+    if (scaled) {
+        scaled->users++;
+    }
+    c->frame_id = s_current_id;
+    frame_trace_handoff(&c->trace, c->fb);
+    c->frame_started = c->trace.handoff_us;
+    c->frame_send_us = 0;
+    c->last_progress = c->frame_started;
+    c->queue_delay_avg_us = avg_update(c->queue_delay_avg_us, c->frame_started - s_current_time);
+
+    const uint8_t *buf = scaled ? scaled->buf : c->fb->buf;
+    size_t len = scaled ? scaled->len : c->fb->len;
+    size_t hlen = snprintf(c->part, sizeof(c->part), _STREAM_PART, len, (int)c->fb->timestamp.tv_sec,
+                           (int)c->fb->timestamp.tv_usec, frame_ring_meta(c->fb)->sequence);
+    client_queue(c, _STREAM_BOUNDARY, strlen(_STREAM_BOUNDARY));
+    client_queue(c, c->part, hlen);
+    client_queue(c, buf, len);
+}
+
+/* scale=2|4|8 in the query of the request line, 1 if absent or invalid */
+static uint32_t request_scale(const char *req)
+{
+    const char *end = strchr(req, '\r');
+    const char *q = strstr(req, "scale=");
+
+    if (!q || q > end || (q[-1] != '?' && q[-1] != '&')) {
+        return 1;
+    }
+    int scale = atoi(q + strlen("scale="));
+    return scale == 2 || scale == 4 || scale == 8 ? scale : 1;
+}
+
+static void client_read(stream_client_t *c)
+{
+    if (c->state != CLIENT_REQUEST) {
+        /* nothing is expected after the request, only watch for the peer closing */
+        char discard[64];
+        ssize_t len = recv(c->fd, discard, sizeof(discard), MSG_DONTWAIT);
+        if (len == 0 || (len < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) {
+            client_close(c);
+        }
+        return;
+    }
+
+    ssize_t len = recv(c->fd, c->req + c->req_len, sizeof(c->req) - 1 - c->req_len, MSG_DONTWAIT);
+    if (len == 0 || (len < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) {
+        client_close(c);
+        return;
+    }
+    if (len < 0) {
+        return;
+    }
+    c->req_len += len;
+    c->req[c->req_len] = '\0';
+
+    if (!strstr(c->req, "\r\n\r\n")) {
+        if (c->req_len == sizeof(c->req) - 1) {
+            ESP_LOGW(TAG, "client %d: request too long", c->fd);
+            client_close(c);
+        }
+        return;
+    }
+
+    if (strncmp(c->req, "GET /stream", strlen("GET /stream")) != 0) {
+        client_queue(c, _STREAM_NOT_FOUND, strlen(_STREAM_NOT_FOUND));
+        c->state = CLIENT_CLOSING;
+        return;
+    }
+
+    c->scale = request_scale(c->req);
+    ESP_LOGI(TAG, "client %d streaming at 1/%lu", c->fd, c->scale);
+    client_queue(c, _STREAM_HTTP_HEADER, strlen(_STREAM_HTTP_HEADER));
+    c->state = CLIENT_STREAMING;
+    c->connected_at = esp_timer_get_time();
+}
+
+static void server_accept(void)
+{
+    while (true) {
+        struct sockaddr_in addr;
+        socklen_t addr_len = sizeof(addr);
+        int fd = accept(s_listen_fd, (struct sockaddr *)&addr, &addr_len);
+        if (fd < 0) {
+            return;
+        }
+
+        stream_client_t *c = NULL;
+        for (size_t i = 0; i < STREAM_MAX_CLIENTS; i++) {
+            if (s_clients[i].state == CLIENT_FREE) {
+                c = &s_clients[i];
+                break;
+            }
+        }
+        if (!c) {
+            ESP_LOGW(TAG, "too many clients, rejecting");
+            close(fd);
+            continue;
+        }
+
+        int nodelay = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+        set_nonblocking(fd);
+        c->fd = fd;
+        c->state = CLIENT_REQUEST;
+        c->last_progress = esp_timer_get_time();
+    }
+}
+
+static void server_new_frame(void)
+{
+    /* the count of wakes since the last read, only the newest frame matters */
+    uint64_t wakes;
+    read(s_wake_fd, &wakes, sizeof(wakes));
+
+    camera_fb_t *fb = frame_ring_reader_get(s_reader, 0);
+    if (!fb) {
+        return;
+    }
+    int64_t now = esp_timer_get_time();
+    if (s_current) {
+        frame_ring_return(s_current);
+        s_frame_interval_avg_us = avg_update(s_frame_interval_avg_us, now - s_current_time);
+    }
+    s_current = fb;
+    s_current_id++;
+    s_current_time = now;
+}
+
+static void server_update_stats(void)
+{
+    xSemaphoreTake(s_stats_lock, portMAX_DELAY);
+    s_stats.client_num = 0;
+    s_stats.evicted = atomic_load(&s_evicted);
+    s_stats.frame_interval_us = s_frame_interval_avg_us;
+    for (size_t i = 0; i < STREAM_MAX_CLIENTS; i++) {
+        stream_client_t *c = &s_clients[i];
+        if (c->state != CLIENT_STREAMING) {
+            continue;
+        }
+        stream_client_stats_t *st = &s_stats.clients[s_stats.client_num++];
+        st->fd = c->fd;
+        st->frames_sent = c->frames_sent;
+        st->frames_dropped = c->frames_skipped;
+        st->fps = c->deliver_avg_us ? 1000000.0f / c->deliver_avg_us : 0;
+        st->queue_delay_us = c->queue_delay_avg_us;
+        st->drain_us = c->drain_avg_us;
+        st->send_us = c->send_avg_us;
+        st->bitrate_kbps = c->deliver_avg_us ? (uint64_t)c->frame_bytes_avg * 8000 / c->deliver_avg_us : 0;
+        st->skip_ratio = c->skip_ratio;
+        st->scale = c->scale;
+        st->backlog = c->backlog;
+    }
+    atomic_store(&s_client_num, s_stats.client_num);
+    xSemaphoreGive(s_stats_lock);
+}
+
+static void stream_server_task(void *arg)
+{
+    while (true) {
+        fd_set rfds;
+        fd_set wfds;
+        int max_fd = s_listen_fd > s_wake_fd ? s_listen_fd : s_wake_fd;
+
+        FD_ZERO(&rfds);
+        FD_ZERO(&wfds);
+        FD_SET(s_listen_fd, &rfds);
+        FD_SET(s_wake_fd, &rfds);
+        for (size_t i = 0; i < STREAM_MAX_CLIENTS; i++) {
+            stream_client_t *c = &s_clients[i];
+            if (c->state == CLIENT_FREE) {
+                continue;
+            }
+            FD_SET(c->fd, &rfds);
+            if (client_busy(c)) {
+                FD_SET(c->fd, &wfds);
+            }
+            if (c->fd > max_fd) {
+                max_fd = c->fd;
+            }
+        }
+
+        struct timeval tv = { .tv_sec = 0, .tv_usec = STREAM_SELECT_MS * 1000 };
+        int ready = select(max_fd + 1, &rfds, &wfds, NULL, &tv);
+        if (ready < 0) {
+            if (errno != EINTR) {
+                ESP_LOGE(TAG, "select failed: %d", errno);
+                vTaskDelay(pdMS_TO_TICKS(100));
+            }
+            continue;
+        }
+
+        if (FD_ISSET(s_wake_fd, &rfds)) {
+            server_new_frame();
+        }
+        if (FD_ISSET(s_listen_fd, &rfds)) {
+            server_accept();
+        }
+
+        for (size_t i = 0; i < STREAM_MAX_CLIENTS; i++) {
+            stream_client_t *c = &s_clients[i];
+            int fd = c->fd;
+            if (c->state == CLIENT_FREE) {
+                continue;
+            }
+            if (FD_ISSET(fd, &rfds)) {
+                client_read(c);
+                if (c->state == CLIENT_FREE) {
+                    continue;
+                }
+            }
+            if (client_busy(c) && esp_timer_get_time() - c->last_progress > STREAM_STALL_US) {
+                ESP_LOGW(TAG, "client %d stalled with %u bytes queued, evicting", fd, c->backlog);
+                atomic_fetch_add(&s_evicted, 1);
+                client_close(c);
+                continue;
+            }
+            /* last_progress is still the time of accept, a slot is not held by a request trickling in */
+            if (c->state == CLIENT_REQUEST && esp_timer_get_time() - c->last_progress > STREAM_STALL_US) {
+                ESP_LOGW(TAG, "client %d sent no request, evicting", fd);
+                atomic_fetch_add(&s_evicted, 1);
+                client_close(c);
+                continue;
+            }
+            if (c->state == CLIENT_STREAMING) {
+                client_start_frame(c);
+            }
+            if (client_busy(c) && client_flush(c) < 0) {
+                client_close(c);
+                continue;
+            }
+            if (c->state == CLIENT_CLOSING && !client_busy(c)) {
+                client_close(c);
+            }
+        }
+
+        server_update_stats();
+    }
+}
+
+esp_err_t stream_server_start(uint16_t port)
+{
+    struct sockaddr_in addr = {
+        .sin_family = AF_INET,
+        .sin_port = htons(port),
+        .sin_addr.s_addr = htonl(INADDR_ANY),
+    };
+    int reuse = 1;
+
+    for (size_t i = 0; i < STREAM_MAX_CLIENTS; i++) {
+        s_clients[i].fd = -1;
+    }
+
+    s_stats_lock = xSemaphoreCreateMutex();
+    if (!s_stats_lock) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    s_reader = frame_ring_reader_open();
+    if (!s_reader) {
+        ESP_LOGE(TAG, "no frame reader");
+        return ESP_FAIL;
+    }
+
+    s_listen_fd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (s_listen_fd < 0) {
+        goto err;
+    }
+    setsockopt(s_listen_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    if (bind(s_listen_fd, (struct sockaddr *)&addr, sizeof(addr)) < 0
+            || listen(s_listen_fd, 4) < 0) {
+        ESP_LOGE(TAG, "listen on port %u failed: %d", port, errno);
+        goto err;
+    }
+    set_nonblocking(s_listen_fd);
+
+    /* already registered by another component is fine */
+    esp_vfs_eventfd_config_t eventfd_config = ESP_VFS_EVENTD_CONFIG_DEFAULT();
+    esp_err_t ret = esp_vfs_eventfd_register(&eventfd_config);
+    if (ret != ESP_OK && ret != ESP_ERR_INVALID_STATE) {
+        ESP_LOGE(TAG, "eventfd not available: %s", esp_err_to_name(ret));
+        goto err;
+    }
+    s_wake_fd = eventfd(0, 0);
+    if (s_wake_fd < 0) {
+        ESP_LOGE(TAG, "wake eventfd failed: %d", errno);
+        goto err;
+    }
+
+    if (frame_ring_add_listener(stream_server_wake, NULL) != ESP_OK) {
+        goto err;
+    }
+
+    metrics_register_counter("stream_frames_out_total", "Frames fully written to /stream clients", &s_frames_out);
+    metrics_register_counter("stream_bytes_out_total", "Bytes written to /stream clients", &s_bytes_out);
+    metrics_register_counter("stream_frames_skipped_total", "Frames /stream clients skipped while busy or throttled", &s_frames_skipped);
+    metrics_register_counter("stream_clients_evicted_total", "/stream clients closed because they stalled", &s_evicted);
+    metrics_register_gauge("stream_clients", "Connected /stream clients", &s_client_num);
+    metrics_register_counter("stream_frames_scaled_total", "Frames downscaled for /stream?scale= clients", &s_frames_scaled);
+    metrics_register_counter("stream_scale_failed_total", "Frames that could not be downscaled", &s_scale_failed);
+    metrics_register_histogram("stream_scale_us", "Time to downscale one frame", &s_scale_hist);
+
+    if (xTaskCreate(stream_server_task, "stream_srv", STREAM_TASK_STACK, NULL, STREAM_TASK_PRIO, NULL) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+
+err:
+    if (s_listen_fd >= 0) {
+        close(s_listen_fd);
+    }
+    if (s_wake_fd >= 0) {
+        close(s_wake_fd);
+    }
+    s_listen_fd = s_wake_fd = -1;
+    frame_ring_reader_close(s_reader);
+    return ESP_FAIL;
+}
+
+void stream_server_get_stats(stream_server_stats_t *stats)
+{
+    if (!s_stats_lock) {
+        memset(stats, 0, sizeof(*stats));
+        return;
+    }
+    xSemaphoreTake(s_stats_lock, portMAX_DELAY);
+    memcpy(stats, &s_stats, sizeof(*stats));
+    xSemaphoreGive(s_stats_lock);
+}
@@ -0,0 +1,381 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <stdatomic.h>
+#include <sys/socket.h>
+#include <sys/select.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "sdkconfig.h"
+#include "frame_ring.h"
+#include "frame_trace.h"
+#include "metrics.h"
+#include "ws_video.h"
+
+#if CONFIG_HTTPD_WS_SUPPORT
+
+static const char *TAG = "ws_video";
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+#define WS_VIDEO_MAX_CLIENTS CONFIG_WS_VIDEO_MAX_CLIENTS
+#define WS_VIDEO_TASK_STACK  3072
+#define WS_VIDEO_TASK_PRIO   5
+#define WS_VIDEO_GET_MS      1000
+#define WS_VIDEO_POLL_MS     5      /* wait for a full socket before looking for a new frame */
+#define WS_VIDEO_STALL_US    (CONFIG_STREAM_CLIENT_STALL_TIMEOUT_MS * 1000LL)
+#define WS_VIDEO_MSG_MAX     16     /* longest credit message accepted */
+#define WS_FRAME_HEAD_MAX    10     /* FIN and opcode, length, 64-bit extended length */
+#define WS_OPCODE_BINARY     0x2
+#define WS_FIN               0x80
+
+typedef struct {
+    int fd;                     /* -1 when the slot is free */
+    atomic_int credits;         /* frames the client is ready for */
+    bool closing;               /* close requested, nothing more is sent */
+    camera_fb_t *fb;            /* frame being sent, pinned until written */
+    uint8_t head[WS_FRAME_HEAD_MAX + sizeof(ws_video_header_t)];
+    size_t head_len;            /* WebSocket frame header and ws_video_header_t */
+    size_t sent;                /* bytes of head and JPEG written */
+    int64_t last_progress;      /* last time the socket took any data */
+    frame_trace_t trace;
+} ws_client_t;
+
+static httpd_handle_t s_server;
+static frame_ring_reader_t *s_reader;
+static SemaphoreHandle_t s_lock;    /* slots, taken by the sender task and the httpd task */
+static ws_client_t s_clients[WS_VIDEO_MAX_CLIENTS];
+static atomic_uint s_frames_out;
+static atomic_uint s_bytes_out;
+static atomic_uint s_frames_skipped;
+static atomic_uint s_stalled;
+
+/* with s_lock held */
+static void ws_client_release(ws_client_t *c)
+{
+    frame_ring_return(c->fb);
+    c->fb = NULL;
+    c->closing = false;
+    atomic_store(&c->credits, 0);
+    c->fd = -1;
+}
+
+/* with s_lock held; the session is closed by the httpd task, which calls ws_video_session_closed() */
+static void ws_client_close(ws_client_t *c)
+{
+    if (!c->closing) {
+        c->closing = true;
+        frame_ring_return(c->fb);
+        c->fb = NULL;
+        httpd_sess_trigger_close(s_server, c->fd);
+    }
+}
+
+/*
+ * Write as much of the frame as the socket takes without blocking. The
+ * server builds the WebSocket frame itself, one unmasked binary frame per
+ * JPEG, and nothing else writes to the socket once the handshake is done:
+ * control frames reach ws_video_handler() instead of being answered by httpd.
+ */
+static void ws_client_flush(ws_client_t *c)
+{
+    size_t total = c->head_len + c->fb->len;
+
+    while (c->sent < total) {
+        struct iovec iov[2];
+        struct msghdr msg = {
+            .msg_iov = iov,
+        };
+        if (c->sent < c->head_len) {
+            iov[0].iov_base = c->head + c->sent;
+            iov[0].iov_len = c->head_len - c->sent;
+            iov[1].iov_base = c->fb->buf;
+            iov[1].iov_len = c->fb->len;
+            msg.msg_iovlen = 2;
+        } else {
+            iov[0].iov_base = c->fb->buf + (c->sent - c->head_len);
+            iov[0].iov_len = total - c->sent;
+            msg.msg_iovlen = 1;
+        }
+        ssize_t sent = sendmsg(c->fd, &msg, MSG_DONTWAIT | MSG_NOSIGNAL);
+        if (sent < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                ESP_LOGW(TAG, "client %d: send failed, closing", c->fd);
+                ws_client_close(c);
+            }
+            return;
+        }
+        if (sent > 0 && !c->sent) {
+            frame_trace_first_byte(&c->trace);
+        }
+        c->sent += sent;
+        c->last_progress = esp_timer_get_time();
+        atomic_fetch_add(&s_bytes_out, sent);
+    }
+
+    frame_trace_last_byte(&c->trace);
+    atomic_fetch_add(&s_frames_out, 1);
+    frame_ring_return(c->fb);
+    c->fb = NULL;
+}
+
+/* queue the frame for a client with a credit and nothing in flight, with s_lock held */
+static void ws_client_start(ws_client_t *c, camera_fb_t *fb)
+{
+    const frame_ring_meta_t *meta = frame_ring_meta(fb);
+    ws_video_header_t header = {
+        .sequence = meta->sequence,
+        .size = fb->len,
+        .captured_us = meta->captured_us,
+    };
+    uint64_t len = sizeof(header) + fb->len;
+    size_t n = 0;
+
+    c->fb = frame_ring_ref(fb);
+    if (!c->fb) {
+        return;
+    }
+    c->head[n++] = WS_FIN | WS_OPCODE_BINARY;
+    if (len < 126) {
+        c->head[n++] = len;
+    } else if (len <= 0xFFFF) {
+        c->head[n++] = 126;
+        c->head[n++] = len >> 8;
+        c->head[n++] = len;
+    } else {
+        c->head[n++] = 127;
+        for (int shift = 56; shift >= 0; shift -= 8) {
+            c->head[n++] = len >> shift;
+        }
+    }
+    memcpy(c->head + n, &header, sizeof(header));
+    c->head_len = n + sizeof(header);
+    c->sent = 0;
+    c->last_progress = esp_timer_get_time();
+    frame_trace_handoff(&c->trace, fb);
+    atomic_fetch_sub(&c->credits, 1);
+}
+
+/* hand a new frame to the idle clients with credits and write what the sockets take */
+static bool ws_video_service(camera_fb_t *fb)
+{
+    int64_t now = esp_timer_get_time();
+    bool pending = false;
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    for (size_t i = 0; i < WS_VIDEO_MAX_CLIENTS; i++) {
+        ws_client_t *c = &s_clients[i];
+        if (c->fd < 0 || c->closing) {
+            continue;
+        }
+        if (fb && !c->fb) {
+            if (atomic_load(&c->credits) > 0) {
+                ws_client_start(c, fb);
+            } else {
+                atomic_fetch_add(&s_frames_skipped, 1);
+            }
+        }
+        if (!c->fb) {
+            continue;
+        }
+        ws_client_flush(c);
+        if (c->fb && now - c->last_progress > WS_VIDEO_STALL_US) {
+            ESP_LOGW(TAG, "client %d stalled, closing", c->fd);
+            atomic_fetch_add(&s_stalled, 1);
+            ws_client_close(c);
+        }
+        pending = pending || c->fb;
+    }
+    xSemaphoreGive(s_lock);
+    return pending;
+}
+
+/* wait until a socket with a frame in flight can take more, or WS_VIDEO_POLL_MS passed */
+static void ws_video_wait_writable(void)
+{
+    fd_set wfds;
+    int max_fd = -1;
+    struct timeval tv = {
+        .tv_usec = WS_VIDEO_POLL_MS * 1000,
+    };
+
+    FD_ZERO(&wfds);
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    for (size_t i = 0; i < WS_VIDEO_MAX_CLIENTS; i++) {
+        ws_client_t *c = &s_clients[i];
+        if (c->fd >= 0 && c->fb) {
+            FD_SET(c->fd, &wfds);
+            max_fd = c->fd > max_fd ? c->fd : max_fd;
+        }
+    }
+    xSemaphoreGive(s_lock);
+    /* a socket closed meanwhile makes select() return early, which is what is wanted */
+    select(max_fd + 1, NULL, &wfds, NULL, &tv);
+}
+
+static void ws_video_task(void *arg)
+{
+    bool pending = false;
+
+    while (true) {
+        if (pending) {
+            ws_video_wait_writable();
+        }
+        camera_fb_t *fb = frame_ring_reader_get(s_reader, pending ? 0 : pdMS_TO_TICKS(WS_VIDEO_GET_MS));
+        pending = ws_video_service(fb);
+        frame_ring_return(fb);
+    }
+}
+
+void ws_video_session_closed(int fd)
+{
+    if (!s_lock) {
+        return;
+    }
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    for (size_t i = 0; i < WS_VIDEO_MAX_CLIENTS; i++) {
+        if (s_clients[i].fd == fd) {
+            ESP_LOGI(TAG, "client %d gone", fd);
+            ws_client_release(&s_clients[i]);
+        }
+    }
+    xSemaphoreGive(s_lock);
+}
+
+static esp_err_t ws_client_open(int fd)
+{
+    esp_err_t ret = ESP_ERR_NO_MEM;
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    for (size_t i = 0; i < WS_VIDEO_MAX_CLIENTS; i++) {
+        ws_client_t *c = &s_clients[i];
+        if (c->fd < 0) {
+            c->fd = fd;
+            atomic_store(&c->credits, 0);
+            ret = ESP_OK;
+            break;
+        }
+    }
+    xSemaphoreGive(s_lock);
+    return ret;
+}
+
+/* add credits, capped at WS_VIDEO_MAX_CREDITS */
+static void ws_client_grant(int fd, int grant)
+{
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    for (size_t i = 0; i < WS_VIDEO_MAX_CLIENTS; i++) {
+        ws_client_t *c = &s_clients[i];
+        if (c->fd != fd) {
+            continue;
+        }
+        int credits = atomic_load(&c->credits);
+        int capped;
+        do {
+            capped = credits + grant > WS_VIDEO_MAX_CREDITS ? WS_VIDEO_MAX_CREDITS : credits + grant;
+        } while (!atomic_compare_exchange_weak(&c->credits, &credits, capped));
+    }
+    xSemaphoreGive(s_lock);
+}
+
+static esp_err_t ws_video_handler(httpd_req_t *req)
+{
+    int fd = httpd_req_to_sockfd(req);
+
+    if (req->method == HTTP_GET) {
+        /* handshake sent; a closed socket left its slot in ws_video_session_closed() */
+        if (ws_client_open(fd) != ESP_OK) {
+            ESP_LOGW(TAG, "too many clients, rejecting %d", fd);
+            return ESP_FAIL;
+        }
+        ESP_LOGI(TAG, "client %d connected", fd);
+        return ESP_OK;
+    }
+
+    uint8_t buf[WS_VIDEO_MSG_MAX + 1] = { 0 };
+    httpd_ws_frame_t pkt = {
+        .payload = buf,
+    };
+    esp_err_t ret = httpd_ws_recv_frame(req, &pkt, 0);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    if (pkt.len > WS_VIDEO_MSG_MAX) {
+        ESP_LOGW(TAG, "client %d: message of %u bytes ignored", fd, pkt.len);
+        return ESP_FAIL;
+    }
+    ret = httpd_ws_recv_frame(req, &pkt, WS_VIDEO_MSG_MAX);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    /* a pong or close frame from httpd could land inside a JPEG being written */
+    if (pkt.type == HTTPD_WS_TYPE_CLOSE) {
+        return ESP_FAIL;
+    }
+    if (pkt.type != HTTPD_WS_TYPE_TEXT) {
+        return ESP_OK;
+    }
+
+    int grant = atoi((const char *)buf);
+    if (grant > 0) {
+        ws_client_grant(fd, grant);
+    }
+    return ESP_OK;
+}
+
+esp_err_t ws_video_register(httpd_handle_t server)
+{
+    httpd_uri_t ws_uri = {
+        .uri = "/ws/video",
+        .method = HTTP_GET,
+        .handler = ws_video_handler,
+        .user_ctx = NULL,
+        .is_websocket = true,
+        .handle_ws_control_frames = true,
+    };
+
+    for (size_t i = 0; i < WS_VIDEO_MAX_CLIENTS; i++) {
+        s_clients[i].fd = -1;
+    }
+    s_server = server;
+
+    s_lock = xSemaphoreCreateMutex();
+    if (!s_lock) {
+        return ESP_ERR_NO_MEM;
+    }
+    s_reader = frame_ring_reader_open();
+    if (!s_reader) {
+        ESP_LOGE(TAG, "no frame reader");
+        return ESP_FAIL;
+    }
+    if (httpd_register_uri_handler(server, &ws_uri) != ESP_OK) {
+        frame_ring_reader_close(s_reader);
+        return ESP_FAIL;
+    }
+
+    metrics_register_counter("ws_frames_out_total", "Frames sent to /ws/video clients", &s_frames_out);
+    metrics_register_counter("ws_bytes_out_total", "Bytes sent to /ws/video clients", &s_bytes_out);
+    metrics_register_counter("ws_frames_skipped_total", "Frames /ws/video clients had no credit for", &s_frames_skipped);
+    metrics_register_counter("ws_clients_stalled_total", "/ws/video clients closed for taking no data", &s_stalled);
+
+    if (xTaskCreate(ws_video_task, "ws_video", WS_VIDEO_TASK_STACK, NULL, WS_VIDEO_TASK_PRIO, NULL) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+#endif /* CONFIG_HTTPD_WS_SUPPORT */
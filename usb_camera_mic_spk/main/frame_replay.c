@@ -0,0 +1,124 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_random.h"
+#include "sdkconfig.h"
+#include "frame_replay.h"
+
+static const char *TAG = "frame_replay";
+
+#define REPLAY_WIDTH        320
+#define REPLAY_HEIGHT       240
+#define COM_PAYLOAD_MAX     (0xFFFF - 2)    /* segment length field counts itself */
+#define COM_HEADER_SIZE     4               /* FF FE + 16 bit length */
+
+extern const uint8_t replay_jpeg_320_240[];
+extern const uint32_t replay_jpeg_size;
+
+typedef struct {
+    uvc_frame_callback_t *cb;
+    void *arg;
+    uint8_t *buf;
+    size_t buf_size;
+} replay_ctx_t;
+
+static size_t put_com(uint8_t *p, const char *text, size_t len)
+{
+    p[0] = 0xFF;
+    p[1] = 0xFE;
+    p[2] = (len + 2) >> 8;
+    p[3] = (len + 2) & 0xFF;
+    if (text) {
+        memcpy(p + COM_HEADER_SIZE, text, len);
+    } else {
+        memset(p + COM_HEADER_SIZE, 0, len);
+    }
+    return COM_HEADER_SIZE + len;
+}
+
+/* SOI, one COM with the sequence number, COM padding, then the rest of the JPEG */
+static size_t build_frame(replay_ctx_t *ctx, uint32_t seq, size_t target)
+{
+    uint8_t *p = ctx->buf;
+    char text[24];
+    size_t text_len = snprintf(text, sizeof(text), "seq=%u", (unsigned)seq);
+
+    p[0] = 0xFF;
+    p[1] = 0xD8;
+    p += 2;
+    p += put_com(p, text, text_len);
+
+    size_t len = (p - ctx->buf) + replay_jpeg_size - 2;
+    while (len + COM_HEADER_SIZE < target) {
+        size_t pad = target - len - COM_HEADER_SIZE;
+        if (pad > COM_PAYLOAD_MAX) {
+            pad = COM_PAYLOAD_MAX;
+        }
+        p += put_com(p, NULL, pad);
+        len += COM_HEADER_SIZE + pad;
+    }
+
+    memcpy(p, replay_jpeg_320_240 + 2, replay_jpeg_size - 2);
+    return len;
+}
+
+static void replay_task(void *arg)
+{
+    replay_ctx_t *ctx = (replay_ctx_t *)arg;
+    const uint32_t span = CONFIG_FRAME_REPLAY_SIZE_MAX - CONFIG_FRAME_REPLAY_SIZE_MIN + 1;
+    TickType_t last_wake = xTaskGetTickCount();
+    uint32_t seq = 0;
+
+    while (1) {
+        size_t target = CONFIG_FRAME_REPLAY_SIZE_MIN + esp_random() % span;
+        uvc_frame_t frame = {
+            .data = ctx->buf,
+            .data_bytes = build_frame(ctx, seq, target),
+            .width = REPLAY_WIDTH,
+            .height = REPLAY_HEIGHT,
+            .frame_format = UVC_FRAME_FORMAT_MJPEG,
+            .sequence = seq++,
+        };
+        ctx->cb(&frame, ctx->arg);
+        vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(1000 / CONFIG_FRAME_REPLAY_FPS));
+    }
+}
+
+esp_err_t frame_replay_start(uvc_frame_callback_t *cb, void *arg)
+{
+    if (cb == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    replay_ctx_t *ctx = calloc(1, sizeof(replay_ctx_t));
+    if (ctx == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    /* worst case: the sequence COM plus one extra padding header */
+    ctx->buf_size = CONFIG_FRAME_REPLAY_SIZE_MAX + replay_jpeg_size + 3 * COM_HEADER_SIZE + 24;
+    ctx->buf = malloc(ctx->buf_size);
+    ctx->cb = cb;
+    ctx->arg = arg;
+    if (ctx->buf == NULL) {
+        free(ctx);
+        return ESP_ERR_NO_MEM;
+    }
+
+    if (xTaskCreate(replay_task, "frame_replay", 3 * 1024, ctx, 5, NULL) != pdPASS) {
+        free(ctx->buf);
+        free(ctx);
+        return ESP_ERR_NO_MEM;
+    }
+    ESP_LOGI(TAG, "Replaying %ux%u MJPEG at %d fps, %d..%d bytes", REPLAY_WIDTH, REPLAY_HEIGHT,
+             CONFIG_FRAME_REPLAY_FPS, CONFIG_FRAME_REPLAY_SIZE_MIN, CONFIG_FRAME_REPLAY_SIZE_MAX);
+    return ESP_OK;
+}
@@ -0,0 +1,41 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Synthetic MJPEG source
+ *
+ * Stands in for the UVC camera when measuring the HTTP pipeline: a task hands
+ * an embedded JPEG to the frame callback at CONFIG_FRAME_REPLAY_FPS. Each
+ * frame is padded with COM segments to a size drawn uniformly from
+ * [CONFIG_FRAME_REPLAY_SIZE_MIN, CONFIG_FRAME_REPLAY_SIZE_MAX] and carries its
+ * sequence number, so it stays a valid JPEG of realistic size.
+ */
+
+#pragma once
+
+#include "esp_err.h"
+#include "usb_stream.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Start the replay task.
+ *
+ * @param cb  Called with every synthetic frame, from the replay task
+ * @param arg Passed to cb
+ *
+ * @return
+ *     - ESP_OK on success
+ *     - ESP_ERR_INVALID_ARG if cb is NULL
+ *     - ESP_ERR_NO_MEM if the frame buffer or task could not be allocated
+ */
+esp_err_t frame_replay_start(uvc_frame_callback_t *cb, void *arg);
+
+#ifdef __cplusplus
+}
+#endif
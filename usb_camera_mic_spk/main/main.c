@@ -21,6 +21,8 @@
  #include "freertos/task.h"
  #include "esp_err.h"
  #include "esp_log.h"
+ #include "esp_timer.h"
+ #include "esp_random.h"
  #include "usb_stream.h"
  
  static const char *TAG = "uvc_mic_spk_demo";
@@ -35,7 +37,7 @@
  #endif
  
  #if (ENABLE_UAC_MIC_SPK_FUNCTION)
- #define ENABLE_UAC_MIC_SPK_LOOPBACK       0        /* 将麦克风数据传输到扬声器（回环模式） */
+ #define ENABLE_UAC_MIC_SPK_LOOPBACK       0        /* 将麦克风数据混入扬声器（回环音源） */
  
  /* 音频参数全局变量 */
  static uint32_t s_mic_samples_frequence = 0;      /* 麦克风采样频率 */
@@ -44,12 +46,27 @@
  static uint32_t s_spk_samples_frequence = 0;      /* 扬声器采样频率 */
  static uint32_t s_spk_ch_num = 0;                 /* 扬声器声道数 */
  static uint32_t s_spk_bit_resolution = 0;         /* 扬声器位分辨率 */
+ 
+ #include "mic_ring.h"
+ #include "pcm_convert.h"
+ #include "prompt_store.h"
+ #include "prompt_assets.h"
+ #include "mixer.h"
+ #include "mixer_sources.h"
+ 
+ #if (ENABLE_UVC_WIFI_XFER && CONFIG_HTTPD_WS_SUPPORT)
+ #define ENABLE_UAC_SPK_NETWORK            1        /* 将 /ws/speaker 收到的网络音频混入扬声器 */
+ #include "speaker_ws.h"
+ #else
+ #define ENABLE_UAC_SPK_NETWORK            0
+ #endif
+ 
+ #define SPK_BUF_SIZE            16000   /* usb_stream扬声器缓冲区大小 */
+ #define MIXER_PERIOD_MS         10      /* 混音周期：每10毫秒混音一次并写入扬声器 */
+ #define SPK_TONE_AMPLITUDE      3277    /* 测试音峰值，-20 dBFS */
  #endif
  
  /* 事件组位定义 - 用于线程间同步 */
- #define BIT0_FRAME_START     (0x01 << 0)    /* 帧开始位 */
- #define BIT1_NEW_FRAME_START (0x01 << 1)    /* 新帧开始位 */
- #define BIT2_NEW_FRAME_END   (0x01 << 2)    /* 新帧结束位 */
  #define BIT3_SPK_START       (0x01 << 3)    /* 扬声器启动位 */
  #define BIT4_SPK_RESET       (0x01 << 4)    /* 扬声器重置位 */
  
@@ -75,30 +92,10 @@
  #include "app_wifi.h"
  #include "app_httpd.h"
  #include "esp_camera.h"
- 
- /* 摄像头帧缓冲区结构体 */
- static camera_fb_t s_fb = {0};
- 
- /**
-  * @brief 获取摄像头帧缓冲区 - ESP-Camera兼容接口
-  * @return 返回帧缓冲区指针
-  */
- camera_fb_t *esp_camera_fb_get()
- {
-     xEventGroupSetBits(s_evt_handle, BIT0_FRAME_START);    /* 设置帧开始标志 */
-     xEventGroupWaitBits(s_evt_handle, BIT1_NEW_FRAME_START, true, true, portMAX_DELAY);    /* 等待新帧开始 */
-     return &s_fb;
- }
- 
- /**
-  * @brief 返回摄像头帧缓冲区 - ESP-Camera兼容接口
-  * @param fb 帧缓冲区指针
-  */
- void esp_camera_fb_return(camera_fb_t *fb)
- {
-     xEventGroupSetBits(s_evt_handle, BIT2_NEW_FRAME_END);    /* 设置帧结束标志 */
-     return;
- }
+ #include "frame_ring.h"
+ #if CONFIG_FRAME_REPLAY_ENABLE
+ #include "frame_replay.h"
+ #endif
  
  /**
   * @brief 摄像头帧回调函数 - 处理UVC视频帧
@@ -107,27 +104,18 @@
   */
  static void camera_frame_cb(uvc_frame_t *frame, void *ptr)
  {
+     int64_t captured_us = esp_timer_get_time();    /* 回调即在USB传输完成一帧后调用，作为帧的采集时间 */
+     
+ #if CONFIG_FRAME_LOG_ENABLE    /* 逐帧日志会占用帧路径上的CPU时间，默认关闭，统计数据见 /metrics */
      ESP_LOGI(TAG, "UVC回调触发! 帧格式 = %d, 序列号 = %"PRIu32", 宽度 = %"PRIu32", 高度 = %"PRIu32", 数据长度 = %u, 指针 = %d",
               frame->frame_format, frame->sequence, frame->width, frame->height, frame->data_bytes, (int) ptr);
+ #endif
      
-     /* 检查是否处于帧处理状态 */
-     if (!(xEventGroupGetBits(s_evt_handle) & BIT0_FRAME_START)) {
-         return;
-     }
- 
      switch (frame->frame_format) {
-     case UVC_FRAME_FORMAT_MJPEG:    /* MJPEG格式处理 */
-         s_fb.buf = frame->data;                    /* 设置缓冲区指针 */
-         s_fb.len = frame->data_bytes;              /* 设置数据长度 */
-         s_fb.width = frame->width;                 /* 设置帧宽度 */
-         s_fb.height = frame->height;               /* 设置帧高度 */
-         s_fb.buf = frame->data;                    /* 设置缓冲区指针 */
-         s_fb.format = PIXFORMAT_JPEG;              /* 设置像素格式为JPEG */
-         s_fb.timestamp.tv_sec = frame->sequence;   /* 设置时间戳 */
-         xEventGroupSetBits(s_evt_handle, BIT1_NEW_FRAME_START);    /* 设置新帧开始标志 */
-         ESP_LOGV(TAG, "发送帧 = %"PRIu32"", frame->sequence);
-         xEventGroupWaitBits(s_evt_handle, BIT2_NEW_FRAME_END, true, true, portMAX_DELAY);    /* 等待帧处理完成 */
-         ESP_LOGV(TAG, "发送帧完成 = %"PRIu32"", frame->sequence);
+     case UVC_FRAME_FORMAT_MJPEG:    /* MJPEG格式处理：拷贝到环形缓冲区，广播给所有读取者 */
+         if (frame_ring_push(frame->data, frame->data_bytes, frame->width, frame->height, frame->sequence, captured_us) != ESP_OK) {
+             ESP_LOGV(TAG, "丢弃帧 = %"PRIu32"", frame->sequence);
+         }
          break;
      default:
          ESP_LOGW(TAG, "不支持的帧格式");
@@ -161,9 +149,213 @@
      ESP_LOGD(TAG, "麦克风回调! 位分辨率 = %u, 采样频率 = %"PRIu32", 数据字节数 = %"PRIu32,
                  frame->bit_resolution, frame->samples_frequence, frame->data_bytes);
      // 麦克风回调中永远不应该阻塞！
+     mic_ring_write(frame->data, frame->data_bytes);    /* 无锁写入麦克风环形缓冲区，各消费者（/audio、回环）通过各自的读取者读取 */
+ }
+ 
  #if (ENABLE_UAC_MIC_SPK_LOOPBACK)
-     uac_spk_streaming_write(frame->data, frame->data_bytes, 0);    /* 回环模式：直接写入扬声器 */
+ #define LOOPBACK_BUF_SIZE    1920   /* 每次读取的最大字节数：240帧32位立体声，声道更多时帧数相应减少 */
+ 
+ /* 回环音源：混音器的读取回调，取出麦克风环形缓冲区中已到达的帧 */
+ typedef struct {
+     mic_ring_reader_t *reader;
+     uint32_t sample_rate;       /* 混音采样率 */
+     uint32_t channels;          /* 混音声道数 */
+     pcm_dither_t dither;
+     uint8_t buf[LOOPBACK_BUF_SIZE];
+ } loopback_source_t;
+ 
+ /**
+  * @brief 回环音源读取回调 - 从麦克风环形缓冲区读取数据，转换为混音格式（16位，扬声器声道数）
+  * @param ctx 回环音源
+  * @param out 混音格式的帧
+  * @param frames 需要的帧数
+  * @return 读取的帧数，不足部分由混音器补静音
+  */
+ static size_t loopback_read(void *ctx, int16_t *out, size_t frames)
+ {
+     loopback_source_t *loopback = (loopback_source_t *)ctx;
+     mic_ring_format_t mic_format;
+     mic_ring_get_format(&mic_format);
+     pcm_format_t in_format = { .bits = mic_format.bit_resolution, .channels = mic_format.ch_num };
+     const pcm_format_t out_format = { .bits = 16, .channels = loopback->channels };
+     size_t frame_bytes = pcm_frame_bytes(&in_format);
+     
+     /* 麦克风未连接，或采样率与扬声器不同（回环不做重采样） */
+     if (!frame_bytes || mic_format.samples_frequence != loopback->sample_rate) {
+         return 0;
+     }
+     size_t done = 0;
+     while (done < frames) {
+         size_t n = frames - done;
+         if (n > LOOPBACK_BUF_SIZE / frame_bytes) {
+             n = LOOPBACK_BUF_SIZE / frame_bytes;
+         }
+         /* 不等待：没有新数据时本周期其余部分为静音，麦克风环形缓冲区只交付整帧 */
+         n = mic_ring_read(loopback->reader, loopback->buf, n * frame_bytes, 0) / frame_bytes;
+         /* 声道按默认映射：相同声道数一一对应，单声道复制到所有声道，多声道到单声道取平均 */
+         if (!n || pcm_convert(loopback->buf, &in_format, out + done * loopback->channels, &out_format, n, &loopback->dither) != ESP_OK) {
+             break;
+         }
+         done += n;
+     }
+     return done;
+ }
  #endif //ENABLE_UAC_MIC_SPK_LOOPBACK
+ 
+ /**
+  * @brief 扬声器混音任务 - 扬声器启动后按其格式创建混音器并注册各音源（提示音、麦克风回环、测试音、网络音频），
+  *        每个周期混音一次，转换为扬声器位宽后写入扬声器；写入阻塞，由扬声器的消耗速度控制节奏
+  * @param arg 未使用
+  */
+ static void speaker_mixer_task(void *arg)
+ {
+     while (1) {
+         xEventGroupWaitBits(s_evt_handle, BIT3_SPK_START, true, false, portMAX_DELAY);
+         
+         /* 混音格式为16位，声道数和采样率与扬声器相同，8位时写入前加TPDF抖动 */
+         const pcm_format_t mix_format = { .bits = 16, .channels = s_spk_ch_num };
+         const pcm_format_t spk_format = { .bits = s_spk_bit_resolution, .channels = s_spk_ch_num };
+         /* 转换0帧只检查格式：不支持的位宽或声道数不播放，扬声器保持挂起，等待下一次连接 */
+         if (pcm_convert(NULL, &mix_format, NULL, &spk_format, 0, NULL) != ESP_OK) {
+             ESP_LOGE(TAG, "不支持的扬声器格式: 声道数 = %"PRIu32", 位分辨率 = %"PRIu32"，不播放",
+                      s_spk_ch_num, s_spk_bit_resolution);
+             continue;
+         }
+         pcm_dither_t dither;
+         pcm_dither_init(&dither, esp_random());
+         
+         /* 每个周期的帧数：MIXER_PERIOD_MS毫秒，且不超过扬声器缓冲区的四分之一，写入阻塞时缓冲区中仍有几个周期的数据 */
+         size_t period = MIXER_PERIOD_MS * s_spk_samples_frequence / 1000;
+         if (period * pcm_frame_bytes(&spk_format) > SPK_BUF_SIZE / 4) {
+             period = SPK_BUF_SIZE / 4 / pcm_frame_bytes(&spk_format);
+         }
+         
+         mixer_config_t mixer_config = {
+             .sample_rate = s_spk_samples_frequence,
+             .channels = s_spk_ch_num,
+             .attack_ms = 20,        /* 提示音开始时其他音源在20毫秒内压低 */
+             .release_ms = 300,      /* 提示音结束后在300毫秒内恢复 */
+         };
+         mixer_t *mixer = NULL;
+         esp_err_t ret = mixer_create(&mixer_config, &mixer);
+         if (ret != ESP_OK) {
+             ESP_LOGE(TAG, "创建混音器失败: %s，不播放", esp_err_to_name(ret));
+             continue;
+         }
+         
+         /* 提示音：以IMA ADPCM保存，播放时直接从flash逐块解码并重采样到扬声器采样率，播放完毕静音1秒后重播 */
+         const prompt_t *prompt = prompt_store_find(CONFIG_PROMPT_PLAY_NAME);
+         if (!prompt) {
+             ESP_LOGW(TAG, "没有提示音 %s，播放默认提示音", CONFIG_PROMPT_PLAY_NAME);
+             prompt = prompt_store_find("default");
+         }
+         mixer_prompt_config_t prompt_config = {
+             .prompt = prompt,
+             .sample_rate = s_spk_samples_frequence,
+             .channels = s_spk_ch_num,
+             .loop = true,
+             .gap_ms = 1000,
+         };
+         mixer_prompt_t *prompt_player = NULL;
+         ret = mixer_prompt_create(&prompt_config, &prompt_player);
+         if (ret != ESP_OK) {
+             ESP_LOGE(TAG, "创建提示音播放器失败: %s，不播放", esp_err_to_name(ret));
+             mixer_delete(mixer);
+             continue;
+         }
+         mixer_source_config_t prompt_source = MIXER_SOURCE_CONFIG_DEFAULT();
+         prompt_source.name = "prompt";
+         prompt_source.read = mixer_prompt_read;
+         prompt_source.ctx = prompt_player;
+         prompt_source.ducks = true;    /* 播放提示音时压低其他音源 */
+         ESP_ERROR_CHECK(mixer_add_source(mixer, &prompt_source, NULL));
+         ESP_LOGI(TAG, "开始播放提示音 %s", prompt->name);
+         
+         /* 手动恢复扬声器，因为设置了SUSPEND_AFTER_START标志 */
+         ESP_ERROR_CHECK(usb_streaming_control(STREAM_UAC_SPK, CTRL_RESUME, NULL));
+         usb_streaming_control(STREAM_UAC_SPK, CTRL_UAC_VOLUME, (void *)80);    /* 设置扬声器音量 */
+         usb_streaming_control(STREAM_UAC_MIC, CTRL_UAC_VOLUME, (void *)80);    /* 设置麦克风音量 */
+         ESP_LOGI(TAG, "扬声器已恢复");
+         
+ #if (ENABLE_UAC_MIC_SPK_LOOPBACK)
+         /* 麦克风回环：提示音播放时压低12dB */
+         loopback_source_t *loopback = (loopback_source_t *)calloc(1, sizeof(loopback_source_t));
+         assert(loopback != NULL);
+         loopback->reader = mic_ring_reader_open();
+         loopback->sample_rate = s_spk_samples_frequence;
+         loopback->channels = s_spk_ch_num;
+         pcm_dither_init(&loopback->dither, esp_random());
+         mixer_source_config_t loopback_source = MIXER_SOURCE_CONFIG_DEFAULT();
+         loopback_source.name = "loopback";
+         loopback_source.read = loopback_read;
+         loopback_source.ctx = loopback;
+         loopback_source.duck_gain = mixer_gain_from_db(-12);
+         ESP_ERROR_CHECK(mixer_add_source(mixer, &loopback_source, NULL));
+ #endif
+         
+ #if CONFIG_SPK_TONE_FREQ
+         /* 测试音：-20 dBFS正弦波，提示音播放时同样压低12dB */
+         mixer_tone_t tone;
+         mixer_tone_init(&tone, s_spk_samples_frequence, s_spk_ch_num, CONFIG_SPK_TONE_FREQ, SPK_TONE_AMPLITUDE);
+         mixer_source_config_t tone_source = MIXER_SOURCE_CONFIG_DEFAULT();
+         tone_source.name = "tone";
+         tone_source.read = mixer_tone_read;
+         tone_source.ctx = &tone;
+         tone_source.duck_gain = mixer_gain_from_db(-12);
+         ESP_ERROR_CHECK(mixer_add_source(mixer, &tone_source, NULL));
+ #endif
+         
+ #if (ENABLE_UAC_SPK_NETWORK)
+         /* 网络音频：/ws/speaker 收到的音频经自适应抖动缓冲后转换为扬声器格式，播放时与提示音一样压低回环和测试音 */
+         speaker_ws_output_t *network = NULL;
+         if (speaker_ws_output_create(s_spk_samples_frequence, s_spk_ch_num, &network) == ESP_OK) {
+             mixer_source_config_t network_source = MIXER_SOURCE_CONFIG_DEFAULT();
+             network_source.name = "network";
+             network_source.read = speaker_ws_read;
+             network_source.ctx = network;
+             network_source.ducks = true;
+             ESP_ERROR_CHECK(mixer_add_source(mixer, &network_source, NULL));
+         } else {
+             ESP_LOGW(TAG, "网络音频不可用，/ws/speaker 未注册");
+         }
+ #endif
+         
+         int16_t *mix_buffer = (int16_t *)malloc(period * pcm_frame_bytes(&mix_format));    /* 混音缓冲区 */
+         uint8_t *spk_buffer = (uint8_t *)malloc(period * pcm_frame_bytes(&spk_format));    /* 扬声器格式缓冲区 */
+         assert(mix_buffer != NULL && spk_buffer != NULL);
+         
+         while (1) {
+             mixer_mix(mixer, mix_buffer, period);
+             void *data = mix_buffer;
+             if (s_spk_bit_resolution != 16) {
+                 /* 按扬声器位宽转换，声道数相同；格式已在开始时检查 */
+                 ESP_ERROR_CHECK(pcm_convert(mix_buffer, &mix_format, spk_buffer, &spk_format, period, &dither));
+                 data = spk_buffer;
+             }
+             // 写入USB扬声器
+             uac_spk_streaming_write(data, period * pcm_frame_bytes(&spk_format), pdMS_TO_TICKS(1000));
+             
+             /* 检查是否需要重置扬声器 */
+             if (xEventGroupGetBits(s_evt_handle) & (BIT4_SPK_RESET | BIT3_SPK_START)) {
+                 // 发生断开连接，我们可能需要重置扬声器的频率
+                 xEventGroupClearBits(s_evt_handle, BIT4_SPK_RESET);
+                 break;
+             }
+         }
+         
+         /* 音源不归混音器所有，删除混音器后再释放 */
+         mixer_delete(mixer);
+         mixer_prompt_delete(prompt_player);
+ #if (ENABLE_UAC_SPK_NETWORK)
+         speaker_ws_output_delete(network);    /* 结束正在播放的网络音频流 */
+ #endif
+ #if (ENABLE_UAC_MIC_SPK_LOOPBACK)
+         mic_ring_reader_close(loopback->reader);
+         free(loopback);
+ #endif
+         free(mix_buffer);
+         free(spk_buffer);
+     }
  }
  #endif //ENABLE_UAC_MIC_SPK_FUNCTION
  
@@ -211,11 +403,18 @@
              s_mic_samples_frequence = mic_frame_list[frame_index].samples_frequence;
              s_mic_ch_num = mic_frame_list[frame_index].ch_num;
              s_mic_bit_resolution = mic_frame_list[frame_index].bit_resolution;
-             if (s_mic_ch_num != 1) {
-                 ESP_LOGW(TAG, "UAC麦克风: 此示例仅支持1声道");
+             if (s_mic_ch_num > PCM_CHANNELS_MAX) {
+                 ESP_LOGW(TAG, "UAC麦克风: 此示例最多支持%d声道", PCM_CHANNELS_MAX);
              }
              ESP_LOGI(TAG, "UAC麦克风: 使用帧[%u] 声道数 = %"PRIu32", 位分辨率 = %"PRIu32", 采样频率 = %"PRIu32,
                      frame_index, s_mic_ch_num, s_mic_bit_resolution, s_mic_samples_frequence);
+             /* 通知 /audio 当前采样格式 */
+             mic_ring_format_t mic_format = {
+                 .samples_frequence = s_mic_samples_frequence,
+                 .bit_resolution = s_mic_bit_resolution,
+                 .ch_num = s_mic_ch_num,
+             };
+             mic_ring_set_format(&mic_format);
              free(mic_frame_list);
          } else {
              ESP_LOGW(TAG, "UAC麦克风: 获取帧列表大小 = %u", frame_size);
@@ -246,8 +445,8 @@
                  s_spk_bit_resolution = spk_frame_list[frame_index].bit_resolution;
              }
              xEventGroupSetBits(s_evt_handle, BIT3_SPK_START);    /* 设置扬声器启动标志 */
-             if (s_spk_ch_num != 1) {
-                 ESP_LOGW(TAG, "UAC扬声器: 此示例仅支持1声道");
+             if (s_spk_ch_num > PCM_CHANNELS_MAX) {
+                 ESP_LOGW(TAG, "UAC扬声器: 此示例最多支持%d声道", PCM_CHANNELS_MAX);
              }
              ESP_LOGI(TAG, "UAC扬声器: 使用帧[%u] 声道数 = %"PRIu32", 位分辨率 = %"PRIu32", 采样频率 = %"PRIu32,
                          frame_index, s_spk_ch_num, s_spk_bit_resolution, s_spk_samples_frequence);
@@ -261,6 +460,9 @@
      }
      case STREAM_DISCONNECTED:    /* USB设备断开事件 */
          ESP_LOGI(TAG, "设备已断开");
+ #if (ENABLE_UAC_MIC_SPK_FUNCTION)
+         mic_ring_set_format(&(mic_ring_format_t) { 0 });    /* 麦克风已断开，结束 /audio 流 */
+ #endif
          break;
      default:
          ESP_LOGE(TAG, "未知事件");
@@ -288,11 +490,22 @@
  
  #if (ENABLE_UVC_CAMERA_FUNCTION)
  #if (ENABLE_UVC_WIFI_XFER)
+     /* 分配引用计数的帧缓冲池（esp_camera_fb_get/return），供多个HTTP消费者同时读取 */
+     if (frame_ring_init(CONFIG_CAMERA_FB_POOL_SIZE, CONFIG_CAMERA_FB_BUF_SIZE) != ESP_OK) {
+         /* 内存不足时不中止启动：WiFi、音频端点照常运行，摄像头端点无帧可发 */
+         ESP_LOGE(TAG, "帧缓冲池分配失败 (%d x %d 字节)，摄像头帧不经WiFi发送",
+                  CONFIG_CAMERA_FB_POOL_SIZE, CONFIG_CAMERA_FB_BUF_SIZE);
+     }
+ 
      /* 初始化WiFi和HTTP服务器 */
      app_wifi_main();
      app_httpd_main();
  #endif //ENABLE_UVC_WIFI_XFER
      
+ #if CONFIG_FRAME_REPLAY_ENABLE
+     /* 无摄像头压测：由合成MJPEG帧源代替UVC，帧回调与真实摄像头相同 */
+     ESP_ERROR_CHECK(frame_replay_start(&camera_frame_cb, NULL));
+ #else
      /* 为USB负载分配双缓冲区，传输缓冲区大小 >= 帧缓冲区大小 */
      uint8_t *xfer_buffer_a = (uint8_t *)malloc(DEMO_UVC_XFER_BUFFER_SIZE);
      assert(xfer_buffer_a != NULL);
@@ -323,9 +536,21 @@
      if (ret != ESP_OK) {
          ESP_LOGE(TAG, "UVC流配置失败");
      }
+ #endif //CONFIG_FRAME_REPLAY_ENABLE
  #endif
  
  #if (ENABLE_UAC_MIC_SPK_FUNCTION)
+     /* 映射assets分区中的提示音（由 main/prompts/mkassets.py 打包），先于内置提示音注册，同名时优先 */
+     prompt_assets_load(CONFIG_PROMPT_ASSETS_PARTITION, NULL);
+     
+     /* 注册内置提示音（IMA ADPCM WAV，由 main/prompts/wav_to_adpcm.py 生成） */
+     extern const uint8_t default_wav_start[] asm("_binary_default_wav_start");
+     extern const uint8_t default_wav_end[] asm("_binary_default_wav_end");
+     ESP_ERROR_CHECK(prompt_store_add("default", default_wav_start, default_wav_end - default_wav_start));
+     
+     /* 分配麦克风环形缓冲区，mic_frame_cb 写入，/audio 读取 */
+     ESP_ERROR_CHECK(mic_ring_init(CONFIG_MIC_RING_SIZE));
+ 
      /* 匹配我们找到的音频设备的任意频率
       * 调用uac_frame_size_list_get获取当前音频设备的帧列表
       */
@@ -334,7 +559,7 @@
          .mic_samples_frequence = UAC_FREQUENCY_ANY, /* 任意采样频率 */
          .spk_bit_resolution = UAC_BITS_ANY,        /* 任意位分辨率 */
          .spk_samples_frequence = UAC_FREQUENCY_ANY, /* 任意采样频率 */
-         .spk_buf_size = 16000,                     /* 扬声器缓冲区大小 */
+         .spk_buf_size = SPK_BUF_SIZE,              /* 扬声器缓冲区大小 */
          .mic_cb = &mic_frame_cb,                   /* 设置麦克风回调函数 */
          .mic_cb_arg = NULL,
          /* 设置标志以暂停扬声器，用户稍后需要调用usb_streaming_control来恢复扬声器 */
@@ -357,64 +582,10 @@
      ESP_ERROR_CHECK(usb_streaming_start());
      ESP_ERROR_CHECK(usb_streaming_connect_wait(portMAX_DELAY));
      
-     // 等待扬声器设备就绪
-     xEventGroupWaitBits(s_evt_handle, BIT3_SPK_START, false, false, portMAX_DELAY);
- 
-     while (1) {
-         xEventGroupWaitBits(s_evt_handle, BIT3_SPK_START, true, false, portMAX_DELAY);
-         
-         /* 手动恢复扬声器，因为设置了SUSPEND_AFTER_START标志 */
-         ESP_ERROR_CHECK(usb_streaming_control(STREAM_UAC_SPK, CTRL_RESUME, NULL));
-         usb_streaming_control(STREAM_UAC_SPK, CTRL_UAC_VOLUME, (void *)80);    /* 设置扬声器音量 */
-         usb_streaming_control(STREAM_UAC_MIC, CTRL_UAC_VOLUME, (void *)80);    /* 设置麦克风音量 */
-         ESP_LOGI(TAG, "扬声器已恢复");
-         
- #if (ENABLE_UAC_MIC_SPK_FUNCTION && !ENABLE_UAC_MIC_SPK_LOOPBACK)
-         ESP_LOGI(TAG, "开始播放默认声音");
-         
-         /* 外部声波数组声明 */
-         extern const uint8_t wave_array_32000_16_1[];
-         extern const uint32_t s_buffer_size;
-         
-         /* 计算频率偏移步长和降采样位数 */
-         int freq_offsite_step = 32000 / s_spk_samples_frequence;
-         int downsampling_bits = 16 - s_spk_bit_resolution;
-         
-         const int buffer_ms = 400;    /* 400毫秒缓冲区 */
-         const int buffer_size = buffer_ms * (s_spk_bit_resolution / 8) * (s_spk_samples_frequence / 1000);
-         
-         // 如果是8位扬声器，声明uint8_t *d_buffer
-         uint16_t *s_buffer = (uint16_t *)wave_array_32000_16_1;    /* 源缓冲区 */
-         uint16_t *d_buffer = calloc(1, buffer_size);              /* 目标缓冲区 */
-         size_t offset_size = buffer_size / (s_spk_bit_resolution / 8);
-         
-         while (1) {
-             /* 检查是否到达缓冲区末尾 */
-             if ((uint32_t)(s_buffer + offset_size) >= (uint32_t)(wave_array_32000_16_1 + s_buffer_size)) {
-                 s_buffer = (uint16_t *)wave_array_32000_16_1;    /* 重置到缓冲区开始 */
-                 // 静音扬声器
-                 vTaskDelay(pdMS_TO_TICKS(1000));
-                 // 取消静音扬声器
-             } else {
-                 // 填充USB缓冲区
-                 for (size_t i = 0; i < offset_size; i++) {
-                     d_buffer[i] = *(s_buffer + i * freq_offsite_step) >> downsampling_bits;
-                 }
-                 // 写入USB扬声器
-                 uac_spk_streaming_write(d_buffer, buffer_size, pdMS_TO_TICKS(1000));
-                 s_buffer += offset_size * freq_offsite_step;
-             }
-             
-             /* 检查是否需要重置扬声器 */
-             if (xEventGroupGetBits(s_evt_handle) & (BIT4_SPK_RESET | BIT3_SPK_START)) {
-                 // 发生断开连接，我们可能需要重置扬声器的频率
-                 xEventGroupClearBits(s_evt_handle, BIT4_SPK_RESET);
-                 break;
-             }
-         }
-         free(d_buffer);
+ #if (ENABLE_UAC_MIC_SPK_FUNCTION)
+     /* 扬声器由混音任务驱动，等待扬声器启动后开始混音 */
+     xTaskCreate(speaker_mixer_task, "spk_mixer", 4096, NULL, 5, NULL);
  #endif
-     }
  
      /* 主循环 */
      while (1) {
@@ -0,0 +1,89 @@
+#!/usr/bin/env python3
+#
+# SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Pack IMA ADPCM WAV files (from wav_to_adpcm.py) into an image for the assets
+# partition, in the layout of components/audio_pipe/include/prompt_assets.h.
+# A prompt is named after its file unless given as name=file.
+#
+#   mkassets.py assets.bin hello.wav bye=goodbye_adpcm.wav [--size 0x1F0000]
+#
+# Put the image at main/prompts/assets.bin to have idf.py flash write it, or
+# write it alone with
+#
+#   parttool.py write_partition --partition-name assets --input assets.bin
+
+import argparse
+import os
+import struct
+import sys
+
+MAGIC = b'PRMT'
+VERSION = 1
+NAME_LEN = 24
+HEADER = struct.Struct('<4sHHII')
+ENTRY = struct.Struct('<%dsII' % NAME_LEN)
+
+
+def check_wav(name, wav):
+    """Exit unless wav is a mono 4-bit IMA ADPCM WAV file, as prompt_store.c wants."""
+    if wav[:4] != b'RIFF' or wav[8:12] != b'WAVE':
+        sys.exit('%s: not a WAV file' % name)
+    pos = 12
+    while pos + 8 <= len(wav):
+        chunk, size = struct.unpack_from('<4sI', wav, pos)
+        if chunk == b'fmt ':
+            fmt, channels, rate, _, _, bits = struct.unpack_from('<HHIIHH', wav, pos + 8)
+            if fmt != 0x11 or channels != 1 or bits != 4:
+                sys.exit('%s: not mono IMA ADPCM, encode it with wav_to_adpcm.py' % name)
+            return rate
+        pos += 8 + size + (size & 1)
+    sys.exit('%s: no fmt chunk' % name)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('output', help='image file')
+    parser.add_argument('prompts', nargs='+', help='IMA ADPCM WAV files, as file or name=file')
+    parser.add_argument('--size', type=lambda s: int(s, 0), help='partition size, to check the image fits')
+    args = parser.parse_args()
+
+    prompts = []
+    for arg in args.prompts:
+        name, _, path = arg.rpartition('=')
+        name = name or os.path.splitext(os.path.basename(path))[0]
+        if len(name.encode()) >= NAME_LEN:
+            sys.exit('%s: name longer than %d bytes' % (name, NAME_LEN - 1))
+        if name in (p[0] for p in prompts):
+            sys.exit('%s: name used twice' % name)
+        with open(path, 'rb') as f:
+            wav = f.read()
+        prompts.append((name, wav, check_wav(path, wav)))
+
+    # index first, then the files on 4 byte boundaries
+    offset = HEADER.size + ENTRY.size * len(prompts)
+    index = b''
+    files = b''
+    for name, wav, _ in prompts:
+        pad = -offset % 4
+        files += b'\0' * pad
+        offset += pad
+        index += ENTRY.pack(name.encode(), offset, len(wav))
+        files += wav
+        offset += len(wav)
+
+    image = HEADER.pack(MAGIC, VERSION, len(prompts), offset, 0) + index + files
+    if args.size is not None and len(image) > args.size:
+        sys.exit('image of %d bytes does not fit in %d' % (len(image), args.size))
+    with open(args.output, 'wb') as f:
+        f.write(image)
+
+    for name, wav, rate in prompts:
+        print('%-23s %7d bytes at %d Hz' % (name, len(wav), rate))
+    print('%s: %d prompts, %d bytes' % (args.output, len(prompts), len(image)))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+#
+# SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Encode a PCM WAV file as a mono IMA ADPCM WAV file (format 0x11) for the
+# prompt store. Stereo input is averaged to mono, the sample rate is kept,
+# the device resamples to the speaker rate.
+#
+#   wav_to_adpcm.py hello.wav hello_adpcm.wav [--block-align 256]
+
+import argparse
+import math
+import struct
+import sys
+import wave
+
+STEP = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+    337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+]
+INDEX_ADJUST = [-1, -1, -1, -1, 2, 4, 6, 8]
+
+
+def decode_nibble(predictor, index, code):
+    # must match adpcm.c bit for bit
+    step = STEP[index]
+    diff = step >> 3
+    if code & 4:
+        diff += step
+    if code & 2:
+        diff += step >> 1
+    if code & 1:
+        diff += step >> 2
+    predictor += -diff if code & 8 else diff
+    predictor = max(-32768, min(32767, predictor))
+    index = max(0, min(88, index + INDEX_ADJUST[code & 7]))
+    return predictor, index
+
+
+def encode_block(samples, index):
+    """Encode up to one block, return the block bytes, the decoded samples and the final index."""
+    predictor = samples[0]
+    decoded = [predictor]
+    codes = []
+    for s in samples[1:]:
+        # of the 16 codes take the one decoding closest to the input
+        best = min(range(16), key=lambda c: abs(decode_nibble(predictor, index, c)[0] - s))
+        predictor, index = decode_nibble(predictor, index, best)
+        codes.append(best)
+        decoded.append(predictor)
+    return codes, decoded, index
+
+
+def read_pcm(path):
+    with wave.open(path, 'rb') as w:
+        channels, width, rate, frames = w.getnchannels(), w.getsampwidth(), w.getframerate(), w.getnframes()
+        raw = w.readframes(frames)
+    if width == 1:
+        values = [b - 128 << 8 for b in raw]
+    elif width == 2:
+        values = list(struct.unpack('<%dh' % (len(raw) // 2), raw))
+    else:
+        sys.exit('only 8 and 16-bit PCM input is supported')
+    if channels > 1:
+        values = [sum(values[i:i + channels]) // channels for i in range(0, len(values), channels)]
+    return rate, values
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('input', help='PCM WAV file, 8 or 16-bit')
+    parser.add_argument('output', help='IMA ADPCM WAV file')
+    parser.add_argument('--block-align', type=int, default=256, help='bytes per block, default 256')
+    args = parser.parse_args()
+
+    rate, pcm = read_pcm(args.input)
+    block_align = args.block_align
+    block_samples = (block_align - 4) * 2 + 1
+
+    data = bytearray()
+    index = 0
+    noise = signal = 0
+    for start in range(0, len(pcm), block_samples):
+        samples = pcm[start:start + block_samples]
+        header = struct.pack('<hBB', samples[0], index, 0)
+        codes, decoded, index = encode_block(samples, index)
+        # pad the last block, the fact chunk holds the real length
+        codes += [0] * (block_samples - 1 - len(codes))
+        body = bytes(codes[i] | codes[i + 1] << 4 for i in range(0, len(codes), 2))
+        data += header + body
+        noise += sum((a - b) ** 2 for a, b in zip(samples, decoded))
+        signal += sum(a * a for a in samples)
+
+    fmt = struct.pack('<HHIIHHHH', 0x11, 1, rate, rate * block_align // block_samples, block_align, 4, 2, block_samples)
+    fact = struct.pack('<I', len(pcm))
+    body = b'WAVE' + b'fmt ' + struct.pack('<I', len(fmt)) + fmt + b'fact' + struct.pack('<I', 4) + fact \
+        + b'data' + struct.pack('<I', len(data)) + data
+    with open(args.output, 'wb') as f:
+        f.write(b'RIFF' + struct.pack('<I', len(body)) + body)
+
+    snr = 10 * math.log10(signal / noise) if noise else float('inf')
+    print('%s: %d samples at %d Hz, %d -> %d bytes, SNR %.1f dB'
+          % (args.output, len(pcm), rate, len(pcm) * 2, len(data), snr))
+
+
+if __name__ == '__main__':
+    main()
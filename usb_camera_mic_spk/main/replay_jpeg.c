@@ -0,0 +1,81 @@
+/*
+ * SPDX-FileCopyrightText: 2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <stdint.h>
+
+/* size: 4220 */
+/* width: 320 */
+/* height: 240 */
+/* format: baseline JPEG, YUV420, color bars */
+const uint8_t replay_jpeg_320_240[4220]={
+255, 216, 255, 224, 0, 16, 74, 70, 73, 70, 0, 1, 1, 0, 0, 1, 0, 1, 0, 0, 255, 219, 0, 67, 0, 8, 6, 6, 7, 6, 5, 8, 7, 7, 7, 9, 9, 8, 10, 12, 20, 13, 12, 11, 11, 12, 25, 18, 19, 15, 20, 29, 26, 31, 30, 29, 26, 28, 28, 32, 36, 46, 39, 32,
+34, 44, 35, 28, 28, 40, 55, 41, 44, 48, 49, 52, 52, 52, 31, 39, 57, 61, 56, 50, 60, 46, 51, 52, 50, 255, 219, 0, 67, 1, 9, 9, 9, 12, 11, 12, 24, 13, 13, 24, 50, 33, 28, 33, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 255, 192, 0, 17, 8, 0, 240, 1, 64, 3, 1, 34, 0, 2, 17, 1, 3, 17, 1, 255, 196, 0, 31, 0, 0, 1, 5, 1, 1, 1, 1, 1, 1, 0,
+0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 255, 196, 0, 181, 16, 0, 2, 1, 3, 3, 2, 4, 3, 5, 5, 4, 4, 0, 0, 1, 125, 1, 2, 3, 0, 4, 17, 5, 18, 33, 49, 65, 6, 19, 81, 97, 7, 34, 113, 20, 50, 129, 145, 161, 8, 35,
+66, 177, 193, 21, 82, 209, 240, 36, 51, 98, 114, 130, 9, 10, 22, 23, 24, 25, 26, 37, 38, 39, 40, 41, 42, 52, 53, 54, 55, 56, 57, 58, 67, 68, 69, 70, 71, 72, 73, 74, 83, 84, 85, 86, 87, 88, 89, 90, 99, 100, 101, 102, 103, 104, 105, 106, 115, 116, 117, 118, 119, 120, 121, 122,
+131, 132, 133, 134, 135, 136, 137, 138, 146, 147, 148, 149, 150, 151, 152, 153, 154, 162, 163, 164, 165, 166, 167, 168, 169, 170, 178, 179, 180, 181, 182, 183, 184, 185, 186, 194, 195, 196, 197, 198, 199, 200, 201, 202, 210, 211, 212, 213, 214, 215, 216, 217, 218, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 241,
+242, 243, 244, 245, 246, 247, 248, 249, 250, 255, 196, 0, 31, 1, 0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 255, 196, 0, 181, 17, 0, 2, 1, 2, 4, 4, 3, 4, 7, 5, 4, 4, 0, 1, 2, 119, 0,
+1, 2, 3, 17, 4, 5, 33, 49, 6, 18, 65, 81, 7, 97, 113, 19, 34, 50, 129, 8, 20, 66, 145, 161, 177, 193, 9, 35, 51, 82, 240, 21, 98, 114, 209, 10, 22, 36, 52, 225, 37, 241, 23, 24, 25, 26, 38, 39, 40, 41, 42, 53, 54, 55, 56, 57, 58, 67, 68, 69, 70, 71, 72, 73,
+74, 83, 84, 85, 86, 87, 88, 89, 90, 99, 100, 101, 102, 103, 104, 105, 106, 115, 116, 117, 118, 119, 120, 121, 122, 130, 131, 132, 133, 134, 135, 136, 137, 138, 146, 147, 148, 149, 150, 151, 152, 153, 154, 162, 163, 164, 165, 166, 167, 168, 169, 170, 178, 179, 180, 181, 182, 183, 184, 185, 186, 194, 195, 196,
+197, 198, 199, 200, 201, 202, 210, 211, 212, 213, 214, 215, 216, 217, 218, 226, 227, 228, 229, 230, 231, 232, 233, 234, 242, 243, 244, 245, 246, 247, 248, 249, 250, 255, 218, 0, 12, 3, 1, 0, 2, 17, 3, 17, 0, 63, 0, 247, 250, 40, 162, 128, 10, 40, 162, 128, 10, 194, 173, 218, 194, 175, 134, 227,
+79, 249, 113, 255, 0, 111, 127, 237, 167, 78, 31, 168, 81, 69, 21, 240, 199, 80, 81, 69, 20, 1, 200, 81, 69, 21, 253, 48, 127, 61, 5, 20, 81, 64, 5, 97, 86, 237, 97, 87, 195, 241, 159, 252, 184, 255, 0, 183, 191, 246, 211, 171, 15, 212, 40, 162, 138, 248, 99, 164, 40, 162, 138, 0,
+228, 168, 162, 138, 254, 150, 63, 175, 130, 138, 40, 160, 2, 176, 171, 118, 176, 171, 225, 184, 207, 254, 92, 127, 219, 223, 251, 105, 211, 135, 234, 20, 81, 69, 124, 57, 210, 20, 81, 69, 0, 114, 20, 81, 69, 127, 75, 159, 207, 97, 69, 20, 80, 1, 88, 85, 187, 88, 85, 240, 220, 103, 255, 0,
+46, 63, 237, 239, 253, 180, 234, 195, 245, 10, 40, 162, 190, 28, 233, 10, 40, 162, 128, 62, 255, 0, 162, 138, 40, 0, 162, 138, 40, 0, 172, 42, 221, 172, 42, 248, 110, 52, 255, 0, 151, 31, 246, 247, 254, 218, 116, 225, 250, 133, 20, 81, 95, 12, 117, 5, 20, 81, 64, 28, 133, 20, 81, 95,
+211, 7, 243, 208, 81, 69, 20, 0, 86, 21, 110, 214, 21, 124, 63, 25, 255, 0, 203, 143, 251, 123, 255, 0, 109, 58, 176, 253, 66, 138, 40, 175, 134, 58, 66, 138, 40, 160, 14, 74, 138, 40, 175, 233, 99, 250, 248, 40, 162, 138, 0, 43, 10, 183, 107, 10, 190, 27, 140, 255, 0, 229, 199, 253,
+189, 255, 0, 182, 157, 56, 126, 161, 69, 20, 87, 195, 157, 33, 69, 20, 80, 7, 33, 69, 20, 87, 244, 185, 252, 246, 20, 81, 69, 0, 21, 133, 91, 181, 133, 95, 13, 198, 127, 242, 227, 254, 222, 255, 0, 219, 78, 172, 63, 80, 162, 138, 43, 225, 206, 144, 162, 138, 40, 3, 239, 250, 40, 162,
+128, 10, 40, 162, 128, 10, 194, 173, 218, 194, 175, 134, 227, 79, 249, 113, 255, 0, 111, 127, 237, 167, 78, 31, 168, 81, 69, 21, 240, 199, 80, 81, 69, 20, 1, 200, 81, 69, 21, 253, 48, 127, 61, 5, 20, 81, 64, 5, 97, 86, 237, 97, 87, 195, 241, 159, 252, 184, 255, 0, 183, 191, 246, 211,
+171, 15, 212, 40, 162, 138, 248, 99, 164, 40, 162, 138, 0, 228, 168, 162, 138, 254, 150, 63, 175, 130, 138, 40, 160, 2, 176, 171, 118, 176, 171, 225, 184, 207, 254, 92, 127, 219, 223, 251, 105, 211, 135, 234, 20, 81, 69, 124, 57, 210, 20, 81, 69, 0, 114, 20, 81, 69, 127, 75, 159, 207, 97, 69,
+20, 80, 1, 88, 85, 187, 88, 85, 240, 220, 103, 255, 0, 46, 63, 237, 239, 253, 180, 234, 195, 245, 10, 40, 162, 190, 28, 233, 10, 40, 162, 128, 62, 255, 0, 162, 138, 40, 0, 162, 138, 40, 0, 172, 42, 221, 172, 42, 248, 110, 52, 255, 0, 151, 31, 246, 247, 254, 218, 116, 225, 250, 133, 20,
+81, 95, 12, 117, 5, 20, 81, 64, 28, 133, 20, 81, 95, 211, 7, 243, 208, 81, 69, 20, 0, 86, 21, 110, 214, 21, 124, 63, 25, 255, 0, 203, 143, 251, 123, 255, 0, 109, 58, 176, 253, 66, 138, 40, 175, 134, 58, 66, 138, 40, 160, 14, 74, 138, 40, 175, 233, 99, 250, 248, 40, 162, 138, 0,
+43, 10, 183, 107, 10, 190, 27, 140, 255, 0, 229, 199, 253, 189, 255, 0, 182, 157, 56, 126, 161, 69, 20, 87, 195, 157, 33, 69, 20, 80, 7, 33, 69, 20, 87, 244, 185, 252, 246, 20, 81, 69, 0, 21, 133, 91, 181, 133, 95, 13, 198, 127, 242, 227, 254, 222, 255, 0, 219, 78, 172, 63, 80, 162,
+138, 43, 225, 206, 144, 162, 138, 40, 3, 239, 250, 40, 162, 128, 10, 40, 162, 128, 10, 194, 173, 218, 194, 175, 134, 227, 79, 249, 113, 255, 0, 111, 127, 237, 167, 78, 31, 168, 81, 69, 21, 240, 199, 80, 81, 69, 20, 1, 200, 81, 69, 21, 253, 48, 127, 61, 5, 20, 81, 64, 5, 97, 86, 237,
+97, 87, 195, 241, 159, 252, 184, 255, 0, 183, 191, 246, 211, 171, 15, 212, 40, 162, 138, 248, 99, 164, 40, 162, 138, 0, 228, 168, 162, 138, 254, 150, 63, 175, 130, 138, 40, 160, 2, 176, 171, 118, 176, 171, 225, 184, 207, 254, 92, 127, 219, 223, 251, 105, 211, 135, 234, 20, 81, 69, 124, 57, 210, 20,
+81, 69, 0, 114, 20, 81, 69, 127, 75, 159, 207, 97, 69, 20, 80, 1, 88, 85, 187, 88, 85, 240, 220, 103, 255, 0, 46, 63, 237, 239, 253, 180, 234, 195, 245, 10, 40, 162, 190, 28, 233, 10, 40, 162, 128, 62, 255, 0, 162, 138, 40, 0, 162, 138, 40, 0, 172, 42, 221, 172, 42, 248, 110, 52,
+255, 0, 151, 31, 246, 247, 254, 218, 116, 225, 250, 133, 20, 81, 95, 12, 117, 5, 20, 81, 64, 28, 133, 20, 81, 95, 211, 7, 243, 208, 81, 69, 20, 0, 86, 21, 110, 214, 21, 124, 63, 25, 255, 0, 203, 143, 251, 123, 255, 0, 109, 58, 176, 253, 66, 138, 40, 175, 134, 58, 66, 138, 40, 160,
+14, 74, 138, 40, 175, 233, 99, 250, 248, 40, 162, 138, 0, 43, 10, 183, 107, 10, 190, 27, 140, 255, 0, 229, 199, 253, 189, 255, 0, 182, 157, 56, 126, 161, 69, 20, 87, 195, 157, 33, 69, 20, 80, 7, 33, 69, 20, 87, 244, 185, 252, 246, 20, 81, 69, 0, 21, 133, 91, 181, 133, 95, 13, 198,
+127, 242, 227, 254, 222, 255, 0, 219, 78, 172, 63, 80, 162, 138, 43, 225, 206, 144, 162, 138, 40, 3, 239, 250, 40, 162, 128, 10, 40, 162, 128, 10, 194, 173, 218, 194, 175, 134, 227, 79, 249, 113, 255, 0, 111, 127, 237, 167, 78, 31, 168, 81, 69, 21, 240, 199, 80, 81, 69, 20, 1, 200, 81, 69,
+21, 253, 48, 127, 61, 5, 20, 81, 64, 5, 97, 86, 237, 97, 87, 195, 241, 159, 252, 184, 255, 0, 183, 191, 246, 211, 171, 15, 212, 40, 162, 138, 248, 99, 164, 40, 162, 138, 0, 228, 168, 162, 138, 254, 150, 63, 175, 130, 138, 40, 160, 2, 176, 171, 118, 176, 171, 225, 184, 207, 254, 92, 127, 219,
+223, 251, 105, 211, 135, 234, 20, 81, 69, 124, 57, 210, 20, 81, 69, 0, 114, 20, 81, 69, 127, 75, 159, 207, 97, 69, 20, 80, 1, 88, 85, 187, 88, 85, 240, 220, 103, 255, 0, 46, 63, 237, 239, 253, 180, 234, 195, 245, 10, 40, 162, 190, 28, 233, 10, 40, 162, 128, 62, 255, 0, 162, 138, 40,
+0, 162, 138, 40, 0, 172, 42, 221, 172, 42, 248, 110, 52, 255, 0, 151, 31, 246, 247, 254, 218, 116, 225, 250, 133, 20, 81, 95, 12, 117, 5, 20, 81, 64, 28, 133, 20, 81, 95, 211, 7, 243, 208, 81, 69, 20, 0, 86, 21, 110, 214, 21, 124, 63, 25, 255, 0, 203, 143, 251, 123, 255, 0, 109,
+58, 176, 253, 66, 138, 40, 175, 134, 58, 66, 138, 40, 160, 14, 74, 138, 40, 175, 233, 99, 250, 248, 40, 162, 138, 0, 43, 10, 183, 107, 10, 190, 27, 140, 255, 0, 229, 199, 253, 189, 255, 0, 182, 157, 56, 126, 161, 69, 20, 87, 195, 157, 33, 69, 20, 80, 7, 33, 69, 20, 87, 244, 185, 252,
+246, 20, 81, 69, 0, 21, 133, 91, 181, 133, 95, 13, 198, 127, 242, 227, 254, 222, 255, 0, 219, 78, 172, 63, 80, 162, 138, 43, 225, 206, 144, 162, 138, 40, 3, 239, 250, 40, 162, 128, 10, 40, 162, 128, 10, 194, 173, 218, 194, 175, 134, 227, 79, 249, 113, 255, 0, 111, 127, 237, 167, 78, 31, 168,
+81, 69, 21, 240, 199, 80, 81, 69, 20, 1, 200, 81, 69, 21, 253, 48, 127, 61, 5, 20, 81, 64, 5, 97, 86, 237, 97, 87, 195, 241, 159, 252, 184, 255, 0, 183, 191, 246, 211, 171, 15, 212, 40, 162, 138, 248, 99, 164, 40, 162, 138, 0, 228, 168, 162, 138, 254, 150, 63, 175, 130, 138, 40, 160,
+2, 176, 171, 118, 176, 171, 225, 184, 207, 254, 92, 127, 219, 223, 251, 105, 211, 135, 234, 20, 81, 69, 124, 57, 210, 20, 81, 69, 0, 114, 20, 81, 69, 127, 75, 159, 207, 97, 69, 20, 80, 1, 88, 85, 187, 88, 85, 240, 220, 103, 255, 0, 46, 63, 237, 239, 253, 180, 234, 195, 245, 10, 40, 162,
+190, 28, 233, 10, 40, 162, 128, 62, 255, 0, 162, 138, 40, 0, 162, 138, 40, 0, 172, 42, 221, 172, 42, 248, 110, 52, 255, 0, 151, 31, 246, 247, 254, 218, 116, 225, 250, 133, 20, 81, 95, 12, 117, 5, 20, 81, 64, 28, 133, 20, 81, 95, 211, 7, 243, 208, 81, 69, 20, 0, 86, 21, 110, 214,
+21, 124, 63, 25, 255, 0, 203, 143, 251, 123, 255, 0, 109, 58, 176, 253, 66, 138, 40, 175, 134, 58, 66, 138, 40, 160, 14, 74, 138, 40, 175, 233, 99, 250, 248, 40, 162, 138, 0, 43, 10, 183, 107, 10, 190, 27, 140, 255, 0, 229, 199, 253, 189, 255, 0, 182, 157, 56, 126, 161, 69, 20, 87, 195,
+157, 33, 69, 20, 80, 7, 33, 69, 20, 87, 244, 185, 252, 246, 20, 81, 69, 0, 21, 133, 91, 181, 133, 95, 13, 198, 127, 242, 227, 254, 222, 255, 0, 219, 78, 172, 63, 80, 162, 138, 43, 225, 206, 144, 162, 138, 40, 3, 220, 124, 143, 106, 95, 35, 218, 180, 188, 143, 106, 95, 35, 218, 191, 64,
+149, 83, 243, 88, 215, 51, 124, 143, 106, 95, 35, 218, 180, 188, 143, 106, 95, 35, 218, 185, 229, 84, 218, 53, 204, 239, 35, 218, 151, 200, 246, 173, 31, 35, 218, 156, 32, 246, 174, 121, 85, 55, 141, 115, 55, 200, 246, 165, 242, 61, 171, 75, 200, 246, 165, 242, 61, 171, 9, 85, 54, 141, 115, 55,
+200, 246, 165, 242, 61, 171, 75, 200, 246, 165, 242, 61, 171, 158, 85, 77, 227, 92, 206, 242, 61, 169, 124, 143, 106, 209, 242, 61, 169, 222, 71, 181, 97, 42, 166, 241, 174, 102, 249, 30, 212, 190, 71, 181, 105, 121, 30, 212, 190, 71, 181, 115, 202, 169, 180, 107, 153, 190, 71, 181, 59, 200, 246, 173,
+31, 35, 218, 151, 200, 246, 174, 121, 85, 55, 141, 115, 59, 200, 246, 165, 242, 61, 171, 75, 200, 246, 165, 242, 61, 171, 9, 85, 54, 141, 115, 55, 200, 246, 165, 242, 61, 171, 75, 200, 246, 165, 242, 61, 171, 158, 85, 77, 227, 92, 206, 242, 61, 169, 124, 143, 106, 209, 242, 61, 169, 124, 143, 106,
+194, 85, 77, 227, 92, 206, 242, 61, 169, 124, 143, 106, 210, 242, 61, 169, 124, 143, 106, 231, 149, 83, 104, 215, 51, 124, 143, 106, 95, 35, 218, 180, 188, 143, 106, 95, 35, 218, 185, 229, 84, 222, 53, 204, 239, 35, 218, 151, 200, 246, 173, 31, 35, 218, 157, 228, 123, 86, 18, 170, 111, 26, 230, 111,
+145, 237, 75, 228, 123, 86, 151, 145, 237, 75, 228, 123, 87, 60, 170, 155, 70, 185, 155, 228, 123, 83, 188, 143, 106, 209, 242, 61, 169, 124, 143, 106, 231, 149, 83, 120, 215, 51, 188, 143, 106, 95, 35, 218, 180, 188, 143, 106, 95, 35, 218, 176, 149, 83, 104, 215, 51, 124, 143, 106, 95, 35, 218, 180,
+188, 143, 106, 95, 35, 218, 185, 229, 84, 222, 53, 204, 223, 35, 218, 157, 228, 123, 86, 143, 145, 237, 75, 228, 123, 86, 18, 170, 111, 26, 230, 119, 145, 237, 75, 228, 123, 86, 151, 145, 237, 75, 228, 123, 87, 60, 170, 155, 70, 185, 135, 228, 123, 83, 188, 143, 106, 209, 242, 61, 169, 124, 143, 106,
+253, 250, 85, 79, 230, 168, 215, 51, 188, 143, 106, 95, 35, 218, 180, 188, 143, 106, 95, 35, 218, 185, 229, 84, 218, 53, 204, 223, 35, 218, 151, 200, 246, 173, 47, 35, 218, 151, 200, 246, 172, 37, 84, 222, 53, 204, 239, 35, 218, 151, 200, 246, 173, 31, 35, 218, 151, 200, 246, 174, 121, 85, 55, 141,
+115, 59, 200, 246, 165, 242, 61, 171, 75, 200, 246, 165, 242, 61, 171, 158, 85, 77, 163, 92, 205, 242, 61, 169, 124, 143, 106, 210, 242, 61, 169, 124, 143, 106, 194, 85, 77, 227, 92, 206, 242, 61, 169, 124, 143, 106, 209, 242, 61, 169, 222, 71, 181, 115, 202, 169, 180, 107, 153, 190, 71, 181, 47, 145,
+237, 90, 94, 71, 181, 47, 145, 237, 92, 242, 170, 111, 26, 230, 111, 145, 237, 78, 242, 61, 171, 71, 200, 246, 165, 242, 61, 171, 9, 85, 55, 141, 115, 59, 200, 246, 165, 242, 61, 171, 75, 200, 246, 165, 242, 61, 171, 158, 85, 77, 163, 92, 205, 242, 61, 169, 124, 143, 106, 210, 242, 61, 169, 124,
+143, 106, 194, 85, 77, 227, 92, 205, 242, 61, 169, 222, 71, 181, 104, 249, 30, 212, 190, 71, 181, 115, 202, 169, 180, 107, 153, 222, 71, 181, 47, 145, 237, 90, 94, 71, 181, 47, 145, 237, 92, 242, 170, 111, 26, 230, 111, 145, 237, 75, 228, 123, 86, 151, 145, 237, 75, 228, 123, 86, 18, 170, 111, 26,
+230, 119, 145, 237, 75, 228, 123, 86, 143, 145, 237, 78, 242, 61, 171, 158, 85, 77, 163, 92, 205, 242, 61, 169, 124, 143, 106, 210, 242, 61, 169, 124, 143, 106, 194, 85, 77, 227, 92, 205, 242, 61, 169, 222, 71, 181, 104, 249, 30, 212, 190, 71, 181, 115, 202, 169, 188, 107, 153, 222, 71, 181, 47, 145,
+237, 90, 62, 71, 181, 59, 200, 246, 174, 121, 85, 54, 141, 115, 55, 200, 246, 165, 242, 61, 171, 75, 200, 246, 165, 242, 61, 171, 9, 85, 55, 141, 115, 55, 200, 246, 167, 121, 30, 213, 163, 228, 123, 82, 249, 30, 213, 207, 42, 166, 209, 174, 124, 157, 228, 123, 82, 249, 30, 213, 163, 228, 123, 83,
+188, 143, 106, 254, 201, 149, 83, 226, 99, 92, 205, 242, 61, 169, 124, 143, 106, 210, 242, 61, 169, 124, 143, 106, 194, 85, 77, 227, 92, 205, 242, 61, 169, 222, 71, 181, 104, 249, 30, 212, 190, 71, 181, 115, 202, 169, 180, 107, 153, 222, 71, 181, 47, 145, 237, 90, 94, 71, 181, 47, 145, 237, 92, 242,
+170, 111, 26, 230, 111, 145, 237, 75, 228, 123, 86, 151, 145, 237, 75, 228, 123, 86, 18, 170, 111, 26, 230, 112, 131, 218, 151, 200, 246, 173, 31, 35, 218, 151, 200, 246, 174, 121, 85, 54, 141, 115, 59, 200, 246, 165, 242, 61, 171, 75, 200, 246, 165, 242, 61, 171, 9, 85, 55, 141, 115, 55, 200, 246,
+165, 242, 61, 171, 75, 200, 246, 165, 242, 61, 171, 158, 85, 77, 163, 92, 206, 242, 61, 169, 124, 143, 106, 209, 242, 61, 169, 222, 71, 181, 115, 202, 169, 188, 107, 153, 190, 71, 181, 47, 145, 237, 90, 94, 71, 181, 47, 145, 237, 88, 74, 169, 188, 107, 153, 190, 71, 181, 59, 200, 246, 173, 31, 35,
+218, 151, 200, 246, 174, 121, 85, 54, 141, 115, 59, 200, 246, 165, 242, 61, 171, 75, 200, 246, 165, 242, 61, 171, 9, 85, 55, 141, 115, 55, 200, 246, 165, 242, 61, 171, 75, 200, 246, 165, 242, 61, 171, 158, 85, 77, 227, 92, 205, 242, 61, 169, 222, 71, 181, 104, 249, 30, 212, 190, 71, 181, 115, 202,
+169, 180, 107, 153, 222, 71, 181, 47, 145, 237, 90, 94, 71, 181, 47, 145, 237, 88, 74, 169, 188, 107, 153, 190, 71, 181, 47, 145, 237, 90, 94, 71, 181, 47, 145, 237, 92, 242, 170, 109, 26, 230, 119, 145, 237, 75, 228, 123, 86, 143, 145, 237, 78, 242, 61, 171, 158, 85, 77, 227, 92, 205, 242, 61,
+169, 124, 143, 106, 210, 242, 61, 169, 124, 143, 106, 194, 85, 77, 227, 92, 205, 242, 61, 169, 124, 143, 106, 210, 242, 61, 169, 124, 143, 106, 231, 149, 83, 104, 215, 51, 188, 143, 106, 95, 35, 218, 180, 124, 143, 106, 119, 145, 237, 88, 74, 169, 188, 107, 152, 126, 71, 181, 47, 145, 237, 90, 94, 71,
+181, 47, 145, 237, 95, 190, 202, 169, 252, 211, 26, 230, 119, 145, 237, 75, 228, 123, 86, 143, 145, 237, 78, 242, 61, 171, 9, 85, 55, 141, 115, 55, 200, 246, 165, 242, 61, 171, 75, 200, 246, 165, 242, 61, 171, 158, 85, 77, 227, 92, 205, 242, 61, 169, 222, 71, 181, 104, 249, 30, 212, 190, 71, 181,
+97, 42, 166, 209, 174, 103, 121, 30, 212, 190, 71, 181, 105, 121, 30, 212, 190, 71, 181, 115, 202, 169, 188, 107, 153, 190, 71, 181, 47, 145, 237, 90, 94, 71, 181, 47, 145, 237, 92, 242, 170, 109, 26, 230, 111, 145, 237, 78, 242, 61, 171, 71, 200, 246, 165, 242, 61, 171, 9, 85, 55, 141, 115, 59,
+200, 246, 165, 242, 61, 171, 75, 200, 246, 165, 242, 61, 171, 158, 85, 77, 227, 92, 205, 242, 61, 169, 124, 143, 106, 210, 242, 61, 169, 124, 143, 106, 194, 85, 77, 163, 92, 206, 242, 61, 169, 124, 143, 106, 209, 242, 61, 169, 222, 71, 181, 115, 202, 169, 188, 107, 153, 190, 71, 181, 47, 145, 237, 90,
+94, 71, 181, 47, 145, 237, 92, 242, 170, 111, 26, 230, 111, 145, 237, 75, 228, 123, 86, 151, 145, 237, 75, 228, 123, 86, 18, 170, 109, 26, 230, 119, 145, 237, 75, 228, 123, 86, 136, 131, 218, 157, 228, 123, 87, 60, 170, 155, 198, 185, 155, 228, 123, 82, 249, 30, 213, 165, 228, 123, 82, 249, 30, 213,
+132, 170, 155, 70, 185, 155, 228, 123, 83, 188, 143, 106, 209, 242, 61, 169, 124, 143, 106, 231, 149, 83, 120, 215, 51, 188, 143, 106, 95, 35, 218, 180, 188, 143, 106, 95, 35, 218, 185, 229, 84, 222, 53, 204, 223, 35, 218, 151, 200, 246, 173, 47, 35, 218, 151, 200, 246, 172, 37, 84, 218, 53, 204, 239,
+35, 218, 151, 200, 246, 173, 31, 35, 218, 151, 200, 246, 174, 121, 85, 55, 141, 115, 59, 200, 246, 165, 242, 61, 171, 75, 200, 246, 165, 242, 61, 171, 9, 85, 54, 141, 115, 55, 200, 246, 165, 242, 61, 171, 75, 200, 246, 165, 242, 61, 171, 158, 85, 77, 227, 92, 196, 242, 61, 169, 124, 143, 106, 210,
+242, 61, 169, 124, 143, 106, 253, 250, 85, 79, 230, 168, 215, 51, 124, 143, 106, 95, 35, 218, 180, 188, 143, 106, 95, 35, 218, 185, 229, 84, 218, 53, 204, 239, 35, 218, 151, 200, 246, 173, 31, 35, 218, 156, 32, 246, 174, 121, 85, 55, 141, 115, 55, 200, 246, 165, 242, 61, 171, 75, 200, 246, 165, 242,
+61, 171, 9, 85, 54, 141, 115, 55, 200, 246, 165, 242, 61, 171, 75, 200, 246, 165, 242, 61, 171, 158, 85, 77, 227, 92, 206, 242, 61, 169, 124, 143, 106, 209, 242, 61, 169, 222, 71, 181, 97, 42, 166, 241, 174, 102, 249, 30, 212, 190, 71, 181, 105, 121, 30, 212, 190, 71, 181, 115, 202, 169, 180, 107,
+153, 190, 71, 181, 59, 200, 246, 173, 31, 35, 218, 151, 200, 246, 174, 121, 85, 55, 141, 115, 59, 200, 246, 165, 242, 61, 171, 75, 200, 246, 165, 242, 61, 171, 9, 85, 54, 141, 115, 55, 200, 246, 165, 242, 61, 171, 75, 200, 246, 165, 242, 61, 171, 158, 85, 77, 227, 92, 206, 242, 61, 169, 124, 143,
+106, 209, 242, 61, 169, 124, 143, 106, 194, 85, 77, 227, 92, 206, 242, 61, 169, 124, 143, 106, 210, 242, 61, 169, 124, 143, 106, 231, 149, 83, 104, 215, 51, 124, 143, 106, 95, 35, 218, 180, 188, 143, 106, 95, 35, 218, 185, 229, 84, 222, 53, 204, 239, 35, 218, 151, 200, 246, 173, 31, 35, 218, 157, 228,
+123, 86, 18, 170, 111, 26, 230, 111, 145, 237, 75, 228, 123, 86, 151, 145, 237, 75, 228, 123, 87, 60, 170, 155, 70, 185, 155, 228, 123, 83, 188, 143, 106, 209, 242, 61, 169, 124, 143, 106, 231, 149, 83, 120, 215, 51, 188, 143, 106, 95, 35, 218, 180, 188, 143, 106, 95, 35, 218, 176, 149, 83, 104, 215,
+51, 124, 143, 106, 95, 35, 218, 180, 188, 143, 106, 95, 35, 218, 185, 229, 84, 222, 53, 204, 223, 35, 218, 157, 228, 123, 86, 143, 145, 237, 75, 228, 123, 86, 18, 170, 111, 26, 230, 119, 145, 237, 75, 228, 123, 86, 151, 145, 237, 75, 228, 123, 87, 60, 170, 155, 70, 185, 255, 217,
+};
+
+const uint32_t replay_jpeg_size = sizeof(replay_jpeg_320_240);
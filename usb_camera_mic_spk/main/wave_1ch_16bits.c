@@ -1,2015 +0,0 @@
-/*
- * SPDX-FileCopyrightText: 2023 Espressif Systems (Shanghai) CO LTD
- *
- * SPDX-License-Identifier: Apache-2.0
- */
-#include <stdint.h>
-
-/* size: 128000 */
-/* framerate: 32000 */
-/* bits: 16 */
-/* channel number: 1 */
-const uint8_t wave_array_32000_16_1[128000]={
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255,
-0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 255, 255, 0, 0, 255, 255, 255, 255, 0, 0,
-255, 255, 255, 255, 0, 0, 255, 255, 255, 255, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 255, 255, 0, 0,
-0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 255, 255, 0, 0,
-0, 0, 255, 255, 0, 0, 255, 255, 255, 255, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 255, 255, 254, 255, 0, 0, 0, 0, 254, 255, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 255, 255,
-0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 1, 0, 255, 255, 255, 255, 1, 0, 255, 255, 255, 255, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 255, 255, 255, 255, 0, 0, 255, 255, 255, 255, 0, 0, 255, 255, 255, 255,
-0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 255, 255,
-254, 255, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 0, 0, 255, 255, 255, 255, 255, 255, 0, 0, 255, 255, 0, 0, 0, 0, 254, 255, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 254, 255, 255, 255, 2, 0, 252, 255, 0, 0, 0, 0, 231, 255, 218, 255, 214, 255, 222, 255, 227, 255, 234, 255, 243, 255, 251, 255, 2, 0, 8, 0, 7, 0, 3, 0, 250, 255, 233, 255, 216, 255, 198, 255, 175, 255, 161, 255,
-151, 255, 145, 255, 155, 255, 172, 255, 195, 255, 232, 255, 14, 0, 53, 0, 95, 0, 130, 0, 159, 0, 178, 0, 181, 0, 174, 0, 153, 0, 121, 0, 83, 0, 41, 0, 2, 0, 226, 255, 201, 255, 195, 255, 207, 255, 235, 255, 28, 0, 89, 0, 157, 0, 228, 0, 38, 1, 94, 1, 134, 1, 151, 1,
-146, 1, 114, 1, 52, 1, 230, 0, 136, 0, 38, 0, 199, 255, 111, 255, 47, 255, 12, 255, 2, 255, 28, 255, 89, 255, 169, 255, 12, 0, 119, 0, 222, 0, 61, 1, 120, 1, 146, 1, 140, 1, 76, 1, 231, 0, 104, 0, 209, 255, 58, 255, 172, 254, 49, 254, 233, 253, 200, 253, 211, 253, 43, 254,
-166, 254, 67, 255, 5, 0, 205, 0, 149, 1, 74, 2, 217, 2, 67, 3, 110, 3, 77, 3, 255, 2, 124, 2, 210, 1, 31, 1, 105, 0, 220, 255, 116, 255, 49, 255, 68, 255, 138, 255, 250, 255, 165, 0, 100, 1, 41, 2, 232, 2, 122, 3, 221, 3, 4, 4, 176, 3, 20, 3, 46, 2, 223, 0,
-109, 255, 224, 253, 82, 252, 241, 250, 193, 249, 239, 248, 157, 248, 169, 248, 41, 249, 37, 250, 92, 251, 202, 252, 90, 254, 226, 255, 93, 1, 140, 2, 108, 3, 1, 4, 14, 4, 183, 3, 33, 3, 75, 2, 118, 1, 185, 0, 39, 0, 2, 0, 37, 0, 147, 0, 129, 1, 163, 2, 241, 3, 101, 5,
-196, 6, 0, 8, 229, 8, 58, 9, 25, 9, 82, 8, 201, 6, 212, 4, 113, 2, 183, 255, 255, 252, 85, 250, 32, 248, 105, 246, 47, 245, 225, 244, 75, 245, 62, 246, 222, 247, 245, 249, 57, 252, 150, 254, 217, 0, 233, 2, 187, 4, 203, 5, 88, 6, 102, 6, 185, 5, 206, 4, 193, 3, 192, 2,
-6, 2, 133, 1, 92, 1, 156, 1, 32, 2, 239, 2, 34, 4, 123, 5, 246, 6, 102, 8, 151, 9, 129, 10, 189, 10, 84, 10, 102, 9, 193, 7, 152, 5, 50, 3, 161, 0, 55, 254, 29, 252, 110, 250, 199, 249, 208, 249, 137, 250, 73, 252, 121, 254, 4, 1, 237, 3, 250, 6, 24, 10, 55, 13,
-5, 16, 111, 18, 70, 20, 7, 21, 41, 21, 174, 20, 143, 19, 90, 18, 23, 17, 236, 15, 212, 14, 203, 13, 214, 12, 3, 12, 83, 11, 219, 10, 161, 10, 122, 10, 93, 10, 225, 9, 10, 9, 208, 7, 195, 5, 81, 3, 137, 0, 104, 253, 66, 250, 44, 247, 89, 244, 43, 242, 146, 240, 210, 239,
-65, 240, 83, 241, 7, 243, 106, 245, 14, 248, 240, 250, 31, 254, 111, 1, 204, 4, 6, 8, 182, 10, 225, 12, 49, 14, 158, 14, 159, 14, 62, 14, 211, 13, 121, 13, 53, 13, 248, 12, 184, 12, 119, 12, 75, 12, 79, 12, 125, 12, 236, 12, 92, 13, 161, 13, 132, 13, 158, 12, 43, 11, 26, 9,
-76, 6, 52, 3, 219, 255, 113, 252, 48, 249, 39, 246, 203, 243, 65, 242, 102, 241, 137, 241, 116, 242, 197, 243, 119, 245, 112, 247, 142, 249, 210, 251, 76, 254, 186, 0, 14, 3, 189, 4, 188, 5, 36, 6, 182, 5, 246, 4, 32, 4, 95, 3, 218, 2, 106, 2, 6, 2, 144, 1, 38, 1, 205, 0,
-206, 0, 29, 1, 173, 1, 106, 2, 238, 2, 41, 3, 198, 2, 180, 1, 51, 0, 52, 254, 201, 251, 61, 249, 155, 246, 32, 244, 0, 242, 73, 240, 184, 239, 254, 239, 250, 240, 222, 242, 41, 245, 179, 247, 112, 250, 83, 253, 80, 0, 110, 3, 108, 6, 12, 9, 58, 11, 50, 12, 140, 12, 86, 12,
-173, 11, 19, 11, 144, 10, 65, 10, 241, 9, 146, 9, 8, 9, 116, 8, 248, 7, 164, 7, 194, 7, 251, 7, 72, 8, 48, 8, 148, 7, 119, 6, 137, 4, 29, 2, 93, 255, 75, 252, 44, 249, 28, 246, 55, 243, 236, 240, 61, 239, 75, 238, 171, 238, 169, 239, 56, 241, 81, 243, 160, 245, 31, 248,
-232, 250, 7, 254, 88, 1, 215, 4, 253, 7, 183, 10, 209, 12, 242, 13, 181, 14, 38, 15, 153, 15, 38, 16, 200, 16, 90, 17, 181, 17, 232, 17, 243, 17, 15, 18, 72, 18, 187, 18, 53, 19, 120, 19, 98, 19, 77, 18, 153, 16, 73, 14, 54, 11, 223, 7, 85, 4, 183, 0, 55, 253, 233, 249,
-13, 247, 17, 245, 198, 243, 98, 243, 249, 243, 247, 244, 82, 246, 12, 248, 251, 249, 32, 252, 187, 254, 132, 1, 89, 4, 224, 6, 187, 8, 11, 10, 153, 10, 188, 10, 207, 10, 239, 10, 92, 11, 210, 11, 71, 12, 105, 12, 104, 12, 77, 12, 73, 12, 133, 12, 239, 12, 139, 13, 228, 13, 232, 13,
-88, 13, 242, 11, 31, 10, 223, 7, 41, 5, 86, 2, 110, 255, 155, 252, 16, 250, 224, 247, 154, 246, 73, 246, 170, 246, 237, 247, 181, 249, 184, 251, 237, 253, 88, 0, 240, 2, 184, 5, 175, 8, 103, 11, 210, 13, 68, 15, 247, 15, 28, 16, 174, 15, 57, 15, 207, 14, 138, 14, 52, 14, 171, 13,
-213, 12, 155, 11, 80, 10, 254, 8, 251, 7, 28, 7, 81, 6, 80, 5, 207, 3, 224, 1, 74, 255, 83, 252, 45, 249, 227, 245, 182, 242, 177, 239, 221, 236, 186, 234, 66, 233, 128, 232, 46, 233, 157, 234, 166, 236, 70, 239, 33, 242, 37, 245, 92, 248, 235, 251, 175, 255, 170, 3, 108, 7, 185, 10,
-128, 13, 2, 15, 5, 16, 150, 16, 232, 16, 73, 17, 175, 17, 13, 18, 33, 18, 5, 18, 172, 17, 85, 17, 27, 17, 17, 17, 65, 17, 77, 17, 39, 17, 47, 16, 160, 14, 141, 12, 222, 9, 244, 6, 238, 3, 229, 0, 11, 254, 104, 251, 28, 249, 175, 247, 236, 246, 230, 246, 248, 247, 100, 249,
-33, 251, 23, 253, 40, 255, 86, 1, 199, 3, 117, 6, 47, 9, 199, 11, 175, 13, 6, 15, 162, 15, 125, 15, 49, 15, 205, 14, 156, 14, 113, 14, 63, 14, 184, 13, 233, 12, 241, 11, 232, 10, 23, 10, 120, 9, 38, 9, 215, 8, 92, 8, 159, 7, 72, 6, 178, 4, 226, 2, 225, 0, 224, 254,
-231, 252, 22, 251, 150, 249, 120, 248, 24, 248, 202, 248, 45, 250, 89, 252, 19, 255, 243, 1, 236, 4, 224, 7, 226, 10, 241, 13, 25, 17, 7, 20, 165, 22, 111, 24, 74, 25, 132, 25, 2, 25, 56, 24, 99, 23, 150, 22, 200, 21, 201, 20, 145, 19, 236, 17, 55, 16, 129, 14, 26, 13, 1, 12,
-23, 11, 68, 10, 23, 9, 153, 7, 165, 5, 61, 3, 172, 0, 251, 253, 80, 251, 197, 248, 95, 246, 102, 244, 246, 242, 17, 242, 61, 242, 56, 243, 182, 244, 181, 246, 225, 248, 32, 251, 109, 253, 242, 255, 167, 2, 147, 5, 130, 8, 17, 11, 56, 13, 93, 14, 216, 14, 226, 14, 157, 14, 95, 14,
-42, 14, 2, 14, 148, 13, 239, 12, 7, 12, 247, 10, 252, 9, 30, 9, 149, 8, 11, 8, 108, 7, 86, 6, 178, 4, 165, 2, 22, 0, 77, 253, 109, 250, 130, 247, 194, 244, 45, 242, 200, 239, 39, 238, 36, 237, 191, 236, 104, 237, 121, 238, 213, 239, 94, 241, 244, 242, 156, 244, 104, 246, 135, 248,
-196, 250, 21, 253, 244, 254, 96, 0, 77, 1, 106, 1, 105, 1, 87, 1, 124, 1, 205, 1, 48, 2, 118, 2, 114, 2, 70, 2, 251, 1, 216, 1, 228, 1, 50, 2, 160, 2, 229, 2, 245, 2, 86, 2, 86, 1, 3, 0, 76, 254, 107, 252, 113, 250, 102, 248, 118, 246, 190, 244, 100, 243, 254, 242,
-57, 243, 27, 244, 200, 245, 157, 247, 148, 249, 154, 251, 176, 253, 221, 255, 64, 2, 178, 4, 2, 7, 237, 8, 12, 10, 171, 10, 186, 10, 121, 10, 67, 10, 35, 10, 50, 10, 34, 10, 236, 9, 62, 9, 82, 8, 69, 7, 55, 6, 96, 5, 163, 4, 245, 3, 241, 2, 153, 1, 216, 255, 124, 253,
-241, 250, 64, 248, 122, 245, 205, 242, 60, 240, 235, 237, 23, 236, 197, 234, 84, 234, 226, 234, 253, 235, 169, 237, 172, 239, 203, 241, 2, 244, 134, 246, 84, 249, 108, 252, 230, 255, 67, 3, 107, 6, 249, 8, 228, 10, 113, 12, 168, 13, 241, 14, 81, 16, 207, 17, 54, 19, 92, 20, 59, 21, 168, 21,
-245, 21, 43, 22, 108, 22, 151, 22, 152, 22, 37, 22, 251, 20, 83, 19, 18, 17, 85, 14, 104, 11, 82, 8, 48, 5, 32, 2, 41, 255, 156, 252, 163, 250, 54, 249, 185, 248, 219, 248, 91, 249, 44, 250, 37, 251, 65, 252, 139, 253, 64, 255, 49, 1, 91, 3, 94, 5, 6, 7, 81, 8, 231, 8,
-59, 9, 114, 9, 193, 9, 62, 10, 195, 10, 57, 11, 67, 11, 9, 11, 134, 10, 216, 9, 61, 9, 182, 8, 81, 8, 196, 7, 6, 7, 198, 5, 19, 4, 22, 2, 203, 255, 92, 253, 228, 250, 108, 248, 29, 246, 6, 244, 51, 242, 94, 241, 52, 241, 179, 241, 31, 243, 216, 244, 198, 246, 217, 248,
-4, 251, 79, 253, 219, 255, 164, 2, 101, 5, 3, 8, 232, 9, 73, 11, 35, 12, 102, 12, 157, 12, 206, 12, 31, 13, 87, 13, 100, 13, 0, 13, 42, 12, 25, 11, 213, 9, 159, 8, 121, 7, 101, 6, 29, 5, 142, 3, 180, 1, 83, 255, 197, 252, 24, 250, 95, 247, 190, 244, 59, 242, 241, 239,
-22, 238, 181, 236, 3, 236, 104, 236, 94, 237, 225, 238, 228, 240, 1, 243, 55, 245, 155, 247, 63, 250, 28, 253, 83, 0, 129, 3, 122, 6, 250, 8, 164, 10, 214, 11, 141, 12, 9, 13, 134, 13, 8, 14, 115, 14, 154, 14, 129, 14, 249, 13, 69, 13, 128, 12, 195, 11, 25, 11, 96, 10, 121, 9,
-10, 8, 65, 6, 22, 4, 140, 1, 244, 254, 86, 252, 208, 249, 118, 247, 75, 245, 126, 243, 83, 242, 180, 241, 236, 241, 230, 242, 60, 244, 231, 245, 177, 247, 141, 249, 124, 251, 182, 253, 39, 0, 196, 2, 95, 5, 153, 7, 114, 9, 148, 10, 51, 11, 155, 11, 236, 11, 98, 12, 228, 12, 108, 13,
-149, 13, 121, 13, 24, 13, 108, 12, 203, 11, 59, 11, 221, 10, 133, 10, 29, 10, 122, 9, 138, 8, 108, 7, 33, 6, 195, 4, 101, 3, 9, 2, 212, 0, 205, 255, 0, 255, 234, 254, 123, 255, 152, 0, 111, 2, 143, 4, 202, 6, 255, 8, 25, 11, 50, 13, 82, 15, 152, 17, 206, 19, 235, 21,
-80, 23, 30, 24, 93, 24, 213, 23, 20, 23, 55, 22, 93, 21, 122, 20, 116, 19, 38, 18, 105, 16, 123, 14, 97, 12, 97, 10, 135, 8, 210, 6, 48, 5, 99, 3, 108, 1, 30, 255, 164, 252, 22, 250, 138, 247, 32, 245, 217, 242, 197, 240, 26, 239, 215, 237, 7, 237, 80, 237, 32, 238, 109, 239,
-63, 241, 39, 243, 32, 245, 45, 247, 105, 249, 213, 251, 143, 254, 108, 1, 39, 4, 156, 6, 69, 8, 123, 9, 64, 10, 174, 10, 38, 11, 166, 11, 43, 12, 128, 12, 160, 12, 92, 12, 212, 11, 53, 11, 142, 10, 253, 9, 105, 9, 204, 8, 187, 7, 89, 6, 168, 4, 133, 2, 71, 0, 247, 253,
-160, 251, 97, 249, 60, 247, 68, 245, 188, 243, 159, 242, 16, 242, 61, 242, 179, 242, 104, 243, 51, 244, 251, 244, 196, 245, 185, 246, 238, 247, 81, 249, 232, 250, 76, 252, 110, 253, 23, 254, 62, 254, 56, 254, 19, 254, 37, 254, 81, 254, 148, 254, 180, 254, 143, 254, 46, 254, 140, 253, 227, 252, 70, 252,
-219, 251, 131, 251, 32, 251, 155, 250, 181, 249, 150, 248, 62, 247, 176, 245, 17, 244, 101, 242, 193, 240, 55, 239, 212, 237, 224, 236, 159, 236, 232, 236, 232, 237, 115, 239, 46, 241, 7, 243, 232, 244, 215, 246, 214, 248, 38, 251, 144, 253, 6, 0, 55, 2, 242, 3, 74, 5, 25, 6, 169, 6, 46, 7,
-198, 7, 113, 8, 8, 9, 124, 9, 105, 9, 16, 9, 119, 8, 175, 7, 242, 6, 60, 6, 138, 5, 161, 4, 129, 3, 255, 1, 38, 0, 35, 254, 252, 251, 207, 249, 173, 247, 152, 245, 198, 243, 66, 242, 20, 241, 191, 240, 5, 241, 191, 241, 249, 242, 95, 244, 218, 245, 101, 247, 42, 249, 46, 251,
-133, 253, 78, 0, 28, 3, 225, 5, 37, 8, 5, 10, 144, 11, 198, 12, 1, 14, 67, 15, 148, 16, 189, 17, 171, 18, 49, 19, 54, 19, 255, 18, 146, 18, 5, 18, 100, 17, 168, 16, 123, 15, 233, 13, 0, 12, 152, 9, 246, 6, 52, 4, 91, 1, 136, 254, 196, 251, 25, 249, 213, 246, 252, 244,
-151, 243, 47, 243, 46, 243, 138, 243, 59, 244, 7, 245, 241, 245, 20, 247, 151, 248, 94, 250, 120, 252, 156, 254, 150, 0, 74, 2, 113, 3, 103, 4, 53, 5, 20, 6, 17, 7, 33, 8, 23, 9, 184, 9, 16, 10, 251, 9, 164, 9, 57, 9, 200, 8, 92, 8, 218, 7, 56, 7, 46, 6, 231, 4,
-105, 3, 176, 1, 228, 255, 13, 254, 53, 252, 115, 250, 209, 248, 116, 247, 191, 246, 139, 246, 244, 246, 5, 248, 75, 249, 190, 250, 55, 252, 187, 253, 80, 255, 32, 1, 31, 3, 50, 5, 41, 7, 171, 8, 203, 9, 96, 10, 133, 10, 142, 10, 140, 10, 148, 10, 133, 10, 85, 10, 146, 9, 110, 8,
-249, 6, 39, 5, 76, 3, 111, 1, 150, 255, 162, 253, 138, 251, 56, 249, 162, 246, 250, 243, 70, 241, 168, 238, 39, 236, 199, 233, 188, 231, 16, 230, 200, 228, 74, 228, 150, 228, 104, 229, 211, 230, 160, 232, 145, 234, 159, 236, 231, 238, 105, 241, 42, 244, 104, 247, 179, 250, 248, 253, 207, 0, 34, 3,
-13, 5, 111, 6, 166, 7, 206, 8, 242, 9, 253, 10, 211, 11, 99, 12, 110, 12, 69, 12, 235, 11, 114, 11, 244, 10, 104, 10, 161, 9, 136, 8, 46, 7, 125, 5, 155, 3, 170, 1, 182, 255, 216, 253, 21, 252, 109, 250, 31, 249, 48, 248, 166, 247, 229, 247, 146, 248, 140, 249, 202, 250, 11, 252,
-82, 253, 163, 254, 45, 0, 229, 1, 214, 3, 215, 5, 161, 7, 43, 9, 9, 10, 148, 10, 221, 10, 10, 11, 74, 11, 142, 11, 202, 11, 178, 11, 83, 11, 149, 10, 132, 9, 96, 8, 52, 7, 51, 6, 59, 5, 74, 4, 60, 3, 20, 2, 216, 0, 135, 255, 65, 254, 2, 253, 206, 251, 195, 250,
-224, 249, 50, 249, 43, 249, 157, 249, 142, 250, 61, 252, 31, 254, 40, 0, 49, 2, 44, 4, 34, 6, 39, 8, 82, 10, 136, 12, 182, 14, 117, 16, 205, 17, 168, 18, 210, 18, 204, 18, 160, 18, 108, 18, 42, 18, 208, 17, 27, 17, 7, 16, 177, 14, 20, 13, 104, 11, 196, 9, 56, 8, 175, 6,
-19, 5, 93, 3, 107, 1, 105, 255, 93, 253, 99, 251, 131, 249, 189, 247, 40, 246, 218, 244, 210, 243, 62, 243, 101, 243, 246, 243, 247, 244, 79, 246, 179, 247, 31, 249, 144, 250, 38, 252, 228, 253, 252, 255, 58, 2, 120, 4, 118, 6, 234, 7, 251, 8, 144, 9, 220, 9, 27, 10, 91, 10, 144, 10,
-156, 10, 120, 10, 215, 9, 247, 8, 233, 7, 179, 6, 129, 5, 73, 4, 254, 2, 117, 1, 184, 255, 188, 253, 134, 251, 67, 249, 249, 246, 185, 244, 139, 242, 114, 240, 140, 238, 251, 236, 190, 235, 32, 235, 10, 235, 64, 235, 190, 235, 75, 236, 225, 236, 127, 237, 88, 238, 112, 239, 200, 240, 112, 242,
-8, 244, 132, 245, 148, 246, 83, 247, 229, 247, 91, 248, 252, 248, 179, 249, 132, 250, 53, 251, 176, 251, 229, 251, 194, 251, 138, 251, 66, 251, 23, 251, 245, 250, 213, 250, 149, 250, 37, 250, 145, 249, 203, 248, 235, 247, 252, 246, 251, 245, 240, 244, 242, 243, 3, 243, 120, 242, 95, 242, 179, 242, 175, 243,
-246, 244, 103, 246, 225, 247, 84, 249, 202, 250, 77, 252, 18, 254, 244, 255, 243, 1, 187, 3, 51, 5, 88, 6, 233, 6, 79, 7, 153, 7, 239, 7, 74, 8, 151, 8, 174, 8, 82, 8, 170, 7, 164, 6, 98, 5, 18, 4, 190, 2, 98, 1, 231, 255, 73, 254, 95, 252, 80, 250, 40, 248, 243, 245,
-204, 243, 182, 241, 190, 239, 5, 238, 142, 236, 110, 235, 22, 235, 47, 235, 186, 235, 202, 236, 248, 237, 66, 239, 172, 240, 83, 242, 58, 244, 153, 246, 96, 249, 77, 252, 66, 255, 221, 1, 45, 4, 37, 6, 204, 7, 115, 9, 31, 11, 226, 12, 138, 14, 10, 16, 22, 17, 179, 17, 5, 18, 3, 18,
-203, 17, 114, 17, 245, 16, 20, 16, 239, 14, 130, 13, 163, 11, 163, 9, 133, 7, 79, 5, 19, 3, 217, 0, 185, 254, 217, 252, 68, 251, 50, 250, 192, 249, 164, 249, 221, 249, 70, 250, 187, 250, 58, 251, 241, 251, 232, 252, 28, 254, 180, 255, 81, 1, 221, 2, 35, 4, 1, 5, 171, 5, 35, 6,
-166, 6, 52, 7, 211, 7, 70, 8, 117, 8, 91, 8, 182, 7, 217, 6, 212, 5, 186, 4, 167, 3, 139, 2, 88, 1, 246, 255, 116, 254, 204, 252, 14, 251, 74, 249, 129, 247, 194, 245, 20, 244, 125, 242, 65, 241, 131, 240, 52, 240, 150, 240, 112, 241, 133, 242, 198, 243, 16, 245, 104, 246, 211, 247,
-142, 249, 122, 251, 147, 253, 164, 255, 109, 1, 237, 2, 221, 3, 127, 4, 248, 4, 97, 5, 201, 5, 33, 6, 86, 6, 11, 6, 107, 5, 113, 4, 12, 3, 146, 1, 6, 0, 124, 254, 220, 252, 37, 251, 68, 249, 63, 247, 45, 245, 29, 243, 33, 241, 62, 239, 127, 237, 6, 236, 210, 234, 232, 233,
-202, 233, 42, 234, 252, 234, 93, 236, 238, 237, 154, 239, 85, 241, 56, 243, 70, 245, 152, 247, 83, 250, 37, 253, 1, 0, 116, 2, 132, 4, 47, 6, 69, 7, 52, 8, 10, 9, 214, 9, 131, 10, 6, 11, 50, 11, 236, 10, 99, 10, 147, 9, 152, 8, 140, 7, 113, 6, 36, 5, 170, 3, 5, 2,
-34, 0, 48, 254, 57, 252, 79, 250, 124, 248, 191, 246, 41, 245, 218, 243, 217, 242, 67, 242, 99, 242, 218, 242, 164, 243, 168, 244, 179, 245, 197, 246, 235, 247, 71, 249, 214, 250, 180, 252, 172, 254, 143, 0, 56, 2, 100, 3, 78, 4, 246, 4, 141, 5, 53, 6, 235, 6, 154, 7, 13, 8, 67, 8,
-5, 8, 127, 7, 214, 6, 26, 6, 117, 5, 222, 4, 84, 4, 193, 3, 39, 3, 129, 2, 214, 1, 48, 1, 144, 0, 249, 255, 122, 255, 22, 255, 235, 254, 54, 255, 221, 255, 5, 1, 162, 2, 98, 4, 55, 6, 236, 7, 143, 9, 31, 11, 193, 12, 128, 14, 81, 16, 21, 18, 128, 19, 149, 20,
-17, 21, 5, 21, 187, 20, 59, 20, 179, 19, 25, 19, 107, 18, 92, 17, 253, 15, 82, 14, 83, 12, 60, 10, 26, 8, 11, 6, 255, 3, 239, 1, 205, 255, 152, 253, 95, 251, 39, 249, 17, 247, 19, 245, 46, 243, 141, 241, 34, 240, 242, 238, 84, 238, 58, 238, 133, 238, 77, 239, 78, 240, 100, 241,
-128, 242, 175, 243, 3, 245, 136, 246, 133, 248, 170, 250, 238, 252, 3, 255, 191, 0, 40, 2, 21, 3, 210, 3, 124, 4, 43, 5, 217, 5, 109, 6, 209, 6, 199, 6, 128, 6, 254, 5, 69, 5, 128, 4, 177, 3, 199, 2, 177, 1, 117, 0, 255, 254, 101, 253, 188, 251, 14, 250, 98, 248, 191, 246,
-42, 245, 189, 243, 135, 242, 145, 241, 57, 241, 44, 241, 96, 241, 201, 241, 41, 242, 133, 242, 224, 242, 100, 243, 24, 244, 24, 245, 88, 246, 151, 247, 198, 248, 139, 249, 18, 250, 98, 250, 153, 250, 233, 250, 76, 251, 199, 251, 28, 252, 68, 252, 23, 252, 150, 251, 240, 250, 47, 250, 123, 249, 209, 248,
-49, 248, 131, 247, 190, 246, 229, 245, 239, 244, 236, 243, 220, 242, 192, 241, 162, 240, 141, 239, 144, 238, 243, 237, 178, 237, 228, 237, 183, 238, 192, 239, 248, 240, 58, 242, 116, 243, 174, 244, 10, 246, 162, 247, 100, 249, 91, 251, 55, 253, 230, 254, 69, 0, 56, 1, 3, 2, 173, 2, 100, 3, 31, 4,
-217, 4, 86, 5, 127, 5, 94, 5, 208, 4, 8, 4, 38, 3, 52, 2, 54, 1, 35, 0, 244, 254, 141, 253, 15, 252, 123, 250, 221, 248, 73, 247, 194, 245, 85, 244, 23, 243, 10, 242, 94, 241, 61, 241, 122, 241, 38, 242, 34, 243, 52, 244, 84, 245, 134, 246, 228, 247, 114, 249, 136, 251, 232, 253,
-125, 0, 27, 3, 122, 5, 158, 7, 96, 9, 228, 10, 84, 12, 191, 13, 31, 15, 93, 16, 114, 17, 239, 17, 21, 18, 233, 17, 78, 17, 140, 16, 169, 15, 153, 14, 76, 13, 205, 11, 12, 10, 6, 8, 228, 5, 173, 3, 95, 1, 21, 255, 209, 252, 169, 250, 187, 248, 13, 247, 245, 245, 82, 245,
-3, 245, 14, 245, 55, 245, 111, 245, 180, 245, 49, 246, 235, 246, 237, 247, 99, 249, 235, 250, 126, 252, 208, 253, 227, 254, 197, 255, 123, 0, 62, 1, 15, 2, 247, 2, 195, 3, 92, 4, 168, 4, 119, 4, 13, 4, 109, 3, 180, 2, 252, 1, 65, 1, 124, 0, 158, 255, 171, 254, 160, 253, 135, 252,
-103, 251, 66, 250, 28, 249, 0, 248, 245, 246, 62, 246, 221, 245, 215, 245, 134, 246, 117, 247, 149, 248, 214, 249, 7, 251, 52, 252, 115, 253, 221, 254, 110, 0, 51, 2, 229, 3, 100, 5, 163, 6, 74, 7, 183, 7, 239, 7, 15, 8, 41, 8, 53, 8, 9, 8, 114, 7, 134, 6, 35, 5, 99, 3,
-126, 1, 126, 255, 125, 253, 116, 251, 98, 249, 50, 247, 249, 244, 186, 242, 133, 240, 104, 238, 99, 236, 136, 234, 238, 232, 146, 231, 152, 230, 69, 230, 98, 230, 250, 230, 23, 232, 86, 233, 179, 234, 39, 236, 186, 237, 117, 239, 152, 241, 18, 244, 187, 246, 129, 249, 255, 251, 55, 254, 9, 0, 102, 1,
-158, 2, 187, 3, 212, 4, 216, 5, 193, 6, 76, 7, 130, 7, 116, 7, 23, 7, 144, 6, 243, 5, 71, 5, 119, 4, 136, 3, 116, 2, 53, 1, 233, 255, 149, 254, 79, 253, 18, 252, 225, 250, 213, 249, 253, 248, 94, 248, 46, 248, 123, 248, 14, 249, 231, 249, 218, 250, 203, 251, 178, 252, 163, 253,
-183, 254, 242, 255, 132, 1, 35, 3, 191, 4, 26, 6, 25, 7, 216, 7, 75, 8, 173, 8, 15, 9, 124, 9, 208, 9, 242, 9, 218, 9, 49, 9, 83, 8, 69, 7, 23, 6, 255, 4, 247, 3, 10, 3, 34, 2, 61, 1, 91, 0, 127, 255, 170, 254, 221, 253, 30, 253, 114, 252, 221, 251, 142, 251,
-154, 251, 252, 251, 241, 252, 54, 254, 166, 255, 37, 1, 139, 2, 223, 3, 30, 5, 126, 6, 252, 7, 156, 9, 71, 11, 191, 12, 254, 13, 168, 14, 251, 14, 14, 15, 241, 14, 209, 14, 169, 14, 106, 14, 223, 13, 19, 13, 243, 11, 121, 10, 228, 8, 58, 7, 156, 5, 2, 4, 107, 2, 201, 0,
-31, 255, 116, 253, 204, 251, 61, 250, 192, 248, 93, 247, 38, 246, 28, 245, 72, 244, 248, 243, 4, 244, 106, 244, 61, 245, 43, 246, 40, 247, 24, 248, 20, 249, 37, 250, 111, 251, 25, 253, 241, 254, 243, 0, 203, 2, 98, 4, 172, 5, 107, 6, 6, 7, 129, 7, 248, 7, 102, 8, 190, 8, 210, 8,
-139, 8, 2, 8, 35, 7, 20, 6, 240, 4, 186, 3, 110, 2, 8, 1, 134, 255, 212, 253, 16, 252, 62, 250, 104, 248, 152, 246, 208, 244, 18, 243, 125, 241, 20, 240, 241, 238, 82, 238, 248, 237, 223, 237, 246, 237, 13, 238, 35, 238, 64, 238, 139, 238, 8, 239, 230, 239, 6, 241, 61, 242, 103, 243,
-83, 244, 18, 245, 153, 245, 26, 246, 176, 246, 96, 247, 48, 248, 232, 248, 130, 249, 187, 249, 180, 249, 127, 249, 35, 249, 207, 248, 131, 248, 66, 248, 254, 247, 175, 247, 83, 247, 223, 246, 97, 246, 218, 245, 58, 245, 151, 244, 244, 243, 104, 243, 33, 243, 29, 243, 144, 243, 111, 244, 124, 245, 173, 246,
-219, 247, 253, 248, 18, 250, 76, 251, 175, 252, 61, 254, 3, 0, 179, 1, 67, 3, 114, 4, 80, 5, 254, 5, 129, 6, 10, 7, 146, 7, 21, 8, 81, 8, 70, 8, 237, 7, 8, 7, 245, 5, 186, 4, 96, 3, 0, 2, 149, 0, 10, 255, 95, 253, 162, 251, 207, 249, 251, 247, 49, 246, 116, 244,
-218, 242, 102, 241, 29, 240, 77, 239, 224, 238, 205, 238, 53, 239, 211, 239, 143, 240, 94, 241, 70, 242, 87, 243, 167, 244, 128, 246, 163, 248, 15, 251, 145, 253, 235, 255, 23, 2, 221, 3, 125, 5, 8, 7, 152, 8, 49, 10, 191, 11, 38, 13, 32, 14, 203, 14, 24, 15, 252, 14, 181, 14, 73, 14,
-172, 13, 228, 12, 240, 11, 181, 10, 75, 9, 191, 7, 21, 6, 87, 4, 148, 2, 207, 0, 35, 255, 159, 253, 79, 252, 141, 251, 23, 251, 232, 250, 5, 251, 42, 251, 86, 251, 134, 251, 221, 251, 96, 252, 55, 253, 98, 254, 170, 255, 252, 0, 15, 2, 238, 2, 151, 3, 14, 4, 139, 4, 18, 5,
-173, 5, 41, 6, 125, 6, 109, 6, 244, 5, 57, 5, 57, 4, 31, 3, 1, 2, 230, 0, 199, 255, 159, 254, 110, 253, 45, 252, 231, 250, 156, 249, 82, 248, 9, 247, 200, 245, 162, 244, 193, 243, 37, 243, 246, 242, 82, 243, 235, 243, 188, 244, 169, 245, 150, 246, 130, 247, 142, 248, 203, 249, 52, 251,
-226, 252, 140, 254, 29, 0, 101, 1, 68, 2, 236, 2, 94, 3, 188, 3, 24, 4, 116, 4, 152, 4, 115, 4, 5, 4, 20, 3, 222, 1, 124, 0, 249, 254, 116, 253, 234, 251, 88, 250, 179, 248, 6, 247, 82, 245, 170, 243, 15, 242, 131, 240, 39, 239, 246, 237, 244, 236, 96, 236, 64, 236, 124, 236,
-60, 237, 70, 238, 113, 239, 181, 240, 248, 241, 82, 243, 204, 244, 168, 246, 195, 248, 24, 251, 129, 253, 183, 255, 180, 1, 54, 3, 101, 4, 102, 5, 70, 6, 32, 7, 233, 7, 151, 8, 229, 8, 236, 8, 171, 8, 4, 8, 59, 7, 88, 6, 92, 5, 78, 4, 42, 3, 225, 1, 132, 0, 27, 255,
-167, 253, 63, 252, 225, 250, 139, 249, 95, 248, 93, 247, 135, 246, 53, 246, 55, 246, 126, 246, 19, 247, 182, 247, 94, 248, 255, 248, 177, 249, 132, 250, 141, 251, 232, 252, 94, 254, 232, 255, 44, 1, 55, 2, 12, 3, 150, 3, 33, 4, 178, 4, 89, 5, 251, 5, 128, 6, 193, 6, 157, 6, 62, 6,
-161, 5, 237, 4, 65, 4, 161, 3, 35, 3, 171, 2, 57, 2, 208, 1, 105, 1, 5, 1, 173, 0, 90, 0, 21, 0, 230, 255, 241, 255, 56, 0, 200, 0, 215, 1, 19, 3, 118, 4, 218, 5, 38, 7, 96, 8, 132, 9, 192, 10, 20, 12, 142, 13, 6, 15, 89, 16, 103, 17, 235, 17, 36, 18,
-20, 18, 206, 17, 134, 17, 56, 17, 203, 16, 34, 16, 63, 15, 242, 13, 89, 12, 152, 10, 184, 8, 219, 6, 3, 5, 48, 3, 87, 1, 125, 255, 162, 253, 202, 251, 3, 250, 77, 248, 177, 246, 59, 245, 237, 243, 228, 242, 70, 242, 249, 241, 19, 242, 134, 242, 20, 243, 184, 243, 87, 244, 5, 245,
-197, 245, 215, 246, 57, 248, 214, 249, 174, 251, 113, 253, 13, 255, 90, 0, 81, 1, 37, 2, 223, 2, 161, 3, 98, 4, 33, 5, 150, 5, 206, 5, 201, 5, 99, 5, 215, 4, 49, 4, 120, 3, 175, 2, 212, 1, 219, 0, 186, 255, 135, 254, 64, 253, 233, 251, 145, 250, 57, 249, 232, 247, 176, 246,
-150, 245, 201, 244, 81, 244, 17, 244, 17, 244, 35, 244, 51, 244, 55, 244, 62, 244, 99, 244, 172, 244, 98, 245, 63, 246, 60, 247, 44, 248, 230, 248, 114, 249, 197, 249, 12, 250, 94, 250, 212, 250, 90, 251, 211, 251, 50, 252, 44, 252, 239, 251, 124, 251, 213, 250, 47, 250, 139, 249, 245, 248, 94, 248,
-194, 247, 26, 247, 98, 246, 161, 245, 211, 244, 251, 243, 33, 243, 68, 242, 146, 241, 18, 241, 203, 240, 16, 241, 155, 241, 90, 242, 67, 243, 43, 244, 17, 245, 241, 245, 0, 247, 57, 248, 172, 249, 97, 251, 20, 253, 189, 254, 9, 0, 32, 1, 8, 2, 201, 2, 149, 3, 103, 4, 58, 5, 224, 5,
-81, 6, 103, 6, 17, 6, 133, 5, 197, 4, 230, 3, 253, 2, 10, 2, 249, 0, 209, 255, 148, 254, 62, 253, 222, 251, 125, 250, 38, 249, 225, 247, 181, 246, 178, 245, 17, 245, 186, 244, 181, 244, 30, 245, 167, 245, 74, 246, 247, 246, 179, 247, 135, 248, 162, 249, 33, 251, 228, 252, 248, 254, 31, 1,
-49, 3, 22, 5, 170, 6, 34, 8, 129, 9, 227, 10, 66, 12, 152, 13, 171, 14, 100, 15, 208, 15, 194, 15, 99, 15, 213, 14, 26, 14, 61, 13, 66, 12, 36, 11, 198, 9, 71, 8, 166, 6, 224, 4, 13, 3, 49, 1, 88, 255, 148, 253, 240, 251, 146, 250, 156, 249, 237, 248, 146, 248, 109, 248,
-87, 248, 77, 248, 74, 248, 108, 248, 183, 248, 109, 249, 106, 250, 149, 251, 212, 252, 238, 253, 226, 254, 156, 255, 56, 0, 214, 0, 132, 1, 78, 2, 12, 3, 183, 3, 251, 3, 247, 3, 178, 3, 30, 3, 117, 2, 194, 1, 18, 1, 96, 0, 169, 255, 232, 254, 24, 254, 64, 253, 98, 252, 127, 251,
-156, 250, 188, 249, 248, 248, 100, 248, 4, 248, 18, 248, 120, 248, 21, 249, 227, 249, 182, 250, 134, 251, 76, 252, 39, 253, 37, 254, 75, 255, 182, 0, 32, 2, 126, 3, 135, 4, 70, 5, 203, 5, 13, 6, 69, 6, 119, 6, 167, 6, 165, 6, 105, 6, 225, 5, 206, 4, 126, 3, 248, 1, 69, 0,
-145, 254, 219, 252, 31, 251, 91, 249, 144, 247, 193, 245, 247, 243, 55, 242, 137, 240, 251, 238, 146, 237, 82, 236, 131, 235, 13, 235, 242, 234, 96, 235, 12, 236, 225, 236, 206, 237, 199, 238, 210, 239, 6, 241, 147, 242, 94, 244, 115, 246, 168, 248, 196, 250, 192, 252, 72, 254, 160, 255, 206, 0, 229, 1,
-2, 3, 27, 4, 27, 5, 215, 5, 87, 6, 129, 6, 88, 6, 12, 6, 163, 5, 40, 5, 161, 4, 13, 4, 90, 3, 147, 2, 189, 1, 217, 0, 239, 255, 4, 255, 33, 254, 80, 253, 154, 252, 16, 252, 232, 251, 251, 251, 77, 252, 220, 252, 107, 253, 248, 253, 116, 254, 245, 254, 133, 255, 80, 0,
-88, 1, 125, 2, 184, 3, 195, 4, 160, 5, 64, 6, 155, 6, 237, 6, 57, 7, 153, 7, 238, 7, 48, 8, 41, 8, 208, 7, 60, 7, 98, 6, 114, 5, 131, 4, 162, 3, 224, 2, 41, 2, 121, 1, 214, 0, 52, 0, 147, 255, 255, 254, 116, 254, 244, 253, 141, 253, 89, 253, 86, 253, 167, 253,
-94, 254, 71, 255, 92, 0, 119, 1, 131, 2, 126, 3, 106, 4, 109, 5, 138, 6, 224, 7, 67, 9, 160, 10, 194, 11, 139, 12, 23, 13, 87, 13, 117, 13, 143, 13, 172, 13, 178, 13, 145, 13, 67, 13, 127, 12, 128, 11, 80, 10, 246, 8, 156, 7, 69, 6, 243, 4, 161, 3, 75, 2, 238, 0,
-144, 255, 54, 254, 225, 252, 157, 251, 110, 250, 87, 249, 131, 248, 243, 247, 164, 247, 191, 247, 17, 248, 126, 248, 251, 248, 111, 249, 231, 249, 105, 250, 49, 251, 50, 252, 111, 253, 237, 254, 92, 0, 182, 1, 187, 2, 130, 3, 31, 4, 162, 4, 45, 5, 187, 5, 73, 6, 156, 6, 185, 6, 150, 6,
-6, 6, 81, 5, 122, 4, 137, 3, 146, 2, 146, 1, 114, 0, 62, 255, 248, 253, 153, 252, 46, 251, 191, 249, 74, 248, 220, 246, 126, 245, 52, 244, 62, 243, 128, 242, 250, 241, 194, 241, 150, 241, 115, 241, 76, 241, 44, 241, 35, 241, 81, 241, 219, 241, 153, 242, 140, 243, 131, 244, 94, 245, 25, 246,
-156, 246, 30, 247, 163, 247, 83, 248, 25, 249, 229, 249, 153, 250, 8, 251, 67, 251, 62, 251, 11, 251, 205, 250, 142, 250, 93, 250, 43, 250, 246, 249, 176, 249, 90, 249, 247, 248, 130, 248, 255, 247, 118, 247, 235, 246, 118, 246, 34, 246, 6, 246, 78, 246, 202, 246, 120, 247, 69, 248, 11, 249, 202, 249,
-127, 250, 80, 251, 65, 252, 118, 253, 223, 254, 87, 0, 198, 1, 240, 2, 234, 3, 172, 4, 70, 5, 227, 5, 135, 6, 42, 7, 171, 7, 5, 8, 241, 7, 133, 7, 217, 6, 231, 5, 214, 4, 183, 3, 142, 2, 79, 1, 254, 255, 154, 254, 29, 253, 152, 251, 14, 250, 137, 248, 19, 247, 177, 245,
-123, 244, 139, 243, 217, 242, 133, 242, 142, 242, 192, 242, 19, 243, 129, 243, 255, 243, 140, 244, 117, 245, 168, 246, 35, 248, 8, 250, 7, 252, 9, 254, 229, 255, 143, 1, 29, 3, 140, 4, 15, 6, 156, 7, 53, 9, 171, 10, 234, 11, 237, 12, 105, 13, 165, 13, 169, 13, 113, 13, 30, 13, 178, 12,
-28, 12, 84, 11, 106, 10, 83, 9, 21, 8, 194, 6, 92, 5, 236, 3, 131, 2, 37, 1, 8, 0, 42, 255, 131, 254, 48, 254, 251, 253, 212, 253, 178, 253, 140, 253, 121, 253, 134, 253, 237, 253, 139, 254, 95, 255, 81, 0, 42, 1, 231, 1, 93, 2, 189, 2, 20, 3, 116, 3, 237, 3, 101, 4,
-201, 4, 222, 4, 182, 4, 69, 4, 125, 3, 160, 2, 178, 1, 199, 0, 222, 255, 245, 254, 2, 254, 5, 253, 1, 252, 243, 250, 226, 249, 210, 248, 197, 247, 210, 246, 3, 246, 93, 245, 43, 245, 56, 245, 129, 245, 6, 246, 150, 246, 44, 247, 190, 247, 104, 248, 48, 249, 50, 250, 122, 251, 215, 252,
-66, 254, 114, 255, 112, 0, 59, 1, 194, 1, 63, 2, 183, 2, 55, 3, 157, 3, 223, 3, 213, 3, 103, 3, 187, 2, 201, 1, 171, 0, 133, 255, 91, 254, 43, 253, 244, 251, 183, 250, 110, 249, 36, 248, 219, 246, 154, 245, 106, 244, 78, 243, 85, 242, 163, 241, 47, 241, 15, 241, 91, 241, 217, 241,
-133, 242, 64, 243, 1, 244, 202, 244, 175, 245, 209, 246, 40, 248, 202, 249, 140, 251, 76, 253, 232, 254, 47, 0, 71, 1, 48, 2, 0, 3, 215, 3, 182, 4, 129, 5, 32, 6, 146, 6, 155, 6, 96, 6, 247, 5, 94, 5, 182, 4, 7, 4, 78, 3, 127, 2, 163, 1, 185, 0, 187, 255, 185, 254,
-182, 253, 176, 252, 184, 251, 209, 250, 23, 250, 161, 249, 97, 249, 106, 249, 169, 249, 246, 249, 73, 250, 144, 250, 220, 250, 49, 251, 201, 251, 147, 252, 139, 253, 173, 254, 188, 255, 177, 0, 107, 1, 247, 1, 115, 2, 237, 2, 131, 3, 34, 4, 196, 4, 47, 5, 103, 5, 106, 5, 22, 5, 176, 4,
-63, 4, 219, 3, 139, 3, 72, 3, 14, 3, 212, 2, 154, 2, 93, 2, 33, 2, 234, 1, 183, 1, 154, 1, 151, 1, 178, 1, 26, 2, 187, 2, 135, 3, 126, 4, 112, 5, 86, 6, 32, 7, 216, 7, 151, 8, 104, 9, 114, 10, 138, 11, 171, 12, 152, 13, 70, 14, 183, 14, 206, 14, 196, 14,
-171, 14, 148, 14, 116, 14, 59, 14, 214, 13, 19, 13, 20, 12, 215, 10, 101, 9, 234, 7, 106, 6, 247, 4, 130, 3, 11, 2, 144, 0, 15, 255, 143, 253, 17, 252, 158, 250, 56, 249, 232, 247, 204, 246, 227, 245, 49, 245, 239, 244, 221, 244, 244, 244, 41, 245, 97, 245, 158, 245, 237, 245, 115, 246,
-46, 247, 54, 248, 132, 249, 225, 250, 65, 252, 102, 253, 99, 254, 57, 255, 247, 255, 195, 0, 156, 1, 130, 2, 80, 3, 253, 3, 95, 4, 113, 4, 84, 4, 7, 4, 159, 3, 45, 3, 179, 2, 33, 2, 124, 1, 194, 0, 231, 255, 248, 254, 249, 253, 237, 252, 215, 251, 196, 250, 190, 249, 229, 248,
-52, 248, 179, 247, 113, 247, 59, 247, 13, 247, 212, 246, 150, 246, 91, 246, 80, 246, 130, 246, 229, 246, 138, 247, 58, 248, 223, 248, 101, 249, 185, 249, 0, 250, 64, 250, 160, 250, 21, 251, 158, 251, 22, 252, 98, 252, 130, 252, 81, 252, 246, 251, 134, 251, 11, 251, 153, 250, 40, 250, 186, 249, 60, 249,
-177, 248, 23, 248, 102, 247, 171, 246, 229, 245, 29, 245, 104, 244, 203, 243, 104, 243, 83, 243, 117, 243, 215, 243, 95, 244, 235, 244, 116, 245, 255, 245, 154, 246, 75, 247, 88, 248, 147, 249, 244, 250, 110, 252, 194, 253, 244, 254, 239, 255, 202, 0, 157, 1, 118, 2, 98, 3, 66, 4, 15, 5, 136, 5,
-190, 5, 178, 5, 79, 5, 205, 4, 50, 4, 137, 3, 207, 2, 7, 2, 37, 1, 41, 0, 30, 255, 2, 254, 223, 252, 188, 251, 156, 250, 155, 249, 190, 248, 11, 248, 181, 247, 155, 247, 174, 247, 237, 247, 57, 248, 143, 248, 246, 248, 143, 249, 93, 250, 113, 251, 236, 252, 132, 254, 52, 0, 205, 1,
-65, 3, 151, 4, 208, 5, 16, 7, 89, 8, 177, 9, 242, 10, 12, 12, 226, 12, 65, 13, 94, 13, 53, 13, 199, 12, 64, 12, 163, 11, 226, 10, 0, 10, 255, 8, 211, 7, 129, 6, 24, 5, 152, 3, 11, 2, 127, 0, 250, 254, 164, 253, 124, 252, 130, 251, 234, 250, 111, 250, 15, 250, 189, 249,
-109, 249, 39, 249, 5, 249, 42, 249, 135, 249, 49, 250, 13, 251, 238, 251, 201, 252, 107, 253, 253, 253, 130, 254, 15, 255, 182, 255, 109, 0, 36, 1, 181, 1, 27, 2, 50, 2, 3, 2, 181, 1, 78, 1, 225, 0, 119, 0, 18, 0, 159, 255, 33, 255, 150, 254, 251, 253, 83, 253, 164, 252, 245, 251,
-76, 251, 180, 250, 66, 250, 21, 250, 27, 250, 93, 250, 211, 250, 81, 251, 212, 251, 66, 252, 178, 252, 42, 253, 215, 253, 183, 254, 183, 255, 213, 0, 213, 1, 176, 2, 80, 3, 179, 3, 2, 4, 62, 4, 133, 4, 193, 4, 238, 4, 208, 4, 104, 4, 192, 3, 185, 2, 136, 1, 63, 0, 231, 254,
-144, 253, 54, 252, 214, 250, 109, 249, 0, 248, 145, 246, 40, 245, 200, 243, 114, 242, 59, 241, 49, 240, 85, 239, 207, 238, 165, 238, 181, 238, 1, 239, 114, 239, 238, 239, 115, 240, 25, 241, 233, 241, 230, 242, 75, 244, 213, 245, 122, 247, 25, 249, 137, 250, 211, 251, 236, 252, 244, 253, 255, 254, 27, 0,
-62, 1, 79, 2, 69, 3, 226, 3, 68, 4, 111, 4, 98, 4, 64, 4, 17, 4, 223, 3, 155, 3, 75, 3, 234, 2, 112, 2, 231, 1, 80, 1, 171, 0, 4, 0, 92, 255, 207, 254, 101, 254, 31, 254, 31, 254, 70, 254, 129, 254, 192, 254, 242, 254, 27, 255, 59, 255, 129, 255, 236, 255, 132, 0,
-84, 1, 36, 2, 239, 2, 134, 3, 245, 3, 72, 4, 139, 4, 215, 4, 42, 5, 141, 5, 205, 5, 233, 5, 210, 5, 108, 5, 232, 4, 74, 4, 178, 3, 38, 3, 169, 2, 59, 2, 206, 1, 96, 1, 237, 0, 120, 0, 1, 0, 141, 255, 36, 255, 206, 254, 146, 254, 149, 254, 199, 254, 42, 255,
-203, 255, 114, 0, 27, 1, 175, 1, 50, 2, 177, 2, 67, 3, 3, 4, 226, 4, 227, 5, 220, 6, 186, 7, 111, 8, 218, 8, 43, 9, 102, 9, 164, 9, 232, 9, 41, 10, 73, 10, 46, 10, 223, 9, 68, 9, 113, 8, 135, 7, 141, 6, 152, 5, 164, 4, 179, 3, 183, 2, 180, 1, 171, 0,
-153, 255, 132, 254, 115, 253, 108, 252, 124, 251, 168, 250, 6, 250, 174, 249, 131, 249, 137, 249, 176, 249, 217, 249, 2, 250, 53, 250, 126, 250, 229, 250, 162, 251, 146, 252, 163, 253, 203, 254, 207, 255, 178, 0, 103, 1, 249, 1, 139, 2, 34, 3, 213, 3, 127, 4, 27, 5, 117, 5, 141, 5, 109, 5,
-6, 5, 121, 4, 218, 3, 46, 3, 114, 2, 167, 1, 199, 0, 201, 255, 183, 254, 146, 253, 87, 252, 19, 251, 198, 249, 129, 248, 82, 247, 62, 246, 102, 245, 191, 244, 53, 244, 200, 243, 90, 243, 236, 242, 128, 242, 56, 242, 33, 242, 61, 242, 183, 242, 83, 243, 4, 244, 171, 244, 61, 245, 191, 245,
-49, 246, 194, 246, 106, 247, 46, 248, 6, 249, 203, 249, 119, 250, 210, 250, 10, 251, 31, 251, 26, 251, 24, 251, 25, 251, 28, 251, 21, 251, 2, 251, 218, 250, 155, 250, 75, 250, 229, 249, 118, 249, 5, 249, 148, 248, 81, 248, 55, 248, 69, 248, 158, 248, 16, 249, 142, 249, 15, 250, 130, 250, 245, 250,
-111, 251, 34, 252, 255, 252, 12, 254, 64, 255, 105, 0, 129, 1, 93, 2, 26, 3, 193, 3, 99, 4, 15, 5, 187, 5, 91, 6, 195, 6, 244, 6, 215, 6, 92, 6, 184, 5, 239, 4, 8, 4, 25, 3, 32, 2, 12, 1, 231, 255, 180, 254, 103, 253, 19, 252, 188, 250, 99, 249, 26, 248, 231, 246,
-212, 245, 17, 245, 131, 244, 43, 244, 22, 244, 25, 244, 48, 244, 91, 244, 171, 244, 36, 245, 234, 245, 16, 247, 107, 248, 253, 249, 153, 251, 41, 253, 164, 254, 249, 255, 81, 1, 175, 2, 38, 4, 169, 5, 43, 7, 131, 8, 149, 9, 108, 10, 239, 10, 44, 11, 70, 11, 60, 11, 14, 11, 197, 10,
-94, 10, 188, 9, 250, 8, 25, 8, 12, 7, 235, 5, 187, 4, 130, 3, 86, 2, 66, 1, 87, 0, 170, 255, 32, 255, 185, 254, 94, 254, 2, 254, 164, 253, 88, 253, 49, 253, 48, 253, 135, 253, 14, 254, 175, 254, 90, 255, 229, 255, 90, 0, 182, 0, 11, 1, 110, 1, 231, 1, 111, 2, 232, 2,
-76, 3, 94, 3, 54, 3, 224, 2, 87, 2, 195, 1, 41, 1, 142, 0, 243, 255, 79, 255, 158, 254, 216, 253, 7, 253, 43, 252, 64, 251, 88, 250, 117, 249, 170, 248, 13, 248, 155, 247, 113, 247, 126, 247, 166, 247, 225, 247, 22, 248, 77, 248, 132, 248, 232, 248, 119, 249, 52, 250, 45, 251, 44, 252,
-40, 253, 247, 253, 157, 254, 40, 255, 154, 255, 19, 0, 146, 0, 21, 1, 117, 1, 168, 1, 170, 1, 68, 1, 180, 0, 255, 255, 47, 255, 90, 254, 132, 253, 170, 252, 198, 251, 219, 250, 229, 249, 233, 248, 235, 247, 239, 246, 1, 246, 38, 245, 97, 244, 225, 243, 157, 243, 143, 243, 195, 243, 26, 244,
-131, 244, 241, 244, 109, 245, 252, 245, 173, 246, 171, 247, 213, 248, 44, 250, 151, 251, 235, 252, 38, 254, 33, 255, 6, 0, 223, 0, 191, 1, 173, 2, 156, 3, 125, 4, 36, 5, 151, 5, 199, 5, 172, 5, 114, 5, 27, 5, 181, 4, 66, 4, 196, 3, 47, 3, 134, 2, 204, 1, 251, 0, 23, 0,
-43, 255, 53, 254, 74, 253, 114, 252, 181, 251, 58, 251, 228, 250, 177, 250, 156, 250, 131, 250, 103, 250, 70, 250, 58, 250, 74, 250, 148, 250, 30, 251, 197, 251, 133, 252, 55, 253, 212, 253, 84, 254, 193, 254, 56, 255, 189, 255, 103, 0, 21, 1, 189, 1, 64, 2, 141, 2, 180, 2, 177, 2, 160, 2,
-145, 2, 138, 2, 149, 2, 160, 2, 169, 2, 171, 2, 165, 2, 152, 2, 129, 2, 106, 2, 84, 2, 70, 2, 86, 2, 131, 2, 218, 2, 95, 3, 245, 3, 155, 4, 40, 5, 165, 5, 20, 6, 124, 6, 254, 6, 152, 7, 98, 8, 53, 9, 1, 10, 174, 10, 28, 11, 100, 11, 128, 11, 139, 11,
-154, 11, 176, 11, 181, 11, 155, 11, 93, 11, 198, 10, 250, 9, 5, 9, 231, 7, 198, 6, 163, 5, 129, 4, 89, 3, 41, 2, 241, 0, 171, 255, 96, 254, 17, 253, 198, 251, 136, 250, 87, 249, 82, 248, 129, 247, 220, 246, 122, 246, 66, 246, 31, 246, 13, 246, 5, 246, 14, 246, 45, 246, 154, 246,
-62, 247, 24, 248, 47, 249, 73, 250, 94, 251, 82, 252, 42, 253, 248, 253, 200, 254, 177, 255, 168, 0, 171, 1, 140, 2, 70, 3, 213, 3, 8, 4, 27, 4, 13, 4, 228, 3, 172, 3, 103, 3, 8, 3, 139, 2, 246, 1, 66, 1, 107, 0, 130, 255, 134, 254, 121, 253, 113, 252, 115, 251, 157, 250,
-232, 249, 82, 249, 222, 248, 110, 248, 253, 247, 137, 247, 30, 247, 203, 246, 160, 246, 197, 246, 18, 247, 136, 247, 19, 248, 143, 248, 253, 248, 87, 249, 180, 249, 27, 250, 171, 250, 79, 251, 249, 251, 156, 252, 4, 253, 69, 253, 86, 253, 53, 253, 9, 253, 214, 252, 161, 252, 103, 252, 39, 252, 209, 251,
-101, 251, 232, 250, 81, 250, 164, 249, 237, 248, 48, 248, 131, 247, 241, 246, 132, 246, 93, 246, 91, 246, 122, 246, 173, 246, 224, 246, 20, 247, 73, 247, 163, 247, 35, 248, 223, 248, 215, 249, 229, 250, 254, 251, 252, 252, 226, 253, 172, 254, 103, 255, 44, 0, 251, 0, 222, 1, 177, 2, 109, 3, 230, 3,
-24, 4, 24, 4, 216, 3, 121, 3, 8, 3, 132, 2, 243, 1, 79, 1, 149, 0, 193, 255, 220, 254, 232, 253, 231, 252, 232, 251, 237, 250, 2, 250, 67, 249, 170, 248, 71, 248, 36, 248, 29, 248, 47, 248, 86, 248, 139, 248, 211, 248, 90, 249, 31, 250, 30, 251, 110, 252, 220, 253, 84, 255, 193, 0,
-17, 2, 84, 3, 141, 4, 217, 5, 50, 7, 151, 8, 228, 9, 3, 11, 240, 11, 114, 12, 175, 12, 185, 12, 132, 12, 47, 12, 191, 11, 44, 11, 108, 10, 140, 9, 135, 8, 79, 7, 255, 5, 154, 4, 30, 3, 162, 1, 43, 0, 215, 254, 174, 253, 168, 252, 217, 251, 38, 251, 127, 250, 226, 249,
-81, 249, 214, 248, 119, 248, 115, 248, 165, 248, 13, 249, 171, 249, 79, 250, 240, 250, 124, 251, 2, 252, 141, 252, 45, 253, 242, 253, 194, 254, 151, 255, 71, 0, 207, 0, 42, 1, 65, 1, 66, 1, 50, 1, 28, 1, 3, 1, 230, 0, 190, 0, 129, 0, 52, 0, 211, 255, 90, 255, 214, 254, 68, 254,
-183, 253, 55, 253, 200, 252, 150, 252, 137, 252, 154, 252, 204, 252, 254, 252, 43, 253, 79, 253, 126, 253, 193, 253, 37, 254, 201, 254, 133, 255, 83, 0, 16, 1, 175, 1, 49, 2, 136, 2, 216, 2, 38, 3, 128, 3, 208, 3, 11, 4, 24, 4, 210, 3, 88, 3, 162, 2, 181, 1, 184, 0, 176, 255,
-164, 254, 143, 253, 113, 252, 73, 251, 23, 250, 223, 248, 165, 247, 109, 246, 62, 245, 31, 244, 43, 243, 93, 242, 189, 241, 119, 241, 87, 241, 89, 241, 129, 241, 177, 241, 237, 241, 83, 242, 232, 242, 172, 243, 191, 244, 3, 246, 89, 247, 183, 248, 241, 249, 23, 251, 40, 252, 50, 253, 76, 254, 116, 255,
-170, 0, 205, 1, 214, 2, 158, 3, 39, 4, 133, 4, 177, 4, 196, 4, 201, 4, 193, 4, 158, 4, 106, 4, 35, 4, 178, 3, 43, 3, 146, 2, 221, 1, 31, 1, 96, 0, 168, 255, 20, 255, 155, 254, 71, 254, 25, 254, 243, 253, 208, 253, 163, 253, 120, 253, 82, 253, 82, 253, 131, 253, 220, 253,
-104, 254, 1, 255, 153, 255, 29, 0, 135, 0, 235, 0, 80, 1, 207, 1, 95, 2, 0, 3, 138, 3, 245, 3, 64, 4, 68, 4, 43, 4, 1, 4, 207, 3, 161, 3, 121, 3, 89, 3, 44, 3, 250, 2, 195, 2, 118, 2, 35, 2, 202, 1, 103, 1, 14, 1, 192, 0, 149, 0, 144, 0, 169, 0,
-229, 0, 40, 1, 103, 1, 158, 1, 198, 1, 247, 1, 56, 2, 170, 2, 60, 3, 231, 3, 154, 4, 54, 5, 188, 5, 31, 6, 108, 6, 183, 6, 13, 7, 108, 7, 200, 7, 24, 8, 39, 8, 10, 8, 191, 7, 46, 7, 142, 6, 224, 5, 43, 5, 117, 4, 187, 3, 244, 2, 32, 2, 66, 1,
-86, 0, 98, 255, 109, 254, 117, 253, 153, 252, 210, 251, 37, 251, 192, 250, 126, 250, 89, 250, 86, 250, 87, 250, 96, 250, 117, 250, 173, 250, 12, 251, 162, 251, 131, 252, 127, 253, 147, 254, 147, 255, 125, 0, 81, 1, 12, 2, 206, 2, 153, 3, 122, 4, 87, 5, 34, 6, 196, 6, 28, 7, 65, 7,
-42, 7, 222, 6, 122, 6, 255, 5, 106, 5, 186, 4, 241, 3, 4, 3, 247, 1, 211, 0, 148, 255, 61, 254, 224, 252, 130, 251, 54, 250, 1, 249, 235, 247, 10, 247, 59, 246, 124, 245, 203, 244, 30, 244, 123, 243, 254, 242, 188, 242, 172, 242, 231, 242, 92, 243, 230, 243, 125, 244, 14, 245, 158, 245,
-47, 246, 227, 246, 181, 247, 161, 248, 163, 249, 149, 250, 113, 251, 24, 252, 142, 252, 232, 252, 39, 253, 94, 253, 146, 253, 194, 253, 227, 253, 242, 253, 238, 253, 197, 253, 131, 253, 43, 253, 187, 252, 68, 252, 206, 251, 103, 251, 42, 251, 10, 251, 16, 251, 55, 251, 100, 251, 147, 251, 184, 251, 229, 251,
-30, 252, 132, 252, 27, 253, 214, 253, 183, 254, 153, 255, 113, 0, 45, 1, 206, 1, 105, 2, 1, 3, 168, 3, 79, 4, 243, 4, 100, 5, 161, 5, 169, 5, 92, 5, 226, 4, 73, 4, 147, 3, 205, 2, 251, 1, 24, 1, 27, 0, 15, 255, 243, 253, 194, 252, 141, 251, 84, 250, 39, 249, 13, 248,
-10, 247, 63, 246, 169, 245, 60, 245, 1, 245, 231, 244, 226, 244, 243, 244, 48, 245, 155, 245, 57, 246, 71, 247, 133, 248, 239, 249, 121, 251, 246, 252, 105, 254, 204, 255, 43, 1, 145, 2, 10, 4, 145, 5, 17, 7, 126, 8, 166, 9, 150, 10, 78, 11, 177, 11, 235, 11, 0, 12, 233, 11, 171, 11,
-75, 11, 187, 10, 248, 9, 21, 9, 14, 8, 226, 6, 168, 5, 97, 4, 31, 3, 240, 1, 214, 0, 244, 255, 46, 255, 126, 254, 228, 253, 78, 253, 192, 252, 67, 252, 246, 251, 212, 251, 240, 251, 86, 252, 212, 252, 105, 253, 247, 253, 123, 254, 246, 254, 121, 255, 18, 0, 189, 0, 129, 1, 62, 2,
-230, 2, 99, 3, 155, 3, 172, 3, 151, 3, 98, 3, 40, 3, 234, 2, 160, 2, 73, 2, 227, 1, 97, 1, 199, 0, 25, 0, 84, 255, 130, 254, 176, 253, 226, 252, 57, 252, 175, 251, 72, 251, 24, 251, 248, 250, 227, 250, 209, 250, 193, 250, 183, 250, 204, 250, 19, 251, 128, 251, 30, 252, 212, 252,
-136, 253, 45, 254, 176, 254, 37, 255, 142, 255, 2, 0, 125, 0, 251, 0, 109, 1, 178, 1, 207, 1, 167, 1, 72, 1, 202, 0, 48, 0, 138, 255, 222, 254, 46, 254, 109, 253, 163, 252, 208, 251, 238, 250, 10, 250, 35, 249, 64, 248, 112, 247, 179, 246, 26, 246, 191, 245, 139, 245, 131, 245, 165, 245,
-212, 245, 13, 246, 92, 246, 196, 246, 74, 247, 25, 248, 30, 249, 74, 250, 146, 251, 209, 252, 255, 253, 8, 255, 254, 255, 239, 0, 225, 1, 233, 2, 241, 3, 243, 4, 193, 5, 90, 6, 194, 6, 218, 6, 200, 6, 153, 6, 76, 6, 233, 5, 116, 5, 229, 4, 50, 4, 105, 3, 136, 2, 133, 1,
-118, 0, 92, 255, 65, 254, 55, 253, 64, 252, 118, 251, 211, 250, 73, 250, 217, 249, 111, 249, 8, 249, 167, 248, 101, 248, 69, 248, 77, 248, 178, 248, 56, 249, 218, 249, 142, 250, 54, 251, 216, 251, 120, 252, 41, 253, 236, 253, 206, 254, 191, 255, 167, 0, 127, 1, 32, 2, 159, 2, 1, 3, 68, 3,
-136, 3, 204, 3, 21, 4, 89, 4, 152, 4, 199, 4, 226, 4, 237, 4, 227, 4, 194, 4, 153, 4, 104, 4, 67, 4, 50, 4, 55, 4, 101, 4, 160, 4, 226, 4, 30, 5, 72, 5, 106, 5, 137, 5, 195, 5, 24, 6, 144, 6, 37, 7, 183, 7, 68, 8, 158, 8, 227, 8, 19, 9, 51, 9,
-93, 9, 140, 9, 183, 9, 197, 9, 178, 9, 103, 9, 217, 8, 43, 8, 92, 7, 122, 6, 149, 5, 172, 4, 185, 3, 189, 2, 182, 1, 158, 0, 127, 255, 92, 254, 52, 253, 25, 252, 12, 251, 21, 250, 83, 249, 184, 248, 68, 248, 6, 248, 219, 247, 193, 247, 183, 247, 200, 247, 246, 247, 96, 248,
-20, 249, 247, 249, 12, 251, 54, 252, 89, 253, 107, 254, 99, 255, 86, 0, 70, 1, 80, 2, 101, 3, 127, 4, 133, 5, 93, 6, 11, 7, 115, 7, 159, 7, 168, 7, 139, 7, 76, 7, 245, 6, 132, 6, 230, 5, 42, 5, 80, 4, 77, 3, 48, 2, 0, 1, 194, 255, 129, 254, 72, 253, 47, 252,
-55, 251, 88, 250, 152, 249, 231, 248, 60, 248, 150, 247, 3, 247, 144, 246, 67, 246, 73, 246, 133, 246, 233, 246, 112, 247, 253, 247, 138, 248, 17, 249, 168, 249, 82, 250, 18, 251, 247, 251, 219, 252, 186, 253, 100, 254, 229, 254, 63, 255, 103, 255, 124, 255, 134, 255, 137, 255, 128, 255, 105, 255, 60, 255,
-235, 254, 128, 254, 250, 253, 79, 253, 151, 252, 212, 251, 22, 251, 109, 250, 221, 249, 127, 249, 68, 249, 31, 249, 15, 249, 254, 248, 240, 248, 235, 248, 9, 249, 76, 249, 185, 249, 112, 250, 56, 251, 14, 252, 220, 252, 149, 253, 66, 254, 232, 254, 153, 255, 87, 0, 40, 1, 235, 1, 149, 2, 28, 3,
-77, 3, 83, 3, 48, 3, 222, 2, 123, 2, 10, 2, 137, 1, 243, 0, 77, 0, 145, 255, 193, 254, 231, 253, 0, 253, 24, 252, 53, 251, 90, 250, 169, 249, 27, 249, 174, 248, 126, 248, 108, 248, 114, 248, 144, 248, 199, 248, 26, 249, 158, 249, 113, 250, 120, 251, 189, 252, 46, 254, 162, 255, 21, 1,
-106, 2, 181, 3, 249, 4, 72, 6, 166, 7, 9, 9, 97, 10, 133, 11, 118, 12, 29, 13, 103, 13, 126, 13, 98, 13, 10, 13, 148, 12, 255, 11, 50, 11, 64, 10, 46, 9, 239, 7, 143, 6, 28, 5, 148, 3, 9, 2, 135, 0, 23, 255, 214, 253, 183, 252, 187, 251, 230, 250, 33, 250, 106, 249,
-199, 248, 74, 248, 241, 247, 225, 247, 31, 248, 142, 248, 49, 249, 235, 249, 169, 250, 103, 251, 40, 252, 250, 252, 222, 253, 233, 254, 253, 255, 17, 1, 4, 2, 201, 2, 104, 3, 209, 3, 24, 4, 82, 4, 130, 4, 166, 4, 192, 4, 207, 4, 177, 4, 124, 4, 48, 4, 176, 3, 29, 3, 123, 2,
-203, 1, 41, 1, 152, 0, 42, 0, 227, 255, 175, 255, 145, 255, 112, 255, 76, 255, 37, 255, 8, 255, 8, 255, 39, 255, 129, 255, 249, 255, 131, 0, 11, 1, 125, 1, 223, 1, 45, 2, 118, 2, 194, 2, 21, 3, 96, 3, 146, 3, 169, 3, 109, 3, 3, 3, 113, 2, 167, 1, 214, 0, 251, 255,
-18, 255, 38, 254, 50, 253, 49, 252, 38, 251, 21, 250, 1, 249, 238, 247, 228, 246, 227, 245, 8, 245, 86, 244, 201, 243, 121, 243, 85, 243, 76, 243, 96, 243, 137, 243, 202, 243, 42, 244, 208, 244, 169, 245, 183, 246, 2, 248, 84, 249, 168, 250, 226, 251, 7, 253, 32, 254, 56, 255, 96, 0, 146, 1,
-205, 2, 236, 3, 233, 4, 186, 5, 50, 6, 127, 6, 165, 6, 155, 6, 124, 6, 73, 6, 244, 5, 130, 5, 247, 4, 71, 4, 119, 3, 148, 2, 155, 1, 149, 0, 145, 255, 148, 254, 187, 253, 1, 253, 98, 252, 232, 251, 120, 251, 16, 251, 172, 250, 89, 250, 27, 250, 5, 250, 58, 250, 152, 250,
-37, 251, 212, 251, 131, 252, 49, 253, 213, 253, 127, 254, 51, 255, 3, 0, 228, 0, 201, 1, 160, 2, 81, 3, 225, 3, 64, 4, 124, 4, 170, 4, 205, 4, 243, 4, 17, 5, 38, 5, 47, 5, 31, 5, 251, 4, 185, 4, 92, 4, 239, 3, 116, 3, 252, 2, 145, 2, 59, 2, 17, 2, 252, 1,
-252, 1, 1, 2, 0, 2, 250, 1, 238, 1, 246, 1, 19, 2, 95, 2, 211, 2, 89, 3, 236, 3, 109, 4, 222, 4, 62, 5, 150, 5, 246, 5, 93, 6, 214, 6, 64, 7, 153, 7, 189, 7, 171, 7, 114, 7, 10, 7, 138, 6, 255, 5, 108, 5, 212, 4, 49, 4, 129, 3, 196, 2, 251, 1,
-39, 1, 76, 0, 113, 255, 154, 254, 213, 253, 44, 253, 160, 252, 64, 252, 12, 252, 238, 251, 231, 251, 240, 251, 9, 252, 51, 252, 148, 252, 39, 253, 232, 253, 232, 254, 253, 255, 23, 1, 35, 2, 19, 3, 245, 3, 205, 4, 179, 5, 162, 6, 157, 7, 133, 8, 73, 9, 229, 9, 34, 10, 36, 10,
-245, 9, 139, 9, 0, 9, 92, 8, 155, 7, 181, 6, 182, 5, 149, 4, 78, 3, 242, 1, 127, 0, 248, 254, 112, 253, 235, 251, 130, 250, 59, 249, 17, 248, 18, 247, 46, 246, 88, 245, 143, 244, 224, 243, 76, 243, 221, 242, 203, 242, 242, 242, 80, 243, 247, 243, 173, 244, 113, 245, 59, 246, 13, 247,
-237, 247, 237, 248, 10, 250, 50, 251, 100, 252, 113, 253, 94, 254, 37, 255, 176, 255, 39, 0, 139, 0, 226, 0, 44, 1, 106, 1, 139, 1, 134, 1, 100, 1, 26, 1, 166, 0, 28, 0, 122, 255, 213, 254, 55, 254, 162, 253, 64, 253, 244, 252, 188, 252, 155, 252, 119, 252, 81, 252, 45, 252, 24, 252,
-29, 252, 80, 252, 189, 252, 71, 253, 238, 253, 147, 254, 43, 255, 182, 255, 52, 0, 182, 0, 62, 1, 221, 1, 116, 2, 252, 2, 95, 3, 126, 3, 112, 3, 44, 3, 180, 2, 43, 2, 145, 1, 230, 0, 46, 0, 109, 255, 147, 254, 173, 253, 188, 252, 188, 251, 184, 250, 180, 249, 183, 248, 212, 247,
-15, 247, 117, 246, 26, 246, 227, 245, 206, 245, 226, 245, 13, 246, 82, 246, 208, 246, 141, 247, 125, 248, 190, 249, 44, 251, 174, 252, 59, 254, 177, 255, 29, 1, 128, 2, 230, 3, 90, 5, 221, 6, 96, 8, 200, 9, 17, 11, 10, 12, 185, 12, 48, 13, 93, 13, 85, 13, 42, 13, 212, 12, 78, 12,
-165, 11, 211, 10, 205, 9, 170, 8, 107, 7, 13, 6, 167, 4, 62, 3, 224, 1, 165, 0, 134, 255, 142, 254, 189, 253, 253, 252, 77, 252, 177, 251, 44, 251, 195, 250, 165, 250, 195, 250, 23, 251, 178, 251, 102, 252, 39, 253, 235, 253, 174, 254, 119, 255, 81, 0, 68, 1, 69, 2, 81, 3, 61, 4,
-8, 5, 176, 5, 16, 6, 80, 6, 118, 6, 133, 6, 134, 6, 122, 6, 85, 6, 12, 6, 168, 5, 31, 5, 104, 4, 155, 3, 185, 2, 198, 1, 221, 0, 0, 0, 71, 255, 175, 254, 51, 254, 212, 253, 121, 253, 33, 253, 203, 252, 127, 252, 75, 252, 59, 252, 110, 252, 198, 252, 64, 253, 204, 253,
-76, 254, 195, 254, 38, 255, 135, 255, 238, 255, 104, 0, 231, 0, 95, 1, 195, 1, 235, 1, 233, 1, 186, 1, 81, 1, 215, 0, 77, 0, 185, 255, 30, 255, 123, 254, 205, 253, 16, 253, 76, 252, 130, 251, 173, 250, 219, 249, 16, 249, 85, 248, 182, 247, 55, 247, 244, 246, 211, 246, 210, 246, 236, 246,
-28, 247, 93, 247, 184, 247, 71, 248, 254, 248, 236, 249, 14, 251, 63, 252, 118, 253, 148, 254, 159, 255, 149, 0, 133, 1, 126, 2, 127, 3, 137, 4, 126, 5, 86, 6, 240, 6, 62, 7, 89, 7, 53, 7, 224, 6, 114, 6, 238, 5, 69, 5, 134, 4, 176, 3, 180, 2, 159, 1, 118, 0, 54, 255,
-237, 253, 166, 252, 105, 251, 75, 250, 73, 249, 109, 248, 188, 247, 31, 247, 150, 246, 30, 246, 186, 245, 110, 245, 93, 245, 143, 245, 245, 245, 165, 246, 125, 247, 104, 248, 92, 249, 77, 250, 66, 251, 62, 252, 88, 253, 129, 254, 183, 255, 231, 0, 251, 1, 244, 2, 186, 3, 91, 4, 231, 4, 101, 5,
-219, 5, 73, 6, 173, 6, 246, 6, 41, 7, 66, 7, 44, 7, 253, 6, 183, 6, 86, 6, 243, 5, 146, 5, 65, 5, 13, 5, 237, 4, 224, 4, 214, 4, 200, 4, 176, 4, 145, 4, 124, 4, 117, 4, 162, 4, 240, 4, 88, 5, 210, 5, 69, 6, 171, 6, 243, 6, 50, 7, 110, 7, 173, 7,
-250, 7, 66, 8, 129, 8, 136, 8, 103, 8, 31, 8, 151, 7, 250, 6, 79, 6, 152, 5, 218, 4, 23, 4, 76, 3, 112, 2, 141, 1, 162, 0, 171, 255, 179, 254, 187, 253, 215, 252, 9, 252, 84, 251, 213, 250, 127, 250, 71, 250, 51, 250, 52, 250, 72, 250, 117, 250, 211, 250, 92, 251, 23, 252,
-25, 253, 50, 254, 93, 255, 126, 0, 143, 1, 146, 2, 137, 3, 139, 4, 151, 5, 179, 6, 199, 7, 195, 8, 150, 9, 16, 10, 85, 10, 99, 10, 35, 10, 199, 9, 81, 9, 180, 8, 249, 7, 37, 7, 41, 6, 9, 5, 209, 3, 126, 2, 22, 1, 168, 255, 57, 254, 224, 252, 161, 251, 126, 250,
-143, 249, 182, 248, 240, 247, 58, 247, 149, 246, 5, 246, 160, 245, 128, 245, 150, 245, 241, 245, 141, 246, 62, 247, 1, 248, 199, 248, 145, 249, 95, 250, 70, 251, 65, 252, 74, 253, 88, 254, 76, 255, 36, 0, 204, 0, 64, 1, 151, 1, 209, 1, 244, 1, 8, 2, 12, 2, 234, 1, 168, 1, 72, 1,
-184, 0, 6, 0, 61, 255, 96, 254, 123, 253, 154, 252, 204, 251, 32, 251, 141, 250, 22, 250, 183, 249, 94, 249, 11, 249, 191, 248, 135, 248, 102, 248, 129, 248, 211, 248, 76, 249, 239, 249, 157, 250, 74, 251, 235, 251, 131, 252, 33, 253, 200, 253, 135, 254, 74, 255, 13, 0, 171, 0, 27, 1, 99, 1,
-110, 1, 83, 1, 32, 1, 219, 0, 134, 0, 40, 0, 191, 255, 61, 255, 173, 254, 15, 254, 91, 253, 158, 252, 219, 251, 25, 251, 108, 250, 212, 249, 103, 249, 45, 249, 19, 249, 31, 249, 76, 249, 140, 249, 224, 249, 101, 250, 20, 251, 239, 251, 28, 253, 106, 254, 208, 255, 61, 1, 155, 2, 237, 3,
-46, 5, 114, 6, 188, 7, 14, 9, 92, 10, 143, 11, 161, 12, 79, 13, 193, 13, 247, 13, 208, 13, 128, 13, 13, 13, 107, 12, 162, 11, 187, 10, 173, 9, 113, 8, 27, 7, 170, 5, 29, 4, 139, 2, 246, 0, 118, 255, 19, 254, 203, 252, 189, 251, 207, 250, 251, 249, 67, 249, 164, 248, 30, 248,
-194, 247, 176, 247, 216, 247, 67, 248, 2, 249, 221, 249, 206, 250, 203, 251, 203, 252, 206, 253, 227, 254, 16, 0, 75, 1, 144, 2, 196, 3, 223, 4, 209, 5, 135, 6, 29, 7, 148, 7, 235, 7, 51, 8, 108, 8, 125, 8, 111, 8, 67, 8, 225, 7, 86, 7, 177, 6, 234, 5, 21, 5, 62, 4,
-107, 3, 181, 2, 22, 2, 141, 1, 31, 1, 180, 0, 76, 0, 223, 255, 128, 255, 50, 255, 7, 255, 24, 255, 74, 255, 160, 255, 10, 0, 111, 0, 200, 0, 13, 1, 79, 1, 145, 1, 224, 1, 51, 2, 132, 2, 183, 2, 189, 2, 155, 2, 62, 2, 180, 1, 20, 1, 96, 0, 162, 255, 222, 254,
-22, 254, 63, 253, 95, 252, 118, 251, 129, 250, 135, 249, 140, 248, 152, 247, 182, 246, 235, 245, 72, 245, 221, 244, 150, 244, 117, 244, 127, 244, 155, 244, 200, 244, 35, 245, 164, 245, 74, 246, 58, 247, 84, 248, 133, 249, 194, 250, 243, 251, 23, 253, 39, 254, 51, 255, 70, 0, 97, 1, 131, 2, 148, 3,
-144, 4, 70, 5, 193, 5, 10, 6, 14, 6, 232, 5, 169, 5, 76, 5, 208, 4, 62, 4, 146, 3, 190, 2, 212, 1, 212, 0, 183, 255, 147, 254, 109, 253, 82, 252, 78, 251, 98, 250, 164, 249, 7, 249, 129, 248, 20, 248, 181, 247, 104, 247, 48, 247, 57, 247, 116, 247, 227, 247, 164, 248, 131, 249,
-117, 250, 110, 251, 98, 252, 85, 253, 74, 254, 85, 255, 105, 0, 135, 1, 159, 2, 157, 3, 124, 4, 34, 5, 167, 5, 16, 6, 94, 6, 161, 6, 217, 6, 255, 6, 9, 7, 250, 6, 201, 6, 112, 6, 254, 5, 113, 5, 210, 4, 47, 4, 142, 3, 9, 3, 154, 2, 64, 2, 4, 2, 205, 1,
-154, 1, 101, 1, 52, 1, 15, 1, 2, 1, 45, 1, 121, 1, 232, 1, 114, 2, 248, 2, 122, 3, 231, 3, 83, 4, 191, 4, 61, 5, 196, 5, 77, 6, 205, 6, 31, 7, 76, 7, 77, 7, 21, 7, 199, 6, 103, 6, 248, 5, 134, 5, 14, 5, 137, 4, 247, 3, 90, 3, 173, 2, 245, 1,
-56, 1, 120, 0, 197, 255, 36, 255, 155, 254, 69, 254, 14, 254, 245, 253, 253, 253, 20, 254, 58, 254, 123, 254, 220, 254, 95, 255, 28, 0, 10, 1, 14, 2, 38, 3, 56, 4, 61, 5, 49, 6, 15, 7, 236, 7, 199, 8, 162, 9, 105, 10, 24, 11, 134, 11, 174, 11, 160, 11, 74, 11, 189, 10,
-18, 10, 72, 9, 93, 8, 90, 7, 62, 6, 249, 4, 156, 3, 40, 2, 152, 0, 253, 254, 95, 253, 200, 251, 76, 250, 234, 248, 175, 247, 166, 246, 180, 245, 216, 244, 29, 244, 118, 243, 229, 242, 156, 242, 144, 242, 187, 242, 67, 243, 249, 243, 206, 244, 186, 245, 170, 246, 158, 247, 155, 248, 177, 249,
-215, 250, 14, 252, 70, 253, 106, 254, 119, 255, 72, 0, 242, 0, 127, 1, 228, 1, 55, 2, 121, 2, 161, 2, 166, 2, 141, 2, 79, 2, 224, 1, 85, 1, 174, 0, 237, 255, 40, 255, 98, 254, 175, 253, 20, 253, 143, 252, 36, 252, 201, 251, 116, 251, 34, 251, 215, 250, 158, 250, 124, 250, 151, 250,
-219, 250, 71, 251, 217, 251, 110, 252, 4, 253, 137, 253, 10, 254, 139, 254, 22, 255, 176, 255, 77, 0, 233, 0, 86, 1, 159, 1, 193, 1, 152, 1, 84, 1, 250, 0, 136, 0, 12, 0, 136, 255, 246, 254, 80, 254, 157, 253, 214, 252, 253, 251, 29, 251, 54, 250, 92, 249, 151, 248, 232, 247, 118, 247,
-44, 247, 5, 247, 15, 247, 52, 247, 113, 247, 203, 247, 85, 248, 6, 249, 240, 249, 33, 251, 115, 252, 226, 253, 83, 255, 188, 0, 29, 2, 107, 3, 193, 4, 30, 6, 132, 7, 229, 8, 51, 10, 83, 11, 38, 12, 193, 12, 23, 13, 29, 13, 252, 12, 184, 12, 63, 12, 167, 11, 240, 10, 10, 10,
-255, 8, 218, 7, 149, 6, 60, 5, 219, 3, 120, 2, 45, 1, 250, 255, 227, 254, 4, 254, 62, 253, 145, 252, 0, 252, 134, 251, 35, 251, 239, 250, 253, 250, 62, 251, 201, 251, 143, 252, 110, 253, 98, 254, 89, 255, 79, 0, 68, 1, 78, 2, 100, 3, 134, 4, 175, 5, 189, 6, 175, 7, 104, 8,
-234, 8, 71, 9, 121, 9, 140, 9, 139, 9, 112, 9, 47, 9, 206, 8, 75, 8, 147, 7, 190, 6, 206, 5, 193, 4, 175, 3, 157, 2, 150, 1, 176, 0, 224, 255, 45, 255, 147, 254, 3, 254, 121, 253, 250, 252, 140, 252, 52, 252, 21, 252, 38, 252, 95, 252, 195, 252, 51, 253, 166, 253, 14, 254,
-108, 254, 203, 254, 51, 255, 169, 255, 36, 0, 163, 0, 250, 0, 47, 1, 64, 1, 16, 1, 192, 0, 89, 0, 224, 255, 94, 255, 213, 254, 71, 254, 167, 253, 254, 252, 77, 252, 138, 251, 193, 250, 244, 249, 46, 249, 121, 248, 216, 247, 106, 247, 37, 247, 1, 247, 5, 247, 38, 247, 88, 247, 157, 247,
-8, 248, 148, 248, 70, 249, 59, 250, 73, 251, 108, 252, 143, 253, 164, 254, 170, 255, 151, 0, 131, 1, 112, 2, 98, 3, 77, 4, 35, 5, 216, 5, 63, 6, 114, 6, 111, 6, 28, 6, 171, 5, 32, 5, 116, 4, 176, 3, 215, 2, 224, 1, 203, 0, 162, 255, 101, 254, 20, 253, 192, 251, 111, 250,
-52, 249, 18, 248, 12, 247, 67, 246, 152, 245, 5, 245, 150, 244, 62, 244, 253, 243, 233, 243, 22, 244, 118, 244, 28, 245, 6, 246, 12, 247, 41, 248, 73, 249, 104, 250, 136, 251, 176, 252, 235, 253, 50, 255, 127, 0, 189, 1, 231, 2, 232, 3, 183, 4, 104, 5, 251, 5, 115, 6, 223, 6, 63, 7,
-130, 7, 173, 7, 192, 7, 167, 7, 109, 7, 28, 7, 172, 6, 46, 6, 173, 5, 49, 5, 205, 4, 124, 4, 67, 4, 29, 4, 251, 3, 220, 3, 182, 3, 154, 3, 138, 3, 158, 3, 220, 3, 58, 4, 186, 4, 68, 5, 202, 5, 68, 6, 170, 6, 10, 7, 100, 7, 207, 7, 55, 8, 154, 8,
-229, 8, 3, 9, 251, 8, 191, 8, 84, 8, 211, 7, 66, 7, 163, 6, 253, 5, 82, 5, 152, 4, 210, 3, 1, 3, 34, 2, 60, 1, 82, 0, 108, 255, 152, 254, 217, 253, 64, 253, 214, 252, 139, 252, 103, 252, 97, 252, 108, 252, 138, 252, 207, 252, 55, 253, 194, 253, 148, 254, 133, 255, 141, 0,
-164, 1, 176, 2, 177, 3, 163, 4, 146, 5, 130, 6, 118, 7, 101, 8, 61, 9, 253, 9, 107, 10, 163, 10, 165, 10, 92, 10, 235, 9, 92, 9, 173, 8, 223, 7, 252, 6, 252, 5, 216, 4, 157, 3, 75, 2, 225, 0, 114, 255, 1, 254, 160, 252, 90, 251, 46, 250, 50, 249, 89, 248, 151, 247,
-238, 246, 92, 246, 223, 245, 130, 245, 106, 245, 134, 245, 218, 245, 129, 246, 68, 247, 30, 248, 2, 249, 229, 249, 200, 250, 179, 251, 175, 252, 180, 253, 196, 254, 195, 255, 170, 0, 113, 1, 248, 1, 92, 2, 160, 2, 187, 2, 196, 2, 185, 2, 140, 2, 62, 2, 213, 1, 66, 1, 136, 0, 183, 255,
-208, 254, 216, 253, 226, 252, 241, 251, 30, 251, 98, 250, 188, 249, 60, 249, 199, 248, 91, 248, 254, 247, 179, 247, 125, 247, 114, 247, 167, 247, 2, 248, 136, 248, 45, 249, 214, 249, 125, 250, 28, 251, 188, 251, 96, 252, 24, 253, 215, 253, 153, 254, 77, 255, 213, 255, 59, 0, 112, 0, 113, 0, 90, 0,
-47, 0, 241, 255, 171, 255, 93, 255, 252, 254, 139, 254, 13, 254, 122, 253, 217, 252, 49, 252, 136, 251, 236, 250, 99, 250, 249, 249, 195, 249, 174, 249, 190, 249, 245, 249, 64, 250, 160, 250, 37, 251, 210, 251, 163, 252, 182, 253, 244, 254, 75, 0, 181, 1, 21, 3, 107, 4, 176, 5, 237, 6, 42, 8,
-106, 9, 168, 10, 204, 11, 214, 12, 149, 13, 13, 14, 75, 14, 57, 14, 236, 13, 123, 13, 227, 12, 32, 12, 66, 11, 70, 10, 23, 9, 210, 7, 119, 6, 251, 4, 122, 3, 246, 1, 128, 0, 39, 255, 234, 253, 217, 252, 247, 251, 48, 251, 134, 250, 254, 249, 143, 249, 60, 249, 55, 249, 106, 249,
-211, 249, 145, 250, 114, 251, 108, 252, 115, 253, 126, 254, 140, 255, 155, 0, 195, 1, 246, 2, 50, 4, 98, 5, 122, 6, 118, 7, 44, 8, 191, 8, 47, 9, 114, 9, 160, 9, 186, 9, 176, 9, 128, 9, 51, 9, 189, 8, 24, 8, 88, 7, 127, 6, 143, 5, 159, 4, 177, 3, 219, 2, 30, 2,
-118, 1, 234, 0, 108, 0, 247, 255, 134, 255, 35, 255, 212, 254, 164, 254, 173, 254, 218, 254, 45, 255, 155, 255, 7, 0, 111, 0, 197, 0, 22, 1, 100, 1, 186, 1, 21, 2, 108, 2, 178, 2, 205, 2, 194, 2, 135, 2, 19, 2, 134, 1, 226, 0, 48, 0, 116, 255, 176, 254, 228, 253, 9, 253,
-37, 252, 53, 251, 59, 250, 62, 249, 65, 248, 88, 247, 134, 246, 205, 245, 85, 245, 254, 244, 201, 244, 198, 244, 216, 244, 255, 244, 74, 245, 192, 245, 90, 246, 43, 247, 48, 248, 74, 249, 117, 250, 150, 251, 174, 252, 185, 253, 181, 254, 181, 255, 184, 0, 188, 1, 175, 2, 139, 3, 48, 4, 150, 4,
-205, 4, 195, 4, 139, 4, 56, 4, 202, 3, 62, 3, 158, 2, 233, 1, 14, 1, 31, 0, 30, 255, 4, 254, 227, 252, 194, 251, 170, 250, 179, 249, 214, 248, 31, 248, 153, 247, 43, 247, 212, 246, 157, 246, 122, 246, 109, 246, 160, 246, 9, 247, 162, 247, 129, 248, 133, 249, 154, 250, 183, 251, 206, 252,
-227, 253, 245, 254, 19, 0, 56, 1, 100, 2, 130, 3, 135, 4, 114, 5, 34, 6, 173, 6, 27, 7, 106, 7, 163, 7, 206, 7, 230, 7, 218, 7, 180, 7, 115, 7, 2, 7, 124, 6, 225, 5, 47, 5, 128, 4, 214, 3, 65, 3, 201, 2, 103, 2, 31, 2, 229, 1, 178, 1, 131, 1, 93, 1,
-73, 1, 73, 1, 135, 1, 228, 1, 97, 2, 249, 2, 145, 3, 38, 4, 171, 4, 44, 5, 173, 5, 48, 6, 191, 6, 73, 7, 199, 7, 24, 8, 70, 8, 76, 8, 24, 8, 204, 7, 108, 7, 252, 6, 134, 6, 9, 6, 126, 5, 231, 4, 70, 4, 150, 3, 219, 2, 28, 2, 91, 1, 168, 0,
-10, 0, 130, 255, 45, 255, 249, 254, 224, 254, 234, 254, 7, 255, 54, 255, 125, 255, 237, 255, 127, 0, 60, 1, 49, 2, 55, 3, 76, 4, 85, 5, 79, 6, 57, 7, 11, 8, 217, 8, 163, 9, 102, 10, 17, 11, 159, 11, 251, 11, 7, 12, 223, 11, 127, 11, 222, 10, 34, 10, 75, 9, 83, 8,
-67, 7, 28, 6, 213, 4, 113, 3, 249, 1, 110, 0, 217, 254, 70, 253, 189, 251, 84, 250, 8, 249, 221, 247, 231, 246, 10, 246, 67, 245, 158, 244, 19, 244, 166, 243, 118, 243, 136, 243, 206, 243, 91, 244, 28, 245, 242, 245, 218, 246, 197, 247, 178, 248, 162, 249, 169, 250, 186, 251, 211, 252, 231, 253,
-226, 254, 195, 255, 113, 0, 243, 0, 88, 1, 158, 1, 200, 1, 226, 1, 232, 1, 195, 1, 132, 1, 43, 1, 161, 0, 1, 0, 78, 255, 131, 254, 188, 253, 253, 252, 75, 252, 185, 251, 60, 251, 216, 250, 138, 250, 67, 250, 2, 250, 214, 249, 193, 249, 196, 249, 4, 250, 109, 250, 245, 250, 158, 251,
-72, 252, 238, 252, 138, 253, 32, 254, 184, 254, 86, 255, 254, 255, 161, 0, 60, 1, 169, 1, 236, 1, 8, 2, 235, 1, 172, 1, 87, 1, 244, 0, 127, 0, 0, 0, 117, 255, 213, 254, 39, 254, 106, 253, 155, 252, 200, 251, 242, 250, 44, 250, 127, 249, 235, 248, 138, 248, 88, 248, 70, 248, 88, 248,
-142, 248, 219, 248, 68, 249, 231, 249, 177, 250, 166, 251, 226, 252, 52, 254, 150, 255, 247, 0, 77, 2, 155, 3, 218, 4, 34, 6, 111, 7, 191, 8, 255, 9, 34, 11, 29, 12, 191, 12, 41, 13, 91, 13, 64, 13, 0, 13, 160, 12, 24, 12, 108, 11, 164, 10, 187, 9, 170, 8, 132, 7, 70, 6,
-249, 4, 171, 3, 98, 2, 58, 1, 45, 0, 60, 255, 131, 254, 226, 253, 87, 253, 236, 252, 157, 252, 105, 252, 104, 252, 171, 252, 31, 253, 202, 253, 171, 254, 154, 255, 148, 0, 145, 1, 141, 2, 140, 3, 152, 4, 173, 5, 195, 6, 203, 7, 175, 8, 112, 9, 254, 9, 80, 10, 131, 10, 147, 10,
-124, 10, 82, 10, 19, 10, 162, 9, 21, 9, 108, 8, 144, 7, 156, 6, 150, 5, 123, 4, 100, 3, 86, 2, 88, 1, 128, 0, 192, 255, 22, 255, 137, 254, 3, 254, 135, 253, 32, 253, 211, 252, 163, 252, 171, 252, 226, 252, 55, 253, 170, 253, 33, 254, 147, 254, 250, 254, 91, 255, 190, 255, 34, 0,
-150, 0, 1, 1, 94, 1, 153, 1, 164, 1, 137, 1, 63, 1, 208, 0, 80, 0, 193, 255, 39, 255, 133, 254, 217, 253, 33, 253, 93, 252, 143, 251, 181, 250, 217, 249, 255, 248, 51, 248, 135, 247, 246, 246, 144, 246, 94, 246, 73, 246, 82, 246, 127, 246, 193, 246, 24, 247, 163, 247, 84, 248, 43, 249,
-55, 250, 86, 251, 126, 252, 159, 253, 174, 254, 175, 255, 161, 0, 146, 1, 130, 2, 111, 3, 70, 4, 252, 4, 141, 5, 204, 5, 214, 5, 178, 5, 84, 5, 215, 4, 66, 4, 146, 3, 199, 2, 231, 1, 237, 0, 215, 255, 175, 254, 118, 253, 51, 252, 246, 250, 192, 249, 172, 248, 188, 247, 237, 246,
-77, 246, 208, 245, 106, 245, 31, 245, 249, 244, 244, 244, 22, 245, 138, 245, 43, 246, 249, 246, 3, 248, 23, 249, 50, 250, 77, 251, 103, 252, 130, 253, 169, 254, 217, 255, 11, 1, 56, 2, 67, 3, 50, 4, 252, 4, 145, 5, 14, 6, 116, 6, 198, 6, 7, 7, 57, 7, 83, 7, 76, 7, 46, 7,
-238, 6, 142, 6, 31, 6, 160, 5, 34, 5, 173, 4, 70, 4, 4, 4, 213, 3, 183, 3, 172, 3, 163, 3, 158, 3, 163, 3, 190, 3, 239, 3, 73, 4, 207, 4, 104, 5, 20, 6, 188, 6, 86, 7, 225, 7, 89, 8, 205, 8, 63, 9, 182, 9, 27, 10, 110, 10, 159, 10, 152, 10, 108, 10,
-20, 10, 145, 9, 254, 8, 95, 8, 175, 7, 246, 6, 53, 6, 97, 5, 131, 4, 155, 3, 168, 2, 180, 1, 196, 0, 227, 255, 34, 255, 124, 254, 250, 253, 169, 253, 115, 253, 87, 253, 93, 253, 121, 253, 172, 253, 14, 254, 158, 254, 83, 255, 57, 0, 56, 1, 62, 2, 65, 3, 53, 4, 32, 5,
-254, 5, 220, 6, 184, 7, 144, 8, 79, 9, 234, 9, 94, 10, 134, 10, 114, 10, 49, 10, 189, 9, 35, 9, 116, 8, 175, 7, 197, 6, 199, 5, 181, 4, 124, 3, 49, 2, 217, 0, 117, 255, 23, 254, 195, 252, 140, 251, 121, 250, 131, 249, 181, 248, 6, 248, 107, 247, 228, 246, 130, 246, 64, 246,
-32, 246, 86, 246, 185, 246, 71, 247, 5, 248, 211, 248, 168, 249, 122, 250, 79, 251, 40, 252, 12, 253, 251, 253, 230, 254, 204, 255, 139, 0, 40, 1, 161, 1, 224, 1, 4, 2, 16, 2, 1, 2, 222, 1, 168, 1, 82, 1, 220, 0, 76, 0, 156, 255, 206, 254, 242, 253, 12, 253, 42, 252, 88, 251,
-149, 250, 249, 249, 122, 249, 15, 249, 186, 248, 116, 248, 57, 248, 17, 248, 15, 248, 46, 248, 120, 248, 255, 248, 158, 249, 82, 250, 12, 251, 191, 251, 109, 252, 20, 253, 192, 253, 113, 254, 42, 255, 216, 255, 117, 0, 245, 0, 58, 1, 92, 1, 92, 1, 46, 1, 242, 0, 169, 0, 79, 0, 232, 255,
-117, 255, 240, 254, 89, 254, 181, 253, 7, 253, 83, 252, 166, 251, 6, 251, 136, 250, 41, 250, 236, 249, 229, 249, 250, 249, 43, 250, 121, 250, 232, 250, 115, 251, 42, 252, 26, 253, 48, 254, 114, 255, 210, 0, 53, 2, 150, 3, 231, 4, 48, 6, 113, 7, 180, 8, 247, 9, 53, 11, 84, 12, 69, 13,
-10, 14, 127, 14, 168, 14, 162, 14, 98, 14, 239, 13, 97, 13, 184, 12, 224, 11, 238, 10, 227, 9, 175, 8, 100, 7, 9, 6, 164, 4, 66, 3, 235, 1, 173, 0, 155, 255, 167, 254, 213, 253, 46, 253, 157, 252, 33, 252, 211, 251, 169, 251, 165, 251, 238, 251, 109, 252, 20, 253, 229, 253, 200, 254,
-177, 255, 154, 0, 136, 1, 125, 2, 123, 3, 135, 4, 143, 5, 142, 6, 98, 7, 13, 8, 148, 8, 225, 8, 14, 9, 35, 9, 30, 9, 254, 8, 202, 8, 123, 8, 1, 8, 109, 7, 190, 6, 234, 5, 11, 5, 36, 4, 63, 3, 109, 2, 173, 1, 12, 1, 138, 0, 26, 0, 186, 255, 105, 255,
-34, 255, 233, 254, 214, 254, 227, 254, 18, 255, 121, 255, 243, 255, 122, 0, 255, 0, 117, 1, 224, 1, 63, 2, 155, 2, 245, 2, 76, 3, 148, 3, 194, 3, 207, 3, 157, 3, 70, 3, 202, 2, 35, 2, 109, 1, 170, 0, 215, 255, 250, 254, 19, 254, 28, 253, 26, 252, 14, 251, 249, 249, 232, 248,
-227, 247, 237, 246, 34, 246, 122, 245, 246, 244, 170, 244, 129, 244, 113, 244, 130, 244, 182, 244, 9, 245, 133, 245, 65, 246, 32, 247, 36, 248, 72, 249, 110, 250, 145, 251, 161, 252, 170, 253, 173, 254, 172, 255, 172, 0, 167, 1, 140, 2, 69, 3, 215, 3, 49, 4, 70, 4, 55, 4, 4, 4, 168, 3,
-59, 3, 188, 2, 29, 2, 105, 1, 161, 0, 187, 255, 194, 254, 191, 253, 180, 252, 177, 251, 190, 250, 225, 249, 50, 249, 160, 248, 45, 248, 225, 247, 170, 247, 135, 247, 135, 247, 175, 247, 251, 247, 133, 248, 68, 249, 35, 250, 33, 251, 40, 252, 46, 253, 48, 254, 45, 255, 46, 0, 52, 1, 66, 2,
-73, 3, 69, 4, 27, 5, 201, 5, 85, 6, 177, 6, 242, 6, 33, 7, 58, 7, 69, 7, 61, 7, 30, 7, 227, 6, 139, 6, 26, 6, 146, 5, 253, 4, 96, 4, 206, 3, 78, 3, 224, 2, 146, 2, 98, 2, 64, 2, 44, 2, 35, 2, 35, 2, 44, 2, 91, 2, 169, 2, 21, 3, 178, 3,
-98, 4, 27, 5, 208, 5, 118, 6, 15, 7, 154, 7, 33, 8, 165, 8, 40, 9, 149, 9, 234, 9, 37, 10, 29, 10, 242, 9, 168, 9, 55, 9, 184, 8, 45, 8, 150, 7, 240, 6, 63, 6, 129, 5, 176, 4, 214, 3, 245, 2, 22, 2, 67, 1, 124, 0, 220, 255, 92, 255, 250, 254, 194, 254,
-169, 254, 164, 254, 183, 254, 231, 254, 50, 255, 160, 255, 71, 0, 16, 1, 251, 1, 255, 2, 3, 4, 5, 5, 239, 5, 206, 6, 165, 7, 115, 8, 61, 9, 251, 9, 162, 10, 18, 11, 86, 11, 103, 11, 36, 11, 189, 10, 50, 10, 123, 9, 176, 8, 209, 7, 210, 6, 186, 5, 141, 4, 66, 3,
-225, 1, 118, 0, 4, 255, 156, 253, 68, 252, 252, 250, 232, 249, 237, 248, 11, 248, 79, 247, 168, 246, 23, 246, 168, 245, 106, 245, 85, 245, 121, 245, 223, 245, 103, 246, 13, 247, 198, 247, 130, 248, 62, 249, 255, 249, 202, 250, 158, 251, 129, 252, 95, 253, 49, 254, 236, 254, 117, 255, 224, 255, 39, 0,
-70, 0, 85, 0, 87, 0, 62, 0, 23, 0, 226, 255, 135, 255, 24, 255, 150, 254, 253, 253, 91, 253, 185, 252, 31, 252, 155, 251, 44, 251, 217, 250, 167, 250, 134, 250, 116, 250, 117, 250, 129, 250, 156, 250, 221, 250, 67, 251, 200, 251, 124, 252, 68, 253, 19, 254, 228, 254, 164, 255, 90, 0, 7, 1,
-176, 1, 89, 2, 255, 2, 144, 3, 3, 4, 89, 4, 115, 4, 94, 4, 40, 4, 205, 3, 90, 3, 217, 2, 75, 2, 164, 1, 239, 0, 42, 0, 72, 255, 91, 254, 99, 253, 108, 252, 131, 251, 170, 250, 246, 249, 109, 249, 7, 249, 206, 248, 189, 248, 198, 248, 239, 248, 63, 249, 181, 249, 80, 250,
-50, 251, 61, 252, 109, 253, 191, 254, 21, 0, 108, 1, 183, 2, 250, 3, 59, 5, 125, 6, 196, 7, 3, 9, 50, 10, 51, 11, 5, 12, 169, 12, 254, 12, 32, 13, 26, 13, 235, 12, 152, 12, 43, 12, 157, 11, 236, 10, 34, 10, 57, 9, 54, 8, 38, 7, 11, 6, 250, 4, 246, 3, 4, 3,
-59, 2, 145, 1, 255, 0, 142, 0, 53, 0, 240, 255, 199, 255, 205, 255, 246, 255, 77, 0, 228, 0, 149, 1, 94, 2, 52, 3, 6, 4, 213, 4, 159, 5, 109, 6, 63, 7, 20, 8, 221, 8, 147, 9, 40, 10, 131, 10, 185, 10, 195, 10, 156, 10, 93, 10, 9, 10, 153, 9, 18, 9, 117, 8,
-184, 7, 222, 6, 239, 5, 236, 4, 223, 3, 211, 2, 204, 1, 225, 0, 12, 0, 78, 255, 188, 254, 59, 254, 202, 253, 112, 253, 42, 253, 248, 252, 234, 252, 13, 253, 81, 253, 191, 253, 77, 254, 225, 254, 119, 255, 0, 0, 128, 0, 246, 0, 107, 1, 223, 1, 80, 2, 176, 2, 238, 2, 13, 3,
-251, 2, 178, 2, 75, 2, 196, 1, 37, 1, 124, 0, 203, 255, 8, 255, 60, 254, 103, 253, 123, 252, 139, 251, 150, 250, 160, 249, 189, 248, 236, 247, 59, 247, 187, 246, 93, 246, 37, 246, 27, 246, 40, 246, 75, 246, 149, 246, 254, 246, 132, 247, 69, 248, 42, 249, 42, 250, 73, 251, 102, 252, 126, 253,
-144, 254, 144, 255, 139, 0, 133, 1, 121, 2, 95, 3, 53, 4, 215, 4, 72, 5, 142, 5, 147, 5, 108, 5, 40, 5, 197, 4, 74, 4, 189, 3, 25, 3, 86, 2, 127, 1, 145, 0, 137, 255, 122, 254, 103, 253, 91, 252, 101, 251, 131, 250, 201, 249, 49, 249, 177, 248, 80, 248, 8, 248, 213, 247,
-189, 247, 214, 247, 23, 248, 130, 248, 49, 249, 250, 249, 218, 250, 201, 251, 179, 252, 153, 253, 121, 254, 93, 255, 68, 0, 50, 1, 26, 2, 241, 2, 180, 3, 68, 4, 180, 4, 4, 5, 48, 5, 75, 5, 89, 5, 91, 5, 77, 5, 48, 5, 2, 5, 189, 4, 106, 4, 10, 4, 164, 3, 67, 3,
-234, 2, 173, 2, 134, 2, 117, 2, 132, 2, 165, 2, 210, 2, 10, 3, 82, 3, 170, 3, 25, 4, 181, 4, 109, 5, 70, 6, 58, 7, 45, 8, 29, 9, 240, 9, 176, 10, 98, 11, 5, 12, 158, 12, 45, 13, 171, 13, 253, 13, 42, 14, 38, 14, 220, 13, 113, 13, 227, 12, 50, 12, 115, 11,
-168, 10, 202, 9, 219, 8, 222, 7, 206, 6, 173, 5, 132, 4, 89, 3, 55, 2, 35, 1, 36, 0, 84, 255, 161, 254, 11, 254, 162, 253, 82, 253, 24, 253, 0, 253, 12, 253, 56, 253, 152, 253, 40, 254, 213, 254, 160, 255, 119, 0, 78, 1, 36, 2, 245, 2, 200, 3, 160, 4, 123, 5, 78, 6,
-21, 7, 177, 7, 28, 8, 92, 8, 98, 8, 58, 8, 248, 7, 155, 7, 39, 7, 161, 6, 11, 6, 82, 5, 131, 4, 159, 3, 162, 2, 154, 1, 142, 0, 138, 255, 151, 254, 182, 253, 240, 252, 78, 252, 189, 251, 61, 251, 215, 250, 126, 250, 51, 250, 23, 250, 31, 250, 72, 250, 173, 250, 53, 251,
-208, 251, 117, 252, 24, 253, 182, 253, 75, 254, 224, 254, 119, 255, 16, 0, 164, 0, 39, 1, 149, 1, 211, 1, 236, 1, 230, 1, 187, 1, 120, 1, 37, 1, 193, 0, 71, 0, 188, 255, 29, 255, 99, 254, 156, 253, 200, 252, 242, 251, 35, 251, 93, 250, 179, 249, 36, 249, 173, 248, 89, 248, 30, 248,
-243, 247, 221, 247, 227, 247, 1, 248, 60, 248, 176, 248, 74, 249, 9, 250, 238, 250, 222, 251, 213, 252, 189, 253, 160, 254, 127, 255, 90, 0, 56, 1, 19, 2, 226, 2, 143, 3, 24, 4, 120, 4, 143, 4, 132, 4, 89, 4, 11, 4, 174, 3, 69, 3, 202, 2, 61, 2, 162, 1, 243, 0, 46, 0,
-97, 255, 140, 254, 190, 253, 0, 253, 82, 252, 213, 251, 121, 251, 59, 251, 46, 251, 61, 251, 100, 251, 176, 251, 34, 252, 182, 252, 121, 253, 112, 254, 134, 255, 186, 0, 250, 1, 61, 3, 129, 4, 190, 5, 254, 6, 65, 8, 133, 9, 191, 10, 233, 11, 236, 12, 178, 13, 72, 14, 162, 14, 187, 14,
-179, 14, 137, 14, 57, 14, 209, 13, 81, 13, 170, 12, 227, 11, 4, 11, 6, 10, 245, 8, 222, 7, 201, 6, 194, 5, 204, 4, 236, 3, 49, 3, 137, 2, 243, 1, 116, 1, 5, 1, 168, 0, 113, 0, 102, 0, 127, 0, 210, 0, 78, 1, 224, 1, 133, 2, 40, 3, 199, 3, 98, 4, 248, 4,
-144, 5, 42, 6, 188, 6, 59, 7, 168, 7, 231, 7, 254, 7, 248, 7, 204, 7, 134, 7, 49, 7, 204, 6, 79, 6, 194, 5, 35, 5, 104, 4, 161, 3, 206, 2, 252, 1, 50, 1, 115, 0, 208, 255, 76, 255, 224, 254, 148, 254, 101, 254, 71, 254, 60, 254, 71, 254, 103, 254, 159, 254, 10, 255,
-152, 255, 67, 0, 16, 1, 228, 1, 184, 2, 125, 3, 47, 4, 213, 4, 111, 5, 255, 5, 132, 6, 252, 6, 69, 7, 102, 7, 94, 7, 6, 7, 131, 6, 221, 5, 17, 5, 50, 4, 70, 3, 75, 2, 63, 1, 39, 0, 0, 255, 198, 253, 134, 252, 66, 251, 4, 250, 210, 248, 175, 247, 183, 246,
-227, 245, 47, 245, 172, 244, 80, 244, 15, 244, 241, 243, 2, 244, 53, 244, 143, 244, 42, 245, 224, 245, 179, 246, 157, 247, 138, 248, 120, 249, 100, 250, 84, 251, 73, 252, 69, 253, 62, 254, 43, 255, 2, 0, 163, 0, 32, 1, 115, 1, 141, 1, 145, 1, 130, 1, 92, 1, 40, 1, 231, 0, 142, 0,
-29, 0, 155, 255, 5, 255, 99, 254, 193, 253, 34, 253, 149, 252, 29, 252, 188, 251, 127, 251, 87, 251, 65, 251, 59, 251, 69, 251, 94, 251, 142, 251, 232, 251, 97, 252, 2, 253, 206, 253, 169, 254, 140, 255, 107, 0, 62, 1, 4, 2, 191, 2, 119, 3, 43, 4, 217, 4, 113, 5, 246, 5, 89, 6,
-142, 6, 166, 6, 160, 6, 123, 6, 74, 6, 13, 6, 185, 5, 86, 5, 229, 4, 94, 4, 197, 3, 35, 3, 130, 2, 231, 1, 90, 1, 231, 0, 146, 0, 86, 0, 53, 0, 52, 0, 64, 0, 87, 0, 136, 0, 202, 0, 29, 1, 158, 1, 68, 2, 7, 3, 239, 3, 229, 4, 220, 5, 204, 6,
-166, 7, 116, 8, 54, 9, 239, 9, 160, 10, 71, 11, 203, 11, 39, 12, 93, 12, 79, 12, 16, 12, 176, 11, 44, 11, 145, 10, 235, 9, 54, 9, 111, 8, 155, 7, 185, 6, 195, 5, 196, 4, 191, 3, 193, 2, 205, 1, 230, 0, 34, 0, 127, 255, 246, 254, 146, 254, 79, 254, 35, 254, 17, 254,
-42, 254, 95, 254, 178, 254, 63, 255, 232, 255, 166, 0, 122, 1, 77, 2, 31, 3, 233, 3, 182, 4, 134, 5, 88, 6, 41, 7, 237, 7, 159, 8, 18, 9, 93, 9, 125, 9, 88, 9, 21, 9, 187, 8, 67, 8, 185, 7, 30, 7, 103, 6, 148, 5, 171, 4, 170, 3, 149, 2, 124, 1, 99, 0,
-86, 255, 91, 254, 115, 253, 171, 252, 248, 251, 85, 251, 194, 250, 63, 250, 201, 249, 103, 249, 48, 249, 28, 249, 45, 249, 121, 249, 219, 249, 78, 250, 203, 250, 68, 251, 187, 251, 45, 252, 164, 252, 30, 253, 150, 253, 4, 254, 98, 254, 165, 254, 188, 254, 186, 254, 159, 254, 102, 254, 36, 254, 216, 253,
-124, 253, 16, 253, 151, 252, 8, 252, 106, 251, 196, 250, 24, 250, 124, 249, 236, 248, 108, 248, 23, 248, 219, 247, 184, 247, 188, 247, 211, 247, 252, 247, 61, 248, 150, 248, 7, 249, 158, 249, 100, 250, 71, 251, 79, 252, 104, 253, 131, 254, 158, 255, 163, 0, 160, 1, 150, 2, 131, 3, 110, 4, 80, 5,
-20, 6, 178, 6, 42, 7, 99, 7, 95, 7, 56, 7, 235, 6, 122, 6, 249, 5, 106, 5, 184, 4, 248, 3, 39, 3, 55, 2, 60, 1, 58, 0, 49, 255, 50, 254, 64, 253, 100, 252, 176, 251, 24, 251, 160, 250, 83, 250, 33, 250, 10, 250, 34, 250, 95, 250, 193, 250, 93, 251, 36, 252, 9, 253,
-7, 254, 18, 255, 32, 0, 41, 1, 60, 2, 83, 3, 112, 4, 152, 5, 185, 6, 207, 7, 188, 8, 127, 9, 30, 10, 130, 10, 192, 10, 227, 10, 234, 10, 211, 10, 168, 10, 101, 10, 250, 9, 119, 9, 223, 8, 41, 8, 109, 7, 173, 6, 245, 5, 78, 5, 184, 4, 62, 4, 222, 3, 140, 3,
-76, 3, 28, 3, 250, 2, 231, 2, 249, 2, 41, 3, 120, 3, 250, 3, 145, 4, 56, 5, 227, 5, 132, 6, 29, 7, 171, 7, 49, 8, 177, 8, 45, 9, 147, 9, 224, 9, 19, 10, 11, 10, 225, 9, 150, 9, 41, 9, 167, 8, 21, 8, 118, 7, 191, 6, 248, 5, 27, 5, 39, 4, 42, 3,
-36, 2, 37, 1, 51, 0, 79, 255, 148, 254, 243, 253, 105, 253, 10, 253, 190, 252, 132, 252, 96, 252, 88, 252, 102, 252, 144, 252, 239, 252, 108, 253, 6, 254, 195, 254, 128, 255, 59, 0, 236, 0, 146, 1, 46, 2, 196, 2, 85, 3, 222, 3, 84, 4, 161, 4, 202, 4, 195, 4, 116, 4, 5, 4,
-119, 3, 194, 2, 2, 2, 56, 1, 89, 0, 110, 255, 119, 254, 110, 253, 93, 252, 72, 251, 51, 250, 43, 249, 50, 248, 75, 247, 146, 246, 245, 245, 116, 245, 37, 245, 241, 244, 213, 244, 231, 244, 28, 245, 114, 245, 250, 245, 174, 246, 124, 247, 101, 248, 86, 249, 71, 250, 54, 251, 30, 252, 8, 253,
-246, 253, 231, 254, 210, 255, 178, 0, 108, 1, 250, 1, 100, 2, 154, 2, 166, 2, 157, 2, 125, 2, 74, 2, 8, 2, 184, 1, 74, 1, 199, 0, 50, 0, 136, 255, 214, 254, 35, 254, 119, 253, 222, 252, 85, 252, 228, 251, 147, 251, 82, 251, 33, 251, 0, 251, 236, 250, 230, 250, 252, 250, 51, 251,
-134, 251, 4, 252, 160, 252, 75, 253, 255, 253, 171, 254, 82, 255, 238, 255, 135, 0, 30, 1, 181, 1, 66, 2, 191, 2, 40, 3, 101, 3, 130, 3, 135, 3, 109, 3, 73, 3, 31, 3, 236, 2, 175, 2, 104, 2, 20, 2, 170, 1, 58, 1, 197, 0, 81, 0, 239, 255, 157, 255, 104, 255, 84, 255,
-91, 255, 127, 255, 190, 255, 12, 0, 107, 0, 224, 0, 102, 1, 0, 2, 200, 2, 172, 3, 170, 4, 202, 5, 237, 6, 16, 8, 26, 9, 19, 10, 251, 10, 203, 11, 147, 12, 78, 13, 244, 13, 111, 14, 194, 14, 236, 14, 193, 14, 111, 14, 251, 13, 87, 13, 163, 12, 224, 11, 1, 11, 18, 10,
-19, 9, 251, 7, 212, 6, 166, 5, 115, 4, 72, 3, 39, 2, 19, 1, 35, 0, 75, 255, 137, 254, 239, 253, 110, 253, 4, 253, 186, 252, 151, 252, 146, 252, 178, 252, 11, 253, 126, 253, 10, 254, 175, 254, 84, 255, 246, 255, 156, 0, 68, 1, 241, 1, 169, 2, 101, 3, 26, 4, 187, 4, 49, 5,
-135, 5, 178, 5, 169, 5, 139, 5, 92, 5, 19, 5, 191, 4, 94, 4, 223, 3, 72, 3, 159, 2, 220, 1, 13, 1, 59, 0, 108, 255, 169, 254, 245, 253, 84, 253, 209, 252, 93, 252, 247, 251, 164, 251, 92, 251, 31, 251, 251, 250, 245, 250, 10, 251, 72, 251, 169, 251, 28, 252, 158, 252, 29, 253,
-151, 253, 11, 254, 118, 254, 225, 254, 77, 255, 179, 255, 10, 0, 79, 0, 109, 0, 99, 0, 61, 0, 245, 255, 151, 255, 46, 255, 186, 254, 55, 254, 167, 253, 11, 253, 83, 252, 146, 251, 202, 250, 255, 249, 65, 249, 144, 248, 246, 247, 126, 247, 30, 247, 221, 246, 189, 246, 178, 246, 188, 246, 227, 246,
-33, 247, 118, 247, 248, 247, 161, 248, 105, 249, 88, 250, 86, 251, 91, 252, 91, 253, 78, 254, 59, 255, 35, 0, 6, 1, 231, 1, 199, 2, 134, 3, 40, 4, 169, 4, 229, 4, 247, 4, 230, 4, 175, 4, 94, 4, 254, 3, 139, 3, 253, 2, 95, 2, 175, 1, 227, 0, 15, 0, 53, 255, 91, 254,
-139, 253, 197, 252, 30, 252, 148, 251, 33, 251, 212, 250, 168, 250, 147, 250, 156, 250, 206, 250, 32, 251, 150, 251, 74, 252, 29, 253, 15, 254, 30, 255, 48, 0, 68, 1, 88, 2, 106, 3, 126, 4, 158, 5, 196, 6, 230, 7, 254, 8, 236, 9, 179, 10, 82, 11, 168, 11, 223, 11, 250, 11, 241, 11,
-209, 11, 158, 11, 75, 11, 213, 10, 72, 10, 162, 9, 224, 8, 24, 8, 77, 7, 134, 6, 203, 5, 31, 5, 142, 4, 14, 4, 158, 3, 65, 3, 239, 2, 169, 2, 119, 2, 95, 2, 96, 2, 132, 2, 210, 2, 51, 3, 165, 3, 27, 4, 139, 4, 245, 4, 84, 5, 177, 5, 11, 6, 100, 6,
-176, 6, 235, 6, 8, 7, 248, 6, 203, 6, 125, 6, 18, 6, 156, 5, 29, 5, 142, 4, 246, 3, 84, 3, 152, 2, 210, 1, 5, 1, 48, 0, 103, 255, 170, 254, 255, 253, 119, 253, 8, 253, 181, 252, 136, 252, 112, 252, 107, 252, 132, 252, 175, 252, 237, 252, 80, 253, 214, 253, 120, 254, 63, 255,
-25, 0, 248, 0, 213, 1, 160, 2, 93, 3, 10, 4, 172, 4, 67, 5, 208, 5, 71, 6, 151, 6, 196, 6, 180, 6, 104, 6, 247, 5, 93, 5, 163, 4, 214, 3, 249, 2, 3, 2, 255, 0, 235, 255, 190, 254, 140, 253, 86, 252, 31, 251, 245, 249, 215, 248, 205, 247, 228, 246, 19, 246, 95, 245,
-216, 244, 105, 244, 19, 244, 241, 243, 233, 243, 254, 243, 83, 244, 203, 244, 95, 245, 25, 246, 222, 246, 168, 247, 114, 248, 58, 249, 5, 250, 215, 250, 176, 251, 136, 252, 97, 253, 20, 254, 173, 254, 42, 255, 109, 255, 153, 255, 178, 255, 182, 255, 173, 255, 154, 255, 124, 255, 66, 255, 249, 254, 159, 254,
-48, 254, 188, 253, 71, 253, 218, 252, 123, 252, 43, 252, 243, 251, 211, 251, 195, 251, 196, 251, 212, 251, 239, 251, 20, 252, 82, 252, 164, 252, 14, 253, 164, 253, 75, 254, 1, 255, 188, 255, 110, 0, 23, 1, 175, 1, 64, 2, 205, 2, 87, 3, 216, 3, 75, 4, 169, 4, 218, 4, 238, 4, 230, 4,
-181, 4, 123, 4, 54, 4, 231, 3, 143, 3, 47, 3, 188, 2, 59, 2, 178, 1, 33, 1, 149, 0, 20, 0, 162, 255, 81, 255, 21, 255, 242, 254, 246, 254, 14, 255, 56, 255, 124, 255, 208, 255, 52, 0, 176, 0, 79, 1, 9, 2, 226, 2, 219, 3, 220, 4, 226, 5, 216, 6, 189, 7, 146, 8,
-85, 9, 14, 10, 191, 10, 96, 11, 225, 11, 68, 12, 118, 12, 104, 12, 52, 12, 217, 11, 83, 11, 191, 10, 30, 10, 98, 9, 152, 8, 192, 7, 205, 6, 204, 5, 197, 4, 185, 3, 179, 2, 181, 1, 199, 0, 247, 255, 60, 255, 151, 254, 29, 254, 184, 253, 104, 253, 60, 253, 40, 253, 43, 253,
-94, 253, 184, 253, 46, 254, 201, 254, 116, 255, 38, 0, 220, 0, 135, 1, 52, 2, 227, 2, 153, 3, 81, 4, 6, 5, 167, 5, 39, 6, 136, 6, 183, 6, 186, 6, 165, 6, 118, 6, 47, 6, 219, 5, 120, 5, 244, 4, 91, 4, 172, 3, 224, 2, 9, 2, 41, 1, 74, 0, 113, 255, 161, 254,
-231, 253, 66, 253, 171, 252, 39, 252, 180, 251, 75, 251, 234, 250, 159, 250, 104, 250, 70, 250, 84, 250, 125, 250, 189, 250, 19, 251, 105, 251, 188, 251, 9, 252, 81, 252, 152, 252, 224, 252, 46, 253, 117, 253, 179, 253, 207, 253, 207, 253, 180, 253, 117, 253, 37, 253, 202, 252, 106, 252, 0, 252, 142, 251,
-20, 251, 135, 250, 243, 249, 88, 249, 190, 248, 45, 248, 165, 247, 59, 247, 231, 246, 168, 246, 144, 246, 147, 246, 172, 246, 223, 246, 45, 247, 141, 247, 1, 248, 160, 248, 89, 249, 46, 250, 50, 251, 65, 252, 89, 253, 112, 254, 119, 255, 116, 0, 100, 1, 76, 2, 46, 3, 14, 4, 214, 4, 131, 5,
-15, 6, 87, 6, 120, 6, 113, 6, 53, 6, 228, 5, 129, 5, 2, 5, 110, 4, 199, 3, 5, 3, 42, 2, 66, 1, 79, 0, 89, 255, 104, 254, 126, 253, 177, 252, 248, 251, 83, 251, 219, 250, 125, 250, 55, 250, 19, 250, 15, 250, 37, 250, 96, 250, 210, 250, 100, 251, 26, 252, 250, 252, 228, 253,
-213, 254, 201, 255, 190, 0, 178, 1, 176, 2, 183, 3, 193, 4, 193, 5, 173, 6, 129, 7, 41, 8, 166, 8, 6, 9, 73, 9, 111, 9, 133, 9, 138, 9, 109, 9, 57, 9, 239, 8, 129, 8, 1, 8, 117, 7, 225, 6, 78, 6, 194, 5, 67, 5, 214, 4, 122, 4, 47, 4, 243, 3, 195, 3,
-159, 3, 134, 3, 128, 3, 139, 3, 185, 3, 6, 4, 103, 4, 224, 4, 91, 5, 209, 5, 62, 6, 152, 6, 236, 6, 59, 7, 135, 7, 203, 7, 6, 8, 32, 8, 25, 8, 245, 7, 164, 7, 55, 7, 185, 6, 42, 6, 146, 5, 240, 4, 66, 4, 129, 3, 180, 2, 220, 1, 255, 0, 39, 0,
-84, 255, 151, 254, 240, 253, 92, 253, 234, 252, 150, 252, 87, 252, 50, 252, 41, 252, 49, 252, 74, 252, 133, 252, 218, 252, 72, 253, 226, 253, 145, 254, 76, 255, 12, 0, 193, 0, 105, 1, 0, 2, 142, 2, 20, 3, 145, 3, 4, 4, 94, 4, 157, 4, 161, 4, 120, 4, 40, 4, 165, 3, 11, 3,
-96, 2, 162, 1, 216, 0, 2, 0, 23, 255, 29, 254, 25, 253, 10, 252, 251, 250, 240, 249, 234, 248, 254, 247, 40, 247, 105, 246, 212, 245, 96, 245, 6, 245, 207, 244, 183, 244, 183, 244, 214, 244, 34, 245, 142, 245, 27, 246, 212, 246, 154, 247, 108, 248, 61, 249, 11, 250, 216, 250, 163, 251, 116, 252,
-71, 253, 26, 254, 217, 254, 129, 255, 13, 0, 96, 0, 153, 0, 186, 0, 186, 0, 180, 0, 165, 0, 130, 0, 77, 0, 10, 0, 172, 255, 60, 255, 195, 254, 66, 254, 194, 253, 75, 253, 222, 252, 133, 252, 59, 252, 3, 252, 224, 251, 202, 251, 190, 251, 190, 251, 205, 251, 235, 251, 34, 252, 124, 252,
-236, 252, 115, 253, 10, 254, 158, 254, 45, 255, 170, 255, 30, 0, 139, 0, 250, 0, 104, 1, 210, 1, 47, 2, 113, 2, 154, 2, 163, 2, 140, 2, 102, 2, 52, 2, 253, 1, 194, 1, 131, 1, 61, 1, 234, 0, 142, 0, 48, 0, 210, 255, 123, 255, 52, 255, 2, 255, 227, 254, 221, 254, 248, 254,
-41, 255, 109, 255, 206, 255, 59, 0, 182, 0, 72, 1, 239, 1, 171, 2, 140, 3, 136, 4, 148, 5, 171, 6, 181, 7, 176, 8, 150, 9, 93, 10, 24, 11, 200, 11, 101, 12, 238, 12, 97, 13, 157, 13, 167, 13, 137, 13, 49, 13, 179, 12, 32, 12, 119, 11, 187, 10, 240, 9, 22, 9, 30, 8,
-26, 7, 9, 6, 234, 4, 206, 3, 182, 2, 166, 1, 173, 0, 199, 255, 251, 254, 81, 254, 191, 253, 71, 253, 239, 252, 171, 252, 124, 252, 121, 252, 148, 252, 205, 252, 53, 253, 181, 253, 70, 254, 222, 254, 121, 255, 18, 0, 168, 0, 71, 1, 234, 1, 145, 2, 54, 3, 200, 3, 70, 4, 149, 4,
-194, 4, 208, 4, 193, 4, 160, 4, 115, 4, 57, 4, 235, 3, 139, 3, 24, 3, 132, 2, 228, 1, 57, 1, 133, 0, 211, 255, 37, 255, 134, 254, 244, 253, 111, 253, 1, 253, 159, 252, 72, 252, 252, 251, 188, 251, 136, 251, 100, 251, 102, 251, 128, 251, 178, 251, 5, 252, 93, 252, 184, 252, 6, 253,
-75, 253, 138, 253, 197, 253, 5, 254, 69, 254, 129, 254, 170, 254, 189, 254, 182, 254, 131, 254, 61, 254, 231, 253, 126, 253, 19, 253, 163, 252, 36, 252, 156, 251, 13, 251, 111, 250, 207, 249, 50, 249, 155, 248, 22, 248, 162, 247, 64, 247, 255, 246, 214, 246, 196, 246, 209, 246, 244, 246, 41, 247, 116, 247,
-218, 247, 86, 248, 241, 248, 183, 249, 146, 250, 126, 251, 121, 252, 109, 253, 87, 254, 50, 255, 4, 0, 207, 0, 155, 1, 92, 2, 17, 3, 175, 3, 26, 4, 98, 4, 124, 4, 102, 4, 57, 4, 246, 3, 158, 3, 56, 3, 197, 2, 54, 2, 147, 1, 226, 0, 31, 0, 86, 255, 138, 254, 195, 253,
-12, 253, 100, 252, 211, 251, 103, 251, 18, 251, 214, 250, 194, 250, 193, 250, 213, 250, 17, 251, 108, 251, 228, 251, 141, 252, 91, 253, 61, 254, 47, 255, 42, 0, 34, 1, 19, 2, 12, 3, 7, 4, 4, 5, 12, 6, 8, 7, 248, 7, 195, 8, 100, 9, 227, 9, 53, 10, 100, 10, 127, 10, 135, 10,
-113, 10, 72, 10, 10, 10, 162, 9, 41, 9, 160, 8, 2, 8, 96, 7, 189, 6, 31, 6, 138, 5, 1, 5, 137, 4, 33, 4, 196, 3, 114, 3, 46, 3, 244, 2, 199, 2, 182, 2, 189, 2, 222, 2, 34, 3, 117, 3, 206, 3, 35, 4, 109, 4, 174, 4, 230, 4, 26, 5, 81, 5, 138, 5,
-182, 5, 209, 5, 219, 5, 182, 5, 121, 5, 40, 5, 192, 4, 81, 4, 221, 3, 98, 3, 219, 2, 75, 2, 176, 1, 12, 1, 101, 0, 192, 255, 43, 255, 160, 254, 35, 254, 200, 253, 128, 253, 76, 253, 58, 253, 59, 253, 76, 253, 114, 253, 170, 253, 243, 253, 81, 254, 213, 254, 109, 255, 26, 0,
-219, 0, 151, 1, 77, 2, 234, 2, 118, 3, 246, 3, 106, 4, 211, 4, 49, 5, 127, 5, 157, 5, 152, 5, 108, 5, 253, 4, 114, 4, 206, 3, 17, 3, 71, 2, 114, 1, 142, 0, 152, 255, 150, 254, 134, 253, 111, 252, 87, 251, 64, 250, 57, 249, 62, 248, 78, 247, 137, 246, 220, 245, 71, 245,
-227, 244, 151, 244, 98, 244, 78, 244, 92, 244, 132, 244, 209, 244, 77, 245, 226, 245, 143, 246, 76, 247, 11, 248, 202, 248, 129, 249, 61, 250, 254, 250, 198, 251, 140, 252, 76, 253, 248, 253, 127, 254, 237, 254, 55, 255, 96, 255, 125, 255, 143, 255, 145, 255, 137, 255, 120, 255, 78, 255, 19, 255, 204, 254,
-119, 254, 28, 254, 193, 253, 106, 253, 30, 253, 220, 252, 167, 252, 136, 252, 117, 252, 109, 252, 116, 252, 131, 252, 155, 252, 195, 252, 3, 253, 87, 253, 200, 253, 80, 254, 226, 254, 118, 255, 253, 255, 121, 0, 234, 0, 77, 1, 177, 1, 23, 2, 120, 2, 208, 2, 26, 3, 68, 3, 78, 3, 67, 3,
-32, 3, 241, 2, 189, 2, 135, 2, 73, 2, 4, 2, 180, 1, 92, 1, 254, 0, 156, 0, 69, 0, 248, 255, 181, 255, 140, 255, 119, 255, 116, 255, 144, 255, 192, 255, 0, 0, 83, 0, 180, 0, 35, 1, 160, 1, 57, 2, 236, 2, 182, 3, 154, 4, 133, 5, 109, 6, 69, 7, 4, 8, 179, 8,
-79, 9, 223, 9, 103, 10, 228, 10, 65, 11, 127, 11, 156, 11, 120, 11, 51, 11, 209, 10, 76, 10, 189, 9, 35, 9, 121, 8, 191, 7, 248, 6, 33, 6, 55, 5, 74, 4, 90, 3, 111, 2, 141, 1, 183, 0, 251, 255, 86, 255, 198, 254, 90, 254, 7, 254, 201, 253, 162, 253, 149, 253, 157, 253,
-192, 253, 15, 254, 121, 254, 253, 254, 154, 255, 61, 0, 225, 0, 125, 1, 24, 2, 178, 2, 77, 3, 239, 3, 142, 4, 35, 5, 153, 5, 244, 5, 47, 6, 54, 6, 39, 6, 4, 6, 203, 5, 132, 5, 46, 5, 191, 4, 57, 4, 161, 3, 242, 2, 53, 2, 113, 1, 167, 0, 226, 255, 35, 255,
-106, 254, 197, 253, 44, 253, 159, 252, 35, 252, 178, 251, 72, 251, 235, 250, 164, 250, 113, 250, 87, 250, 104, 250, 139, 250, 191, 250, 251, 250, 51, 251, 100, 251, 142, 251, 185, 251, 231, 251, 30, 252, 89, 252, 143, 252, 181, 252, 194, 252, 187, 252, 152, 252, 98, 252, 38, 252, 229, 251, 160, 251, 88, 251,
-10, 251, 172, 250, 74, 250, 227, 249, 121, 249, 23, 249, 189, 248, 110, 248, 56, 248, 18, 248, 0, 248, 12, 248, 43, 248, 92, 248, 166, 248, 252, 248, 94, 249, 218, 249, 111, 250, 24, 251, 223, 251, 190, 252, 164, 253, 139, 254, 101, 255, 52, 0, 243, 0, 167, 1, 87, 2, 1, 3, 160, 3, 40, 4,
-153, 4, 214, 4, 232, 4, 219, 4, 166, 4, 90, 4, 1, 4, 153, 3, 29, 3, 146, 2, 247, 1, 63, 1, 126, 0, 181, 255, 226, 254, 22, 254, 81, 253, 154, 252, 252, 251, 114, 251, 6, 251, 189, 250, 137, 250, 106, 250, 113, 250, 139, 250, 183, 250, 28, 251, 157, 251, 56, 252, 4, 253, 223, 253,
-193, 254, 171, 255, 144, 0, 116, 1, 90, 2, 75, 3, 63, 4, 53, 5, 32, 6, 246, 6, 181, 7, 69, 8, 183, 8, 16, 9, 73, 9, 112, 9, 134, 9, 134, 9, 105, 9, 56, 9, 238, 8, 136, 8, 22, 8, 154, 7, 21, 7, 145, 6, 14, 6, 148, 5, 38, 5, 195, 4, 109, 4, 36, 4,
-227, 3, 171, 3, 129, 3, 101, 3, 92, 3, 118, 3, 165, 3, 233, 3, 61, 4, 142, 4, 220, 4, 25, 5, 79, 5, 128, 5, 177, 5, 229, 5, 24, 6, 69, 6, 86, 6, 83, 6, 55, 6, 243, 5, 163, 5, 72, 5, 226, 4, 118, 4, 4, 4, 135, 3, 251, 2, 103, 2, 204, 1, 44, 1,
-144, 0, 255, 255, 118, 255, 255, 254, 154, 254, 77, 254, 21, 254, 240, 253, 223, 253, 222, 253, 232, 253, 0, 254, 46, 254, 109, 254, 193, 254, 56, 255, 188, 255, 74, 0, 213, 0, 84, 1, 198, 1, 35, 2, 117, 2, 193, 2, 12, 3, 69, 3, 109, 3, 122, 3, 85, 3, 16, 3, 170, 2, 32, 2,
-137, 1, 231, 0, 60, 0, 135, 255, 201, 254, 253, 253, 35, 253, 64, 252, 89, 251, 113, 250, 141, 249, 179, 248, 242, 247, 67, 247, 173, 246, 68, 246, 242, 245, 183, 245, 163, 245, 160, 245, 176, 245, 226, 245, 50, 246, 157, 246, 45, 247, 218, 247, 147, 248, 87, 249, 22, 250, 209, 250, 134, 251, 60, 252,
-244, 252, 176, 253, 106, 254, 22, 255, 177, 255, 38, 0, 119, 0, 175, 0, 199, 0, 205, 0, 200, 0, 184, 0, 151, 0, 103, 0, 42, 0, 211, 255, 112, 255, 4, 255, 142, 254, 26, 254, 167, 253, 56, 253, 216, 252, 130, 252, 57, 252, 5, 252, 217, 251, 183, 251, 164, 251, 155, 251, 158, 251, 192, 251,
-251, 251, 76, 252, 185, 252, 46, 253, 164, 253, 21, 254, 122, 254, 217, 254, 53, 255, 150, 255, 252, 255, 102, 0, 199, 0, 26, 1, 93, 1, 125, 1, 141, 1, 145, 1, 140, 1, 133, 1, 125, 1, 117, 1, 98, 1, 73, 1, 44, 1, 4, 1, 222, 0, 188, 0, 163, 0, 151, 0, 153, 0, 172, 0,
-213, 0, 13, 1, 88, 1, 179, 1, 23, 2, 134, 2, 255, 2, 134, 3, 29, 4, 205, 4, 140, 5, 91, 6, 42, 7, 239, 7, 167, 8, 64, 9, 201, 9, 68, 10, 176, 10, 14, 11, 97, 11, 163, 11, 182, 11, 168, 11, 121, 11, 19, 11, 155, 10, 18, 10, 118, 9, 209, 8, 36, 8, 101, 7,
-152, 6, 191, 5, 216, 4, 237, 3, 2, 3, 24, 2, 62, 1, 113, 0, 177, 255, 20, 255, 142, 254, 29, 254, 203, 253, 144, 253, 102, 253, 80, 253, 91, 253, 124, 253, 185, 253, 34, 254, 157, 254, 39, 255, 189, 255, 80, 0, 222, 0, 104, 1, 246, 1, 134, 2, 29, 3, 177, 3, 61, 4, 178, 4,
-2, 5, 54, 5, 75, 5, 61, 5, 34, 5, 251, 4, 191, 4, 118, 4, 31, 4, 171, 3, 37, 3, 144, 2, 235, 1, 63, 1, 145, 0, 224, 255, 54, 255, 147, 254, 250, 253, 114, 253, 245, 252, 132, 252, 30, 252, 195, 251, 114, 251, 50, 251, 14, 251, 0, 251, 17, 251, 59, 251, 111, 251, 171, 251,
-223, 251, 14, 252, 56, 252, 100, 252, 149, 252, 205, 252, 14, 253, 68, 253, 112, 253, 132, 253, 126, 253, 104, 253, 63, 253, 17, 253, 222, 252, 166, 252, 103, 252, 33, 252, 208, 251, 114, 251, 16, 251, 170, 250, 71, 250, 235, 249, 151, 249, 83, 249, 33, 249, 254, 248, 240, 248, 250, 248, 15, 249, 47, 249,
-97, 249, 158, 249, 233, 249, 79, 250, 207, 250, 98, 251, 13, 252, 193, 252, 118, 253, 32, 254, 189, 254, 82, 255, 221, 255, 105, 0, 241, 0, 117, 1, 224, 1, 52, 2, 111, 2, 120, 2, 105, 2, 70, 2, 14, 2, 207, 1, 135, 1, 51, 1, 207, 0, 93, 0, 220, 255, 78, 255, 187, 254, 35, 254,
-149, 253, 15, 253, 147, 252, 48, 252, 229, 251, 175, 251, 146, 251, 149, 251, 170, 251, 208, 251, 22, 252, 113, 252, 226, 252, 131, 253, 59, 254, 8, 255, 235, 255, 208, 0, 179, 1, 144, 2, 107, 3, 72, 4, 43, 5, 22, 6, 255, 6, 225, 7, 163, 8, 70, 9, 200, 9, 18, 10, 68, 10, 95, 10,
-97, 10, 79, 10, 44, 10, 240, 9, 153, 9, 47, 9, 176, 8, 30, 8, 133, 7, 231, 6, 67, 6, 163, 5, 8, 5, 122, 4, 248, 3, 129, 3, 23, 3, 184, 2, 98, 2, 27, 2, 233, 1, 202, 1, 200, 1, 229, 1, 20, 2, 83, 2, 144, 2, 203, 2, 1, 3, 46, 3, 96, 3, 151, 3,
-215, 3, 23, 4, 83, 4, 129, 4, 147, 4, 148, 4, 130, 4, 93, 4, 50, 4, 5, 4, 206, 3, 144, 3, 75, 3, 246, 2, 149, 2, 46, 2, 197, 1, 90, 1, 244, 0, 153, 0, 75, 0, 10, 0, 216, 255, 189, 255, 172, 255, 167, 255, 174, 255, 187, 255, 207, 255, 245, 255, 44, 0, 115, 0,
-212, 0, 65, 1, 175, 1, 26, 2, 113, 2, 186, 2, 245, 2, 37, 3, 79, 3, 117, 3, 143, 3, 146, 3, 128, 3, 68, 3, 227, 2, 106, 2, 217, 1, 58, 1, 148, 0, 230, 255, 52, 255, 119, 254, 174, 253, 217, 252, 255, 251, 31, 251, 69, 250, 110, 249, 159, 248, 230, 247, 73, 247, 192, 246,
-84, 246, 14, 246, 219, 245, 188, 245, 191, 245, 209, 245, 244, 245, 69, 246, 173, 246, 42, 247, 203, 247, 115, 248, 29, 249, 199, 249, 107, 250, 14, 251, 178, 251, 93, 252, 10, 253, 186, 253, 86, 254, 221, 254, 78, 255, 148, 255, 194, 255, 222, 255, 232, 255, 232, 255, 223, 255, 204, 255, 165, 255, 113, 255,
-47, 255, 220, 254, 131, 254, 37, 254, 195, 253, 102, 253, 13, 253, 191, 252, 127, 252, 74, 252, 35, 252, 9, 252, 247, 251, 241, 251, 251, 251, 19, 252, 61, 252, 140, 252, 237, 252, 93, 253, 218, 253, 82, 254, 196, 254, 44, 255, 144, 255, 243, 255, 93, 0, 205, 0, 60, 1, 168, 1, 253, 1, 66, 2,
-116, 2, 141, 2, 158, 2, 170, 2, 178, 2, 182, 2, 181, 2, 168, 2, 141, 2, 108, 2, 65, 2, 21, 2, 235, 1, 198, 1, 173, 1, 158, 1, 155, 1, 171, 1, 200, 1, 240, 1, 35, 2, 94, 2, 159, 2, 230, 2, 62, 3, 164, 3, 27, 4, 168, 4, 59, 5, 209, 5, 87, 6, 209, 6,
-62, 7, 149, 7, 231, 7, 53, 8, 127, 8, 185, 8, 227, 8, 243, 8, 219, 8, 170, 8, 96, 8, 253, 7, 148, 7, 38, 7, 172, 6, 44, 6, 165, 5, 10, 5, 103, 4, 190, 3, 17, 3, 102, 2, 192, 1, 38, 1, 156, 0, 35, 0, 189, 255, 120, 255, 67, 255, 31, 255, 20, 255, 23, 255,
-39, 255, 80, 255, 148, 255, 236, 255, 96, 0, 231, 0, 115, 1, 0, 2, 133, 2, 5, 3, 129, 3, 253, 3, 126, 4, 3, 5, 126, 5, 233, 5, 64, 6, 105, 6, 113, 6, 96, 6, 45, 6, 237, 5, 159, 5, 65, 5, 209, 4, 80, 4, 190, 3, 19, 3, 92, 2, 154, 1, 209, 0, 5, 0,
-58, 255, 120, 254, 189, 253, 12, 253, 108, 252, 216, 251, 79, 251, 209, 250, 97, 250, 0, 250, 175, 249, 131, 249, 113, 249, 117, 249, 150, 249, 193, 249, 239, 249, 28, 250, 70, 250, 116, 250, 168, 250, 237, 250, 57, 251, 137, 251, 216, 251, 23, 252, 72, 252, 100, 252, 114, 252, 117, 252, 116, 252, 113, 252,
-105, 252, 87, 252, 58, 252, 20, 252, 224, 251, 167, 251, 108, 251, 46, 251, 251, 250, 205, 250, 164, 250, 145, 250, 136, 250, 137, 250, 154, 250, 180, 250, 211, 250, 251, 250, 47, 251, 112, 251, 193, 251, 52, 252, 180, 252, 65, 253, 211, 253, 94, 254, 225, 254, 86, 255, 197, 255, 50, 0, 158, 0, 6, 1,
-103, 1, 185, 1, 232, 1, 0, 2, 255, 1, 224, 1, 181, 1, 129, 1, 73, 1, 4, 1, 182, 0, 91, 0, 239, 255, 120, 255, 247, 254, 112, 254, 236, 253, 110, 253, 252, 252, 153, 252, 69, 252, 14, 252, 234, 251, 216, 251, 225, 251, 251, 251, 34, 252, 98, 252, 189, 252, 46, 253, 190, 253, 106, 254,
-36, 255, 236, 255, 177, 0, 117, 1, 54, 2, 247, 2, 193, 3, 144, 4, 96, 5, 43, 6, 235, 6, 146, 7, 17, 8, 117, 8, 189, 8, 227, 8, 250, 8, 4, 9, 247, 8, 215, 8, 166, 8, 89, 8, 250, 7, 140, 7, 15, 7, 138, 6, 2, 6, 121, 5, 244, 4, 119, 4, 3, 4, 156, 3,
-63, 3, 234, 2, 164, 2, 104, 2, 55, 2, 34, 2, 36, 2, 59, 2, 111, 2, 176, 2, 244, 2, 58, 3, 118, 3, 177, 3, 233, 3, 43, 4, 114, 4, 191, 4, 14, 5, 79, 5, 131, 5, 161, 5, 164, 5, 153, 5, 132, 5, 97, 5, 57, 5, 10, 5, 201, 4, 123, 4, 33, 4, 183, 3,
-70, 3, 208, 2, 91, 2, 233, 1, 123, 1, 24, 1, 192, 0, 115, 0, 49, 0, 248, 255, 197, 255, 151, 255, 114, 255, 87, 255, 70, 255, 82, 255, 111, 255, 152, 255, 211, 255, 9, 0, 56, 0, 93, 0, 117, 0, 138, 0, 155, 0, 177, 0, 195, 0, 207, 0, 195, 0, 162, 0, 108, 0, 22, 0,
-180, 255, 74, 255, 220, 254, 108, 254, 247, 253, 125, 253, 244, 252, 100, 252, 204, 251, 44, 251, 143, 250, 244, 249, 103, 249, 233, 248, 122, 248, 35, 248, 231, 247, 190, 247, 170, 247, 171, 247, 185, 247, 212, 247, 8, 248, 78, 248, 165, 248, 35, 249, 173, 249, 66, 250, 222, 250, 117, 251, 8, 252, 147, 252,
-30, 253, 172, 253, 63, 254, 205, 254, 82, 255, 202, 255, 26, 0, 82, 0, 114, 0, 113, 0, 103, 0, 84, 0, 51, 0, 9, 0, 212, 255, 140, 255, 51, 255, 208, 254, 96, 254, 234, 253, 114, 253, 249, 252, 136, 252, 31, 252, 189, 251, 110, 251, 42, 251, 239, 250, 195, 250, 165, 250, 146, 250, 146, 250,
-176, 250, 226, 250, 46, 251, 149, 251, 4, 252, 120, 252, 233, 252, 85, 253, 190, 253, 49, 254, 169, 254, 40, 255, 182, 255, 60, 0, 187, 0, 45, 1, 133, 1, 209, 1, 16, 2, 70, 2, 122, 2, 170, 2, 209, 2, 240, 2, 4, 3, 8, 3, 5, 3, 252, 2, 239, 2, 228, 2, 220, 2, 218, 2,
-226, 2, 241, 2, 7, 3, 41, 3, 77, 3, 116, 3, 159, 3, 206, 3, 3, 4, 71, 4, 156, 4, 253, 4, 107, 5, 219, 5, 68, 6, 165, 6, 241, 6, 53, 7, 116, 7, 172, 7, 228, 7, 25, 8, 59, 8, 70, 8, 62, 8, 22, 8, 216, 7, 141, 7, 56, 7, 223, 6, 129, 6, 28, 6,
-170, 5, 45, 5, 165, 4, 16, 4, 119, 3, 222, 2, 71, 2, 188, 1, 57, 1, 198, 0, 106, 0, 30, 0, 227, 255, 188, 255, 159, 255, 139, 255, 139, 255, 154, 255, 182, 255, 245, 255, 70, 0, 164, 0, 16, 1, 123, 1, 226, 1, 69, 2, 164, 2, 6, 3, 106, 3, 213, 3, 57, 4, 150, 4,
-213, 4, 251, 4, 9, 5, 242, 4, 202, 4, 150, 4, 82, 4, 3, 4, 169, 3, 62, 3, 191, 2, 50, 2, 149, 1, 237, 0, 63, 0, 141, 255, 222, 254, 50, 254, 140, 253, 247, 252, 108, 252, 233, 251, 116, 251, 9, 251, 170, 250, 91, 250, 36, 250, 3, 250, 252, 249, 22, 250, 63, 250, 116, 250,
-173, 250, 228, 250, 27, 251, 84, 251, 153, 251, 232, 251, 66, 252, 163, 252, 0, 253, 83, 253, 145, 253, 189, 253, 215, 253, 230, 253, 235, 253, 234, 253, 228, 253, 209, 253, 179, 253, 134, 253, 74, 253, 5, 253, 183, 252, 104, 252, 24, 252, 200, 251, 130, 251, 66, 251, 9, 251, 220, 250, 183, 250, 150, 250,
-125, 250, 107, 250, 98, 250, 107, 250, 138, 250, 188, 250, 6, 251, 97, 251, 193, 251, 35, 252, 127, 252, 215, 252, 45, 253, 136, 253, 232, 253, 74, 254, 171, 254, 255, 254, 70, 255, 119, 255, 145, 255, 161, 255, 168, 255, 168, 255, 166, 255, 161, 255, 144, 255, 115, 255, 75, 255, 18, 255, 210, 254, 140, 254,
-70, 254, 6, 254, 205, 253, 158, 253, 133, 253, 121, 253, 124, 253, 146, 253, 178, 253, 222, 253, 21, 254, 94, 254, 180, 254, 33, 255, 171, 255, 69, 0, 236, 0, 155, 1, 74, 2, 244, 2, 155, 3, 69, 4, 242, 4, 168, 5, 92, 6, 12, 7, 165, 7, 31, 8, 127, 8, 185, 8, 212, 8, 222, 8,
-216, 8, 192, 8, 153, 8, 103, 8, 25, 8, 188, 7, 77, 7, 203, 6, 62, 6, 170, 5, 20, 5, 126, 4, 234, 3, 95, 3, 224, 2, 106, 2, 255, 1, 162, 1, 80, 1, 9, 1, 217, 0, 190, 0, 184, 0, 211, 0, 3, 1, 62, 1, 130, 1, 197, 1, 9, 2, 76, 2, 151, 2, 233, 2,
-72, 3, 178, 3, 25, 4, 124, 4, 203, 4, 8, 5, 52, 5, 76, 5, 89, 5, 93, 5, 90, 5, 71, 5, 41, 5, 253, 4, 188, 4, 111, 4, 22, 4, 180, 3, 79, 3, 231, 2, 132, 2, 35, 2, 198, 1, 116, 1, 37, 1, 217, 0, 147, 0, 79, 0, 17, 0, 218, 255, 185, 255, 166, 255,
-161, 255, 182, 255, 206, 255, 232, 255, 251, 255, 6, 0, 12, 0, 16, 0, 26, 0, 39, 0, 48, 0, 54, 0, 46, 0, 18, 0, 225, 255, 162, 255, 85, 255, 6, 255, 179, 254, 94, 254, 4, 254, 160, 253, 51, 253, 185, 252, 51, 252, 170, 251, 29, 251, 153, 250, 28, 250, 167, 249, 77, 249, 1, 249,
-193, 248, 155, 248, 127, 248, 108, 248, 104, 248, 112, 248, 132, 248, 174, 248, 242, 248, 72, 249, 174, 249, 36, 250, 153, 250, 10, 251, 121, 251, 230, 251, 82, 252, 200, 252, 63, 253, 181, 253, 35, 254, 124, 254, 193, 254, 235, 254, 251, 254, 0, 255, 252, 254, 235, 254, 214, 254, 189, 254, 145, 254, 90, 254,
-24, 254, 199, 253, 110, 253, 18, 253, 179, 252, 87, 252, 255, 251, 174, 251, 108, 251, 53, 251, 8, 251, 234, 250, 215, 250, 208, 250, 220, 250, 252, 250, 45, 251, 125, 251, 226, 251, 83, 252, 206, 252, 76, 253, 199, 253, 64, 254, 191, 254, 67, 255, 206, 255, 103, 0, 254, 0, 148, 1, 17, 2, 128, 2,
-223, 2, 36, 3, 99, 3, 159, 3, 211, 3, 2, 4, 42, 4, 75, 4, 83, 4, 81, 4, 68, 4, 33, 4, 248, 3, 202, 3, 148, 3, 97, 3, 49, 3, 5, 3, 223, 2, 190, 2, 162, 2, 140, 2, 127, 2, 124, 2, 140, 2, 174, 2, 226, 2, 43, 3, 124, 3, 207, 3, 28, 4, 91, 4,
-148, 4, 196, 4, 243, 4, 34, 5, 84, 5, 129, 5, 165, 5, 190, 5, 196, 5, 191, 5, 177, 5, 159, 5, 142, 5, 124, 5, 103, 5, 73, 5, 33, 5, 235, 4, 160, 4, 74, 4, 235, 3, 132, 3, 29, 3, 184, 2, 95, 2, 14, 2, 200, 1, 149, 1, 108, 1, 78, 1, 60, 1, 57, 1,
-65, 1, 89, 1, 142, 1, 210, 1, 37, 2, 132, 2, 225, 2, 57, 3, 129, 3, 195, 3, 0, 4, 58, 4, 119, 4, 177, 4, 229, 4, 5, 5, 19, 5, 13, 5, 231, 4, 183, 4, 124, 4, 52, 4, 232, 3, 150, 3, 50, 3, 188, 2, 55, 2, 156, 1, 237, 0, 53, 0, 114, 255, 172, 254,
-232, 253, 38, 253, 115, 252, 204, 251, 46, 251, 167, 250, 45, 250, 193, 249, 108, 249, 49, 249, 12, 249, 5, 249, 32, 249, 75, 249, 131, 249, 196, 249, 3, 250, 64, 250, 128, 250, 198, 250, 20, 251, 114, 251, 214, 251, 62, 252, 162, 252, 249, 252, 69, 253, 131, 253, 183, 253, 230, 253, 18, 254, 55, 254,
-82, 254, 100, 254, 94, 254, 69, 254, 28, 254, 221, 253, 145, 253, 62, 253, 227, 252, 137, 252, 48, 252, 220, 251, 147, 251, 79, 251, 18, 251, 226, 250, 186, 250, 155, 250, 148, 250, 161, 250, 191, 250, 250, 250, 67, 251, 147, 251, 230, 251, 50, 252, 123, 252, 189, 252, 6, 253, 82, 253, 161, 253, 248, 253,
-74, 254, 149, 254, 212, 254, 7, 255, 50, 255, 87, 255, 124, 255, 160, 255, 195, 255, 218, 255, 231, 255, 230, 255, 204, 255, 164, 255, 113, 255, 51, 255, 242, 254, 177, 254, 121, 254, 73, 254, 35, 254, 12, 254, 4, 254, 5, 254, 18, 254, 47, 254, 89, 254, 145, 254, 235, 254, 86, 255, 209, 255, 96, 0,
-242, 0, 132, 1, 16, 2, 150, 2, 28, 3, 161, 3, 47, 4, 190, 4, 77, 5, 206, 5, 64, 6, 160, 6, 222, 6, 13, 7, 47, 7, 65, 7, 76, 7, 78, 7, 64, 7, 31, 7, 236, 6, 162, 6, 68, 6, 215, 5, 92, 5, 217, 4, 84, 4, 207, 3, 80, 3, 219, 2, 110, 2, 15, 2,
-193, 1, 125, 1, 72, 1, 45, 1, 37, 1, 52, 1, 100, 1, 162, 1, 239, 1, 67, 2, 150, 2, 231, 2, 51, 3, 133, 3, 221, 3, 60, 4, 164, 4, 13, 5, 113, 5, 195, 5, 8, 6, 63, 6, 92, 6, 114, 6, 130, 6, 131, 6, 123, 6, 102, 6, 59, 6, 248, 5, 164, 5, 59, 5,
-192, 4, 59, 4, 172, 3, 24, 3, 133, 2, 242, 1, 103, 1, 225, 0, 94, 0, 231, 255, 115, 255, 7, 255, 174, 254, 104, 254, 52, 254, 27, 254, 17, 254, 16, 254, 25, 254, 23, 254, 22, 254, 22, 254, 17, 254, 21, 254, 33, 254, 49, 254, 66, 254, 80, 254, 81, 254, 71, 254, 55, 254, 30, 254,
-8, 254, 242, 253, 221, 253, 195, 253, 161, 253, 119, 253, 55, 253, 236, 252, 151, 252, 57, 252, 215, 251, 120, 251, 32, 251, 208, 250, 139, 250, 85, 250, 43, 250, 11, 250, 244, 249, 235, 249, 237, 249, 251, 249, 34, 250, 93, 250, 167, 250, 2, 251, 100, 251, 198, 251, 36, 252, 120, 252, 202, 252, 26, 253,
-110, 253, 195, 253, 25, 254, 101, 254, 162, 254, 209, 254, 234, 254, 243, 254, 242, 254, 236, 254, 222, 254, 204, 254, 182, 254, 141, 254, 88, 254, 21, 254, 189, 253, 91, 253, 241, 252, 129, 252, 17, 252, 162, 251, 60, 251, 226, 250, 144, 250, 79, 250, 29, 250, 248, 249, 228, 249, 234, 249, 5, 250, 54, 250,
-139, 250, 241, 250, 103, 251, 234, 251, 107, 252, 236, 252, 111, 253, 242, 253, 124, 254, 18, 255, 175, 255, 79, 0, 241, 0, 129, 1, 7, 2, 129, 2, 231, 2, 71, 3, 162, 3, 243, 3, 64, 4, 131, 4, 178, 4, 207, 4, 220, 4, 214, 4, 186, 4, 150, 4, 105, 4, 49, 4, 250, 3, 196, 3,
-142, 3, 92, 3, 45, 3, 1, 3, 218, 2, 184, 2, 162, 2, 158, 2, 170, 2, 201, 2, 253, 2, 55, 3, 118, 3, 176, 3, 231, 3, 27, 4, 75, 4, 130, 4, 189, 4, 250, 4, 55, 5, 109, 5, 152, 5, 178, 5, 195, 5, 203, 5, 204, 5, 205, 5, 203, 5, 195, 5, 177, 5, 149, 5,
-102, 5, 36, 5, 215, 4, 127, 4, 29, 4, 186, 3, 88, 3, 252, 2, 168, 2, 89, 2, 25, 2, 221, 1, 167, 1, 121, 1, 86, 1, 61, 1, 54, 1, 70, 1, 102, 1, 148, 1, 208, 1, 11, 2, 69, 2, 121, 2, 171, 2, 221, 2, 18, 3, 74, 3, 131, 3, 178, 3, 211, 3, 230, 3,
-225, 3, 198, 3, 162, 3, 117, 3, 62, 3, 0, 3, 189, 2, 103, 2, 2, 2, 143, 1, 6, 1, 112, 0, 207, 255, 39, 255, 125, 254, 212, 253, 47, 253, 152, 252, 8, 252, 127, 251, 6, 251, 151, 250, 51, 250, 233, 249, 182, 249, 151, 249, 156, 249, 187, 249, 235, 249, 42, 250, 111, 250, 184, 250,
-4, 251, 84, 251, 172, 251, 17, 252, 127, 252, 243, 252, 108, 253, 211, 253, 48, 254, 130, 254, 188, 254, 237, 254, 24, 255, 56, 255, 78, 255, 89, 255, 86, 255, 57, 255, 13, 255, 210, 254, 123, 254, 27, 254, 180, 253, 62, 253, 203, 252, 88, 252, 228, 251, 119, 251, 15, 251, 172, 250, 80, 250, 254, 249,
-187, 249, 143, 249, 121, 249, 122, 249, 154, 249, 200, 249, 0, 250, 65, 250, 130, 250, 197, 250, 17, 251, 105, 251, 200, 251, 49, 252, 160, 252, 12, 253, 115, 253, 205, 253, 31, 254, 103, 254, 175, 254, 245, 254, 57, 255, 123, 255, 177, 255, 221, 255, 250, 255, 3, 0, 255, 255, 237, 255, 208, 255, 177, 255,
-144, 255, 118, 255, 95, 255, 79, 255, 74, 255, 73, 255, 75, 255, 89, 255, 110, 255, 140, 255, 191, 255, 9, 0, 101, 0, 210, 0, 77, 1, 202, 1, 74, 2, 199, 2, 69, 3, 197, 3, 75, 4, 211, 4, 91, 5, 218, 5, 71, 6, 165, 6, 234, 6, 22, 7, 52, 7, 68, 7, 73, 7, 69, 7,
-53, 7, 20, 7, 223, 6, 153, 6, 61, 6, 206, 5, 83, 5, 206, 4, 67, 4, 184, 3, 46, 3, 173, 2, 51, 2, 191, 1, 87, 1, 250, 0, 167, 0, 105, 0, 66, 0, 48, 0, 64, 0, 105, 0, 163, 0, 240, 0, 65, 1, 149, 1, 238, 1, 74, 2, 175, 2, 31, 3, 153, 3, 24, 4,
-152, 4, 12, 5, 114, 5, 203, 5, 16, 6, 68, 6, 110, 6, 142, 6, 156, 6, 157, 6, 145, 6, 104, 6, 44, 6, 222, 5, 122, 5, 5, 5, 133, 4, 252, 3, 108, 3, 218, 2, 73, 2, 184, 1, 40, 1, 155, 0, 21, 0, 148, 255, 26, 255, 189, 254, 111, 254, 50, 254, 22, 254, 1, 254,
-244, 253, 240, 253, 234, 253, 232, 253, 238, 253, 250, 253, 14, 254, 45, 254, 80, 254, 110, 254, 135, 254, 143, 254, 141, 254, 133, 254, 120, 254, 107, 254, 92, 254, 77, 254, 52, 254, 18, 254, 230, 253, 164, 253, 89, 253, 5, 253, 162, 252, 65, 252, 226, 251, 135, 251, 54, 251, 237, 250, 171, 250, 114, 250,
-63, 250, 18, 250, 240, 249, 218, 249, 212, 249, 233, 249, 15, 250, 70, 250, 141, 250, 218, 250, 41, 251, 118, 251, 198, 251, 24, 252, 111, 252, 202, 252, 38, 253, 129, 253, 202, 253, 8, 254, 57, 254, 79, 254, 95, 254, 107, 254, 108, 254, 106, 254, 100, 254, 80, 254, 46, 254, 1, 254, 195, 253, 116, 253,
-31, 253, 197, 252, 103, 252, 11, 252, 179, 251, 102, 251, 33, 251, 226, 250, 175, 250, 137, 250, 109, 250, 99, 250, 116, 250, 154, 250, 220, 250, 63, 251, 176, 251, 45, 252, 181, 252, 63, 253, 201, 253, 93, 254, 246, 254, 150, 255, 68, 0, 242, 0, 159, 1, 68, 2, 214, 2, 91, 3, 208, 3, 51, 4,
-142, 4, 226, 4, 37, 5, 93, 5, 138, 5, 155, 5, 154, 5, 138, 5, 99, 5, 44, 5, 235, 4, 161, 4, 79, 4, 251, 3, 167, 3, 81, 3, 253, 2, 171, 2, 90, 2, 17, 2, 209, 1, 164, 1, 142, 1, 137, 1, 156, 1, 190, 1, 230, 1, 18, 2, 66, 2, 117, 2, 171, 2, 239, 2,
-58, 3, 142, 3, 226, 3, 52, 4, 127, 4, 184, 4, 231, 4, 14, 5, 44, 5, 72, 5, 97, 5, 117, 5, 130, 5, 131, 5, 118, 5, 84, 5, 37, 5, 234, 4, 162, 4, 84, 4, 5, 4, 188, 3, 116, 3, 48, 3, 245, 2, 187, 2, 131, 2, 81, 2, 35, 2, 2, 2, 236, 1, 240, 1,
-3, 2, 34, 2, 82, 2, 132, 2, 185, 2, 236, 2, 33, 3, 88, 3, 147, 3, 207, 3, 8, 4, 62, 4, 93, 4, 108, 4, 107, 4, 77, 4, 36, 4, 243, 3, 179, 3, 109, 3, 29, 3, 189, 2, 75, 2, 202, 1, 54, 1, 146, 0, 228, 255, 45, 255, 119, 254, 195, 253, 17, 253, 106, 252,
-203, 251, 50, 251, 161, 250, 29, 250, 163, 249, 57, 249, 241, 248, 192, 248, 168, 248, 189, 248, 226, 248, 21, 249, 94, 249, 171, 249, 253, 249, 93, 250, 201, 250, 63, 251, 197, 251, 81, 252, 221, 252, 99, 253, 216, 253, 64, 254, 154, 254, 225, 254, 31, 255, 83, 255, 119, 255, 142, 255, 153, 255, 142, 255,
-110, 255, 62, 255, 250, 254, 166, 254, 72, 254, 225, 253, 116, 253, 5, 253, 148, 252, 38, 252, 183, 251, 73, 251, 227, 250, 135, 250, 54, 250, 254, 249, 222, 249, 211, 249, 228, 249, 8, 250, 53, 250, 109, 250, 172, 250, 243, 250, 67, 251, 164, 251, 17, 252, 134, 252, 2, 253, 119, 253, 231, 253, 77, 254,
-162, 254, 241, 254, 59, 255, 126, 255, 190, 255, 253, 255, 46, 0, 82, 0, 105, 0, 110, 0, 98, 0, 74, 0, 39, 0, 255, 255, 214, 255, 172, 255, 139, 255, 110, 255, 83, 255, 65, 255, 50, 255, 35, 255, 36, 255, 47, 255, 71, 255, 125, 255, 197, 255, 28, 0, 133, 0, 244, 0, 104, 1, 224, 1,
-95, 2, 228, 2, 112, 3, 4, 4, 149, 4, 34, 5, 155, 5, 1, 6, 85, 6, 143, 6, 186, 6, 219, 6, 235, 6, 241, 6, 234, 6, 210, 6, 163, 6, 99, 6, 18, 6, 168, 5, 53, 5, 186, 4, 57, 4, 184, 3, 58, 3, 198, 2, 85, 2, 231, 1, 131, 1, 39, 1, 213, 0, 146, 0,
-109, 0, 95, 0, 103, 0, 150, 0, 212, 0, 32, 1, 118, 1, 213, 1, 56, 2, 163, 2, 29, 3, 160, 3, 42, 4, 186, 4, 69, 5, 200, 5, 54, 6, 147, 6, 224, 6, 20, 7, 59, 7, 84, 7, 89, 7, 75, 7, 44, 7, 243, 6, 165, 6, 68, 6, 206, 5, 71, 5, 181, 4, 23, 4,
-118, 3, 208, 2, 39, 2, 126, 1, 212, 0, 43, 0, 135, 255, 237, 254, 96, 254, 230, 253, 137, 253, 63, 253, 9, 253, 234, 252, 209, 252, 190, 252, 182, 252, 183, 252, 193, 252, 220, 252, 5, 253, 53, 253, 109, 253, 157, 253, 198, 253, 231, 253, 248, 253, 4, 254, 10, 254, 14, 254, 15, 254, 13, 254,
-3, 254, 237, 253, 204, 253, 157, 253, 94, 253, 23, 253, 203, 252, 121, 252, 42, 252, 223, 251, 156, 251, 95, 251, 40, 251, 246, 250, 200, 250, 160, 250, 129, 250, 114, 250, 112, 250, 134, 250, 177, 250, 232, 250, 45, 251, 122, 251, 202, 251, 28, 252, 121, 252, 216, 252, 58, 253, 167, 253, 11, 254, 102, 254,
-182, 254, 240, 254, 27, 255, 53, 255, 63, 255, 66, 255, 63, 255, 46, 255, 19, 255, 238, 254, 178, 254, 106, 254, 21, 254, 173, 253, 63, 253, 207, 252, 92, 252, 238, 251, 134, 251, 38, 251, 208, 250, 128, 250, 56, 250, 0, 250, 211, 249, 179, 249, 187, 249, 219, 249, 17, 250, 107, 250, 216, 250, 81, 251,
-214, 251, 100, 252, 249, 252, 153, 253, 73, 254, 1, 255, 194, 255, 134, 0, 67, 1, 249, 1, 157, 2, 48, 3, 182, 3, 43, 4, 148, 4, 242, 4, 64, 5, 123, 5, 168, 5, 193, 5, 193, 5, 176, 5, 145, 5, 93, 5, 32, 5, 220, 4, 144, 4, 66, 4, 242, 3, 157, 3, 71, 3, 242, 2,
-158, 2, 84, 2, 24, 2, 237, 1, 222, 1, 225, 1, 243, 1, 20, 2, 59, 2, 103, 2, 151, 2, 210, 2, 21, 3, 100, 3, 192, 3, 31, 4, 127, 4, 213, 4, 31, 5, 92, 5, 137, 5, 173, 5, 200, 5, 220, 5, 232, 5, 237, 5, 228, 5, 205, 5, 170, 5, 114, 5, 45, 5, 221, 4,
-128, 4, 34, 4, 198, 3, 105, 3, 22, 3, 197, 2, 119, 2, 47, 2, 233, 1, 167, 1, 112, 1, 73, 1, 49, 1, 45, 1, 63, 1, 92, 1, 132, 1, 179, 1, 230, 1, 30, 2, 93, 2, 163, 2, 239, 2, 61, 3, 133, 3, 195, 3, 237, 3, 0, 4, 3, 4, 243, 3, 209, 3, 166, 3,
-113, 3, 42, 3, 214, 2, 117, 2, 252, 1, 115, 1, 219, 0, 49, 0, 131, 255, 210, 254, 28, 254, 114, 253, 205, 252, 45, 252, 153, 251, 11, 251, 129, 250, 5, 250, 153, 249, 61, 249, 3, 249, 233, 248, 232, 248, 6, 249, 59, 249, 125, 249, 204, 249, 41, 250, 143, 250, 1, 251, 137, 251, 24, 252,
-176, 252, 75, 253, 220, 253, 100, 254, 221, 254, 65, 255, 152, 255, 224, 255, 21, 0, 60, 0, 84, 0, 83, 0, 65, 0, 30, 0, 224, 255, 145, 255, 52, 255, 202, 254, 84, 254, 216, 253, 93, 253, 219, 252, 89, 252, 219, 251, 89, 251, 219, 250, 100, 250, 255, 249, 171, 249, 107, 249, 81, 249, 75, 249,
-85, 249, 119, 249, 160, 249, 211, 249, 21, 250, 101, 250, 195, 250, 52, 251, 178, 251, 53, 252, 190, 252, 57, 253, 173, 253, 26, 254, 118, 254, 204, 254, 29, 255, 102, 255, 167, 255, 225, 255, 15, 0, 42, 0, 58, 0, 59, 0, 43, 0, 20, 0, 246, 255, 214, 255, 183, 255, 155, 255, 137, 255, 121, 255,
-108, 255, 100, 255, 97, 255, 100, 255, 115, 255, 153, 255, 206, 255, 19, 0, 117, 0, 222, 0, 78, 1, 202, 1, 76, 2, 212, 2, 102, 3, 4, 4, 166, 4, 70, 5, 220, 5, 100, 6, 216, 6, 45, 7, 113, 7, 162, 7, 186, 7, 199, 7, 200, 7, 175, 7, 133, 7, 75, 7, 246, 6, 138, 6,
-15, 6, 132, 5, 238, 4, 85, 4, 187, 3, 39, 3, 153, 2, 16, 2, 142, 1, 21, 1, 162, 0, 58, 0, 228, 255, 161, 255, 123, 255, 119, 255, 138, 255, 181, 255, 245, 255, 66, 0, 155, 0, 254, 0, 111, 1, 237, 1, 123, 2, 19, 3, 175, 3, 73, 4, 218, 4, 95, 5, 211, 5, 51, 6,
-132, 6, 196, 6, 238, 6, 7, 7, 15, 7, 248, 6, 204, 6, 143, 6, 55, 6, 202, 5, 80, 5, 201, 4, 56, 4, 163, 3, 9, 3, 111, 2, 210, 1, 48, 1, 145, 0, 245, 255, 93, 255, 215, 254, 102, 254, 8, 254, 193, 253, 146, 253, 112, 253, 83, 253, 70, 253, 64, 253, 63, 253, 84, 253,
-117, 253, 160, 253, 217, 253, 19, 254, 75, 254, 118, 254, 151, 254, 175, 254, 184, 254, 186, 254, 183, 254, 170, 254, 150, 254, 120, 254, 80, 254, 22, 254, 209, 253, 131, 253, 37, 253, 197, 252, 98, 252, 0, 252, 166, 251, 82, 251, 5, 251, 193, 250, 130, 250, 68, 250, 21, 250, 238, 249, 210, 249, 213, 249,
-232, 249, 10, 250, 69, 250, 136, 250, 208, 250, 36, 251, 126, 251, 224, 251, 78, 252, 195, 252, 59, 253, 180, 253, 32, 254, 127, 254, 208, 254, 6, 255, 46, 255, 76, 255, 89, 255, 91, 255, 84, 255, 62, 255, 19, 255, 219, 254, 148, 254, 53, 254, 206, 253, 94, 253, 232, 252, 115, 252, 2, 252, 157, 251,
-64, 251, 233, 250, 158, 250, 90, 250, 31, 250, 246, 249, 228, 249, 231, 249, 7, 250, 74, 250, 161, 250, 12, 251, 138, 251, 18, 252, 164, 252, 69, 253, 244, 253, 175, 254, 118, 255, 68, 0, 18, 1, 215, 1, 144, 2, 61, 3, 216, 3, 97, 4, 221, 4, 75, 5, 165, 5, 238, 5, 38, 6, 66, 6,
-71, 6, 58, 6, 21, 6, 222, 5, 155, 5, 76, 5, 245, 4, 156, 4, 65, 4, 225, 3, 129, 3, 32, 3, 187, 2, 94, 2, 11, 2, 197, 1, 152, 1, 126, 1, 121, 1, 134, 1, 155, 1, 183, 1, 220, 1, 8, 2, 61, 2, 134, 2, 216, 2, 51, 3, 150, 3, 245, 3, 79, 4, 154, 4,
-216, 4, 11, 5, 49, 5, 77, 5, 97, 5, 109, 5, 102, 5, 84, 5, 57, 5, 6, 5, 199, 4, 127, 4, 43, 4, 210, 3, 120, 3, 32, 3, 208, 2, 132, 2, 60, 2, 251, 1, 189, 1, 132, 1, 87, 1, 55, 1, 35, 1, 43, 1, 67, 1, 105, 1, 158, 1, 218, 1, 27, 2, 97, 2,
-175, 2, 4, 3, 99, 3, 196, 3, 35, 4, 127, 4, 193, 4, 242, 4, 18, 5, 18, 5, 0, 5, 224, 4, 172, 4, 102, 4, 18, 4, 171, 3, 41, 3, 150, 2, 242, 1, 53, 1, 112, 0, 163, 255, 210, 254, 6, 254, 63, 253, 131, 252, 211, 251, 40, 251, 132, 250, 239, 249, 100, 249, 231, 248,
-140, 248, 74, 248, 33, 248, 35, 248, 56, 248, 96, 248, 157, 248, 233, 248, 67, 249, 178, 249, 51, 250, 192, 250, 94, 251, 254, 251, 157, 252, 56, 253, 193, 253, 63, 254, 180, 254, 14, 255, 94, 255, 162, 255, 209, 255, 235, 255, 244, 255, 232, 255, 192, 255, 136, 255, 66, 255, 228, 254, 127, 254, 24, 254,
-169, 253, 60, 253, 208, 252, 97, 252, 243, 251, 135, 251, 29, 251, 194, 250, 116, 250, 57, 250, 30, 250, 22, 250, 32, 250, 66, 250, 107, 250, 154, 250, 219, 250, 39, 251, 124, 251, 233, 251, 96, 252, 222, 252, 97, 253, 222, 253, 84, 254, 192, 254, 26, 255, 108, 255, 185, 255, 241, 255, 35, 0, 79, 0,
-98, 0, 107, 0, 103, 0, 80, 0, 44, 0, 0, 0, 204, 255, 151, 255, 98, 255, 50, 255, 11, 255, 231, 254, 201, 254, 178, 254, 161, 254, 150, 254, 157, 254, 183, 254, 227, 254, 41, 255, 132, 255, 234, 255, 93, 0, 216, 0, 89, 1, 228, 1, 122, 2, 27, 3, 199, 3, 118, 4, 33, 5, 199, 5,
-82, 6, 201, 6, 46, 7, 117, 7, 169, 7, 204, 7, 217, 7, 207, 7, 180, 7, 131, 7, 52, 7, 210, 6, 93, 6, 208, 5, 57, 5, 154, 4, 252, 3, 96, 3, 199, 2, 59, 2, 181, 1, 52, 1, 188, 0, 82, 0, 246, 255, 168, 255, 128, 255, 109, 255, 112, 255, 151, 255, 203, 255, 12, 0,
-97, 0, 194, 0, 46, 1, 176, 1, 65, 2, 219, 2, 127, 3, 32, 4, 187, 4, 80, 5, 201, 5, 54, 6, 151, 6, 223, 6, 23, 7, 63, 7, 75, 7, 63, 7, 31, 7, 229, 6, 140, 6, 35, 6, 168, 5, 25, 5, 131, 4, 232, 3, 74, 3, 171, 2, 11, 2, 105, 1, 201, 0, 41, 0,
-142, 255, 4, 255, 136, 254, 29, 254, 209, 253, 148, 253, 102, 253, 71, 253, 47, 253, 30, 253, 24, 253, 34, 253, 55, 253, 91, 253, 138, 253, 189, 253, 241, 253, 27, 254, 62, 254, 89, 254, 101, 254, 104, 254, 101, 254, 84, 254, 57, 254, 22, 254, 227, 253, 162, 253, 87, 253, 255, 252, 159, 252, 58, 252,
-210, 251, 114, 251, 22, 251, 191, 250, 120, 250, 55, 250, 250, 249, 199, 249, 159, 249, 130, 249, 120, 249, 134, 249, 167, 249, 226, 249, 48, 250, 135, 250, 232, 250, 83, 251, 194, 251, 54, 252, 186, 252, 68, 253, 210, 253, 96, 254, 230, 254, 98, 255, 198, 255, 26, 0, 93, 0, 137, 0, 166, 0, 180, 0,
-175, 0, 150, 0, 108, 0, 47, 0, 216, 255, 111, 255, 247, 254, 110, 254, 223, 253, 78, 253, 190, 252, 55, 252, 182, 251, 62, 251, 211, 250, 113, 250, 23, 250, 210, 249, 159, 249, 127, 249, 135, 249, 169, 249, 223, 249, 49, 250, 149, 250, 5, 251, 131, 251, 22, 252, 183, 252, 101, 253, 43, 254, 246, 254,
-196, 255, 142, 0, 79, 1, 5, 2, 166, 2, 61, 3, 200, 3, 64, 4, 170, 4, 8, 5, 81, 5, 129, 5, 160, 5, 171, 5, 151, 5, 117, 5, 70, 5, 4, 5, 191, 4, 117, 4, 42, 4, 223, 3, 148, 3, 71, 3, 251, 2, 179, 2, 113, 2, 65, 2, 32, 2, 17, 2, 28, 2, 52, 2,
-88, 2, 129, 2, 177, 2, 230, 2, 34, 3, 108, 3, 189, 3, 24, 4, 121, 4, 215, 4, 47, 5, 119, 5, 180, 5, 228, 5, 3, 6, 23, 6, 30, 6, 20, 6, 251, 5, 213, 5, 152, 5, 76, 5, 244, 4, 137, 4, 25, 4, 164, 3, 41, 3, 185, 2, 76, 2, 228, 1, 137, 1, 50, 1,
-223, 0, 150, 0, 90, 0, 41, 0, 14, 0, 14, 0, 33, 0, 73, 0, 132, 0, 199, 0, 18, 1, 99, 1, 187, 1, 28, 2, 134, 2, 247, 2, 105, 3, 214, 3, 55, 4, 139, 4, 198, 4, 233, 4, 250, 4, 244, 4, 216, 4, 171, 4, 108, 4, 17, 4, 162, 3, 32, 3, 129, 2, 209, 1,
-19, 1, 69, 0, 113, 255, 157, 254, 206, 253, 6, 253, 72, 252, 151, 251, 235, 250, 75, 250, 184, 249, 57, 249, 209, 248, 127, 248, 81, 248, 66, 248, 71, 248, 101, 248, 151, 248, 215, 248, 40, 249, 142, 249, 5, 250, 142, 250, 42, 251, 204, 251, 113, 252, 13, 253, 159, 253, 38, 254, 154, 254, 0, 255,
-90, 255, 163, 255, 217, 255, 1, 0, 23, 0, 16, 0, 248, 255, 205, 255, 135, 255, 50, 255, 208, 254, 100, 254, 244, 253, 131, 253, 19, 253, 166, 252, 58, 252, 206, 251, 106, 251, 13, 251, 184, 250, 129, 250, 91, 250, 71, 250, 83, 250, 107, 250, 143, 250, 191, 250, 249, 250, 60, 251, 139, 251, 236, 251,
-85, 252, 199, 252, 64, 253, 181, 253, 36, 254, 135, 254, 224, 254, 48, 255, 116, 255, 171, 255, 217, 255, 248, 255, 7, 0, 9, 0, 248, 255, 214, 255, 168, 255, 110, 255, 47, 255, 238, 254, 173, 254, 116, 254, 69, 254, 28, 254, 251, 253, 228, 253, 210, 253, 199, 253, 208, 253, 233, 253, 20, 254, 101, 254,
-199, 254, 57, 255, 195, 255, 84, 0, 235, 0, 140, 1, 53, 2, 230, 2, 165, 3, 103, 4, 42, 5, 235, 5, 153, 6, 54, 7, 191, 7, 38, 8, 122, 8, 186, 8, 219, 8, 229, 8, 220, 8, 180, 8, 113, 8, 25, 8, 166, 7, 25, 7, 126, 6, 214, 5, 33, 5, 108, 4, 186, 3, 14, 3,
-103, 2, 199, 1, 52, 1, 169, 0, 40, 0, 190, 255, 109, 255, 49, 255, 22, 255, 21, 255, 37, 255, 73, 255, 124, 255, 188, 255, 9, 0, 110, 0, 227, 0, 102, 1, 250, 1, 145, 2, 41, 3, 184, 3, 57, 4, 175, 4, 19, 5, 101, 5, 171, 5, 227, 5, 2, 6, 17, 6, 17, 6, 240, 5,
-187, 5, 117, 5, 21, 5, 164, 4, 40, 4, 165, 3, 26, 3, 143, 2, 8, 2, 127, 1, 248, 0, 117, 0, 245, 255, 126, 255, 18, 255, 188, 254, 121, 254, 71, 254, 43, 254, 27, 254, 18, 254, 17, 254, 26, 254, 41, 254, 65, 254, 105, 254, 150, 254, 199, 254, 252, 254, 41, 255, 77, 255, 100, 255,
-111, 255, 111, 255, 99, 255, 75, 255, 42, 255, 253, 254, 185, 254, 106, 254, 17, 254, 155, 253, 31, 253, 160, 252, 23, 252, 146, 251, 19, 251, 158, 250, 54, 250, 215, 249, 131, 249, 54, 249, 244, 248, 192, 248, 158, 248, 142, 248, 149, 248, 193, 248, 0, 249, 80, 249, 182, 249, 36, 250, 152, 250, 23, 251,
-159, 251, 46, 252, 201, 252, 98, 253, 252, 253, 149, 254, 23, 255, 139, 255, 243, 255, 63, 0, 123, 0, 170, 0, 194, 0, 198, 0, 187, 0, 152, 0, 92, 0, 16, 0, 175, 255, 56, 255, 183, 254, 46, 254, 157, 253, 16, 253, 135, 252, 7, 252, 143, 251, 29, 251, 184, 250, 96, 250, 23, 250, 230, 249,
-210, 249, 212, 249, 245, 249, 52, 250, 131, 250, 224, 250, 77, 251, 199, 251, 79, 252, 235, 252, 152, 253, 80, 254, 24, 255, 223, 255, 164, 0, 96, 1, 10, 2, 168, 2, 57, 3, 182, 3, 39, 4, 139, 4, 221, 4, 29, 5, 77, 5, 102, 5, 106, 5, 93, 5, 57, 5, 6, 5, 201, 4, 129, 4,
-57, 4, 240, 3, 166, 3, 95, 3, 25, 3, 213, 2, 152, 2, 100, 2, 58, 2, 40, 2, 41, 2, 55, 2, 89, 2, 132, 2, 180, 2, 234, 2, 39, 3, 106, 3, 180, 3, 9, 4, 99, 4, 190, 4, 18, 5, 92, 5, 157, 5, 203, 5, 233, 5, 252, 5, 2, 6, 247, 5, 223, 5, 184, 5,
-124, 5, 48, 5, 213, 4, 102, 4, 235, 3, 103, 3, 223, 2, 89, 2, 215, 1, 94, 1, 245, 0, 148, 0, 57, 0, 236, 255, 167, 255, 105, 255, 70, 255, 53, 255, 55, 255, 93, 255, 152, 255, 224, 255, 57, 0, 158, 0, 9, 1, 121, 1, 247, 1, 122, 2, 1, 3, 141, 3, 17, 4, 141, 4,
-245, 4, 71, 5, 134, 5, 170, 5, 182, 5, 175, 5, 145, 5, 87, 5, 10, 5, 164, 4, 32, 4, 136, 3, 221, 2, 26, 2, 76, 1, 117, 0, 152, 255, 191, 254, 234, 253, 27, 253, 88, 252, 156, 251, 232, 250, 69, 250, 176, 249, 47, 249, 208, 248, 138, 248, 94, 248, 84, 248, 92, 248, 115, 248,
-156, 248, 214, 248, 30, 249, 124, 249, 238, 249, 110, 250, 252, 250, 141, 251, 27, 252, 164, 252, 29, 253, 138, 253, 236, 253, 58, 254, 125, 254, 181, 254, 217, 254, 237, 254, 244, 254, 230, 254, 195, 254, 147, 254, 83, 254, 2, 254, 172, 253, 82, 253, 246, 252, 158, 252, 73, 252, 246, 251, 170, 251, 100, 251,
-35, 251, 245, 250, 211, 250, 197, 250, 212, 250, 242, 250, 33, 251, 95, 251, 164, 251, 241, 251, 70, 252, 166, 252, 14, 253, 129, 253, 250, 253, 117, 254, 233, 254, 85, 255, 181, 255, 5, 0, 71, 0, 126, 0, 168, 0, 196, 0, 211, 0, 209, 0, 192, 0, 155, 0, 102, 0, 33, 0, 205, 255, 113, 255,
-19, 255, 181, 254, 92, 254, 14, 254, 203, 253, 146, 253, 98, 253, 62, 253, 35, 253, 19, 253, 27, 253, 59, 253, 112, 253, 196, 253, 49, 254, 174, 254, 58, 255, 212, 255, 116, 0, 27, 1, 209, 1, 144, 2, 86, 3, 31, 4, 229, 4, 167, 5, 83, 6, 236, 6, 117, 7, 224, 7, 55, 8, 121, 8,
-156, 8, 166, 8, 154, 8, 113, 8, 42, 8, 207, 7, 94, 7, 210, 6, 59, 6, 154, 5, 241, 4, 73, 4, 164, 3, 2, 3, 104, 2, 211, 1, 67, 1, 195, 0, 82, 0, 240, 255, 176, 255, 136, 255, 119, 255, 128, 255, 155, 255, 195, 255, 245, 255, 55, 0, 134, 0, 225, 0, 86, 1, 211, 1,
-86, 2, 224, 2, 101, 3, 225, 3, 77, 4, 171, 4, 252, 4, 59, 5, 105, 5, 139, 5, 154, 5, 147, 5, 124, 5, 84, 5, 16, 5, 190, 4, 93, 4, 232, 3, 111, 3, 239, 2, 110, 2, 238, 1, 113, 1, 244, 0, 125, 0, 10, 0, 157, 255, 62, 255, 235, 254, 170, 254, 131, 254, 105, 254,
-94, 254, 94, 254, 99, 254, 110, 254, 130, 254, 158, 254, 192, 254, 238, 254, 32, 255, 82, 255, 129, 255, 161, 255, 182, 255, 190, 255, 179, 255, 159, 255, 129, 255, 82, 255, 25, 255, 214, 254, 126, 254, 24, 254, 165, 253, 35, 253, 149, 252, 1, 252, 109, 251, 219, 250, 82, 250, 212, 249, 104, 249, 7, 249,
-178, 248, 108, 248, 50, 248, 5, 248, 241, 247, 246, 247, 16, 248, 73, 248, 159, 248, 4, 249, 120, 249, 250, 249, 131, 250, 20, 251, 180, 251, 89, 252, 4, 253, 178, 253, 91, 254, 253, 254, 142, 255, 12, 0, 123, 0, 214, 0, 26, 1, 78, 1, 113, 1, 122, 1, 110, 1, 79, 1, 22, 1, 199, 0,
-102, 0, 241, 255, 112, 255, 230, 254, 87, 254, 204, 253, 69, 253, 193, 252, 70, 252, 210, 251, 98, 251, 6, 251, 183, 250, 119, 250, 93, 250, 91, 250, 109, 250, 156, 250, 223, 250, 44, 251, 133, 251, 241, 251, 103, 252, 232, 252, 133, 253, 40, 254, 209, 254, 128, 255, 40, 0, 202, 0, 91, 1, 224, 1,
-90, 2, 197, 2, 34, 3, 115, 3, 185, 3, 232, 3, 11, 4, 36, 4, 30, 4, 15, 4, 247, 3, 201, 3, 153, 3, 102, 3, 48, 3, 255, 2, 208, 2, 164, 2, 125, 2, 89, 2, 58, 2, 43, 2, 42, 2, 54, 2, 93, 2, 144, 2, 208, 2, 25, 3, 102, 3, 183, 3, 11, 4, 101, 4,
-196, 4, 42, 5, 145, 5, 243, 5, 78, 6, 149, 6, 206, 6, 249, 6, 9, 7, 11, 7, 0, 7, 222, 6, 173, 6, 110, 6, 26, 6, 179, 5, 61, 5, 182, 4, 33, 4, 133, 3, 226, 2, 69, 2, 173, 1, 27, 1, 154, 0, 36, 0, 182, 255, 86, 255, 3, 255, 187, 254, 135, 254, 113, 254,
-112, 254, 136, 254, 193, 254, 7, 255, 88, 255, 190, 255, 40, 0, 150, 0, 22, 1, 155, 1, 36, 2, 179, 2, 59, 3, 187, 3, 47, 4, 135, 4, 207, 4, 6, 5, 27, 5, 32, 5, 22, 5, 231, 4, 165, 4, 82, 4, 220, 3, 84, 3, 187, 2, 9, 2, 77, 1, 138, 0, 191, 255, 247, 254,
-52, 254, 118, 253, 195, 252, 23, 252, 114, 251, 216, 250, 82, 250, 220, 249, 122, 249, 61, 249, 23, 249, 5, 249, 15, 249, 37, 249, 70, 249, 123, 249, 189, 249, 11, 250, 115, 250, 228, 250, 95, 251, 221, 251, 87, 252, 203, 252, 51, 253, 139, 253, 216, 253, 26, 254, 74, 254, 113, 254, 142, 254, 147, 254,
-141, 254, 125, 254, 82, 254, 29, 254, 223, 253, 141, 253, 59, 253, 230, 252, 143, 252, 66, 252, 249, 251, 177, 251, 117, 251, 63, 251, 13, 251, 238, 250, 223, 250, 224, 250, 251, 250, 41, 251, 101, 251, 173, 251, 255, 251, 85, 252, 176, 252, 23, 253, 131, 253, 245, 253, 113, 254, 232, 254, 91, 255, 193, 255,
-26, 0, 101, 0, 158, 0, 200, 0, 231, 0, 245, 0, 243, 0, 228, 0, 198, 0, 144, 0, 79, 0, 2, 0, 160, 255, 59, 255, 212, 254, 106, 254, 10, 254, 178, 253, 99, 253, 36, 253, 238, 252, 194, 252, 165, 252, 149, 252, 150, 252, 182, 252, 237, 252, 60, 253, 174, 253, 48, 254, 193, 254, 93, 255,
-4, 0, 180, 0, 109, 1, 49, 2, 251, 2, 202, 3, 152, 4, 96, 5, 31, 6, 197, 6, 91, 7, 223, 7, 65, 8, 143, 8, 201, 8, 226, 8, 225, 8, 203, 8, 152, 8, 72, 8, 229, 7, 110, 7, 224, 6, 73, 6, 172, 5, 9, 5, 105, 4, 202, 3, 51, 3, 159, 2, 16, 2, 139, 1,
-20, 1, 170, 0, 86, 0, 32, 0, 254, 255, 240, 255, 247, 255, 9, 0, 37, 0, 78, 0, 132, 0, 198, 0, 27, 1, 124, 1, 228, 1, 81, 2, 186, 2, 28, 3, 114, 3, 183, 3, 243, 3, 36, 4, 63, 4, 82, 4, 92, 4, 78, 4, 53, 4, 15, 4, 213, 3, 138, 3, 52, 3, 208, 2,
-99, 2, 244, 1, 135, 1, 27, 1, 181, 0, 84, 0, 247, 255, 161, 255, 81, 255, 12, 255, 214, 254, 175, 254, 158, 254, 159, 254, 171, 254, 195, 254, 227, 254, 5, 255, 44, 255, 90, 255, 141, 255, 197, 255, 4, 0, 64, 0, 120, 0, 164, 0, 190, 0, 204, 0, 198, 0, 177, 0, 143, 0, 93, 0,
-28, 0, 205, 255, 110, 255, 252, 254, 125, 254, 242, 253, 86, 253, 180, 252, 14, 252, 103, 251, 201, 250, 52, 250, 173, 249, 56, 249, 205, 248, 109, 248, 33, 248, 225, 247, 174, 247, 160, 247, 168, 247, 199, 247, 11, 248, 97, 248, 197, 248, 61, 249, 189, 249, 69, 250, 216, 250, 118, 251, 26, 252, 196, 252,
-109, 253, 16, 254, 174, 254, 53, 255, 175, 255, 26, 0, 111, 0, 177, 0, 228, 0, 3, 1, 9, 1, 0, 1, 229, 0, 172, 0, 100, 0, 14, 0, 162, 255, 47, 255, 182, 254, 61, 254, 197, 253, 80, 253, 228, 252, 127, 252, 32, 252, 201, 251, 131, 251, 75, 251, 37, 251, 32, 251, 46, 251, 79, 251,
-139, 251, 209, 251, 32, 252, 126, 252, 230, 252, 89, 253, 222, 253, 110, 254, 6, 255, 164, 255, 62, 0, 209, 0, 89, 1, 207, 1, 57, 2, 152, 2, 232, 2, 43, 3, 101, 3, 146, 3, 175, 3, 192, 3, 194, 3, 178, 3, 151, 3, 112, 3, 62, 3, 11, 3, 213, 2, 164, 2, 119, 2, 79, 2,
-48, 2, 20, 2, 253, 1, 242, 1, 245, 1, 4, 2, 39, 2, 94, 2, 161, 2, 238, 2, 69, 3, 157, 3, 245, 3, 86, 4, 184, 4, 28, 5, 131, 5, 232, 5, 70, 6, 149, 6, 212, 6, 3, 7, 28, 7, 30, 7, 19, 7, 249, 6, 197, 6, 133, 6, 55, 6, 206, 5, 87, 5, 212, 4,
-63, 4, 161, 3, 254, 2, 87, 2, 185, 1, 33, 1, 146, 0, 21, 0, 162, 255, 54, 255, 221, 254, 143, 254, 77, 254, 38, 254, 25, 254, 34, 254, 75, 254, 139, 254, 218, 254, 58, 255, 163, 255, 19, 0, 141, 0, 16, 1, 152, 1, 38, 2, 184, 2, 66, 3, 194, 3, 51, 4, 142, 4, 216, 4,
-11, 5, 36, 5, 43, 5, 29, 5, 241, 4, 178, 4, 95, 4, 236, 3, 105, 3, 213, 2, 44, 2, 120, 1, 189, 0, 252, 255, 62, 255, 132, 254, 208, 253, 38, 253, 130, 252, 228, 251, 87, 251, 214, 250, 97, 250, 16, 250, 209, 249, 165, 249, 151, 249, 150, 249, 159, 249, 184, 249, 222, 249, 17, 250,
-83, 250, 168, 250, 5, 251, 108, 251, 211, 251, 53, 252, 146, 252, 222, 252, 31, 253, 87, 253, 127, 253, 157, 253, 179, 253, 188, 253, 184, 253, 171, 253, 146, 253, 102, 253, 50, 253, 245, 252, 172, 252, 97, 252, 23, 252, 210, 251, 148, 251, 92, 251, 46, 251, 9, 251, 234, 250, 212, 250, 209, 250, 219, 250,
-246, 250, 45, 251, 114, 251, 197, 251, 35, 252, 136, 252, 242, 252, 94, 253, 209, 253, 74, 254, 200, 254, 69, 255, 192, 255, 55, 0, 155, 0, 242, 0, 62, 1, 111, 1, 148, 1, 174, 1, 176, 1, 165, 1, 140, 1, 94, 1, 30, 1, 211, 0, 118, 0, 14, 0, 159, 255, 43, 255, 187, 254, 81, 254,
-237, 253, 152, 253, 78, 253, 12, 253, 215, 252, 176, 252, 150, 252, 141, 252, 163, 252, 205, 252, 19, 253, 122, 253, 240, 253, 114, 254, 9, 255, 165, 255, 69, 0, 246, 0, 172, 1, 102, 2, 44, 3, 236, 3, 169, 4, 93, 5, 254, 5, 145, 6, 15, 7, 114, 7, 195, 7, 0, 8, 26, 8, 35, 8,
-26, 8, 236, 7, 172, 7, 91, 7, 240, 6, 120, 6, 245, 5, 103, 5, 218, 4, 78, 4, 194, 3, 63, 3, 191, 2, 66, 2, 211, 1, 108, 1, 15, 1, 204, 0, 158, 0, 128, 0, 123, 0, 133, 0, 152, 0, 181, 0, 222, 0, 16, 1, 75, 1, 153, 1, 238, 1, 75, 2, 171, 2, 6, 3,
-92, 3, 163, 3, 219, 3, 8, 4, 37, 4, 54, 4, 60, 4, 52, 4, 30, 4, 253, 3, 207, 3, 142, 3, 65, 3, 234, 2, 133, 2, 25, 2, 171, 1, 61, 1, 214, 0, 116, 0, 20, 0, 193, 255, 114, 255, 39, 255, 235, 254, 186, 254, 147, 254, 138, 254, 142, 254, 157, 254, 185, 254, 220, 254,
-4, 255, 45, 255, 91, 255, 141, 255, 195, 255, 255, 255, 56, 0, 108, 0, 149, 0, 178, 0, 192, 0, 184, 0, 161, 0, 127, 0, 73, 0, 5, 0, 180, 255, 83, 255, 225, 254, 101, 254, 219, 253, 68, 253, 169, 252, 8, 252, 101, 251, 202, 250, 54, 250, 180, 249, 63, 249, 214, 248, 126, 248, 51, 248,
-245, 247, 200, 247, 184, 247, 188, 247, 216, 247, 28, 248, 112, 248, 211, 248, 75, 249, 202, 249, 81, 250, 226, 250, 125, 251, 29, 252, 195, 252, 106, 253, 14, 254, 168, 254, 52, 255, 178, 255, 31, 0, 118, 0, 190, 0, 246, 0, 23, 1, 39, 1, 39, 1, 16, 1, 228, 0, 170, 0, 91, 0, 252, 255,
-148, 255, 35, 255, 174, 254, 60, 254, 205, 253, 102, 253, 6, 253, 172, 252, 90, 252, 20, 252, 216, 251, 175, 251, 159, 251, 160, 251, 184, 251, 229, 251, 30, 252, 100, 252, 179, 252, 11, 253, 109, 253, 222, 253, 90, 254, 223, 254, 106, 255, 241, 255, 116, 0, 239, 0, 87, 1, 182, 1, 11, 2, 76, 2,
-135, 2, 188, 2, 221, 2, 247, 2, 8, 3, 8, 3, 252, 2, 231, 2, 198, 2, 157, 2, 113, 2, 68, 2, 28, 2, 249, 1, 221, 1, 201, 1, 187, 1, 178, 1, 180, 1, 193, 1, 216, 1, 5, 2, 68, 2, 143, 2, 234, 2, 74, 3, 174, 3, 22, 4, 124, 4, 227, 4, 77, 5, 183, 5,
-31, 6, 131, 6, 216, 6, 32, 7, 89, 7, 120, 7, 131, 7, 127, 7, 101, 7, 54, 7, 249, 6, 171, 6, 72, 6, 214, 5, 87, 5, 199, 4, 45, 4, 139, 3, 230, 2, 67, 2, 163, 1, 16, 1, 135, 0, 8, 0, 153, 255, 52, 255, 218, 254, 141, 254, 88, 254, 53, 254, 40, 254, 61, 254,
-103, 254, 163, 254, 242, 254, 74, 255, 169, 255, 20, 0, 131, 0, 249, 0, 121, 1, 249, 1, 120, 2, 244, 2, 95, 3, 187, 3, 7, 4, 59, 4, 92, 4, 107, 4, 102, 4, 73, 4, 26, 4, 216, 3, 124, 3, 17, 3, 149, 2, 1, 2, 100, 1, 190, 0, 15, 0, 98, 255, 184, 254, 22, 254,
-123, 253, 231, 252, 95, 252, 221, 251, 101, 251, 254, 250, 169, 250, 101, 250, 57, 250, 40, 250, 37, 250, 46, 250, 73, 250, 108, 250, 151, 250, 211, 250, 28, 251, 109, 251, 202, 251, 40, 252, 133, 252, 222, 252, 40, 253, 104, 253, 158, 253, 194, 253, 223, 253, 242, 253, 248, 253, 244, 253, 231, 253, 205, 253,
-166, 253, 117, 253, 59, 253, 245, 252, 172, 252, 98, 252, 23, 252, 212, 251, 153, 251, 103, 251, 61, 251, 27, 251, 0, 251, 242, 250, 240, 250, 253, 250, 36, 251, 89, 251, 159, 251, 246, 251, 82, 252, 179, 252, 24, 253, 128, 253, 235, 253, 92, 254, 207, 254, 68, 255, 181, 255, 28, 0, 121, 0, 200, 0,
-5, 1, 51, 1, 81, 1, 91, 1, 88, 1, 73, 1, 35, 1, 242, 0, 184, 0, 108, 0, 21, 0, 182, 255, 80, 255, 234, 254, 133, 254, 38, 254, 210, 253, 136, 253, 76, 253, 24, 253, 242, 252, 217, 252, 205, 252, 215, 252, 244, 252, 45, 253, 130, 253, 233, 253, 100, 254, 238, 254, 127, 255, 25, 0,
-187, 0, 99, 1, 20, 2, 203, 2, 133, 3, 64, 4, 241, 4, 150, 5, 46, 6, 178, 6, 29, 7, 119, 7, 190, 7, 229, 7, 253, 7, 3, 8, 232, 7, 189, 7, 130, 7, 39, 7, 191, 6, 77, 6, 200, 5, 65, 5, 185, 4, 49, 4, 178, 3, 54, 3, 191, 2, 80, 2, 231, 1, 133, 1,
-53, 1, 244, 0, 194, 0, 170, 0, 163, 0, 169, 0, 188, 0, 217, 0, 252, 0, 40, 1, 98, 1, 162, 1, 236, 1, 62, 2, 143, 2, 221, 2, 32, 3, 90, 3, 137, 3, 167, 3, 186, 3, 196, 3, 191, 3, 175, 3, 149, 3, 109, 3, 57, 3, 250, 2, 176, 2, 87, 2, 250, 1, 152, 1,
-49, 1, 205, 0, 111, 0, 26, 0, 202, 255, 127, 255, 61, 255, 1, 255, 205, 254, 169, 254, 147, 254, 141, 254, 154, 254, 183, 254, 219, 254, 6, 255, 53, 255, 101, 255, 150, 255, 205, 255, 6, 0, 65, 0, 126, 0, 179, 0, 226, 0, 7, 1, 19, 1, 17, 1, 4, 1, 217, 0, 165, 0, 100, 0,
-13, 0, 171, 255, 64, 255, 195, 254, 60, 254, 172, 253, 17, 253, 115, 252, 212, 251, 54, 251, 169, 250, 39, 250, 177, 249, 87, 249, 11, 249, 203, 248, 164, 248, 144, 248, 138, 248, 153, 248, 167, 248, 183, 248, 200, 248, 215, 248, 241, 248, 25, 249, 131, 249, 31, 250, 237, 250, 6, 252, 66, 253, 150, 254,
-245, 255, 56, 1, 95, 2, 86, 3, 249, 3, 95, 4, 122, 4, 43, 4, 171, 3, 252, 2, 3, 2, 248, 0, 221, 255, 189, 254, 181, 253, 203, 252, 35, 252, 203, 251, 170, 251, 206, 251, 42, 252, 152, 252, 18, 253, 131, 253, 223, 253, 34, 254, 46, 254, 24, 254, 229, 253, 138, 253, 27, 253, 158, 252,
-20, 252, 143, 251, 24, 251, 186, 250, 160, 250, 186, 250, 14, 251, 208, 251, 196, 252, 232, 253, 64, 255, 157, 0, 252, 1, 78, 3, 123, 4, 133, 5, 89, 6, 209, 6, 8, 7, 239, 6, 98, 6, 157, 5, 162, 4, 103, 3, 38, 2, 226, 0, 180, 255, 175, 254, 207, 253, 47, 253, 214, 252, 170, 252,
-183, 252, 4, 253, 112, 253, 252, 253, 173, 254, 100, 255, 30, 0, 204, 0, 97, 1, 222, 1, 45, 2, 94, 2, 125, 2, 141, 2, 166, 2, 205, 2, 12, 3, 115, 3, 243, 3, 142, 4, 70, 5, 10, 6, 216, 6, 173, 7, 124, 8, 65, 9, 238, 9, 106, 10, 187, 10, 199, 10, 111, 10, 210, 9,
-230, 8, 147, 7, 16, 6, 99, 4, 141, 2, 183, 0, 230, 254, 57, 253, 186, 251, 102, 250, 91, 249, 168, 248, 54, 248, 24, 248, 97, 248, 231, 248, 171, 249, 188, 250, 228, 251, 29, 253, 98, 254, 152, 255, 191, 0, 200, 1, 176, 2, 128, 3, 49, 4, 193, 4, 67, 5, 183, 5, 36, 6, 148, 6,
-11, 7, 149, 7, 49, 8, 220, 8, 152, 9, 89, 10, 24, 11, 200, 11, 87, 12, 200, 12, 13, 13, 8, 13, 208, 12, 94, 12, 137, 11, 124, 10, 58, 9, 180, 7, 20, 6, 99, 4, 178, 2, 29, 1, 165, 255, 102, 254, 124, 253, 205, 252, 105, 252, 104, 252, 153, 252, 250, 252, 162, 253, 102, 254,
-66, 255, 55, 0, 40, 1, 15, 2, 209, 2, 89, 3, 178, 3, 201, 3, 162, 3, 93, 3, 252, 2, 146, 2, 38, 2, 186, 1, 89, 1, 2, 1, 181, 0, 131, 0, 101, 0, 87, 0, 92, 0, 99, 0, 101, 0, 90, 0, 44, 0, 225, 255, 115, 255, 187, 254, 219, 253, 212, 252, 145, 251, 69, 250,
-247, 248, 196, 247, 196, 246, 241, 245, 101, 245, 36, 245, 24, 245, 76, 245, 220, 245, 163, 246, 165, 247, 7, 249, 137, 250, 39, 252, 203, 253, 78, 255, 173, 0, 191, 1, 127, 2, 5, 3, 68, 3, 70, 3, 41, 3, 237, 2, 144, 2, 35, 2, 167, 1, 35, 1, 167, 0, 56, 0, 236, 255, 208, 255,
-223, 255, 46, 0, 175, 0, 70, 1, 237, 1, 123, 2, 235, 2, 55, 3, 56, 3, 23, 3, 214, 2, 104, 2, 238, 1, 109, 1, 225, 0, 98, 0, 243, 255, 159, 255, 124, 255, 130, 255, 188, 255, 50, 0, 202, 0, 133, 1, 114, 2, 129, 3, 177, 4, 14, 6, 123, 7, 238, 8, 82, 10, 134, 11,
-145, 12, 99, 13, 238, 13, 88, 14, 162, 14, 200, 14, 225, 14, 238, 14, 215, 14, 186, 14, 150, 14, 112, 14, 88, 14, 78, 14, 89, 14, 111, 14, 133, 14, 150, 14, 140, 14, 107, 14, 45, 14, 175, 13, 2, 13, 41, 12, 8, 11, 197, 9, 106, 8, 253, 6, 164, 5, 92, 4, 46, 3, 32, 2,
-29, 1, 31, 0, 44, 255, 68, 254, 103, 253, 206, 252, 105, 252, 53, 252, 88, 252, 156, 252, 242, 252, 70, 253, 118, 253, 134, 253, 105, 253, 40, 253, 223, 252, 148, 252, 108, 252, 92, 252, 100, 252, 136, 252, 169, 252, 200, 252, 225, 252, 254, 252, 42, 253, 126, 253, 15, 254, 199, 254, 172, 255, 160, 0,
-127, 1, 63, 2, 168, 2, 226, 2, 238, 2, 181, 2, 90, 2, 223, 1, 54, 1, 96, 0, 112, 255, 101, 254, 79, 253, 63, 252, 64, 251, 99, 250, 157, 249, 236, 248, 102, 248, 2, 248, 193, 247, 206, 247, 24, 248, 144, 248, 66, 249, 4, 250, 208, 250, 162, 251, 118, 252, 86, 253, 73, 254, 95, 255,
-138, 0, 201, 1, 16, 3, 78, 4, 132, 5, 174, 6, 206, 7, 235, 8, 13, 10, 47, 11, 77, 12, 101, 13, 87, 14, 38, 15, 206, 15, 17, 16, 9, 16, 181, 15, 218, 14, 177, 13, 79, 12, 183, 10, 17, 9, 115, 7, 241, 5, 156, 4, 101, 3, 78, 2, 73, 1, 82, 0, 105, 255, 153, 254,
-241, 253, 115, 253, 79, 253, 123, 253, 228, 253, 159, 254, 124, 255, 97, 0, 64, 1, 249, 1, 156, 2, 40, 3, 182, 3, 98, 4, 45, 5, 55, 6, 87, 7, 132, 8, 173, 9, 193, 10, 197, 11, 185, 12, 182, 13, 186, 14, 200, 15, 186, 16, 121, 17, 251, 17, 204, 17, 45, 17, 35, 16, 132, 14,
-163, 12, 147, 10, 86, 8, 3, 6, 167, 3, 66, 1, 242, 254, 186, 252, 159, 250, 202, 248, 34, 247, 166, 245, 131, 244, 167, 243, 17, 243, 244, 242, 68, 243, 230, 243, 239, 244, 54, 246, 149, 247, 1, 249, 101, 250, 199, 251, 39, 253, 148, 254, 21, 0, 166, 1, 75, 3, 242, 4, 150, 6, 34, 8,
-146, 9, 229, 10, 10, 12, 246, 12, 190, 13, 89, 14, 184, 14, 235, 14, 241, 14, 148, 14, 232, 13, 238, 12, 111, 11, 139, 9, 96, 7, 237, 4, 93, 2, 205, 255, 83, 253, 19, 251, 12, 249, 75, 247, 18, 246, 43, 245, 151, 244, 136, 244, 193, 244, 60, 245, 26, 246, 76, 247, 192, 248, 150, 250,
-185, 252, 251, 254, 80, 1, 126, 3, 125, 5, 73, 7, 185, 8, 25, 10, 108, 11, 197, 12, 35, 14, 122, 15, 161, 16, 125, 17, 29, 18, 104, 18, 126, 18, 131, 18, 125, 18, 140, 18, 147, 18, 143, 18, 68, 18, 167, 17, 186, 16, 67, 15, 107, 13, 77, 11, 223, 8, 73, 6, 166, 3, 2, 1,
-123, 254, 25, 252, 227, 249, 1, 248, 79, 246, 207, 244, 156, 243, 173, 242, 255, 241, 198, 241, 4, 242, 158, 242, 180, 243, 56, 245, 238, 246, 209, 248, 186, 250, 146, 252, 84, 254, 207, 255, 32, 1, 69, 2, 37, 3, 225, 3, 128, 4, 245, 4, 70, 5, 120, 5, 131, 5, 93, 5, 32, 5, 204, 4,
-109, 4, 17, 4, 183, 3, 87, 3, 223, 2, 76, 2, 115, 1, 91, 0, 20, 255, 146, 253, 241, 251, 71, 250, 153, 248, 252, 246, 114, 245, 253, 243, 210, 242, 222, 241, 36, 241, 207, 240, 181, 240, 207, 240, 49, 241, 208, 241, 164, 242, 205, 243, 92, 245, 36, 247, 43, 249, 58, 251, 39, 253, 236, 254,
-49, 0, 50, 1, 249, 1, 136, 2, 9, 3, 126, 3, 224, 3, 19, 4, 28, 4, 234, 3, 125, 3, 255, 2, 116, 2, 11, 2, 200, 1, 172, 1, 220, 1, 42, 2, 140, 2, 241, 2, 58, 3, 105, 3, 106, 3, 52, 3, 227, 2, 117, 2, 1, 2, 150, 1, 53, 1, 254, 0, 219, 0, 206, 0,
-229, 0, 23, 1, 101, 1, 231, 1, 166, 2, 147, 3, 191, 4, 56, 6, 223, 7, 185, 9, 195, 11, 214, 13, 237, 15, 224, 17, 169, 19, 70, 21, 153, 22, 179, 23, 164, 24, 98, 25, 230, 25, 62, 26, 89, 26, 21, 26, 155, 25, 238, 24, 16, 24, 49, 23, 84, 22, 141, 21, 197, 20, 246, 19,
-8, 19, 233, 17, 166, 16, 54, 15, 166, 13, 10, 12, 101, 10, 195, 8, 36, 7, 136, 5, 12, 4, 171, 2, 103, 1, 87, 0, 94, 255, 115, 254, 143, 253, 175, 252, 218, 251, 26, 251, 164, 250, 105, 250, 116, 250, 227, 250, 110, 251, 14, 252, 156, 252, 12, 253, 96, 253, 143, 253, 186, 253, 233, 253,
-41, 254, 124, 254, 216, 254, 57, 255, 133, 255, 193, 255, 237, 255, 253, 255, 10, 0, 23, 0, 59, 0, 116, 0, 191, 0, 27, 1, 105, 1, 160, 1, 170, 1, 107, 1, 0, 1, 99, 0, 164, 255, 222, 254, 22, 254, 70, 253, 113, 252, 151, 251, 170, 250, 179, 249, 180, 248, 177, 247, 184, 246, 200, 245,
-227, 244, 33, 244, 124, 243, 251, 242, 206, 242, 207, 242, 253, 242, 90, 243, 195, 243, 53, 244, 173, 244, 62, 245, 234, 245, 202, 246, 230, 247, 38, 249, 139, 250, 240, 251, 66, 253, 127, 254, 143, 255, 142, 0, 128, 1, 121, 2, 115, 3, 107, 4, 90, 5, 34, 6, 200, 6, 59, 7, 110, 7, 113, 7,
-58, 7, 191, 6, 35, 6, 104, 5, 150, 4, 201, 3, 7, 3, 111, 2, 245, 1, 144, 1, 64, 1, 236, 0, 147, 0, 56, 0, 233, 255, 177, 255, 152, 255, 200, 255, 29, 0, 149, 0, 47, 1, 197, 1, 85, 2, 210, 2, 62, 3, 162, 3, 7, 4, 129, 4, 18, 5, 193, 5, 143, 6, 98, 7,
-60, 8, 243, 8, 144, 9, 19, 10, 112, 10, 194, 10, 12, 11, 76, 11, 102, 11, 81, 11, 240, 10, 13, 10, 215, 8, 67, 7, 77, 5, 52, 3, 0, 1, 193, 254, 134, 252, 81, 250, 55, 248, 61, 246, 97, 244, 182, 242, 69, 241, 253, 239, 229, 238, 25, 238, 136, 237, 57, 237, 114, 237, 2, 238,
-233, 238, 69, 240, 206, 241, 117, 243, 36, 245, 212, 246, 137, 248, 70, 250, 38, 252, 33, 254, 59, 0, 107, 2, 147, 4, 175, 6, 152, 8, 94, 10, 3, 12, 113, 13, 186, 14, 226, 15, 216, 16, 139, 17, 3, 18, 43, 18, 221, 17, 59, 17, 60, 16, 173, 14, 216, 12, 195, 10, 118, 8, 34, 6,
-209, 3, 167, 1, 178, 255, 237, 253, 115, 252, 69, 251, 78, 250, 157, 249, 65, 249, 34, 249, 66, 249, 213, 249, 168, 250, 188, 251, 45, 253, 198, 254, 117, 0, 38, 2, 191, 3, 64, 5, 158, 6, 226, 7, 40, 9, 118, 10, 222, 11, 74, 13, 186, 14, 244, 15, 255, 16, 218, 17, 104, 18, 209, 18,
-40, 19, 122, 19, 197, 19, 4, 20, 44, 20, 1, 20, 147, 19, 218, 18, 154, 17, 31, 16, 108, 14, 115, 12, 104, 10, 80, 8, 49, 6, 42, 4, 60, 2, 120, 0, 243, 254, 149, 253, 101, 252, 117, 251, 177, 250, 27, 250, 244, 249, 23, 250, 131, 250, 104, 251, 135, 252, 204, 253, 37, 255, 108, 0,
-156, 1, 169, 2, 138, 3, 81, 4, 255, 4, 144, 5, 9, 6, 106, 6, 148, 6, 146, 6, 105, 6, 4, 6, 111, 5, 187, 4, 235, 3, 12, 3, 38, 2, 58, 1, 61, 0, 46, 255, 9, 254, 160, 252, 21, 251, 102, 249, 134, 247, 160, 245, 186, 243, 233, 241, 63, 240, 185, 238, 104, 237, 94, 236,
-133, 235, 233, 234, 156, 234, 129, 234, 152, 234, 10, 235, 183, 235, 162, 236, 250, 237, 160, 239, 125, 241, 145, 243, 165, 245, 168, 247, 131, 249, 21, 251, 130, 252, 202, 253, 245, 254, 20, 0, 38, 1, 14, 2, 194, 2, 68, 3, 121, 3, 128, 3, 108, 3, 74, 3, 59, 3, 61, 3, 86, 3, 129, 3,
-171, 3, 208, 3, 201, 3, 166, 3, 103, 3, 241, 2, 95, 2, 183, 1, 252, 0, 63, 0, 136, 255, 224, 254, 88, 254, 225, 253, 126, 253, 54, 253, 253, 252, 213, 252, 224, 252, 18, 253, 109, 253, 27, 254, 8, 255, 40, 0, 137, 1, 11, 3, 155, 4, 54, 6, 188, 7, 50, 9, 150, 10, 208, 11,
-247, 12, 11, 14, 243, 14, 180, 15, 80, 16, 160, 16, 174, 16, 139, 16, 40, 16, 163, 15, 18, 15, 124, 14, 229, 13, 75, 13, 174, 12, 237, 11, 16, 11, 24, 10, 248, 8, 197, 7, 136, 6, 73, 5, 23, 4, 240, 2, 221, 1, 236, 0, 19, 0, 86, 255, 186, 254, 37, 254, 151, 253, 11, 253,
-134, 252, 12, 252, 183, 251, 156, 251, 176, 251, 7, 252, 135, 252, 19, 253, 154, 253, 253, 253, 71, 254, 117, 254, 151, 254, 197, 254, 255, 254, 87, 255, 180, 255, 15, 0, 81, 0, 108, 0, 106, 0, 66, 0, 2, 0, 188, 255, 119, 255, 61, 255, 11, 255, 225, 254, 176, 254, 108, 254, 20, 254, 142, 253,
-229, 252, 37, 252, 75, 251, 114, 250, 160, 249, 218, 248, 37, 248, 122, 247, 218, 246, 58, 246, 157, 245, 1, 245, 100, 244, 213, 243, 83, 243, 230, 242, 157, 242, 118, 242, 134, 242, 213, 242, 76, 243, 237, 243, 175, 244, 126, 245, 92, 246, 79, 247, 94, 248, 139, 249, 237, 250, 114, 252, 15, 254, 187, 255,
-90, 1, 229, 2, 81, 4, 151, 5, 202, 6, 234, 7, 252, 8, 1, 10, 248, 10, 192, 11, 93, 12, 207, 12, 249, 12, 232, 12, 167, 12, 42, 12, 123, 11, 183, 10, 224, 9, 255, 8, 43, 8, 107, 7, 204, 6, 60, 6, 185, 5, 46, 5, 151, 4, 245, 3, 69, 3, 170, 2, 38, 2, 207, 1,
-179, 1, 185, 1, 225, 1, 17, 2, 61, 2, 100, 2, 120, 2, 150, 2, 191, 2, 10, 3, 123, 3, 10, 4, 191, 4, 126, 5, 59, 6, 235, 6, 125, 7, 249, 7, 91, 8, 175, 8, 251, 8, 64, 9, 113, 9, 122, 9, 87, 9, 213, 8, 2, 8, 239, 6, 135, 5, 238, 3, 63, 2, 125, 0,
-187, 254, 253, 252, 70, 251, 170, 249, 33, 248, 172, 246, 100, 245, 62, 244, 55, 243, 101, 242, 204, 241, 101, 241, 73, 241, 139, 241, 12, 242, 211, 242, 216, 243, 240, 244, 26, 246, 68, 247, 114, 248, 167, 249, 255, 250, 116, 252, 0, 254, 171, 255, 82, 1, 238, 2, 115, 4, 191, 5, 236, 6, 246, 7,
-198, 8, 117, 9, 4, 10, 78, 10, 100, 10, 71, 10, 212, 9, 17, 9, 14, 8, 183, 6, 5, 5, 37, 3, 22, 1, 238, 254, 207, 252, 191, 250, 241, 248, 83, 247, 229, 245, 207, 244, 239, 243, 62, 243, 212, 242, 171, 242, 184, 242, 22, 243, 217, 243, 223, 244, 48, 246, 214, 247, 149, 249, 101, 251,
-48, 253, 231, 254, 139, 0, 26, 2, 171, 3, 65, 5, 237, 6, 168, 8, 98, 10, 13, 12, 127, 13, 196, 14, 211, 15, 155, 16, 72, 17, 221, 17, 95, 18, 202, 18, 26, 19, 39, 19, 224, 18, 80, 18, 86, 17, 250, 15, 100, 14, 146, 12, 151, 10, 143, 8, 122, 6, 112, 4, 119, 2, 142, 0,
-204, 254, 38, 253, 153, 251, 44, 250, 233, 248, 205, 247, 234, 246, 104, 246, 42, 246, 57, 246, 173, 246, 70, 247, 255, 247, 193, 248, 123, 249, 43, 250, 204, 250, 103, 251, 253, 251, 140, 252, 18, 253, 137, 253, 231, 253, 27, 254, 49, 254, 37, 254, 237, 253, 156, 253, 52, 253, 186, 252, 53, 252, 168, 251,
-14, 251, 101, 250, 173, 249, 216, 248, 224, 247, 207, 246, 162, 245, 97, 244, 36, 243, 236, 241, 211, 240, 215, 239, 246, 238, 80, 238, 212, 237, 125, 237, 98, 237, 117, 237, 172, 237, 20, 238, 191, 238, 155, 239, 177, 240, 42, 242, 208, 243, 158, 245, 130, 247, 83, 249, 14, 251, 143, 252, 232, 253, 39, 255,
-82, 0, 116, 1, 141, 2, 154, 3, 104, 4, 4, 5, 106, 5, 112, 5, 85, 5, 30, 5, 216, 4, 157, 4, 108, 4, 72, 4, 38, 4, 0, 4, 199, 3, 111, 3, 255, 2, 115, 2, 197, 1, 12, 1, 76, 0, 144, 255, 229, 254, 76, 254, 213, 253, 116, 253, 36, 253, 233, 252, 184, 252, 151, 252,
-148, 252, 197, 252, 37, 253, 190, 253, 182, 254, 227, 255, 65, 1, 220, 2, 137, 4, 70, 6, 16, 8, 216, 9, 157, 11, 94, 13, 9, 15, 159, 16, 27, 18, 86, 19, 98, 20, 57, 21, 176, 21, 243, 21, 6, 22, 214, 21, 145, 21, 56, 21, 194, 20, 59, 20, 157, 19, 213, 18, 223, 17, 200, 16,
-137, 15, 38, 14, 183, 12, 62, 11, 203, 9, 95, 8, 250, 6, 173, 5, 118, 4, 81, 3, 70, 2, 67, 1, 66, 0, 64, 255, 55, 254, 53, 253, 63, 252, 129, 251, 244, 250, 153, 250, 138, 250, 142, 250, 158, 250, 167, 250, 153, 250, 128, 250, 95, 250, 84, 250, 96, 250, 139, 250, 218, 250, 45, 251,
-130, 251, 183, 251, 214, 251, 222, 251, 196, 251, 161, 251, 123, 251, 88, 251, 60, 251, 38, 251, 24, 251, 255, 250, 219, 250, 170, 250, 76, 250, 220, 249, 91, 249, 202, 248, 68, 248, 200, 247, 93, 247, 2, 247, 174, 246, 91, 246, 0, 246, 157, 245, 49, 245, 200, 244, 103, 244, 19, 244, 224, 243, 202, 243,
-207, 243, 0, 244, 76, 244, 171, 244, 24, 245, 145, 245, 19, 246, 158, 246, 79, 247, 29, 248, 15, 249, 52, 250, 104, 251, 170, 252, 223, 253, 250, 254, 250, 255, 206, 0, 135, 1, 47, 2, 197, 2, 73, 3, 186, 3, 15, 4, 47, 4, 42, 4, 251, 3, 148, 3, 17, 3, 114, 2, 172, 1, 218, 0,
-253, 255, 26, 255, 72, 254, 137, 253, 235, 252, 115, 252, 12, 252, 182, 251, 90, 251, 251, 250, 152, 250, 60, 250, 252, 249, 219, 249, 251, 249, 74, 250, 184, 250, 64, 251, 210, 251, 101, 252, 242, 252, 138, 253, 45, 254, 226, 254, 189, 255, 176, 0, 185, 1, 213, 2, 240, 3, 7, 5, 1, 6, 223, 6,
-165, 7, 73, 8, 214, 8, 80, 9, 175, 9, 225, 9, 225, 9, 166, 9, 245, 8, 255, 7, 198, 6, 53, 5, 134, 3, 196, 1, 252, 255, 58, 254, 128, 252, 214, 250, 59, 249, 170, 247, 37, 246, 179, 244, 83, 243, 6, 242, 246, 240, 22, 240, 106, 239, 38, 239, 46, 239, 114, 239, 0, 240, 177, 240,
-115, 241, 67, 242, 31, 243, 15, 244, 26, 245, 100, 246, 208, 247, 91, 249, 5, 251, 164, 252, 51, 254, 160, 255, 235, 0, 29, 2, 51, 3, 43, 4, 11, 5, 202, 5, 75, 6, 158, 6, 192, 6, 140, 6, 40, 6, 148, 5, 178, 4, 160, 3, 106, 2, 14, 1, 169, 255, 73, 254, 253, 252, 226, 251,
-235, 250, 30, 250, 149, 249, 49, 249, 241, 248, 254, 248, 56, 249, 160, 249, 100, 250, 103, 251, 154, 252, 15, 254, 159, 255, 58, 1, 216, 2, 96, 4, 218, 5, 69, 7, 167, 8, 15, 10, 125, 11, 253, 12, 117, 14, 224, 15, 27, 17, 24, 18, 228, 18, 102, 19, 179, 19, 230, 19, 253, 19, 2, 20,
-240, 19, 197, 19, 78, 19, 155, 18, 174, 17, 83, 16, 193, 14, 5, 13, 22, 11, 29, 9, 33, 7, 34, 5, 68, 3, 122, 1, 200, 255, 68, 254, 213, 252, 123, 251, 70, 250, 52, 249, 71, 248, 173, 247, 104, 247, 104, 247, 202, 247, 113, 248, 56, 249, 20, 250, 241, 250, 199, 251, 147, 252, 103, 253,
-58, 254, 13, 255, 224, 255, 154, 0, 60, 1, 167, 1, 228, 1, 254, 1, 237, 1, 189, 1, 121, 1, 32, 1, 175, 0, 41, 0, 141, 255, 201, 254, 233, 253, 239, 252, 202, 251, 135, 250, 44, 249, 182, 247, 58, 246, 192, 244, 79, 243, 255, 241, 196, 240, 162, 239, 178, 238, 218, 237, 28, 237, 151, 236,
-51, 236, 241, 235, 239, 235, 35, 236, 136, 236, 57, 237, 47, 238, 78, 239, 149, 240, 232, 241, 51, 243, 111, 244, 138, 245, 151, 246, 153, 247, 157, 248, 165, 249, 170, 250, 156, 251, 98, 252, 0, 253, 100, 253, 143, 253, 163, 253, 165, 253, 165, 253, 176, 253, 198, 253, 227, 253, 255, 253, 24, 254, 32, 254,
-25, 254, 2, 254, 213, 253, 152, 253, 83, 253, 3, 253, 186, 252, 124, 252, 80, 252, 59, 252, 52, 252, 57, 252, 64, 252, 75, 252, 93, 252, 137, 252, 226, 252, 99, 253, 38, 254, 43, 255, 85, 0, 163, 1, 0, 3, 93, 4, 186, 5, 18, 7, 109, 8, 202, 9, 36, 11, 114, 12, 176, 13, 195, 14,
-151, 15, 55, 16, 146, 16, 154, 16, 114, 16, 25, 16, 145, 15, 245, 14, 73, 14, 135, 13, 177, 12, 198, 11, 177, 10, 120, 9, 38, 8, 179, 6, 54, 5, 188, 3, 79, 2, 246, 0, 178, 255, 135, 254, 119, 253, 125, 252, 151, 251, 200, 250, 1, 250, 66, 249, 136, 248, 212, 247, 45, 247, 163, 246,
-79, 246, 39, 246, 60, 246, 132, 246, 222, 246, 72, 247, 171, 247, 8, 248, 95, 248, 196, 248, 62, 249, 202, 249, 117, 250, 37, 251, 208, 251, 107, 252, 231, 252, 80, 253, 162, 253, 224, 253, 22, 254, 68, 254, 104, 254, 130, 254, 145, 254, 142, 254, 117, 254, 73, 254, 3, 254, 150, 253, 21, 253, 130, 252,
-227, 251, 72, 251, 183, 250, 65, 250, 209, 249, 102, 249, 246, 248, 113, 248, 218, 247, 50, 247, 135, 246, 226, 245, 83, 245, 234, 244, 158, 244, 118, 244, 118, 244, 136, 244, 170, 244, 218, 244, 24, 245, 99, 245, 212, 245, 112, 246, 51, 247, 49, 248, 89, 249, 147, 250, 218, 251, 18, 253, 54, 254, 65, 255,
-40, 0, 2, 1, 211, 1, 155, 2, 88, 3, 8, 4, 149, 4, 249, 4, 60, 5, 84, 5, 68, 5, 31, 5, 230, 4, 148, 4, 55, 4, 210, 3, 100, 3, 254, 2, 161, 2, 88, 2, 34, 2, 246, 1, 205, 1, 160, 1, 111, 1, 59, 1, 20, 1, 0, 1, 9, 1, 62, 1, 131, 1, 213, 1,
-42, 2, 121, 2, 196, 2, 20, 3, 117, 3, 232, 3, 123, 4, 40, 5, 224, 5, 161, 6, 88, 7, 3, 8, 161, 8, 32, 9, 139, 9, 226, 9, 25, 10, 56, 10, 64, 10, 35, 10, 214, 9, 96, 9, 167, 8, 154, 7, 85, 6, 206, 4, 13, 3, 58, 1, 87, 255, 129, 253, 185, 251, 255, 249,
-99, 248, 212, 246, 81, 245, 221, 243, 123, 242, 45, 241, 255, 239, 16, 239, 84, 238, 213, 237, 204, 237, 255, 237, 107, 238, 42, 239, 253, 239, 224, 240, 219, 241, 232, 242, 9, 244, 88, 245, 215, 246, 117, 248, 53, 250, 243, 251, 164, 253, 67, 255, 170, 0, 251, 1, 55, 3, 79, 4, 85, 5, 67, 6,
-251, 6, 113, 7, 174, 7, 151, 7, 46, 7, 143, 6, 176, 5, 139, 4, 67, 3, 217, 1, 80, 0, 200, 254, 68, 253, 221, 251, 148, 250, 100, 249, 93, 248, 122, 247, 179, 246, 19, 246, 180, 245, 132, 245, 141, 245, 251, 245, 154, 246, 104, 247, 114, 248, 136, 249, 169, 250, 204, 251, 239, 252, 19, 254,
-58, 255, 113, 0, 179, 1, 2, 3, 95, 4, 183, 5, 6, 7, 41, 8, 41, 9, 4, 10, 160, 10, 32, 11, 137, 11, 214, 11, 16, 12, 54, 12, 58, 12, 2, 12, 155, 11, 252, 10, 10, 10, 240, 8, 178, 7, 76, 6, 219, 4, 99, 3, 245, 1, 148, 0, 67, 255, 16, 254, 248, 252, 241, 251,
-1, 251, 48, 250, 124, 249, 237, 248, 179, 248, 179, 248, 238, 248, 127, 249, 43, 250, 233, 250, 168, 251, 86, 252, 250, 252, 150, 253, 55, 254, 221, 254, 139, 255, 41, 0, 172, 0, 17, 1, 33, 1, 7, 1, 196, 0, 78, 0, 194, 255, 36, 255, 116, 254, 171, 253, 208, 252, 218, 251, 192, 250, 143, 249,
-71, 248, 216, 246, 89, 245, 201, 243, 52, 242, 172, 240, 51, 239, 228, 237, 190, 236, 183, 235, 219, 234, 37, 234, 138, 233, 14, 233, 201, 232, 170, 232, 183, 232, 25, 233, 179, 233, 132, 234, 173, 235, 5, 237, 131, 238, 36, 240, 205, 241, 118, 243, 21, 245, 163, 246, 41, 248, 169, 249, 33, 251, 146, 252,
-252, 253, 48, 255, 64, 0, 43, 1, 207, 1, 86, 2, 198, 2, 32, 3, 120, 3, 205, 3, 27, 4, 88, 4, 134, 4, 161, 4, 158, 4, 136, 4, 96, 4, 31, 4, 209, 3, 120, 3, 23, 3, 186, 2, 101, 2, 30, 2, 229, 1, 177, 1, 128, 1, 71, 1, 13, 1, 209, 0, 186, 0, 197, 0,
-242, 0, 120, 1, 41, 2, 252, 2, 243, 3, 236, 4, 229, 5, 218, 6, 212, 7, 212, 8, 224, 9, 252, 10, 18, 12, 31, 13, 254, 13, 176, 14, 52, 15, 112, 15, 121, 15, 91, 15, 20, 15, 182, 14, 76, 14, 212, 13, 79, 13, 190, 12, 28, 12, 90, 11, 129, 10, 147, 9, 143, 8, 135, 7,
-130, 6, 142, 5, 172, 4, 218, 3, 30, 3, 111, 2, 201, 1, 45, 1, 151, 0, 2, 0, 109, 255, 221, 254, 83, 254, 210, 253, 111, 253, 40, 253, 251, 252, 244, 252, 250, 252, 3, 253, 10, 253, 1, 253, 245, 252, 232, 252, 240, 252, 9, 253, 50, 253, 107, 253, 157, 253, 196, 253, 202, 253, 186, 253,
-152, 253, 96, 253, 38, 253, 233, 252, 162, 252, 86, 252, 1, 252, 157, 251, 44, 251, 176, 250, 43, 250, 149, 249, 242, 248, 70, 248, 146, 247, 227, 246, 62, 246, 176, 245, 62, 245, 217, 244, 127, 244, 31, 244, 177, 243, 53, 243, 169, 242, 36, 242, 167, 241, 82, 241, 35, 241, 19, 241, 49, 241, 109, 241,
-185, 241, 18, 242, 124, 242, 244, 242, 126, 243, 54, 244, 17, 245, 14, 246, 68, 247, 143, 248, 230, 249, 62, 251, 134, 252, 190, 253, 219, 254, 225, 255, 220, 0, 208, 1, 180, 2, 134, 3, 67, 4, 193, 4, 21, 5, 62, 5, 37, 5, 234, 4, 147, 4, 30, 4, 155, 3, 15, 3, 116, 2, 215, 1,
-58, 1, 156, 0, 7, 0, 115, 255, 224, 254, 70, 254, 169, 253, 11, 253, 114, 252, 238, 251, 128, 251, 59, 251, 19, 251, 251, 250, 241, 250, 230, 250, 224, 250, 225, 250, 0, 251, 62, 251, 156, 251, 49, 252, 223, 252, 160, 253, 109, 254, 60, 255, 9, 0, 205, 0, 139, 1, 66, 2, 234, 2, 128, 3,
-3, 4, 115, 4, 181, 4, 212, 4, 209, 4, 132, 4, 254, 3, 72, 3, 72, 2, 30, 1, 222, 255, 137, 254, 55, 253, 235, 251, 167, 250, 115, 249, 69, 248, 29, 247, 252, 245, 233, 244, 230, 243, 5, 243, 86, 242, 211, 241, 153, 241, 168, 241, 229, 241, 86, 242, 239, 242, 150, 243, 75, 244, 17, 245,
-236, 245, 222, 246, 6, 248, 84, 249, 190, 250, 64, 252, 186, 253, 37, 255, 108, 0, 138, 1, 145, 2, 126, 3, 81, 4, 17, 5, 189, 5, 37, 6, 91, 6, 93, 6, 4, 6, 109, 5, 166, 4, 164, 3, 116, 2, 42, 1, 199, 255, 92, 254, 247, 252, 161, 251, 111, 250, 88, 249, 92, 248, 141, 247,
-219, 246, 71, 246, 235, 245, 203, 245, 224, 245, 74, 246, 8, 247, 251, 247, 43, 249, 129, 250, 232, 251, 94, 253, 215, 254, 89, 0, 226, 1, 123, 3, 32, 5, 207, 6, 141, 8, 65, 10, 233, 11, 120, 13, 213, 14, 13, 16, 25, 17, 234, 17, 154, 18, 40, 19, 135, 19, 195, 19, 222, 19, 183, 19,
-84, 19, 190, 18, 219, 17, 184, 16, 110, 15, 247, 13, 99, 12, 197, 10, 28, 9, 123, 7, 226, 5, 85, 4, 225, 2, 123, 1, 36, 0, 228, 254, 196, 253, 192, 252, 237, 251, 104, 251, 26, 251, 14, 251, 72, 251, 153, 251, 251, 251, 97, 252, 193, 252, 30, 253, 132, 253, 249, 253, 121, 254, 8, 255,
-136, 255, 242, 255, 54, 0, 53, 0, 16, 0, 196, 255, 80, 255, 208, 254, 70, 254, 168, 253, 252, 252, 68, 252, 108, 251, 128, 250, 131, 249, 111, 248, 70, 247, 17, 246, 208, 244, 141, 243, 84, 242, 42, 241, 39, 240, 66, 239, 121, 238, 220, 237, 87, 237, 233, 236, 161, 236, 132, 236, 139, 236, 201, 236,
-76, 237, 253, 237, 227, 238, 2, 240, 56, 241, 132, 242, 219, 243, 45, 245, 123, 246, 187, 247, 241, 248, 31, 250, 72, 251, 98, 252, 108, 253, 93, 254, 22, 255, 167, 255, 11, 0, 46, 0, 58, 0, 51, 0, 25, 0, 252, 255, 221, 255, 178, 255, 123, 255, 56, 255, 229, 254, 130, 254, 23, 254, 165, 253,
-45, 253, 181, 252, 64, 252, 216, 251, 126, 251, 52, 251, 11, 251, 241, 250, 226, 250, 217, 250, 208, 250, 203, 250, 209, 250, 251, 250, 74, 251, 203, 251, 155, 252, 144, 253, 169, 254, 217, 255, 11, 1, 61, 2, 110, 3, 165, 4, 227, 5, 50, 7, 129, 8, 201, 9, 255, 10, 254, 11, 210, 12, 116, 13,
-204, 13, 255, 13, 13, 14, 237, 13, 187, 13, 120, 13, 27, 13, 170, 12, 37, 12, 129, 11, 189, 10, 226, 9, 233, 8, 223, 7, 212, 6, 202, 5, 213, 4, 239, 3, 24, 3, 84, 2, 148, 1, 216, 0, 27, 0, 88, 255, 145, 254, 201, 253, 1, 253, 64, 252, 139, 251, 243, 250, 114, 250, 10, 250,
-186, 249, 113, 249, 45, 249, 225, 248, 151, 248, 82, 248, 26, 248, 1, 248, 252, 247, 20, 248, 59, 248, 97, 248, 128, 248, 138, 248, 140, 248, 135, 248, 129, 248, 129, 248, 135, 248, 150, 248, 163, 248, 173, 248, 180, 248, 183, 248, 186, 248, 188, 248, 178, 248, 165, 248, 148, 248, 118, 248, 93, 248, 75, 248,
-72, 248, 82, 248, 100, 248, 121, 248, 124, 248, 112, 248, 81, 248, 32, 248, 239, 247, 195, 247, 176, 247, 175, 247, 194, 247, 235, 247, 25, 248, 73, 248, 121, 248, 174, 248, 238, 248, 68, 249, 196, 249, 99, 250, 42, 251, 27, 252, 25, 253, 30, 254, 31, 255, 16, 0, 242, 0, 191, 1, 128, 2, 58, 3,
-240, 3, 153, 4, 52, 5, 179, 5, 0, 6, 42, 6, 41, 6, 242, 5, 164, 5, 66, 5, 199, 4, 72, 4, 198, 3, 63, 3, 186, 2, 56, 2, 185, 1, 61, 1, 193, 0, 68, 0, 195, 255, 66, 255, 193, 254, 87, 254, 3, 254, 201, 253, 195, 253, 210, 253, 241, 253, 30, 254, 79, 254, 134, 254,
-205, 254, 54, 255, 187, 255, 103, 0, 68, 1, 52, 2, 51, 3, 56, 4, 57, 5, 52, 6, 41, 7, 20, 8, 249, 8, 205, 9, 137, 10, 45, 11, 167, 11, 231, 11, 249, 11, 211, 11, 87, 11, 164, 10, 188, 9, 130, 8, 37, 7, 171, 5, 24, 4, 128, 2, 232, 0, 86, 255, 197, 253, 52, 252,
-165, 250, 23, 249, 147, 247, 29, 246, 211, 244, 175, 243, 178, 242, 14, 242, 159, 241, 93, 241, 89, 241, 118, 241, 170, 241, 253, 241, 111, 242, 1, 243, 188, 243, 186, 244, 219, 245, 32, 247, 130, 248, 225, 249, 57, 251, 112, 252, 149, 253, 169, 254, 165, 255, 149, 0, 118, 1, 60, 2, 209, 2, 60, 3,
-114, 3, 90, 3, 21, 3, 162, 2, 236, 1, 21, 1, 34, 0, 15, 255, 244, 253, 218, 252, 205, 251, 216, 250, 247, 249, 48, 249, 139, 248, 254, 247, 141, 247, 88, 247, 80, 247, 116, 247, 243, 247, 167, 248, 133, 249, 147, 250, 180, 251, 223, 252, 14, 254, 69, 255, 130, 0, 196, 1, 27, 3, 120, 4,
-220, 5, 61, 7, 142, 8, 205, 9, 219, 10, 194, 11, 133, 12, 17, 13, 115, 13, 183, 13, 213, 13, 200, 13, 156, 13, 77, 13, 188, 12, 1, 12, 27, 11, 239, 9, 158, 8, 46, 7, 158, 5, 5, 4, 105, 2, 211, 0, 77, 255, 215, 253, 119, 252, 52, 251, 4, 250, 231, 248, 247, 247, 37, 247,
-116, 246, 22, 246, 247, 245, 15, 246, 125, 246, 25, 247, 207, 247, 157, 248, 109, 249, 59, 250, 9, 251, 223, 251, 188, 252, 162, 253, 132, 254, 83, 255, 11, 0, 133, 0, 208, 0, 244, 0, 230, 0, 184, 0, 119, 0, 34, 0, 174, 255, 36, 255, 129, 254, 175, 253, 196, 252, 193, 251, 154, 250, 97, 249,
-24, 248, 192, 246, 106, 245, 29, 244, 228, 242, 209, 241, 215, 240, 251, 239, 70, 239, 162, 238, 16, 238, 166, 237, 91, 237, 47, 237, 72, 237, 151, 237, 19, 238, 208, 238, 185, 239, 185, 240, 201, 241, 230, 242, 1, 244, 26, 245, 49, 246, 73, 247, 98, 248, 124, 249, 141, 250, 147, 251, 114, 252, 46, 253,
-202, 253, 47, 254, 115, 254, 166, 254, 197, 254, 230, 254, 7, 255, 40, 255, 72, 255, 101, 255, 127, 255, 144, 255, 156, 255, 164, 255, 170, 255, 174, 255, 181, 255, 195, 255, 220, 255, 1, 0, 57, 0, 134, 0, 223, 0, 66, 1, 164, 1, 7, 2, 108, 2, 215, 2, 90, 3, 243, 3, 181, 4, 156, 5,
-152, 6, 166, 7, 177, 8, 181, 9, 172, 10, 145, 11, 116, 12, 87, 13, 56, 14, 20, 15, 229, 15, 145, 16, 11, 17, 91, 17, 111, 17, 75, 17, 5, 17, 156, 16, 23, 16, 131, 15, 225, 14, 42, 14, 103, 13, 153, 12, 177, 11, 188, 10, 188, 9, 170, 8, 152, 7, 139, 6, 137, 5, 163, 4,
-209, 3, 22, 3, 118, 2, 223, 1, 78, 1, 187, 0, 35, 0, 134, 255, 231, 254, 77, 254, 187, 253, 67, 253, 227, 252, 151, 252, 102, 252, 64, 252, 29, 252, 250, 251, 208, 251, 166, 251, 124, 251, 105, 251, 103, 251, 117, 251, 155, 251, 197, 251, 237, 251, 11, 252, 27, 252, 37, 252, 40, 252, 47, 252,
-60, 252, 78, 252, 95, 252, 106, 252, 112, 252, 97, 252, 72, 252, 39, 252, 245, 251, 189, 251, 127, 251, 56, 251, 240, 250, 167, 250, 94, 250, 30, 250, 224, 249, 162, 249, 86, 249, 248, 248, 139, 248, 252, 247, 98, 247, 197, 246, 45, 246, 168, 245, 53, 245, 216, 244, 139, 244, 68, 244, 3, 244, 200, 243,
-154, 243, 125, 243, 146, 243, 207, 243, 53, 244, 218, 244, 160, 245, 123, 246, 105, 247, 90, 248, 74, 249, 54, 250, 32, 251, 10, 252, 243, 252, 224, 253, 200, 254, 171, 255, 115, 0, 35, 1, 186, 1, 38, 2, 111, 2, 158, 2, 173, 2, 165, 2, 143, 2, 108, 2, 66, 2, 19, 2, 224, 1, 167, 1,
-105, 1, 35, 1, 208, 0, 117, 0, 22, 0, 178, 255, 92, 255, 19, 255, 219, 254, 192, 254, 174, 254, 165, 254, 156, 254, 149, 254, 143, 254, 158, 254, 198, 254, 10, 255, 130, 255, 27, 0, 200, 0, 133, 1, 65, 2, 246, 2, 160, 3, 66, 4, 221, 4, 114, 5, 254, 5, 119, 6, 222, 6, 18, 7,
-24, 7, 243, 6, 141, 6, 235, 5, 30, 5, 28, 4, 229, 2, 148, 1, 40, 0, 171, 254, 47, 253, 179, 251, 65, 250, 212, 248, 106, 247, 7, 246, 171, 244, 91, 243, 37, 242, 34, 241, 75, 240, 174, 239, 109, 239, 94, 239, 128, 239, 228, 239, 102, 240, 2, 241, 197, 241, 166, 242, 165, 243, 209, 244,
-40, 246, 155, 247, 44, 249, 201, 250, 102, 252, 251, 253, 119, 255, 223, 0, 52, 2, 105, 3, 137, 4, 147, 5, 105, 6, 13, 7, 132, 7, 177, 7, 148, 7, 69, 7, 185, 6, 237, 5, 0, 5, 243, 3, 198, 2, 148, 1, 94, 0, 51, 255, 23, 254, 10, 253, 22, 252, 57, 251, 114, 250, 205, 249,
-91, 249, 19, 249, 4, 249, 77, 249, 200, 249, 116, 250, 87, 251, 73, 252, 73, 253, 81, 254, 100, 255, 128, 0, 179, 1, 0, 3, 92, 4, 198, 5, 46, 7, 134, 8, 198, 9, 217, 10, 202, 11, 152, 12, 58, 13, 191, 13, 41, 14, 114, 14, 150, 14, 159, 14, 129, 14, 50, 14, 192, 13, 36, 13,
-78, 12, 90, 11, 73, 10, 21, 9, 219, 7, 158, 6, 103, 5, 60, 4, 29, 3, 21, 2, 31, 1, 58, 0, 113, 255, 200, 254, 62, 254, 216, 253, 176, 253, 176, 253, 218, 253, 66, 254, 192, 254, 80, 255, 238, 255, 137, 0, 33, 1, 182, 1, 70, 2, 215, 2, 104, 3, 231, 3, 81, 4, 158, 4,
-165, 4, 129, 4, 48, 4, 163, 3, 252, 2, 62, 2, 106, 1, 128, 0, 133, 255, 112, 254, 63, 253, 254, 251, 167, 250, 67, 249, 218, 247, 106, 246, 254, 244, 154, 243, 65, 242, 14, 241, 255, 239, 16, 239, 85, 238, 189, 237, 61, 237, 216, 236, 148, 236, 109, 236, 107, 236, 178, 236, 43, 237, 216, 237,
-212, 238, 237, 239, 30, 241, 90, 242, 150, 243, 209, 244, 6, 246, 56, 247, 105, 248, 155, 249, 193, 250, 218, 251, 226, 252, 187, 253, 116, 254, 13, 255, 110, 255, 184, 255, 239, 255, 18, 0, 48, 0, 73, 0, 91, 0, 97, 0, 95, 0, 83, 0, 56, 0, 24, 0, 245, 255, 211, 255, 181, 255, 158, 255,
-148, 255, 146, 255, 151, 255, 168, 255, 192, 255, 219, 255, 251, 255, 26, 0, 55, 0, 86, 0, 123, 0, 173, 0, 234, 0, 81, 1, 204, 1, 88, 2, 249, 2, 151, 3, 48, 4, 194, 4, 76, 5, 213, 5, 100, 6, 251, 6, 148, 7, 44, 8, 162, 8, 252, 8, 55, 9, 59, 9, 35, 9, 245, 8,
-179, 8, 101, 8, 16, 8, 185, 7, 89, 7, 247, 6, 147, 6, 40, 6, 186, 5, 72, 5, 200, 4, 68, 4, 189, 3, 61, 3, 207, 2, 113, 2, 44, 2, 249, 1, 206, 1, 161, 1, 100, 1, 28, 1, 197, 0, 96, 0, 251, 255, 153, 255, 68, 255, 247, 254, 175, 254, 105, 254, 28, 254, 200, 253,
-104, 253, 0, 253, 151, 252, 52, 252, 228, 251, 164, 251, 118, 251, 93, 251, 67, 251, 39, 251, 254, 250, 198, 250, 135, 250, 72, 250, 16, 250, 226, 249, 199, 249, 173, 249, 148, 249, 119, 249, 69, 249, 11, 249, 203, 248, 134, 248, 68, 248, 4, 248, 201, 247, 144, 247, 90, 247, 38, 247, 248, 246, 206, 246,
-167, 246, 120, 246, 64, 246, 251, 245, 157, 245, 57, 245, 211, 244, 123, 244, 57, 244, 13, 244, 253, 243, 255, 243, 13, 244, 36, 244, 69, 244, 117, 244, 189, 244, 48, 245, 199, 245, 135, 246, 125, 247, 142, 248, 185, 249, 247, 250, 62, 252, 138, 253, 213, 254, 27, 0, 92, 1, 149, 2, 195, 3, 230, 4,
-252, 5, 239, 6, 199, 7, 132, 8, 251, 8, 75, 9, 119, 9, 106, 9, 67, 9, 7, 9, 179, 8, 83, 8, 235, 7, 118, 7, 238, 6, 89, 6, 183, 5, 2, 5, 69, 4, 128, 3, 193, 2, 20, 2, 118, 1, 244, 0, 143, 0, 58, 0, 241, 255, 179, 255, 124, 255, 76, 255, 61, 255, 77, 255,
-128, 255, 250, 255, 144, 0, 65, 1, 5, 2, 197, 2, 130, 3, 57, 4, 238, 4, 164, 5, 93, 6, 19, 7, 188, 7, 82, 8, 179, 8, 240, 8, 8, 9, 214, 8, 125, 8, 254, 7, 64, 7, 86, 6, 78, 5, 32, 4, 221, 2, 148, 1, 72, 0, 6, 255, 201, 253, 144, 252, 98, 251, 61, 250,
-33, 249, 38, 248, 75, 247, 145, 246, 18, 246, 197, 245, 157, 245, 164, 245, 213, 245, 30, 246, 132, 246, 10, 247, 165, 247, 85, 248, 46, 249, 29, 250, 32, 251, 60, 252, 90, 253, 118, 254, 132, 255, 115, 0, 75, 1, 7, 2, 162, 2, 41, 3, 152, 3, 220, 3, 252, 3, 249, 3, 167, 3, 37, 3,
-121, 2, 143, 1, 131, 0, 95, 255, 36, 254, 224, 252, 159, 251, 102, 250, 69, 249, 56, 248, 63, 247, 110, 246, 180, 245, 18, 245, 167, 244, 107, 244, 93, 244, 165, 244, 57, 245, 3, 246, 11, 247, 62, 248, 127, 249, 200, 250, 27, 252, 113, 253, 204, 254, 68, 0, 196, 1, 75, 3, 217, 4, 83, 6,
-186, 7, 0, 9, 25, 10, 18, 11, 228, 11, 139, 12, 19, 13, 121, 13, 171, 13, 183, 13, 156, 13, 72, 13, 203, 12, 43, 12, 87, 11, 95, 10, 77, 9, 26, 8, 216, 6, 143, 5, 64, 4, 249, 2, 186, 1, 129, 0, 94, 255, 73, 254, 68, 253, 94, 252, 144, 251, 218, 250, 79, 250, 238, 249,
-175, 249, 163, 249, 199, 249, 2, 250, 85, 250, 185, 250, 28, 251, 125, 251, 217, 251, 58, 252, 157, 252, 0, 253, 97, 253, 183, 253, 234, 253, 243, 253, 219, 253, 148, 253, 37, 253, 165, 252, 21, 252, 123, 251, 220, 250, 56, 250, 138, 249, 212, 248, 21, 248, 73, 247, 116, 246, 154, 245, 184, 244, 218, 243,
-5, 243, 64, 242, 164, 241, 36, 241, 194, 240, 151, 240, 125, 240, 114, 240, 125, 240, 147, 240, 184, 240, 255, 240, 116, 241, 10, 242, 204, 242, 185, 243, 180, 244, 182, 245, 184, 246, 177, 247, 160, 248, 135, 249, 107, 250, 77, 251, 44, 252, 255, 252, 195, 253, 110, 254, 239, 254, 82, 255, 143, 255, 164, 255,
-167, 255, 152, 255, 133, 255, 112, 255, 88, 255, 69, 255, 44, 255, 15, 255, 241, 254, 213, 254, 186, 254, 168, 254, 165, 254, 171, 254, 187, 254, 223, 254, 11, 255, 65, 255, 138, 255, 221, 255, 56, 0, 152, 0, 250, 0, 90, 1, 182, 1, 23, 2, 129, 2, 249, 2, 146, 3, 61, 4, 252, 4, 205, 5,
-154, 6, 98, 7, 27, 8, 202, 8, 114, 9, 26, 10, 199, 10, 118, 11, 36, 12, 190, 12, 68, 13, 176, 13, 241, 13, 26, 14, 45, 14, 36, 14, 17, 14, 243, 13, 195, 13, 136, 13, 68, 13, 242, 12, 144, 12, 33, 12, 161, 11, 13, 11, 114, 10, 207, 9, 42, 9, 142, 8, 254, 7, 123, 7,
-250, 6, 122, 6, 239, 5, 80, 5, 162, 4, 223, 3, 16, 3, 62, 2, 112, 1, 173, 0, 245, 255, 71, 255, 154, 254, 237, 253, 64, 253, 142, 252, 225, 251, 60, 251, 173, 250, 58, 250, 223, 249, 164, 249, 127, 249, 97, 249, 74, 249, 47, 249, 18, 249, 242, 248, 222, 248, 214, 248, 219, 248, 245, 248,
-20, 249, 53, 249, 80, 249, 97, 249, 106, 249, 106, 249, 98, 249, 86, 249, 70, 249, 47, 249, 20, 249, 246, 248, 211, 248, 178, 248, 147, 248, 115, 248, 80, 248, 37, 248, 230, 247, 152, 247, 63, 247, 218, 246, 126, 246, 44, 246, 229, 245, 187, 245, 153, 245, 128, 245, 115, 245, 108, 245, 109, 245, 135, 245,
-195, 245, 28, 246, 163, 246, 87, 247, 35, 248, 9, 249, 252, 249, 241, 250, 231, 251, 215, 252, 193, 253, 166, 254, 133, 255, 87, 0, 32, 1, 215, 1, 109, 2, 233, 2, 66, 3, 104, 3, 109, 3, 81, 3, 9, 3, 175, 2, 70, 2, 207, 1, 84, 1, 215, 0, 88, 0, 211, 255, 72, 255, 179, 254,
-28, 254, 134, 253, 243, 252, 123, 252, 25, 252, 207, 251, 184, 251, 183, 251, 203, 251, 250, 251, 47, 252, 108, 252, 186, 252, 26, 253, 143, 253, 41, 254, 235, 254, 197, 255, 184, 0, 185, 1, 185, 2, 183, 3, 164, 4, 134, 5, 94, 6, 40, 7, 225, 7, 135, 8, 8, 9, 85, 9, 121, 9, 103, 9,
-18, 9, 148, 8, 237, 7, 8, 7, 5, 6, 228, 4, 155, 3, 67, 2, 225, 0, 127, 255, 35, 254, 205, 252, 128, 251, 65, 250, 9, 249, 220, 247, 204, 246, 214, 245, 254, 244, 104, 244, 251, 243, 183, 243, 169, 243, 185, 243, 225, 243, 41, 244, 135, 244, 250, 244, 141, 245, 62, 246, 6, 247, 233, 247,
-217, 248, 207, 249, 201, 250, 169, 251, 124, 252, 65, 253, 231, 253, 126, 254, 9, 255, 128, 255, 225, 255, 44, 0, 90, 0, 86, 0, 50, 0, 235, 255, 109, 255, 217, 254, 49, 254, 113, 253, 178, 252, 245, 251, 62, 251, 161, 250, 23, 250, 164, 249, 82, 249, 22, 249, 243, 248, 253, 248, 39, 249, 115, 249,
-4, 250, 194, 250, 167, 251, 192, 252, 241, 253, 46, 255, 109, 0, 168, 1, 222, 2, 12, 4, 63, 5, 118, 6, 175, 7, 224, 8, 1, 10, 14, 11, 227, 11, 144, 12, 23, 13, 106, 13, 154, 13, 177, 13, 171, 13, 127, 13, 56, 13, 210, 12, 65, 12, 152, 11, 214, 10, 246, 9, 3, 9, 0, 8,
-237, 6, 210, 5, 180, 4, 156, 3, 146, 2, 148, 1, 169, 0, 208, 255, 4, 255, 71, 254, 161, 253, 15, 253, 148, 252, 73, 252, 33, 252, 27, 252, 72, 252, 150, 252, 250, 252, 115, 253, 243, 253, 116, 254, 244, 254, 110, 255, 229, 255, 90, 0, 205, 0, 58, 1, 159, 1, 232, 1, 15, 2, 24, 2,
-246, 1, 175, 1, 84, 1, 231, 0, 106, 0, 230, 255, 91, 255, 190, 254, 20, 254, 91, 253, 149, 252, 198, 251, 238, 250, 23, 250, 58, 249, 94, 248, 140, 247, 199, 246, 17, 246, 117, 245, 245, 244, 133, 244, 34, 244, 204, 243, 123, 243, 46, 243, 248, 242, 222, 242, 222, 242, 12, 243, 95, 243, 200, 243,
-65, 244, 194, 244, 66, 245, 185, 245, 55, 246, 186, 246, 64, 247, 215, 247, 113, 248, 10, 249, 148, 249, 11, 250, 112, 250, 186, 250, 237, 250, 22, 251, 57, 251, 92, 251, 132, 251, 181, 251, 237, 251, 42, 252, 110, 252, 180, 252, 252, 252, 68, 253, 141, 253, 218, 253, 44, 254, 134, 254, 234, 254, 86, 255,
-204, 255, 73, 0, 201, 0, 76, 1, 201, 1, 65, 2, 179, 2, 26, 3, 125, 3, 221, 3, 64, 4, 172, 4, 30, 5, 157, 5, 27, 6, 151, 6, 16, 7, 113, 7, 204, 7, 34, 8, 114, 8, 201, 8, 38, 9, 134, 9, 219, 9, 35, 10, 76, 10, 83, 10, 66, 10, 24, 10, 218, 9, 146, 9,
-64, 9, 224, 8, 118, 8, 0, 8, 119, 7, 229, 6, 74, 6, 163, 5, 245, 4, 67, 4, 135, 3, 203, 2, 18, 2, 100, 1, 199, 0, 53, 0, 175, 255, 43, 255, 160, 254, 14, 254, 108, 253, 197, 252, 32, 252, 138, 251, 8, 251, 151, 250, 63, 250, 245, 249, 178, 249, 117, 249, 59, 249, 6, 249,
-215, 248, 187, 248, 181, 248, 195, 248, 240, 248, 47, 249, 121, 249, 207, 249, 34, 250, 112, 250, 182, 250, 240, 250, 41, 251, 97, 251, 155, 251, 210, 251, 6, 252, 34, 252, 42, 252, 31, 252, 244, 251, 184, 251, 113, 251, 31, 251, 198, 250, 106, 250, 7, 250, 160, 249, 54, 249, 200, 248, 92, 248, 236, 247,
-120, 247, 255, 246, 123, 246, 239, 245, 98, 245, 220, 244, 98, 244, 1, 244, 189, 243, 138, 243, 107, 243, 95, 243, 94, 243, 104, 243, 148, 243, 220, 243, 66, 244, 224, 244, 162, 245, 127, 246, 120, 247, 126, 248, 137, 249, 152, 250, 169, 251, 186, 252, 201, 253, 211, 254, 213, 255, 207, 0, 176, 1, 127, 2,
-60, 3, 212, 3, 76, 4, 169, 4, 219, 4, 233, 4, 227, 4, 196, 4, 153, 4, 105, 4, 56, 4, 10, 4, 219, 3, 171, 3, 118, 3, 61, 3, 3, 3, 206, 2, 163, 2, 131, 2, 122, 2, 140, 2, 173, 2, 226, 2, 38, 3, 110, 3, 183, 3, 0, 4, 77, 4, 161, 4, 13, 5, 144, 5,
-37, 6, 208, 6, 123, 7, 30, 8, 178, 8, 36, 9, 130, 9, 207, 9, 6, 10, 52, 10, 88, 10, 93, 10, 67, 10, 12, 10, 156, 9, 3, 9, 75, 8, 106, 7, 107, 6, 88, 5, 45, 4, 239, 2, 172, 1, 98, 0, 35, 255, 240, 253, 200, 252, 181, 251, 176, 250, 183, 249, 209, 248, 7, 248,
-87, 247, 205, 246, 125, 246, 82, 246, 81, 246, 128, 246, 194, 246, 24, 247, 134, 247, 255, 247, 134, 248, 36, 249, 207, 249, 133, 250, 80, 251, 29, 252, 235, 252, 188, 253, 122, 254, 45, 255, 214, 255, 85, 0, 199, 0, 43, 1, 110, 1, 159, 1, 191, 1, 188, 1, 151, 1, 86, 1, 236, 0, 93, 0,
-184, 255, 251, 254, 44, 254, 89, 253, 130, 252, 179, 251, 241, 250, 58, 250, 159, 249, 24, 249, 163, 248, 71, 248, 6, 248, 218, 247, 206, 247, 244, 247, 63, 248, 179, 248, 99, 249, 42, 250, 6, 251, 238, 251, 209, 252, 175, 253, 134, 254, 97, 255, 66, 0, 45, 1, 27, 2, 6, 3, 230, 3, 158, 4,
-62, 5, 197, 5, 23, 6, 91, 6, 144, 6, 173, 6, 191, 6, 198, 6, 178, 6, 138, 6, 81, 6, 2, 6, 157, 5, 42, 5, 168, 4, 22, 4, 124, 3, 220, 2, 61, 2, 165, 1, 19, 1, 142, 0, 17, 0, 154, 255, 42, 255, 195, 254, 102, 254, 24, 254, 221, 253, 181, 253, 162, 253, 174, 253,
-199, 253, 237, 253, 35, 254, 91, 254, 149, 254, 205, 254, 1, 255, 48, 255, 88, 255, 127, 255, 162, 255, 186, 255, 193, 255, 177, 255, 136, 255, 55, 255, 204, 254, 74, 254, 182, 253, 25, 253, 118, 252, 207, 251, 31, 251, 106, 250, 172, 249, 230, 248, 28, 248, 79, 247, 126, 246, 176, 245, 229, 244, 33, 244,
-105, 243, 189, 242, 48, 242, 186, 241, 86, 241, 12, 241, 203, 240, 146, 240, 97, 240, 64, 240, 52, 240, 67, 240, 138, 240, 244, 240, 125, 241, 44, 242, 229, 242, 162, 243, 97, 244, 35, 245, 231, 245, 179, 246, 145, 247, 119, 248, 100, 249, 80, 250, 51, 251, 10, 252, 190, 252, 100, 253, 251, 253, 120, 254,
-242, 254, 104, 255, 216, 255, 72, 0, 180, 0, 21, 1, 112, 1, 192, 1, 5, 2, 67, 2, 125, 2, 179, 2, 238, 2, 44, 3, 109, 3, 175, 3, 240, 3, 45, 4, 101, 4, 147, 4, 185, 4, 215, 4, 236, 4, 252, 4, 9, 5, 27, 5, 52, 5, 86, 5, 137, 5, 197, 5, 7, 6, 77, 6,
-146, 6, 214, 6, 29, 7, 105, 7, 190, 7, 35, 8, 146, 8, 2, 9, 114, 9, 202, 9, 18, 10, 73, 10, 99, 10, 111, 10, 113, 10, 101, 10, 78, 10, 45, 10, 255, 9, 192, 9, 119, 9, 36, 9, 195, 8, 84, 8, 218, 7, 78, 7, 186, 6, 32, 6, 137, 5, 253, 4, 123, 4, 7, 4,
-158, 3, 53, 3, 200, 2, 79, 2, 208, 1, 73, 1, 199, 0, 81, 0, 230, 255, 148, 255, 79, 255, 17, 255, 219, 254, 163, 254, 106, 254, 49, 254, 2, 254, 223, 253, 201, 253, 209, 253, 227, 253, 255, 253, 32, 254, 55, 254, 68, 254, 55, 254, 25, 254, 240, 253, 187, 253, 134, 253, 77, 253, 13, 253,
-188, 252, 90, 252, 229, 251, 81, 251, 176, 250, 5, 250, 85, 249, 166, 248, 247, 247, 80, 247, 173, 246, 15, 246, 125, 245, 245, 244, 117, 244, 0, 244, 148, 243, 47, 243, 209, 242, 127, 242, 59, 242, 5, 242, 245, 241, 1, 242, 36, 242, 99, 242, 179, 242, 15, 243, 121, 243, 242, 243, 126, 244, 33, 245,
-232, 245, 199, 246, 191, 247, 204, 248, 228, 249, 3, 251, 28, 252, 51, 253, 67, 254, 70, 255, 59, 0, 34, 1, 244, 1, 170, 2, 72, 3, 206, 3, 42, 4, 107, 4, 146, 4, 139, 4, 105, 4, 46, 4, 212, 3, 108, 3, 253, 2, 133, 2, 23, 2, 172, 1, 65, 1, 219, 0, 115, 0, 9, 0,
-165, 255, 75, 255, 253, 254, 201, 254, 175, 254, 171, 254, 197, 254, 240, 254, 35, 255, 89, 255, 143, 255, 199, 255, 0, 0, 78, 0, 173, 0, 30, 1, 174, 1, 65, 2, 212, 2, 93, 3, 204, 3, 40, 4, 112, 4, 167, 4, 215, 4, 2, 5, 34, 5, 52, 5, 52, 5, 10, 5, 197, 4, 102, 4,
-224, 3, 69, 3, 154, 2, 216, 1, 13, 1, 60, 0, 100, 255, 149, 254, 207, 253, 19, 253, 109, 252, 210, 251, 66, 251, 195, 250, 84, 250, 243, 249, 173, 249, 130, 249, 110, 249, 126, 249, 164, 249, 216, 249, 30, 250, 104, 250, 183, 250, 13, 251, 105, 251, 203, 251, 48, 252, 161, 252, 16, 253, 125, 253,
-231, 253, 65, 254, 140, 254, 198, 254, 231, 254, 249, 254, 250, 254, 233, 254, 206, 254, 166, 254, 106, 254, 31, 254, 196, 253, 79, 253, 200, 252, 52, 252, 140, 251, 220, 250, 42, 250, 120, 249, 208, 248, 53, 248, 173, 247, 67, 247, 239, 246, 175, 246, 144, 246, 135, 246, 146, 246, 194, 246, 26, 247, 148, 247,
-66, 248, 34, 249, 31, 250, 59, 251, 98, 252, 139, 253, 177, 254, 203, 255, 228, 0, 254, 1, 28, 3, 64, 4, 103, 5, 131, 6, 137, 7, 121, 8, 71, 9, 238, 9, 123, 10, 238, 10, 70, 11, 141, 11, 195, 11, 216, 11, 215, 11, 193, 11, 133, 11, 53, 11, 211, 10, 89, 10, 207, 9, 58, 9,
-155, 8, 241, 7, 68, 7, 150, 6, 232, 5, 58, 5, 142, 4, 224, 3, 52, 3, 140, 2, 236, 1, 88, 1, 208, 0, 98, 0, 7, 0, 189, 255, 139, 255, 102, 255, 75, 255, 59, 255, 47, 255, 39, 255, 36, 255, 37, 255, 43, 255, 53, 255, 66, 255, 72, 255, 70, 255, 53, 255, 11, 255, 209, 254,
-137, 254, 46, 254, 209, 253, 113, 253, 17, 253, 176, 252, 76, 252, 230, 251, 121, 251, 7, 251, 144, 250, 16, 250, 140, 249, 5, 249, 121, 248, 241, 247, 111, 247, 254, 246, 157, 246, 78, 246, 17, 246, 222, 245, 178, 245, 134, 245, 97, 245, 68, 245, 57, 245, 79, 245, 127, 245, 208, 245, 64, 246, 188, 246,
-66, 247, 201, 247, 80, 248, 215, 248, 102, 249, 255, 249, 161, 250, 81, 251, 255, 251, 168, 252, 67, 253, 193, 253, 42, 254, 124, 254, 180, 254, 226, 254, 6, 255, 40, 255, 68, 255, 91, 255, 105, 255, 110, 255, 107, 255, 95, 255, 77, 255, 57, 255, 36, 255, 23, 255, 14, 255, 10, 255, 15, 255, 27, 255,
-46, 255, 66, 255, 87, 255, 111, 255, 138, 255, 166, 255, 198, 255, 239, 255, 40, 0, 110, 0, 196, 0, 55, 1, 182, 1, 65, 2, 219, 2, 120, 3, 24, 4, 183, 4, 92, 5, 7, 6, 185, 6, 115, 7, 47, 8, 235, 8, 149, 9, 46, 10, 183, 10, 21, 11, 96, 11, 149, 11, 166, 11, 163, 11,
-142, 11, 87, 11, 8, 11, 166, 10, 41, 10, 150, 9, 242, 8, 61, 8, 113, 7, 154, 6, 184, 5, 208, 4, 235, 3, 11, 3, 62, 2, 120, 1, 185, 0, 253, 255, 61, 255, 124, 254, 183, 253, 253, 252, 78, 252, 178, 251, 55, 251, 209, 250, 127, 250, 62, 250, 5, 250, 209, 249, 165, 249, 129, 249,
-105, 249, 106, 249, 129, 249, 168, 249, 226, 249, 32, 250, 90, 250, 141, 250, 171, 250, 187, 250, 191, 250, 185, 250, 178, 250, 168, 250, 153, 250, 129, 250, 94, 250, 38, 250, 217, 249, 126, 249, 19, 249, 160, 248, 43, 248, 181, 247, 71, 247, 223, 246, 125, 246, 44, 246, 230, 245, 171, 245, 125, 245, 93, 245,
-68, 245, 52, 245, 45, 245, 46, 245, 56, 245, 93, 245, 145, 245, 211, 245, 48, 246, 150, 246, 4, 247, 123, 247, 249, 247, 126, 248, 14, 249, 181, 249, 106, 250, 47, 251, 2, 252, 217, 252, 179, 253, 127, 254, 68, 255, 2, 0, 170, 0, 70, 1, 217, 1, 84, 2, 187, 2, 15, 3, 74, 3, 104, 3,
-116, 3, 104, 3, 63, 3, 4, 3, 184, 2, 86, 2, 237, 1, 125, 1, 22, 1, 185, 0, 101, 0, 35, 0, 237, 255, 189, 255, 152, 255, 128, 255, 118, 255, 123, 255, 168, 255, 239, 255, 78, 0, 213, 0, 104, 1, 6, 2, 168, 2, 71, 3, 227, 3, 122, 4, 25, 5, 191, 5, 111, 6, 48, 7,
-241, 7, 176, 8, 88, 9, 236, 9, 105, 10, 189, 10, 254, 10, 48, 11, 75, 11, 88, 11, 85, 11, 54, 11, 243, 10, 148, 10, 20, 10, 109, 9, 176, 8, 224, 7, 250, 6, 10, 6, 19, 5, 21, 4, 24, 3, 29, 2, 44, 1, 72, 0, 109, 255, 159, 254, 225, 253, 47, 253, 136, 252, 0, 252,
-139, 251, 43, 251, 244, 250, 211, 250, 195, 250, 198, 250, 212, 250, 232, 250, 3, 251, 39, 251, 84, 251, 141, 251, 207, 251, 22, 252, 97, 252, 167, 252, 232, 252, 34, 253, 74, 253, 107, 253, 132, 253, 141, 253, 148, 253, 150, 253, 141, 253, 126, 253, 101, 253, 64, 253, 8, 253, 195, 252, 111, 252, 8, 252,
-151, 251, 30, 251, 166, 250, 49, 250, 196, 249, 110, 249, 42, 249, 248, 248, 222, 248, 215, 248, 222, 248, 246, 248, 39, 249, 111, 249, 208, 249, 94, 250, 13, 251, 214, 251, 190, 252, 175, 253, 163, 254, 147, 255, 119, 0, 86, 1, 46, 2, 8, 3, 225, 3, 185, 4, 134, 5, 64, 6, 232, 6, 102, 7,
-195, 7, 6, 8, 43, 8, 57, 8, 57, 8, 43, 8, 2, 8, 201, 7, 130, 7, 19, 7, 154, 6, 24, 6, 123, 5, 220, 4, 57, 4, 135, 3, 216, 2, 42, 2, 121, 1, 206, 0, 40, 0, 139, 255, 243, 254, 97, 254, 215, 253, 93, 253, 241, 252, 147, 252, 85, 252, 48, 252, 31, 252, 40, 252,
-68, 252, 107, 252, 155, 252, 212, 252, 17, 253, 81, 253, 155, 253, 232, 253, 55, 254, 142, 254, 221, 254, 37, 255, 98, 255, 135, 255, 156, 255, 156, 255, 133, 255, 97, 255, 49, 255, 240, 254, 165, 254, 79, 254, 234, 253, 122, 253, 255, 252, 114, 252, 220, 251, 59, 251, 141, 250, 217, 249, 34, 249, 107, 248,
-188, 247, 23, 247, 128, 246, 248, 245, 120, 245, 0, 245, 142, 244, 36, 244, 194, 243, 117, 243, 70, 243, 49, 243, 70, 243, 127, 243, 205, 243, 46, 244, 159, 244, 23, 245, 149, 245, 36, 246, 193, 246, 108, 247, 46, 248, 247, 248, 194, 249, 132, 250, 51, 251, 211, 251, 90, 252, 211, 252, 65, 253, 166, 253,
-12, 254, 109, 254, 202, 254, 32, 255, 108, 255, 175, 255, 228, 255, 18, 0, 58, 0, 95, 0, 134, 0, 175, 0, 221, 0, 23, 1, 86, 1, 153, 1, 231, 1, 55, 2, 137, 2, 221, 2, 49, 3, 136, 3, 228, 3, 71, 4, 178, 4, 44, 5, 179, 5, 66, 6, 219, 6, 121, 7, 23, 8, 181, 8,
-82, 9, 239, 9, 140, 10, 44, 11, 205, 11, 109, 12, 4, 13, 138, 13, 255, 13, 84, 14, 134, 14, 160, 14, 155, 14, 117, 14, 59, 14, 235, 13, 120, 13, 240, 12, 84, 12, 156, 11, 211, 10, 253, 9, 17, 9, 28, 8, 30, 7, 21, 6, 13, 5, 11, 4, 17, 3, 46, 2, 90, 1, 149, 0,
-225, 255, 52, 255, 141, 254, 241, 253, 99, 253, 229, 252, 136, 252, 77, 252, 43, 252, 38, 252, 54, 252, 79, 252, 112, 252, 150, 252, 195, 252, 247, 252, 63, 253, 151, 253, 254, 253, 116, 254, 235, 254, 96, 255, 198, 255, 21, 0, 82, 0, 118, 0, 133, 0, 134, 0, 120, 0, 90, 0, 43, 0, 234, 255,
-139, 255, 19, 255, 136, 254, 228, 253, 50, 253, 120, 252, 188, 251, 255, 250, 69, 250, 147, 249, 230, 248, 69, 248, 174, 247, 36, 247, 167, 246, 52, 246, 205, 245, 115, 245, 36, 245, 230, 244, 191, 244, 171, 244, 174, 244, 202, 244, 244, 244, 45, 245, 116, 245, 197, 245, 34, 246, 147, 246, 21, 247, 168, 247,
-83, 248, 9, 249, 199, 249, 139, 250, 74, 251, 5, 252, 189, 252, 108, 253, 22, 254, 187, 254, 80, 255, 216, 255, 82, 0, 178, 0, 255, 0, 59, 1, 93, 1, 106, 1, 101, 1, 74, 1, 31, 1, 235, 0, 171, 0, 119, 0, 71, 0, 26, 0, 12, 0, 1, 0, 249, 255, 2, 0, 15, 0, 34, 0,
-72, 0, 131, 0, 207, 0, 51, 1, 178, 1, 58, 2, 201, 2, 91, 3, 230, 3, 104, 4, 230, 4, 95, 5, 217, 5, 93, 6, 223, 6, 96, 7, 220, 7, 60, 8, 135, 8, 184, 8, 191, 8, 179, 8, 150, 8, 94, 8, 29, 8, 210, 7, 104, 7, 232, 6, 83, 6, 151, 5, 201, 4, 234, 3,
-243, 2, 247, 1, 246, 0, 240, 255, 239, 254, 243, 253, 254, 252, 27, 252, 71, 251, 128, 250, 211, 249, 57, 249, 176, 248, 64, 248, 241, 247, 187, 247, 164, 247, 186, 247, 230, 247, 40, 248, 131, 248, 231, 248, 81, 249, 197, 249, 64, 250, 195, 250, 82, 251, 234, 251, 133, 252, 33, 253, 185, 253, 72, 254,
-205, 254, 61, 255, 159, 255, 245, 255, 51, 0, 100, 0, 136, 0, 150, 0, 148, 0, 131, 0, 91, 0, 29, 0, 206, 255, 108, 255, 239, 254, 103, 254, 214, 253, 55, 253, 155, 252, 1, 252, 115, 251, 243, 250, 128, 250, 35, 250, 214, 249, 150, 249, 105, 249, 85, 249, 87, 249, 116, 249, 197, 249, 52, 250,
-194, 250, 122, 251, 66, 252, 21, 253, 235, 253, 195, 254, 155, 255, 116, 0, 85, 1, 58, 2, 37, 3, 11, 4, 231, 4, 180, 5, 97, 6, 248, 6, 120, 7, 222, 7, 52, 8, 127, 8, 186, 8, 230, 8, 4, 9, 9, 9, 246, 8, 211, 8, 157, 8, 82, 8, 253, 7, 159, 7, 52, 7, 199, 6,
-88, 6, 235, 5, 127, 5, 21, 5, 180, 4, 82, 4, 242, 3, 150, 3, 63, 3, 240, 2, 172, 2, 124, 2, 90, 2, 72, 2, 73, 2, 83, 2, 100, 2, 125, 2, 153, 2, 184, 2, 218, 2, 0, 3, 39, 3, 77, 3, 111, 3, 137, 3, 152, 3, 145, 3, 118, 3, 72, 3, 253, 2, 160, 2,
-52, 2, 186, 1, 47, 1, 155, 0, 254, 255, 77, 255, 148, 254, 218, 253, 13, 253, 62, 252, 111, 251, 149, 250, 186, 249, 224, 248, 10, 248, 61, 247, 123, 246, 209, 245, 59, 245, 179, 244, 66, 244, 223, 243, 138, 243, 70, 243, 36, 243, 30, 243, 53, 243, 132, 243, 240, 243, 115, 244, 18, 245, 187, 245,
-109, 246, 39, 247, 239, 247, 194, 248, 164, 249, 149, 250, 139, 251, 132, 252, 108, 253, 67, 254, 9, 255, 171, 255, 54, 0, 177, 0, 23, 1, 109, 1, 186, 1, 249, 1, 35, 2, 64, 2, 79, 2, 69, 2, 49, 2, 21, 2, 237, 1, 197, 1, 157, 1, 121, 1, 91, 1, 66, 1, 45, 1, 31, 1,
-19, 1, 5, 1, 254, 0, 249, 0, 246, 0, 2, 1, 24, 1, 55, 1, 113, 1, 185, 1, 12, 2, 112, 2, 224, 2, 86, 3, 209, 3, 86, 4, 226, 4, 115, 5, 15, 6, 176, 6, 86, 7, 241, 7, 131, 8, 10, 9, 112, 9, 193, 9, 1, 10, 41, 10, 57, 10, 58, 10, 41, 10, 248, 9,
-179, 9, 90, 9, 226, 8, 92, 8, 199, 7, 28, 7, 103, 6, 166, 5, 220, 4, 16, 4, 68, 3, 131, 2, 212, 1, 49, 1, 159, 0, 25, 0, 151, 255, 26, 255, 159, 254, 46, 254, 199, 253, 124, 253, 71, 253, 38, 253, 29, 253, 34, 253, 46, 253, 62, 253, 84, 253, 108, 253, 135, 253, 177, 253,
-228, 253, 33, 254, 102, 254, 171, 254, 236, 254, 21, 255, 46, 255, 54, 255, 27, 255, 242, 254, 189, 254, 122, 254, 39, 254, 201, 253, 91, 253, 212, 252, 60, 252, 146, 251, 214, 250, 19, 250, 77, 249, 136, 248, 202, 247, 18, 247, 103, 246, 202, 245, 57, 245, 183, 244, 75, 244, 237, 243, 158, 243, 103, 243,
-64, 243, 40, 243, 44, 243, 74, 243, 126, 243, 208, 243, 58, 244, 179, 244, 56, 245, 205, 245, 106, 246, 16, 247, 209, 247, 160, 248, 125, 249, 120, 250, 119, 251, 121, 252, 129, 253, 126, 254, 115, 255, 100, 0, 69, 1, 28, 2, 235, 2, 159, 3, 65, 4, 206, 4, 51, 5, 131, 5, 189, 5, 213, 5,
-214, 5, 195, 5, 145, 5, 75, 5, 246, 4, 147, 4, 44, 4, 198, 3, 100, 3, 13, 3, 188, 2, 113, 2, 44, 2, 240, 1, 189, 1, 155, 1, 144, 1, 155, 1, 194, 1, 4, 2, 87, 2, 188, 2, 39, 3, 152, 3, 13, 4, 129, 4, 249, 4, 121, 5, 1, 6, 141, 6, 30, 7, 171, 7,
-39, 8, 148, 8, 232, 8, 31, 9, 69, 9, 91, 9, 96, 9, 91, 9, 76, 9, 32, 9, 223, 8, 136, 8, 7, 8, 111, 7, 196, 6, 3, 6, 55, 5, 99, 4, 134, 3, 173, 2, 215, 1, 4, 1, 70, 0, 145, 255, 230, 254, 81, 254, 199, 253, 71, 253, 228, 252, 148, 252, 89, 252, 71, 252,
-78, 252, 106, 252, 160, 252, 225, 252, 40, 253, 118, 253, 204, 253, 41, 254, 139, 254, 0, 255, 115, 255, 230, 255, 86, 0, 182, 0, 10, 1, 77, 1, 122, 1, 153, 1, 167, 1, 161, 1, 141, 1, 105, 1, 45, 1, 225, 0, 132, 0, 13, 0, 134, 255, 240, 254, 66, 254, 135, 253, 196, 252, 245, 251,
-40, 251, 92, 250, 148, 249, 226, 248, 63, 248, 171, 247, 59, 247, 224, 246, 155, 246, 123, 246, 121, 246, 147, 246, 219, 246, 81, 247, 233, 247, 173, 248, 153, 249, 150, 250, 164, 251, 188, 252, 214, 253, 240, 254, 18, 0, 57, 1, 100, 2, 150, 3, 189, 4, 217, 5, 224, 6, 194, 7, 139, 8, 53, 9,
-185, 9, 40, 10, 130, 10, 182, 10, 211, 10, 219, 10, 180, 10, 120, 10, 38, 10, 179, 9, 45, 9, 153, 8, 242, 7, 63, 7, 134, 6, 199, 5, 8, 5, 77, 4, 150, 3, 226, 2, 49, 2, 132, 1, 216, 0, 57, 0, 165, 255, 36, 255, 191, 254, 111, 254, 54, 254, 21, 254, 0, 254, 247, 253,
-252, 253, 8, 254, 28, 254, 64, 254, 106, 254, 154, 254, 207, 254, 2, 255, 47, 255, 82, 255, 97, 255, 98, 255, 83, 255, 41, 255, 246, 254, 184, 254, 107, 254, 23, 254, 186, 253, 76, 253, 211, 252, 80, 252, 191, 251, 37, 251, 134, 250, 227, 249, 61, 249, 153, 248, 247, 247, 96, 247, 210, 246, 78, 246,
-231, 245, 142, 245, 68, 245, 18, 245, 235, 244, 205, 244, 193, 244, 206, 244, 239, 244, 42, 245, 148, 245, 18, 246, 161, 246, 72, 247, 244, 247, 162, 248, 88, 249, 18, 250, 210, 250, 161, 251, 113, 252, 63, 253, 4, 254, 174, 254, 69, 255, 191, 255, 24, 0, 93, 0, 143, 0, 172, 0, 186, 0, 188, 0,
-176, 0, 150, 0, 113, 0, 64, 0, 7, 0, 201, 255, 131, 255, 63, 255, 254, 254, 191, 254, 148, 254, 116, 254, 96, 254, 101, 254, 116, 254, 140, 254, 175, 254, 223, 254, 25, 255, 95, 255, 189, 255, 41, 0, 169, 0, 69, 1, 238, 1, 164, 2, 109, 3, 60, 4, 17, 5, 240, 5, 212, 6, 187, 7,
-170, 8, 154, 9, 138, 10, 120, 11, 85, 12, 35, 13, 218, 13, 106, 14, 226, 14, 64, 15, 119, 15, 155, 15, 172, 15, 152, 15, 104, 15, 32, 15, 179, 14, 42, 14, 142, 13, 218, 12, 20, 12, 65, 11, 98, 10, 117, 9, 131, 8, 143, 7, 160, 6, 188, 5, 224, 4, 17, 4, 73, 3, 134, 2,
-200, 1, 15, 1, 97, 0, 193, 255, 62, 255, 208, 254, 119, 254, 59, 254, 8, 254, 219, 253, 190, 253, 165, 253, 147, 253, 151, 253, 167, 253, 194, 253, 244, 253, 36, 254, 86, 254, 141, 254, 177, 254, 206, 254, 229, 254, 233, 254, 230, 254, 221, 254, 200, 254, 172, 254, 135, 254, 82, 254, 14, 254, 187, 253,
-85, 253, 222, 252, 95, 252, 217, 251, 83, 251, 208, 250, 81, 250, 223, 249, 117, 249, 19, 249, 188, 248, 111, 248, 41, 248, 236, 247, 186, 247, 144, 247, 111, 247, 97, 247, 98, 247, 113, 247, 153, 247, 206, 247, 14, 248, 91, 248, 171, 248, 2, 249, 104, 249, 220, 249, 93, 250, 242, 250, 152, 251, 67, 252,
-241, 252, 156, 253, 63, 254, 218, 254, 110, 255, 250, 255, 127, 0, 0, 1, 110, 1, 205, 1, 25, 2, 70, 2, 98, 2, 106, 2, 84, 2, 45, 2, 247, 1, 162, 1, 67, 1, 216, 0, 96, 0, 235, 255, 122, 255, 20, 255, 183, 254, 99, 254, 26, 254, 220, 253, 170, 253, 135, 253, 132, 253, 153, 253,
-197, 253, 30, 254, 136, 254, 3, 255, 148, 255, 46, 0, 208, 0, 127, 1, 56, 2, 249, 2, 196, 3, 155, 4, 116, 5, 77, 6, 26, 7, 215, 7, 132, 8, 9, 9, 118, 9, 205, 9, 6, 10, 41, 10, 58, 10, 43, 10, 254, 9, 181, 9, 70, 9, 172, 8, 249, 7, 46, 7, 63, 6, 68, 5,
-60, 4, 36, 3, 6, 2, 231, 0, 202, 255, 181, 254, 168, 253, 169, 252, 188, 251, 220, 250, 11, 250, 89, 249, 191, 248, 60, 248, 238, 247, 189, 247, 168, 247, 184, 247, 221, 247, 18, 248, 91, 248, 183, 248, 34, 249, 160, 249, 55, 250, 213, 250, 121, 251, 31, 252, 191, 252, 87, 253, 221, 253, 90, 254,
-206, 254, 48, 255, 135, 255, 209, 255, 6, 0, 35, 0, 47, 0, 36, 0, 250, 255, 189, 255, 107, 255, 249, 254, 121, 254, 234, 253, 77, 253, 174, 252, 15, 252, 122, 251, 244, 250, 121, 250, 14, 250, 186, 249, 118, 249, 69, 249, 56, 249, 70, 249, 109, 249, 207, 249, 84, 250, 249, 250, 198, 251, 178, 252,
-177, 253, 189, 254, 214, 255, 245, 0, 24, 2, 68, 3, 114, 4, 163, 5, 198, 6, 220, 7, 230, 8, 195, 9, 129, 10, 36, 11, 156, 11, 241, 11, 47, 12, 81, 12, 76, 12, 47, 12, 246, 11, 145, 11, 21, 11, 133, 10, 212, 9, 24, 9, 83, 8, 127, 7, 167, 6, 204, 5, 243, 4, 33, 4,
-88, 3, 155, 2, 240, 1, 79, 1, 188, 0, 66, 0, 216, 255, 129, 255, 82, 255, 62, 255, 67, 255, 105, 255, 166, 255, 240, 255, 71, 0, 172, 0, 25, 1, 141, 1, 16, 2, 151, 2, 32, 3, 170, 3, 42, 4, 157, 4, 246, 4, 51, 5, 90, 5, 93, 5, 67, 5, 19, 5, 200, 4, 97, 4,
-232, 3, 88, 3, 175, 2, 246, 1, 44, 1, 82, 0, 107, 255, 124, 254, 136, 253, 143, 252, 148, 251, 163, 250, 183, 249, 214, 248, 9, 248, 79, 247, 166, 246, 18, 246, 148, 245, 40, 245, 206, 244, 150, 244, 125, 244, 129, 244, 177, 244, 3, 245, 108, 245, 241, 245, 130, 246, 29, 247, 195, 247, 111, 248,
-36, 249, 229, 249, 172, 250, 117, 251, 60, 252, 235, 252, 135, 253, 16, 254, 116, 254, 196, 254, 4, 255, 49, 255, 79, 255, 100, 255, 109, 255, 100, 255, 80, 255, 50, 255, 4, 255, 211, 254, 158, 254, 107, 254, 61, 254, 22, 254, 255, 253, 246, 253, 251, 253, 22, 254, 65, 254, 120, 254, 188, 254, 13, 255,
-101, 255, 197, 255, 56, 0, 181, 0, 62, 1, 221, 1, 135, 2, 58, 3, 247, 3, 181, 4, 117, 5, 53, 6, 239, 6, 169, 7, 99, 8, 21, 9, 195, 9, 105, 10, 249, 10, 117, 11, 220, 11, 33, 12, 71, 12, 87, 12, 75, 12, 37, 12, 235, 11, 159, 11, 49, 11, 178, 10, 33, 10, 116, 9,
-188, 8, 249, 7, 39, 7, 78, 6, 112, 5, 139, 4, 167, 3, 198, 2, 237, 1, 42, 1, 116, 0, 203, 255, 59, 255, 178, 254, 48, 254, 190, 253, 87, 253, 253, 252, 191, 252, 152, 252, 130, 252, 133, 252, 146, 252, 164, 252, 189, 252, 217, 252, 250, 252, 35, 253, 94, 253, 163, 253, 242, 253, 77, 254,
-166, 254, 250, 254, 68, 255, 124, 255, 167, 255, 195, 255, 206, 255, 210, 255, 209, 255, 192, 255, 167, 255, 133, 255, 73, 255, 253, 254, 164, 254, 54, 254, 187, 253, 57, 253, 182, 252, 44, 252, 164, 251, 35, 251, 160, 250, 33, 250, 168, 249, 51, 249, 195, 248, 88, 248, 246, 247, 154, 247, 69, 247, 2, 247,
-205, 246, 164, 246, 145, 246, 141, 246, 147, 246, 164, 246, 193, 246, 232, 246, 28, 247, 104, 247, 201, 247, 59, 248, 199, 248, 96, 249, 3, 250, 174, 250, 93, 251, 17, 252, 202, 252, 136, 253, 73, 254, 13, 255, 201, 255, 124, 0, 37, 1, 181, 1, 55, 2, 170, 2, 5, 3, 75, 3, 129, 3, 160, 3,
-168, 3, 162, 3, 141, 3, 110, 3, 79, 3, 47, 3, 15, 3, 239, 2, 209, 2, 179, 2, 150, 2, 123, 2, 109, 2, 113, 2, 134, 2, 177, 2, 244, 2, 66, 3, 157, 3, 2, 4, 108, 4, 219, 4, 79, 5, 204, 5, 81, 6, 224, 6, 118, 7, 13, 8, 162, 8, 41, 9, 161, 9, 5, 10,
-77, 10, 133, 10, 171, 10, 188, 10, 190, 10, 175, 10, 127, 10, 51, 10, 205, 9, 60, 9, 138, 8, 194, 7, 221, 6, 226, 5, 218, 4, 193, 3, 160, 2, 123, 1, 82, 0, 53, 255, 30, 254, 15, 253, 21, 252, 43, 251, 80, 250, 149, 249, 252, 248, 128, 248, 44, 248, 6, 248, 251, 247, 13, 248,
-69, 248, 142, 248, 234, 248, 107, 249, 5, 250, 181, 250, 130, 251, 99, 252, 77, 253, 57, 254, 31, 255, 255, 255, 209, 0, 147, 1, 74, 2, 243, 2, 127, 3, 248, 3, 92, 4, 148, 4, 176, 4, 179, 4, 137, 4, 63, 4, 218, 3, 78, 3, 160, 2, 221, 1, 2, 1, 19, 0, 29, 255, 32, 254,
-41, 253, 54, 252, 73, 251, 111, 250, 167, 249, 240, 248, 91, 248, 234, 247, 153, 247, 117, 247, 143, 247, 206, 247, 55, 248, 218, 248, 151, 249, 107, 250, 92, 251, 93, 252, 107, 253, 138, 254, 186, 255, 243, 0, 50, 2, 108, 3, 156, 4, 187, 5, 184, 6, 159, 7, 113, 8, 26, 9, 174, 9, 44, 10,
-128, 10, 176, 10, 196, 10, 169, 10, 104, 10, 13, 10, 146, 9, 250, 8, 83, 8, 154, 7, 212, 6, 9, 6, 57, 5, 115, 4, 177, 3, 246, 2, 74, 2, 164, 1, 6, 1, 120, 0, 1, 0, 157, 255, 86, 255, 58, 255, 53, 255, 74, 255, 127, 255, 190, 255, 6, 0, 99, 0, 198, 0, 49, 1,
-172, 1, 40, 2, 166, 2, 34, 3, 138, 3, 223, 3, 30, 4, 52, 4, 48, 4, 20, 4, 200, 3, 103, 3, 241, 2, 80, 2, 155, 1, 212, 0, 234, 255, 239, 254, 230, 253, 199, 252, 162, 251, 118, 250, 68, 249, 22, 248, 235, 246, 196, 245, 180, 244, 183, 243, 204, 242, 12, 242, 109, 241, 235, 240,
-147, 240, 95, 240, 70, 240, 82, 240, 141, 240, 235, 240, 109, 241, 37, 242, 246, 242, 224, 243, 225, 244, 238, 245, 3, 247, 31, 248, 71, 249, 116, 250, 164, 251, 207, 252, 238, 253, 253, 254, 223, 255, 166, 0, 82, 1, 199, 1, 37, 2, 109, 2, 143, 2, 153, 2, 143, 2, 106, 2, 44, 2, 225, 1,
-135, 1, 29, 1, 174, 0, 61, 0, 201, 255, 92, 255, 246, 254, 166, 254, 102, 254, 55, 254, 35, 254, 29, 254, 37, 254, 64, 254, 106, 254, 162, 254, 238, 254, 87, 255, 211, 255, 99, 0, 15, 1, 196, 1, 128, 2, 71, 3, 14, 4, 215, 4, 164, 5, 116, 6, 69, 7, 22, 8, 226, 8, 164, 9,
-88, 10, 241, 10, 116, 11, 224, 11, 39, 12, 88, 12, 117, 12, 123, 12, 108, 12, 76, 12, 16, 12, 191, 11, 92, 11, 227, 10, 88, 10, 196, 9, 42, 9, 139, 8, 234, 7, 71, 7, 170, 6, 19, 6, 130, 5, 1, 5, 143, 4, 41, 4, 209, 3, 130, 3, 57, 3, 244, 2, 187, 2, 138, 2,
-99, 2, 84, 2, 79, 2, 83, 2, 90, 2, 98, 2, 104, 2, 101, 2, 99, 2, 96, 2, 94, 2, 94, 2, 95, 2, 97, 2, 85, 2, 63, 2, 30, 2, 234, 1, 169, 1, 93, 1, 7, 1, 167, 0, 67, 0, 217, 255, 104, 255, 241, 254, 119, 254, 241, 253, 104, 253, 220, 252, 70, 252, 178, 251,
-35, 251, 152, 250, 23, 250, 161, 249, 55, 249, 220, 248, 139, 248, 71, 248, 13, 248, 220, 247, 180, 247, 153, 247, 135, 247, 128, 247, 142, 247, 165, 247, 199, 247, 248, 247, 43, 248, 99, 248, 163, 248, 231, 248, 52, 249, 143, 249, 254, 249, 123, 250, 5, 251, 158, 251, 58, 252, 216, 252, 115, 253, 16, 254,
-173, 254, 73, 255, 231, 255, 131, 0, 27, 1, 166, 1, 38, 2, 152, 2, 237, 2, 53, 3, 111, 3, 139, 3, 153, 3, 153, 3, 124, 3, 79, 3, 20, 3, 204, 2, 123, 2, 37, 2, 205, 1, 113, 1, 18, 1, 178, 0, 83, 0, 249, 255, 163, 255, 104, 255, 61, 255, 34, 255, 31, 255, 42, 255,
-64, 255, 99, 255, 144, 255, 199, 255, 13, 0, 100, 0, 200, 0, 58, 1, 189, 1, 69, 2, 208, 2, 91, 3, 225, 3, 99, 4, 220, 4, 77, 5, 181, 5, 19, 6, 95, 6, 156, 6, 198, 6, 202, 6, 182, 6, 140, 6, 51, 6, 198, 5, 69, 5, 168, 4, 247, 3, 55, 3, 107, 2, 145, 1,
-178, 0, 210, 255, 238, 254, 11, 254, 45, 253, 84, 252, 135, 251, 196, 250, 30, 250, 145, 249, 26, 249, 205, 248, 154, 248, 125, 248, 124, 248, 147, 248, 187, 248, 253, 248, 95, 249, 215, 249, 100, 250, 11, 251, 187, 251, 115, 252, 40, 253, 217, 253, 132, 254, 37, 255, 189, 255, 76, 0, 205, 0, 56, 1,
-146, 1, 214, 1, 242, 1, 247, 1, 228, 1, 162, 1, 71, 1, 212, 0, 60, 0, 139, 255, 201, 254, 246, 253, 25, 253, 57, 252, 91, 251, 135, 250, 189, 249, 255, 248, 91, 248, 205, 247, 84, 247, 14, 247, 239, 246, 246, 246, 58, 247, 176, 247, 73, 248, 15, 249, 251, 249, 0, 251, 32, 252, 96, 253,
-178, 254, 24, 0, 150, 1, 25, 3, 161, 4, 36, 6, 152, 7, 252, 8, 72, 10, 115, 11, 134, 12, 120, 13, 61, 14, 224, 14, 91, 15, 152, 15, 175, 15, 159, 15, 80, 15, 226, 14, 86, 14, 159, 13, 207, 12, 236, 11, 239, 10, 230, 9, 214, 8, 192, 7, 174, 6, 160, 5, 152, 4, 158, 3,
-175, 2, 206, 1, 15, 1, 108, 0, 227, 255, 139, 255, 86, 255, 58, 255, 66, 255, 101, 255, 155, 255, 230, 255, 74, 0, 188, 0, 61, 1, 204, 1, 96, 2, 245, 2, 126, 3, 249, 3, 101, 4, 183, 4, 234, 4, 6, 5, 5, 5, 225, 4, 165, 4, 76, 4, 198, 3, 42, 3, 119, 2, 155, 1,
-174, 0, 178, 255, 161, 254, 138, 253, 112, 252, 82, 251, 55, 250, 36, 249, 28, 248, 42, 247, 75, 246, 130, 245, 224, 244, 87, 244, 230, 243, 160, 243, 122, 243, 117, 243, 160, 243, 250, 243, 117, 244, 24, 245, 221, 245, 179, 246, 154, 247, 143, 248, 140, 249, 145, 250, 160, 251, 176, 252, 190, 253, 192, 254,
-168, 255, 122, 0, 37, 1, 165, 1, 8, 2, 71, 2, 94, 2, 93, 2, 65, 2, 2, 2, 171, 1, 61, 1, 181, 0, 28, 0, 116, 255, 196, 254, 15, 254, 91, 253, 174, 252, 15, 252, 126, 251, 0, 251, 165, 250, 95, 250, 47, 250, 39, 250, 53, 250, 89, 250, 160, 250, 3, 251, 126, 251, 27, 252,
-216, 252, 169, 253, 142, 254, 136, 255, 138, 0, 145, 1, 160, 2, 177, 3, 195, 4, 219, 5, 243, 6, 10, 8, 27, 9, 23, 10, 0, 11, 200, 11, 104, 12, 233, 12, 68, 13, 117, 13, 141, 13, 137, 13, 89, 13, 18, 13, 179, 12, 41, 12, 141, 11, 224, 10, 31, 10, 82, 9, 126, 8, 161, 7,
-193, 6, 223, 5, 253, 4, 42, 4, 96, 3, 162, 2, 1, 2, 107, 1, 223, 0, 102, 0, 245, 255, 142, 255, 56, 255, 249, 254, 202, 254, 176, 254, 167, 254, 167, 254, 172, 254, 176, 254, 180, 254, 187, 254, 193, 254, 203, 254, 217, 254, 232, 254, 245, 254, 0, 255, 2, 255, 246, 254, 226, 254, 194, 254,
-150, 254, 101, 254, 46, 254, 242, 253, 176, 253, 107, 253, 31, 253, 207, 252, 123, 252, 31, 252, 193, 251, 100, 251, 7, 251, 182, 250, 108, 250, 44, 250, 251, 249, 212, 249, 185, 249, 167, 249, 159, 249, 160, 249, 164, 249, 179, 249, 201, 249, 227, 249, 5, 250, 46, 250, 98, 250, 153, 250, 212, 250, 19, 251,
-76, 251, 132, 251, 187, 251, 242, 251, 46, 252, 111, 252, 185, 252, 8, 253, 90, 253, 170, 253, 246, 253, 64, 254, 136, 254, 210, 254, 30, 255, 110, 255, 195, 255, 20, 0, 96, 0, 165, 0, 221, 0, 12, 1, 50, 1, 78, 1, 98, 1, 108, 1, 104, 1, 89, 1, 63, 1, 28, 1, 244, 0, 202, 0,
-167, 0, 133, 0, 101, 0, 73, 0, 45, 0, 20, 0, 1, 0, 249, 255, 252, 255, 16, 0, 59, 0, 116, 0, 185, 0, 14, 1, 108, 1, 209, 1, 67, 2, 191, 2, 67, 3, 212, 3, 113, 4, 21, 5, 189, 5, 103, 6, 12, 7, 170, 7, 55, 8, 186, 8, 51, 9, 151, 9, 244, 9, 72, 10,
-133, 10, 172, 10, 192, 10, 178, 10, 126, 10, 50, 10, 198, 9, 55, 9, 149, 8, 222, 7, 7, 7, 35, 6, 51, 5, 45, 4, 34, 3, 18, 2, 248, 0, 226, 255, 207, 254, 189, 253, 190, 252, 205, 251, 239, 250, 56, 250, 153, 249, 16, 249, 173, 248, 93, 248, 31, 248, 6, 248, 6, 248, 30, 248,
-96, 248, 194, 248, 58, 249, 202, 249, 106, 250, 17, 251, 193, 251, 119, 252, 48, 253, 235, 253, 174, 254, 106, 255, 29, 0, 192, 0, 73, 1, 190, 1, 25, 2, 82, 2, 117, 2, 126, 2, 96, 2, 42, 2, 219, 1, 104, 1, 228, 0, 80, 0, 173, 255, 3, 255, 86, 254, 170, 253, 0, 253, 90, 252,
-194, 251, 57, 251, 195, 250, 105, 250, 59, 250, 44, 250, 66, 250, 145, 250, 252, 250, 130, 251, 53, 252, 252, 252, 214, 253, 205, 254, 214, 255, 238, 0, 25, 2, 73, 3, 122, 4, 170, 5, 196, 6, 208, 7, 207, 8, 166, 9, 105, 10, 23, 11, 153, 11, 246, 11, 53, 12, 68, 12, 34, 12, 222, 11,
-118, 11, 225, 10, 52, 10, 112, 9, 142, 8, 156, 7, 157, 6, 150, 5, 141, 4, 132, 3, 134, 2, 143, 1, 160, 0, 193, 255, 248, 254, 68, 254, 171, 253, 68, 253, 252, 252, 210, 252, 223, 252, 2, 253, 56, 253, 147, 253, 3, 254, 135, 254, 40, 255, 225, 255, 168, 0, 124, 1, 80, 2, 30, 3,
-229, 3, 139, 4, 29, 5, 155, 5, 235, 5, 30, 6, 54, 6, 32, 6, 225, 5, 130, 5, 248, 4, 66, 4, 111, 3, 125, 2, 103, 1, 63, 0, 7, 255, 188, 253, 107, 252, 20, 251, 184, 249, 97, 248, 16, 247, 206, 245, 164, 244, 144, 243, 157, 242, 212, 241, 40, 241, 160, 240, 79, 240, 35, 240,
-30, 240, 95, 240, 196, 240, 75, 241, 2, 242, 209, 242, 180, 243, 173, 244, 185, 245, 209, 246, 246, 247, 35, 249, 79, 250, 121, 251, 135, 252, 130, 253, 106, 254, 34, 255, 194, 255, 76, 0, 173, 0, 242, 0, 31, 1, 40, 1, 18, 1, 230, 0, 164, 0, 78, 0, 239, 255, 136, 255, 31, 255, 185, 254,
-89, 254, 14, 254, 218, 253, 187, 253, 185, 253, 209, 253, 248, 253, 50, 254, 101, 254, 140, 254, 163, 254, 215, 254, 59, 255, 216, 255, 211, 0, 232, 1, 21, 3, 104, 4, 186, 5, 251, 6, 252, 7, 150, 8, 225, 8, 192, 8, 80, 8, 219, 7, 113, 7, 101, 7, 134, 7, 215, 7, 184, 8, 244, 9,
-115, 11, 17, 13, 117, 14, 142, 15, 14, 16, 197, 15, 11, 15, 220, 13, 128, 12, 52, 11, 2, 10, 75, 9, 247, 8, 2, 9, 134, 9, 21, 10, 161, 10, 253, 10, 230, 10, 98, 10, 48, 9, 92, 7, 79, 5, 27, 3, 42, 1, 157, 255, 127, 254, 102, 254, 220, 254, 208, 255, 79, 1, 249, 2,
-166, 4, 15, 6, 236, 6, 95, 7, 72, 7, 185, 6, 253, 5, 29, 5, 86, 4, 182, 3, 65, 3, 33, 3, 53, 3, 111, 3, 195, 3, 214, 3, 159, 3, 220, 2, 104, 1, 147, 255, 93, 253, 5, 251, 213, 248, 219, 246, 131, 245, 173, 244, 90, 244, 248, 244, 42, 246, 193, 247, 165, 249, 110, 251,
-7, 253, 63, 254, 238, 254, 94, 255, 147, 255, 175, 255, 225, 255, 47, 0, 227, 0, 232, 1, 46, 3, 170, 4, 4, 6, 42, 7, 213, 7, 211, 7, 94, 7, 94, 6, 242, 4, 120, 3, 255, 1, 226, 0, 49, 0, 240, 255, 134, 0, 144, 1, 245, 2, 174, 4, 110, 6, 14, 8, 80, 9, 237, 9,
-23, 10, 182, 9, 217, 8, 216, 7, 187, 6, 189, 5, 229, 4, 49, 4, 194, 3, 115, 3, 46, 3, 209, 2, 46, 2, 74, 1, 3, 0, 70, 254, 80, 252, 35, 250, 16, 248, 90, 246, 16, 245, 233, 244, 120, 245, 165, 246, 161, 248, 14, 251, 188, 253, 153, 0, 53, 3, 122, 5, 56, 7, 46, 8,
-211, 8, 51, 9, 127, 9, 222, 9, 84, 10, 9, 11, 236, 11, 238, 12, 255, 13, 226, 14, 147, 15, 241, 15, 214, 15, 105, 15, 156, 14, 97, 13, 34, 12, 236, 10, 78, 10, 49, 10, 134, 10, 93, 11, 96, 12, 130, 13, 198, 14, 6, 16, 10, 17, 147, 17, 240, 16, 152, 15, 128, 13, 210, 10,
-10, 8, 48, 5, 99, 2, 172, 255, 15, 253, 177, 250, 142, 248, 146, 246, 191, 244, 9, 243, 102, 241, 217, 239, 59, 238, 161, 236, 12, 235, 17, 234, 216, 233, 100, 234, 61, 236, 167, 238, 123, 241, 182, 244, 86, 248, 52, 252, 85, 0, 13, 4, 41, 7, 107, 9, 96, 10, 238, 10, 37, 11, 38, 11,
-255, 10, 178, 10, 43, 10, 147, 9, 241, 8, 70, 8, 134, 7, 183, 6, 211, 5, 208, 4, 169, 3, 89, 2, 204, 0, 119, 255, 109, 254, 153, 254, 159, 255, 74, 1, 132, 3, 241, 5, 145, 8, 137, 11, 212, 14, 254, 17, 205, 20, 67, 22, 245, 22, 230, 22, 81, 22, 171, 21, 235, 20, 222, 19,
-138, 18, 8, 17, 98, 15, 195, 13, 35, 12, 124, 10, 204, 8, 13, 7, 61, 5, 19, 3, 182, 0, 45, 254, 245, 251, 136, 250, 222, 249, 122, 250, 154, 251, 10, 253, 190, 254, 238, 0, 116, 3, 97, 6, 227, 8, 172, 10, 149, 11, 10, 11, 55, 10, 43, 9, 35, 8, 0, 7, 197, 5, 105, 4,
-52, 3, 47, 2, 128, 1, 30, 1, 232, 0, 222, 0, 11, 1, 53, 1, 86, 1, 85, 1, 159, 1, 77, 2, 61, 4, 26, 7, 135, 10, 79, 14, 6, 18, 201, 21, 177, 25, 209, 29, 152, 33, 211, 36, 207, 37, 149, 37, 52, 36, 216, 33, 54, 31, 76, 28, 202, 24, 214, 20, 167, 16, 91, 12,
-69, 8, 86, 4, 148, 0, 12, 253, 167, 249, 101, 246, 26, 243, 185, 239, 83, 236, 109, 233, 155, 231, 189, 230, 89, 231, 160, 232, 62, 234, 28, 236, 142, 238, 109, 241, 207, 244, 246, 247, 100, 250, 3, 252, 75, 252, 107, 252, 121, 252, 203, 252, 10, 253, 43, 253, 6, 253, 205, 252, 153, 252, 122, 252,
-88, 252, 47, 252, 254, 251, 188, 251, 83, 251, 192, 250, 203, 249, 7, 249, 159, 248, 110, 249, 115, 251, 30, 254, 60, 1, 72, 4, 98, 7, 160, 10, 72, 14, 181, 17, 206, 20, 2, 22, 52, 22, 131, 21, 82, 20, 54, 19, 30, 18, 236, 16, 129, 15, 8, 14, 157, 12, 111, 11, 91, 10, 94, 9,
-102, 8, 118, 7, 139, 6, 113, 5, 38, 4, 198, 2, 175, 1, 166, 1, 132, 2, 191, 4, 132, 7, 104, 10, 59, 13, 48, 16, 95, 19, 211, 22, 173, 25, 103, 27, 247, 27, 140, 26, 154, 24, 85, 22, 2, 20, 107, 17, 146, 14, 81, 11, 230, 7, 137, 4, 85, 1, 96, 254, 149, 251, 247, 248,
-218, 246, 249, 244, 76, 243, 210, 241, 218, 240, 136, 240, 164, 241, 59, 244, 134, 247, 84, 251, 246, 254, 146, 2, 51, 6, 48, 10, 245, 13, 102, 17, 19, 19, 158, 19, 80, 19, 124, 18, 196, 17, 6, 17, 20, 16, 146, 14, 196, 12, 171, 10, 128, 8, 81, 6, 31, 4, 240, 1, 217, 255, 218, 253,
-235, 251, 235, 249, 249, 247, 100, 246, 250, 245, 128, 246, 86, 248, 183, 250, 24, 253, 72, 255, 109, 1, 206, 3, 111, 6, 222, 8, 105, 10, 22, 11, 71, 10, 41, 9, 251, 7, 25, 7, 53, 6, 37, 5, 182, 3, 252, 1, 49, 0, 94, 254, 139, 252, 183, 250, 230, 248, 81, 247, 206, 245, 86, 244,
-214, 242, 163, 241, 243, 240, 102, 241, 98, 243, 3, 246, 37, 249, 23, 252, 8, 255, 254, 1, 162, 5, 73, 9, 204, 12, 1, 15, 252, 15, 34, 16, 152, 15, 8, 15, 90, 14, 103, 13, 188, 11, 177, 9, 68, 7, 191, 4, 70, 2, 220, 255, 166, 253, 185, 251, 12, 250, 181, 248, 104, 247, 53, 246,
-71, 245, 106, 245, 112, 246, 168, 248, 145, 251, 128, 254, 86, 1, 38, 4, 85, 7, 224, 10, 157, 14, 167, 17, 0, 20, 8, 21, 143, 21, 228, 21, 56, 22, 64, 22, 220, 21, 219, 20, 40, 19, 73, 17, 75, 15, 85, 13, 115, 11, 171, 9, 67, 8, 26, 7, 18, 6, 18, 5, 59, 4, 205, 3,
-46, 4, 226, 5, 13, 8, 148, 10, 161, 12, 119, 14, 31, 16, 10, 18, 223, 19, 106, 21, 153, 21, 83, 20, 46, 18, 76, 15, 124, 12, 173, 9, 214, 6, 149, 3, 52, 0, 183, 252, 143, 249, 169, 246, 7, 244, 205, 241, 241, 239, 96, 238, 49, 237, 26, 236, 33, 235, 93, 234, 159, 234, 197, 235,
-7, 238, 58, 241, 123, 244, 184, 247, 7, 251, 199, 254, 230, 2, 87, 7, 5, 11, 229, 13, 56, 15, 155, 15, 164, 15, 130, 15, 19, 15, 57, 14, 218, 12, 204, 10, 164, 8, 109, 6, 89, 4, 103, 2, 156, 0, 32, 255, 209, 253, 141, 252, 52, 251, 224, 249, 233, 248, 156, 248, 230, 249, 225, 251,
-127, 254, 46, 1, 233, 3, 192, 6, 65, 10, 13, 14, 204, 17, 177, 20, 49, 22, 217, 22, 161, 22, 60, 22, 177, 21, 251, 20, 122, 19, 138, 17, 47, 15, 145, 12, 248, 9, 101, 7, 230, 4, 156, 2, 124, 0, 146, 254, 160, 252, 178, 250, 210, 248, 223, 247, 214, 247, 217, 248, 2, 251, 51, 253,
-97, 255, 93, 1, 160, 3, 28, 6, 211, 8, 205, 10, 247, 11, 179, 11, 125, 10, 16, 9, 161, 7, 93, 6, 253, 4, 120, 3, 183, 1, 13, 0, 127, 254, 57, 253, 35, 252, 57, 251, 153, 250, 67, 250, 13, 250, 234, 249, 241, 249, 112, 250, 151, 251, 131, 254, 44, 2, 124, 6, 216, 10, 10, 15,
-37, 19, 96, 23, 146, 27, 96, 31, 254, 33, 132, 34, 216, 33, 236, 31, 128, 29, 230, 26, 39, 24, 189, 20, 252, 16, 241, 12, 196, 8, 174, 4, 173, 0, 204, 252, 36, 249, 166, 245, 96, 242, 42, 239, 6, 236, 254, 232, 235, 230, 212, 229, 199, 229, 48, 231, 201, 232, 135, 234, 77, 236, 135, 238,
-32, 241, 68, 244, 10, 247, 67, 249, 140, 250, 8, 251, 114, 251, 240, 251, 161, 252, 21, 253, 65, 253, 176, 252, 214, 251, 197, 250, 140, 249, 58, 248, 226, 246, 145, 245, 111, 244, 93, 243, 84, 242, 111, 241, 2, 241, 33, 241, 14, 243, 186, 245, 6, 249, 94, 252, 118, 255, 114, 2, 142, 5, 239, 8,
-48, 12, 233, 14, 49, 16, 183, 16, 123, 16, 46, 16, 0, 16, 240, 15, 141, 15, 199, 14, 173, 13, 61, 12, 185, 10, 40, 9, 139, 7, 9, 6, 171, 4, 134, 3, 142, 2, 178, 1, 245, 0, 33, 1, 55, 2, 51, 4, 87, 7, 123, 10, 136, 13, 30, 16, 178, 18, 83, 21, 23, 24, 41, 26,
-87, 27, 61, 27, 159, 25, 169, 23, 119, 21, 65, 19, 198, 16, 1, 14, 160, 10, 11, 7, 97, 3, 206, 255, 118, 252, 94, 249, 169, 246, 153, 244, 221, 242, 119, 241, 120, 240, 248, 239, 7, 240, 186, 241, 70, 244, 112, 247, 204, 250, 231, 253, 240, 0, 27, 4, 176, 7, 67, 11, 155, 14, 166, 16,
-235, 17, 104, 18, 125, 18, 132, 18, 113, 18, 180, 17, 81, 16, 110, 14, 254, 11, 109, 9, 211, 6, 65, 4, 244, 1, 232, 255, 50, 254, 217, 252, 163, 251, 142, 250, 31, 250, 120, 250, 140, 251, 174, 253, 214, 255, 227, 1, 134, 3, 46, 5, 3, 7, 54, 9, 61, 11, 181, 12, 105, 13, 230, 12,
-44, 12, 76, 11, 136, 10, 126, 9, 35, 8, 12, 6, 136, 3, 202, 0, 235, 253, 14, 251, 66, 248, 152, 245, 92, 243, 85, 241, 128, 239, 247, 237, 219, 236, 64, 236, 36, 237, 6, 239, 142, 241, 124, 244, 79, 247, 44, 250, 58, 253, 224, 0, 150, 4, 56, 8, 120, 10, 200, 11, 45, 12, 209, 11,
-80, 11, 160, 10, 101, 9, 137, 7, 65, 5, 139, 2, 215, 255, 57, 253, 203, 250, 193, 248, 2, 247, 154, 245, 147, 244, 157, 243, 187, 242, 84, 242, 194, 242, 241, 243, 89, 246, 25, 249, 239, 251, 161, 254, 135, 1, 191, 4, 115, 8, 67, 12, 134, 15, 29, 18, 46, 19, 211, 19, 28, 20, 55, 20,
-230, 19, 42, 19, 166, 17, 161, 15, 104, 13, 28, 11, 245, 8, 247, 6, 42, 5, 203, 3, 148, 2, 130, 1, 110, 0, 130, 255, 217, 254, 28, 255, 54, 0, 193, 1, 126, 3, 208, 4, 251, 5, 14, 7, 128, 8, 242, 9, 86, 11, 101, 11, 142, 10, 226, 8, 152, 6, 98, 4, 50, 2, 237, 255,
-78, 253, 122, 250, 118, 247, 139, 244, 196, 241, 43, 239, 232, 236, 245, 234, 86, 233, 55, 232, 68, 231, 134, 230, 93, 230, 47, 231, 221, 232, 229, 235, 133, 239, 77, 243, 5, 247, 203, 250, 207, 254, 41, 3, 122, 7, 22, 11, 230, 13, 240, 14, 98, 15, 103, 15, 65, 15, 218, 14, 34, 14, 208, 12,
-3, 11, 5, 9, 228, 6, 194, 4, 163, 2, 134, 0, 164, 254, 216, 252, 29, 251, 95, 249, 218, 247, 181, 246, 158, 246, 203, 247, 174, 249, 62, 252, 211, 254, 120, 1, 53, 4, 138, 7, 0, 11, 133, 14, 225, 16, 67, 18, 206, 18, 128, 18, 19, 18, 126, 17, 150, 16, 254, 14, 245, 12, 107, 10,
-170, 7, 229, 4, 39, 2, 150, 255, 58, 253, 19, 251, 82, 249, 176, 247, 52, 246, 34, 245, 238, 244, 124, 245, 55, 247, 120, 249, 187, 251, 202, 253, 153, 255, 142, 1, 182, 3, 239, 5, 152, 7, 165, 8, 84, 8, 150, 7, 168, 6, 231, 5, 61, 5, 122, 4, 105, 3, 254, 1, 117, 0, 217, 254,
-84, 253, 231, 251, 152, 250, 183, 249, 40, 249, 222, 248, 230, 248, 89, 249, 76, 250, 58, 252, 114, 255, 64, 3, 136, 7, 121, 11, 41, 15, 146, 18, 7, 22, 89, 25, 110, 28, 32, 30, 124, 30, 209, 29, 25, 28, 41, 26, 14, 24, 190, 21, 193, 18, 87, 15, 111, 11, 49, 7, 224, 2, 130, 254,
-55, 250, 34, 246, 68, 242, 206, 238, 140, 235, 131, 232, 232, 229, 82, 228, 158, 227, 46, 228, 184, 229, 124, 231, 85, 233, 64, 235, 137, 237, 54, 240, 121, 243, 112, 246, 9, 249, 159, 250, 181, 251, 146, 252, 110, 253, 34, 254, 131, 254, 90, 254, 97, 253, 21, 252, 127, 250, 199, 248, 25, 247, 123, 245,
-57, 244, 71, 243, 147, 242, 32, 242, 239, 241, 32, 242, 12, 243, 35, 245, 190, 247, 206, 250, 155, 253, 57, 0, 172, 2, 120, 5, 127, 8, 159, 11, 56, 14, 238, 15, 2, 17, 102, 17, 178, 17, 230, 17, 246, 17, 85, 17, 58, 16, 151, 14, 116, 12, 59, 10, 241, 7, 188, 5, 201, 3, 26, 2,
-235, 0, 10, 0, 101, 255, 18, 255, 132, 255, 162, 0, 163, 2, 67, 5, 202, 7, 32, 10, 245, 11, 221, 13, 216, 15, 253, 17, 139, 19, 114, 20, 253, 19, 152, 18, 206, 16, 212, 14, 183, 12, 86, 10, 151, 7, 59, 4, 189, 0, 41, 253, 197, 249, 153, 246, 172, 243, 81, 241, 117, 239, 239, 237,
-196, 236, 235, 235, 122, 235, 174, 235, 51, 237, 88, 239, 19, 242, 225, 244, 159, 247, 86, 250, 138, 253, 30, 1, 215, 4, 50, 8, 137, 10, 38, 12, 216, 12, 39, 13, 56, 13, 5, 13, 7, 12, 135, 10, 132, 8, 14, 6, 156, 3, 52, 1, 2, 255, 36, 253, 141, 251, 99, 250, 102, 249, 130, 248,
-178, 247, 110, 247, 187, 247, 191, 248, 137, 250, 75, 252, 249, 253, 90, 255, 239, 0, 190, 2, 13, 5, 23, 7, 173, 8, 60, 9, 217, 8, 18, 8, 3, 7, 193, 5, 43, 4, 47, 2, 101, 255, 90, 252, 23, 249, 201, 245, 152, 242, 140, 239, 226, 236, 181, 234, 221, 232, 106, 231, 91, 230, 199, 229,
-219, 229, 115, 231, 197, 233, 197, 236, 254, 239, 41, 243, 84, 246, 209, 249, 165, 253, 136, 1, 7, 5, 86, 7, 207, 8, 65, 9, 55, 9, 253, 8, 158, 8, 172, 7, 88, 6, 165, 4, 152, 2, 137, 0, 128, 254, 146, 252, 224, 250, 98, 249, 51, 248, 52, 247, 81, 246, 140, 245, 118, 245, 30, 246,
-152, 247, 91, 250, 77, 253, 98, 0, 99, 3, 155, 6, 10, 10, 219, 13, 93, 17, 87, 20, 71, 22, 255, 22, 60, 23, 19, 23, 165, 22, 224, 21, 190, 20, 221, 18, 190, 16, 113, 14, 22, 12, 208, 9, 163, 7, 170, 5, 249, 3, 101, 2, 226, 0, 103, 255, 34, 254, 34, 253, 66, 253, 232, 253,
-1, 255, 38, 0, 11, 1, 208, 1, 180, 2, 237, 3, 53, 5, 73, 6, 81, 6, 170, 5, 63, 4, 137, 2, 213, 0, 42, 255, 60, 253, 2, 251, 131, 248, 191, 245, 1, 243, 80, 240, 198, 237, 144, 235, 169, 233, 56, 232, 80, 231, 188, 230, 128, 230, 68, 231, 228, 232, 100, 235, 40, 239, 23, 243,
-21, 247, 207, 250, 142, 254, 100, 2, 124, 6, 61, 10, 101, 13, 147, 15, 99, 16, 194, 16, 201, 16, 160, 16, 45, 16, 103, 15, 209, 13, 195, 11, 94, 9, 165, 6, 202, 3, 232, 0, 19, 254, 132, 251, 30, 249, 230, 246, 245, 244, 105, 243, 82, 242, 197, 242, 11, 244, 253, 245, 93, 248, 167, 250,
-241, 252, 96, 255, 49, 2, 19, 5, 216, 7, 149, 9, 153, 10, 211, 10, 122, 10, 10, 10, 129, 9, 135, 8, 18, 7, 56, 5, 227, 2, 110, 0, 241, 253, 130, 251, 94, 249, 126, 247, 250, 245, 229, 244, 255, 243, 69, 243, 50, 243, 198, 243, 254, 244, 55, 247, 135, 249, 206, 251, 187, 253, 157, 255,
-157, 1, 238, 3, 58, 6, 35, 8, 114, 9, 174, 9, 159, 9, 86, 9, 13, 9, 146, 8, 219, 7, 136, 6, 210, 4, 229, 2, 214, 0, 220, 254, 8, 253, 118, 251, 130, 250, 236, 249, 184, 249, 6, 250, 189, 250, 227, 251, 34, 254, 6, 1, 82, 4, 168, 7, 144, 10, 54, 13, 160, 15, 43, 18,
-160, 20, 227, 22, 224, 23, 1, 24, 67, 23, 172, 21, 229, 19, 234, 17, 104, 15, 72, 12, 171, 8, 108, 4, 241, 255, 96, 251, 204, 246, 126, 242, 118, 238, 198, 234, 163, 231, 198, 228, 48, 226, 99, 224, 126, 223, 111, 223, 179, 224, 121, 226, 127, 228, 153, 230, 247, 232, 174, 235, 236, 238, 111, 242,
-168, 245, 117, 248, 22, 250, 85, 251, 61, 252, 236, 252, 68, 253, 62, 253, 116, 252, 37, 251, 146, 249, 206, 247, 35, 246, 159, 244, 82, 243, 133, 242, 245, 241, 156, 241, 119, 241, 133, 241, 216, 241, 9, 243, 237, 244, 61, 247, 208, 249, 40, 252, 112, 254, 191, 0, 141, 3, 136, 6, 169, 9, 4, 12,
-170, 13, 156, 14, 191, 14, 174, 14, 101, 14, 161, 13, 64, 12, 112, 10, 23, 8, 143, 5, 6, 3, 147, 0, 127, 254, 192, 252, 93, 251, 151, 250, 5, 250, 172, 249, 205, 249, 142, 250, 223, 251, 22, 254, 135, 0, 242, 2, 30, 5, 38, 7, 79, 9, 182, 11, 38, 14, 24, 16, 119, 17, 94, 17,
-185, 16, 166, 15, 86, 14, 204, 12, 1, 11, 182, 8, 1, 6, 36, 3, 48, 0, 93, 253, 178, 250, 55, 248, 66, 246, 149, 244, 44, 243, 14, 242, 63, 241, 211, 240, 94, 241, 235, 242, 17, 245, 200, 247, 131, 250, 72, 253, 28, 0, 111, 3, 230, 6, 121, 10, 46, 13, 15, 15, 45, 16, 96, 16,
-77, 16, 252, 15, 77, 15, 8, 14, 96, 12, 70, 10, 2, 8, 193, 5, 145, 3, 153, 1, 214, 255, 72, 254, 8, 253, 214, 251, 181, 250, 201, 249, 116, 249, 170, 249, 198, 250, 84, 252, 246, 253, 130, 255, 4, 1, 180, 2, 165, 4, 217, 6, 157, 8, 224, 9, 202, 9, 9, 9, 210, 7, 79, 6,
-134, 4, 111, 2, 214, 255, 192, 252, 121, 249, 14, 246, 195, 242, 163, 239, 181, 236, 109, 234, 139, 232, 11, 231, 27, 230, 165, 229, 179, 229, 197, 230, 244, 232, 187, 235, 17, 239, 79, 242, 125, 245, 154, 248, 5, 252, 138, 255, 23, 3, 209, 5, 164, 7, 181, 8, 218, 8, 198, 8, 135, 8, 15, 8,
-9, 7, 160, 5, 190, 3, 124, 1, 32, 255, 177, 252, 83, 250, 32, 248, 29, 246, 128, 244, 22, 243, 225, 241, 32, 241, 57, 241, 18, 242, 6, 244, 194, 246, 170, 249, 151, 252, 103, 255, 94, 2, 130, 5, 210, 8, 180, 11, 24, 14, 73, 15, 205, 15, 241, 15, 225, 15, 164, 15, 38, 15, 59, 14,
-180, 12, 235, 10, 232, 8, 205, 6, 180, 4, 162, 2, 209, 0, 45, 255, 171, 253, 72, 252, 9, 251, 11, 250, 160, 249, 36, 250, 29, 251, 130, 252, 191, 253, 219, 254, 213, 255, 18, 1, 128, 2, 8, 4, 21, 5, 89, 5, 1, 5, 235, 3, 175, 2, 87, 1, 220, 255, 234, 253, 163, 251, 250, 248,
-15, 246, 38, 243, 72, 240, 183, 237, 134, 235, 181, 233, 157, 232, 8, 232, 219, 231, 64, 232, 139, 233, 139, 235, 117, 238, 11, 242, 166, 245, 41, 249, 88, 252, 156, 255, 251, 2, 153, 6, 219, 9, 172, 12, 102, 14, 86, 15, 220, 15, 18, 16, 241, 15, 104, 15, 81, 14, 74, 12, 220, 9, 14, 7,
-238, 3, 208, 0, 187, 253, 242, 250, 136, 248, 106, 246, 172, 244, 92, 243, 126, 242, 84, 242, 105, 243, 20, 245, 74, 247, 141, 249, 182, 251, 199, 253, 33, 0, 180, 2, 91, 5, 168, 7, 33, 9, 254, 9, 22, 10, 230, 9, 141, 9, 6, 9, 231, 7, 95, 6, 102, 4, 4, 2, 159, 255, 62, 253,
-14, 251, 46, 249, 151, 247, 118, 246, 152, 245, 228, 244, 96, 244, 110, 244, 2, 245, 65, 246, 43, 248, 24, 250, 249, 251, 150, 253, 97, 255, 94, 1, 205, 3, 20, 6, 11, 8, 47, 9, 135, 9, 128, 9, 45, 9, 153, 8, 183, 7, 118, 6, 137, 4, 104, 2, 30, 0, 236, 253, 239, 251, 46, 250,
-248, 248, 77, 248, 1, 248, 34, 248, 153, 248, 104, 249, 175, 250, 244, 252, 160, 255, 169, 2, 143, 5, 54, 8, 172, 10, 52, 13, 237, 15, 167, 18, 4, 21, 83, 22, 222, 22, 109, 22, 89, 21, 239, 19, 46, 18, 155, 15, 130, 12, 230, 8, 184, 4, 109, 0, 19, 252, 217, 247, 232, 243, 65, 240,
-24, 237, 87, 234, 221, 231, 186, 229, 110, 228, 226, 227, 48, 228, 188, 229, 134, 231, 132, 233, 150, 235, 242, 237, 149, 240, 186, 243, 199, 246, 133, 249, 129, 251, 150, 252, 74, 253, 171, 253, 209, 253, 173, 253, 58, 253, 31, 252, 208, 250, 89, 249, 227, 247, 144, 246, 102, 245, 140, 244, 11, 244, 185, 243,
-152, 243, 149, 243, 210, 243, 98, 244, 249, 245, 23, 248, 176, 250, 112, 253, 25, 0, 188, 2, 146, 5, 187, 8, 247, 11, 1, 15, 21, 17, 113, 18, 228, 18, 163, 18, 25, 18, 76, 17, 217, 15, 252, 13, 191, 11, 45, 9, 153, 6, 16, 4, 186, 1, 183, 255, 254, 253, 179, 252, 194, 251, 0, 251,
-109, 250, 115, 250, 8, 251, 51, 252, 66, 254, 93, 0, 121, 2, 85, 4, 68, 6, 82, 8, 180, 10, 239, 12, 192, 14, 197, 15, 183, 15, 53, 15, 76, 14, 39, 13, 183, 11, 247, 9, 147, 7, 224, 4, 243, 1, 225, 254, 218, 251, 234, 248, 46, 246, 222, 243, 207, 241, 11, 240, 173, 238, 186, 237,
-60, 237, 40, 238, 200, 239, 5, 242, 170, 244, 66, 247, 219, 249, 149, 252, 161, 255, 186, 2, 179, 5, 203, 7, 63, 9, 244, 9, 35, 10, 47, 10, 28, 10, 168, 9, 206, 8, 155, 7, 252, 5, 47, 4, 77, 2, 106, 0, 161, 254, 251, 252, 141, 251, 80, 250, 42, 249, 26, 248, 133, 247, 134, 247,
-31, 248, 174, 249, 101, 251, 40, 253, 179, 254, 59, 0, 214, 1, 172, 3, 87, 5, 144, 6, 21, 7, 96, 6, 55, 5, 169, 3, 215, 1, 197, 255, 111, 253, 136, 250, 90, 247, 7, 244, 175, 240, 139, 237, 163, 234, 33, 232, 79, 230, 235, 228, 252, 227, 172, 227, 213, 227, 129, 228, 106, 230, 2, 233,
-28, 236, 126, 239, 172, 242, 195, 245, 218, 248, 55, 252, 164, 255, 9, 3, 151, 5, 132, 7, 197, 8, 76, 9, 167, 9, 208, 9, 111, 9, 133, 8, 39, 7, 44, 5, 232, 2, 131, 0, 9, 254, 187, 251, 169, 249, 233, 247, 170, 246, 177, 245, 0, 245, 17, 245, 217, 245, 78, 247, 198, 249, 134, 252,
-92, 255, 0, 2, 158, 4, 86, 7, 72, 10, 60, 13, 217, 15, 251, 17, 17, 19, 203, 19, 51, 20, 94, 20, 62, 20, 206, 19, 175, 18, 7, 17, 10, 15, 193, 12, 86, 10, 239, 7, 160, 5, 155, 3, 197, 1, 28, 0, 164, 254, 101, 253, 112, 252, 86, 252, 228, 252, 223, 253, 27, 255, 47, 0,
-52, 1, 50, 2, 142, 3, 8, 5, 151, 6, 116, 7, 183, 7, 90, 7, 62, 6, 247, 4, 130, 3, 165, 1, 88, 255, 184, 252, 183, 249, 167, 246, 168, 243, 213, 240, 121, 238, 131, 236, 1, 235, 66, 234, 218, 233, 201, 233, 97, 234, 168, 235, 136, 237, 80, 240, 95, 243, 121, 246, 100, 249, 71, 252,
-78, 255, 151, 2, 17, 6, 62, 9, 8, 12, 164, 13, 183, 14, 82, 15, 117, 15, 33, 15, 90, 14, 200, 12, 141, 10, 247, 7, 16, 5, 19, 2, 43, 255, 102, 252, 38, 250, 49, 248, 136, 246, 74, 245, 95, 244, 211, 243, 35, 244, 54, 245, 189, 246, 163, 248, 107, 250, 40, 252, 221, 253, 234, 255,
-23, 2, 97, 4, 5, 6, 15, 7, 134, 7, 75, 7, 225, 6, 76, 6, 111, 5, 25, 4, 111, 2, 95, 0, 32, 254, 226, 251, 183, 249, 211, 247, 50, 246, 215, 244, 238, 243, 41, 243, 138, 242, 57, 242, 120, 242, 57, 243, 208, 244, 207, 246, 235, 248, 252, 250, 16, 253, 83, 255, 218, 1, 160, 4,
-27, 7, 58, 9, 52, 10, 158, 10, 150, 10, 46, 10, 122, 9, 125, 8, 5, 7, 45, 5, 50, 3, 38, 1, 81, 255, 174, 253, 68, 252, 109, 251, 226, 250, 159, 250, 171, 250, 249, 250, 150, 251, 221, 252, 236, 254, 101, 1, 52, 4, 230, 6, 131, 9, 7, 12, 203, 14, 163, 17, 135, 20, 172, 22,
-244, 23, 113, 24, 206, 23, 169, 22, 30, 21, 8, 19, 53, 16, 232, 12, 11, 9, 204, 4, 117, 0, 18, 252, 230, 247, 251, 243, 84, 240, 55, 237, 97, 234, 209, 231, 194, 229, 122, 228, 224, 227, 77, 228, 121, 229, 229, 230, 116, 232, 25, 234, 252, 235, 35, 238, 171, 240, 246, 242, 247, 244, 23, 246,
-183, 246, 11, 247, 62, 247, 87, 247, 75, 247, 249, 246, 63, 246, 92, 245, 88, 244, 90, 243, 113, 242, 162, 241, 49, 241, 252, 240, 250, 240, 48, 241, 164, 241, 99, 242, 193, 243, 4, 246, 194, 248, 248, 251, 35, 255, 53, 2, 41, 5, 65, 8, 100, 11, 131, 14, 248, 16, 141, 18, 104, 19, 72, 19,
-188, 18, 233, 17, 197, 16, 30, 15, 33, 13, 193, 10, 31, 8, 122, 5, 217, 2, 104, 0, 51, 254, 57, 252, 171, 250, 94, 249, 72, 248, 134, 247, 105, 247, 220, 247, 26, 249, 246, 250, 236, 252, 228, 254, 183, 0, 170, 2, 197, 4, 48, 7, 97, 9, 70, 11, 65, 12, 138, 12, 104, 12, 239, 11,
-36, 11, 5, 10, 112, 8, 46, 6, 160, 3, 206, 0, 214, 253, 239, 250, 31, 248, 179, 245, 166, 243, 235, 241, 167, 240, 214, 239, 122, 239, 218, 239, 84, 241, 95, 243, 245, 245, 169, 248, 80, 251, 233, 253, 194, 0, 204, 3, 241, 6, 213, 9, 23, 12, 220, 13, 252, 14, 215, 15, 135, 16, 11, 17,
-247, 16, 117, 16, 120, 15, 222, 13, 20, 12, 32, 10, 20, 8, 40, 6, 95, 4, 223, 2, 144, 1, 104, 0, 115, 255, 4, 255, 17, 255, 194, 255, 12, 1, 91, 2, 158, 3, 125, 4, 96, 5, 73, 6, 82, 7, 17, 8, 109, 8, 216, 7, 124, 6, 185, 4, 162, 2, 91, 0, 222, 253, 30, 251,
-223, 247, 127, 244, 5, 241, 172, 237, 144, 234, 184, 231, 115, 229, 199, 227, 141, 226, 224, 225, 182, 225, 255, 225, 231, 226, 228, 228, 103, 231, 108, 234, 143, 237, 157, 240, 157, 243, 199, 246, 57, 250, 204, 253, 58, 1, 252, 3, 51, 6, 163, 7, 141, 8, 41, 9, 114, 9, 255, 8, 13, 8, 155, 6,
-145, 4, 99, 2, 28, 0, 236, 253, 251, 251, 75, 250, 20, 249, 62, 248, 169, 247, 91, 247, 166, 247, 117, 248, 225, 249, 9, 252, 67, 254, 130, 0, 134, 2, 158, 4, 209, 6, 84, 9, 195, 11, 241, 13, 120, 15, 59, 16, 158, 16, 167, 16, 91, 16, 185, 15, 184, 14, 225, 12, 176, 10, 47, 8,
-111, 5, 172, 2, 246, 255, 126, 253, 92, 251, 119, 249, 220, 247, 128, 246, 109, 245, 186, 244, 249, 244, 187, 245, 249, 246, 111, 248, 213, 249, 54, 251, 193, 252, 147, 254, 130, 0, 88, 2, 122, 3, 13, 4, 225, 3, 37, 3, 48, 2, 9, 1, 100, 255, 110, 253, 44, 251, 166, 248, 44, 246, 200, 243,
-171, 241, 239, 239, 139, 238, 173, 237, 62, 237, 18, 237, 47, 237, 227, 237, 36, 239, 253, 240, 198, 243, 183, 246, 196, 249, 183, 252, 195, 255, 242, 2, 122, 6, 240, 9, 26, 13, 155, 15, 17, 17, 249, 17, 83, 18, 21, 18, 102, 17, 65, 16, 58, 14, 207, 11, 22, 9, 41, 6, 68, 3, 116, 0,
-223, 253, 174, 251, 187, 249, 13, 248, 156, 246, 110, 245, 141, 244, 155, 244, 40, 245, 42, 246, 107, 247, 155, 248, 197, 249, 6, 251, 151, 252, 75, 254, 4, 0, 37, 1, 204, 1, 216, 1, 111, 1, 234, 0, 81, 0, 105, 255, 58, 254, 200, 252, 0, 251, 39, 249, 75, 247, 134, 245, 253, 243, 175, 242,
-187, 241, 37, 241, 195, 240, 149, 240, 236, 240, 205, 241, 63, 243, 168, 245, 76, 248, 17, 251, 185, 253, 98, 0, 27, 3, 7, 6, 222, 8, 93, 11, 63, 13, 9, 14, 83, 14, 37, 14, 152, 13, 201, 12, 182, 11, 29, 10, 64, 8, 55, 6, 21, 4, 7, 2, 21, 0, 89, 254, 254, 252, 221, 251,
-250, 250, 98, 250, 14, 250, 4, 250, 252, 250, 143, 252, 165, 254, 34, 1, 136, 3, 229, 5, 63, 8, 204, 10, 95, 13, 224, 15, 149, 17, 155, 18, 215, 18, 28, 18, 4, 17, 146, 15, 122, 13, 219, 10, 202, 7, 42, 4, 83, 0, 100, 252, 115, 248, 189, 244, 68, 241, 34, 238, 130, 235, 36, 233,
-7, 231, 153, 229, 204, 228, 159, 228, 138, 229, 219, 230, 101, 232, 245, 233, 158, 235, 112, 237, 146, 239, 230, 241, 18, 244, 240, 245, 19, 247, 241, 247, 146, 248, 37, 249, 158, 249, 243, 249, 224, 249, 121, 249, 217, 248, 6, 248, 41, 247, 90, 246, 175, 245, 100, 245, 90, 245, 150, 245, 43, 246, 4, 247,
-39, 248, 31, 250, 168, 252, 152, 255, 208, 2, 205, 5, 159, 8, 56, 11, 210, 13, 90, 16, 196, 18, 90, 20, 64, 21, 112, 21, 182, 20, 188, 19, 130, 18, 224, 16, 212, 14, 112, 12, 150, 9, 134, 6, 103, 3, 74, 0, 102, 253, 193, 250, 106, 248, 151, 246, 5, 245, 181, 243, 240, 242, 198, 242,
-47, 243, 152, 244, 112, 246, 122, 248, 133, 250, 144, 252, 186, 254, 34, 1, 188, 3, 43, 6, 90, 8, 143, 9, 77, 10, 157, 10, 114, 10, 237, 9, 13, 9, 127, 7, 103, 5, 255, 2, 73, 0, 135, 253, 218, 250, 84, 248, 79, 246, 156, 244, 61, 243, 91, 242, 200, 241, 140, 241, 27, 242, 94, 243,
-26, 245, 75, 247, 121, 249, 162, 251, 196, 253, 54, 0, 214, 2, 166, 5, 40, 8, 59, 10, 218, 11, 194, 12, 107, 13, 214, 13, 215, 13, 78, 13, 87, 12, 193, 10, 192, 8, 143, 6, 56, 4, 239, 1, 212, 255, 237, 253, 123, 252, 55, 251, 33, 250, 90, 249, 2, 249, 15, 249, 201, 249, 211, 250,
-236, 251, 223, 252, 154, 253, 81, 254, 21, 255, 246, 255, 152, 0, 232, 0, 57, 0, 11, 255, 118, 253, 143, 251, 125, 249, 60, 247, 165, 244, 189, 241, 184, 238, 168, 235, 206, 232, 54, 230, 239, 227, 86, 226, 45, 225, 113, 224, 61, 224, 100, 224, 232, 224, 41, 226, 60, 228, 214, 230, 0, 234, 71, 237,
-146, 240, 218, 243, 100, 247, 23, 251, 241, 254, 109, 2, 85, 5, 174, 7, 19, 9, 9, 10, 165, 10, 196, 10, 76, 10, 103, 9, 247, 7, 40, 6, 63, 4, 74, 2, 127, 0, 237, 254, 149, 253, 179, 252, 2, 252, 127, 251, 59, 251, 100, 251, 244, 251, 49, 253, 239, 254, 210, 0, 185, 2, 142, 4,
-123, 6, 137, 8, 235, 10, 39, 13, 45, 15, 92, 16, 235, 16, 1, 17, 160, 16, 236, 15, 235, 14, 115, 13, 102, 11, 14, 9, 108, 6, 168, 3, 238, 0, 71, 254, 2, 252, 9, 250, 86, 248, 4, 247, 248, 245, 56, 245, 10, 245, 171, 245, 202, 246, 119, 248, 74, 250, 24, 252, 215, 253, 187, 255,
-189, 1, 216, 3, 160, 5, 203, 6, 104, 7, 36, 7, 126, 6, 154, 5, 121, 4, 255, 2, 66, 1, 51, 255, 236, 252, 160, 250, 87, 248, 72, 246, 115, 244, 219, 242, 191, 241, 234, 240, 80, 240, 15, 240, 90, 240, 42, 241, 201, 242, 52, 245, 230, 247, 202, 250, 160, 253, 133, 0, 125, 3, 170, 6,
-160, 9, 79, 12, 24, 14, 18, 15, 127, 15, 88, 15, 194, 14, 213, 13, 114, 12, 104, 10, 14, 8, 106, 5, 151, 2, 203, 255, 11, 253, 144, 250, 87, 248, 84, 246, 156, 244, 23, 243, 203, 241, 232, 240, 198, 240, 29, 241, 249, 241, 10, 243, 26, 244, 32, 245, 82, 246, 185, 247, 73, 249, 211, 250,
-236, 251, 162, 252, 187, 252, 138, 252, 55, 252, 207, 251, 36, 251, 60, 250, 12, 249, 132, 247, 233, 245, 66, 244, 181, 242, 97, 241, 71, 240, 168, 239, 106, 239, 116, 239, 221, 239, 210, 240, 68, 242, 96, 244, 58, 247, 63, 250, 94, 253, 58, 0, 8, 3, 203, 5, 169, 8, 91, 11, 201, 13, 114, 15,
-79, 16, 172, 16, 140, 16, 30, 16, 109, 15, 106, 14, 201, 12, 220, 10, 168, 8, 54, 6, 197, 3, 93, 1, 46, 255, 78, 253, 174, 251, 106, 250, 121, 249, 216, 248, 173, 248, 107, 249, 185, 250, 159, 252, 226, 254, 25, 1, 65, 3, 99, 5, 163, 7, 239, 9, 21, 12, 158, 13, 153, 14, 181, 14,
-39, 14, 65, 13, 4, 12, 50, 10, 248, 7, 82, 5, 13, 2, 165, 254, 34, 251, 169, 247, 103, 244, 94, 241, 197, 238, 147, 236, 165, 234, 4, 233, 230, 231, 66, 231, 56, 231, 28, 232, 68, 233, 164, 234, 6, 236, 124, 237, 14, 239, 9, 241, 41, 243, 65, 245, 5, 247, 61, 248, 39, 249, 195, 249,
-56, 250, 132, 250, 160, 250, 50, 250, 128, 249, 142, 248, 101, 247, 68, 246, 52, 245, 99, 244, 249, 243, 222, 243, 46, 244, 211, 244, 184, 245, 236, 246, 204, 248, 16, 251, 182, 253, 126, 0, 17, 3, 114, 5, 147, 7, 182, 9, 210, 11, 207, 13, 47, 15, 1, 16, 5, 16, 87, 15, 92, 14, 26, 13,
-94, 11, 70, 9, 208, 6, 215, 3, 185, 0, 134, 253, 100, 250, 124, 247, 212, 244, 162, 242, 237, 240, 137, 239, 128, 238, 11, 238, 25, 238, 188, 238, 119, 240, 143, 242, 244, 244, 107, 247, 240, 249, 142, 252, 113, 255, 110, 2, 78, 5, 201, 7, 117, 9, 162, 10, 70, 11, 103, 11, 48, 11, 161, 10,
-73, 9, 143, 7, 129, 5, 38, 3, 204, 0, 128, 254, 101, 252, 172, 250, 57, 249, 26, 248, 73, 247, 176, 246, 85, 246, 183, 246, 155, 247, 252, 248, 221, 250, 202, 252, 195, 254, 211, 0, 49, 3, 195, 5, 137, 8, 252, 10, 8, 13, 121, 14, 50, 15, 153, 15, 178, 15, 74, 15, 124, 14, 74, 13,
-128, 11, 120, 9, 73, 7, 7, 5, 230, 2, 238, 0, 63, 255, 244, 253, 218, 252, 237, 251, 74, 251, 248, 250, 254, 250, 192, 251, 186, 252, 216, 253, 203, 254, 159, 255, 105, 0, 71, 1, 56, 2, 3, 3, 112, 3, 0, 3, 26, 2, 189, 0, 10, 255, 51, 253, 54, 251, 218, 248, 70, 246, 137, 243,
-183, 240, 254, 237, 105, 235, 32, 233, 84, 231, 227, 229, 227, 228, 99, 228, 46, 228, 68, 228, 77, 229, 244, 230, 48, 233, 38, 236, 54, 239, 85, 242, 120, 245, 192, 248, 29, 252, 148, 255, 157, 2, 40, 5, 14, 7, 3, 8, 157, 8, 228, 8, 175, 8, 28, 8, 48, 7, 191, 5, 18, 4, 67, 2,
-96, 0, 147, 254, 235, 252, 124, 251, 102, 250, 123, 249, 187, 248, 68, 248, 37, 248, 100, 248, 126, 249, 1, 251, 201, 252, 168, 254, 128, 0, 101, 2, 117, 4, 182, 6, 223, 8, 208, 10, 233, 11, 127, 12, 148, 12, 24, 12, 93, 11, 97, 10, 222, 8, 246, 6, 198, 4, 72, 2, 181, 255, 38, 253,
-171, 250, 139, 248, 178, 246, 44, 245, 30, 244, 83, 243, 208, 242, 4, 243, 207, 243, 26, 245, 249, 246, 233, 248, 213, 250, 158, 252, 124, 254, 104, 0, 101, 2, 25, 4, 89, 5, 17, 6, 240, 5, 140, 5, 233, 4, 6, 4, 218, 2, 108, 1, 149, 255, 122, 253, 63, 251, 242, 248, 189, 246, 178, 244,
-229, 242, 156, 241, 159, 240, 237, 239, 191, 239, 14, 240, 221, 240, 169, 242, 13, 245, 201, 247, 182, 250, 145, 253, 109, 0, 83, 3, 86, 6, 55, 9, 224, 11, 159, 13, 205, 14, 111, 15, 115, 15, 41, 15, 147, 14, 119, 13, 217, 11, 226, 9, 134, 7, 242, 4, 78, 2, 166, 255, 54, 253, 248, 250,
-242, 248, 64, 247, 184, 245, 96, 244, 136, 243, 66, 243, 115, 243, 63, 244, 50, 245, 48, 246, 36, 247, 58, 248, 122, 249, 242, 250, 100, 252, 139, 253, 93, 254, 124, 254, 92, 254, 6, 254, 123, 253, 176, 252, 169, 251, 62, 250, 142, 248, 195, 246, 231, 244, 46, 243, 172, 241, 108, 240, 207, 239, 142, 239,
-165, 239, 55, 240, 55, 241, 159, 242, 190, 244, 96, 247, 60, 250, 41, 253, 228, 255, 139, 2, 36, 5, 227, 7, 144, 10, 35, 13, 247, 14, 65, 16, 11, 17, 55, 17, 17, 17, 160, 16, 176, 15, 47, 14, 80, 12, 3, 10, 116, 7, 216, 4, 57, 2, 225, 255, 204, 253, 1, 252, 188, 250, 188, 249,
-5, 249, 228, 248, 109, 249, 119, 250, 44, 252, 34, 254, 33, 0, 17, 2, 252, 3, 249, 5, 15, 8, 2, 10, 139, 11, 163, 12, 205, 12, 122, 12, 197, 11, 168, 10, 23, 9, 42, 7, 188, 4, 219, 1, 202, 254, 147, 251, 104, 248, 101, 245, 141, 242, 49, 240, 20, 238, 52, 236, 167, 234, 117, 233,
-160, 232, 127, 232, 17, 233, 255, 233, 64, 235, 151, 236, 11, 238, 164, 239, 179, 241, 230, 243, 48, 246, 31, 248, 159, 249, 194, 250, 111, 251, 235, 251, 59, 252, 67, 252, 235, 251, 86, 251, 127, 250, 141, 249, 165, 248, 206, 247, 85, 247, 39, 247, 68, 247, 216, 247, 163, 248, 159, 249, 232, 250, 163, 252,
-180, 254, 54, 1, 213, 3, 92, 6, 183, 8, 221, 10, 6, 13, 52, 15, 59, 17, 208, 18, 237, 19, 11, 20, 134, 19, 147, 18, 48, 17, 92, 15, 49, 13, 149, 10, 125, 7, 60, 4, 220, 0, 131, 253, 88, 250, 99, 247, 246, 244, 239, 242, 61, 241, 0, 240, 64, 239, 244, 238, 102, 239, 191, 240,
-141, 242, 201, 244, 46, 247, 161, 249, 34, 252, 232, 254, 185, 1, 133, 4, 217, 6, 140, 8, 192, 9, 77, 10, 114, 10, 77, 10, 202, 9, 185, 8, 85, 7, 153, 5, 140, 3, 116, 1, 87, 255, 93, 253, 156, 251, 17, 250, 219, 248, 221, 247, 15, 247, 144, 246, 170, 246, 63, 247, 118, 248, 60, 250,
-39, 252, 43, 254, 79, 0, 164, 2, 38, 5, 222, 7, 78, 10, 108, 12, 201, 13, 129, 14, 212, 14, 192, 14, 64, 14, 110, 13, 58, 12, 127, 10, 143, 8, 109, 6, 48, 4, 4, 2, 236, 255, 30, 254, 142, 252, 46, 251, 10, 250, 29, 249, 113, 248, 42, 248, 130, 248, 32, 249, 254, 249, 198, 250,
-121, 251, 28, 252, 216, 252, 163, 253, 104, 254, 212, 254, 169, 254, 15, 254, 233, 252, 127, 251, 239, 249, 58, 248, 45, 246, 235, 243, 114, 241, 207, 238, 56, 236, 179, 233, 116, 231, 149, 229, 11, 228, 11, 227, 130, 226, 84, 226, 161, 226, 184, 227, 104, 229, 206, 231, 239, 234, 56, 238, 157, 241, 243, 244,
-90, 248, 207, 251, 85, 255, 143, 2, 112, 5, 156, 7, 21, 9, 45, 10, 233, 10, 70, 11, 87, 11, 18, 11, 46, 10, 6, 9, 159, 7, 254, 5, 85, 4, 175, 2, 54, 1, 246, 255, 225, 254, 1, 254, 99, 253, 16, 253, 36, 253, 6, 254, 76, 255, 243, 0, 190, 2, 126, 4, 56, 6, 14, 8,
-255, 9, 237, 11, 162, 13, 181, 14, 78, 15, 73, 15, 197, 14, 1, 14, 252, 12, 121, 11, 166, 9, 133, 7, 5, 5, 113, 2, 212, 255, 83, 253, 23, 251, 30, 249, 148, 247, 120, 246, 164, 245, 33, 245, 57, 245, 196, 245, 206, 246, 124, 248, 61, 250, 9, 252, 180, 253, 107, 255, 50, 1, 33, 3,
-242, 4, 135, 6, 156, 7, 12, 8, 40, 8, 242, 7, 110, 7, 162, 6, 138, 5, 225, 3, 244, 1, 205, 255, 132, 253, 72, 251, 41, 249, 88, 247, 247, 245, 233, 244, 66, 244, 21, 244, 73, 244, 240, 244, 131, 246, 135, 248, 242, 250, 144, 253, 23, 0, 143, 2, 5, 5, 138, 7, 9, 10, 96, 12,
-27, 14, 90, 15, 251, 15, 0, 16, 184, 15, 40, 15, 243, 13, 85, 12, 82, 10, 198, 7, 5, 5, 36, 2, 54, 255, 109, 252, 207, 249, 123, 247, 118, 245, 162, 243, 5, 242, 227, 240, 49, 240, 244, 239, 128, 240, 65, 241, 44, 242, 35, 243, 62, 244, 130, 245, 21, 247, 183, 248, 54, 250, 98, 251,
-235, 251, 36, 252, 17, 252, 183, 251, 39, 251, 96, 250, 50, 249, 207, 247, 72, 246, 186, 244, 76, 243, 9, 242, 28, 241, 174, 240, 149, 240, 225, 240, 148, 241, 146, 242, 221, 243, 226, 245, 72, 248, 2, 251, 239, 253, 197, 0, 142, 3, 84, 6, 62, 9, 52, 12, 39, 15, 141, 17, 117, 19, 198, 20,
-76, 21, 117, 21, 65, 21, 99, 20, 12, 19, 74, 17, 245, 14, 100, 12, 179, 9, 250, 6, 112, 4, 28, 2, 29, 0, 142, 254, 61, 253, 45, 252, 161, 251, 136, 251, 230, 251, 14, 253, 119, 254, 6, 0, 148, 1, 31, 3, 183, 4, 115, 6, 45, 8, 177, 9, 220, 10, 46, 11, 19, 11, 143, 10,
-140, 9, 62, 8, 164, 6, 125, 4, 0, 2, 72, 255, 92, 252, 109, 249, 142, 246, 214, 243, 117, 241, 78, 239, 103, 237, 210, 235, 129, 234, 120, 233, 49, 233, 129, 233, 75, 234, 155, 235, 17, 237, 164, 238, 95, 240, 111, 242, 169, 244, 9, 247, 35, 249, 231, 250, 70, 252, 18, 253, 179, 253, 42, 254,
-95, 254, 84, 254, 20, 254, 136, 253, 223, 252, 43, 252, 118, 251, 237, 250, 144, 250, 105, 250, 158, 250, 247, 250, 113, 251, 49, 252, 61, 253, 150, 254, 126, 0, 155, 2, 201, 4, 225, 6, 212, 8, 192, 10, 180, 12, 149, 14, 47, 16, 102, 17, 137, 17, 30, 17, 44, 16, 159, 14, 187, 12, 137, 10,
-212, 7, 195, 4, 127, 1, 12, 254, 167, 250, 97, 247, 77, 244, 186, 241, 131, 239, 171, 237, 112, 236, 155, 235, 51, 235, 172, 235, 227, 236, 168, 238, 7, 241, 147, 243, 49, 246, 209, 248, 158, 251, 125, 254, 108, 1, 12, 4, 66, 6, 9, 8, 28, 9, 235, 9, 122, 10, 178, 10, 134, 10, 9, 10,
-21, 9, 199, 7, 74, 6, 161, 4, 243, 2, 87, 1, 215, 255, 170, 254, 168, 253, 207, 252, 85, 252, 76, 252, 178, 252, 229, 253, 158, 255, 155, 1, 192, 3, 238, 5, 46, 8, 134, 10, 1, 13, 84, 15, 115, 17, 193, 18, 143, 19, 231, 19, 188, 19, 68, 19, 135, 18, 93, 17, 193, 15, 225, 13,
-184, 11, 89, 9, 242, 6, 139, 4, 90, 2, 91, 0, 142, 254, 10, 253, 177, 251, 136, 250, 202, 249, 138, 249, 162, 249, 32, 250, 173, 250, 52, 251, 168, 251, 51, 252, 217, 252, 156, 253, 57, 254, 130, 254, 116, 254, 205, 253, 232, 252, 209, 251, 133, 250, 242, 248, 37, 247, 4, 245, 172, 242, 70, 240,
-217, 237, 170, 235, 187, 233, 20, 232, 31, 231, 146, 230, 102, 230, 211, 230, 210, 231, 84, 233, 161, 235, 137, 238, 179, 241, 7, 245, 66, 248, 123, 251, 181, 254, 4, 2, 54, 5, 64, 8, 152, 10, 107, 12, 208, 13, 173, 14, 46, 15, 96, 15, 24, 15, 55, 14, 247, 12, 81, 11, 80, 9, 53, 7,
-8, 5, 245, 2, 16, 1, 89, 255, 239, 253, 189, 252, 196, 251, 60, 251, 78, 251, 202, 251, 198, 252, 249, 253, 51, 255, 104, 0, 177, 1, 25, 3, 160, 4, 25, 6, 61, 7, 13, 8, 51, 8, 252, 7, 133, 7, 199, 6, 180, 5, 95, 4, 177, 2, 169, 0, 129, 254, 66, 252, 20, 250, 19, 248,
-70, 246, 243, 244, 240, 243, 50, 243, 208, 242, 210, 242, 48, 243, 28, 244, 162, 245, 101, 247, 88, 249, 68, 251, 56, 253, 57, 255, 124, 1, 191, 3, 244, 5, 182, 7, 237, 8, 184, 9, 252, 9, 223, 9, 120, 9, 179, 8, 99, 7, 203, 5, 233, 3, 212, 1, 197, 255, 195, 253, 18, 252, 180, 250,
-162, 249, 5, 249, 184, 248, 176, 248, 15, 249, 3, 250, 95, 251, 52, 253, 72, 255, 90, 1, 92, 3, 80, 5, 89, 7, 117, 9, 143, 11, 80, 13, 182, 14, 102, 15, 132, 15, 68, 15, 158, 14, 123, 13, 252, 11, 18, 10, 152, 7, 234, 4, 13, 2, 19, 255, 46, 252, 102, 249, 238, 246, 193, 244,
-205, 242, 33, 241, 217, 239, 239, 238, 144, 238, 0, 239, 204, 239, 240, 240, 73, 242, 186, 243, 69, 245, 39, 247, 34, 249, 31, 251, 211, 252, 7, 254, 221, 254, 59, 255, 78, 255, 50, 255, 223, 254, 47, 254, 79, 253, 64, 252, 13, 251, 228, 249, 203, 248, 238, 247, 91, 247, 8, 247, 22, 247, 102, 247,
-235, 247, 182, 248, 254, 249, 166, 251, 193, 253, 61, 0, 198, 2, 85, 5, 221, 7, 127, 10, 53, 13, 238, 15, 81, 18, 80, 20, 139, 21, 1, 22, 4, 22, 139, 21, 127, 20, 20, 19, 67, 17, 215, 14, 53, 12, 102, 9, 130, 6, 183, 3, 13, 1, 185, 254, 190, 252, 4, 251, 158, 249, 161, 248,
-0, 248, 214, 247, 129, 248, 135, 249, 222, 250, 90, 252, 212, 253, 81, 255, 241, 0, 169, 2, 93, 4, 210, 5, 192, 6, 71, 7, 70, 7, 220, 6, 53, 6, 77, 5, 234, 3, 61, 2, 74, 0, 253, 253, 151, 251, 33, 249, 173, 246, 103, 244, 76, 242, 121, 240, 241, 238, 164, 237, 164, 236, 71, 236,
-106, 236, 24, 237, 130, 238, 27, 240, 220, 241, 177, 243, 176, 245, 209, 247, 37, 250, 90, 252, 90, 254, 239, 255, 253, 0, 206, 1, 101, 2, 195, 2, 243, 2, 245, 2, 143, 2, 252, 1, 68, 1, 105, 0, 144, 255, 196, 254, 35, 254, 194, 253, 139, 253, 132, 253, 179, 253, 25, 254, 193, 254, 8, 0,
-151, 1, 105, 3, 68, 5, 5, 7, 178, 8, 77, 10, 233, 11, 109, 13, 168, 14, 48, 15, 55, 15, 157, 14, 104, 13, 234, 11, 41, 10, 232, 7, 98, 5, 156, 2, 147, 255, 132, 252, 126, 249, 164, 246, 34, 244, 240, 241, 50, 240, 6, 239, 56, 238, 210, 237, 52, 238, 32, 239, 151, 240, 220, 242,
-79, 245, 228, 247, 119, 250, 19, 253, 191, 255, 144, 2, 77, 5, 216, 7, 5, 10, 142, 11, 194, 12, 162, 13, 16, 14, 42, 14, 237, 13, 9, 13, 193, 11, 41, 10, 61, 8, 49, 6, 31, 4, 34, 2, 108, 0, 236, 254, 173, 253, 203, 252, 57, 252, 252, 251, 145, 252, 150, 253, 253, 254, 178, 0,
-101, 2, 26, 4, 218, 5, 182, 7, 153, 9, 113, 11, 210, 12, 211, 13, 98, 14, 96, 14, 35, 14, 176, 13, 207, 12, 149, 11, 15, 10, 28, 8, 240, 5, 165, 3, 70, 1, 0, 255, 223, 252, 249, 250, 97, 249, 241, 247, 169, 246, 193, 245, 49, 245, 250, 244, 94, 245, 245, 245, 169, 246, 94, 247,
-25, 248, 231, 248, 227, 249, 237, 250, 215, 251, 135, 252, 152, 252, 89, 252, 204, 251, 228, 250, 197, 249, 109, 248, 176, 246, 187, 244, 164, 242, 125, 240, 119, 238, 157, 236, 10, 235, 4, 234, 93, 233, 29, 233, 114, 233, 33, 234, 44, 235, 251, 236, 69, 239, 241, 241, 242, 244, 240, 247, 234, 250, 219, 253,
-231, 0, 254, 3, 27, 7, 215, 9, 47, 12, 22, 14, 54, 15, 1, 16, 116, 16, 78, 16, 174, 15, 167, 14, 11, 13, 23, 11, 243, 8, 165, 6, 99, 4, 63, 2, 72, 0, 179, 254, 82, 253, 36, 252, 99, 251, 7, 251, 15, 251, 201, 251, 215, 252, 20, 254, 103, 255, 190, 0, 41, 2, 186, 3,
-100, 5, 246, 6, 96, 8, 39, 9, 151, 9, 179, 9, 106, 9, 231, 8, 42, 8, 5, 7, 143, 5, 231, 3, 10, 2, 34, 0, 70, 254, 129, 252, 21, 251, 224, 249, 227, 248, 63, 248, 201, 247, 137, 247, 204, 247, 140, 248, 169, 249, 50, 251, 217, 252, 139, 254, 66, 0, 36, 2, 28, 4, 43, 6,
-254, 7, 114, 9, 128, 10, 204, 10, 188, 10, 92, 10, 146, 9, 106, 8, 255, 6, 63, 5, 80, 3, 84, 1, 91, 255, 147, 253, 253, 251, 159, 250, 192, 249, 27, 249, 173, 248, 160, 248, 239, 248, 150, 249, 217, 250, 124, 252, 75, 254, 44, 0, 1, 2, 219, 3, 200, 5, 214, 7, 200, 9, 147, 11,
-165, 12, 55, 13, 82, 13, 216, 12, 251, 11, 204, 10, 36, 9, 7, 7, 163, 4, 247, 1, 31, 255, 66, 252, 106, 249, 211, 246, 115, 244, 75, 242, 136, 240, 11, 239, 216, 237, 67, 237, 86, 237, 228, 237, 16, 239, 131, 240, 19, 242, 183, 243, 131, 245, 110, 247, 120, 249, 101, 251, 11, 253, 100, 254,
-38, 255, 164, 255, 239, 255, 0, 0, 212, 255, 117, 255, 208, 254, 239, 253, 247, 252, 237, 251, 244, 250, 29, 250, 108, 249, 22, 249, 245, 248, 5, 249, 91, 249, 8, 250, 10, 251, 159, 252, 183, 254, 11, 1, 140, 3, 6, 6, 128, 8, 250, 10, 130, 13, 230, 15, 28, 18, 158, 19, 135, 20, 238, 20,
-173, 20, 3, 20, 7, 19, 157, 17, 192, 15, 161, 13, 57, 11, 166, 8, 15, 6, 121, 3, 35, 1, 7, 255, 39, 253, 175, 251, 126, 250, 143, 249, 23, 249, 52, 249, 186, 249, 192, 250, 13, 252, 102, 253, 190, 254, 36, 0, 161, 1, 56, 3, 202, 4, 23, 6, 25, 7, 124, 7, 117, 7, 33, 7,
-115, 6, 95, 5, 255, 3, 63, 2, 12, 0, 169, 253, 26, 251, 112, 248, 219, 245, 94, 243, 56, 241, 94, 239, 199, 237, 147, 236, 215, 235, 132, 235, 209, 235, 217, 236, 55, 238, 222, 239, 168, 241, 126, 243, 94, 245, 124, 247, 164, 249, 205, 251, 177, 253, 59, 255, 127, 0, 107, 1, 39, 2, 185, 2,
-12, 3, 253, 2, 171, 2, 18, 2, 44, 1, 48, 0, 35, 255, 40, 254, 83, 253, 163, 252, 55, 252, 246, 251, 221, 251, 5, 252, 161, 252, 145, 253, 232, 254, 130, 0, 25, 2, 160, 3, 5, 5, 102, 6, 195, 7, 9, 9, 250, 9, 146, 10, 124, 10, 218, 9, 224, 8, 141, 7, 221, 5, 239, 3,
-189, 1, 56, 255, 157, 252, 244, 249, 98, 247, 254, 244, 207, 242, 32, 241, 227, 239, 3, 239, 163, 238, 195, 238, 73, 239, 90, 240, 34, 242, 57, 244, 153, 246, 18, 249, 141, 251, 14, 254, 187, 0, 125, 3, 65, 6, 206, 8, 228, 10, 157, 12, 210, 13, 143, 14, 252, 14, 11, 15, 115, 14, 127, 13,
-50, 12, 99, 10, 121, 8, 120, 6, 128, 4, 191, 2, 47, 1, 248, 255, 18, 255, 104, 254, 15, 254, 62, 254, 211, 254, 223, 255, 98, 1, 252, 2, 165, 4, 71, 6, 253, 7, 198, 9, 168, 11, 98, 13, 231, 14, 245, 15, 130, 16, 191, 16, 165, 16, 32, 16, 77, 15, 36, 14, 107, 12, 116, 10,
-69, 8, 233, 5, 139, 3, 54, 1, 22, 255, 47, 253, 113, 251, 233, 249, 158, 248, 145, 247, 215, 246, 194, 246, 253, 246, 131, 247, 57, 248, 239, 248, 169, 249, 136, 250, 130, 251, 130, 252, 103, 253, 218, 253, 247, 253, 160, 253, 221, 252, 231, 251, 190, 250, 57, 249, 138, 247, 180, 245, 187, 243, 209, 241,
-252, 239, 101, 238, 38, 237, 52, 236, 185, 235, 174, 235, 238, 235, 132, 236, 168, 237, 51, 239, 45, 241, 191, 243, 113, 246, 60, 249, 12, 252, 234, 254, 218, 1, 231, 4, 205, 7, 117, 10, 160, 12, 19, 14, 21, 15, 158, 15, 147, 15, 36, 15, 81, 14, 214, 12, 12, 11, 0, 9, 180, 6, 95, 4,
-19, 2, 238, 255, 20, 254, 109, 252, 7, 251, 247, 249, 45, 249, 177, 248, 240, 248, 141, 249, 127, 250, 183, 251, 244, 252, 57, 254, 151, 255, 26, 1, 167, 2, 42, 4, 83, 5, 46, 6, 163, 6, 173, 6, 131, 6, 38, 6, 97, 5, 92, 4, 23, 3, 128, 1, 204, 255, 8, 254, 66, 252, 160, 250,
-34, 249, 221, 247, 221, 246, 9, 246, 102, 245, 60, 245, 118, 245, 26, 246, 114, 247, 254, 248, 176, 250, 109, 252, 56, 254, 17, 0, 5, 2, 235, 3, 161, 5, 251, 6, 182, 7, 24, 8, 32, 8, 202, 7, 60, 7, 118, 6, 86, 5, 6, 4, 148, 2, 8, 1, 133, 255, 21, 254, 208, 252, 223, 251,
-37, 251, 170, 250, 132, 250, 154, 250, 238, 250, 234, 251, 65, 253, 232, 254, 219, 0, 205, 2, 190, 4, 176, 6, 174, 8, 166, 10, 130, 12, 215, 13, 186, 14, 19, 15, 173, 14, 239, 13, 221, 12, 66, 11, 77, 9, 7, 7, 86, 4, 115, 1, 116, 254, 106, 251, 135, 248, 208, 245, 94, 243, 88, 241,
-149, 239, 24, 238, 55, 237, 205, 236, 220, 236, 185, 237, 235, 238, 88, 240, 228, 241, 134, 243, 66, 245, 41, 247, 41, 249, 23, 251, 225, 252, 53, 254, 75, 255, 39, 0, 184, 0, 28, 1, 82, 1, 37, 1, 185, 0, 29, 0, 76, 255, 105, 254, 136, 253, 184, 252, 38, 252, 197, 251, 155, 251, 194, 251,
-40, 252, 208, 252, 16, 254, 189, 255, 190, 1, 12, 4, 86, 6, 151, 8, 191, 10, 224, 12, 245, 14, 244, 16, 120, 18, 144, 19, 49, 20, 16, 20, 159, 19, 224, 18, 180, 17, 46, 16, 97, 14, 55, 12, 207, 9, 77, 7, 188, 4, 66, 2, 241, 255, 216, 253, 38, 252, 175, 250, 115, 249, 165, 248,
-57, 248, 43, 248, 186, 248, 160, 249, 180, 250, 220, 251, 18, 253, 89, 254, 189, 255, 64, 1, 170, 2, 239, 3, 152, 4, 225, 4, 206, 4, 64, 4, 98, 3, 61, 2, 164, 0, 170, 254, 115, 252, 253, 249, 109, 247, 231, 244, 124, 242, 112, 240, 178, 238, 68, 237, 92, 236, 201, 235, 142, 235, 250, 235,
-245, 236, 90, 238, 57, 240, 65, 242, 93, 244, 134, 246, 224, 248, 89, 251, 247, 253, 125, 0, 203, 2, 219, 4, 103, 6, 175, 7, 185, 8, 94, 9, 162, 9, 151, 9, 25, 9, 62, 8, 49, 7, 244, 5, 161, 4, 91, 3, 40, 2, 53, 1, 100, 0, 181, 255, 67, 255, 25, 255, 51, 255, 198, 255,
-166, 0, 164, 1, 166, 2, 144, 3, 117, 4, 87, 5, 68, 6, 20, 7, 191, 7, 207, 7, 125, 7, 209, 6, 182, 5, 95, 4, 216, 2, 10, 1, 1, 255, 217, 252, 148, 250, 89, 248, 55, 246, 55, 244, 170, 242, 109, 241, 132, 240, 36, 240, 18, 240, 76, 240, 16, 241, 92, 242, 10, 244, 48, 246,
-141, 248, 255, 250, 126, 253, 35, 0, 222, 2, 175, 5, 98, 8, 197, 10, 212, 12, 51, 14, 36, 15, 185, 15, 210, 15, 109, 15, 175, 14, 128, 13, 234, 11, 41, 10, 69, 8, 93, 6, 144, 4, 229, 2, 152, 1, 127, 0, 150, 255, 0, 255, 188, 254, 198, 254, 86, 255, 84, 0, 134, 1, 226, 2,
-64, 4, 171, 5, 36, 7, 203, 8, 106, 10, 247, 11, 21, 13, 198, 13, 25, 14, 234, 13, 91, 13, 129, 12, 63, 11, 137, 9, 142, 7, 76, 5, 204, 2, 62, 0, 167, 253, 51, 251, 236, 248, 212, 246, 7, 245, 118, 243, 31, 242, 50, 241, 209, 240, 213, 240, 89, 241, 42, 242, 20, 243, 15, 244,
-41, 245, 94, 246, 175, 247, 252, 248, 11, 250, 219, 250, 39, 251, 32, 251, 226, 250, 110, 250, 194, 249, 239, 248, 239, 247, 195, 246, 141, 245, 81, 244, 53, 243, 67, 242, 126, 241, 35, 241, 17, 241, 58, 241, 181, 241, 143, 242, 189, 243, 105, 245, 167, 247, 36, 250, 215, 252, 151, 255, 88, 2, 27, 5,
-236, 7, 169, 10, 68, 13, 90, 15, 222, 16, 236, 17, 82, 18, 56, 18, 195, 17, 221, 16, 107, 15, 172, 13, 158, 11, 62, 9, 205, 6, 82, 4, 241, 1, 195, 255, 198, 253, 27, 252, 182, 250, 142, 249, 196, 248, 135, 248, 175, 248, 81, 249, 81, 250, 107, 251, 151, 252, 224, 253, 72, 255, 207, 0,
-113, 2, 235, 3, 56, 5, 25, 6, 160, 6, 235, 6, 241, 6, 164, 6, 26, 6, 70, 5, 16, 4, 173, 2, 32, 1, 116, 255, 208, 253, 60, 252, 228, 250, 204, 249, 230, 248, 74, 248, 11, 248, 31, 248, 166, 248, 203, 249, 49, 251, 211, 252, 134, 254, 56, 0, 232, 1, 181, 3, 128, 5, 58, 7,
-172, 8, 167, 9, 75, 10, 128, 10, 93, 10, 1, 10, 101, 9, 106, 8, 54, 7, 202, 5, 31, 4, 105, 2, 174, 0, 12, 255, 157, 253, 93, 252, 105, 251, 186, 250, 67, 250, 25, 250, 113, 250, 40, 251, 74, 252, 208, 253, 102, 255, 7, 1, 159, 2, 63, 4, 227, 5, 129, 7, 214, 8, 221, 9,
-76, 10, 36, 10, 160, 9, 182, 8, 89, 7, 177, 5, 187, 3, 80, 1, 187, 254, 1, 252, 49, 249, 119, 246, 219, 243, 144, 241, 170, 239, 17, 238, 223, 236, 44, 236, 219, 235, 2, 236, 233, 236, 39, 238, 180, 239, 124, 241, 88, 243, 75, 245, 123, 247, 213, 249, 65, 252, 158, 254, 174, 0, 125, 2,
-244, 3, 19, 5, 251, 5, 167, 6, 220, 6, 203, 6, 119, 6, 195, 5, 236, 4, 254, 3, 12, 3, 62, 2, 149, 1, 44, 1, 6, 1, 14, 1, 77, 1, 251, 1, 245, 2, 63, 4, 232, 5, 145, 7, 53, 9, 187, 10, 57, 12, 177, 13, 38, 15, 99, 16, 97, 17, 240, 17, 238, 17, 158, 17,
-253, 16, 242, 15, 166, 14, 24, 13, 26, 11, 240, 8, 161, 6, 59, 4, 229, 1, 167, 255, 166, 253, 246, 251, 128, 250, 80, 249, 124, 248, 241, 247, 185, 247, 51, 248, 253, 248, 17, 250, 96, 251, 181, 252, 20, 254, 141, 255, 27, 1, 165, 2, 14, 4, 254, 4, 144, 5, 171, 5, 53, 5, 116, 4,
-106, 3, 216, 1, 5, 0, 241, 253, 151, 251, 46, 249, 195, 246, 116, 244, 107, 242, 160, 240, 50, 239, 53, 238, 128, 237, 29, 237, 82, 237, 242, 237, 254, 238, 169, 240, 136, 242, 145, 244, 185, 246, 13, 249, 131, 251, 41, 254, 206, 0, 75, 3, 121, 5, 32, 7, 114, 8, 108, 9, 229, 9, 11, 10,
-220, 9, 31, 9, 14, 8, 189, 6, 37, 5, 115, 3, 190, 1, 25, 0, 166, 254, 90, 253, 58, 252, 84, 251, 164, 250, 46, 250, 68, 250, 165, 250, 69, 251, 15, 252, 218, 252, 169, 253, 129, 254, 119, 255, 113, 0, 91, 1, 243, 1, 66, 2, 61, 2, 215, 1, 71, 1, 142, 0, 146, 255, 106, 254,
-29, 253, 168, 251, 47, 250, 187, 248, 95, 247, 63, 246, 86, 245, 181, 244, 116, 244, 108, 244, 159, 244, 85, 245, 112, 246, 238, 247, 5, 250, 84, 252, 196, 254, 61, 1, 193, 3, 78, 6, 232, 8, 107, 11, 184, 13, 178, 15, 247, 16, 213, 17, 76, 18, 46, 18, 188, 17, 250, 16, 190, 15, 60, 14,
-141, 12, 176, 10, 203, 8, 240, 6, 46, 5, 183, 3, 111, 2, 91, 1, 155, 0, 24, 0, 214, 255, 42, 0, 226, 0, 232, 1, 56, 3, 156, 4, 16, 6, 149, 7, 59, 9, 231, 10, 139, 12, 205, 13, 181, 14, 60, 15, 29, 15, 179, 14, 255, 13, 207, 12, 67, 11, 109, 9, 53, 7, 193, 4,
-47, 2, 138, 255, 253, 252, 150, 250, 98, 248, 144, 246, 247, 244, 153, 243, 183, 242, 62, 242, 38, 242, 171, 242, 122, 243, 115, 244, 134, 245, 172, 246, 229, 247, 64, 249, 163, 250, 234, 251, 11, 253, 177, 253, 29, 254, 82, 254, 65, 254, 5, 254, 160, 253, 242, 252, 17, 252, 17, 251, 241, 249, 208, 248,
-188, 247, 194, 246, 19, 246, 151, 245, 80, 245, 107, 245, 201, 245, 108, 246, 165, 247, 77, 249, 67, 251, 130, 253, 195, 255, 0, 2, 49, 4, 99, 6, 138, 8, 157, 10, 64, 12, 125, 13, 82, 14, 115, 14, 61, 14, 185, 13, 193, 12, 103, 11, 198, 9, 206, 7, 152, 5, 73, 3, 233, 0, 163, 254,
-132, 252, 145, 250, 7, 249, 180, 247, 152, 246, 237, 245, 167, 245, 191, 245, 113, 246, 124, 247, 183, 248, 23, 250, 148, 251, 46, 253, 238, 254, 205, 0, 153, 2, 72, 4, 125, 5, 104, 6, 15, 7, 85, 7, 80, 7, 11, 7, 95, 6, 82, 5, 9, 4, 130, 2, 214, 0, 43, 255, 138, 253, 51, 252,
-18, 251, 41, 250, 153, 249, 74, 249, 58, 249, 165, 249, 129, 250, 166, 251, 22, 253, 148, 254, 22, 0, 148, 1, 39, 3, 194, 4, 102, 6, 211, 7, 249, 8, 215, 9, 58, 10, 79, 10, 38, 10, 169, 9, 210, 8, 189, 7, 93, 6, 191, 4, 10, 3, 68, 1, 148, 255, 8, 254, 164, 252, 167, 251,
-227, 250, 86, 250, 39, 250, 96, 250, 239, 250, 252, 251, 98, 253, 231, 254, 123, 0, 4, 2, 143, 3, 30, 5, 168, 6, 6, 8, 49, 9, 186, 9, 209, 9, 136, 9, 192, 8, 156, 7, 51, 6, 111, 4, 86, 2, 19, 0, 166, 253, 43, 251, 185, 248, 86, 246, 79, 244, 143, 242, 23, 241, 17, 240,
-94, 239, 249, 238, 23, 239, 197, 239, 211, 240, 80, 242, 17, 244, 242, 245, 240, 247, 48, 250, 143, 252, 9, 255, 117, 1, 158, 3, 134, 5, 251, 6, 25, 8, 244, 8, 120, 9, 144, 9, 94, 9, 214, 8, 241, 7, 233, 6, 195, 5, 152, 4, 137, 3, 151, 2, 237, 1, 108, 1, 16, 1, 236, 0,
-16, 1, 115, 1, 56, 2, 80, 3, 130, 4, 193, 5, 247, 6, 46, 8, 105, 9, 187, 10, 242, 11, 7, 13, 179, 13, 248, 13, 239, 13, 133, 13, 204, 12, 216, 11, 152, 10, 2, 9, 65, 7, 83, 5, 77, 3, 77, 1, 87, 255, 163, 253, 41, 252, 228, 250, 242, 249, 70, 249, 219, 248, 215, 248,
-92, 249, 51, 250, 99, 251, 196, 252, 40, 254, 140, 255, 245, 0, 98, 2, 206, 3, 10, 5, 226, 5, 93, 6, 59, 6, 169, 5, 204, 4, 152, 3, 12, 2, 75, 0, 79, 254, 28, 252, 221, 249, 150, 247, 111, 245, 124, 243, 191, 241, 112, 240, 122, 239, 202, 238, 124, 238, 169, 238, 60, 239, 88, 240,
-22, 242, 24, 244, 89, 246, 201, 248, 81, 251, 241, 253, 185, 0, 111, 3, 8, 6, 61, 8, 246, 9, 83, 11, 58, 12, 172, 12, 205, 12, 142, 12, 196, 11, 176, 10, 85, 9, 169, 7, 231, 5, 23, 4, 91, 2, 197, 0, 81, 255, 18, 254, 2, 253, 30, 252, 127, 251, 87, 251, 123, 251, 242, 251,
-166, 252, 100, 253, 42, 254, 3, 255, 246, 255, 250, 0, 249, 1, 195, 2, 90, 3, 150, 3, 137, 3, 79, 3, 230, 2, 62, 2, 106, 1, 105, 0, 43, 255, 219, 253, 124, 252, 36, 251, 235, 249, 214, 248, 12, 248, 142, 247, 74, 247, 82, 247, 202, 247, 153, 248, 210, 249, 155, 251, 144, 253, 168, 255,
-194, 1, 216, 3, 235, 5, 7, 8, 14, 10, 240, 11, 112, 13, 101, 14, 253, 14, 36, 15, 226, 14, 94, 14, 148, 13, 94, 12, 245, 10, 89, 9, 140, 7, 186, 5, 234, 3, 65, 2, 208, 0, 145, 255, 157, 254, 239, 253, 126, 253, 93, 253, 206, 253, 152, 254, 191, 255, 65, 1, 205, 2, 97, 4,
-250, 5, 157, 7, 64, 9, 209, 10, 10, 12, 241, 12, 89, 13, 49, 13, 181, 12, 225, 11, 141, 10, 236, 8, 254, 6, 161, 4, 29, 2, 123, 255, 204, 252, 64, 250, 218, 247, 188, 245, 244, 243, 102, 242, 28, 241, 67, 240, 195, 239, 165, 239, 51, 240, 254, 240, 1, 242, 39, 243, 94, 244, 169, 245,
-33, 247, 172, 248, 53, 250, 157, 251, 174, 252, 135, 253, 33, 254, 110, 254, 145, 254, 138, 254, 33, 254, 140, 253, 207, 252, 223, 251, 233, 250, 246, 249, 35, 249, 145, 248, 52, 248, 35, 248, 102, 248, 229, 248, 168, 249, 240, 250, 134, 252, 102, 254, 135, 0, 164, 2, 187, 4, 184, 6, 181, 8, 170, 10,
-135, 12, 17, 14, 70, 15, 4, 16, 40, 16, 251, 15, 126, 15, 128, 14, 60, 13, 177, 11, 189, 9, 160, 7, 103, 5, 24, 3, 225, 0, 201, 254, 234, 252, 95, 251, 9, 250, 240, 248, 66, 248, 232, 247, 230, 247, 148, 248, 138, 249, 191, 250, 28, 252, 145, 253, 26, 255, 201, 0, 138, 2, 64, 4,
-208, 5, 237, 6, 193, 7, 65, 8, 74, 8, 17, 8, 150, 7, 160, 6, 103, 5, 249, 3, 84, 2, 165, 0, 251, 254, 115, 253, 44, 252, 26, 251, 78, 250, 203, 249, 126, 249, 105, 249, 212, 249, 144, 250, 154, 251, 251, 252, 106, 254, 224, 255, 93, 1, 242, 2, 151, 4, 76, 6, 213, 7, 34, 9,
-27, 10, 134, 10, 169, 10, 134, 10, 240, 9, 21, 9, 250, 7, 133, 6, 226, 4, 36, 3, 86, 1, 160, 255, 11, 254, 174, 252, 175, 251, 228, 250, 81, 250, 34, 250, 55, 250, 146, 250, 125, 251, 160, 252, 233, 253, 62, 255, 132, 0, 196, 1, 8, 3, 66, 4, 93, 5, 66, 6, 148, 6, 137, 6,
-35, 6, 56, 5, 21, 4, 187, 2, 255, 0, 8, 255, 230, 252, 153, 250, 78, 248, 17, 246, 249, 243, 55, 242, 180, 240, 125, 239, 181, 238, 51, 238, 247, 237, 96, 238, 65, 239, 140, 240, 104, 242, 126, 244, 186, 246, 24, 249, 160, 251, 64, 254, 249, 0, 138, 3, 226, 5, 244, 7, 112, 9, 165, 10,
-147, 11, 15, 12, 60, 12, 36, 12, 171, 11, 243, 10, 20, 10, 19, 9, 7, 8, 6, 7, 28, 6, 98, 5, 197, 4, 69, 4, 246, 3, 221, 3, 253, 3, 140, 4, 95, 5, 89, 6, 100, 7, 110, 8, 123, 9, 143, 10, 179, 11, 196, 12, 180, 13, 45, 14, 85, 14, 47, 14, 150, 13, 194, 12,
-183, 11, 84, 10, 178, 8, 228, 6, 227, 4, 212, 2, 199, 0, 202, 254, 13, 253, 136, 251, 64, 250, 96, 249, 187, 248, 83, 248, 106, 248, 228, 248, 173, 249, 215, 250, 23, 252, 90, 253, 147, 254, 199, 255, 248, 0, 40, 2, 23, 3, 186, 3, 12, 4, 191, 3, 44, 3, 92, 2, 61, 1, 226, 255,
-89, 254, 148, 252, 168, 250, 173, 248, 172, 246, 204, 244, 22, 243, 149, 241, 139, 240, 200, 239, 75, 239, 74, 239, 178, 239, 124, 240, 242, 241, 222, 243, 14, 246, 121, 248, 237, 250, 106, 253, 242, 255, 127, 2, 244, 4, 75, 7, 18, 9, 118, 10, 121, 11, 235, 11, 0, 12, 198, 11, 19, 11, 249, 9,
-153, 8, 232, 6, 249, 4, 245, 2, 227, 0, 235, 254, 23, 253, 107, 251, 252, 249, 187, 248, 167, 247, 238, 246, 159, 246, 161, 246, 10, 247, 170, 247, 98, 248, 40, 249, 24, 250, 36, 251, 77, 252, 125, 253, 135, 254, 104, 255, 234, 255, 54, 0, 87, 0, 62, 0, 236, 255, 110, 255, 182, 254, 203, 253,
-203, 252, 186, 251, 181, 250, 210, 249, 22, 249, 195, 248, 174, 248, 210, 248, 86, 249, 41, 250, 68, 251, 217, 252, 196, 254, 215, 0, 5, 3, 34, 5, 58, 7, 75, 9, 96, 11, 92, 13, 55, 15, 147, 16, 138, 17, 37, 18, 64, 18, 6, 18, 137, 17, 176, 16, 119, 15, 6, 14, 90, 12, 129, 10,
-161, 8, 191, 6, 16, 5, 146, 3, 69, 2, 83, 1, 158, 0, 37, 0, 19, 0, 119, 0, 47, 1, 77, 2, 153, 3, 239, 4, 67, 6, 143, 7, 222, 8, 48, 10, 81, 11, 43, 12, 186, 12, 169, 12, 49, 12, 104, 11, 54, 10, 166, 8, 214, 6, 184, 4, 85, 2, 219, 255, 80, 253, 212, 250,
-125, 248, 79, 246, 133, 244, 251, 242, 173, 241, 179, 240, 22, 240, 203, 239, 253, 239, 179, 240, 170, 241, 220, 242, 50, 244, 161, 245, 41, 247, 236, 248, 185, 250, 137, 252, 27, 254, 97, 255, 104, 0, 20, 1, 121, 1, 168, 1, 142, 1, 34, 1, 132, 0, 181, 255, 188, 254, 193, 253, 199, 252, 4, 252,
-115, 251, 19, 251, 5, 251, 42, 251, 126, 251, 22, 252, 13, 253, 66, 254, 190, 255, 94, 1, 250, 2, 138, 4, 7, 6, 132, 7, 253, 8, 83, 10, 94, 11, 30, 12, 83, 12, 21, 12, 137, 11, 162, 10, 89, 9, 211, 7, 6, 6, 238, 3, 187, 1, 112, 255, 43, 253, 3, 251, 252, 248, 77, 247,
-228, 245, 180, 244, 216, 243, 99, 243, 72, 243, 175, 243, 174, 244, 246, 245, 130, 247, 50, 249, 245, 250, 200, 252, 187, 254, 172, 0, 145, 2, 38, 4, 92, 5, 66, 6, 187, 6, 220, 6, 191, 6, 89, 6, 153, 5, 171, 4, 144, 3, 77, 2, 7, 1, 196, 255, 166, 254, 183, 253, 242, 252, 111, 252,
-31, 252, 251, 251, 24, 252, 161, 252, 116, 253, 155, 254, 7, 0, 126, 1, 254, 2, 138, 4, 33, 6, 192, 7, 83, 9, 159, 10, 166, 11, 46, 12, 58, 12, 250, 11, 102, 11, 113, 10, 66, 9, 215, 7, 31, 6, 80, 4, 109, 2, 139, 0, 203, 254, 47, 253, 226, 251, 221, 250, 14, 250, 129, 249,
-70, 249, 76, 249, 170, 249, 127, 250, 128, 251, 166, 252, 203, 253, 234, 254, 5, 0, 36, 1, 55, 2, 49, 3, 219, 3, 25, 4, 10, 4, 152, 3, 209, 2, 213, 1, 160, 0, 22, 255, 98, 253, 134, 251, 138, 249, 147, 247, 168, 245, 244, 243, 135, 242, 88, 241, 136, 240, 24, 240, 243, 239, 48, 240,
-18, 241, 93, 242, 22, 244, 73, 246, 151, 248, 248, 250, 110, 253, 241, 255, 125, 2, 4, 5, 82, 7, 97, 9, 3, 11, 49, 12, 22, 13, 170, 13, 210, 13, 182, 13, 87, 13, 131, 12, 131, 11, 88, 10, 252, 8, 159, 7, 72, 6, 15, 5, 254, 3, 10, 3, 60, 2, 168, 1, 79, 1, 64, 1,
-174, 1, 76, 2, 22, 3, 241, 3, 205, 4, 172, 5, 158, 6, 141, 7, 106, 8, 19, 9, 85, 9, 78, 9, 243, 8, 62, 8, 90, 7, 71, 6, 222, 4, 81, 3, 163, 1, 210, 255, 7, 254, 73, 252, 185, 250, 112, 249, 101, 248, 174, 247, 77, 247, 39, 247, 68, 247, 217, 247, 185, 248, 225, 249,
-80, 251, 187, 252, 33, 254, 113, 255, 190, 0, 4, 2, 58, 3, 46, 4, 225, 4, 48, 5, 6, 5, 159, 4, 248, 3, 248, 2, 197, 1, 96, 0, 177, 254, 236, 252, 24, 251, 70, 249, 157, 247, 32, 246, 240, 244, 41, 244, 169, 243, 121, 243, 197, 243, 106, 244, 108, 245, 26, 247, 4, 249, 32, 251,
-82, 253, 122, 255, 157, 1, 194, 3, 217, 5, 211, 7, 144, 9, 203, 10, 173, 11, 42, 12, 28, 12, 196, 11, 33, 11, 246, 9, 134, 8, 217, 6, 226, 4, 207, 2, 176, 0, 150, 254, 172, 252, 231, 250, 86, 249, 13, 248, 243, 246, 8, 246, 162, 245, 146, 245, 213, 245, 140, 246, 100, 247, 85, 248,
-100, 249, 153, 250, 233, 251, 87, 253, 172, 254, 218, 255, 203, 0, 86, 1, 175, 1, 215, 1, 174, 1, 88, 1, 214, 0, 20, 0, 56, 255, 77, 254, 98, 253, 153, 252, 246, 251, 145, 251, 135, 251, 176, 251, 16, 252, 192, 252, 171, 253, 210, 254, 112, 0, 56, 2, 29, 4, 6, 6, 219, 7, 166, 9,
-105, 11, 27, 13, 170, 14, 253, 15, 194, 16, 44, 17, 54, 17, 181, 16, 241, 15, 235, 14, 118, 13, 197, 11, 229, 9, 212, 7, 185, 5, 164, 3, 171, 1, 245, 255, 121, 254, 66, 253, 106, 252, 207, 251, 113, 251, 155, 251, 29, 252, 239, 252, 30, 254, 90, 255, 154, 0, 207, 1, 2, 3, 51, 4,
-92, 5, 69, 6, 232, 6, 53, 7, 233, 6, 89, 6, 133, 5, 75, 4, 218, 2, 57, 1, 87, 255, 88, 253, 76, 251, 60, 249, 71, 247, 118, 245, 221, 243, 156, 242, 147, 241, 194, 240, 88, 240, 62, 240, 118, 240, 70, 241, 108, 242, 207, 243, 95, 245, 6, 247, 191, 248, 144, 250, 122, 252, 88, 254,
-25, 0, 113, 1, 128, 2, 70, 3, 151, 3, 180, 3, 157, 3, 50, 3, 145, 2, 204, 1, 222, 0, 227, 255, 235, 254, 5, 254, 88, 253, 217, 252, 142, 252, 135, 252, 164, 252, 231, 252, 131, 253, 100, 254, 128, 255, 229, 0, 77, 2, 179, 3, 14, 5, 96, 6, 173, 7, 245, 8, 248, 9, 178, 10,
-30, 11, 230, 10, 102, 10, 158, 9, 113, 8, 0, 7, 92, 5, 116, 3, 104, 1, 78, 255, 48, 253, 51, 251, 94, 249, 187, 247, 138, 246, 153, 245, 229, 244, 174, 244, 212, 244, 84, 245, 116, 246, 242, 247, 166, 249, 129, 251, 97, 253, 70, 255, 49, 1, 30, 3, 246, 4, 174, 6, 239, 7, 226, 8,
-138, 9, 198, 9, 191, 9, 126, 9, 234, 8, 17, 8, 12, 7, 220, 5, 140, 4, 56, 3, 234, 1, 201, 0, 208, 255, 254, 254, 119, 254, 25, 254, 232, 253, 27, 254, 169, 254, 125, 255, 164, 0, 227, 1, 37, 3, 94, 4, 152, 5, 205, 6, 250, 7, 234, 8, 143, 9, 230, 9, 168, 9, 35, 9,
-95, 8, 74, 7, 253, 5, 135, 4, 220, 2, 21, 1, 69, 255, 112, 253, 190, 251, 52, 250, 215, 248, 230, 247, 41, 247, 157, 246, 104, 246, 120, 246, 202, 246, 145, 247, 160, 248, 211, 249, 26, 251, 82, 252, 135, 253, 187, 254, 238, 255, 8, 1, 1, 2, 136, 2, 189, 2, 167, 2, 45, 2, 112, 1,
-125, 0, 68, 255, 203, 253, 46, 252, 112, 250, 171, 248, 243, 246, 82, 245, 10, 244, 8, 243, 77, 242, 11, 242, 24, 242, 111, 242, 76, 243, 164, 244, 84, 246, 107, 248, 168, 250, 240, 252, 58, 255, 130, 1, 205, 3, 28, 6, 58, 8, 24, 10, 181, 11, 211, 12, 156, 13, 33, 14, 69, 14, 11, 14,
-143, 13, 193, 12, 162, 11, 92, 10, 241, 8, 114, 7, 3, 6, 170, 4, 138, 3, 150, 2, 202, 1, 54, 1, 236, 0, 228, 0, 62, 1, 241, 1, 199, 2, 177, 3, 153, 4, 131, 5, 110, 6, 93, 7, 53, 8, 240, 8, 67, 9, 69, 9, 2, 9, 100, 8, 138, 7, 134, 6, 73, 5, 220, 3,
-88, 2, 192, 0, 40, 255, 165, 253, 60, 252, 39, 251, 83, 250, 188, 249, 124, 249, 116, 249, 158, 249, 23, 250, 233, 250, 245, 251, 63, 253, 149, 254, 227, 255, 35, 1, 84, 2, 129, 3, 167, 4, 149, 5, 53, 6, 139, 6, 91, 6, 208, 5, 3, 5, 232, 3, 128, 2, 235, 0, 37, 255, 55, 253,
-69, 251, 85, 249, 147, 247, 9, 246, 186, 244, 228, 243, 93, 243, 26, 243, 55, 243, 183, 243, 138, 244, 209, 245, 124, 247, 76, 249, 57, 251, 21, 253, 237, 254, 194, 0, 143, 2, 63, 4, 204, 5, 235, 6, 162, 7, 7, 8, 253, 7, 146, 7, 229, 6, 228, 5, 136, 4, 251, 2, 61, 1, 83, 255,
-101, 253, 121, 251, 186, 249, 45, 248, 205, 246, 175, 245, 207, 244, 39, 244, 215, 243, 6, 244, 132, 244, 93, 245, 119, 246, 161, 247, 216, 248, 45, 250, 144, 251, 254, 252, 92, 254, 126, 255, 105, 0, 246, 0, 54, 1, 68, 1, 28, 1, 187, 0, 58, 0, 153, 255, 222, 254, 31, 254, 96, 253, 196, 252,
-83, 252, 14, 252, 34, 252, 113, 252, 236, 252, 161, 253, 156, 254, 210, 255, 86, 1, 45, 3, 28, 5, 27, 7, 4, 9, 226, 10, 181, 12, 110, 14, 251, 15, 85, 17, 44, 18, 136, 18, 136, 18, 17, 18, 52, 17, 22, 16, 175, 14, 248, 12, 31, 11, 40, 9, 35, 7, 48, 5, 83, 3, 187, 1,
-108, 0, 89, 255, 151, 254, 33, 254, 230, 253, 251, 253, 138, 254, 91, 255, 113, 0, 169, 1, 218, 2, 1, 4, 23, 5, 40, 6, 47, 7, 5, 8, 139, 8, 201, 8, 150, 8, 3, 8, 52, 7, 35, 6, 197, 4, 62, 3, 140, 1, 168, 255, 187, 253, 199, 251, 228, 249, 43, 248, 158, 246, 96, 245,
-107, 244, 172, 243, 52, 243, 38, 243, 107, 243, 23, 244, 67, 245, 154, 246, 22, 248, 156, 249, 39, 251, 182, 252, 82, 254, 213, 255, 53, 1, 71, 2, 242, 2, 90, 3, 119, 3, 75, 3, 245, 2, 116, 2, 184, 1, 225, 0, 243, 255, 243, 254, 250, 253, 15, 253, 83, 252, 210, 251, 125, 251, 99, 251,
-123, 251, 190, 251, 57, 252, 27, 253, 51, 254, 127, 255, 233, 0, 69, 2, 146, 3, 200, 4, 245, 5, 15, 7, 244, 7, 122, 8, 175, 8, 111, 8, 187, 7, 197, 6, 136, 5, 246, 3, 57, 2, 82, 0, 68, 254, 49, 252, 32, 250, 50, 248, 127, 246, 6, 245, 239, 243, 66, 243, 219, 242, 197, 242,
-46, 243, 237, 243, 12, 245, 175, 246, 117, 248, 85, 250, 51, 252, 14, 254, 230, 255, 193, 1, 130, 3, 31, 5, 116, 6, 99, 7, 17, 8, 119, 8, 132, 8, 93, 8, 3, 8, 82, 7, 119, 6, 120, 5, 91, 4, 56, 3, 30, 2, 48, 1, 121, 0, 240, 255, 167, 255, 152, 255, 186, 255, 23, 0,
-234, 0, 244, 1, 47, 3, 134, 4, 203, 5, 254, 6, 25, 8, 37, 9, 27, 10, 228, 10, 74, 11, 100, 11, 29, 11, 105, 10, 128, 9, 100, 8, 4, 7, 130, 5, 223, 3, 31, 2, 91, 0, 152, 254, 238, 252, 124, 251, 59, 250, 68, 249, 161, 248, 47, 248, 242, 247, 16, 248, 113, 248, 23, 249,
-39, 250, 77, 251, 130, 252, 172, 253, 206, 254, 235, 255, 4, 1, 255, 1, 204, 2, 75, 3, 83, 3, 17, 3, 130, 2, 149, 1, 118, 0, 40, 255, 151, 253, 240, 251, 59, 250, 136, 248, 245, 246, 135, 245, 100, 244, 172, 243, 60, 243, 35, 243, 110, 243, 255, 243, 215, 244, 70, 246, 253, 247, 242, 249,
-26, 252, 62, 254, 94, 0, 120, 2, 145, 4, 160, 6, 148, 8, 51, 10, 140, 11, 146, 12, 24, 13, 91, 13, 93, 13, 228, 12, 44, 12, 59, 11, 251, 9, 154, 8, 37, 7, 165, 5, 70, 4, 7, 3, 251, 1, 52, 1, 147, 0, 24, 0, 246, 255, 19, 0, 111, 0, 43, 1, 252, 1, 213, 2,
-157, 3, 90, 4, 17, 5, 194, 5, 83, 6, 182, 6, 214, 6, 133, 6, 246, 5, 45, 5, 32, 4, 243, 2, 169, 1, 66, 0, 207, 254, 90, 253, 241, 251, 167, 250, 130, 249, 153, 248, 15, 248, 191, 247, 174, 247, 236, 247, 94, 248, 5, 249, 33, 250, 118, 251, 249, 252, 151, 254, 38, 0, 168, 1,
-28, 3, 129, 4, 207, 5, 248, 6, 177, 7, 21, 8, 31, 8, 159, 7, 225, 6, 231, 5, 155, 4, 37, 3, 144, 1, 221, 255, 45, 254, 136, 252, 1, 251, 197, 249, 198, 248, 19, 248, 201, 247, 181, 247, 215, 247, 97, 248, 55, 249, 85, 250, 216, 251, 119, 253, 34, 255, 194, 0, 85, 2, 225, 3,
-102, 5, 195, 6, 234, 7, 203, 8, 37, 9, 50, 9, 241, 8, 67, 8, 81, 7, 37, 6, 171, 4, 0, 3, 57, 1, 91, 255, 129, 253, 186, 251, 21, 250, 192, 248, 155, 247, 168, 246, 16, 246, 180, 245, 151, 245, 4, 246, 193, 246, 181, 247, 219, 248, 1, 250, 40, 251, 82, 252, 128, 253, 166, 254,
-190, 255, 129, 0, 10, 1, 88, 1, 72, 1, 25, 1, 203, 0, 80, 0, 194, 255, 39, 255, 127, 254, 220, 253, 68, 253, 194, 252, 125, 252, 108, 252, 149, 252, 23, 253, 197, 253, 158, 254, 203, 255, 65, 1, 244, 2, 245, 4, 10, 7, 28, 9, 16, 11, 225, 12, 150, 14, 43, 16, 109, 17, 93, 18,
-245, 18, 210, 18, 89, 18, 141, 17, 81, 16, 213, 14, 38, 13, 58, 11, 45, 9, 17, 7, 239, 4, 226, 2, 250, 0, 68, 255, 244, 253, 223, 252, 5, 252, 128, 251, 57, 251, 46, 251, 149, 251, 76, 252, 49, 253, 54, 254, 53, 255, 46, 0, 27, 1, 6, 2, 224, 2, 164, 3, 10, 4, 44, 4,
-12, 4, 135, 3, 203, 2, 223, 1, 177, 0, 86, 255, 221, 253, 67, 252, 158, 250, 254, 248, 110, 247, 31, 246, 9, 245, 49, 244, 200, 243, 151, 243, 159, 243, 13, 244, 215, 244, 232, 245, 88, 247, 230, 248, 125, 250, 16, 252, 145, 253, 16, 255, 142, 0, 228, 1, 10, 3, 250, 3, 120, 4, 182, 4,
-190, 4, 130, 4, 22, 4, 137, 3, 208, 2, 250, 1, 21, 1, 36, 0, 61, 255, 111, 254, 189, 253, 97, 253, 50, 253, 48, 253, 107, 253, 218, 253, 121, 254, 112, 255, 164, 0, 244, 1, 81, 3, 146, 4, 187, 5, 203, 6, 187, 7, 134, 8, 38, 9, 67, 9, 5, 9, 114, 8, 104, 7, 26, 6,
-155, 4, 224, 2, 253, 0, 6, 255, 3, 253, 6, 251, 30, 249, 82, 247, 230, 245, 194, 244, 234, 243, 150, 243, 132, 243, 177, 243, 75, 244, 73, 245, 146, 246, 62, 248, 20, 250, 247, 251, 220, 253, 187, 255, 156, 1, 127, 3, 66, 5, 212, 6, 51, 8, 32, 9, 197, 9, 46, 10, 69, 10, 24, 10,
-186, 9, 29, 9, 75, 8, 96, 7, 93, 6, 94, 5, 119, 4, 175, 3, 58, 3, 243, 2, 215, 2, 241, 2, 60, 3, 180, 3, 118, 4, 117, 5, 136, 6, 162, 7, 150, 8, 113, 9, 48, 10, 210, 10, 84, 11, 178, 11, 164, 11, 67, 11, 152, 10, 134, 9, 55, 8, 192, 6, 22, 5, 71, 3,
-104, 1, 124, 255, 142, 253, 176, 251, 232, 249, 101, 248, 35, 247, 31, 246, 119, 245, 14, 245, 220, 244, 251, 244, 127, 245, 70, 246, 92, 247, 160, 248, 232, 249, 41, 251, 98, 252, 146, 253, 187, 254, 188, 255, 126, 0, 1, 1, 14, 1, 199, 0, 68, 0, 122, 255, 121, 254, 91, 253, 29, 252, 207, 250,
-131, 249, 61, 248, 38, 247, 65, 246, 145, 245, 82, 245, 92, 245, 161, 245, 52, 246, 12, 247, 32, 248, 142, 249, 85, 251, 67, 253, 80, 255, 89, 1, 93, 3, 90, 5, 77, 7, 42, 9, 235, 10, 79, 12, 85, 13, 15, 14, 90, 14, 69, 14, 241, 13, 80, 13, 89, 12, 56, 11, 237, 9, 119, 8,
-0, 7, 138, 5, 65, 4, 44, 3, 69, 2, 166, 1, 57, 1, 242, 0, 227, 0, 36, 1, 151, 1, 67, 2, 2, 3, 181, 3, 86, 4, 208, 4, 62, 5, 159, 5, 215, 5, 210, 5, 151, 5, 254, 4, 30, 4, 21, 3, 232, 1, 156, 0, 73, 255, 242, 253, 156, 252, 86, 251, 32, 250, 18, 249,
-57, 248, 149, 247, 83, 247, 98, 247, 171, 247, 61, 248, 29, 249, 60, 250, 174, 251, 126, 253, 110, 255, 119, 1, 107, 3, 77, 5, 27, 7, 209, 8, 90, 10, 177, 11, 154, 12, 1, 13, 10, 13, 156, 12, 197, 11, 176, 10, 90, 9, 190, 7, 4, 6, 47, 4, 72, 2, 105, 0, 152, 254, 1, 253,
-175, 251, 150, 250, 209, 249, 83, 249, 9, 249, 1, 249, 103, 249, 15, 250, 253, 250, 39, 252, 82, 253, 123, 254, 156, 255, 184, 0, 201, 1, 189, 2, 111, 3, 227, 3, 248, 3, 171, 3, 36, 3, 99, 2, 88, 1, 41, 0, 213, 254, 82, 253, 196, 251, 44, 250, 161, 248, 61, 247, 4, 246, 32, 245,
-136, 244, 38, 244, 6, 244, 47, 244, 149, 244, 71, 245, 90, 246, 141, 247, 220, 248, 30, 250, 85, 251, 132, 252, 177, 253, 205, 254, 210, 255, 160, 0, 31, 1, 105, 1, 119, 1, 80, 1, 16, 1, 184, 0, 68, 0, 201, 255, 72, 255, 206, 254, 101, 254, 18, 254, 1, 254, 56, 254, 167, 254, 102, 255,
-99, 0, 139, 1, 227, 2, 146, 4, 112, 6, 125, 8, 156, 10, 160, 12, 135, 14, 38, 16, 150, 17, 218, 18, 204, 19, 82, 20, 126, 20, 44, 20, 86, 19, 58, 18, 213, 16, 28, 15, 62, 13, 63, 11, 20, 9, 229, 6, 180, 4, 144, 2, 156, 0, 217, 254, 110, 253, 98, 252, 146, 251, 9, 251,
-219, 250, 239, 250, 80, 251, 48, 252, 63, 253, 120, 254, 200, 255, 27, 1, 112, 2, 198, 3, 11, 5, 48, 6, 19, 7, 148, 7, 209, 7, 190, 7, 79, 7, 175, 6, 221, 5, 193, 4, 134, 3, 50, 2, 202, 0, 105, 255, 24, 254, 247, 252, 34, 252, 134, 251, 53, 251, 43, 251, 76, 251, 154, 251,
-65, 252, 25, 253, 31, 254, 71, 255, 100, 0, 115, 1, 100, 2, 75, 3, 38, 4, 233, 4, 112, 5, 195, 5, 207, 5, 133, 5, 18, 5, 118, 4, 158, 3, 175, 2, 169, 1, 139, 0, 108, 255, 82, 254, 75, 253, 115, 252, 197, 251, 88, 251, 55, 251, 62, 251, 111, 251, 224, 251, 129, 252, 85, 253,
-130, 254, 192, 255, 7, 1, 43, 2, 42, 3, 11, 4, 196, 4, 75, 5, 159, 5, 164, 5, 37, 5, 91, 4, 66, 3, 207, 1, 59, 0, 136, 254, 170, 252, 196, 250, 219, 248, 253, 246, 73, 245, 191, 243, 129, 242, 187, 241, 69, 241, 44, 241, 125, 241, 7, 242, 201, 242, 8, 244, 143, 245, 89, 247,
-109, 249, 141, 251, 178, 253, 208, 255, 236, 1, 254, 3, 253, 5, 184, 7, 51, 9, 96, 10, 22, 11, 145, 11, 211, 11, 193, 11, 133, 11, 34, 11, 137, 10, 215, 9, 17, 9, 59, 8, 126, 7, 220, 6, 102, 6, 59, 6, 46, 6, 60, 6, 120, 6, 213, 6, 84, 7, 26, 8, 245, 8, 216, 9,
-166, 10, 79, 11, 223, 11, 80, 12, 150, 12, 178, 12, 149, 12, 9, 12, 63, 11, 56, 10, 215, 8, 80, 7, 167, 5, 213, 3, 248, 1, 27, 0, 76, 254, 156, 252, 14, 251, 184, 249, 192, 248, 10, 248, 159, 247, 146, 247, 185, 247, 21, 248, 220, 248, 228, 249, 34, 251, 144, 252, 248, 253, 83, 255,
-141, 0, 171, 1, 176, 2, 146, 3, 28, 4, 97, 4, 91, 4, 223, 3, 51, 3, 89, 2, 68, 1, 18, 0, 201, 254, 110, 253, 18, 252, 189, 250, 123, 249, 117, 248, 163, 247, 19, 247, 248, 246, 19, 247, 98, 247, 16, 248, 254, 248, 44, 250, 201, 251, 151, 253, 128, 255, 111, 1, 86, 3, 52, 5,
-4, 7, 192, 8, 81, 10, 170, 11, 123, 12, 250, 12, 40, 13, 222, 12, 94, 12, 173, 11, 178, 10, 143, 9, 81, 8, 239, 6, 135, 5, 39, 4, 221, 2, 214, 1, 252, 0, 83, 0, 218, 255, 119, 255, 46, 255, 29, 255, 65, 255, 138, 255, 246, 255, 86, 0, 166, 0, 214, 0, 246, 0, 14, 1,
-27, 1, 6, 1, 203, 0, 105, 0, 200, 255, 10, 255, 52, 254, 76, 253, 91, 252, 106, 251, 133, 250, 179, 249, 246, 248, 91, 248, 5, 248, 235, 247, 22, 248, 188, 248, 152, 249, 167, 250, 255, 251, 140, 253, 75, 255, 90, 1, 140, 3, 200, 5, 245, 7, 238, 9, 193, 11, 104, 13, 189, 14, 206, 15,
-152, 16, 178, 16, 113, 16, 215, 15, 191, 14, 97, 13, 207, 11, 254, 9, 10, 8, 5, 6, 247, 3, 238, 1, 249, 255, 36, 254, 171, 252, 118, 251, 133, 250, 255, 249, 181, 249, 165, 249, 245, 249, 153, 250, 118, 251, 145, 252, 191, 253, 238, 254, 24, 0, 59, 1, 85, 2, 100, 3, 39, 4, 172, 4,
-240, 4, 194, 4, 87, 4, 187, 3, 225, 2, 215, 1, 175, 0, 101, 255, 9, 254, 170, 252, 78, 251, 22, 250, 7, 249, 37, 248, 159, 247, 69, 247, 21, 247, 29, 247, 95, 247, 212, 247, 153, 248, 145, 249, 155, 250, 167, 251, 159, 252, 143, 253, 121, 254, 95, 255, 50, 0, 240, 0, 102, 1, 171, 1,
-199, 1, 177, 1, 128, 1, 61, 1, 231, 0, 137, 0, 44, 0, 215, 255, 155, 255, 130, 255, 142, 255, 255, 255, 167, 0, 133, 1, 160, 2, 212, 3, 31, 5, 148, 6, 56, 8, 246, 9, 199, 11, 114, 13, 240, 14, 46, 16, 18, 17, 194, 17, 62, 18, 66, 18, 242, 17, 78, 17, 33, 16, 168, 14,
-245, 12, 255, 10, 231, 8, 188, 6, 127, 4, 69, 2, 17, 0, 231, 253, 248, 251, 63, 250, 195, 248, 205, 247, 35, 247, 186, 246, 170, 246, 236, 246, 113, 247, 91, 248, 156, 249, 2, 251, 134, 252, 16, 254, 152, 255, 30, 1, 149, 2, 234, 3, 23, 5, 221, 5, 76, 6, 117, 6, 62, 6, 191, 5,
-17, 5, 49, 4, 41, 3, 16, 2, 234, 0, 197, 255, 172, 254, 162, 253, 223, 252, 80, 252, 241, 251, 216, 251, 233, 251, 29, 252, 136, 252, 53, 253, 8, 254, 8, 255, 14, 0, 7, 1, 239, 1, 187, 2, 121, 3, 41, 4, 168, 4, 240, 4, 6, 5, 204, 4, 92, 4, 199, 3, 8, 3, 31, 2,
-35, 1, 19, 0, 253, 254, 239, 253, 238, 252, 34, 252, 135, 251, 29, 251, 14, 251, 48, 251, 118, 251, 235, 251, 141, 252, 89, 253, 99, 254, 151, 255, 206, 0, 0, 2, 242, 2, 192, 3, 107, 4, 223, 4, 35, 5, 52, 5, 223, 4, 53, 4, 79, 3, 35, 2, 207, 0, 101, 255, 230, 253, 86, 252,
-202, 250, 68, 249, 220, 247, 155, 246, 134, 245, 218, 244, 137, 244, 131, 244, 223, 244, 128, 245, 86, 246, 121, 247, 247, 248, 174, 250, 162, 252, 174, 254, 180, 0, 176, 2, 143, 4, 98, 6, 36, 8, 179, 9, 247, 10, 249, 11, 150, 12, 208, 12, 211, 12, 153, 12, 36, 12, 148, 11, 236, 10, 38, 10,
-86, 9, 124, 8, 171, 7, 246, 6, 95, 6, 5, 6, 219, 5, 204, 5, 216, 5, 6, 6, 83, 6, 202, 6, 118, 7, 43, 8, 227, 8, 113, 9, 229, 9, 61, 10, 108, 10, 113, 10, 78, 10, 217, 9, 22, 9, 28, 8, 221, 6, 101, 5, 205, 3, 19, 2, 72, 0, 123, 254, 178, 252, 11, 251,
-133, 249, 36, 248, 32, 247, 110, 246, 0, 246, 237, 245, 35, 246, 139, 246, 47, 247, 45, 248, 91, 249, 183, 250, 42, 252, 140, 253, 217, 254, 252, 255, 1, 1, 233, 1, 154, 2, 250, 2, 28, 3, 232, 2, 102, 2, 188, 1, 234, 0, 232, 255, 213, 254, 177, 253, 126, 252, 79, 251, 39, 250, 32, 249,
-76, 248, 171, 247, 103, 247, 114, 247, 178, 247, 51, 248, 0, 249, 4, 250, 73, 251, 229, 252, 148, 254, 79, 0, 249, 1, 141, 3, 14, 5, 126, 6, 200, 7, 235, 8, 194, 9, 50, 10, 95, 10, 60, 10, 200, 9, 47, 9, 113, 8, 129, 7, 127, 6, 109, 5, 77, 4, 51, 3, 38, 2, 68, 1,
-157, 0, 31, 0, 212, 255, 169, 255, 146, 255, 148, 255, 209, 255, 50, 0, 185, 0, 79, 1, 211, 1, 67, 2, 136, 2, 189, 2, 226, 2, 234, 2, 200, 2, 127, 2, 251, 1, 67, 1, 110, 0, 126, 255, 125, 254, 123, 253, 121, 252, 144, 251, 190, 250, 7, 250, 137, 249, 83, 249, 94, 249, 208, 249,
-163, 250, 172, 251, 237, 252, 101, 254, 6, 0, 208, 1, 218, 3, 238, 5, 4, 8, 240, 9, 175, 11, 71, 13, 156, 14, 173, 15, 124, 16, 231, 16, 205, 16, 96, 16, 151, 15, 98, 14, 249, 12, 94, 11, 132, 9, 150, 7, 153, 5, 145, 3, 149, 1, 173, 255, 242, 253, 138, 252, 96, 251, 133, 250,
-3, 250, 179, 249, 151, 249, 225, 249, 100, 250, 28, 251, 6, 252, 242, 252, 219, 253, 180, 254, 127, 255, 59, 0, 222, 0, 60, 1, 99, 1, 70, 1, 204, 0, 40, 0, 94, 255, 96, 254, 78, 253, 42, 252, 246, 250, 197, 249, 156, 248, 133, 247, 156, 246, 220, 245, 90, 245, 36, 245, 19, 245, 36, 245,
-110, 245, 224, 245, 125, 246, 109, 247, 121, 248, 150, 249, 167, 250, 167, 251, 154, 252, 125, 253, 86, 254, 23, 255, 177, 255, 5, 0, 47, 0, 44, 0, 249, 255, 185, 255, 107, 255, 18, 255, 190, 254, 111, 254, 49, 254, 19, 254, 22, 254, 82, 254, 229, 254, 176, 255, 183, 0, 240, 1, 61, 3, 156, 4,
-37, 6, 203, 7, 136, 9, 78, 11, 236, 12, 98, 14, 140, 15, 109, 16, 26, 17, 133, 17, 133, 17, 56, 17, 147, 16, 106, 15, 7, 14, 112, 12, 154, 10, 174, 8, 179, 6, 176, 4, 179, 2, 189, 0, 219, 254, 47, 253, 185, 251, 143, 250, 222, 249, 111, 249, 65, 249, 110, 249, 213, 249, 120, 250,
-131, 251, 191, 252, 29, 254, 144, 255, 244, 0, 78, 2, 154, 3, 202, 4, 216, 5, 186, 6, 57, 7, 125, 7, 134, 7, 54, 7, 187, 6, 26, 6, 74, 5, 101, 4, 117, 3, 126, 2, 140, 1, 167, 0, 217, 255, 71, 255, 226, 254, 175, 254, 184, 254, 222, 254, 31, 255, 155, 255, 71, 0, 23, 1,
-16, 2, 3, 3, 232, 3, 175, 4, 88, 5, 233, 5, 91, 6, 138, 6, 130, 6, 62, 6, 152, 5, 202, 4, 214, 3, 181, 2, 128, 1, 61, 0, 238, 254, 169, 253, 111, 252, 71, 251, 86, 250, 146, 249, 5, 249, 218, 248, 217, 248, 255, 248, 87, 249, 209, 249, 108, 250, 65, 251, 49, 252, 40, 253,
-12, 254, 197, 254, 95, 255, 211, 255, 33, 0, 74, 0, 73, 0, 226, 255, 65, 255, 104, 254, 77, 253, 24, 252, 211, 250, 131, 249, 55, 248, 242, 246, 186, 245, 159, 244, 164, 243, 215, 242, 117, 242, 93, 242, 144, 242, 52, 243, 7, 244, 8, 245, 88, 246, 235, 247, 176, 249, 178, 251, 188, 253, 188, 255,
-164, 1, 102, 3, 17, 5, 161, 6, 243, 7, 13, 9, 237, 9, 103, 10, 167, 10, 182, 10, 134, 10, 49, 10, 197, 9, 64, 9, 169, 8, 10, 8, 104, 7, 206, 6, 79, 6, 240, 5, 215, 5, 225, 5, 10, 6, 78, 6, 168, 6, 24, 7, 182, 7, 114, 8, 56, 9, 247, 9, 139, 10, 254, 10,
-75, 11, 102, 11, 88, 11, 31, 11, 134, 10, 176, 9, 163, 8, 79, 7, 208, 5, 55, 4, 130, 2, 198, 0, 16, 255, 105, 253, 229, 251, 129, 250, 68, 249, 107, 248, 215, 247, 136, 247, 162, 247, 241, 247, 108, 248, 38, 249, 28, 250, 59, 251, 139, 252, 224, 253, 46, 255, 105, 0, 123, 1, 121, 2,
-103, 3, 9, 4, 118, 4, 173, 4, 118, 4, 10, 4, 115, 3, 165, 2, 185, 1, 184, 0, 161, 255, 131, 254, 101, 253, 74, 252, 87, 251, 143, 250, 243, 249, 198, 249, 209, 249, 13, 250, 137, 250, 48, 251, 0, 252, 16, 253, 85, 254, 173, 255, 15, 1, 81, 2, 126, 3, 148, 4, 132, 5, 88, 6,
-12, 7, 103, 7, 126, 7, 90, 7, 229, 6, 60, 6, 115, 5, 136, 4, 128, 3, 109, 2, 84, 1, 50, 0, 27, 255, 16, 254, 60, 253, 152, 252, 34, 252, 232, 251, 201, 251, 193, 251, 214, 251, 29, 252, 137, 252, 35, 253, 208, 253, 116, 254, 2, 255, 103, 255, 185, 255, 246, 255, 17, 0, 2, 0,
-204, 255, 85, 255, 173, 254, 231, 253, 7, 253, 29, 252, 54, 251, 94, 250, 169, 249, 15, 249, 142, 248, 84, 248, 77, 248, 124, 248, 35, 249, 18, 250, 55, 251, 154, 252, 33, 254, 197, 255, 146, 1, 137, 3, 142, 5, 156, 7, 130, 9, 70, 11, 229, 12, 58, 14, 87, 15, 55, 16, 157, 16, 158, 16,
-78, 16, 145, 15, 131, 14, 65, 13, 197, 11, 30, 10, 100, 8, 152, 6, 201, 4, 2, 3, 72, 1, 198, 255, 132, 254, 124, 253, 206, 252, 93, 252, 23, 252, 7, 252, 59, 252, 158, 252, 58, 253, 254, 253, 197, 254, 138, 255, 51, 0, 206, 0, 88, 1, 189, 1, 240, 1, 246, 1, 178, 1, 49, 1,
-139, 0, 189, 255, 208, 254, 210, 253, 194, 252, 172, 251, 152, 250, 133, 249, 147, 248, 193, 247, 19, 247, 183, 246, 147, 246, 152, 246, 205, 246, 39, 247, 165, 247, 83, 248, 73, 249, 90, 250, 132, 251, 158, 252, 165, 253, 152, 254, 112, 255, 53, 0, 230, 0, 103, 1, 169, 1, 193, 1, 164, 1, 90, 1,
-1, 1, 159, 0, 53, 0, 212, 255, 126, 255, 53, 255, 3, 255, 232, 254, 2, 255, 87, 255, 223, 255, 174, 0, 162, 1, 170, 2, 198, 3, 252, 4, 73, 6, 178, 7, 33, 9, 120, 10, 176, 11, 148, 12, 67, 13, 194, 13, 246, 13, 221, 13, 131, 13, 192, 12, 160, 11, 69, 10, 172, 8, 231, 6,
-15, 5, 39, 3, 65, 1, 97, 255, 136, 253, 206, 251, 65, 250, 226, 248, 229, 247, 76, 247, 246, 246, 237, 246, 47, 247, 159, 247, 69, 248, 71, 249, 113, 250, 194, 251, 33, 253, 117, 254, 186, 255, 224, 0, 237, 1, 225, 2, 161, 3, 29, 4, 107, 4, 127, 4, 81, 4, 3, 4, 151, 3, 252, 2,
-84, 2, 161, 1, 236, 0, 56, 0, 140, 255, 255, 254, 161, 254, 108, 254, 116, 254, 175, 254, 8, 255, 124, 255, 31, 0, 231, 0, 211, 1, 230, 2, 243, 3, 247, 4, 202, 5, 124, 6, 17, 7, 122, 7, 170, 7, 170, 7, 98, 7, 198, 6, 253, 5, 7, 5, 227, 3, 174, 2, 105, 1, 31, 0,
-218, 254, 156, 253, 120, 252, 115, 251, 145, 250, 240, 249, 152, 249, 112, 249, 123, 249, 177, 249, 1, 250, 111, 250, 25, 251, 218, 251, 174, 252, 121, 253, 38, 254, 186, 254, 40, 255, 124, 255, 182, 255, 199, 255, 142, 255, 34, 255, 123, 254, 147, 253, 149, 252, 132, 251, 104, 250, 81, 249, 64, 248, 66, 247,
-92, 246, 145, 245, 253, 244, 188, 244, 191, 244, 29, 245, 213, 245, 185, 246, 197, 247, 14, 249, 130, 250, 33, 252, 255, 253, 229, 255, 202, 1, 144, 3, 51, 5, 188, 6, 31, 8, 81, 9, 87, 10, 30, 11, 139, 11, 195, 11, 199, 11, 129, 11, 29, 11, 155, 10, 248, 9, 73, 9, 145, 8, 207, 7,
-25, 7, 113, 6, 236, 5, 168, 5, 136, 5, 142, 5, 178, 5, 228, 5, 38, 6, 148, 6, 25, 7, 177, 7, 66, 8, 180, 8, 6, 9, 34, 9, 20, 9, 228, 8, 130, 8, 216, 7, 251, 6, 228, 5, 134, 4, 12, 3, 121, 1, 207, 255, 43, 254, 143, 252, 13, 251, 168, 249, 95, 248, 67, 247,
-111, 246, 214, 245, 138, 245, 164, 245, 238, 245, 102, 246, 34, 247, 5, 248, 16, 249, 94, 250, 183, 251, 19, 253, 97, 254, 145, 255, 173, 0, 178, 1, 133, 2, 44, 3, 158, 3, 173, 3, 136, 3, 49, 3, 160, 2, 241, 1, 41, 1, 79, 0, 105, 255, 128, 254, 158, 253, 209, 252, 34, 252, 165, 251,
-122, 251, 131, 251, 196, 251, 54, 252, 195, 252, 107, 253, 71, 254, 75, 255, 107, 0, 157, 1, 188, 2, 198, 3, 173, 4, 114, 5, 28, 6, 164, 6, 229, 6, 240, 6, 194, 6, 63, 6, 149, 5, 200, 4, 212, 3, 206, 2, 187, 1, 158, 0, 132, 255, 112, 254, 104, 253, 141, 252, 219, 251, 90, 251,
-39, 251, 14, 251, 12, 251, 53, 251, 125, 251, 230, 251, 143, 252, 77, 253, 16, 254, 198, 254, 86, 255, 207, 255, 47, 0, 113, 0, 149, 0, 154, 0, 90, 0, 246, 255, 112, 255, 200, 254, 26, 254, 108, 253, 205, 252, 74, 252, 220, 251, 142, 251, 104, 251, 103, 251, 149, 251, 35, 252, 235, 252, 237, 253,
-54, 255, 148, 0, 7, 2, 163, 3, 89, 5, 34, 7, 254, 8, 187, 10, 89, 12, 195, 13, 224, 14, 201, 15, 122, 16, 177, 16, 159, 16, 66, 16, 101, 15, 77, 14, 2, 13, 115, 11, 199, 9, 7, 8, 50, 6, 93, 4, 140, 2, 196, 0, 43, 255, 192, 253, 137, 252, 187, 251, 28, 251, 169, 250,
-109, 250, 91, 250, 113, 250, 201, 250, 74, 251, 222, 251, 121, 252, 253, 252, 114, 253, 215, 253, 25, 254, 68, 254, 83, 254, 30, 254, 196, 253, 74, 253, 166, 252, 229, 251, 19, 251, 48, 250, 66, 249, 83, 248, 109, 247, 154, 246, 224, 245, 68, 245, 247, 244, 219, 244, 240, 244, 74, 245, 193, 245, 84, 246,
-30, 247, 24, 248, 52, 249, 124, 250, 187, 251, 236, 252, 9, 254, 254, 254, 227, 255, 186, 0, 94, 1, 221, 1, 53, 2, 69, 2, 50, 2, 7, 2, 195, 1, 121, 1, 45, 1, 230, 0, 169, 0, 117, 0, 77, 0, 72, 0, 103, 0, 173, 0, 66, 1, 249, 1, 202, 2, 175, 3, 164, 4, 169, 5,
-200, 6, 249, 7, 37, 9, 62, 10, 17, 11, 184, 11, 48, 12, 86, 12, 78, 12, 21, 12, 115, 11, 142, 10, 115, 9, 18, 8, 139, 6, 241, 4, 71, 3, 156, 1, 249, 255, 100, 254, 237, 252, 149, 251, 97, 250, 147, 249, 14, 249, 208, 248, 244, 248, 72, 249, 196, 249, 115, 250, 95, 251, 118, 252,
-193, 253, 39, 255, 136, 0, 219, 1, 8, 3, 31, 4, 30, 5, 240, 5, 153, 6, 26, 7, 84, 7, 91, 7, 58, 7, 227, 6, 98, 6, 203, 5, 29, 5, 101, 4, 172, 3, 242, 2, 77, 2, 195, 1, 85, 1, 47, 1, 54, 1, 93, 1, 166, 1, 7, 2, 127, 2, 24, 3, 215, 3, 156, 4,
-97, 5, 254, 5, 123, 6, 217, 6, 4, 7, 14, 7, 245, 6, 151, 6, 254, 5, 54, 5, 52, 4, 9, 3, 202, 1, 118, 0, 27, 255, 194, 253, 110, 252, 47, 251, 254, 249, 224, 248, 254, 247, 84, 247, 221, 246, 173, 246, 168, 246, 191, 246, 243, 246, 89, 247, 221, 247, 132, 248, 67, 249, 251, 249,
-165, 250, 41, 251, 155, 251, 249, 251, 48, 252, 64, 252, 40, 252, 207, 251, 71, 251, 162, 250, 227, 249, 21, 249, 70, 248, 122, 247, 190, 246, 21, 246, 128, 245, 31, 245, 243, 244, 251, 244, 100, 245, 20, 246, 244, 246, 4, 248, 54, 249, 131, 250, 247, 251, 165, 253, 104, 255, 62, 1, 252, 2, 156, 4,
-29, 6, 106, 7, 149, 8, 159, 9, 108, 10, 247, 10, 80, 11, 98, 11, 53, 11, 227, 10, 105, 10, 200, 9, 28, 9, 102, 8, 165, 7, 232, 6, 50, 6, 150, 5, 40, 5, 223, 4, 202, 4, 218, 4, 250, 4, 36, 5, 110, 5, 205, 5, 67, 6, 213, 6, 85, 7, 193, 7, 251, 7, 14, 8,
-255, 7, 199, 7, 98, 7, 213, 6, 12, 6, 12, 5, 236, 3, 167, 2, 81, 1, 247, 255, 158, 254, 97, 253, 52, 252, 25, 251, 39, 250, 91, 249, 183, 248, 98, 248, 93, 248, 142, 248, 255, 248, 157, 249, 89, 250, 58, 251, 85, 252, 138, 253, 216, 254, 38, 0, 94, 1, 127, 2, 118, 3, 72, 4,
-249, 4, 115, 5, 167, 5, 169, 5, 112, 5, 249, 4, 98, 4, 172, 3, 210, 2, 238, 1, 1, 1, 17, 0, 46, 255, 88, 254, 163, 253, 36, 253, 209, 252, 187, 252, 219, 252, 19, 253, 97, 253, 213, 253, 104, 254, 28, 255, 251, 255, 223, 0, 193, 1, 121, 2, 23, 3, 156, 3, 249, 3, 49, 4,
-70, 4, 32, 4, 189, 3, 48, 3, 117, 2, 145, 1, 152, 0, 139, 255, 119, 254, 99, 253, 83, 252, 82, 251, 108, 250, 161, 249, 8, 249, 178, 248, 134, 248, 136, 248, 176, 248, 240, 248, 74, 249, 225, 249, 147, 250, 94, 251, 51, 252, 240, 252, 151, 253, 30, 254, 138, 254, 228, 254, 41, 255, 64, 255,
-55, 255, 12, 255, 183, 254, 88, 254, 243, 253, 142, 253, 58, 253, 245, 252, 198, 252, 175, 252, 174, 252, 205, 252, 40, 253, 179, 253, 130, 254, 150, 255, 198, 0, 14, 2, 108, 3, 220, 4, 94, 6, 5, 8, 167, 9, 62, 11, 161, 12, 193, 13, 175, 14, 84, 15, 170, 15, 196, 15, 147, 15, 251, 14,
-40, 14, 29, 13, 197, 11, 78, 10, 188, 8, 17, 7, 101, 5, 185, 3, 24, 2, 143, 0, 32, 255, 222, 253, 241, 252, 54, 252, 177, 251, 106, 251, 63, 251, 45, 251, 95, 251, 187, 251, 59, 252, 225, 252, 128, 253, 21, 254, 144, 254, 241, 254, 64, 255, 123, 255, 143, 255, 133, 255, 88, 255, 246, 254,
-120, 254, 222, 253, 33, 253, 87, 252, 133, 251, 180, 250, 237, 249, 52, 249, 145, 248, 24, 248, 197, 247, 169, 247, 213, 247, 35, 248, 146, 248, 39, 249, 217, 249, 168, 250, 167, 251, 184, 252, 207, 253, 217, 254, 196, 255, 154, 0, 87, 1, 250, 1, 132, 2, 241, 2, 33, 3, 48, 3, 31, 3, 234, 2,
-162, 2, 76, 2, 242, 1, 149, 1, 57, 1, 231, 0, 160, 0, 106, 0, 83, 0, 119, 0, 195, 0, 58, 1, 211, 1, 116, 2, 31, 3, 217, 3, 166, 4, 128, 5, 101, 6, 43, 7, 207, 7, 60, 8, 103, 8, 105, 8, 61, 8, 204, 7, 44, 7, 92, 6, 63, 5, 5, 4, 175, 2, 64, 1,
-207, 255, 95, 254, 253, 252, 180, 251, 132, 250, 119, 249, 167, 248, 12, 248, 178, 247, 193, 247, 0, 248, 108, 248, 13, 249, 208, 249, 180, 250, 218, 251, 42, 253, 142, 254, 249, 255, 68, 1, 119, 2, 139, 3, 121, 4, 79, 5, 12, 6, 131, 6, 208, 6, 242, 6, 201, 6, 122, 6, 13, 6, 119, 5,
-217, 4, 53, 4, 140, 3, 236, 2, 83, 2, 197, 1, 107, 1, 54, 1, 39, 1, 82, 1, 141, 1, 216, 1, 55, 2, 177, 2, 64, 3, 232, 3, 140, 4, 33, 5, 151, 5, 221, 5, 8, 6, 23, 6, 243, 5, 171, 5, 63, 5, 141, 4, 186, 3, 202, 2, 180, 1, 145, 0, 104, 255, 59, 254,
-24, 253, 254, 251, 241, 250, 3, 250, 52, 249, 137, 248, 55, 248, 13, 248, 7, 248, 46, 248, 104, 248, 183, 248, 51, 249, 209, 249, 130, 250, 67, 251, 237, 251, 130, 252, 252, 252, 80, 253, 138, 253, 171, 253, 151, 253, 94, 253, 6, 253, 135, 252, 243, 251, 83, 251, 169, 250, 5, 250, 106, 249, 225, 248,
-126, 248, 55, 248, 16, 248, 50, 248, 135, 248, 13, 249, 218, 249, 197, 250, 200, 251, 232, 252, 44, 254, 140, 255, 18, 1, 165, 2, 43, 4, 150, 5, 204, 6, 225, 7, 212, 8, 150, 9, 50, 10, 166, 10, 202, 10, 182, 10, 120, 10, 2, 10, 100, 9, 178, 8, 240, 7, 37, 7, 90, 6, 148, 5,
-214, 4, 44, 4, 152, 3, 64, 3, 15, 3, 253, 2, 9, 3, 31, 3, 65, 3, 122, 3, 207, 3, 50, 4, 161, 4, 244, 4, 43, 5, 66, 5, 39, 5, 243, 4, 166, 4, 47, 4, 144, 3, 207, 2, 229, 1, 224, 0, 204, 255, 176, 254, 153, 253, 141, 252, 140, 251, 170, 250, 217, 249, 26, 249,
-158, 248, 84, 248, 60, 248, 129, 248, 241, 248, 128, 249, 52, 250, 5, 251, 241, 251, 9, 253, 65, 254, 124, 255, 178, 0, 184, 1, 155, 2, 93, 3, 236, 3, 84, 4, 153, 4, 165, 4, 125, 4, 47, 4, 182, 3, 19, 3, 92, 2, 148, 1, 198, 0, 254, 255, 60, 255, 144, 254, 248, 253, 118, 253,
-44, 253, 18, 253, 29, 253, 85, 253, 168, 253, 15, 254, 144, 254, 62, 255, 2, 0, 222, 0, 184, 1, 125, 2, 44, 3, 168, 3, 11, 4, 85, 4, 115, 4, 101, 4, 48, 4, 198, 3, 42, 3, 113, 2, 153, 1, 171, 0, 182, 255, 192, 254, 217, 253, 252, 252, 43, 252, 125, 251, 239, 250, 129, 250,
-86, 250, 88, 250, 117, 250, 174, 250, 1, 251, 107, 251, 243, 251, 159, 252, 79, 253, 255, 253, 148, 254, 17, 255, 118, 255, 200, 255, 4, 0, 46, 0, 59, 0, 40, 0, 0, 0, 196, 255, 129, 255, 59, 255, 244, 254, 193, 254, 152, 254, 121, 254, 127, 254, 157, 254, 213, 254, 75, 255, 248, 255, 203, 0,
-205, 1, 226, 2, 0, 4, 36, 5, 95, 6, 169, 7, 1, 9, 72, 10, 105, 11, 96, 12, 246, 12, 85, 13, 133, 13, 112, 13, 29, 13, 153, 12, 210, 11, 194, 10, 139, 9, 44, 8, 164, 6, 18, 5, 122, 3, 235, 1, 104, 0, 244, 254, 157, 253, 113, 252, 107, 251, 167, 250, 38, 250, 203, 249,
-152, 249, 142, 249, 161, 249, 214, 249, 74, 250, 211, 250, 109, 251, 255, 251, 120, 252, 222, 252, 44, 253, 104, 253, 148, 253, 165, 253, 136, 253, 75, 253, 232, 252, 88, 252, 180, 251, 255, 250, 64, 250, 138, 249, 221, 248, 64, 248, 184, 247, 67, 247, 240, 246, 211, 246, 224, 246, 39, 247, 157, 247, 42, 248,
-201, 248, 139, 249, 101, 250, 88, 251, 108, 252, 122, 253, 128, 254, 106, 255, 57, 0, 244, 0, 158, 1, 38, 2, 149, 2, 231, 2, 13, 3, 28, 3, 21, 3, 245, 2, 202, 2, 149, 2, 102, 2, 58, 2, 20, 2, 3, 2, 6, 2, 31, 2, 97, 2, 204, 2, 77, 3, 225, 3, 121, 4, 18, 5,
-174, 5, 90, 6, 9, 7, 182, 7, 63, 8, 148, 8, 188, 8, 165, 8, 95, 8, 248, 7, 107, 7, 167, 6, 194, 5, 187, 4, 138, 3, 78, 2, 7, 1, 191, 255, 136, 254, 97, 253, 95, 252, 129, 251, 195, 250, 59, 250, 240, 249, 215, 249, 2, 250, 110, 250, 249, 250, 163, 251, 124, 252, 115, 253,
-138, 254, 208, 255, 22, 1, 87, 2, 120, 3, 122, 4, 100, 5, 50, 6, 223, 6, 108, 7, 204, 7, 225, 7, 203, 7, 139, 7, 15, 7, 131, 6, 231, 5, 62, 5, 153, 4, 246, 3, 84, 3, 194, 2, 64, 2, 218, 1, 172, 1, 157, 1, 176, 1, 218, 1, 11, 2, 68, 2, 151, 2, 0, 3,
-119, 3, 238, 3, 77, 4, 147, 4, 170, 4, 158, 4, 122, 4, 55, 4, 202, 3, 61, 3, 142, 2, 168, 1, 172, 0, 155, 255, 117, 254, 77, 253, 40, 252, 14, 251, 7, 250, 16, 249, 46, 248, 123, 247, 236, 246, 139, 246, 108, 246, 103, 246, 123, 246, 172, 246, 245, 246, 88, 247, 229, 247, 133, 248,
-40, 249, 185, 249, 39, 250, 125, 250, 179, 250, 212, 250, 227, 250, 223, 250, 181, 250, 121, 250, 43, 250, 197, 249, 90, 249, 239, 248, 144, 248, 74, 248, 25, 248, 9, 248, 28, 248, 74, 248, 155, 248, 45, 249, 232, 249, 205, 250, 230, 251, 15, 253, 72, 254, 158, 255, 8, 1, 126, 2, 0, 4, 102, 5,
-178, 6, 213, 7, 198, 8, 153, 9, 79, 10, 198, 10, 17, 11, 48, 11, 2, 11, 174, 10, 58, 10, 164, 9, 248, 8, 66, 8, 137, 7, 207, 6, 24, 6, 105, 5, 203, 4, 70, 4, 223, 3, 176, 3, 147, 3, 134, 3, 136, 3, 145, 3, 163, 3, 207, 3, 8, 4, 65, 4, 111, 4, 115, 4,
-93, 4, 44, 4, 218, 3, 119, 3, 2, 3, 100, 2, 174, 1, 224, 0, 252, 255, 14, 255, 27, 254, 46, 253, 82, 252, 134, 251, 212, 250, 72, 250, 215, 249, 135, 249, 129, 249, 168, 249, 253, 249, 143, 250, 56, 251, 244, 251, 200, 252, 189, 253, 201, 254, 233, 255, 4, 1, 10, 2, 232, 2, 144, 3,
-25, 4, 133, 4, 201, 4, 236, 4, 238, 4, 181, 4, 80, 4, 202, 3, 29, 3, 92, 2, 148, 1, 206, 0, 20, 0, 99, 255, 189, 254, 46, 254, 181, 253, 84, 253, 61, 253, 72, 253, 113, 253, 190, 253, 23, 254, 127, 254, 1, 255, 155, 255, 62, 0, 230, 0, 109, 1, 219, 1, 45, 2, 81, 2,
-94, 2, 84, 2, 19, 2, 175, 1, 44, 1, 122, 0, 176, 255, 214, 254, 240, 253, 12, 253, 48, 252, 95, 251, 164, 250, 244, 249, 78, 249, 219, 248, 143, 248, 104, 248, 132, 248, 184, 248, 0, 249, 93, 249, 207, 249, 84, 250, 248, 250, 172, 251, 92, 252, 1, 253, 136, 253, 2, 254, 111, 254, 204, 254,
-30, 255, 101, 255, 144, 255, 171, 255, 186, 255, 190, 255, 188, 255, 190, 255, 201, 255, 233, 255, 30, 0, 105, 0, 211, 0, 85, 1, 240, 1, 186, 2, 163, 3, 161, 4, 175, 5, 189, 6, 204, 7, 219, 8, 233, 9, 239, 10, 228, 11, 149, 12, 19, 13, 93, 13, 83, 13, 37, 13, 210, 12, 67, 12,
-128, 11, 146, 10, 101, 9, 14, 8, 160, 6, 27, 5, 149, 3, 22, 2, 161, 0, 75, 255, 9, 254, 218, 252, 219, 251, 11, 251, 105, 250, 15, 250, 228, 249, 215, 249, 234, 249, 28, 250, 105, 250, 218, 250, 107, 251, 255, 251, 148, 252, 8, 253, 105, 253, 183, 253, 238, 253, 13, 254, 21, 254, 244, 253,
-169, 253, 67, 253, 193, 252, 41, 252, 142, 251, 241, 250, 95, 250, 219, 249, 99, 249, 0, 249, 178, 248, 123, 248, 124, 248, 172, 248, 1, 249, 130, 249, 20, 250, 177, 250, 95, 251, 42, 252, 9, 253, 252, 253, 239, 254, 208, 255, 157, 0, 68, 1, 217, 1, 95, 2, 203, 2, 29, 3, 86, 3, 108, 3,
-97, 3, 65, 3, 12, 3, 204, 2, 141, 2, 80, 2, 38, 2, 3, 2, 231, 1, 214, 1, 216, 1, 237, 1, 36, 2, 115, 2, 204, 2, 40, 3, 127, 3, 214, 3, 47, 4, 134, 4, 207, 4, 7, 5, 255, 4, 209, 4, 130, 4, 8, 4, 121, 3, 213, 2, 20, 2, 50, 1, 63, 0, 61, 255,
-45, 254, 35, 253, 37, 252, 67, 251, 125, 250, 212, 249, 91, 249, 4, 249, 205, 248, 209, 248, 20, 249, 133, 249, 46, 250, 1, 251, 233, 251, 228, 252, 255, 253, 45, 255, 110, 0, 179, 1, 227, 2, 254, 3, 235, 4, 187, 5, 114, 6, 253, 6, 93, 7, 152, 7, 157, 7, 115, 7, 44, 7, 196, 6,
-71, 6, 192, 5, 49, 5, 164, 4, 27, 4, 150, 3, 29, 3, 186, 2, 108, 2, 73, 2, 75, 2, 95, 2, 129, 2, 169, 2, 217, 2, 16, 3, 98, 3, 182, 3, 9, 4, 58, 4, 74, 4, 63, 4, 10, 4, 190, 3, 94, 3, 222, 2, 52, 2, 111, 1, 140, 0, 136, 255, 125, 254, 107, 253,
-98, 252, 106, 251, 130, 250, 180, 249, 249, 248, 82, 248, 206, 247, 121, 247, 73, 247, 75, 247, 117, 247, 176, 247, 249, 247, 91, 248, 209, 248, 89, 249, 241, 249, 124, 250, 248, 250, 80, 251, 143, 251, 190, 251, 223, 251, 240, 251, 242, 251, 222, 251, 174, 251, 114, 251, 43, 251, 227, 250, 165, 250, 117, 250,
-100, 250, 109, 250, 137, 250, 190, 250, 16, 251, 126, 251, 21, 252, 233, 252, 218, 253, 229, 254, 0, 0, 31, 1, 66, 2, 113, 3, 163, 4, 210, 5, 228, 6, 207, 7, 151, 8, 43, 9, 148, 9, 223, 9, 3, 10, 238, 9, 182, 9, 91, 9, 206, 8, 46, 8, 124, 7, 182, 6, 238, 5, 41, 5,
-106, 4, 181, 3, 8, 3, 107, 2, 237, 1, 138, 1, 74, 1, 42, 1, 19, 1, 2, 1, 245, 0, 245, 0, 1, 1, 26, 1, 44, 1, 52, 1, 29, 1, 233, 0, 165, 0, 79, 0, 233, 255, 115, 255, 236, 254, 72, 254, 155, 253, 230, 252, 45, 252, 129, 251, 226, 250, 95, 250, 253, 249, 180, 249,
-141, 249, 141, 249, 173, 249, 244, 249, 127, 250, 44, 251, 247, 251, 223, 252, 204, 253, 191, 254, 195, 255, 202, 0, 207, 1, 198, 2, 145, 3, 59, 4, 188, 4, 18, 5, 81, 5, 118, 5, 98, 5, 41, 5, 204, 4, 49, 4, 133, 3, 201, 2, 0, 2, 65, 1, 139, 0, 229, 255, 79, 255, 199, 254,
-81, 254, 2, 254, 214, 253, 213, 253, 9, 254, 80, 254, 168, 254, 9, 255, 119, 255, 242, 255, 129, 0, 18, 1, 154, 1, 6, 2, 71, 2, 108, 2, 114, 2, 85, 2, 34, 2, 215, 1, 92, 1, 204, 0, 39, 0, 103, 255, 164, 254, 225, 253, 36, 253, 124, 252, 224, 251, 86, 251, 224, 250, 126, 250,
-51, 250, 37, 250, 55, 250, 103, 250, 186, 250, 19, 251, 116, 251, 233, 251, 115, 252, 12, 253, 177, 253, 77, 254, 219, 254, 81, 255, 182, 255, 18, 0, 101, 0, 172, 0, 228, 0, 14, 1, 40, 1, 57, 1, 70, 1, 88, 1, 117, 1, 159, 1, 223, 1, 53, 2, 150, 2, 3, 3, 133, 3, 26, 4,
-195, 4, 145, 5, 99, 6, 55, 7, 248, 7, 167, 8, 73, 9, 218, 9, 79, 10, 167, 10, 206, 10, 176, 10, 104, 10, 244, 9, 76, 9, 131, 8, 155, 7, 117, 6, 52, 5, 218, 3, 98, 2, 237, 0, 123, 255, 20, 254, 206, 252, 159, 251, 140, 250, 163, 249, 217, 248, 45, 248, 205, 247, 155, 247,
-150, 247, 202, 247, 16, 248, 104, 248, 219, 248, 104, 249, 5, 250, 181, 250, 90, 251, 238, 251, 108, 252, 187, 252, 250, 252, 45, 253, 49, 253, 31, 253, 246, 252, 161, 252, 59, 252, 199, 251, 72, 251, 205, 250, 91, 250, 245, 249, 171, 249, 111, 249, 64, 249, 55, 249, 73, 249, 120, 249, 231, 249, 110, 250,
-7, 251, 175, 251, 97, 252, 30, 253, 240, 253, 213, 254, 186, 255, 151, 0, 83, 1, 246, 1, 127, 2, 237, 2, 75, 3, 150, 3, 193, 3, 211, 3, 207, 3, 177, 3, 134, 3, 88, 3, 40, 3, 3, 3, 231, 2, 213, 2, 205, 2, 201, 2, 200, 2, 227, 2, 19, 3, 85, 3, 174, 3, 1, 4,
-76, 4, 135, 4, 190, 4, 240, 4, 27, 5, 46, 5, 37, 5, 253, 4, 158, 4, 45, 4, 171, 3, 10, 3, 90, 2, 155, 1, 196, 0, 230, 255, 7, 255, 45, 254, 104, 253, 184, 252, 36, 252, 192, 251, 118, 251, 71, 251, 74, 251, 111, 251, 181, 251, 68, 252, 252, 252, 211, 253, 194, 254, 185, 255,
-184, 0, 192, 1, 208, 2, 222, 3, 227, 4, 187, 5, 115, 6, 10, 7, 106, 7, 172, 7, 210, 7, 193, 7, 138, 7, 54, 7, 190, 6, 45, 6, 144, 5, 235, 4, 69, 4, 166, 3, 18, 3, 144, 2, 24, 2, 171, 1, 98, 1, 53, 1, 33, 1, 54, 1, 81, 1, 112, 1, 148, 1, 187, 1,
-234, 1, 36, 2, 82, 2, 108, 2, 113, 2, 57, 2, 236, 1, 138, 1, 6, 1, 108, 0, 191, 255, 240, 254, 12, 254, 29, 253, 38, 252, 52, 251, 79, 250, 121, 249, 196, 248, 36, 248, 153, 247, 45, 247, 223, 246, 175, 246, 180, 246, 232, 246, 54, 247, 153, 247, 6, 248, 121, 248, 243, 248, 127, 249,
-14, 250, 159, 250, 18, 251, 113, 251, 188, 251, 228, 251, 4, 252, 25, 252, 23, 252, 0, 252, 219, 251, 166, 251, 110, 251, 56, 251, 8, 251, 249, 250, 253, 250, 21, 251, 82, 251, 161, 251, 1, 252, 135, 252, 50, 253, 0, 254, 253, 254, 15, 0, 39, 1, 62, 2, 79, 3, 94, 4, 109, 5, 115, 6,
-99, 7, 60, 8, 215, 8, 79, 9, 167, 9, 210, 9, 218, 9, 195, 9, 130, 9, 22, 9, 147, 8, 248, 7, 70, 7, 144, 6, 219, 5, 45, 5, 140, 4, 245, 3, 104, 3, 234, 2, 123, 2, 41, 2, 250, 1, 220, 1, 205, 1, 190, 1, 175, 1, 160, 1, 154, 1, 153, 1, 155, 1, 131, 1,
-83, 1, 12, 1, 165, 0, 49, 0, 179, 255, 42, 255, 146, 254, 241, 253, 73, 253, 159, 252, 252, 251, 99, 251, 230, 250, 134, 250, 65, 250, 46, 250, 58, 250, 97, 250, 178, 250, 45, 251, 201, 251, 146, 252, 120, 253, 101, 254, 82, 255, 57, 0, 29, 1, 0, 2, 217, 2, 156, 3, 70, 4, 181, 4,
-249, 4, 29, 5, 24, 5, 233, 4, 155, 4, 37, 4, 128, 3, 199, 2, 252, 1, 39, 1, 88, 0, 144, 255, 229, 254, 77, 254, 198, 253, 90, 253, 7, 253, 206, 252, 194, 252, 233, 252, 48, 253, 152, 253, 7, 254, 122, 254, 239, 254, 109, 255, 240, 255, 118, 0, 237, 0, 70, 1, 133, 1, 150, 1,
-138, 1, 103, 1, 39, 1, 194, 0, 70, 0, 177, 255, 0, 255, 74, 254, 142, 253, 215, 252, 48, 252, 153, 251, 27, 251, 174, 250, 81, 250, 10, 250, 230, 249, 223, 249, 3, 250, 80, 250, 172, 250, 19, 251, 136, 251, 7, 252, 145, 252, 55, 253, 220, 253, 125, 254, 9, 255, 127, 255, 231, 255, 65, 0,
-151, 0, 231, 0, 46, 1, 102, 1, 153, 1, 197, 1, 240, 1, 37, 2, 100, 2, 187, 2, 43, 3, 171, 3, 60, 4, 216, 4, 123, 5, 43, 6, 238, 6, 185, 7, 142, 8, 74, 9, 241, 9, 131, 10, 240, 10, 74, 11, 143, 11, 166, 11, 133, 11, 55, 11, 170, 10, 234, 9, 11, 9, 6, 8,
-214, 6, 141, 5, 43, 4, 182, 2, 64, 1, 205, 255, 111, 254, 43, 253, 0, 252, 2, 251, 42, 250, 111, 249, 222, 248, 133, 248, 87, 248, 96, 248, 168, 248, 7, 249, 125, 249, 0, 250, 139, 250, 29, 251, 192, 251, 96, 252, 247, 252, 114, 253, 197, 253, 253, 253, 22, 254, 16, 254, 244, 253, 192, 253,
-103, 253, 252, 252, 131, 252, 1, 252, 128, 251, 4, 251, 160, 250, 79, 250, 17, 250, 241, 249, 229, 249, 239, 249, 27, 250, 121, 250, 247, 250, 149, 251, 75, 252, 6, 253, 196, 253, 140, 254, 93, 255, 52, 0, 6, 1, 187, 1, 88, 2, 207, 2, 36, 3, 104, 3, 156, 3, 180, 3, 186, 3, 172, 3,
-125, 3, 65, 3, 251, 2, 177, 2, 112, 2, 55, 2, 18, 2, 249, 1, 230, 1, 218, 1, 217, 1, 230, 1, 5, 2, 66, 2, 130, 2, 194, 2, 239, 2, 16, 3, 41, 3, 56, 3, 62, 3, 52, 3, 7, 3, 178, 2, 66, 2, 178, 1, 15, 1, 96, 0, 162, 255, 214, 254, 7, 254, 53, 253,
-112, 252, 188, 251, 27, 251, 157, 250, 77, 250, 27, 250, 18, 250, 55, 250, 124, 250, 227, 250, 143, 251, 95, 252, 83, 253, 106, 254, 130, 255, 155, 0, 173, 1, 191, 2, 208, 3, 220, 4, 202, 5, 155, 6, 63, 7, 172, 7, 247, 7, 31, 8, 18, 8, 229, 7, 155, 7, 37, 7, 159, 6, 12, 6,
-107, 5, 207, 4, 58, 4, 178, 3, 65, 3, 221, 2, 135, 2, 75, 2, 36, 2, 19, 2, 47, 2, 86, 2, 133, 2, 178, 2, 215, 2, 248, 2, 26, 3, 49, 3, 57, 3, 38, 3, 225, 2, 127, 2, 1, 2, 99, 1, 184, 0, 255, 255, 37, 255, 61, 254, 73, 253, 76, 252, 87, 251, 111, 250,
-162, 249, 249, 248, 107, 248, 254, 247, 183, 247, 134, 247, 111, 247, 144, 247, 214, 247, 61, 248, 203, 248, 94, 249, 244, 249, 137, 250, 34, 251, 188, 251, 87, 252, 221, 252, 77, 253, 160, 253, 203, 253, 229, 253, 239, 253, 225, 253, 196, 253, 151, 253, 87, 253, 19, 253, 206, 252, 142, 252, 104, 252, 86, 252,
-93, 252, 139, 252, 205, 252, 36, 253, 165, 253, 64, 254, 244, 254, 227, 255, 228, 0, 240, 1, 249, 2, 245, 3, 233, 4, 211, 5, 183, 6, 140, 7, 72, 8, 207, 8, 46, 9, 99, 9, 91, 9, 54, 9, 242, 8, 128, 8, 239, 7, 71, 7, 130, 6, 175, 5, 216, 4, 0, 4, 56, 3, 127, 2,
-213, 1, 66, 1, 189, 0, 68, 0, 234, 255, 173, 255, 137, 255, 126, 255, 121, 255, 118, 255, 109, 255, 103, 255, 100, 255, 101, 255, 86, 255, 54, 255, 1, 255, 166, 254, 64, 254, 207, 253, 83, 253, 207, 252, 70, 252, 184, 251, 46, 251, 174, 250, 64, 250, 247, 249, 203, 249, 196, 249, 245, 249, 66, 250,
-172, 250, 61, 251, 230, 251, 168, 252, 156, 253, 164, 254, 186, 255, 210, 0, 218, 1, 217, 2, 203, 3, 173, 4, 122, 5, 43, 6, 148, 6, 208, 6, 223, 6, 171, 6, 84, 6, 222, 5, 59, 5, 117, 4, 156, 3, 178, 2, 199, 1, 228, 0, 15, 0, 91, 255, 189, 254, 56, 254, 219, 253, 146, 253,
-96, 253, 98, 253, 136, 253, 205, 253, 65, 254, 192, 254, 68, 255, 201, 255, 80, 0, 219, 0, 108, 1, 235, 1, 82, 2, 159, 2, 164, 2, 140, 2, 89, 2, 252, 1, 133, 1, 251, 0, 85, 0, 159, 255, 226, 254, 35, 254, 109, 253, 197, 252, 47, 252, 190, 251, 93, 251, 13, 251, 221, 250, 194, 250,
-192, 250, 248, 250, 80, 251, 192, 251, 76, 252, 219, 252, 112, 253, 17, 254, 191, 254, 109, 255, 26, 0, 170, 0, 35, 1, 135, 1, 208, 1, 15, 2, 69, 2, 110, 2, 142, 2, 168, 2, 188, 2, 213, 2, 244, 2, 27, 3, 93, 3, 175, 3, 15, 4, 130, 4, 250, 4, 118, 5, 247, 5, 136, 6,
-36, 7, 200, 7, 101, 8, 240, 8, 92, 9, 166, 9, 216, 9, 242, 9, 215, 9, 144, 9, 27, 9, 81, 8, 96, 7, 76, 6, 14, 5, 182, 3, 76, 2, 206, 0, 74, 255, 203, 253, 87, 252, 6, 251, 207, 249, 182, 248, 224, 247, 43, 247, 153, 246, 63, 246, 15, 246, 7, 246, 65, 246, 177, 246,
-64, 247, 238, 247, 168, 248, 104, 249, 46, 250, 252, 250, 199, 251, 141, 252, 36, 253, 149, 253, 230, 253, 6, 254, 10, 254, 247, 253, 202, 253, 129, 253, 43, 253, 199, 252, 92, 252, 245, 251, 149, 251, 78, 251, 27, 251, 253, 250, 2, 251, 28, 251, 74, 251, 155, 251, 19, 252, 170, 252, 102, 253, 56, 254,
-14, 255, 226, 255, 177, 0, 129, 1, 83, 2, 19, 3, 188, 3, 76, 4, 165, 4, 221, 4, 253, 4, 253, 4, 231, 4, 190, 4, 122, 4, 34, 4, 191, 3, 83, 3, 234, 2, 138, 2, 53, 2, 253, 1, 209, 1, 177, 1, 163, 1, 160, 1, 172, 1, 214, 1, 29, 2, 112, 2, 206, 2, 25, 3,
-90, 3, 142, 3, 177, 3, 201, 3, 211, 3, 175, 3, 104, 3, 3, 3, 119, 2, 211, 1, 35, 1, 103, 0, 158, 255, 209, 254, 3, 254, 69, 253, 152, 252, 253, 251, 147, 251, 77, 251, 42, 251, 62, 251, 119, 251, 205, 251, 80, 252, 5, 253, 222, 253, 227, 254, 5, 0, 45, 1, 86, 2, 113, 3,
-134, 4, 149, 5, 141, 6, 99, 7, 23, 8, 139, 8, 198, 8, 220, 8, 199, 8, 127, 8, 26, 8, 151, 7, 239, 6, 58, 6, 120, 5, 178, 4, 242, 3, 58, 3, 154, 2, 17, 2, 153, 1, 54, 1, 235, 0, 181, 0, 154, 0, 166, 0, 193, 0, 229, 0, 2, 1, 25, 1, 43, 1, 52, 1,
-58, 1, 53, 1, 10, 1, 185, 0, 73, 0, 174, 255, 251, 254, 58, 254, 102, 253, 133, 252, 157, 251, 173, 250, 203, 249, 245, 248, 43, 248, 143, 247, 19, 247, 183, 246, 140, 246, 131, 246, 149, 246, 203, 246, 50, 247, 185, 247, 103, 248, 55, 249, 11, 250, 226, 250, 175, 251, 121, 252, 62, 253, 249, 253,
-153, 254, 32, 255, 120, 255, 166, 255, 184, 255, 173, 255, 137, 255, 84, 255, 11, 255, 175, 254, 80, 254, 241, 253, 159, 253, 100, 253, 61, 253, 62, 253, 99, 253, 163, 253, 255, 253, 123, 254, 16, 255, 200, 255, 174, 0, 168, 1, 181, 2, 191, 3, 191, 4, 181, 5, 159, 6, 123, 7, 71, 8, 235, 8,
-89, 9, 156, 9, 166, 9, 122, 9, 46, 9, 191, 8, 33, 8, 108, 7, 162, 6, 193, 5, 219, 4, 243, 3, 20, 3, 71, 2, 138, 1, 234, 0, 98, 0, 237, 255, 140, 255, 81, 255, 47, 255, 43, 255, 66, 255, 92, 255, 120, 255, 143, 255, 166, 255, 190, 255, 214, 255, 221, 255, 209, 255, 163, 255,
-81, 255, 238, 254, 123, 254, 252, 253, 120, 253, 238, 252, 104, 252, 232, 251, 113, 251, 27, 251, 222, 250, 187, 250, 204, 250, 4, 251, 90, 251, 214, 251, 111, 252, 35, 253, 248, 253, 242, 254, 254, 255, 27, 1, 38, 2, 34, 3, 14, 4, 221, 4, 149, 5, 54, 6, 164, 6, 206, 6, 201, 6, 137, 6,
-18, 6, 122, 5, 193, 4, 224, 3, 235, 2, 226, 1, 209, 0, 197, 255, 194, 254, 222, 253, 28, 253, 118, 252, 250, 251, 164, 251, 105, 251, 77, 251, 105, 251, 170, 251, 16, 252, 167, 252, 72, 253, 240, 253, 148, 254, 53, 255, 213, 255, 113, 0, 242, 0, 90, 1, 153, 1, 159, 1, 133, 1, 74, 1,
-233, 0, 114, 0, 230, 255, 64, 255, 145, 254, 220, 253, 40, 253, 128, 252, 231, 251, 107, 251, 16, 251, 205, 250, 169, 250, 169, 250, 195, 250, 254, 250, 116, 251, 3, 252, 168, 252, 94, 253, 19, 254, 200, 254, 133, 255, 67, 0, 254, 0, 173, 1, 55, 2, 168, 2, 252, 2, 49, 3, 90, 3, 119, 3,
-130, 3, 133, 3, 129, 3, 119, 3, 115, 3, 115, 3, 125, 3, 161, 3, 214, 3, 31, 4, 134, 4, 247, 4, 114, 5, 2, 6, 160, 6, 77, 7, 254, 7, 160, 8, 47, 9, 149, 9, 219, 9, 8, 10, 17, 10, 225, 9, 135, 9, 246, 8, 24, 8, 26, 7, 252, 5, 181, 4, 90, 3, 238, 1,
-115, 0, 246, 254, 124, 253, 28, 252, 218, 250, 182, 249, 197, 248, 12, 248, 122, 247, 21, 247, 234, 246, 233, 246, 18, 247, 138, 247, 38, 248, 225, 248, 179, 249, 132, 250, 85, 251, 39, 252, 243, 252, 181, 253, 102, 254, 225, 254, 59, 255, 111, 255, 112, 255, 90, 255, 46, 255, 224, 254, 127, 254, 16, 254,
-145, 253, 19, 253, 153, 252, 43, 252, 219, 251, 162, 251, 135, 251, 148, 251, 183, 251, 241, 251, 90, 252, 224, 252, 129, 253, 71, 254, 14, 255, 213, 255, 147, 0, 73, 1, 251, 1, 170, 2, 63, 3, 186, 3, 20, 4, 47, 4, 45, 4, 14, 4, 205, 3, 119, 3, 16, 3, 151, 2, 15, 2, 128, 1,
-243, 0, 110, 0, 247, 255, 152, 255, 92, 255, 55, 255, 45, 255, 59, 255, 96, 255, 155, 255, 249, 255, 107, 0, 233, 0, 99, 1, 206, 1, 46, 2, 124, 2, 185, 2, 230, 2, 250, 2, 214, 2, 145, 2, 43, 2, 151, 1, 243, 0, 63, 0, 117, 255, 162, 254, 204, 253, 251, 252, 58, 252, 141, 251,
-255, 250, 165, 250, 112, 250, 101, 250, 155, 250, 242, 250, 106, 251, 31, 252, 252, 252, 252, 253, 42, 255, 98, 0, 157, 1, 211, 2, 250, 3, 23, 5, 41, 6, 20, 7, 221, 7, 127, 8, 209, 8, 251, 8, 253, 8, 200, 8, 110, 8, 247, 7, 89, 7, 163, 6, 225, 5, 23, 5, 82, 4, 151, 3,
-236, 2, 99, 2, 237, 1, 137, 1, 73, 1, 28, 1, 3, 1, 22, 1, 57, 1, 101, 1, 149, 1, 181, 1, 202, 1, 213, 1, 222, 1, 217, 1, 193, 1, 121, 1, 15, 1, 129, 0, 199, 255, 255, 254, 41, 254, 67, 253, 89, 252, 109, 251, 129, 250, 168, 249, 222, 248, 42, 248, 169, 247, 77, 247,
-22, 247, 30, 247, 69, 247, 138, 247, 1, 248, 158, 248, 89, 249, 56, 250, 34, 251, 11, 252, 235, 252, 191, 253, 139, 254, 79, 255, 242, 255, 118, 0, 218, 0, 250, 0, 249, 0, 220, 0, 154, 0, 66, 0, 218, 255, 93, 255, 217, 254, 86, 254, 217, 253, 116, 253, 40, 253, 247, 252, 254, 252, 33, 253,
-95, 253, 203, 253, 84, 254, 250, 254, 212, 255, 203, 0, 211, 1, 231, 2, 238, 3, 235, 4, 218, 5, 184, 6, 128, 7, 47, 8, 152, 8, 209, 8, 221, 8, 164, 8, 68, 8, 194, 7, 20, 7, 70, 6, 101, 5, 110, 4, 114, 3, 119, 2, 128, 1, 163, 0, 218, 255, 39, 255, 155, 254, 39, 254,
-203, 253, 147, 253, 130, 253, 139, 253, 178, 253, 229, 253, 24, 254, 70, 254, 116, 254, 161, 254, 207, 254, 238, 254, 247, 254, 231, 254, 167, 254, 82, 254, 236, 253, 121, 253, 0, 253, 134, 252, 12, 252, 153, 251, 50, 251, 220, 250, 169, 250, 147, 250, 153, 250, 224, 250, 74, 251, 211, 251, 132, 252, 87, 253,
-70, 254, 88, 255, 133, 0, 184, 1, 230, 2, 250, 3, 250, 4, 228, 5, 170, 6, 83, 7, 221, 7, 16, 8, 13, 8, 217, 7, 96, 7, 191, 6, 0, 6, 29, 5, 29, 4, 13, 3, 238, 1, 213, 0, 197, 255, 189, 254, 235, 253, 55, 253, 162, 252, 70, 252, 11, 252, 237, 251, 1, 252, 72, 252,
-178, 252, 66, 253, 234, 253, 147, 254, 56, 255, 212, 255, 106, 0, 249, 0, 108, 1, 193, 1, 248, 1, 243, 1, 200, 1, 129, 1, 23, 1, 143, 0, 244, 255, 68, 255, 136, 254, 201, 253, 11, 253, 95, 252, 199, 251, 67, 251, 238, 250, 185, 250, 161, 250, 178, 250, 236, 250, 70, 251, 206, 251, 126, 252,
-62, 253, 11, 254, 212, 254, 156, 255, 101, 0, 43, 1, 234, 1, 159, 2, 39, 3, 142, 3, 217, 3, 253, 3, 11, 4, 9, 4, 245, 3, 208, 3, 165, 3, 116, 3, 66, 3, 23, 3, 248, 2, 240, 2, 2, 3, 43, 3, 114, 3, 208, 3, 63, 4, 191, 4, 91, 5, 0, 6, 171, 6, 71, 7,
-203, 7, 49, 8, 111, 8, 146, 8, 152, 8, 106, 8, 4, 8, 112, 7, 147, 6, 134, 5, 91, 4, 14, 3, 166, 1, 49, 0, 175, 254, 42, 253, 175, 251, 61, 250, 248, 248, 214, 247, 215, 246, 33, 246, 157, 245, 66, 245, 35, 245, 63, 245, 136, 245, 15, 246, 206, 246, 165, 247, 146, 248, 128, 249,
-109, 250, 87, 251, 60, 252, 18, 253, 215, 253, 114, 254, 224, 254, 45, 255, 81, 255, 80, 255, 57, 255, 7, 255, 189, 254, 101, 254, 0, 254, 160, 253, 67, 253, 238, 252, 187, 252, 164, 252, 165, 252, 203, 252, 17, 253, 110, 253, 232, 253, 142, 254, 72, 255, 23, 0, 236, 0, 183, 1, 117, 2, 36, 3,
-201, 3, 97, 4, 225, 4, 57, 5, 109, 5, 108, 5, 57, 5, 233, 4, 122, 4, 237, 3, 79, 3, 161, 2, 236, 1, 55, 1, 129, 0, 228, 255, 89, 255, 227, 254, 154, 254, 116, 254, 104, 254, 125, 254, 185, 254, 13, 255, 125, 255, 15, 0, 164, 0, 55, 1, 185, 1, 48, 2, 157, 2, 248, 2,
-59, 3, 101, 3, 91, 3, 28, 3, 187, 2, 52, 2, 142, 1, 217, 0, 18, 0, 62, 255, 106, 254, 151, 253, 218, 252, 52, 252, 168, 251, 80, 251, 42, 251, 43, 251, 96, 251, 200, 251, 84, 252, 12, 253, 5, 254, 30, 255, 86, 0, 158, 1, 220, 2, 18, 4, 53, 5, 70, 6, 71, 7, 41, 8,
-215, 8, 89, 9, 155, 9, 156, 9, 119, 9, 39, 9, 164, 8, 6, 8, 76, 7, 119, 6, 152, 5, 180, 4, 217, 3, 13, 3, 80, 2, 178, 1, 45, 1, 187, 0, 96, 0, 40, 0, 8, 0, 4, 0, 34, 0, 65, 0, 98, 0, 115, 0, 119, 0, 112, 0, 99, 0, 64, 0, 8, 0, 174, 255,
-34, 255, 121, 254, 179, 253, 211, 252, 235, 251, 252, 250, 13, 250, 36, 249, 66, 248, 127, 247, 212, 246, 66, 246, 225, 245, 180, 245, 176, 245, 223, 245, 65, 246, 198, 246, 116, 247, 89, 248, 88, 249, 111, 250, 142, 251, 163, 252, 175, 253, 171, 254, 152, 255, 115, 0, 49, 1, 185, 1, 25, 2, 68, 2,
-59, 2, 22, 2, 211, 1, 111, 1, 250, 0, 116, 0, 231, 255, 93, 255, 217, 254, 105, 254, 26, 254, 229, 253, 217, 253, 251, 253, 59, 254, 153, 254, 46, 255, 226, 255, 180, 0, 181, 1, 186, 2, 190, 3, 180, 4, 157, 5, 120, 6, 63, 7, 227, 7, 99, 8, 172, 8, 175, 8, 135, 8, 50, 8,
-169, 7, 2, 7, 63, 6, 85, 5, 94, 4, 91, 3, 86, 2, 90, 1, 107, 0, 152, 255, 227, 254, 72, 254, 206, 253, 119, 253, 62, 253, 37, 253, 69, 253, 126, 253, 205, 253, 37, 254, 120, 254, 197, 254, 11, 255, 77, 255, 137, 255, 184, 255, 194, 255, 176, 255, 127, 255, 40, 255, 197, 254, 87, 254,
-223, 253, 103, 253, 239, 252, 131, 252, 41, 252, 223, 251, 180, 251, 178, 251, 209, 251, 27, 252, 154, 252, 52, 253, 237, 253, 214, 254, 217, 255, 246, 0, 39, 2, 82, 3, 114, 4, 108, 5, 74, 6, 18, 7, 182, 7, 42, 8, 111, 8, 119, 8, 41, 8, 173, 7, 4, 7, 31, 6, 32, 5, 7, 4,
-209, 2, 146, 1, 79, 0, 20, 255, 234, 253, 214, 252, 232, 251, 43, 251, 147, 250, 38, 250, 240, 249, 225, 249, 248, 249, 82, 250, 204, 250, 96, 251, 5, 252, 167, 252, 72, 253, 225, 253, 116, 254, 249, 254, 103, 255, 170, 255, 204, 255, 199, 255, 153, 255, 83, 255, 244, 254, 123, 254, 240, 253, 87, 253,
-187, 252, 34, 252, 148, 251, 27, 251, 196, 250, 136, 250, 112, 250, 133, 250, 183, 250, 7, 251, 140, 251, 55, 252, 1, 253, 238, 253, 224, 254, 210, 255, 185, 0, 150, 1, 110, 2, 62, 3, 244, 3, 145, 4, 13, 5, 80, 5, 118, 5, 128, 5, 101, 5, 54, 5, 247, 4, 168, 4, 82, 4, 250, 3,
-171, 3, 107, 3, 60, 3, 37, 3, 52, 3, 89, 3, 146, 3, 239, 3, 94, 4, 223, 4, 130, 5, 42, 6, 209, 6, 101, 7, 214, 7, 47, 8, 104, 8, 124, 8, 112, 8, 60, 8, 182, 7, 2, 7, 33, 6, 251, 4, 191, 3, 109, 2, 250, 0, 129, 255, 7, 254, 144, 252, 48, 251, 229, 249,
-188, 248, 206, 247, 11, 247, 121, 246, 47, 246, 16, 246, 28, 246, 115, 246, 252, 246, 174, 247, 148, 248, 136, 249, 132, 250, 132, 251, 124, 252, 113, 253, 95, 254, 43, 255, 217, 255, 103, 0, 179, 0, 225, 0, 245, 0, 221, 0, 173, 0, 104, 0, 11, 0, 166, 255, 62, 255, 215, 254, 130, 254, 63, 254,
-16, 254, 6, 254, 18, 254, 52, 254, 118, 254, 211, 254, 73, 255, 230, 255, 148, 0, 72, 1, 242, 1, 139, 2, 24, 3, 147, 3, 248, 3, 68, 4, 116, 4, 98, 4, 41, 4, 203, 3, 59, 3, 149, 2, 219, 1, 9, 1, 47, 0, 82, 255, 119, 254, 175, 253, 246, 252, 84, 252, 225, 251, 139, 251,
-84, 251, 82, 251, 111, 251, 170, 251, 26, 252, 174, 252, 93, 253, 35, 254, 231, 254, 162, 255, 78, 0, 237, 0, 128, 1, 3, 2, 88, 2, 137, 2, 146, 2, 85, 2, 249, 1, 131, 1, 237, 0, 69, 0, 147, 255, 217, 254, 39, 254, 125, 253, 224, 252, 110, 252, 24, 252, 226, 251, 247, 251, 44, 252,
-130, 252, 22, 253, 210, 253, 178, 254, 203, 255, 252, 0, 56, 2, 119, 3, 164, 4, 196, 5, 214, 6, 204, 7, 164, 8, 90, 9, 194, 9, 248, 9, 254, 9, 200, 9, 103, 9, 230, 8, 60, 8, 116, 7, 157, 6, 183, 5, 207, 4, 237, 3, 21, 3, 92, 2, 184, 1, 42, 1, 187, 0, 100, 0,
-34, 0, 8, 0, 15, 0, 41, 0, 84, 0, 121, 0, 151, 0, 167, 0, 168, 0, 156, 0, 131, 0, 63, 0, 222, 255, 94, 255, 175, 254, 237, 253, 27, 253, 53, 252, 76, 251, 98, 250, 121, 249, 170, 248, 237, 247, 69, 247, 215, 246, 140, 246, 100, 246, 131, 246, 200, 246, 48, 247, 208, 247, 158, 248,
-144, 249, 176, 250, 224, 251, 20, 253, 66, 254, 89, 255, 99, 0, 97, 1, 56, 2, 240, 2, 133, 3, 202, 3, 226, 3, 211, 3, 144, 3, 43, 3, 174, 2, 19, 2, 102, 1, 179, 0, 250, 255, 80, 255, 181, 254, 45, 254, 217, 253, 164, 253, 140, 253, 167, 253, 226, 253, 60, 254, 202, 254, 128, 255,
-75, 0, 41, 1, 3, 2, 213, 2, 154, 3, 81, 4, 247, 4, 138, 5, 230, 5, 22, 6, 30, 6, 229, 5, 134, 5, 11, 5, 106, 4, 172, 3, 221, 2, 253, 1, 21, 1, 49, 0, 82, 255, 147, 254, 236, 253, 95, 253, 1, 253, 191, 252, 150, 252, 150, 252, 190, 252, 3, 253, 110, 253, 237, 253,
-110, 254, 236, 254, 95, 255, 201, 255, 43, 0, 123, 0, 177, 0, 207, 0, 189, 0, 142, 0, 74, 0, 235, 255, 123, 255, 1, 255, 128, 254, 2, 254, 142, 253, 40, 253, 226, 252, 185, 252, 175, 252, 220, 252, 47, 253, 163, 253, 64, 254, 0, 255, 220, 255, 222, 0, 251, 1, 32, 3, 70, 4, 82, 5,
-75, 6, 47, 7, 235, 7, 135, 8, 0, 9, 42, 9, 21, 9, 202, 8, 56, 8, 112, 7, 133, 6, 116, 5, 60, 4, 246, 2, 166, 1, 87, 0, 18, 255, 221, 253, 212, 252, 237, 251, 40, 251, 153, 250, 52, 250, 242, 249, 229, 249, 17, 250, 97, 250, 217, 250, 111, 251, 11, 252, 168, 252, 70, 253,
-227, 253, 125, 254, 1, 255, 108, 255, 188, 255, 212, 255, 203, 255, 169, 255, 103, 255, 13, 255, 165, 254, 43, 254, 167, 253, 35, 253, 162, 252, 55, 252, 227, 251, 168, 251, 155, 251, 174, 251, 221, 251, 45, 252, 163, 252, 52, 253, 232, 253, 194, 254, 167, 255, 145, 0, 112, 1, 70, 2, 16, 3, 204, 3,
-113, 4, 255, 4, 94, 5, 142, 5, 156, 5, 125, 5, 60, 5, 229, 4, 118, 4, 243, 3, 107, 3, 223, 2, 94, 2, 234, 1, 134, 1, 72, 1, 41, 1, 35, 1, 65, 1, 125, 1, 207, 1, 61, 2, 210, 2, 120, 3, 45, 4, 223, 4, 129, 5, 17, 6, 124, 6, 207, 6, 7, 7, 5, 7,
-204, 6, 100, 6, 184, 5, 215, 4, 213, 3, 175, 2, 102, 1, 15, 0, 173, 254, 73, 253, 241, 251, 169, 250, 134, 249, 136, 248, 173, 247, 16, 247, 165, 246, 99, 246, 89, 246, 142, 246, 240, 246, 136, 247, 89, 248, 60, 249, 48, 250, 44, 251, 41, 252, 37, 253, 27, 254, 253, 254, 200, 255, 98, 0,
-205, 0, 23, 1, 58, 1, 56, 1, 32, 1, 243, 0, 167, 0, 82, 0, 246, 255, 151, 255, 67, 255, 251, 254, 208, 254, 192, 254, 196, 254, 228, 254, 31, 255, 110, 255, 213, 255, 99, 0, 1, 1, 173, 1, 84, 2, 237, 2, 121, 3, 232, 3, 70, 4, 144, 4, 172, 4, 152, 4, 93, 4, 237, 3,
-85, 3, 166, 2, 221, 1, 253, 0, 21, 0, 40, 255, 58, 254, 90, 253, 137, 252, 220, 251, 85, 251, 239, 250, 188, 250, 181, 250, 207, 250, 15, 251, 129, 251, 21, 252, 208, 252, 173, 253, 143, 254, 118, 255, 74, 0, 18, 1, 207, 1, 117, 2, 248, 2, 92, 3, 139, 3, 130, 3, 87, 3, 5, 3,
-140, 2, 254, 1, 92, 1, 168, 0, 244, 255, 66, 255, 161, 254, 23, 254, 164, 253, 93, 253, 67, 253, 76, 253, 128, 253, 231, 253, 112, 254, 34, 255, 10, 0, 9, 1, 24, 2, 44, 3, 56, 4, 61, 5, 52, 6, 28, 7, 241, 7, 154, 8, 7, 9, 72, 9, 78, 9, 29, 9, 202, 8, 84, 8,
-176, 7, 247, 6, 41, 6, 74, 5, 104, 4, 135, 3, 183, 2, 251, 1, 83, 1, 203, 0, 95, 0, 9, 0, 204, 255, 181, 255, 182, 255, 208, 255, 0, 0, 44, 0, 81, 0, 104, 0, 116, 0, 117, 0, 98, 0, 47, 0, 223, 255, 98, 255, 189, 254, 1, 254, 44, 253, 73, 252, 92, 251, 101, 250,
-116, 249, 142, 248, 180, 247, 253, 246, 111, 246, 5, 246, 213, 245, 224, 245, 19, 246, 115, 246, 11, 247, 199, 247, 170, 248, 201, 249, 251, 250, 61, 252, 125, 253, 177, 254, 217, 255, 240, 0, 233, 1, 202, 2, 126, 3, 239, 3, 54, 4, 76, 4, 36, 4, 221, 3, 123, 3, 231, 2, 69, 2, 151, 1,
-219, 0, 40, 0, 126, 255, 234, 254, 122, 254, 36, 254, 245, 253, 239, 253, 5, 254, 61, 254, 164, 254, 42, 255, 205, 255, 134, 0, 65, 1, 250, 1, 169, 2, 79, 3, 236, 3, 121, 4, 222, 4, 33, 5, 52, 5, 14, 5, 200, 4, 98, 4, 213, 3, 51, 3, 124, 2, 183, 1, 238, 0, 36, 0,
-104, 255, 193, 254, 48, 254, 195, 253, 126, 253, 83, 253, 67, 253, 99, 253, 155, 253, 235, 253, 111, 254, 251, 254, 141, 255, 29, 0, 164, 0, 36, 1, 154, 1, 255, 1, 79, 2, 124, 2, 118, 2, 83, 2, 13, 2, 167, 1, 51, 1, 175, 0, 25, 0, 130, 255, 234, 254, 95, 254, 233, 253, 138, 253,
-84, 253, 79, 253, 108, 253, 179, 253, 40, 254, 183, 254, 99, 255, 67, 0, 57, 1, 69, 2, 95, 3, 110, 4, 115, 5, 97, 6, 56, 7, 246, 7, 140, 8, 219, 8, 245, 8, 208, 8, 87, 8, 179, 7, 231, 6, 222, 5, 189, 4, 132, 3, 50, 2, 223, 0, 141, 255, 70, 254, 31, 253, 16, 252,
-36, 251, 108, 250, 211, 249, 91, 249, 32, 249, 10, 249, 26, 249, 105, 249, 206, 249, 68, 250, 197, 250, 73, 251, 207, 251, 88, 252, 217, 252, 74, 253, 163, 253, 205, 253, 222, 253, 210, 253, 161, 253, 98, 253, 21, 253, 180, 252, 81, 252, 239, 251, 144, 251, 70, 251, 11, 251, 233, 250, 243, 250, 25, 251,
-92, 251, 205, 251, 86, 252, 247, 252, 199, 253, 171, 254, 158, 255, 155, 0, 142, 1, 119, 2, 79, 3, 26, 4, 210, 4, 111, 5, 214, 5, 22, 6, 42, 6, 5, 6, 198, 5, 108, 5, 242, 4, 101, 4, 203, 3, 42, 3, 136, 2, 238, 1, 105, 1, 3, 1, 184, 0, 146, 0, 153, 0, 186, 0,
-245, 0, 91, 1, 222, 1, 123, 2, 58, 3, 251, 3, 188, 4, 109, 5, 7, 6, 145, 6, 2, 7, 68, 7, 94, 7, 71, 7, 221, 6, 74, 6, 142, 5, 159, 4, 147, 3, 111, 2, 53, 1, 237, 255, 161, 254, 96, 253, 50, 252, 27, 251, 41, 250, 108, 249, 212, 248, 100, 248, 50, 248, 41, 248,
-74, 248, 179, 248, 72, 249, 253, 249, 210, 250, 173, 251, 141, 252, 115, 253, 86, 254, 51, 255, 5, 0, 174, 0, 55, 1, 159, 1, 208, 1, 231, 1, 230, 1, 192, 1, 136, 1, 65, 1, 234, 0, 146, 0, 58, 0, 232, 255, 173, 255, 132, 255, 112, 255, 131, 255, 167, 255, 220, 255, 50, 0, 159, 0,
-31, 1, 178, 1, 68, 2, 207, 2, 74, 3, 173, 3, 0, 4, 64, 4, 83, 4, 68, 4, 17, 4, 146, 3, 247, 2, 64, 2, 95, 1, 110, 0, 111, 255, 96, 254, 82, 253, 73, 252, 77, 251, 111, 250, 172, 249, 11, 249, 173, 248, 117, 248, 100, 248, 146, 248, 230, 248, 94, 249, 11, 250, 220, 250,
-193, 251, 179, 252, 164, 253, 143, 254, 113, 255, 69, 0, 6, 1, 177, 1, 30, 2, 101, 2, 134, 2, 112, 2, 61, 2, 240, 1, 131, 1, 0, 1, 113, 0, 216, 255, 67, 255, 184, 254, 64, 254, 237, 253, 185, 253, 164, 253, 197, 253, 4, 254, 98, 254, 242, 254, 172, 255, 135, 0, 128, 1, 136, 2,
-146, 3, 148, 4, 141, 5, 125, 6, 97, 7, 30, 8, 183, 8, 44, 9, 79, 9, 74, 9, 33, 9, 196, 8, 68, 8, 170, 7, 241, 6, 34, 6, 76, 5, 114, 4, 155, 3, 212, 2, 36, 2, 144, 1, 21, 1, 179, 0, 108, 0, 67, 0, 49, 0, 63, 0, 101, 0, 149, 0, 197, 0, 235, 0,
-10, 1, 31, 1, 35, 1, 24, 1, 250, 0, 165, 0, 46, 0, 152, 255, 216, 254, 7, 254, 38, 253, 55, 252, 66, 251, 77, 250, 94, 249, 132, 248, 192, 247, 24, 247, 173, 246, 111, 246, 92, 246, 144, 246, 237, 246, 111, 247, 40, 248, 15, 249, 20, 250, 62, 251, 114, 252, 169, 253, 223, 254, 4, 0,
-30, 1, 45, 2, 9, 3, 189, 3, 73, 4, 140, 4, 160, 4, 143, 4, 80, 4, 231, 3, 102, 3, 200, 2, 21, 2, 93, 1, 162, 0, 246, 255, 89, 255, 206, 254, 112, 254, 42, 254, 251, 253, 245, 253, 17, 254, 72, 254, 169, 254, 40, 255, 179, 255, 70, 0, 209, 0, 88, 1, 218, 1, 79, 2,
-177, 2, 255, 2, 26, 3, 15, 3, 226, 2, 133, 2, 13, 2, 129, 1, 218, 0, 36, 0, 106, 255, 170, 254, 245, 253, 78, 253, 182, 252, 71, 252, 247, 251, 197, 251, 195, 251, 225, 251, 27, 252, 128, 252, 11, 253, 173, 253, 106, 254, 41, 255, 230, 255, 158, 0, 71, 1, 233, 1, 131, 2, 248, 2,
-74, 3, 121, 3, 112, 3, 68, 3, 253, 2, 155, 2, 37, 2, 163, 1, 20, 1, 131, 0, 245, 255, 111, 255, 5, 255, 181, 254, 129, 254, 137, 254, 178, 254, 251, 254, 115, 255, 14, 0, 197, 0, 167, 1, 160, 2, 162, 3, 172, 4, 168, 5, 151, 6, 121, 7, 51, 8, 198, 8, 51, 9, 80, 9,
-48, 9, 223, 8, 81, 8, 145, 7, 178, 6, 172, 5, 132, 4, 76, 3, 7, 2, 189, 0, 125, 255, 72, 254, 53, 253, 64, 252, 104, 251, 189, 250, 54, 250, 207, 249, 151, 249, 149, 249, 180, 249, 245, 249, 79, 250, 176, 250, 21, 251, 129, 251, 238, 251, 91, 252, 181, 252, 248, 252, 37, 253, 42, 253,
-25, 253, 245, 252, 186, 252, 114, 252, 34, 252, 201, 251, 119, 251, 44, 251, 231, 250, 197, 250, 184, 250, 196, 250, 3, 251, 96, 251, 215, 251, 116, 252, 49, 253, 6, 254, 253, 254, 2, 0, 10, 1, 17, 2, 255, 2, 227, 3, 186, 4, 116, 5, 16, 6, 138, 6, 196, 6, 198, 6, 160, 6, 72, 6,
-204, 5, 55, 5, 134, 4, 197, 3, 249, 2, 35, 2, 89, 1, 157, 0, 238, 255, 105, 255, 10, 255, 203, 254, 186, 254, 210, 254, 9, 255, 101, 255, 240, 255, 144, 0, 67, 1, 250, 1, 172, 2, 85, 3, 232, 3, 112, 4, 232, 4, 45, 5, 68, 5, 49, 5, 222, 4, 90, 4, 182, 3, 238, 2,
-3, 2, 6, 1, 244, 255, 218, 254, 193, 253, 170, 252, 178, 251, 212, 250, 17, 250, 132, 249, 31, 249, 220, 248, 202, 248, 240, 248, 61, 249, 186, 249, 108, 250, 47, 251, 0, 252, 220, 252, 183, 253, 147, 254, 111, 255, 58, 0, 243, 0, 138, 1, 247, 1, 70, 2, 116, 2, 126, 2, 113, 2, 77, 2,
-15, 2, 199, 1, 117, 1, 31, 1, 209, 0, 139, 0, 93, 0, 70, 0, 67, 0, 92, 0, 140, 0, 206, 0, 41, 1, 156, 1, 27, 2, 163, 2, 29, 3, 139, 3, 235, 3, 49, 4, 103, 4, 137, 4, 124, 4, 63, 4, 219, 3, 66, 3, 124, 2, 159, 1, 167, 0, 154, 255, 130, 254, 98, 253,
-73, 252, 57, 251, 54, 250, 86, 249, 156, 248, 5, 248, 169, 247, 132, 247, 135, 247, 190, 247, 46, 248, 196, 248, 134, 249, 112, 250, 101, 251, 98, 252, 94, 253, 87, 254, 74, 255, 50, 0, 0, 1, 180, 1, 56, 2, 133, 2, 177, 2, 181, 2, 142, 2, 80, 2, 252, 1, 136, 1, 13, 1, 139, 0,
-14, 0, 157, 255, 60, 255, 253, 254, 224, 254, 221, 254, 1, 255, 73, 255, 176, 255, 59, 0, 244, 0, 196, 1, 171, 2, 153, 3, 131, 4, 102, 5, 61, 6, 4, 7, 186, 7, 78, 8, 170, 8, 223, 8, 222, 8, 165, 8, 76, 8, 209, 7, 42, 7, 111, 6, 161, 5, 192, 4, 219, 3, 245, 2,
-28, 2, 86, 1, 164, 0, 18, 0, 159, 255, 67, 255, 4, 255, 233, 254, 234, 254, 6, 255, 57, 255, 116, 255, 178, 255, 228, 255, 19, 0, 61, 0, 92, 0, 100, 0, 84, 0, 32, 0, 182, 255, 50, 255, 147, 254, 212, 253, 10, 253, 54, 252, 88, 251, 128, 250, 174, 249, 238, 248, 74, 248, 190, 247,
-94, 247, 51, 247, 47, 247, 89, 247, 191, 247, 72, 248, 246, 248, 227, 249, 233, 250, 4, 252, 40, 253, 76, 254, 108, 255, 126, 0, 132, 1, 120, 2, 71, 3, 227, 3, 86, 4, 149, 4, 155, 4, 128, 4, 68, 4, 215, 3, 83, 3, 187, 2, 11, 2, 88, 1, 166, 0, 251, 255, 103, 255, 229, 254,
-124, 254, 56, 254, 11, 254, 246, 253, 18, 254, 74, 254, 156, 254, 20, 255, 145, 255, 16, 0, 141, 0, 0, 1, 109, 1, 213, 1, 27, 2, 73, 2, 86, 2, 39, 2, 221, 1, 121, 1, 240, 0, 88, 0, 178, 255, 250, 254, 65, 254, 136, 253, 216, 252, 60, 252, 182, 251, 83, 251, 30, 251, 9, 251,
-24, 251, 92, 251, 190, 251, 64, 252, 250, 252, 200, 253, 168, 254, 145, 255, 116, 0, 83, 1, 41, 2, 244, 2, 178, 3, 92, 4, 205, 4, 27, 5, 68, 5, 40, 5, 244, 4, 167, 4, 47, 4, 170, 3, 25, 3, 123, 2, 224, 1, 74, 1, 193, 0, 88, 0, 8, 0, 215, 255, 214, 255, 242, 255,
-42, 0, 149, 0, 32, 1, 199, 1, 141, 2, 90, 3, 41, 4, 237, 4, 162, 5, 75, 6, 225, 6, 77, 7, 150, 7, 180, 7, 137, 7, 54, 7, 189, 6, 11, 6, 57, 5, 76, 4, 58, 3, 26, 2, 240, 0, 193, 255, 157, 254, 134, 253, 131, 252, 169, 251, 232, 250, 66, 250, 207, 249, 123, 249,
-70, 249, 77, 249, 113, 249, 172, 249, 254, 249, 86, 250, 178, 250, 19, 251, 116, 251, 208, 251, 37, 252, 87, 252, 112, 252, 114, 252, 83, 252, 38, 252, 237, 251, 162, 251, 81, 251, 254, 250, 171, 250, 101, 250, 44, 250, 4, 250, 3, 250, 28, 250, 81, 250, 190, 250, 69, 251, 229, 251, 181, 252, 161, 253,
-164, 254, 188, 255, 214, 0, 235, 1, 239, 2, 227, 3, 203, 4, 161, 5, 76, 6, 212, 6, 51, 7, 60, 7, 29, 7, 217, 6, 90, 6, 192, 5, 13, 5, 60, 4, 93, 3, 121, 2, 146, 1, 189, 0, 249, 255, 77, 255, 209, 254, 114, 254, 47, 254, 39, 254, 63, 254, 117, 254, 227, 254, 110, 255,
-12, 0, 186, 0, 101, 1, 12, 2, 170, 2, 62, 3, 194, 3, 49, 4, 109, 4, 128, 4, 108, 4, 33, 4, 178, 3, 38, 3, 120, 2, 172, 1, 209, 0, 237, 255, 0, 255, 28, 254, 71, 253, 141, 252, 240, 251, 116, 251, 38, 251, 250, 250, 237, 250, 18, 251, 100, 251, 216, 251, 118, 252, 45, 253,
-239, 253, 182, 254, 129, 255, 77, 0, 25, 1, 212, 1, 121, 2, 6, 3, 93, 3, 149, 3, 176, 3, 163, 3, 125, 3, 68, 3, 243, 2, 146, 2, 44, 2, 193, 1, 92, 1, 0, 1, 175, 0, 125, 0, 93, 0, 80, 0, 96, 0, 135, 0, 194, 0, 24, 1, 125, 1, 232, 1, 82, 2, 171, 2,
-251, 2, 62, 3, 103, 3, 127, 3, 133, 3, 69, 3, 226, 2, 92, 2, 156, 1, 193, 0, 210, 255, 199, 254, 175, 253, 144, 252, 111, 251, 92, 250, 87, 249, 101, 248, 161, 247, 2, 247, 137, 246, 80, 246, 66, 246, 92, 246, 176, 246, 55, 247, 227, 247, 188, 248, 174, 249, 170, 250, 171, 251, 173, 252,
-171, 253, 164, 254, 135, 255, 80, 0, 253, 0, 109, 1, 186, 1, 233, 1, 239, 1, 213, 1, 165, 1, 90, 1, 251, 0, 149, 0, 43, 0, 204, 255, 122, 255, 55, 255, 30, 255, 30, 255, 53, 255, 119, 255, 214, 255, 82, 0, 250, 0, 194, 1, 157, 2, 135, 3, 110, 4, 78, 5, 40, 6, 241, 6,
-168, 7, 74, 8, 177, 8, 236, 8, 253, 8, 207, 8, 121, 8, 5, 8, 106, 7, 177, 6, 229, 5, 6, 5, 29, 4, 50, 3, 72, 2, 113, 1, 173, 0, 252, 255, 113, 255, 2, 255, 171, 254, 122, 254, 112, 254, 127, 254, 174, 254, 240, 254, 53, 255, 122, 255, 191, 255, 0, 0, 61, 0, 109, 0,
-133, 0, 130, 0, 83, 0, 1, 0, 151, 255, 15, 255, 114, 254, 202, 253, 23, 253, 93, 252, 167, 251, 247, 250, 94, 250, 218, 249, 109, 249, 52, 249, 31, 249, 43, 249, 103, 249, 204, 249, 80, 250, 255, 250, 216, 251, 196, 252, 190, 253, 188, 254, 180, 255, 165, 0, 138, 1, 94, 2, 29, 3, 172, 3,
-14, 4, 75, 4, 84, 4, 53, 4, 248, 3, 150, 3, 15, 3, 117, 2, 196, 1, 8, 1, 73, 0, 140, 255, 229, 254, 82, 254, 209, 253, 119, 253, 55, 253, 17, 253, 18, 253, 53, 253, 115, 253, 210, 253, 68, 254, 187, 254, 51, 255, 163, 255, 14, 0, 116, 0, 201, 0, 1, 1, 31, 1, 14, 1,
-210, 0, 123, 0, 7, 0, 117, 255, 213, 254, 36, 254, 104, 253, 172, 252, 241, 251, 72, 251, 178, 250, 50, 250, 220, 249, 176, 249, 165, 249, 201, 249, 30, 250, 149, 250, 56, 251, 10, 252, 243, 252, 240, 253, 242, 254, 244, 255, 246, 0, 241, 1, 228, 2, 203, 3, 140, 4, 35, 5, 151, 5, 216, 5,
-239, 5, 233, 5, 193, 5, 114, 5, 17, 5, 157, 4, 22, 4, 142, 3, 6, 3, 143, 2, 44, 2, 221, 1, 176, 1, 161, 1, 170, 1, 207, 1, 29, 2, 132, 2, 5, 3, 158, 3, 57, 4, 211, 4, 99, 5, 232, 5, 99, 6, 200, 6, 11, 7, 48, 7, 31, 7, 221, 6, 120, 6, 235, 5,
-52, 5, 100, 4, 123, 3, 114, 2, 96, 1, 72, 0, 51, 255, 42, 254, 48, 253, 85, 252, 157, 251, 254, 250, 128, 250, 47, 250, 250, 249, 230, 249, 9, 250, 65, 250, 140, 250, 236, 250, 76, 251, 173, 251, 24, 252, 126, 252, 221, 252, 41, 253, 87, 253, 109, 253, 98, 253, 61, 253, 7, 253, 193, 252,
-107, 252, 15, 252, 175, 251, 84, 251, 1, 251, 184, 250, 138, 250, 120, 250, 127, 250, 173, 250, 4, 251, 120, 251, 12, 252, 204, 252, 165, 253, 150, 254, 158, 255, 166, 0, 172, 1, 165, 2, 148, 3, 121, 4, 72, 5, 241, 5, 119, 6, 197, 6, 210, 6, 182, 6, 109, 6, 241, 5, 88, 5, 161, 4,
-201, 3, 228, 2, 245, 1, 7, 1, 36, 0, 79, 255, 152, 254, 3, 254, 137, 253, 52, 253, 10, 253, 255, 252, 23, 253, 103, 253, 206, 253, 77, 254, 221, 254, 111, 255, 2, 0, 150, 0, 37, 1, 168, 1, 19, 2, 88, 2, 124, 2, 117, 2, 69, 2, 249, 1, 147, 1, 9, 1, 108, 0, 191, 255,
-6, 255, 77, 254, 153, 253, 243, 252, 108, 252, 251, 251, 170, 251, 132, 251, 123, 251, 144, 251, 221, 251, 75, 252, 220, 252, 148, 253, 93, 254, 49, 255, 4, 0, 222, 0, 184, 1, 136, 2, 74, 3, 246, 3, 123, 4, 208, 4, 7, 5, 30, 5, 8, 5, 221, 4, 156, 4, 60, 4, 206, 3, 85, 3,
-214, 2, 87, 2, 221, 1, 114, 1, 31, 1, 221, 0, 174, 0, 158, 0, 160, 0, 183, 0, 239, 0, 53, 1, 134, 1, 217, 1, 34, 2, 101, 2, 157, 2, 196, 2, 218, 2, 217, 2, 161, 2, 72, 2, 202, 1, 27, 1, 87, 0, 128, 255, 140, 254, 143, 253, 140, 252, 129, 251, 130, 250, 142, 249,
-175, 248, 245, 247, 91, 247, 235, 246, 180, 246, 161, 246, 182, 246, 11, 247, 134, 247, 37, 248, 246, 248, 219, 249, 206, 250, 199, 251, 196, 252, 193, 253, 183, 254, 157, 255, 108, 0, 27, 1, 147, 1, 239, 1, 47, 2, 58, 2, 49, 2, 19, 2, 203, 1, 121, 1, 32, 1, 183, 0, 94, 0, 15, 0,
-203, 255, 168, 255, 156, 255, 168, 255, 223, 255, 47, 0, 154, 0, 56, 1, 237, 1, 181, 2, 140, 3, 96, 4, 49, 5, 249, 5, 181, 6, 99, 7, 247, 7, 87, 8, 144, 8, 159, 8, 105, 8, 19, 8, 157, 7, 250, 6, 59, 6, 101, 5, 116, 4, 121, 3, 121, 2, 120, 1, 137, 0, 170, 255,
-223, 254, 62, 254, 181, 253, 65, 253, 4, 253, 229, 252, 226, 252, 13, 253, 73, 253, 144, 253, 225, 253, 54, 254, 140, 254, 229, 254, 53, 255, 117, 255, 159, 255, 161, 255, 137, 255, 89, 255, 12, 255, 175, 254, 67, 254, 201, 253, 69, 253, 191, 252, 61, 252, 198, 251, 95, 251, 15, 251, 228, 250, 215, 250,
-232, 250, 35, 251, 123, 251, 239, 251, 142, 252, 74, 253, 25, 254, 246, 254, 214, 255, 178, 0, 133, 1, 78, 2, 10, 3, 180, 3, 45, 4, 133, 4, 186, 4, 176, 4, 133, 4, 61, 4, 201, 3, 55, 3, 145, 2, 212, 1, 12, 1, 67, 0, 123, 255, 197, 254, 32, 254, 144, 253, 38, 253, 214, 252,
-162, 252, 147, 252, 169, 252, 219, 252, 46, 253, 151, 253, 11, 254, 128, 254, 245, 254, 104, 255, 215, 255, 57, 0, 134, 0, 190, 0, 190, 0, 162, 0, 106, 0, 8, 0, 145, 255, 7, 255, 101, 254, 179, 253, 253, 252, 70, 252, 153, 251, 251, 250, 113, 250, 18, 250, 209, 249, 176, 249, 199, 249, 1, 250,
-93, 250, 244, 250, 175, 251, 135, 252, 132, 253, 135, 254, 145, 255, 162, 0, 177, 1, 187, 2, 192, 3, 160, 4, 98, 5, 6, 6, 113, 6, 184, 6, 223, 6, 220, 6, 178, 6, 110, 6, 12, 6, 146, 5, 15, 5, 132, 4, 3, 4, 139, 3, 31, 3, 211, 2, 151, 2, 108, 2, 98, 2, 115, 2,
-153, 2, 226, 2, 60, 3, 158, 3, 4, 4, 98, 4, 187, 4, 16, 5, 84, 5, 131, 5, 156, 5, 130, 5, 64, 5, 220, 4, 80, 4, 161, 3, 218, 2, 252, 1, 5, 1, 4, 0, 255, 254, 251, 253, 2, 253, 20, 252, 76, 251, 155, 250, 3, 250, 154, 249, 80, 249, 34, 249, 33, 249, 77, 249,
-148, 249, 246, 249, 110, 250, 236, 250, 108, 251, 245, 251, 123, 252, 254, 252, 112, 253, 201, 253, 11, 254, 39, 254, 40, 254, 21, 254, 235, 253, 173, 253, 99, 253, 13, 253, 176, 252, 87, 252, 1, 252, 192, 251, 145, 251, 117, 251, 132, 251, 174, 251, 242, 251, 91, 252, 230, 252, 138, 253, 82, 254, 51, 255,
-30, 0, 18, 1, 253, 1, 227, 2, 196, 3, 141, 4, 64, 5, 218, 5, 57, 6, 104, 6, 112, 6, 67, 6, 235, 5, 117, 5, 218, 4, 27, 4, 76, 3, 108, 2, 132, 1, 161, 0, 197, 255, 1, 255, 84, 254, 188, 253, 76, 253, 252, 252, 201, 252, 193, 252, 232, 252, 43, 253, 145, 253, 12, 254,
-144, 254, 28, 255, 173, 255, 62, 0, 206, 0, 73, 1, 174, 1, 252, 1, 26, 2, 20, 2, 246, 1, 187, 1, 94, 1, 238, 0, 107, 0, 215, 255, 64, 255, 169, 254, 29, 254, 161, 253, 55, 253, 239, 252, 195, 252, 177, 252, 201, 252, 7, 253, 100, 253, 233, 253, 153, 254, 89, 255, 41, 0, 3, 1,
-219, 1, 175, 2, 132, 3, 72, 4, 252, 4, 143, 5, 245, 5, 58, 6, 86, 6, 69, 6, 25, 6, 208, 5, 92, 5, 214, 4, 65, 4, 150, 3, 235, 2, 66, 2, 162, 1, 21, 1, 151, 0, 46, 0, 222, 255, 160, 255, 121, 255, 118, 255, 135, 255, 173, 255, 229, 255, 30, 0, 86, 0, 134, 0,
-176, 0, 210, 0, 226, 0, 213, 0, 176, 0, 99, 0, 242, 255, 107, 255, 204, 254, 18, 254, 75, 253, 120, 252, 151, 251, 185, 250, 222, 249, 22, 249, 101, 248, 203, 247, 91, 247, 20, 247, 238, 246, 245, 246, 43, 247, 132, 247, 8, 248, 189, 248, 138, 249, 108, 250, 93, 251, 80, 252, 69, 253, 60, 254,
-39, 255, 6, 0, 205, 0, 104, 1, 229, 1, 62, 2, 106, 2, 124, 2, 116, 2, 70, 2, 6, 2, 182, 1, 89, 1, 250, 0, 157, 0, 77, 0, 15, 0, 226, 255, 213, 255, 229, 255, 14, 0, 89, 0, 202, 0, 87, 1, 2, 2, 195, 2, 140, 3, 89, 4, 29, 5, 220, 5, 145, 6, 50, 7,
-180, 7, 23, 8, 71, 8, 67, 8, 27, 8, 201, 7, 72, 7, 167, 6, 232, 5, 2, 5, 13, 4, 12, 3, 5, 2, 7, 1, 19, 0, 50, 255, 111, 254, 195, 253, 49, 253, 202, 252, 129, 252, 89, 252, 105, 252, 147, 252, 213, 252, 47, 253, 146, 253, 250, 253, 106, 254, 220, 254, 75, 255, 174, 255,
-244, 255, 38, 0, 61, 0, 52, 0, 24, 0, 234, 255, 158, 255, 68, 255, 222, 254, 107, 254, 251, 253, 144, 253, 48, 253, 231, 252, 177, 252, 149, 252, 151, 252, 176, 252, 227, 252, 61, 253, 176, 253, 61, 254, 232, 254, 155, 255, 81, 0, 1, 1, 175, 1, 89, 2, 247, 2, 126, 3, 237, 3, 53, 4,
-69, 4, 51, 4, 253, 3, 148, 3, 19, 3, 122, 2, 188, 1, 242, 0, 31, 0, 72, 255, 119, 254, 176, 253, 251, 252, 101, 252, 229, 251, 131, 251, 71, 251, 41, 251, 42, 251, 91, 251, 170, 251, 16, 252, 137, 252, 9, 253, 141, 253, 17, 254, 150, 254, 20, 255, 134, 255, 213, 255, 9, 0, 30, 0,
-255, 255, 199, 255, 116, 255, 248, 254, 102, 254, 193, 253, 14, 253, 89, 252, 168, 251, 8, 251, 130, 250, 22, 250, 203, 249, 177, 249, 182, 249, 222, 249, 67, 250, 208, 250, 132, 251, 110, 252, 114, 253, 136, 254, 169, 255, 212, 0, 2, 2, 47, 3, 83, 4, 100, 5, 89, 6, 26, 7, 183, 7, 44, 8,
-102, 8, 117, 8, 94, 8, 18, 8, 163, 7, 27, 7, 124, 6, 213, 5, 43, 5, 135, 4, 248, 3, 120, 3, 7, 3, 184, 2, 128, 2, 94, 2, 111, 2, 154, 2, 219, 2, 49, 3, 140, 3, 231, 3, 65, 4, 152, 4, 231, 4, 43, 5, 66, 5, 56, 5, 10, 5, 156, 4, 17, 4, 106, 3,
-149, 2, 168, 1, 168, 0, 146, 255, 123, 254, 102, 253, 90, 252, 108, 251, 149, 250, 222, 249, 89, 249, 242, 248, 170, 248, 161, 248, 193, 248, 8, 249, 136, 249, 36, 250, 209, 250, 139, 251, 79, 252, 22, 253, 225, 253, 160, 254, 78, 255, 228, 255, 62, 0, 120, 0, 148, 0, 128, 0, 76, 0, 255, 255,
-141, 255, 5, 255, 114, 254, 218, 253, 76, 253, 202, 252, 93, 252, 28, 252, 245, 251, 231, 251, 14, 252, 84, 252, 186, 252, 94, 253, 41, 254, 15, 255, 10, 0, 5, 1, 254, 1, 242, 2, 220, 3, 184, 4, 127, 5, 4, 6, 93, 6, 138, 6, 99, 6, 20, 6, 157, 5, 232, 4, 11, 4, 17, 3,
-248, 1, 213, 0, 181, 255, 155, 254, 162, 253, 195, 252, 1, 252, 120, 251, 12, 251, 188, 250, 180, 250, 221, 250, 50, 251, 194, 251, 110, 252, 41, 253, 234, 253, 184, 254, 139, 255, 96, 0, 41, 1, 214, 1, 98, 2, 171, 2, 209, 2, 214, 2, 169, 2, 85, 2, 225, 1, 70, 1, 145, 0, 209, 255,
-14, 255, 87, 254, 181, 253, 45, 253, 221, 252, 172, 252, 156, 252, 182, 252, 251, 252, 103, 253, 22, 254, 243, 254, 233, 255, 241, 0, 248, 1, 255, 2, 10, 4, 19, 5, 13, 6, 245, 6, 144, 7, 253, 7, 58, 8, 51, 8, 3, 8, 173, 7, 31, 7, 100, 6, 140, 5, 151, 4, 149, 3, 147, 2,
-151, 1, 189, 0, 254, 255, 90, 255, 222, 254, 114, 254, 24, 254, 239, 253, 249, 253, 41, 254, 140, 254, 249, 254, 102, 255, 203, 255, 52, 0, 156, 0, 3, 1, 79, 1, 117, 1, 116, 1, 47, 1, 202, 0, 73, 0, 163, 255, 224, 254, 5, 254, 14, 253, 13, 252, 11, 251, 13, 250, 45, 249, 109, 248,
-208, 247, 130, 247, 81, 247, 63, 247, 89, 247, 154, 247, 4, 248, 189, 248, 170, 249, 176, 250, 194, 251, 206, 252, 221, 253, 242, 254, 18, 0, 35, 1, 31, 2, 203, 2, 71, 3, 153, 3, 176, 3, 167, 3, 128, 3, 44, 3, 183, 2, 46, 2, 145, 1, 242, 0, 87, 0, 194, 255, 98, 255, 34, 255,
-2, 255, 8, 255, 29, 255, 66, 255, 144, 255, 27, 0, 205, 0, 172, 1, 140, 2, 101, 3, 49, 4, 252, 4, 206, 5, 166, 6, 87, 7, 215, 7, 40, 8, 37, 8, 251, 7, 177, 7, 56, 7, 143, 6, 197, 5, 209, 4, 188, 3, 155, 2, 109, 1, 67, 0, 49, 255, 58, 254, 126, 253, 216, 252,
-69, 252, 200, 251, 114, 251, 70, 251, 108, 251, 210, 251, 81, 252, 220, 252, 96, 253, 234, 253, 123, 254, 41, 255, 202, 255, 92, 0, 178, 0, 224, 0, 242, 0, 233, 0, 209, 0, 168, 0, 102, 0, 8, 0, 158, 255, 44, 255, 171, 254, 47, 254, 188, 253, 112, 253, 72, 253, 64, 253, 76, 253, 100, 253,
-138, 253, 207, 253, 92, 254, 18, 255, 243, 255, 211, 0, 161, 1, 88, 2, 11, 3, 194, 3, 121, 4, 13, 5, 108, 5, 154, 5, 128, 5, 64, 5, 231, 4, 112, 4, 208, 3, 22, 3, 64, 2, 84, 1, 94, 0, 96, 255, 106, 254, 142, 253, 204, 252, 76, 252, 228, 251, 141, 251, 68, 251, 29, 251,
-28, 251, 94, 251, 223, 251, 108, 252, 252, 252, 115, 253, 236, 253, 105, 254, 252, 254, 133, 255, 253, 255, 52, 0, 63, 0, 46, 0, 4, 0, 196, 255, 111, 255, 253, 254, 98, 254, 183, 253, 252, 252, 51, 252, 110, 251, 177, 250, 38, 250, 205, 249, 155, 249, 152, 249, 166, 249, 203, 249, 28, 250, 191, 250,
-151, 251, 168, 252, 190, 253, 206, 254, 213, 255, 225, 0, 3, 2, 53, 3, 84, 4, 74, 5, 29, 6, 182, 6, 54, 7, 161, 7, 242, 7, 11, 8, 255, 7, 203, 7, 96, 7, 220, 6, 63, 6, 140, 5, 228, 4, 75, 4, 220, 3, 124, 3, 34, 3, 199, 2, 122, 2, 78, 2, 89, 2, 158, 2,
-232, 2, 49, 3, 84, 3, 121, 3, 165, 3, 238, 3, 50, 4, 102, 4, 94, 4, 33, 4, 197, 3, 80, 3, 196, 2, 36, 2, 103, 1, 130, 0, 143, 255, 144, 254, 135, 253, 132, 252, 139, 251, 194, 250, 43, 250, 184, 249, 112, 249, 46, 249, 250, 248, 222, 248, 14, 249, 107, 249, 248, 249, 148, 250,
-35, 251, 168, 251, 62, 252, 240, 252, 183, 253, 133, 254, 41, 255, 172, 255, 0, 0, 60, 0, 108, 0, 139, 0, 129, 0, 91, 0, 24, 0, 185, 255, 78, 255, 220, 254, 107, 254, 19, 254, 213, 253, 203, 253, 222, 253, 250, 253, 17, 254, 56, 254, 124, 254, 235, 254, 160, 255, 91, 0, 21, 1, 172, 1,
-67, 2, 222, 2, 149, 3, 74, 4, 237, 4, 85, 5, 126, 5, 134, 5, 113, 5, 61, 5, 236, 4, 123, 4, 209, 3, 16, 3, 58, 2, 81, 1, 94, 0, 106, 255, 145, 254, 221, 253, 68, 253, 201, 252, 78, 252, 217, 251, 112, 251, 90, 251, 115, 251, 188, 251, 42, 252, 141, 252, 235, 252, 99, 253,
-254, 253, 176, 254, 114, 255, 9, 0, 125, 0, 192, 0, 230, 0, 1, 1, 20, 1, 5, 1, 221, 0, 159, 0, 73, 0, 234, 255, 131, 255, 22, 255, 190, 254, 122, 254, 94, 254, 94, 254, 101, 254, 102, 254, 112, 254, 156, 254, 242, 254, 160, 255, 92, 0, 34, 1, 206, 1, 125, 2, 53, 3, 19, 4,
-247, 4, 203, 5, 112, 6, 206, 6, 9, 7, 37, 7, 38, 7, 12, 7, 212, 6, 95, 6, 210, 5, 47, 5, 113, 4, 168, 3, 220, 2, 23, 2, 115, 1, 227, 0, 101, 0, 218, 255, 76, 255, 188, 254, 107, 254, 72, 254, 80, 254, 110, 254, 119, 254, 116, 254, 111, 254, 138, 254, 183, 254, 241, 254,
-7, 255, 251, 254, 190, 254, 114, 254, 36, 254, 216, 253, 130, 253, 26, 253, 161, 252, 27, 252, 140, 251, 247, 250, 90, 250, 208, 249, 92, 249, 8, 249, 224, 248, 195, 248, 167, 248, 157, 248, 184, 248, 0, 249, 171, 249, 111, 250, 65, 251, 254, 251, 188, 252, 133, 253, 108, 254, 105, 255, 89, 0, 34, 1,
-168, 1, 19, 2, 102, 2, 181, 2, 249, 2, 45, 3, 56, 3, 43, 3, 10, 3, 206, 2, 129, 2, 45, 2, 214, 1, 154, 1, 111, 1, 85, 1, 54, 1, 19, 1, 238, 0, 5, 1, 78, 1, 194, 1, 84, 2, 210, 2, 65, 3, 167, 3, 45, 4, 197, 4, 113, 5, 241, 5, 73, 6, 110, 6,
-101, 6, 83, 6, 57, 6, 255, 5, 160, 5, 33, 5, 112, 4, 167, 3, 203, 2, 218, 1, 235, 0, 8, 0, 63, 255, 153, 254, 249, 253, 92, 253, 195, 252, 74, 252, 246, 251, 2, 252, 39, 252, 89, 252, 124, 252, 153, 252, 195, 252, 21, 253, 147, 253, 20, 254, 140, 254, 211, 254, 12, 255, 60, 255,
-125, 255, 190, 255, 250, 255, 24, 0, 23, 0, 3, 0, 218, 255, 158, 255, 93, 255, 32, 255, 254, 254, 241, 254, 252, 254, 5, 255, 10, 255, 11, 255, 50, 255, 135, 255, 254, 255, 136, 0, 242, 0, 68, 1, 123, 1, 201, 1, 42, 2, 162, 2, 3, 3, 65, 3, 86, 3, 62, 3, 37, 3, 10, 3,
-229, 2, 163, 2, 74, 2, 201, 1, 49, 1, 139, 0, 212, 255, 31, 255, 121, 254, 233, 253, 126, 253, 23, 253, 176, 252, 62, 252, 224, 251, 156, 251, 161, 251, 195, 251, 241, 251, 11, 252, 26, 252, 50, 252, 103, 252, 210, 252, 66, 253, 175, 253, 227, 253, 1, 254, 13, 254, 26, 254, 37, 254, 41, 254,
-11, 254, 208, 253, 128, 253, 29, 253, 179, 252, 75, 252, 233, 251, 179, 251, 152, 251, 152, 251, 163, 251, 172, 251, 184, 251, 227, 251, 74, 252, 219, 252, 147, 253, 68, 254, 236, 254, 131, 255, 66, 0, 32, 1, 34, 2, 39, 3, 14, 4, 213, 4, 107, 5, 251, 5, 133, 6, 1, 7, 89, 7, 146, 7,
-151, 7, 113, 7, 50, 7, 220, 6, 115, 6, 15, 6, 180, 5, 111, 5, 36, 5, 207, 4, 84, 4, 221, 3, 116, 3, 66, 3, 45, 3, 30, 3, 252, 2, 191, 2, 136, 2, 102, 2, 119, 2, 144, 2, 174, 2, 138, 2, 76, 2, 249, 1, 156, 1, 70, 1, 240, 0, 137, 0, 11, 0, 127, 255,
-226, 254, 64, 254, 160, 253, 7, 253, 141, 252, 43, 252, 222, 251, 148, 251, 61, 251, 225, 250, 148, 250, 123, 250, 136, 250, 200, 250, 4, 251, 57, 251, 98, 251, 173, 251, 26, 252, 172, 252, 83, 253, 222, 253, 79, 254, 146, 254, 210, 254, 19, 255, 92, 255, 154, 255, 203, 255, 229, 255, 233, 255, 227, 255,
-215, 255, 197, 255, 189, 255, 195, 255, 225, 255, 249, 255, 10, 0, 250, 255, 230, 255, 220, 255, 2, 0, 75, 0, 157, 0, 232, 0, 15, 1, 54, 1, 103, 1, 201, 1, 51, 2, 157, 2, 210, 2, 227, 2, 217, 2, 190, 2, 167, 2, 139, 2, 94, 2, 21, 2, 183, 1, 63, 1, 178, 0, 30, 0,
-133, 255, 250, 254, 129, 254, 22, 254, 173, 253, 55, 253, 189, 252, 76, 252, 20, 252, 6, 252, 45, 252, 90, 252, 127, 252, 152, 252, 194, 252, 14, 253, 125, 253, 2, 254, 113, 254, 202, 254, 247, 254, 33, 255, 80, 255, 144, 255, 210, 255, 12, 0, 52, 0, 70, 0, 73, 0, 60, 0, 36, 0, 18, 0,
-7, 0, 22, 0, 34, 0, 42, 0, 30, 0, 16, 0, 20, 0, 71, 0, 175, 0, 34, 1, 149, 1, 228, 1, 47, 2, 122, 2, 247, 2, 128, 3, 14, 4, 117, 4, 178, 4, 215, 4, 233, 4, 254, 4, 17, 5, 31, 5, 16, 5, 235, 4, 174, 4, 79, 4, 226, 3, 107, 3, 248, 2, 143, 2,
-45, 2, 200, 1, 72, 1, 185, 0, 32, 0, 171, 255, 84, 255, 34, 255, 237, 254, 165, 254, 71, 254, 229, 253, 160, 253, 120, 253, 113, 253, 95, 253, 64, 253, 1, 253, 198, 252, 148, 252, 119, 252, 105, 252, 91, 252, 70, 252, 30, 252, 235, 251, 173, 251, 105, 251, 46, 251, 255, 250, 247, 250, 251, 250,
-0, 251, 252, 250, 249, 250, 8, 251, 62, 251, 172, 251, 38, 252, 161, 252, 243, 252, 65, 253, 143, 253, 5, 254, 147, 254, 45, 255, 180, 255, 27, 0, 114, 0, 193, 0, 26, 1, 119, 1, 216, 1, 31, 2, 85, 2, 120, 2, 114, 2, 94, 2, 64, 2, 35, 2, 21, 2, 18, 2, 20, 2, 2, 2,
-228, 1, 187, 1, 180, 1, 202, 1, 3, 2, 63, 2, 100, 2, 115, 2, 118, 2, 145, 2, 194, 2, 20, 3, 88, 3, 137, 3, 146, 3, 139, 3, 127, 3, 116, 3, 104, 3, 77, 3, 31, 3, 209, 2, 109, 2, 245, 1, 111, 1, 238, 0, 117, 0, 25, 0, 200, 255, 116, 255, 15, 255, 155, 254,
-48, 254, 219, 253, 189, 253, 170, 253, 155, 253, 109, 253, 63, 253, 23, 253, 31, 253, 78, 253, 148, 253, 221, 253, 18, 254, 63, 254, 105, 254, 162, 254, 228, 254, 46, 255, 111, 255, 166, 255, 209, 255, 229, 255, 240, 255, 246, 255, 6, 0, 45, 0, 98, 0, 164, 0, 204, 0, 225, 0, 227, 0, 237, 0,
-11, 1, 65, 1, 109, 1, 126, 1, 116, 1, 84, 1, 71, 1, 79, 1, 124, 1, 164, 1, 191, 1, 190, 1, 170, 1, 146, 1, 124, 1, 106, 1, 82, 1, 50, 1, 255, 0, 190, 0, 110, 0, 16, 0, 182, 255, 99, 255, 40, 255, 247, 254, 194, 254, 122, 254, 21, 254, 180, 253, 97, 253, 60, 253,
-36, 253, 22, 253, 230, 252, 180, 252, 133, 252, 119, 252, 144, 252, 185, 252, 224, 252, 239, 252, 241, 252, 232, 252, 231, 252, 238, 252, 253, 252, 11, 253, 21, 253, 27, 253, 23, 253, 15, 253, 8, 253, 13, 253, 44, 253, 91, 253, 154, 253, 194, 253, 220, 253, 231, 253, 0, 254, 55, 254, 143, 254, 252, 254,
-89, 255, 168, 255, 237, 255, 75, 0, 191, 0, 88, 1, 236, 1, 114, 2, 222, 2, 46, 3, 122, 3, 195, 3, 15, 4, 83, 4, 142, 4, 183, 4, 206, 4, 213, 4, 196, 4, 173, 4, 152, 4, 142, 4, 136, 4, 117, 4, 76, 4, 244, 3, 154, 3, 67, 3, 20, 3, 236, 2, 198, 2, 124, 2,
-32, 2, 192, 1, 115, 1, 71, 1, 39, 1, 5, 1, 200, 0, 125, 0, 33, 0, 213, 255, 143, 255, 80, 255, 33, 255, 240, 254, 190, 254, 134, 254, 69, 254, 254, 253, 183, 253, 133, 253, 95, 253, 66, 253, 22, 253, 216, 252, 133, 252, 68, 252, 32, 252, 26, 252, 52, 252, 63, 252, 62, 252, 47, 252,
-52, 252, 78, 252, 138, 252, 206, 252, 10, 253, 55, 253, 90, 253, 133, 253, 187, 253, 9, 254, 96, 254, 190, 254, 32, 255, 124, 255, 209, 255, 20, 0, 83, 0, 146, 0, 218, 0, 45, 1, 114, 1, 160, 1, 165, 1, 162, 1, 156, 1, 187, 1, 227, 1, 10, 2, 18, 2, 253, 1, 223, 1, 200, 1,
-203, 1, 211, 1, 217, 1, 191, 1, 152, 1, 99, 1, 52, 1, 10, 1, 230, 0, 200, 0, 166, 0, 128, 0, 82, 0, 22, 0, 210, 255, 137, 255, 82, 255, 41, 255, 18, 255, 238, 254, 191, 254, 133, 254, 81, 254, 64, 254, 74, 254, 100, 254, 109, 254, 101, 254, 65, 254, 42, 254, 36, 254, 59, 254,
-93, 254, 121, 254, 139, 254, 142, 254, 154, 254, 178, 254, 220, 254, 13, 255, 66, 255, 118, 255, 161, 255, 194, 255, 211, 255, 220, 255, 233, 255, 2, 0, 51, 0, 97, 0, 136, 0, 149, 0, 162, 0, 179, 0, 238, 0, 52, 1, 121, 1, 162, 1, 168, 1, 164, 1, 163, 1, 190, 1, 227, 1, 16, 2,
-41, 2, 58, 2, 68, 2, 86, 2, 113, 2, 144, 2, 177, 2, 204, 2, 223, 2, 229, 2, 212, 2, 184, 2, 143, 2, 110, 2, 84, 2, 69, 2, 28, 2, 218, 1, 128, 1, 17, 1, 179, 0, 98, 0, 29, 0, 190, 255, 74, 255, 180, 254, 38, 254, 170, 253, 72, 253, 251, 252, 172, 252, 87, 252,
-255, 251, 180, 251, 119, 251, 82, 251, 60, 251, 47, 251, 41, 251, 42, 251, 45, 251, 45, 251, 50, 251, 67, 251, 103, 251, 175, 251, 252, 251, 74, 252, 125, 252, 172, 252, 221, 252, 41, 253, 130, 253, 216, 253, 22, 254, 49, 254, 69, 254, 93, 254, 153, 254, 226, 254, 55, 255, 124, 255, 182, 255, 233, 255,
-33, 0, 96, 0, 164, 0, 231, 0, 38, 1, 97, 1, 150, 1, 190, 1, 224, 1, 253, 1, 35, 2, 88, 2, 155, 2, 210, 2, 244, 2, 5, 3, 0, 3, 13, 3, 38, 3, 74, 3, 86, 3, 74, 3, 28, 3, 239, 2, 206, 2, 192, 2, 192, 2, 180, 2, 155, 2, 110, 2, 67, 2, 25, 2,
-248, 1, 216, 1, 185, 1, 150, 1, 114, 1, 74, 1, 29, 1, 239, 0, 199, 0, 165, 0, 160, 0, 149, 0, 129, 0, 72, 0, 252, 255, 171, 255, 110, 255, 67, 255, 25, 255, 223, 254, 139, 254, 51, 254, 221, 253, 183, 253, 161, 253, 154, 253, 138, 253, 115, 253, 89, 253, 76, 253, 81, 253, 98, 253,
-129, 253, 172, 253, 223, 253, 28, 254, 94, 254, 162, 254, 233, 254, 64, 255, 166, 255, 25, 0, 136, 0, 219, 0, 25, 1, 57, 1, 94, 1, 137, 1, 188, 1, 211, 1, 207, 1, 170, 1, 124, 1, 90, 1, 71, 1, 72, 1, 59, 1, 32, 1, 238, 0, 187, 0, 137, 0, 98, 0, 64, 0, 31, 0,
-1, 0, 232, 255, 204, 255, 174, 255, 137, 255, 102, 255, 70, 255, 60, 255, 46, 255, 25, 255, 228, 254, 158, 254, 84, 254, 25, 254, 247, 253, 215, 253, 174, 253, 97, 253, 15, 253, 188, 252, 137, 252, 99, 252, 74, 252, 33, 252, 240, 251, 190, 251, 153, 251, 139, 251, 142, 251, 164, 251, 203, 251, 252, 251,
-58, 252, 133, 252, 209, 252, 32, 253, 123, 253, 227, 253, 85, 254, 202, 254, 36, 255, 107, 255, 161, 255, 229, 255, 55, 0, 161, 0, 253, 0, 68, 1, 110, 1, 137, 1, 173, 1, 220, 1, 23, 2, 65, 2, 91, 2, 91, 2, 91, 2, 96, 2, 114, 2, 143, 2, 177, 2, 214, 2, 1, 3, 45, 3,
-87, 3, 121, 3, 156, 3, 193, 3, 242, 3, 35, 4, 74, 4, 77, 4, 56, 4, 27, 4, 255, 3, 243, 3, 224, 3, 188, 3, 99, 3, 250, 2, 132, 2, 32, 2, 200, 1, 117, 1, 20, 1, 158, 0, 33, 0, 170, 255, 73, 255, 245, 254, 176, 254, 117, 254, 64, 254, 19, 254, 233, 253, 189, 253,
-144, 253, 107, 253, 85, 253, 75, 253, 76, 253, 63, 253, 37, 253, 253, 252, 230, 252, 226, 252, 246, 252, 4, 253, 253, 252, 223, 252, 175, 252, 144, 252, 131, 252, 144, 252, 157, 252, 168, 252, 171, 252, 192, 252, 230, 252, 40, 253, 131, 253, 233, 253, 89, 254, 207, 254, 73, 255, 199, 255, 52, 0, 163, 0,
-20, 1, 137, 1, 0, 2, 109, 2, 188, 2, 232, 2, 10, 3, 40, 3, 80, 3, 109, 3, 121, 3, 68, 3, 248, 2, 153, 2, 63, 2, 238, 1, 160, 1, 64, 1, 206, 0, 86, 0, 223, 255, 130, 255, 50, 255, 238, 254, 181, 254, 131, 254, 89, 254, 61, 254, 37, 254, 19, 254, 15, 254, 33, 254,
-67, 254, 118, 254, 162, 254, 195, 254, 211, 254, 235, 254, 15, 255, 65, 255, 99, 255, 105, 255, 83, 255, 32, 255, 248, 254, 219, 254, 218, 254, 209, 254, 191, 254, 161, 254, 130, 254, 110, 254, 110, 254, 125, 254, 145, 254, 168, 254, 196, 254, 229, 254, 9, 255, 47, 255, 91, 255, 145, 255, 224, 255, 60, 0,
-154, 0, 238, 0, 42, 1, 97, 1, 154, 1, 228, 1, 37, 2, 92, 2, 88, 2, 62, 2, 24, 2, 1, 2, 251, 1, 253, 1, 255, 1, 234, 1, 208, 1, 186, 1, 179, 1, 182, 1, 197, 1, 211, 1, 225, 1, 237, 1, 255, 1, 10, 2, 17, 2, 26, 2, 41, 2, 61, 2, 85, 2, 80, 2,
-50, 2, 246, 1, 167, 1, 93, 1, 25, 1, 195, 0, 81, 0, 196, 255, 23, 255, 118, 254, 226, 253, 104, 253, 238, 252, 112, 252, 231, 251, 100, 251, 241, 250, 146, 250, 86, 250, 39, 250, 5, 250, 1, 250, 16, 250, 48, 250, 102, 250, 173, 250, 6, 251, 123, 251, 5, 252, 144, 252, 22, 253, 124, 253,
-220, 253, 57, 254, 167, 254, 16, 255, 113, 255, 165, 255, 193, 255, 209, 255, 234, 255, 21, 0, 70, 0, 113, 0, 126, 0, 127, 0, 120, 0, 124, 0, 136, 0, 155, 0, 173, 0, 194, 0, 220, 0, 0, 1, 40, 1, 84, 1, 135, 1, 199, 1, 16, 2, 102, 2, 166, 2, 212, 2, 234, 2, 240, 2,
-255, 2, 21, 3, 31, 3, 12, 3, 224, 2, 143, 2, 66, 2, 254, 1, 205, 1, 150, 1, 84, 1, 255, 0, 161, 0, 78, 0, 8, 0, 221, 255, 187, 255, 160, 255, 149, 255, 149, 255, 157, 255, 172, 255, 194, 255, 222, 255, 6, 0, 57, 0, 101, 0, 129, 0, 120, 0, 100, 0, 71, 0, 64, 0,
-55, 0, 40, 0, 246, 255, 168, 255, 78, 255, 252, 254, 189, 254, 131, 254, 77, 254, 254, 253, 171, 253, 87, 253, 30, 253, 253, 252, 241, 252, 255, 252, 32, 253, 82, 253, 157, 253, 248, 253, 93, 254, 206, 254, 75, 255, 213, 255, 110, 0, 242, 0, 100, 1, 195, 1, 12, 2, 92, 2, 178, 2, 255, 2,
-41, 3, 53, 3, 21, 3, 239, 2, 202, 2, 174, 2, 136, 2, 78, 2, 251, 1, 146, 1, 45, 1, 207, 0, 130, 0, 59, 0, 248, 255, 187, 255, 134, 255, 88, 255, 47, 255, 9, 255, 233, 254, 212, 254, 207, 254, 201, 254, 191, 254, 153, 254, 110, 254, 67, 254, 46, 254, 31, 254, 14, 254, 224, 253,
-146, 253, 58, 253, 230, 252, 169, 252, 114, 252, 67, 252, 1, 252, 191, 251, 127, 251, 102, 251, 101, 251, 123, 251, 176, 251, 241, 251, 62, 252, 159, 252, 6, 253, 114, 253, 230, 253, 102, 254, 239, 254, 134, 255, 15, 0, 135, 0, 240, 0, 70, 1, 166, 1, 12, 2, 111, 2, 173, 2, 202, 2, 184, 2,
-150, 2, 115, 2, 84, 2, 50, 2, 255, 1, 183, 1, 96, 1, 20, 1, 213, 0, 180, 0, 161, 0, 154, 0, 160, 0, 182, 0, 212, 0, 251, 0, 42, 1, 98, 1, 165, 1, 252, 1, 80, 2, 160, 2, 205, 2, 238, 2, 7, 3, 39, 3, 67, 3, 81, 3, 54, 3, 234, 2, 136, 2, 24, 2,
-183, 1, 87, 1, 245, 0, 123, 0, 245, 255, 102, 255, 232, 254, 121, 254, 21, 254, 190, 253, 111, 253, 39, 253, 234, 252, 187, 252, 148, 252, 117, 252, 114, 252, 127, 252, 158, 252, 201, 252, 233, 252, 255, 252, 14, 253, 47, 253, 90, 253, 141, 253, 171, 253, 181, 253, 157, 253, 133, 253, 119, 253, 121, 253,
-146, 253, 165, 253, 178, 253, 189, 253, 217, 253, 5, 254, 78, 254, 166, 254, 5, 255, 105, 255, 211, 255, 63, 0, 174, 0, 29, 1, 145, 1, 10, 2, 143, 2, 17, 3, 140, 3, 218, 3, 19, 4, 61, 4, 91, 4, 111, 4, 112, 4, 71, 4, 229, 3, 108, 3, 223, 2, 96, 2, 225, 1, 99, 1,
-206, 0, 44, 0, 131, 255, 238, 254, 109, 254, 253, 253, 165, 253, 93, 253, 35, 253, 2, 253, 248, 252, 255, 252, 22, 253, 79, 253, 156, 253, 253, 253, 102, 254, 194, 254, 19, 255, 83, 255, 154, 255, 229, 255, 50, 0, 97, 0, 116, 0, 98, 0, 60, 0, 28, 0, 8, 0, 253, 255, 228, 255, 189, 255,
-125, 255, 64, 255, 8, 255, 225, 254, 198, 254, 177, 254, 161, 254, 164, 254, 176, 254, 199, 254, 243, 254, 43, 255, 112, 255, 214, 255, 62, 0, 167, 0, 252, 0, 63, 1, 121, 1, 180, 1, 242, 1, 36, 2, 59, 2, 39, 2, 3, 2, 209, 1, 180, 1, 158, 1, 140, 1, 106, 1, 57, 1, 0, 1,
-206, 0, 173, 0, 150, 0, 138, 0, 131, 0, 128, 0, 133, 0, 144, 0, 160, 0, 180, 0, 206, 0, 241, 0, 26, 1, 62, 1, 73, 1, 64, 1, 26, 1, 238, 0, 193, 0, 152, 0, 82, 0, 243, 255, 118, 255, 226, 254, 85, 254, 210, 253, 89, 253, 216, 252, 77, 252, 179, 251, 37, 251, 166, 250,
-72, 250, 9, 250, 223, 249, 205, 249, 224, 249, 7, 250, 68, 250, 163, 250, 18, 251, 144, 251, 47, 252, 211, 252, 120, 253, 13, 254, 145, 254, 16, 255, 147, 255, 32, 0, 164, 0, 24, 1, 89, 1, 133, 1, 158, 1, 191, 1, 224, 1, 254, 1, 0, 2, 229, 1, 184, 1, 131, 1, 91, 1, 58, 1,
-35, 1, 17, 1, 7, 1, 5, 1, 18, 1, 38, 1, 64, 1, 104, 1, 155, 1, 214, 1, 19, 2, 62, 2, 91, 2, 96, 2, 103, 2, 115, 2, 134, 2, 132, 2, 104, 2, 48, 2, 216, 1, 133, 1, 58, 1, 249, 0, 175, 0, 93, 0, 246, 255, 153, 255, 72, 255, 14, 255, 242, 254, 226, 254,
-220, 254, 237, 254, 5, 255, 36, 255, 77, 255, 125, 255, 178, 255, 247, 255, 63, 0, 130, 0, 178, 0, 202, 0, 218, 0, 232, 0, 252, 0, 9, 1, 10, 1, 208, 0, 130, 0, 35, 0, 197, 255, 110, 255, 25, 255, 182, 254, 68, 254, 205, 253, 95, 253, 19, 253, 221, 252, 194, 252, 196, 252, 216, 252,
-253, 252, 64, 253, 141, 253, 229, 253, 79, 254, 202, 254, 81, 255, 229, 255, 110, 0, 237, 0, 93, 1, 202, 1, 58, 2, 174, 2, 6, 3, 60, 3, 80, 3, 49, 3, 15, 3, 233, 2, 192, 2, 134, 2, 57, 2, 202, 1, 80, 1, 216, 0, 107, 0, 5, 0, 164, 255, 71, 255, 241, 254, 164, 254,
-95, 254, 39, 254, 246, 253, 207, 253, 194, 253, 194, 253, 198, 253, 199, 253, 184, 253, 170, 253, 164, 253, 174, 253, 182, 253, 186, 253, 147, 253, 90, 253, 21, 253, 220, 252, 182, 252, 154, 252, 126, 252, 92, 252, 59, 252, 32, 252, 40, 252, 67, 252, 112, 252, 180, 252, 0, 253, 82, 253, 182, 253, 31, 254,
-141, 254, 6, 255, 142, 255, 31, 0, 187, 0, 74, 1, 201, 1, 50, 2, 144, 2, 235, 2, 67, 3, 127, 3, 150, 3, 136, 3, 69, 3, 253, 2, 179, 2, 111, 2, 33, 2, 200, 1, 92, 1, 238, 0, 139, 0, 59, 0, 5, 0, 221, 255, 194, 255, 188, 255, 195, 255, 216, 255, 252, 255, 45, 0,
-107, 0, 192, 0, 37, 1, 140, 1, 236, 1, 49, 2, 109, 2, 159, 2, 213, 2, 1, 3, 29, 3, 1, 3, 199, 2, 118, 2, 28, 2, 203, 1, 121, 1, 25, 1, 161, 0, 29, 0, 140, 255, 8, 255, 140, 254, 23, 254, 169, 253, 71, 253, 239, 252, 170, 252, 119, 252, 82, 252, 66, 252, 75, 252,
-104, 252, 155, 252, 206, 252, 252, 252, 32, 253, 71, 253, 120, 253, 178, 253, 240, 253, 24, 254, 43, 254, 40, 254, 41, 254, 52, 254, 88, 254, 126, 254, 159, 254, 181, 254, 198, 254, 223, 254, 1, 255, 55, 255, 115, 255, 178, 255, 249, 255, 72, 0, 155, 0, 244, 0, 83, 1, 184, 1, 35, 2, 154, 2,
-11, 3, 106, 3, 163, 3, 201, 3, 218, 3, 230, 3, 226, 3, 206, 3, 133, 3, 23, 3, 148, 2, 8, 2, 133, 1, 4, 1, 126, 0, 224, 255, 59, 255, 144, 254, 251, 253, 120, 253, 8, 253, 181, 252, 118, 252, 72, 252, 60, 252, 70, 252, 96, 252, 144, 252, 221, 252, 58, 253, 173, 253, 29, 254,
-131, 254, 219, 254, 39, 255, 123, 255, 214, 255, 45, 0, 107, 0, 146, 0, 146, 0, 136, 0, 126, 0, 126, 0, 115, 0, 92, 0, 48, 0, 237, 255, 171, 255, 110, 255, 64, 255, 27, 255, 254, 254, 243, 254, 247, 254, 8, 255, 40, 255, 84, 255, 137, 255, 206, 255, 41, 0, 132, 0, 220, 0, 29, 1,
-82, 1, 126, 1, 184, 1, 237, 1, 25, 2, 40, 2, 24, 2, 248, 1, 209, 1, 184, 1, 162, 1, 137, 1, 93, 1, 37, 1, 224, 0, 169, 0, 122, 0, 83, 0, 58, 0, 39, 0, 26, 0, 27, 0, 33, 0, 41, 0, 51, 0, 70, 0, 95, 0, 128, 0, 154, 0, 163, 0, 155, 0, 128, 0,
-105, 0, 82, 0, 60, 0, 10, 0, 192, 255, 82, 255, 214, 254, 90, 254, 232, 253, 117, 253, 249, 252, 113, 252, 227, 251, 97, 251, 238, 250, 166, 250, 114, 250, 81, 250, 83, 250, 110, 250, 155, 250, 220, 250, 49, 251, 149, 251, 10, 252, 160, 252, 59, 253, 216, 253, 103, 254, 239, 254, 115, 255, 8, 0,
-158, 0, 47, 1, 166, 1, 240, 1, 36, 2, 71, 2, 100, 2, 125, 2, 146, 2, 126, 2, 90, 2, 40, 2, 239, 1, 191, 1, 150, 1, 112, 1, 82, 1, 59, 1, 45, 1, 32, 1, 23, 1, 19, 1, 21, 1, 34, 1, 61, 1, 85, 1, 98, 1, 98, 1, 83, 1, 73, 1, 69, 1, 74, 1,
-54, 1, 12, 1, 197, 0, 110, 0, 27, 0, 214, 255, 154, 255, 92, 255, 26, 255, 207, 254, 142, 254, 89, 254, 60, 254, 46, 254, 44, 254, 59, 254, 87, 254, 123, 254, 166, 254, 213, 254, 8, 255, 66, 255, 148, 255, 231, 255, 59, 0, 123, 0, 172, 0, 212, 0, 252, 0, 36, 1, 64, 1, 62, 1,
-17, 1, 205, 0, 117, 0, 39, 0, 219, 255, 145, 255, 59, 255, 221, 254, 123, 254, 41, 254, 235, 253, 190, 253, 168, 253, 164, 253, 173, 253, 203, 253, 247, 253, 45, 254, 108, 254, 194, 254, 42, 255, 164, 255, 49, 0, 181, 0, 48, 1, 157, 1, 11, 2, 121, 2, 230, 2, 56, 3, 109, 3, 121, 3,
-100, 3, 72, 3, 41, 3, 1, 3, 199, 2, 123, 2, 13, 2, 150, 1, 27, 1, 164, 0, 47, 0, 189, 255, 78, 255, 234, 254, 141, 254, 54, 254, 233, 253, 167, 253, 112, 253, 94, 253, 84, 253, 81, 253, 72, 253, 54, 253, 34, 253, 25, 253, 33, 253, 42, 253, 42, 253, 15, 253, 236, 252, 193, 252,
-176, 252, 173, 252, 184, 252, 200, 252, 209, 252, 217, 252, 235, 252, 9, 253, 48, 253, 106, 253, 175, 253, 254, 253, 89, 254, 190, 254, 37, 255, 139, 255, 255, 255, 124, 0, 5, 1, 148, 1, 18, 2, 127, 2, 203, 2, 12, 3, 69, 3, 120, 3, 141, 3, 132, 3, 86, 3, 5, 3, 177, 2, 94, 2,
-18, 2, 192, 1, 102, 1, 250, 0, 143, 0, 42, 0, 209, 255, 136, 255, 77, 255, 33, 255, 9, 255, 254, 254, 1, 255, 15, 255, 41, 255, 79, 255, 147, 255, 227, 255, 55, 0, 125, 0, 177, 0, 222, 0, 9, 1, 56, 1, 98, 1, 131, 1, 119, 1, 86, 1, 34, 1, 238, 0, 188, 0, 138, 0,
-71, 0, 238, 255, 133, 255, 15, 255, 157, 254, 47, 254, 200, 253, 110, 253, 32, 253, 225, 252, 181, 252, 147, 252, 122, 252, 116, 252, 131, 252, 163, 252, 214, 252, 6, 253, 49, 253, 84, 253, 128, 253, 183, 253, 1, 254, 73, 254, 136, 254, 185, 254, 212, 254, 247, 254, 37, 255, 97, 255, 158, 255, 214, 255,
-250, 255, 23, 0, 49, 0, 79, 0, 118, 0, 162, 0, 215, 0, 21, 1, 86, 1, 154, 1, 217, 1, 23, 2, 86, 2, 159, 2, 233, 2, 46, 3, 88, 3, 103, 3, 100, 3, 79, 3, 65, 3, 41, 3, 2, 3, 177, 2, 73, 2, 203, 1, 75, 1, 209, 0, 91, 0, 226, 255, 89, 255, 202, 254,
-60, 254, 185, 253, 69, 253, 233, 252, 167, 252, 121, 252, 96, 252, 95, 252, 103, 252, 121, 252, 157, 252, 213, 252, 30, 253, 127, 253, 220, 253, 50, 254, 124, 254, 199, 254, 26, 255, 123, 255, 221, 255, 46, 0, 108, 0, 132, 0, 151, 0, 165, 0, 184, 0, 195, 0, 194, 0, 169, 0, 133, 0, 94, 0,
-55, 0, 26, 0, 6, 0, 250, 255, 253, 255, 5, 0, 19, 0, 30, 0, 45, 0, 66, 0, 101, 0, 151, 0, 202, 0, 243, 0, 14, 1, 33, 1, 45, 1, 78, 1, 112, 1, 145, 1, 146, 1, 129, 1, 96, 1, 58, 1, 31, 1, 10, 1, 241, 0, 203, 0, 156, 0, 98, 0, 43, 0, 250, 255,
-207, 255, 178, 255, 154, 255, 136, 255, 123, 255, 107, 255, 88, 255, 71, 255, 66, 255, 72, 255, 89, 255, 103, 255, 107, 255, 93, 255, 75, 255, 61, 255, 53, 255, 46, 255, 19, 255, 224, 254, 141, 254, 50, 254, 213, 253, 138, 253, 65, 253, 247, 252, 167, 252, 85, 252, 7, 252, 196, 251, 159, 251, 136, 251,
-129, 251, 148, 251, 178, 251, 218, 251, 11, 252, 69, 252, 140, 252, 238, 252, 104, 253, 238, 253, 119, 254, 246, 254, 113, 255, 234, 255, 119, 0, 6, 1, 148, 1, 2, 2, 83, 2, 140, 2, 181, 2, 221, 2, 3, 3, 37, 3, 46, 3, 38, 3, 11, 3, 228, 2, 188, 2, 150, 2, 110, 2, 72, 2,
-36, 2, 250, 1, 202, 1, 150, 1, 94, 1, 50, 1, 17, 1, 253, 0, 232, 0, 202, 0, 158, 0, 108, 0, 64, 0, 29, 0, 8, 0, 230, 255, 184, 255, 114, 255, 43, 255, 235, 254, 194, 254, 163, 254, 138, 254, 114, 254, 80, 254, 49, 254, 24, 254, 11, 254, 11, 254, 21, 254, 47, 254, 76, 254,
-109, 254, 145, 254, 180, 254, 222, 254, 27, 255, 101, 255, 181, 255, 6, 0, 63, 0, 109, 0, 144, 0, 183, 0, 223, 0, 4, 1, 8, 1, 242, 0, 202, 0, 148, 0, 104, 0, 66, 0, 35, 0, 253, 255, 204, 255, 142, 255, 84, 255, 32, 255, 242, 254, 215, 254, 197, 254, 188, 254, 188, 254, 192, 254,
-202, 254, 221, 254, 8, 255, 68, 255, 152, 255, 246, 255, 78, 0, 158, 0, 226, 0, 42, 1, 117, 1, 201, 1, 10, 2, 56, 2, 67, 2, 60, 2, 45, 2, 33, 2, 16, 2, 246, 1, 201, 1, 119, 1, 23, 1, 172, 0, 62, 0, 209, 255, 103, 255, 1, 255, 156, 254, 55, 254, 210, 253, 115, 253,
-30, 253, 218, 252, 177, 252, 144, 252, 117, 252, 82, 252, 45, 252, 8, 252, 254, 251, 6, 252, 28, 252, 53, 252, 71, 252, 84, 252, 97, 252, 136, 252, 191, 252, 6, 253, 81, 253, 148, 253, 206, 253, 5, 254, 64, 254, 128, 254, 209, 254, 40, 255, 131, 255, 227, 255, 61, 0, 149, 0, 237, 0, 74, 1,
-174, 1, 27, 2, 130, 2, 215, 2, 27, 3, 60, 3, 88, 3, 113, 3, 138, 3, 146, 3, 136, 3, 93, 3, 29, 3, 216, 2, 153, 2, 96, 2, 35, 2, 221, 1, 130, 1, 31, 1, 181, 0, 90, 0, 7, 0, 188, 255, 131, 255, 80, 255, 34, 255, 251, 254, 219, 254, 197, 254, 190, 254, 208, 254,
-236, 254, 14, 255, 40, 255, 60, 255, 75, 255, 105, 255, 149, 255, 200, 255, 248, 255, 10, 0, 14, 0, 5, 0, 251, 255, 245, 255, 246, 255, 226, 255, 190, 255, 136, 255, 56, 255, 237, 254, 167, 254, 104, 254, 51, 254, 3, 254, 212, 253, 167, 253, 124, 253, 84, 253, 61, 253, 52, 253, 57, 253, 80, 253,
-101, 253, 119, 253, 138, 253, 169, 253, 215, 253, 41, 254, 128, 254, 213, 254, 28, 255, 88, 255, 150, 255, 220, 255, 51, 0, 136, 0, 216, 0, 13, 1, 54, 1, 86, 1, 119, 1, 154, 1, 193, 1, 234, 1, 10, 2, 34, 2, 50, 2, 52, 2, 52, 2, 51, 2, 55, 2, 61, 2, 65, 2, 44, 2,
-9, 2, 218, 1, 167, 1, 128, 1, 94, 1, 51, 1, 241, 0, 159, 0, 59, 0, 219, 255, 133, 255, 58, 255, 239, 254, 153, 254, 58, 254, 211, 253, 120, 253, 39, 253, 235, 252, 191, 252, 156, 252, 126, 252, 106, 252, 89, 252, 78, 252, 87, 252, 112, 252, 155, 252, 224, 252, 39, 253, 111, 253, 183, 253,
-8, 254, 99, 254, 216, 254, 81, 255, 195, 255, 32, 0, 102, 0, 167, 0, 227, 0, 44, 1, 110, 1, 168, 1, 198, 1, 211, 1, 211, 1, 214, 1, 216, 1, 218, 1, 219, 1, 208, 1, 190, 1, 162, 1, 126, 1, 92, 1, 59, 1, 40, 1, 28, 1, 22, 1, 10, 1, 247, 0, 226, 0, 212, 0,
-217, 0, 231, 0, 255, 0, 2, 1, 249, 0, 226, 0, 207, 0, 197, 0, 197, 0, 197, 0, 183, 0, 156, 0, 108, 0, 60, 0, 15, 0, 230, 255, 190, 255, 147, 255, 98, 255, 45, 255, 245, 254, 187, 254, 137, 254, 96, 254, 67, 254, 54, 254, 39, 254, 23, 254, 254, 253, 231, 253, 216, 253, 219, 253,
-231, 253, 237, 253, 229, 253, 199, 253, 169, 253, 143, 253, 139, 253, 142, 253, 147, 253, 136, 253, 116, 253, 94, 253, 74, 253, 66, 253, 65, 253, 67, 253, 69, 253, 73, 253, 79, 253, 90, 253, 110, 253, 139, 253, 198, 253, 16, 254, 104, 254, 202, 254, 40, 255, 134, 255, 234, 255, 95, 0, 222, 0, 99, 1,
-213, 1, 54, 2, 132, 2, 200, 2, 17, 3, 95, 3, 162, 3, 207, 3, 231, 3, 220, 3, 195, 3, 162, 3, 119, 3, 60, 3, 247, 2, 164, 2, 65, 2, 215, 1, 103, 1, 247, 0, 141, 0, 42, 0, 219, 255, 139, 255, 58, 255, 232, 254, 150, 254, 79, 254, 33, 254, 10, 254, 247, 253, 228, 253,
-200, 253, 179, 253, 166, 253, 182, 253, 208, 253, 241, 253, 6, 254, 17, 254, 24, 254, 32, 254, 47, 254, 66, 254, 89, 254, 107, 254, 126, 254, 146, 254, 169, 254, 194, 254, 225, 254, 14, 255, 69, 255, 130, 255, 193, 255, 242, 255, 28, 0, 68, 0, 117, 0, 174, 0, 243, 0, 37, 1, 74, 1, 97, 1,
-112, 1, 135, 1, 164, 1, 194, 1, 205, 1, 198, 1, 168, 1, 125, 1, 77, 1, 30, 1, 235, 0, 182, 0, 125, 0, 67, 0, 12, 0, 218, 255, 175, 255, 148, 255, 134, 255, 141, 255, 162, 255, 186, 255, 203, 255, 222, 255, 250, 255, 40, 0, 104, 0, 168, 0, 228, 0, 5, 1, 31, 1, 53, 1,
-78, 1, 102, 1, 118, 1, 103, 1, 60, 1, 0, 1, 175, 0, 89, 0, 251, 255, 144, 255, 30, 255, 167, 254, 42, 254, 173, 253, 50, 253, 186, 252, 77, 252, 245, 251, 171, 251, 109, 251, 57, 251, 14, 251, 235, 250, 242, 250, 19, 251, 78, 251, 162, 251, 245, 251, 71, 252, 165, 252, 18, 253, 140, 253,
-20, 254, 147, 254, 9, 255, 110, 255, 203, 255, 37, 0, 125, 0, 208, 0, 28, 1, 98, 1, 162, 1, 219, 1, 14, 2, 56, 2, 96, 2, 135, 2, 179, 2, 218, 2, 249, 2, 9, 3, 7, 3, 6, 3, 11, 3, 27, 3, 42, 3, 53, 3, 31, 3, 1, 3, 222, 2, 185, 2, 150, 2, 111, 2,
-51, 2, 226, 1, 132, 1, 27, 1, 176, 0, 69, 0, 215, 255, 103, 255, 249, 254, 143, 254, 42, 254, 201, 253, 112, 253, 39, 253, 245, 252, 211, 252, 199, 252, 196, 252, 200, 252, 213, 252, 254, 252, 61, 253, 147, 253, 240, 253, 70, 254, 148, 254, 212, 254, 22, 255, 90, 255, 159, 255, 212, 255, 249, 255,
-6, 0, 255, 255, 240, 255, 219, 255, 185, 255, 144, 255, 96, 255, 39, 255, 233, 254, 168, 254, 99, 254, 35, 254, 235, 253, 203, 253, 189, 253, 184, 253, 188, 253, 204, 253, 237, 253, 32, 254, 130, 254, 240, 254, 104, 255, 214, 255, 64, 0, 167, 0, 17, 1, 132, 1, 244, 1, 87, 2, 165, 2, 225, 2,
-10, 3, 32, 3, 40, 3, 36, 3, 9, 3, 228, 2, 182, 2, 114, 2, 37, 2, 210, 1, 118, 1, 38, 1, 221, 0, 154, 0, 88, 0, 18, 0, 198, 255, 142, 255, 100, 255, 73, 255, 63, 255, 42, 255, 15, 255, 235, 254, 201, 254, 172, 254, 157, 254, 137, 254, 109, 254, 73, 254, 23, 254, 225, 253,
-169, 253, 111, 253, 51, 253, 246, 252, 191, 252, 139, 252, 90, 252, 46, 252, 20, 252, 9, 252, 22, 252, 73, 252, 139, 252, 214, 252, 50, 253, 154, 253, 15, 254, 168, 254, 76, 255, 245, 255, 144, 0, 32, 1, 169, 1, 42, 2, 174, 2, 46, 3, 161, 3, 245, 3, 52, 4, 91, 4, 96, 4, 84, 4,
-57, 4, 2, 4, 186, 3, 102, 3, 0, 3, 142, 2, 24, 2, 161, 1, 57, 1, 223, 0, 150, 0, 85, 0, 24, 0, 223, 255, 184, 255, 168, 255, 172, 255, 197, 255, 221, 255, 241, 255, 250, 255, 6, 0, 21, 0, 43, 0, 66, 0, 78, 0, 76, 0, 43, 0, 254, 255, 197, 255, 125, 255, 46, 255,
-217, 254, 127, 254, 32, 254, 190, 253, 91, 253, 253, 252, 171, 252, 106, 252, 70, 252, 46, 252, 32, 252, 22, 252, 25, 252, 42, 252, 89, 252, 160, 252, 244, 252, 67, 253, 144, 253, 217, 253, 29, 254, 111, 254, 196, 254, 23, 255, 88, 255, 134, 255, 160, 255, 160, 255, 151, 255, 133, 255, 103, 255, 70, 255,
-37, 255, 1, 255, 219, 254, 186, 254, 163, 254, 161, 254, 180, 254, 223, 254, 25, 255, 91, 255, 163, 255, 247, 255, 95, 0, 216, 0, 107, 1, 250, 1, 131, 2, 255, 2, 108, 3, 212, 3, 58, 4, 145, 4, 209, 4, 250, 4, 230, 4, 187, 4, 120, 4, 16, 4, 154, 3, 23, 3, 124, 2, 218, 1,
-48, 1, 117, 0, 195, 255, 23, 255, 113, 254, 240, 253, 123, 253, 16, 253, 184, 252, 108, 252, 48, 252, 31, 252, 45, 252, 80, 252, 135, 252, 186, 252, 240, 252, 44, 253, 119, 253, 202, 253, 36, 254, 114, 254, 176, 254, 221, 254, 248, 254, 12, 255, 28, 255, 40, 255, 50, 255, 56, 255, 59, 255, 57, 255,
-54, 255, 51, 255, 65, 255, 90, 255, 126, 255, 180, 255, 234, 255, 33, 0, 97, 0, 180, 0, 24, 1, 145, 1, 15, 2, 133, 2, 228, 2, 49, 3, 117, 3, 178, 3, 226, 3, 254, 3, 2, 4, 208, 3, 133, 3, 39, 3, 180, 2, 59, 2, 189, 1, 54, 1, 175, 0, 40, 0, 159, 255, 32, 255,
-173, 254, 73, 254, 8, 254, 218, 253, 187, 253, 167, 253, 160, 253, 165, 253, 202, 253, 14, 254, 97, 254, 190, 254, 17, 255, 91, 255, 152, 255, 217, 255, 25, 0, 88, 0, 123, 0, 130, 0, 111, 0, 52, 0, 232, 255, 142, 255, 39, 255, 175, 254, 45, 254, 160, 253, 9, 253, 110, 252, 211, 251, 77, 251,
-220, 250, 131, 250, 83, 250, 56, 250, 48, 250, 70, 250, 134, 250, 230, 250, 114, 251, 27, 252, 202, 252, 120, 253, 30, 254, 200, 254, 117, 255, 41, 0, 209, 0, 109, 1, 228, 1, 65, 2, 138, 2, 199, 2, 244, 2, 25, 3, 55, 3, 64, 3, 64, 3, 55, 3, 29, 3, 2, 3, 232, 2, 217, 2,
-207, 2, 201, 2, 194, 2, 183, 2, 174, 2, 178, 2, 202, 2, 233, 2, 12, 3, 24, 3, 20, 3, 1, 3, 227, 2, 199, 2, 170, 2, 117, 2, 40, 2, 197, 1, 65, 1, 178, 0, 29, 0, 130, 255, 227, 254, 66, 254, 158, 253, 255, 252, 105, 252, 218, 251, 106, 251, 21, 251, 222, 250, 210, 250,
-225, 250, 3, 251, 57, 251, 146, 251, 4, 252, 153, 252, 68, 253, 239, 253, 146, 254, 32, 255, 170, 255, 47, 0, 182, 0, 46, 1, 147, 1, 208, 1, 233, 1, 236, 1, 216, 1, 178, 1, 126, 1, 57, 1, 225, 0, 126, 0, 19, 0, 162, 255, 56, 255, 215, 254, 146, 254, 102, 254, 77, 254, 73, 254,
-83, 254, 110, 254, 163, 254, 0, 255, 112, 255, 245, 255, 118, 0, 238, 0, 94, 1, 204, 1, 62, 2, 176, 2, 19, 3, 84, 3, 122, 3, 115, 3, 80, 3, 26, 3, 206, 2, 107, 2, 250, 1, 123, 1, 235, 0, 88, 0, 193, 255, 47, 255, 177, 254, 68, 254, 241, 253, 177, 253, 124, 253, 77, 253,
-56, 253, 53, 253, 73, 253, 121, 253, 169, 253, 213, 253, 241, 253, 11, 254, 37, 254, 76, 254, 108, 254, 127, 254, 125, 254, 94, 254, 48, 254, 250, 253, 187, 253, 122, 253, 54, 253, 247, 252, 185, 252, 127, 252, 87, 252, 60, 252, 48, 252, 74, 252, 130, 252, 208, 252, 54, 253, 170, 253, 41, 254, 185, 254,
-107, 255, 46, 0, 3, 1, 208, 1, 146, 2, 75, 3, 246, 3, 160, 4, 67, 5, 207, 5, 49, 6, 111, 6, 120, 6, 88, 6, 29, 6, 195, 5, 77, 5, 193, 4, 32, 4, 114, 3, 188, 2, 0, 2, 77, 1, 170, 0, 23, 0, 165, 255, 72, 255, 250, 254, 186, 254, 147, 254, 131, 254, 141, 254,
-190, 254, 242, 254, 37, 255, 79, 255, 117, 255, 153, 255, 197, 255, 234, 255, 3, 0, 0, 0, 218, 255, 161, 255, 83, 255, 249, 254, 152, 254, 49, 254, 197, 253, 88, 253, 234, 252, 132, 252, 38, 252, 210, 251, 151, 251, 123, 251, 115, 251, 128, 251, 159, 251, 202, 251, 3, 252, 105, 252, 225, 252, 106, 253,
-2, 254, 143, 254, 18, 255, 144, 255, 12, 0, 135, 0, 246, 0, 69, 1, 122, 1, 137, 1, 121, 1, 88, 1, 37, 1, 229, 0, 156, 0, 72, 0, 244, 255, 160, 255, 77, 255, 7, 255, 213, 254, 181, 254, 183, 254, 211, 254, 253, 254, 53, 255, 126, 255, 219, 255, 77, 0, 224, 0, 118, 1, 14, 2,
-147, 2, 9, 3, 117, 3, 211, 3, 29, 4, 82, 4, 97, 4, 58, 4, 246, 3, 147, 3, 16, 3, 124, 2, 219, 1, 35, 1, 102, 0, 164, 255, 221, 254, 27, 254, 97, 253, 183, 252, 46, 252, 188, 251, 100, 251, 39, 251, 254, 250, 231, 250, 8, 251, 70, 251, 159, 251, 21, 252, 139, 252, 1, 253,
-120, 253, 243, 253, 114, 254, 242, 254, 93, 255, 181, 255, 246, 255, 27, 0, 52, 0, 66, 0, 67, 0, 62, 0, 52, 0, 36, 0, 20, 0, 4, 0, 245, 255, 244, 255, 1, 0, 33, 0, 93, 0, 163, 0, 243, 0, 78, 1, 182, 1, 45, 2, 184, 2, 70, 3, 209, 3, 62, 4, 150, 4, 222, 4,
-14, 5, 45, 5, 53, 5, 27, 5, 208, 4, 107, 4, 235, 3, 80, 3, 169, 2, 248, 1, 60, 1, 125, 0, 189, 255, 254, 254, 73, 254, 159, 253, 10, 253, 153, 252, 67, 252, 13, 252, 246, 251, 239, 251, 250, 251, 45, 252, 124, 252, 228, 252, 98, 253, 221, 253, 82, 254, 190, 254, 34, 255, 127, 255,
-217, 255, 20, 0, 55, 0, 63, 0, 21, 0, 216, 255, 138, 255, 31, 255, 168, 254, 39, 254, 153, 253, 9, 253, 121, 252, 236, 251, 116, 251, 15, 251, 201, 250, 179, 250, 181, 250, 207, 250, 17, 251, 106, 251, 218, 251, 124, 252, 50, 253, 241, 253, 180, 254, 109, 255, 33, 0, 206, 0, 120, 1, 26, 2,
-175, 2, 29, 3, 116, 3, 180, 3, 208, 3, 221, 3, 219, 3, 193, 3, 155, 3, 105, 3, 39, 3, 223, 2, 149, 2, 74, 2, 17, 2, 228, 1, 197, 1, 183, 1, 173, 1, 165, 1, 171, 1, 192, 1, 225, 1, 13, 2, 49, 2, 74, 2, 78, 2, 67, 2, 47, 2, 19, 2, 222, 1, 151, 1,
-59, 1, 179, 0, 32, 0, 130, 255, 211, 254, 36, 254, 116, 253, 197, 252, 31, 252, 131, 251, 247, 250, 136, 250, 54, 250, 7, 250, 15, 250, 53, 250, 120, 250, 216, 250, 81, 251, 225, 251, 143, 252, 88, 253, 43, 254, 251, 254, 195, 255, 128, 0, 46, 1, 209, 1, 103, 2, 235, 2, 66, 3, 121, 3,
-145, 3, 123, 3, 77, 3, 10, 3, 173, 2, 62, 2, 196, 1, 67, 1, 187, 0, 55, 0, 190, 255, 90, 255, 15, 255, 220, 254, 204, 254, 203, 254, 216, 254, 1, 255, 66, 255, 151, 255, 9, 0, 127, 0, 243, 0, 94, 1, 187, 1, 17, 2, 99, 2, 160, 2, 201, 2, 220, 2, 187, 2, 127, 2,
-43, 2, 187, 1, 57, 1, 173, 0, 22, 0, 120, 255, 218, 254, 62, 254, 168, 253, 34, 253, 174, 252, 93, 252, 35, 252, 254, 251, 238, 251, 239, 251, 254, 251, 45, 252, 116, 252, 201, 252, 44, 253, 131, 253, 213, 253, 33, 254, 100, 254, 162, 254, 217, 254, 245, 254, 252, 254, 239, 254, 197, 254, 144, 254,
-83, 254, 15, 254, 206, 253, 145, 253, 87, 253, 44, 253, 12, 253, 248, 252, 9, 253, 50, 253, 116, 253, 223, 253, 88, 254, 222, 254, 121, 255, 37, 0, 227, 0, 186, 1, 152, 2, 114, 3, 66, 4, 246, 4, 154, 5, 45, 6, 160, 6, 242, 6, 36, 7, 25, 7, 225, 6, 135, 6, 9, 6, 107, 5,
-190, 4, 3, 4, 53, 3, 101, 2, 152, 1, 202, 0, 11, 0, 92, 255, 207, 254, 93, 254, 2, 254, 195, 253, 152, 253, 128, 253, 133, 253, 171, 253, 227, 253, 47, 254, 117, 254, 182, 254, 242, 254, 33, 255, 77, 255, 116, 255, 133, 255, 124, 255, 94, 255, 34, 255, 211, 254, 122, 254, 27, 254, 182, 253,
-81, 253, 238, 252, 144, 252, 57, 252, 235, 251, 182, 251, 152, 251, 145, 251, 177, 251, 230, 251, 43, 252, 131, 252, 242, 252, 118, 253, 20, 254, 196, 254, 116, 255, 32, 0, 180, 0, 58, 1, 182, 1, 29, 2, 111, 2, 173, 2, 191, 2, 172, 2, 129, 2, 61, 2, 228, 1, 130, 1, 25, 1, 169, 0,
-57, 0, 202, 255, 99, 255, 8, 255, 187, 254, 148, 254, 134, 254, 142, 254, 180, 254, 232, 254, 42, 255, 128, 255, 244, 255, 117, 0, 4, 1, 140, 1, 4, 2, 108, 2, 186, 2, 250, 2, 42, 3, 60, 3, 41, 3, 249, 2, 156, 2, 32, 2, 145, 1, 238, 0, 63, 0, 137, 255, 203, 254, 18, 254,
-90, 253, 165, 252, 7, 252, 128, 251, 18, 251, 211, 250, 180, 250, 174, 250, 198, 250, 253, 250, 77, 251, 191, 251, 85, 252, 243, 252, 150, 253, 47, 254, 191, 254, 70, 255, 208, 255, 76, 0, 187, 0, 22, 1, 80, 1, 117, 1, 134, 1, 133, 1, 123, 1, 106, 1, 77, 1, 46, 1, 13, 1, 240, 0,
-215, 0, 196, 0, 202, 0, 232, 0, 24, 1, 97, 1, 177, 1, 9, 2, 109, 2, 222, 2, 89, 3, 224, 3, 84, 4, 180, 4, 0, 5, 38, 5, 55, 5, 54, 5, 27, 5, 217, 4, 122, 4, 242, 3, 72, 3, 143, 2, 196, 1, 240, 0, 25, 0, 62, 255, 105, 254, 157, 253, 218, 252, 47, 252,
-161, 251, 47, 251, 231, 250, 201, 250, 194, 250, 210, 250, 2, 251, 72, 251, 166, 251, 43, 252, 184, 252, 74, 253, 203, 253, 65, 254, 175, 254, 15, 255, 101, 255, 172, 255, 210, 255, 209, 255, 181, 255, 120, 255, 35, 255, 193, 254, 80, 254, 214, 253, 90, 253, 220, 252, 104, 252, 255, 251, 163, 251, 105, 251,
-87, 251, 96, 251, 142, 251, 219, 251, 57, 252, 167, 252, 62, 253, 232, 253, 164, 254, 114, 255, 53, 0, 237, 0, 148, 1, 50, 2, 200, 2, 84, 3, 196, 3, 27, 4, 78, 4, 87, 4, 75, 4, 40, 4, 236, 3, 160, 3, 72, 3, 230, 2, 125, 2, 17, 2, 169, 1, 78, 1, 0, 1, 204, 0,
-177, 0, 162, 0, 155, 0, 160, 0, 174, 0, 197, 0, 251, 0, 50, 1, 105, 1, 141, 1, 158, 1, 160, 1, 148, 1, 123, 1, 85, 1, 25, 1, 184, 0, 65, 0, 177, 255, 20, 255, 111, 254, 197, 253, 36, 253, 137, 252, 245, 251, 121, 251, 16, 251, 186, 250, 138, 250, 134, 250, 162, 250, 233, 250,
-81, 251, 203, 251, 88, 252, 5, 253, 200, 253, 161, 254, 136, 255, 104, 0, 62, 1, 251, 1, 169, 2, 76, 3, 221, 3, 76, 4, 155, 4, 193, 4, 172, 4, 123, 4, 49, 4, 194, 3, 71, 3, 194, 2, 46, 2, 154, 1, 7, 1, 125, 0, 1, 0, 150, 255, 73, 255, 32, 255, 9, 255, 6, 255,
-21, 255, 52, 255, 100, 255, 182, 255, 22, 0, 126, 0, 219, 0, 42, 1, 108, 1, 157, 1, 198, 1, 223, 1, 225, 1, 182, 1, 112, 1, 16, 1, 141, 0, 0, 0, 106, 255, 200, 254, 35, 254, 125, 253, 219, 252, 65, 252, 178, 251, 56, 251, 225, 250, 165, 250, 137, 250, 143, 250, 163, 250, 198, 250,
-13, 251, 107, 251, 222, 251, 109, 252, 248, 252, 125, 253, 240, 253, 90, 254, 187, 254, 17, 255, 87, 255, 136, 255, 155, 255, 138, 255, 106, 255, 58, 255, 3, 255, 202, 254, 145, 254, 93, 254, 49, 254, 13, 254, 247, 253, 243, 253, 3, 254, 47, 254, 130, 254, 233, 254, 100, 255, 243, 255, 143, 0, 57, 1,
-2, 2, 216, 2, 179, 3, 130, 4, 53, 5, 210, 5, 82, 6, 181, 6, 0, 7, 46, 7, 28, 7, 229, 6, 136, 6, 248, 5, 85, 5, 160, 4, 213, 3, 4, 3, 47, 2, 84, 1, 130, 0, 182, 255, 248, 254, 90, 254, 217, 253, 118, 253, 60, 253, 20, 253, 253, 252, 7, 253, 44, 253, 104, 253,
-195, 253, 33, 254, 126, 254, 206, 254, 16, 255, 76, 255, 129, 255, 169, 255, 188, 255, 184, 255, 142, 255, 83, 255, 9, 255, 179, 254, 86, 254, 245, 253, 148, 253, 54, 253, 221, 252, 141, 252, 78, 252, 34, 252, 15, 252, 43, 252, 95, 252, 170, 252, 14, 253, 129, 253, 3, 254, 163, 254, 85, 255, 15, 0,
-195, 0, 96, 1, 235, 1, 95, 2, 192, 2, 18, 3, 83, 3, 96, 3, 79, 3, 34, 3, 203, 2, 100, 2, 241, 1, 111, 1, 232, 0, 95, 0, 215, 255, 83, 255, 216, 254, 105, 254, 23, 254, 224, 253, 197, 253, 206, 253, 234, 253, 22, 254, 85, 254, 171, 254, 20, 255, 147, 255, 17, 0, 136, 0,
-235, 0, 51, 1, 111, 1, 160, 1, 181, 1, 180, 1, 155, 1, 73, 1, 224, 0, 98, 0, 204, 255, 43, 255, 131, 254, 214, 253, 41, 253, 129, 252, 226, 251, 88, 251, 229, 250, 138, 250, 109, 250, 110, 250, 139, 250, 202, 250, 33, 251, 139, 251, 22, 252, 194, 252, 125, 253, 63, 254, 249, 254, 169, 255,
-75, 0, 230, 0, 121, 1, 4, 2, 111, 2, 191, 2, 245, 2, 8, 3, 6, 3, 245, 2, 212, 2, 166, 2, 112, 2, 53, 2, 247, 1, 187, 1, 133, 1, 101, 1, 91, 1, 102, 1, 145, 1, 201, 1, 10, 2, 83, 2, 172, 2, 16, 3, 129, 3, 241, 3, 84, 4, 161, 4, 204, 4, 228, 4,
-236, 4, 216, 4, 171, 4, 99, 4, 232, 3, 78, 3, 157, 2, 214, 1, 2, 1, 41, 0, 78, 255, 120, 254, 170, 253, 231, 252, 58, 252, 163, 251, 36, 251, 216, 250, 173, 250, 159, 250, 179, 250, 220, 250, 24, 251, 116, 251, 237, 251, 119, 252, 14, 253, 155, 253, 28, 254, 144, 254, 246, 254, 82, 255,
-164, 255, 209, 255, 224, 255, 212, 255, 158, 255, 81, 255, 247, 254, 142, 254, 29, 254, 171, 253, 60, 253, 212, 252, 119, 252, 40, 252, 248, 251, 230, 251, 240, 251, 40, 252, 117, 252, 211, 252, 69, 253, 206, 253, 106, 254, 33, 255, 229, 255, 167, 0, 100, 1, 6, 2, 159, 2, 46, 3, 170, 3, 14, 4,
-91, 4, 119, 4, 106, 4, 65, 4, 249, 3, 151, 3, 38, 3, 168, 2, 31, 2, 148, 1, 9, 1, 127, 0, 3, 0, 148, 255, 68, 255, 16, 255, 240, 254, 228, 254, 229, 254, 243, 254, 20, 255, 80, 255, 152, 255, 236, 255, 53, 0, 112, 0, 157, 0, 184, 0, 202, 0, 211, 0, 194, 0, 148, 0,
-80, 0, 234, 255, 115, 255, 243, 254, 109, 254, 234, 253, 106, 253, 240, 252, 138, 252, 46, 252, 223, 251, 180, 251, 166, 251, 181, 251, 243, 251, 78, 252, 187, 252, 62, 253, 219, 253, 141, 254, 87, 255, 55, 0, 21, 1, 239, 1, 173, 2, 92, 3, 253, 3, 132, 4, 240, 4, 65, 5, 93, 5, 71, 5,
-17, 5, 186, 4, 68, 4, 193, 3, 51, 3, 154, 2, 0, 2, 102, 1, 209, 0, 73, 0, 205, 255, 117, 255, 56, 255, 17, 255, 5, 255, 11, 255, 29, 255, 63, 255, 130, 255, 213, 255, 55, 0, 149, 0, 227, 0, 33, 1, 77, 1, 105, 1, 120, 1, 114, 1, 72, 1, 3, 1, 158, 0, 25, 0,
-136, 255, 235, 254, 64, 254, 148, 253, 231, 252, 63, 252, 160, 251, 9, 251, 140, 250, 42, 250, 227, 249, 205, 249, 212, 249, 243, 249, 45, 250, 128, 250, 234, 250, 113, 251, 19, 252, 185, 252, 96, 253, 242, 253, 121, 254, 246, 254, 103, 255, 200, 255, 25, 0, 75, 0, 91, 0, 87, 0, 63, 0, 23, 0,
-233, 255, 182, 255, 128, 255, 77, 255, 26, 255, 243, 254, 213, 254, 196, 254, 211, 254, 1, 255, 68, 255, 165, 255, 27, 0, 155, 0, 41, 1, 215, 1, 142, 2, 77, 3, 10, 4, 175, 4, 62, 5, 171, 5, 0, 6, 63, 6, 95, 6, 79, 6, 31, 6, 195, 5, 59, 5, 159, 4, 241, 3, 42, 3,
-95, 2, 142, 1, 185, 0, 235, 255, 36, 255, 110, 254, 213, 253, 84, 253, 251, 252, 202, 252, 173, 252, 165, 252, 191, 252, 236, 252, 45, 253, 154, 253, 11, 254, 126, 254, 230, 254, 67, 255, 152, 255, 227, 255, 34, 0, 83, 0, 108, 0, 98, 0, 65, 0, 9, 0, 189, 255, 102, 255, 7, 255, 162, 254,
-62, 254, 220, 253, 128, 253, 51, 253, 245, 252, 210, 252, 214, 252, 245, 252, 52, 253, 138, 253, 238, 253, 97, 254, 238, 254, 139, 255, 55, 0, 226, 0, 125, 1, 10, 2, 125, 2, 221, 2, 46, 3, 107, 3, 130, 3, 127, 3, 89, 3, 7, 3, 163, 2, 47, 2, 167, 1, 24, 1, 132, 0, 236, 255,
-92, 255, 209, 254, 81, 254, 236, 253, 157, 253, 110, 253, 99, 253, 108, 253, 135, 253, 181, 253, 244, 253, 69, 254, 177, 254, 35, 255, 150, 255, 248, 255, 71, 0, 136, 0, 185, 0, 214, 0, 225, 0, 212, 0, 152, 0, 67, 0, 216, 255, 77, 255, 186, 254, 31, 254, 123, 253, 220, 252, 68, 252, 184, 251,
-65, 251, 221, 250, 153, 250, 130, 250, 138, 250, 183, 250, 6, 251, 104, 251, 219, 251, 118, 252, 38, 253, 234, 253, 194, 254, 147, 255, 92, 0, 23, 1, 200, 1, 112, 2, 10, 3, 136, 3, 234, 3, 44, 4, 60, 4, 55, 4, 26, 4, 224, 3, 153, 3, 72, 3, 234, 2, 140, 2, 47, 2, 214, 1,
-143, 1, 88, 1, 55, 1, 59, 1, 74, 1, 99, 1, 144, 1, 198, 1, 7, 2, 95, 2, 191, 2, 29, 3, 107, 3, 163, 3, 205, 3, 226, 3, 229, 3, 213, 3, 171, 3, 84, 3, 226, 2, 86, 2, 171, 1, 249, 0, 63, 0, 123, 255, 188, 254, 1, 254, 76, 253, 170, 252, 23, 252, 154, 251,
-71, 251, 16, 251, 247, 250, 3, 251, 31, 251, 76, 251, 154, 251, 3, 252, 127, 252, 14, 253, 155, 253, 34, 254, 149, 254, 249, 254, 82, 255, 159, 255, 204, 255, 225, 255, 219, 255, 168, 255, 98, 255, 12, 255, 168, 254, 63, 254, 212, 253, 108, 253, 14, 253, 185, 252, 111, 252, 67, 252, 42, 252, 41, 252,
-94, 252, 165, 252, 252, 252, 111, 253, 242, 253, 134, 254, 59, 255, 253, 255, 196, 0, 136, 1, 53, 2, 211, 2, 97, 3, 217, 3, 61, 4, 138, 4, 158, 4, 144, 4, 96, 4, 7, 4, 150, 3, 19, 3, 127, 2, 224, 1, 60, 1, 152, 0, 249, 255, 98, 255, 214, 254, 107, 254, 24, 254, 221, 253,
-197, 253, 187, 253, 193, 253, 226, 253, 28, 254, 104, 254, 204, 254, 49, 255, 143, 255, 224, 255, 33, 0, 91, 0, 141, 0, 168, 0, 175, 0, 161, 0, 111, 0, 43, 0, 218, 255, 126, 255, 27, 255, 182, 254, 84, 254, 246, 253, 159, 253, 84, 253, 29, 253, 252, 252, 244, 252, 28, 253, 90, 253, 174, 253,
-28, 254, 157, 254, 47, 255, 223, 255, 161, 0, 107, 1, 51, 2, 227, 2, 133, 3, 23, 4, 137, 4, 230, 4, 45, 5, 62, 5, 43, 5, 248, 4, 161, 4, 51, 4, 182, 3, 42, 3, 149, 2, 252, 1, 96, 1, 205, 0, 65, 0, 189, 255, 90, 255, 14, 255, 216, 254, 198, 254, 196, 254, 207, 254,
-239, 254, 40, 255, 114, 255, 208, 255, 46, 0, 131, 0, 199, 0, 246, 0, 25, 1, 48, 1, 45, 1, 19, 1, 224, 0, 130, 0, 10, 0, 128, 255, 225, 254, 53, 254, 133, 253, 210, 252, 33, 252, 121, 251, 220, 250, 83, 250, 228, 249, 144, 249, 110, 249, 108, 249, 134, 249, 191, 249, 16, 250, 117, 250,
-251, 250, 157, 251, 74, 252, 254, 252, 165, 253, 66, 254, 212, 254, 90, 255, 216, 255, 75, 0, 156, 0, 212, 0, 246, 0, 246, 0, 231, 0, 204, 0, 161, 0, 108, 0, 53, 0, 253, 255, 199, 255, 152, 255, 114, 255, 106, 255, 120, 255, 157, 255, 231, 255, 61, 0, 160, 0, 21, 1, 155, 1, 46, 2,
-211, 2, 118, 3, 12, 4, 144, 4, 243, 4, 67, 5, 130, 5, 160, 5, 161, 5, 132, 5, 53, 5, 196, 4, 60, 4, 152, 3, 227, 2, 36, 2, 93, 1, 148, 0, 209, 255, 20, 255, 106, 254, 212, 253, 81, 253, 255, 252, 202, 252, 174, 252, 177, 252, 202, 252, 247, 252, 62, 253, 168, 253, 31, 254,
-160, 254, 25, 255, 138, 255, 242, 255, 79, 0, 163, 0, 238, 0, 27, 1, 41, 1, 31, 1, 243, 0, 175, 0, 94, 0, 255, 255, 148, 255, 40, 255, 190, 254, 89, 254, 254, 253, 176, 253, 124, 253, 100, 253, 99, 253, 135, 253, 190, 253, 3, 254, 90, 254, 198, 254, 66, 255, 211, 255, 112, 0, 4, 1,
-142, 1, 1, 2, 102, 2, 189, 2, 4, 3, 47, 3, 66, 3, 46, 3, 245, 2, 165, 2, 60, 2, 191, 1, 56, 1, 167, 0, 17, 0, 127, 255, 240, 254, 107, 254, 248, 253, 151, 253, 86, 253, 52, 253, 37, 253, 43, 253, 66, 253, 103, 253, 161, 253, 245, 253, 85, 254, 192, 254, 28, 255, 108, 255,
-174, 255, 225, 255, 4, 0, 24, 0, 23, 0, 238, 255, 173, 255, 81, 255, 216, 254, 87, 254, 212, 253, 69, 253, 186, 252, 56, 252, 192, 251, 88, 251, 1, 251, 200, 250, 176, 250, 180, 250, 229, 250, 51, 251, 150, 251, 20, 252, 171, 252, 91, 253, 43, 254, 9, 255, 234, 255, 205, 0, 151, 1, 87, 2,
-15, 3, 182, 3, 66, 4, 182, 4, 2, 5, 29, 5, 29, 5, 254, 4, 189, 4, 110, 4, 19, 4, 165, 3, 54, 3, 197, 2, 86, 2, 239, 1, 148, 1, 81, 1, 38, 1, 13, 1, 9, 1, 17, 1, 38, 1, 77, 1, 140, 1, 218, 1, 52, 2, 129, 2, 195, 2, 251, 2, 28, 3, 52, 3,
-64, 3, 50, 3, 4, 3, 191, 2, 89, 2, 217, 1, 77, 1, 179, 0, 13, 0, 103, 255, 192, 254, 29, 254, 131, 253, 244, 252, 118, 252, 22, 252, 204, 251, 165, 251, 155, 251, 163, 251, 192, 251, 247, 251, 67, 252, 165, 252, 33, 253, 158, 253, 25, 254, 129, 254, 220, 254, 45, 255, 114, 255, 163, 255,
-195, 255, 197, 255, 167, 255, 118, 255, 50, 255, 226, 254, 141, 254, 50, 254, 218, 253, 133, 253, 53, 253, 241, 252, 188, 252, 151, 252, 145, 252, 175, 252, 227, 252, 49, 253, 152, 253, 14, 254, 147, 254, 59, 255, 238, 255, 170, 0, 100, 1, 14, 2, 168, 2, 42, 3, 155, 3, 251, 3, 61, 4, 86, 4,
-77, 4, 26, 4, 188, 3, 74, 3, 196, 2, 37, 2, 126, 1, 210, 0, 33, 0, 116, 255, 204, 254, 52, 254, 177, 253, 69, 253, 250, 252, 206, 252, 183, 252, 180, 252, 206, 252, 0, 253, 74, 253, 177, 253, 32, 254, 145, 254, 248, 254, 85, 255, 172, 255, 253, 255, 67, 0, 124, 0, 159, 0, 162, 0,
-147, 0, 113, 0, 56, 0, 248, 255, 178, 255, 98, 255, 20, 255, 199, 254, 129, 254, 72, 254, 29, 254, 10, 254, 26, 254, 65, 254, 128, 254, 214, 254, 58, 255, 174, 255, 61, 0, 221, 0, 138, 1, 54, 2, 212, 2, 101, 3, 222, 3, 67, 4, 153, 4, 220, 4, 245, 4, 244, 4, 214, 4, 139, 4,
-47, 4, 195, 3, 65, 3, 185, 2, 42, 2, 150, 1, 6, 1, 121, 0, 244, 255, 134, 255, 42, 255, 233, 254, 201, 254, 184, 254, 180, 254, 200, 254, 237, 254, 33, 255, 108, 255, 188, 255, 11, 0, 76, 0, 127, 0, 166, 0, 193, 0, 203, 0, 195, 0, 164, 0, 91, 0, 251, 255, 133, 255, 247, 254,
-94, 254, 188, 253, 25, 253, 117, 252, 213, 251, 67, 251, 191, 250, 77, 250, 248, 249, 204, 249, 187, 249, 198, 249, 244, 249, 54, 250, 138, 250, 1, 251, 145, 251, 49, 252, 222, 252, 138, 253, 47, 254, 201, 254, 94, 255, 236, 255, 113, 0, 218, 0, 46, 1, 108, 1, 126, 1, 128, 1, 113, 1, 77, 1,
-31, 1, 234, 0, 174, 0, 117, 0, 62, 0, 13, 0, 239, 255, 225, 255, 233, 255, 15, 0, 64, 0, 125, 0, 200, 0, 35, 1, 138, 1, 4, 2, 129, 2, 251, 2, 106, 3, 192, 3, 7, 4, 64, 4, 98, 4, 109, 4, 97, 4, 40, 4, 212, 3, 102, 3, 221, 2, 69, 2, 163, 1, 249, 0,
-79, 0, 165, 255, 255, 254, 104, 254, 222, 253, 100, 253, 22, 253, 223, 252, 189, 252, 194, 252, 213, 252, 248, 252, 64, 253, 158, 253, 13, 254, 144, 254, 17, 255, 142, 255, 2, 0, 109, 0, 209, 0, 43, 1, 105, 1, 144, 1, 161, 1, 136, 1, 94, 1, 36, 1, 212, 0, 126, 0, 34, 0, 194, 255,
-100, 255, 10, 255, 182, 254, 116, 254, 67, 254, 36, 254, 39, 254, 56, 254, 88, 254, 138, 254, 206, 254, 34, 255, 143, 255, 7, 0, 130, 0, 248, 0, 97, 1, 193, 1, 22, 2, 92, 2, 144, 2, 178, 2, 175, 2, 143, 2, 88, 2, 6, 2, 161, 1, 48, 1, 182, 0, 52, 0, 177, 255, 47, 255,
-178, 254, 63, 254, 214, 253, 140, 253, 84, 253, 45, 253, 33, 253, 32, 253, 45, 253, 81, 253, 138, 253, 208, 253, 35, 254, 115, 254, 188, 254, 250, 254, 46, 255, 87, 255, 117, 255, 126, 255, 114, 255, 81, 255, 21, 255, 201, 254, 114, 254, 18, 254, 172, 253, 70, 253, 228, 252, 136, 252, 52, 252, 234, 251,
-185, 251, 159, 251, 158, 251, 202, 251, 10, 252, 94, 252, 209, 252, 88, 253, 241, 253, 170, 254, 113, 255, 58, 0, 6, 1, 195, 1, 118, 2, 31, 3, 182, 3, 56, 4, 164, 4, 232, 4, 11, 5, 17, 5, 246, 4, 192, 4, 121, 4, 30, 4, 183, 3, 72, 3, 208, 2, 88, 2, 227, 1, 111, 1,
-24, 1, 207, 0, 148, 0, 115, 0, 93, 0, 84, 0, 99, 0, 135, 0, 184, 0, 249, 0, 56, 1, 116, 1, 172, 1, 215, 1, 253, 1, 30, 2, 41, 2, 34, 2, 10, 2, 211, 1, 136, 1, 48, 1, 197, 0, 78, 0, 211, 255, 84, 255, 210, 254, 83, 254, 217, 253, 109, 253, 17, 253, 198, 252,
-156, 252, 132, 252, 123, 252, 132, 252, 162, 252, 208, 252, 18, 253, 104, 253, 193, 253, 26, 254, 108, 254, 184, 254, 255, 254, 58, 255, 108, 255, 148, 255, 161, 255, 156, 255, 138, 255, 98, 255, 48, 255, 246, 254, 178, 254, 110, 254, 41, 254, 227, 253, 167, 253, 115, 253, 72, 253, 62, 253, 73, 253, 104, 253,
-161, 253, 234, 253, 64, 254, 165, 254, 36, 255, 172, 255, 60, 0, 204, 0, 83, 1, 207, 1, 60, 2, 157, 2, 240, 2, 40, 3, 65, 3, 67, 3, 34, 3, 225, 2, 139, 2, 33, 2, 162, 1, 27, 1, 140, 0, 250, 255, 104, 255, 215, 254, 82, 254, 220, 253, 119, 253, 50, 253, 3, 253, 229, 252,
-224, 252, 240, 252, 21, 253, 88, 253, 173, 253, 12, 254, 115, 254, 213, 254, 55, 255, 155, 255, 248, 255, 79, 0, 157, 0, 214, 0, 247, 0, 9, 1, 7, 1, 241, 0, 208, 0, 165, 0, 111, 0, 58, 0, 5, 0, 203, 255, 155, 255, 115, 255, 89, 255, 88, 255, 102, 255, 129, 255, 174, 255, 228, 255,
-38, 0, 125, 0, 225, 0, 79, 1, 188, 1, 36, 2, 135, 2, 219, 2, 42, 3, 112, 3, 160, 3, 186, 3, 193, 3, 168, 3, 123, 3, 62, 3, 236, 2, 142, 2, 39, 2, 181, 1, 68, 1, 208, 0, 89, 0, 240, 255, 145, 255, 63, 255, 8, 255, 225, 254, 197, 254, 180, 254, 181, 254, 196, 254,
-228, 254, 23, 255, 78, 255, 133, 255, 181, 255, 222, 255, 2, 0, 33, 0, 49, 0, 52, 0, 33, 0, 242, 255, 180, 255, 102, 255, 6, 255, 158, 254, 45, 254, 182, 253, 65, 253, 205, 252, 93, 252, 245, 251, 152, 251, 81, 251, 36, 251, 8, 251, 6, 251, 24, 251, 57, 251, 109, 251, 194, 251, 40, 252,
-158, 252, 31, 253, 160, 253, 32, 254, 159, 254, 29, 255, 152, 255, 9, 0, 101, 0, 177, 0, 229, 0, 3, 1, 21, 1, 25, 1, 9, 1, 243, 0, 215, 0, 182, 0, 147, 0, 111, 0, 78, 0, 54, 0, 40, 0, 44, 0, 61, 0, 83, 0, 114, 0, 156, 0, 209, 0, 20, 1, 100, 1, 183, 1,
-11, 2, 77, 2, 139, 2, 197, 2, 242, 2, 21, 3, 41, 3, 33, 3, 2, 3, 209, 2, 139, 2, 56, 2, 218, 1, 114, 1, 1, 1, 143, 0, 28, 0, 168, 255, 60, 255, 218, 254, 133, 254, 75, 254, 33, 254, 11, 254, 5, 254, 12, 254, 34, 254, 85, 254, 152, 254, 233, 254, 66, 255, 152, 255,
-236, 255, 58, 0, 136, 0, 210, 0, 20, 1, 68, 1, 98, 1, 106, 1, 95, 1, 72, 1, 34, 1, 241, 0, 183, 0, 117, 0, 44, 0, 226, 255, 152, 255, 75, 255, 11, 255, 213, 254, 171, 254, 151, 254, 140, 254, 135, 254, 149, 254, 178, 254, 220, 254, 29, 255, 99, 255, 170, 255, 236, 255, 41, 0,
-99, 0, 157, 0, 209, 0, 251, 0, 23, 1, 25, 1, 13, 1, 242, 0, 200, 0, 149, 0, 90, 0, 23, 0, 206, 255, 130, 255, 53, 255, 232, 254, 160, 254, 97, 254, 49, 254, 12, 254, 244, 253, 228, 253, 221, 253, 221, 253, 240, 253, 15, 254, 57, 254, 101, 254, 139, 254, 172, 254, 197, 254, 221, 254,
-244, 254, 8, 255, 13, 255, 4, 255, 238, 254, 198, 254, 154, 254, 104, 254, 49, 254, 249, 253, 190, 253, 134, 253, 82, 253, 35, 253, 252, 252, 233, 252, 230, 252, 247, 252, 36, 253, 93, 253, 162, 253, 246, 253, 90, 254, 206, 254, 80, 255, 219, 255, 105, 0, 231, 0, 97, 1, 214, 1, 67, 2, 171, 2,
-9, 3, 85, 3, 129, 3, 157, 3, 166, 3, 155, 3, 130, 3, 94, 3, 45, 3, 239, 2, 168, 2, 93, 2, 13, 2, 190, 1, 118, 1, 59, 1, 11, 1, 229, 0, 203, 0, 181, 0, 164, 0, 170, 0, 187, 0, 212, 0, 249, 0, 21, 1, 46, 1, 66, 1, 88, 1, 110, 1, 133, 1, 145, 1,
-144, 1, 126, 1, 93, 1, 49, 1, 251, 0, 195, 0, 130, 0, 61, 0, 250, 255, 173, 255, 96, 255, 28, 255, 220, 254, 164, 254, 121, 254, 93, 254, 71, 254, 52, 254, 37, 254, 30, 254, 32, 254, 50, 254, 75, 254, 100, 254, 119, 254, 134, 254, 148, 254, 159, 254, 179, 254, 193, 254, 199, 254, 193, 254,
-175, 254, 146, 254, 112, 254, 77, 254, 39, 254, 4, 254, 225, 253, 192, 253, 164, 253, 143, 253, 130, 253, 129, 253, 151, 253, 185, 253, 229, 253, 31, 254, 92, 254, 155, 254, 232, 254, 63, 255, 154, 255, 249, 255, 77, 0, 154, 0, 218, 0, 19, 1, 71, 1, 119, 1, 148, 1, 161, 1, 157, 1, 125, 1,
-83, 1, 32, 1, 225, 0, 159, 0, 90, 0, 16, 0, 196, 255, 120, 255, 46, 255, 236, 254, 181, 254, 136, 254, 113, 254, 96, 254, 85, 254, 88, 254, 99, 254, 122, 254, 165, 254, 216, 254, 14, 255, 68, 255, 113, 255, 158, 255, 205, 255, 251, 255, 39, 0, 81, 0, 100, 0, 111, 0, 112, 0, 102, 0,
-90, 0, 79, 0, 64, 0, 54, 0, 44, 0, 31, 0, 22, 0, 15, 0, 11, 0, 23, 0, 43, 0, 70, 0, 98, 0, 125, 0, 155, 0, 188, 0, 233, 0, 28, 1, 82, 1, 127, 1, 165, 1, 196, 1, 220, 1, 242, 1, 7, 2, 17, 2, 16, 2, 3, 2, 227, 1, 187, 1, 140, 1, 91, 1,
-41, 1, 248, 0, 198, 0, 152, 0, 106, 0, 58, 0, 22, 0, 250, 255, 231, 255, 228, 255, 227, 255, 229, 255, 229, 255, 236, 255, 247, 255, 8, 0, 31, 0, 51, 0, 59, 0, 58, 0, 50, 0, 35, 0, 19, 0, 252, 255, 223, 255, 177, 255, 120, 255, 55, 255, 239, 254, 166, 254, 93, 254, 24, 254,
-215, 253, 154, 253, 93, 253, 37, 253, 243, 252, 196, 252, 173, 252, 161, 252, 160, 252, 172, 252, 190, 252, 213, 252, 250, 252, 46, 253, 106, 253, 172, 253, 235, 253, 36, 254, 87, 254, 135, 254, 182, 254, 228, 254, 14, 255, 47, 255, 74, 255, 87, 255, 97, 255, 106, 255, 114, 255, 125, 255, 139, 255, 158, 255,
-180, 255, 202, 255, 223, 255, 252, 255, 30, 0, 70, 0, 123, 0, 175, 0, 228, 0, 20, 1, 70, 1, 122, 1, 175, 1, 229, 1, 20, 2, 54, 2, 71, 2, 80, 2, 84, 2, 75, 2, 63, 2, 46, 2, 6, 2, 217, 1, 166, 1, 101, 1, 35, 1, 226, 0, 161, 0, 104, 0, 50, 0, 254, 255,
-210, 255, 170, 255, 138, 255, 126, 255, 126, 255, 137, 255, 154, 255, 175, 255, 197, 255, 223, 255, 3, 0, 41, 0, 81, 0, 112, 0, 134, 0, 148, 0, 152, 0, 156, 0, 159, 0, 154, 0, 142, 0, 125, 0, 98, 0, 65, 0, 28, 0, 244, 255, 207, 255, 171, 255, 138, 255, 109, 255, 80, 255, 52, 255,
-28, 255, 16, 255, 14, 255, 24, 255, 42, 255, 63, 255, 79, 255, 105, 255, 134, 255, 162, 255, 200, 255, 232, 255, 251, 255, 2, 0, 4, 0, 2, 0, 252, 255, 243, 255, 232, 255, 209, 255, 186, 255, 158, 255, 121, 255, 89, 255, 58, 255, 27, 255, 10, 255, 252, 254, 239, 254, 235, 254, 231, 254, 230, 254,
-243, 254, 9, 255, 36, 255, 62, 255, 87, 255, 108, 255, 126, 255, 148, 255, 167, 255, 184, 255, 184, 255, 174, 255, 155, 255, 124, 255, 91, 255, 56, 255, 10, 255, 215, 254, 160, 254, 97, 254, 36, 254, 231, 253, 171, 253, 124, 253, 85, 253, 56, 253, 45, 253, 45, 253, 54, 253, 78, 253, 122, 253, 180, 253,
-0, 254, 86, 254, 176, 254, 9, 255, 99, 255, 192, 255, 34, 0, 129, 0, 217, 0, 40, 1, 96, 1, 147, 1, 191, 1, 223, 1, 250, 1, 14, 2, 15, 2, 10, 2, 255, 1, 233, 1, 208, 1, 181, 1, 152, 1, 126, 1, 105, 1, 87, 1, 69, 1, 56, 1, 50, 1, 51, 1, 65, 1, 85, 1,
-106, 1, 125, 1, 142, 1, 157, 1, 175, 1, 192, 1, 206, 1, 207, 1, 196, 1, 174, 1, 146, 1, 113, 1, 76, 1, 37, 1, 243, 0, 187, 0, 128, 0, 66, 0, 5, 0, 203, 255, 153, 255, 110, 255, 75, 255, 55, 255, 39, 255, 27, 255, 25, 255, 30, 255, 43, 255, 66, 255, 90, 255, 112, 255,
-128, 255, 141, 255, 152, 255, 161, 255, 171, 255, 171, 255, 159, 255, 133, 255, 97, 255, 54, 255, 11, 255, 217, 254, 160, 254, 97, 254, 30, 254, 219, 253, 153, 253, 95, 253, 44, 253, 0, 253, 234, 252, 225, 252, 229, 252, 250, 252, 28, 253, 73, 253, 138, 253, 218, 253, 48, 254, 141, 254, 229, 254, 59, 255,
-142, 255, 226, 255, 49, 0, 122, 0, 180, 0, 220, 0, 246, 0, 0, 1, 0, 1, 249, 0, 226, 0, 190, 0, 146, 0, 91, 0, 35, 0, 235, 255, 177, 255, 126, 255, 82, 255, 43, 255, 16, 255, 255, 254, 245, 254, 243, 254, 0, 255, 23, 255, 58, 255, 102, 255, 145, 255, 186, 255, 231, 255, 20, 0,
-67, 0, 111, 0, 145, 0, 169, 0, 172, 0, 165, 0, 152, 0, 135, 0, 108, 0, 75, 0, 37, 0, 246, 255, 200, 255, 157, 255, 124, 255, 97, 255, 77, 255, 77, 255, 86, 255, 103, 255, 134, 255, 172, 255, 217, 255, 18, 0, 86, 0, 157, 0, 231, 0, 43, 1, 106, 1, 164, 1, 221, 1, 15, 2,
-57, 2, 79, 2, 82, 2, 71, 2, 42, 2, 3, 2, 214, 1, 156, 1, 87, 1, 11, 1, 182, 0, 102, 0, 25, 0, 208, 255, 149, 255, 99, 255, 57, 255, 37, 255, 27, 255, 26, 255, 42, 255, 71, 255, 111, 255, 165, 255, 224, 255, 24, 0, 79, 0, 127, 0, 172, 0, 214, 0, 249, 0, 12, 1,
-17, 1, 254, 0, 219, 0, 174, 0, 120, 0, 53, 0, 234, 255, 150, 255, 56, 255, 220, 254, 128, 254, 47, 254, 229, 253, 161, 253, 109, 253, 68, 253, 38, 253, 21, 253, 20, 253, 31, 253, 58, 253, 100, 253, 152, 253, 216, 253, 19, 254, 80, 254, 143, 254, 204, 254, 7, 255, 62, 255, 93, 255, 109, 255,
-112, 255, 99, 255, 80, 255, 55, 255, 23, 255, 238, 254, 194, 254, 147, 254, 106, 254, 72, 254, 47, 254, 37, 254, 40, 254, 53, 254, 85, 254, 129, 254, 184, 254, 253, 254, 81, 255, 175, 255, 24, 0, 134, 0, 240, 0, 86, 1, 178, 1, 10, 2, 93, 2, 161, 2, 210, 2, 241, 2, 241, 2, 220, 2,
-187, 2, 140, 2, 80, 2, 8, 2, 178, 1, 84, 1, 243, 0, 146, 0, 59, 0, 235, 255, 163, 255, 111, 255, 71, 255, 43, 255, 37, 255, 47, 255, 71, 255, 117, 255, 181, 255, 252, 255, 72, 0, 145, 0, 215, 0, 26, 1, 88, 1, 145, 1, 192, 1, 218, 1, 224, 1, 213, 1, 184, 1, 144, 1,
-96, 1, 38, 1, 222, 0, 144, 0, 60, 0, 230, 255, 149, 255, 72, 255, 7, 255, 208, 254, 162, 254, 130, 254, 114, 254, 109, 254, 117, 254, 149, 254, 192, 254, 246, 254, 56, 255, 118, 255, 177, 255, 232, 255, 29, 0, 79, 0, 118, 0, 139, 0, 145, 0, 126, 0, 90, 0, 44, 0, 245, 255, 180, 255,
-109, 255, 32, 255, 202, 254, 120, 254, 42, 254, 229, 253, 178, 253, 138, 253, 113, 253, 110, 253, 120, 253, 142, 253, 187, 253, 245, 253, 60, 254, 152, 254, 246, 254, 84, 255, 172, 255, 255, 255, 78, 0, 146, 0, 207, 0, 1, 1, 24, 1, 20, 1, 254, 0, 211, 0, 151, 0, 81, 0, 1, 0, 157, 255,
-51, 255, 196, 254, 85, 254, 237, 253, 143, 253, 70, 253, 15, 253, 231, 252, 217, 252, 225, 252, 251, 252, 43, 253, 123, 253, 219, 253, 73, 254, 198, 254, 62, 255, 179, 255, 40, 0, 152, 0, 5, 1, 109, 1, 191, 1, 0, 2, 40, 2, 57, 2, 59, 2, 47, 2, 20, 2, 235, 1, 180, 1, 115, 1,
-44, 1, 226, 0, 159, 0, 100, 0, 49, 0, 12, 0, 247, 255, 236, 255, 237, 255, 4, 0, 39, 0, 89, 0, 161, 0, 238, 0, 62, 1, 135, 1, 205, 1, 15, 2, 76, 2, 126, 2, 166, 2, 184, 2, 171, 2, 141, 2, 93, 2, 26, 2, 208, 1, 126, 1, 25, 1, 178, 0, 72, 0, 223, 255,
-127, 255, 41, 255, 228, 254, 180, 254, 146, 254, 129, 254, 132, 254, 148, 254, 177, 254, 234, 254, 45, 255, 121, 255, 206, 255, 28, 0, 102, 0, 171, 0, 233, 0, 34, 1, 80, 1, 100, 1, 99, 1, 73, 1, 16, 1, 200, 0, 116, 0, 11, 0, 151, 255, 24, 255, 145, 254, 11, 254, 136, 253, 19, 253,
-176, 252, 92, 252, 33, 252, 255, 251, 239, 251, 244, 251, 23, 252, 79, 252, 156, 252, 8, 253, 123, 253, 245, 253, 108, 254, 225, 254, 85, 255, 198, 255, 47, 0, 140, 0, 214, 0, 254, 0, 21, 1, 24, 1, 4, 1, 227, 0, 183, 0, 118, 0, 43, 0, 216, 255, 128, 255, 48, 255, 228, 254, 163, 254,
-119, 254, 88, 254, 68, 254, 71, 254, 87, 254, 115, 254, 179, 254, 254, 254, 85, 255, 189, 255, 31, 0, 126, 0, 217, 0, 48, 1, 131, 1, 204, 1, 250, 1, 19, 2, 21, 2, 246, 1, 203, 1, 148, 1, 76, 1, 250, 0, 160, 0, 64, 0, 223, 255, 129, 255, 47, 255, 237, 254, 185, 254, 154, 254,
-144, 254, 150, 254, 171, 254, 216, 254, 22, 255, 103, 255, 205, 255, 61, 0, 176, 0, 30, 1, 136, 1, 236, 1, 74, 2, 155, 2, 220, 2, 3, 3, 4, 3, 237, 2, 190, 2, 118, 2, 30, 2, 184, 1, 66, 1, 192, 0, 56, 0, 182, 255, 55, 255, 194, 254, 98, 254, 23, 254, 222, 253, 187, 253,
-178, 253, 186, 253, 212, 253, 20, 254, 102, 254, 199, 254, 55, 255, 164, 255, 15, 0, 118, 0, 217, 0, 55, 1, 141, 1, 199, 1, 236, 1, 249, 1, 228, 1, 192, 1, 140, 1, 64, 1, 230, 0, 129, 0, 12, 0, 148, 255, 27, 255, 165, 254, 62, 254, 228, 253, 154, 253, 104, 253, 69, 253, 46, 253,
-56, 253, 82, 253, 127, 253, 203, 253, 30, 254, 119, 254, 209, 254, 37, 255, 119, 255, 199, 255, 13, 0, 69, 0, 105, 0, 106, 0, 89, 0, 53, 0, 252, 255, 186, 255, 111, 255, 22, 255, 184, 254, 89, 254, 249, 253, 167, 253, 94, 253, 34, 253, 6, 253, 252, 252, 3, 253, 41, 253, 96, 253, 169, 253,
-17, 254, 144, 254, 29, 255, 180, 255, 74, 0, 221, 0, 105, 1, 240, 1, 110, 2, 224, 2, 49, 3, 105, 3, 133, 3, 119, 3, 87, 3, 36, 3, 214, 2, 119, 2, 12, 2, 144, 1, 16, 1, 145, 0, 20, 0, 169, 255, 77, 255, 1, 255, 212, 254, 183, 254, 170, 254, 188, 254, 228, 254, 33, 255,
-125, 255, 226, 255, 77, 0, 188, 0, 34, 1, 132, 1, 228, 1, 58, 2, 128, 2, 182, 2, 197, 2, 190, 2, 164, 2, 112, 2, 41, 2, 211, 1, 107, 1, 244, 0, 119, 0, 245, 255, 119, 255, 0, 255, 148, 254, 63, 254, 251, 253, 199, 253, 172, 253, 163, 253, 171, 253, 210, 253, 17, 254, 93, 254,
-185, 254, 19, 255, 107, 255, 191, 255, 16, 0, 90, 0, 156, 0, 196, 0, 211, 0, 203, 0, 164, 0, 109, 0, 40, 0, 211, 255, 113, 255, 7, 255, 151, 254, 40, 254, 190, 253, 91, 253, 15, 253, 211, 252, 169, 252, 164, 252, 177, 252, 207, 252, 10, 253, 91, 253, 190, 253, 60, 254, 197, 254, 81, 255,
-220, 255, 95, 0, 221, 0, 87, 1, 197, 1, 32, 2, 102, 2, 130, 2, 129, 2, 104, 2, 47, 2, 223, 1, 124, 1, 2, 1, 121, 0, 233, 255, 81, 255, 191, 254, 54, 254, 182, 253, 86, 253, 8, 253, 206, 252, 181, 252, 178, 252, 196, 252, 252, 252, 82, 253, 187, 253, 56, 254, 188, 254, 64, 255,
-196, 255, 71, 0, 199, 0, 69, 1, 167, 1, 244, 1, 46, 2, 67, 2, 69, 2, 55, 2, 15, 2, 210, 1, 138, 1, 53, 1, 214, 0, 119, 0, 30, 0, 207, 255, 143, 255, 94, 255, 65, 255, 55, 255, 61, 255, 85, 255, 133, 255, 199, 255, 30, 0, 132, 0, 236, 0, 84, 1, 179, 1, 14, 2,
-102, 2, 173, 2, 229, 2, 12, 3, 9, 3, 237, 2, 191, 2, 121, 2, 32, 2, 188, 1, 73, 1, 204, 0, 74, 0, 200, 255, 79, 255, 224, 254, 122, 254, 52, 254, 0, 254, 223, 253, 219, 253, 235, 253, 14, 254, 78, 254, 170, 254, 20, 255, 138, 255, 2, 0, 117, 0, 228, 0, 75, 1, 170, 1,
-254, 1, 52, 2, 72, 2, 64, 2, 15, 2, 194, 1, 97, 1, 233, 0, 91, 0, 193, 255, 27, 255, 116, 254, 208, 253, 47, 253, 165, 252, 45, 252, 200, 251, 134, 251, 91, 251, 69, 251, 79, 251, 121, 251, 189, 251, 36, 252, 163, 252, 45, 253, 192, 253, 81, 254, 227, 254, 119, 255, 2, 0, 131, 0,
-247, 0, 74, 1, 130, 1, 166, 1, 178, 1, 161, 1, 127, 1, 76, 1, 252, 0, 166, 0, 76, 0, 234, 255, 144, 255, 62, 255, 251, 254, 204, 254, 172, 254, 158, 254, 165, 254, 190, 254, 236, 254, 59, 255, 152, 255, 1, 0, 111, 0, 215, 0, 59, 1, 151, 1, 235, 1, 54, 2, 104, 2, 126, 2,
-126, 2, 94, 2, 40, 2, 228, 1, 140, 1, 41, 1, 188, 0, 68, 0, 210, 255, 97, 255, 243, 254, 155, 254, 81, 254, 22, 254, 255, 253, 252, 253, 11, 254, 53, 254, 124, 254, 214, 254, 71, 255, 207, 255, 90, 0, 226, 0, 104, 1, 232, 1, 98, 2, 210, 2, 42, 3, 107, 3, 132, 3, 117, 3,
-76, 3, 6, 3, 160, 2, 41, 2, 159, 1, 0, 1, 92, 0, 179, 255, 17, 255, 122, 254, 238, 253, 125, 253, 39, 253, 230, 252, 194, 252, 189, 252, 208, 252, 0, 253, 92, 253, 204, 253, 76, 254, 216, 254, 99, 255, 234, 255, 111, 0, 240, 0, 106, 1, 209, 1, 29, 2, 84, 2, 105, 2, 97, 2,
-69, 2, 18, 2, 191, 1, 93, 1, 237, 0, 110, 0, 238, 255, 110, 255, 248, 254, 144, 254, 52, 254, 237, 253, 185, 253, 148, 253, 129, 253, 138, 253, 167, 253, 219, 253, 43, 254, 126, 254, 212, 254, 42, 255, 121, 255, 196, 255, 15, 0, 72, 0, 116, 0, 138, 0, 127, 0, 100, 0, 57, 0, 245, 255,
-166, 255, 79, 255, 231, 254, 127, 254, 23, 254, 179, 253, 90, 253, 12, 253, 216, 252, 189, 252, 185, 252, 210, 252, 9, 253, 84, 253, 185, 253, 63, 254, 214, 254, 125, 255, 44, 0, 215, 0, 126, 1, 32, 2, 183, 2, 65, 3, 177, 3, 251, 3, 41, 4, 48, 4, 18, 4, 220, 3, 142, 3, 34, 3,
-165, 2, 24, 2, 130, 1, 234, 0, 85, 0, 201, 255, 81, 255, 232, 254, 152, 254, 102, 254, 72, 254, 62, 254, 95, 254, 149, 254, 226, 254, 85, 255, 203, 255, 68, 0, 195, 0, 57, 1, 171, 1, 34, 2, 130, 2, 210, 2, 13, 3, 30, 3, 26, 3, 0, 3, 195, 2, 113, 2, 11, 2, 143, 1,
-7, 1, 119, 0, 236, 255, 102, 255, 233, 254, 128, 254, 44, 254, 231, 253, 182, 253, 155, 253, 147, 253, 161, 253, 210, 253, 21, 254, 102, 254, 190, 254, 18, 255, 98, 255, 171, 255, 241, 255, 47, 0, 94, 0, 115, 0, 116, 0, 92, 0, 45, 0, 241, 255, 168, 255, 77, 255, 237, 254, 135, 254, 28, 254,
-183, 253, 87, 253, 2, 253, 197, 252, 155, 252, 136, 252, 150, 252, 182, 252, 234, 252, 60, 253, 163, 253, 32, 254, 182, 254, 82, 255, 242, 255, 142, 0, 35, 1, 179, 1, 58, 2, 169, 2, 1, 3, 56, 3, 63, 3, 41, 3, 247, 2, 157, 2, 46, 2, 172, 1, 15, 1, 106, 0, 191, 255, 17, 255,
-108, 254, 208, 253, 68, 253, 218, 252, 131, 252, 69, 252, 47, 252, 51, 252, 80, 252, 160, 252, 9, 253, 136, 253, 26, 254, 175, 254, 70, 255, 225, 255, 119, 0, 8, 1, 148, 1, 254, 1, 86, 2, 154, 2, 181, 2, 188, 2, 174, 2, 126, 2, 57, 2, 231, 1, 135, 1, 34, 1, 190, 0, 98, 0,
-16, 0, 202, 255, 146, 255, 113, 255, 93, 255, 86, 255, 113, 255, 159, 255, 225, 255, 62, 0, 161, 0, 4, 1, 96, 1, 182, 1, 7, 2, 80, 2, 139, 2, 181, 2, 199, 2, 182, 2, 146, 2, 91, 2, 15, 2, 180, 1, 76, 1, 217, 0, 93, 0, 222, 255, 102, 255, 246, 254, 147, 254, 70, 254,
-21, 254, 248, 253, 241, 253, 7, 254, 46, 254, 105, 254, 194, 254, 46, 255, 167, 255, 39, 0, 161, 0, 24, 1, 135, 1, 233, 1, 62, 2, 129, 2, 150, 2, 142, 2, 106, 2, 23, 2, 176, 1, 56, 1, 165, 0, 5, 0, 91, 255, 171, 254, 249, 253, 76, 253, 169, 252, 26, 252, 159, 251, 59, 251,
-253, 250, 216, 250, 203, 250, 232, 250, 37, 251, 126, 251, 253, 251, 145, 252, 47, 253, 210, 253, 120, 254, 29, 255, 192, 255, 92, 0, 233, 0, 99, 1, 187, 1, 250, 1, 33, 2, 40, 2, 17, 2, 228, 1, 160, 1, 73, 1, 233, 0, 131, 0, 31, 0, 190, 255, 99, 255, 29, 255, 225, 254, 177, 254,
-160, 254, 158, 254, 175, 254, 229, 254, 48, 255, 137, 255, 239, 255, 84, 0, 182, 0, 17, 1, 105, 1, 185, 1, 254, 1, 38, 2, 58, 2, 58, 2, 25, 2, 235, 1, 177, 1, 95, 1, 0, 1, 153, 0, 40, 0, 184, 255, 77, 255, 235, 254, 158, 254, 99, 254, 58, 254, 54, 254, 66, 254, 94, 254,
-154, 254, 237, 254, 83, 255, 208, 255, 87, 0, 223, 0, 97, 1, 219, 1, 78, 2, 187, 2, 13, 3, 72, 3, 108, 3, 87, 3, 41, 3, 227, 2, 125, 2, 5, 2, 127, 1, 232, 0, 71, 0, 162, 255, 252, 254, 98, 254, 214, 253, 90, 253, 0, 253, 189, 252, 144, 252, 136, 252, 150, 252, 187, 252,
-10, 253, 118, 253, 244, 253, 131, 254, 20, 255, 163, 255, 48, 0, 184, 0, 57, 1, 178, 1, 15, 2, 86, 2, 133, 2, 140, 2, 119, 2, 77, 2, 5, 2, 164, 1, 53, 1, 185, 0, 53, 0, 178, 255, 49, 255, 187, 254, 82, 254, 247, 253, 179, 253, 128, 253, 94, 253, 85, 253, 103, 253, 143, 253,
-214, 253, 42, 254, 132, 254, 228, 254, 60, 255, 146, 255, 231, 255, 48, 0, 107, 0, 151, 0, 166, 0, 161, 0, 139, 0, 95, 0, 33, 0, 214, 255, 122, 255, 18, 255, 168, 254, 63, 254, 218, 253, 131, 253, 59, 253, 14, 253, 250, 252, 252, 252, 27, 253, 84, 253, 161, 253, 15, 254, 151, 254, 47, 255,
-213, 255, 124, 0, 33, 1, 196, 1, 92, 2, 231, 2, 101, 3, 191, 3, 246, 3, 14, 4, 3, 4, 217, 3, 155, 3, 68, 3, 211, 2, 84, 2, 200, 1, 49, 1, 157, 0, 15, 0, 144, 255, 34, 255, 200, 254, 138, 254, 98, 254, 78, 254, 88, 254, 131, 254, 196, 254, 34, 255, 148, 255, 10, 0,
-128, 0, 242, 0, 99, 1, 208, 1, 52, 2, 136, 2, 203, 2, 232, 2, 232, 2, 210, 2, 157, 2, 80, 2, 242, 1, 127, 1, 254, 0, 121, 0, 238, 255, 106, 255, 241, 254, 131, 254, 44, 254, 230, 253, 175, 253, 144, 253, 130, 253, 133, 253, 166, 253, 228, 253, 47, 254, 136, 254, 225, 254, 53, 255,
-133, 255, 204, 255, 14, 0, 73, 0, 111, 0, 127, 0, 124, 0, 94, 0, 45, 0, 239, 255, 161, 255, 70, 255, 228, 254, 123, 254, 16, 254, 171, 253, 76, 253, 3, 253, 205, 252, 170, 252, 169, 252, 191, 252, 232, 252, 41, 253, 133, 253, 244, 253, 124, 254, 21, 255, 179, 255, 83, 0, 236, 0, 126, 1,
-7, 2, 130, 2, 225, 2, 39, 3, 70, 3, 60, 3, 25, 3, 218, 2, 123, 2, 10, 2, 132, 1, 234, 0, 73, 0, 161, 255, 253, 254, 97, 254, 207, 253, 86, 253, 245, 252, 169, 252, 125, 252, 110, 252, 121, 252, 168, 252, 254, 252, 105, 253, 232, 253, 114, 254, 255, 254, 142, 255, 28, 0, 169, 0,
-49, 1, 166, 1, 3, 2, 74, 2, 113, 2, 124, 2, 115, 2, 80, 2, 21, 2, 204, 1, 114, 1, 19, 1, 180, 0, 85, 0, 5, 0, 194, 255, 139, 255, 102, 255, 82, 255, 77, 255, 90, 255, 130, 255, 190, 255, 18, 0, 115, 0, 215, 0, 59, 1, 145, 1, 225, 1, 44, 2, 104, 2, 149, 2,
-178, 2, 174, 2, 142, 2, 93, 2, 23, 2, 190, 1, 91, 1, 236, 0, 111, 0, 239, 255, 112, 255, 247, 254, 141, 254, 49, 254, 242, 253, 208, 253, 193, 253, 200, 253, 234, 253, 27, 254, 94, 254, 195, 254, 52, 255, 176, 255, 46, 0, 169, 0, 31, 1, 134, 1, 227, 1, 50, 2, 98, 2, 109, 2,
-94, 2, 41, 2, 213, 1, 112, 1, 250, 0, 107, 0, 212, 255, 53, 255, 142, 254, 234, 253, 75, 253, 190, 252, 65, 252, 213, 251, 140, 251, 93, 251, 70, 251, 80, 251, 123, 251, 196, 251, 47, 252, 180, 252, 70, 253, 225, 253, 122, 254, 21, 255, 176, 255, 70, 0, 207, 0, 73, 1, 172, 1, 235, 1,
-21, 2, 40, 2, 22, 2, 241, 1, 188, 1, 107, 1, 20, 1, 182, 0, 85, 0, 250, 255, 164, 255, 89, 255, 31, 255, 241, 254, 209, 254, 201, 254, 210, 254, 238, 254, 46, 255, 125, 255, 214, 255, 55, 0, 146, 0, 233, 0, 59, 1, 133, 1, 199, 1, 250, 1, 16, 2, 19, 2, 254, 1, 209, 1,
-151, 1, 78, 1, 243, 0, 142, 0, 33, 0, 173, 255, 62, 255, 213, 254, 124, 254, 60, 254, 14, 254, 249, 253, 3, 254, 31, 254, 74, 254, 152, 254, 247, 254, 102, 255, 238, 255, 118, 0, 253, 0, 124, 1, 241, 1, 93, 2, 187, 2, 254, 2, 44, 3, 57, 3, 26, 3, 229, 2, 153, 2, 51, 2,
-192, 1, 65, 1, 178, 0, 30, 0, 135, 255, 241, 254, 105, 254, 238, 253, 136, 253, 63, 253, 10, 253, 238, 252, 242, 252, 11, 253, 56, 253, 144, 253, 251, 253, 118, 254, 247, 254, 121, 255, 250, 255, 113, 0, 229, 0, 83, 1, 178, 1, 247, 1, 37, 2, 56, 2, 38, 2, 254, 1, 192, 1, 101, 1,
-254, 0, 140, 0, 17, 0, 150, 255, 29, 255, 174, 254, 76, 254, 246, 253, 182, 253, 136, 253, 107, 253, 95, 253, 112, 253, 149, 253, 209, 253, 36, 254, 127, 254, 224, 254, 60, 255, 148, 255, 232, 255, 53, 0, 119, 0, 170, 0, 201, 0, 202, 0, 188, 0, 156, 0, 100, 0, 33, 0, 210, 255, 113, 255,
-11, 255, 163, 254, 60, 254, 228, 253, 153, 253, 97, 253, 73, 253, 68, 253, 85, 253, 133, 253, 200, 253, 28, 254, 147, 254, 24, 255, 169, 255, 70, 0, 221, 0, 113, 1, 1, 2, 131, 2, 249, 2, 94, 3, 153, 3, 186, 3, 191, 3, 153, 3, 98, 3, 26, 3, 183, 2, 70, 2, 201, 1, 63, 1,
-180, 0, 43, 0, 169, 255, 59, 255, 221, 254, 145, 254, 100, 254, 72, 254, 63, 254, 91, 254, 140, 254, 209, 254, 55, 255, 160, 255, 12, 0, 123, 0, 223, 0, 63, 1, 158, 1, 236, 1, 43, 2, 91, 2, 98, 2, 83, 2, 48, 2, 237, 1, 157, 1, 65, 1, 211, 0, 100, 0, 243, 255, 129, 255,
-28, 255, 194, 254, 115, 254, 61, 254, 19, 254, 246, 253, 243, 253, 255, 253, 25, 254, 81, 254, 152, 254, 235, 254, 70, 255, 157, 255, 238, 255, 56, 0, 118, 0, 173, 0, 218, 0, 236, 0, 235, 0, 215, 0, 164, 0, 100, 0, 24, 0, 187, 255, 85, 255, 233, 254, 119, 254, 11, 254, 165, 253, 73, 253,
-6, 253, 215, 252, 189, 252, 199, 252, 227, 252, 19, 253, 93, 253, 186, 253, 39, 254, 168, 254, 52, 255, 195, 255, 80, 0, 215, 0, 86, 1, 200, 1, 38, 2, 110, 2, 158, 2, 160, 2, 136, 2, 88, 2, 14, 2, 175, 1, 67, 1, 199, 0, 62, 0, 176, 255, 33, 255, 153, 254, 25, 254, 162, 253,
-76, 253, 8, 253, 213, 252, 201, 252, 211, 252, 242, 252, 56, 253, 150, 253, 4, 254, 129, 254, 4, 255, 135, 255, 7, 0, 132, 0, 252, 0, 108, 1, 197, 1, 10, 2, 59, 2, 72, 2, 65, 2, 42, 2, 252, 1, 190, 1, 119, 1, 39, 1, 212, 0, 133, 0, 59, 0, 253, 255, 202, 255, 162, 255,
-142, 255, 136, 255, 144, 255, 171, 255, 218, 255, 23, 0, 103, 0, 190, 0, 21, 1, 106, 1, 174, 1, 234, 1, 32, 2, 65, 2, 84, 2, 89, 2, 58, 2, 9, 2, 200, 1, 112, 1, 15, 1, 166, 0, 49, 0, 187, 255, 68, 255, 206, 254, 105, 254, 17, 254, 200, 253, 165, 253, 150, 253, 155, 253,
-190, 253, 243, 253, 53, 254, 138, 254, 241, 254, 98, 255, 219, 255, 84, 0, 199, 0, 48, 1, 137, 1, 214, 1, 21, 2, 49, 2, 53, 2, 34, 2, 233, 1, 156, 1, 64, 1, 209, 0, 87, 0, 213, 255, 74, 255, 191, 254, 55, 254, 180, 253, 66, 253, 224, 252, 142, 252, 96, 252, 72, 252, 71, 252,
-102, 252, 158, 252, 232, 252, 77, 253, 196, 253, 66, 254, 198, 254, 69, 255, 191, 255, 54, 0, 162, 0, 1, 1, 84, 1, 138, 1, 168, 1, 178, 1, 161, 1, 123, 1, 71, 1, 1, 1, 178, 0, 94, 0, 7, 0, 184, 255, 109, 255, 38, 255, 241, 254, 200, 254, 169, 254, 162, 254, 170, 254, 192, 254,
-235, 254, 40, 255, 113, 255, 198, 255, 27, 0, 109, 0, 186, 0, 250, 0, 52, 1, 101, 1, 133, 1, 145, 1, 141, 1, 112, 1, 65, 1, 6, 1, 192, 0, 110, 0, 22, 0, 186, 255, 94, 255, 10, 255, 190, 254, 133, 254, 96, 254, 79, 254, 90, 254, 125, 254, 176, 254, 244, 254, 73, 255, 169, 255,
-22, 0, 142, 0, 9, 1, 128, 1, 235, 1, 74, 2, 158, 2, 219, 2, 5, 3, 29, 3, 13, 3, 228, 2, 167, 2, 76, 2, 231, 1, 120, 1, 252, 0, 121, 0, 245, 255, 112, 255, 242, 254, 126, 254, 22, 254, 196, 253, 141, 253, 105, 253, 95, 253, 111, 253, 142, 253, 192, 253, 11, 254, 99, 254,
-200, 254, 52, 255, 155, 255, 253, 255, 83, 0, 162, 0, 233, 0, 32, 1, 68, 1, 86, 1, 78, 1, 43, 1, 249, 0, 184, 0, 102, 0, 15, 0, 180, 255, 88, 255, 1, 255, 177, 254, 104, 254, 42, 254, 248, 253, 219, 253, 208, 253, 210, 253, 229, 253, 8, 254, 58, 254, 124, 254, 207, 254, 41, 255,
-137, 255, 222, 255, 44, 0, 115, 0, 174, 0, 219, 0, 254, 0, 13, 1, 2, 1, 231, 0, 189, 0, 128, 0, 58, 0, 236, 255, 149, 255, 61, 255, 229, 254, 152, 254, 83, 254, 24, 254, 247, 253, 236, 253, 242, 253, 17, 254, 69, 254, 133, 254, 207, 254, 46, 255, 150, 255, 8, 0, 130, 0, 248, 0,
-106, 1, 206, 1, 37, 2, 112, 2, 170, 2, 197, 2, 202, 2, 184, 2, 132, 2, 68, 2, 254, 1, 160, 1, 61, 1, 213, 0, 101, 0, 248, 255, 142, 255, 46, 255, 222, 254, 155, 254, 114, 254, 97, 254, 96, 254, 116, 254, 155, 254, 209, 254, 26, 255, 114, 255, 211, 255, 57, 0, 148, 0, 230, 0,
-49, 1, 113, 1, 165, 1, 207, 1, 234, 1, 231, 1, 211, 1, 175, 1, 119, 1, 55, 1, 241, 0, 165, 0, 89, 0, 14, 0, 200, 255, 135, 255, 77, 255, 31, 255, 2, 255, 242, 254, 242, 254, 0, 255, 23, 255, 53, 255, 100, 255, 157, 255, 222, 255, 36, 0, 99, 0, 154, 0, 189, 0, 214, 0,
-230, 0, 231, 0, 217, 0, 189, 0, 141, 0, 74, 0, 252, 255, 165, 255, 70, 255, 228, 254, 128, 254, 32, 254, 197, 253, 112, 253, 45, 253, 253, 252, 222, 252, 220, 252, 243, 252, 26, 253, 82, 253, 151, 253, 229, 253, 60, 254, 168, 254, 25, 255, 142, 255, 255, 255, 101, 0, 194, 0, 17, 1, 80, 1,
-131, 1, 160, 1, 162, 1, 144, 1, 107, 1, 48, 1, 236, 0, 158, 0, 67, 0, 229, 255, 132, 255, 32, 255, 196, 254, 112, 254, 41, 254, 248, 253, 217, 253, 209, 253, 222, 253, 249, 253, 37, 254, 101, 254, 179, 254, 14, 255, 116, 255, 217, 255, 59, 0, 150, 0, 232, 0, 52, 1, 122, 1, 176, 1,
-217, 1, 240, 1, 237, 1, 221, 1, 190, 1, 148, 1, 99, 1, 43, 1, 242, 0, 184, 0, 127, 0, 74, 0, 31, 0, 252, 255, 229, 255, 221, 255, 221, 255, 231, 255, 249, 255, 20, 0, 58, 0, 107, 0, 161, 0, 218, 0, 9, 1, 43, 1, 67, 1, 80, 1, 80, 1, 72, 1, 55, 1, 15, 1,
-219, 0, 156, 0, 77, 0, 253, 255, 172, 255, 91, 255, 11, 255, 190, 254, 124, 254, 67, 254, 22, 254, 253, 253, 0, 254, 19, 254, 55, 254, 112, 254, 173, 254, 239, 254, 62, 255, 147, 255, 239, 255, 83, 0, 180, 0, 15, 1, 92, 1, 152, 1, 202, 1, 237, 1, 251, 1, 248, 1, 227, 1, 174, 1,
-109, 1, 33, 1, 199, 0, 106, 0, 8, 0, 161, 255, 59, 255, 215, 254, 121, 254, 39, 254, 225, 253, 172, 253, 144, 253, 131, 253, 132, 253, 153, 253, 185, 253, 228, 253, 33, 254, 105, 254, 184, 254, 6, 255, 81, 255, 151, 255, 211, 255, 11, 0, 60, 0, 102, 0, 127, 0, 138, 0, 138, 0, 116, 0,
-85, 0, 48, 0, 7, 0, 217, 255, 168, 255, 121, 255, 76, 255, 34, 255, 255, 254, 230, 254, 212, 254, 204, 254, 211, 254, 224, 254, 244, 254, 26, 255, 71, 255, 122, 255, 189, 255, 250, 255, 53, 0, 107, 0, 147, 0, 180, 0, 208, 0, 225, 0, 234, 0, 235, 0, 214, 0, 187, 0, 154, 0, 115, 0,
-75, 0, 34, 0, 246, 255, 205, 255, 170, 255, 143, 255, 129, 255, 128, 255, 143, 255, 172, 255, 211, 255, 2, 0, 57, 0, 116, 0, 178, 0, 248, 0, 66, 1, 141, 1, 217, 1, 19, 2, 66, 2, 101, 2, 116, 2, 119, 2, 111, 2, 75, 2, 25, 2, 218, 1, 136, 1, 50, 1, 216, 0, 122, 0,
-26, 0, 184, 255, 87, 255, 252, 254, 169, 254, 98, 254, 43, 254, 5, 254, 237, 253, 232, 253, 239, 253, 1, 254, 29, 254, 69, 254, 116, 254, 173, 254, 235, 254, 39, 255, 94, 255, 136, 255, 175, 255, 209, 255, 240, 255, 7, 0, 22, 0, 24, 0, 13, 0, 248, 255, 221, 255, 189, 255, 155, 255, 120, 255,
-86, 255, 53, 255, 22, 255, 254, 254, 235, 254, 219, 254, 216, 254, 222, 254, 234, 254, 2, 255, 31, 255, 65, 255, 108, 255, 157, 255, 210, 255, 11, 0, 58, 0, 98, 0, 130, 0, 149, 0, 163, 0, 173, 0, 172, 0, 163, 0, 147, 0, 114, 0, 78, 0, 38, 0, 243, 255, 195, 255, 145, 255, 94, 255,
-50, 255, 13, 255, 237, 254, 220, 254, 211, 254, 210, 254, 227, 254, 250, 254, 23, 255, 60, 255, 101, 255, 147, 255, 201, 255, 8, 0, 70, 0, 126, 0, 176, 0, 217, 0, 250, 0, 17, 1, 32, 1, 37, 1, 26, 1, 6, 1, 233, 0, 194, 0, 151, 0, 103, 0, 51, 0, 253, 255, 201, 255, 152, 255,
-110, 255, 76, 255, 50, 255, 37, 255, 38, 255, 49, 255, 72, 255, 103, 255, 138, 255, 179, 255, 230, 255, 28, 0, 84, 0, 140, 0, 189, 0, 229, 0, 10, 1, 42, 1, 71, 1, 96, 1, 111, 1, 116, 1, 112, 1, 98, 1, 79, 1, 57, 1, 32, 1, 6, 1, 236, 0, 213, 0, 188, 0, 162, 0,
-143, 0, 122, 0, 104, 0, 98, 0, 92, 0, 87, 0, 85, 0, 82, 0, 81, 0, 84, 0, 89, 0, 90, 0, 88, 0, 71, 0, 46, 0, 14, 0, 236, 255, 201, 255, 162, 255, 120, 255, 71, 255, 17, 255, 215, 254, 157, 254, 99, 254, 42, 254, 249, 253, 205, 253, 166, 253, 137, 253, 117, 253, 105, 253,
-107, 253, 120, 253, 143, 253, 178, 253, 216, 253, 1, 254, 48, 254, 103, 254, 165, 254, 237, 254, 55, 255, 125, 255, 190, 255, 242, 255, 32, 0, 75, 0, 110, 0, 136, 0, 156, 0, 167, 0, 162, 0, 151, 0, 137, 0, 109, 0, 79, 0, 49, 0, 10, 0, 229, 255, 194, 255, 158, 255, 129, 255, 106, 255,
-94, 255, 92, 255, 97, 255, 106, 255, 121, 255, 142, 255, 170, 255, 206, 255, 249, 255, 42, 0, 80, 0, 119, 0, 157, 0, 191, 0, 225, 0, 3, 1, 29, 1, 48, 1, 60, 1, 61, 1, 57, 1, 49, 1, 37, 1, 22, 1, 4, 1, 239, 0, 214, 0, 186, 0, 156, 0, 130, 0, 104, 0, 81, 0,
-64, 0, 49, 0, 35, 0, 19, 0, 11, 0, 7, 0, 5, 0, 6, 0, 1, 0, 247, 255, 231, 255, 213, 255, 195, 255, 183, 255, 170, 255, 156, 255, 142, 255, 122, 255, 102, 255, 85, 255, 68, 255, 56, 255, 49, 255, 46, 255, 45, 255, 47, 255, 58, 255, 75, 255, 98, 255, 129, 255, 168, 255, 209, 255,
-247, 255, 31, 0, 70, 0, 109, 0, 160, 0, 211, 0, 4, 1, 47, 1, 78, 1, 100, 1, 114, 1, 124, 1, 129, 1, 128, 1, 118, 1, 98, 1, 64, 1, 24, 1, 235, 0, 185, 0, 129, 0, 71, 0, 10, 0, 199, 255, 132, 255, 67, 255, 8, 255, 211, 254, 165, 254, 129, 254, 97, 254, 69, 254,
-49, 254, 32, 254, 25, 254, 30, 254, 47, 254, 68, 254, 92, 254, 117, 254, 144, 254, 173, 254, 207, 254, 247, 254, 28, 255, 62, 255, 88, 255, 108, 255, 122, 255, 134, 255, 144, 255, 150, 255, 152, 255, 149, 255, 143, 255, 129, 255, 115, 255, 100, 255, 85, 255, 78, 255, 73, 255, 68, 255, 69, 255, 71, 255,
-75, 255, 89, 255, 108, 255, 131, 255, 159, 255, 182, 255, 204, 255, 231, 255, 1, 0, 31, 0, 70, 0, 103, 0, 133, 0, 162, 0, 185, 0, 204, 0, 222, 0, 239, 0, 253, 0, 7, 1, 17, 1, 25, 1, 33, 1, 44, 1, 51, 1, 60, 1, 70, 1, 77, 1, 81, 1, 84, 1, 85, 1, 88, 1,
-93, 1, 104, 1, 112, 1, 117, 1, 110, 1, 99, 1, 84, 1, 64, 1, 48, 1, 27, 1, 3, 1, 224, 0, 187, 0, 145, 0, 100, 0, 52, 0, 2, 0, 204, 255, 146, 255, 88, 255, 31, 255, 234, 254, 184, 254, 140, 254, 104, 254, 72, 254, 45, 254, 23, 254, 4, 254, 247, 253, 247, 253, 1, 254,
-20, 254, 46, 254, 76, 254, 108, 254, 142, 254, 183, 254, 229, 254, 25, 255, 75, 255, 123, 255, 166, 255, 200, 255, 234, 255, 11, 0, 38, 0, 62, 0, 81, 0, 91, 0, 93, 0, 90, 0, 80, 0, 67, 0, 52, 0, 35, 0, 22, 0, 8, 0, 251, 255, 235, 255, 225, 255, 219, 255, 219, 255, 227, 255,
-237, 255, 245, 255, 252, 255, 4, 0, 14, 0, 30, 0, 47, 0, 66, 0, 77, 0, 84, 0, 85, 0, 80, 0, 70, 0, 57, 0, 37, 0, 13, 0, 242, 255, 210, 255, 179, 255, 146, 255, 111, 255, 79, 255, 50, 255, 23, 255, 1, 255, 236, 254, 218, 254, 211, 254, 213, 254, 224, 254, 247, 254, 15, 255,
-39, 255, 66, 255, 92, 255, 121, 255, 157, 255, 192, 255, 228, 255, 8, 0, 34, 0, 59, 0, 81, 0, 92, 0, 97, 0, 96, 0, 87, 0, 76, 0, 62, 0, 46, 0, 30, 0, 14, 0, 254, 255, 247, 255, 240, 255, 235, 255, 235, 255, 237, 255, 243, 255, 7, 0, 32, 0, 63, 0, 101, 0, 138, 0,
-177, 0, 220, 0, 13, 1, 63, 1, 115, 1, 164, 1, 208, 1, 248, 1, 26, 2, 53, 2, 73, 2, 83, 2, 80, 2, 69, 2, 46, 2, 12, 2, 226, 1, 174, 1, 119, 1, 60, 1, 254, 0, 192, 0, 128, 0, 62, 0, 253, 255, 193, 255, 137, 255, 90, 255, 46, 255, 5, 255, 223, 254, 188, 254,
-160, 254, 140, 254, 130, 254, 122, 254, 116, 254, 108, 254, 97, 254, 87, 254, 77, 254, 62, 254, 48, 254, 37, 254, 21, 254, 6, 254, 249, 253, 233, 253, 219, 253, 209, 253, 202, 253, 200, 253, 201, 253, 207, 253, 219, 253, 237, 253, 12, 254, 59, 254, 113, 254, 173, 254, 234, 254, 40, 255, 102, 255, 168, 255,
-237, 255, 52, 0, 124, 0, 187, 0, 244, 0, 34, 1, 64, 1, 84, 1, 94, 1, 88, 1, 73, 1, 50, 1, 17, 1, 232, 0, 186, 0, 139, 0, 92, 0, 46, 0, 5, 0, 223, 255, 186, 255, 153, 255, 130, 255, 117, 255, 118, 255, 133, 255, 154, 255, 182, 255, 215, 255, 252, 255, 36, 0, 86, 0,
-136, 0, 186, 0, 232, 0, 15, 1, 49, 1, 73, 1, 87, 1, 93, 1, 89, 1, 72, 1, 45, 1, 11, 1, 215, 0, 160, 0, 102, 0, 37, 0, 235, 255, 180, 255, 121, 255, 68, 255, 18, 255, 230, 254, 198, 254, 175, 254, 162, 254, 160, 254, 162, 254, 166, 254, 190, 254, 219, 254, 252, 254, 42, 255,
-88, 255, 132, 255, 176, 255, 217, 255, 254, 255, 34, 0, 68, 0, 98, 0, 122, 0, 145, 0, 161, 0, 172, 0, 178, 0, 180, 0, 179, 0, 178, 0, 176, 0, 173, 0, 169, 0, 172, 0, 180, 0, 194, 0, 217, 0, 243, 0, 12, 1, 34, 1, 57, 1, 79, 1, 102, 1, 128, 1, 152, 1, 167, 1,
-171, 1, 165, 1, 144, 1, 109, 1, 66, 1, 13, 1, 204, 0, 131, 0, 51, 0, 218, 255, 125, 255, 32, 255, 197, 254, 111, 254, 28, 254, 209, 253, 140, 253, 78, 253, 27, 253, 1, 253, 246, 252, 248, 252, 18, 253, 49, 253, 85, 253, 136, 253, 194, 253, 3, 254, 80, 254, 156, 254, 231, 254, 46, 255,
-106, 255, 158, 255, 203, 255, 238, 255, 8, 0, 22, 0, 20, 0, 6, 0, 236, 255, 204, 255, 167, 255, 129, 255, 97, 255, 67, 255, 40, 255, 18, 255, 255, 254, 245, 254, 246, 254, 10, 255, 38, 255, 75, 255, 123, 255, 173, 255, 227, 255, 39, 0, 113, 0, 189, 0, 13, 1, 86, 1, 152, 1, 210, 1,
-1, 2, 41, 2, 74, 2, 95, 2, 106, 2, 107, 2, 92, 2, 66, 2, 32, 2, 245, 1, 198, 1, 149, 1, 99, 1, 51, 1, 3, 1, 210, 0, 175, 0, 146, 0, 123, 0, 112, 0, 101, 0, 91, 0, 85, 0, 83, 0, 85, 0, 96, 0, 107, 0, 117, 0, 124, 0, 115, 0, 101, 0, 81, 0,
-46, 0, 7, 0, 219, 255, 163, 255, 104, 255, 42, 255, 230, 254, 163, 254, 97, 254, 37, 254, 237, 253, 188, 253, 145, 253, 113, 253, 91, 253, 81, 253, 99, 253, 129, 253, 169, 253, 228, 253, 35, 254, 104, 254, 186, 254, 21, 255, 116, 255, 212, 255, 48, 0, 134, 0, 211, 0, 19, 1, 75, 1, 122, 1,
-146, 1, 159, 1, 158, 1, 135, 1, 100, 1, 57, 1, 2, 1, 205, 0, 152, 0, 94, 0, 45, 0, 252, 255, 201, 255, 165, 255, 136, 255, 114, 255, 116, 255, 120, 255, 128, 255, 145, 255, 169, 255, 197, 255, 233, 255, 18, 0, 56, 0, 87, 0, 106, 0, 117, 0, 119, 0, 110, 0, 95, 0, 72, 0,
-35, 0, 246, 255, 191, 255, 128, 255, 58, 255, 242, 254, 172, 254, 108, 254, 50, 254, 254, 253, 212, 253, 181, 253, 160, 253, 164, 253, 182, 253, 212, 253, 1, 254, 52, 254, 107, 254, 172, 254, 248, 254, 73, 255, 158, 255, 243, 255, 64, 0, 129, 0, 180, 0, 222, 0, 0, 1, 19, 1, 28, 1, 30, 1,
-20, 1, 0, 1, 231, 0, 199, 0, 165, 0, 131, 0, 99, 0, 71, 0, 46, 0, 26, 0, 15, 0, 14, 0, 27, 0, 59, 0, 103, 0, 154, 0, 213, 0, 23, 1, 94, 1, 172, 1, 254, 1, 79, 2, 154, 2, 215, 2, 10, 3, 48, 3, 67, 3, 72, 3, 63, 3, 32, 3, 238, 2, 174, 2,
-93, 2, 0, 2, 157, 1, 50, 1, 198, 0, 92, 0, 246, 255, 143, 255, 45, 255, 211, 254, 131, 254, 69, 254, 20, 254, 239, 253, 214, 253, 198, 253, 194, 253, 200, 253, 216, 253, 245, 253, 14, 254, 39, 254, 66, 254, 80, 254, 95, 254, 109, 254, 115, 254, 115, 254, 111, 254, 97, 254, 77, 254, 51, 254,
-21, 254, 245, 253, 216, 253, 190, 253, 176, 253, 169, 253, 168, 253, 183, 253, 211, 253, 251, 253, 53, 254, 122, 254, 199, 254, 26, 255, 113, 255, 203, 255, 44, 0, 143, 0, 240, 0, 77, 1, 152, 1, 213, 1, 5, 2, 33, 2, 44, 2, 42, 2, 23, 2, 242, 1, 194, 1, 133, 1, 60, 1, 236, 0,
-153, 0, 72, 0, 249, 255, 174, 255, 110, 255, 52, 255, 0, 255, 225, 254, 212, 254, 213, 254, 235, 254, 11, 255, 50, 255, 97, 255, 153, 255, 216, 255, 28, 0, 97, 0, 161, 0, 221, 0, 9, 1, 44, 1, 68, 1, 76, 1, 68, 1, 47, 1, 8, 1, 210, 0, 147, 0, 72, 0, 249, 255, 170, 255,
-92, 255, 21, 255, 210, 254, 147, 254, 95, 254, 51, 254, 17, 254, 5, 254, 10, 254, 28, 254, 63, 254, 108, 254, 163, 254, 229, 254, 49, 255, 132, 255, 220, 255, 47, 0, 127, 0, 203, 0, 14, 1, 72, 1, 124, 1, 165, 1, 193, 1, 210, 1, 215, 1, 203, 1, 182, 1, 154, 1, 120, 1, 86, 1,
-53, 1, 25, 1, 1, 1, 234, 0, 221, 0, 216, 0, 219, 0, 229, 0, 249, 0, 14, 1, 36, 1, 64, 1, 94, 1, 123, 1, 152, 1, 171, 1, 182, 1, 177, 1, 155, 1, 121, 1, 74, 1, 9, 1, 189, 0, 103, 0, 6, 0, 158, 255, 47, 255, 189, 254, 74, 254, 216, 253, 116, 253, 22, 253,
-191, 252, 125, 252, 72, 252, 34, 252, 22, 252, 35, 252, 63, 252, 110, 252, 175, 252, 248, 252, 72, 253, 168, 253, 11, 254, 112, 254, 212, 254, 47, 255, 129, 255, 201, 255, 0, 0, 44, 0, 73, 0, 80, 0, 76, 0, 60, 0, 28, 0, 248, 255, 207, 255, 160, 255, 121, 255, 86, 255, 50, 255, 24, 255,
-4, 255, 247, 254, 252, 254, 13, 255, 46, 255, 97, 255, 156, 255, 224, 255, 46, 0, 130, 0, 218, 0, 56, 1, 147, 1, 234, 1, 56, 2, 119, 2, 172, 2, 212, 2, 233, 2, 242, 2, 238, 2, 211, 2, 171, 2, 119, 2, 48, 2, 227, 1, 145, 1, 66, 1, 246, 0, 173, 0, 105, 0, 45, 0,
-246, 255, 199, 255, 172, 255, 153, 255, 141, 255, 146, 255, 154, 255, 166, 255, 187, 255, 214, 255, 242, 255, 13, 0, 36, 0, 53, 0, 56, 0, 49, 0, 35, 0, 8, 0, 230, 255, 189, 255, 141, 255, 83, 255, 20, 255, 207, 254, 138, 254, 71, 254, 9, 254, 215, 253, 175, 253, 143, 253, 125, 253, 127, 253,
-144, 253, 176, 253, 237, 253, 52, 254, 131, 254, 226, 254, 68, 255, 169, 255, 20, 0, 127, 0, 231, 0, 70, 1, 153, 1, 226, 1, 25, 2, 58, 2, 76, 2, 78, 2, 55, 2, 19, 2, 227, 1, 161, 1, 89, 1, 13, 1, 190, 0, 114, 0, 40, 0, 226, 255, 161, 255, 104, 255, 55, 255, 28, 255,
-11, 255, 5, 255, 19, 255, 37, 255, 60, 255, 92, 255, 128, 255, 167, 255, 204, 255, 237, 255, 7, 0, 21, 0, 25, 0, 19, 0, 2, 0, 226, 255, 186, 255, 138, 255, 71, 255, 255, 254, 180, 254, 96, 254, 19, 254, 205, 253, 145, 253, 98, 253, 61, 253, 36, 253, 31, 253, 37, 253, 57, 253, 106, 253,
-165, 253, 232, 253, 59, 254, 146, 254, 238, 254, 83, 255, 185, 255, 29, 0, 125, 0, 208, 0, 25, 1, 83, 1, 126, 1, 158, 1, 180, 1, 187, 1, 183, 1, 167, 1, 136, 1, 97, 1, 54, 1, 8, 1, 222, 0, 183, 0, 152, 0, 127, 0, 109, 0, 102, 0, 113, 0, 136, 0, 174, 0, 229, 0,
-33, 1, 99, 1, 171, 1, 243, 1, 61, 2, 139, 2, 207, 2, 11, 3, 63, 3, 89, 3, 101, 3, 98, 3, 67, 3, 23, 3, 222, 2, 140, 2, 47, 2, 200, 1, 84, 1, 218, 0, 97, 0, 234, 255, 118, 255, 6, 255, 159, 254, 63, 254, 236, 253, 167, 253, 120, 253, 91, 253, 76, 253, 78, 253,
-89, 253, 108, 253, 142, 253, 181, 253, 224, 253, 19, 254, 63, 254, 104, 254, 142, 254, 167, 254, 186, 254, 200, 254, 201, 254, 195, 254, 182, 254, 159, 254, 131, 254, 101, 254, 72, 254, 51, 254, 37, 254, 31, 254, 36, 254, 48, 254, 68, 254, 105, 254, 152, 254, 211, 254, 29, 255, 109, 255, 193, 255, 29, 0,
-119, 0, 209, 0, 45, 1, 126, 1, 198, 1, 5, 2, 43, 2, 66, 2, 73, 2, 60, 2, 33, 2, 249, 1, 192, 1, 120, 1, 38, 1, 204, 0, 108, 0, 13, 0, 179, 255, 98, 255, 24, 255, 213, 254, 163, 254, 125, 254, 100, 254, 102, 254, 118, 254, 146, 254, 191, 254, 242, 254, 41, 255, 103, 255,
-172, 255, 241, 255, 55, 0, 115, 0, 165, 0, 205, 0, 224, 0, 230, 0, 224, 0, 205, 0, 171, 0, 127, 0, 71, 0, 3, 0, 187, 255, 113, 255, 41, 255, 228, 254, 163, 254, 110, 254, 62, 254, 20, 254, 3, 254, 0, 254, 10, 254, 49, 254, 102, 254, 164, 254, 239, 254, 68, 255, 158, 255, 0, 0,
-105, 0, 208, 0, 54, 1, 145, 1, 225, 1, 39, 2, 94, 2, 135, 2, 165, 2, 179, 2, 175, 2, 157, 2, 125, 2, 83, 2, 37, 2, 243, 1, 196, 1, 150, 1, 104, 1, 64, 1, 27, 1, 249, 0, 229, 0, 218, 0, 213, 0, 220, 0, 230, 0, 242, 0, 1, 1, 15, 1, 29, 1, 42, 1,
-44, 1, 37, 1, 22, 1, 241, 0, 195, 0, 140, 0, 72, 0, 249, 255, 162, 255, 65, 255, 216, 254, 107, 254, 252, 253, 148, 253, 51, 253, 219, 252, 147, 252, 87, 252, 39, 252, 16, 252, 11, 252, 23, 252, 60, 252, 116, 252, 183, 252, 5, 253, 94, 253, 188, 253, 30, 254, 132, 254, 233, 254, 75, 255,
-158, 255, 230, 255, 34, 0, 75, 0, 103, 0, 121, 0, 125, 0, 113, 0, 91, 0, 60, 0, 21, 0, 236, 255, 195, 255, 158, 255, 123, 255, 90, 255, 71, 255, 60, 255, 56, 255, 74, 255, 109, 255, 154, 255, 214, 255, 28, 0, 103, 0, 182, 0, 8, 1, 94, 1, 183, 1, 7, 2, 81, 2, 148, 2,
-191, 2, 220, 2, 238, 2, 236, 2, 218, 2, 186, 2, 136, 2, 71, 2, 250, 1, 163, 1, 77, 1, 245, 0, 157, 0, 79, 0, 2, 0, 183, 255, 119, 255, 67, 255, 25, 255, 255, 254, 244, 254, 242, 254, 252, 254, 13, 255, 36, 255, 66, 255, 102, 255, 139, 255, 175, 255, 207, 255, 230, 255, 245, 255,
-250, 255, 246, 255, 234, 255, 216, 255, 187, 255, 149, 255, 99, 255, 46, 255, 247, 254, 192, 254, 148, 254, 109, 254, 75, 254, 58, 254, 48, 254, 48, 254, 68, 254, 104, 254, 152, 254, 218, 254, 38, 255, 120, 255, 209, 255, 46, 0, 141, 0, 239, 0, 76, 1, 164, 1, 244, 1, 48, 2, 91, 2, 121, 2,
-130, 2, 120, 2, 97, 2, 59, 2, 0, 2, 188, 1, 112, 1, 26, 1, 196, 0, 110, 0, 23, 0, 198, 255, 121, 255, 53, 255, 255, 254, 212, 254, 185, 254, 173, 254, 172, 254, 180, 254, 197, 254, 218, 254, 244, 254, 22, 255, 55, 255, 89, 255, 117, 255, 136, 255, 148, 255, 145, 255, 131, 255, 110, 255,
-81, 255, 37, 255, 243, 254, 187, 254, 123, 254, 59, 254, 254, 253, 200, 253, 153, 253, 112, 253, 82, 253, 65, 253, 59, 253, 66, 253, 95, 253, 136, 253, 191, 253, 7, 254, 87, 254, 175, 254, 14, 255, 113, 255, 217, 255, 60, 0, 157, 0, 250, 0, 71, 1, 137, 1, 193, 1, 235, 1, 8, 2, 27, 2,
-32, 2, 17, 2, 249, 1, 214, 1, 173, 1, 132, 1, 90, 1, 51, 1, 16, 1, 241, 0, 213, 0, 200, 0, 196, 0, 204, 0, 230, 0, 7, 1, 48, 1, 102, 1, 157, 1, 212, 1, 13, 2, 72, 2, 129, 2, 176, 2, 212, 2, 237, 2, 240, 2, 228, 2, 202, 2, 161, 2, 101, 2, 28, 2,
-199, 1, 92, 1, 237, 0, 122, 0, 0, 0, 137, 255, 20, 255, 163, 254, 60, 254, 222, 253, 140, 253, 80, 253, 34, 253, 2, 253, 249, 252, 252, 252, 11, 253, 44, 253, 84, 253, 132, 253, 191, 253, 252, 253, 59, 254, 119, 254, 171, 254, 216, 254, 0, 255, 29, 255, 51, 255, 68, 255, 72, 255, 68, 255,
-59, 255, 46, 255, 31, 255, 16, 255, 6, 255, 251, 254, 244, 254, 247, 254, 1, 255, 18, 255, 45, 255, 85, 255, 132, 255, 186, 255, 251, 255, 61, 0, 129, 0, 197, 0, 8, 1, 72, 1, 130, 1, 176, 1, 212, 1, 232, 1, 235, 1, 226, 1, 204, 1, 163, 1, 111, 1, 47, 1, 224, 0, 141, 0,
-56, 0, 227, 255, 146, 255, 68, 255, 252, 254, 190, 254, 136, 254, 95, 254, 73, 254, 63, 254, 67, 254, 88, 254, 121, 254, 163, 254, 213, 254, 14, 255, 73, 255, 133, 255, 196, 255, 255, 255, 51, 0, 93, 0, 126, 0, 145, 0, 150, 0, 147, 0, 134, 0, 100, 0, 60, 0, 11, 0, 208, 255, 147, 255,
-87, 255, 27, 255, 226, 254, 175, 254, 131, 254, 106, 254, 91, 254, 87, 254, 111, 254, 145, 254, 190, 254, 2, 255, 78, 255, 162, 255, 2, 0, 104, 0, 209, 0, 59, 1, 162, 1, 3, 2, 90, 2, 162, 2, 223, 2, 19, 3, 49, 3, 64, 3, 67, 3, 46, 3, 13, 3, 225, 2, 171, 2, 111, 2,
-45, 2, 230, 1, 162, 1, 94, 1, 28, 1, 230, 0, 180, 0, 135, 0, 104, 0, 80, 0, 62, 0, 54, 0, 48, 0, 46, 0, 50, 0, 51, 0, 51, 0, 53, 0, 41, 0, 23, 0, 1, 0, 218, 255, 172, 255, 120, 255, 56, 255, 238, 254, 160, 254, 79, 254, 255, 253, 178, 253, 106, 253, 40, 253,
-237, 252, 184, 252, 151, 252, 130, 252, 121, 252, 135, 252, 163, 252, 203, 252, 5, 253, 75, 253, 152, 253, 238, 253, 69, 254, 159, 254, 255, 254, 88, 255, 173, 255, 1, 0, 61, 0, 115, 0, 161, 0, 185, 0, 199, 0, 203, 0, 190, 0, 168, 0, 140, 0, 106, 0, 70, 0, 32, 0, 248, 255, 216, 255,
-188, 255, 166, 255, 162, 255, 166, 255, 178, 255, 205, 255, 244, 255, 35, 0, 92, 0, 157, 0, 226, 0, 41, 1, 113, 1, 184, 1, 252, 1, 51, 2, 96, 2, 131, 2, 144, 2, 147, 2, 138, 2, 109, 2, 66, 2, 14, 2, 200, 1, 123, 1, 41, 1, 210, 0, 120, 0, 30, 0, 196, 255, 121, 255,
-50, 255, 241, 254, 196, 254, 158, 254, 129, 254, 121, 254, 124, 254, 137, 254, 164, 254, 198, 254, 237, 254, 26, 255, 75, 255, 124, 255, 172, 255, 211, 255, 243, 255, 12, 0, 27, 0, 32, 0, 27, 0, 14, 0, 249, 255, 222, 255, 192, 255, 160, 255, 127, 255, 92, 255, 61, 255, 36, 255, 14, 255, 13, 255,
-18, 255, 28, 255, 56, 255, 95, 255, 142, 255, 202, 255, 12, 0, 83, 0, 156, 0, 233, 0, 53, 1, 128, 1, 195, 1, 252, 1, 43, 2, 71, 2, 84, 2, 83, 2, 66, 2, 30, 2, 238, 1, 177, 1, 104, 1, 25, 1, 197, 0, 105, 0, 13, 0, 179, 255, 96, 255, 20, 255, 208, 254, 153, 254,
-108, 254, 73, 254, 52, 254, 47, 254, 51, 254, 63, 254, 88, 254, 116, 254, 145, 254, 182, 254, 217, 254, 249, 254, 20, 255, 39, 255, 52, 255, 56, 255, 52, 255, 41, 255, 20, 255, 247, 254, 213, 254, 175, 254, 136, 254, 95, 254, 53, 254, 17, 254, 243, 253, 219, 253, 212, 253, 214, 253, 225, 253, 251, 253,
-34, 254, 83, 254, 148, 254, 223, 254, 48, 255, 137, 255, 226, 255, 63, 0, 159, 0, 250, 0, 79, 1, 159, 1, 224, 1, 21, 2, 64, 2, 91, 2, 103, 2, 105, 2, 94, 2, 72, 2, 44, 2, 7, 2, 221, 1, 174, 1, 123, 1, 80, 1, 41, 1, 6, 1, 238, 0, 223, 0, 215, 0, 216, 0,
-233, 0, 1, 1, 29, 1, 64, 1, 101, 1, 140, 1, 179, 1, 216, 1, 251, 1, 22, 2, 37, 2, 41, 2, 29, 2, 1, 2, 217, 1, 163, 1, 91, 1, 11, 1, 180, 0, 79, 0, 231, 255, 123, 255, 15, 255, 167, 254, 69, 254, 242, 253, 169, 253, 104, 253, 53, 253, 23, 253, 4, 253, 255, 252,
-21, 253, 51, 253, 86, 253, 143, 253, 203, 253, 9, 254, 83, 254, 155, 254, 226, 254, 37, 255, 98, 255, 153, 255, 197, 255, 231, 255, 2, 0, 17, 0, 23, 0, 22, 0, 12, 0, 249, 255, 226, 255, 202, 255, 179, 255, 160, 255, 145, 255, 138, 255, 134, 255, 137, 255, 148, 255, 169, 255, 198, 255, 234, 255,
-19, 0, 62, 0, 109, 0, 154, 0, 201, 0, 248, 0, 29, 1, 57, 1, 77, 1, 82, 1, 72, 1, 53, 1, 23, 1, 237, 0, 188, 0, 132, 0, 69, 0, 1, 0, 186, 255, 114, 255, 46, 255, 237, 254, 184, 254, 138, 254, 99, 254, 73, 254, 60, 254, 59, 254, 72, 254, 99, 254, 134, 254, 175, 254,
-223, 254, 19, 255, 75, 255, 137, 255, 196, 255, 253, 255, 50, 0, 87, 0, 117, 0, 138, 0, 139, 0, 133, 0, 121, 0, 92, 0, 59, 0, 23, 0, 230, 255, 181, 255, 133, 255, 90, 255, 55, 255, 27, 255, 9, 255, 2, 255, 3, 255, 17, 255, 51, 255, 97, 255, 154, 255, 226, 255, 47, 0, 129, 0,
-219, 0, 55, 1, 147, 1, 240, 1, 68, 2, 145, 2, 212, 2, 3, 3, 39, 3, 60, 3, 59, 3, 47, 3, 23, 3, 230, 2, 171, 2, 103, 2, 19, 2, 190, 1, 105, 1, 22, 1, 197, 0, 119, 0, 46, 0, 236, 255, 180, 255, 136, 255, 106, 255, 83, 255, 69, 255, 63, 255, 65, 255, 72, 255,
-82, 255, 98, 255, 114, 255, 124, 255, 131, 255, 130, 255, 119, 255, 102, 255, 78, 255, 43, 255, 6, 255, 220, 254, 172, 254, 117, 254, 61, 254, 4, 254, 206, 253, 159, 253, 118, 253, 85, 253, 64, 253, 52, 253, 48, 253, 71, 253, 102, 253, 141, 253, 200, 253, 7, 254, 73, 254, 148, 254, 229, 254, 57, 255,
-141, 255, 224, 255, 45, 0, 112, 0, 166, 0, 209, 0, 243, 0, 5, 1, 15, 1, 15, 1, 0, 1, 233, 0, 203, 0, 164, 0, 126, 0, 89, 0, 56, 0, 25, 0, 254, 255, 233, 255, 219, 255, 215, 255, 224, 255, 245, 255, 20, 0, 59, 0, 102, 0, 150, 0, 202, 0, 1, 1, 58, 1, 114, 1,
-166, 1, 204, 1, 233, 1, 254, 1, 253, 1, 245, 1, 231, 1, 197, 1, 152, 1, 98, 1, 28, 1, 204, 0, 121, 0, 40, 0, 214, 255, 137, 255, 68, 255, 3, 255, 201, 254, 152, 254, 122, 254, 103, 254, 97, 254, 108, 254, 128, 254, 156, 254, 195, 254, 242, 254, 39, 255, 100, 255, 161, 255, 220, 255,
-20, 0, 62, 0, 98, 0, 128, 0, 146, 0, 156, 0, 160, 0, 153, 0, 135, 0, 110, 0, 75, 0, 39, 0, 2, 0, 222, 255, 189, 255, 159, 255, 133, 255, 116, 255, 108, 255, 110, 255, 127, 255, 154, 255, 189, 255, 231, 255, 24, 0, 78, 0, 137, 0, 202, 0, 10, 1, 72, 1, 123, 1, 165, 1,
-196, 1, 208, 1, 208, 1, 197, 1, 174, 1, 134, 1, 83, 1, 20, 1, 202, 0, 122, 0, 41, 0, 215, 255, 134, 255, 55, 255, 236, 254, 168, 254, 106, 254, 60, 254, 26, 254, 3, 254, 253, 253, 0, 254, 10, 254, 32, 254, 62, 254, 98, 254, 142, 254, 189, 254, 235, 254, 24, 255, 59, 255, 88, 255,
-112, 255, 127, 255, 137, 255, 139, 255, 127, 255, 107, 255, 80, 255, 43, 255, 8, 255, 229, 254, 194, 254, 168, 254, 144, 254, 122, 254, 115, 254, 116, 254, 125, 254, 154, 254, 192, 254, 238, 254, 43, 255, 108, 255, 181, 255, 6, 0, 94, 0, 184, 0, 20, 1, 104, 1, 181, 1, 250, 1, 45, 2, 88, 2,
-124, 2, 144, 2, 150, 2, 145, 2, 123, 2, 87, 2, 44, 2, 250, 1, 195, 1, 139, 1, 83, 1, 26, 1, 230, 0, 182, 0, 146, 0, 119, 0, 102, 0, 99, 0, 103, 0, 114, 0, 132, 0, 156, 0, 185, 0, 219, 0, 3, 1, 40, 1, 75, 1, 95, 1, 107, 1, 112, 1, 96, 1, 74, 1,
-43, 1, 249, 0, 189, 0, 121, 0, 41, 0, 215, 255, 130, 255, 45, 255, 217, 254, 135, 254, 55, 254, 244, 253, 185, 253, 136, 253, 106, 253, 93, 253, 92, 253, 107, 253, 137, 253, 175, 253, 224, 253, 31, 254, 99, 254, 174, 254, 251, 254, 68, 255, 137, 255, 200, 255, 255, 255, 49, 0, 90, 0, 117, 0,
-133, 0, 135, 0, 125, 0, 106, 0, 80, 0, 51, 0, 17, 0, 236, 255, 203, 255, 169, 255, 138, 255, 119, 255, 106, 255, 98, 255, 104, 255, 116, 255, 136, 255, 167, 255, 201, 255, 242, 255, 34, 0, 89, 0, 139, 0, 184, 0, 222, 0, 249, 0, 11, 1, 22, 1, 22, 1, 14, 1, 252, 0, 217, 0,
-174, 0, 123, 0, 63, 0, 1, 0, 192, 255, 124, 255, 56, 255, 246, 254, 189, 254, 141, 254, 101, 254, 77, 254, 66, 254, 65, 254, 79, 254, 105, 254, 138, 254, 177, 254, 227, 254, 30, 255, 96, 255, 160, 255, 225, 255, 32, 0, 79, 0, 123, 0, 162, 0, 187, 0, 201, 0, 206, 0, 199, 0, 180, 0,
-158, 0, 132, 0, 98, 0, 63, 0, 27, 0, 247, 255, 214, 255, 185, 255, 167, 255, 159, 255, 160, 255, 176, 255, 205, 255, 242, 255, 32, 0, 88, 0, 148, 0, 214, 0, 33, 1, 109, 1, 184, 1, 252, 1, 56, 2, 108, 2, 146, 2, 170, 2, 184, 2, 183, 2, 160, 2, 124, 2, 77, 2, 14, 2,
-200, 1, 124, 1, 41, 1, 212, 0, 128, 0, 47, 0, 227, 255, 156, 255, 94, 255, 44, 255, 3, 255, 229, 254, 213, 254, 206, 254, 206, 254, 220, 254, 241, 254, 11, 255, 42, 255, 72, 255, 100, 255, 124, 255, 141, 255, 154, 255, 160, 255, 156, 255, 143, 255, 120, 255, 85, 255, 45, 255, 0, 255, 204, 254,
-150, 254, 95, 254, 42, 254, 249, 253, 206, 253, 176, 253, 155, 253, 143, 253, 145, 253, 164, 253, 194, 253, 233, 253, 28, 254, 88, 254, 155, 254, 233, 254, 59, 255, 144, 255, 227, 255, 50, 0, 124, 0, 189, 0, 243, 0, 31, 1, 63, 1, 77, 1, 82, 1, 79, 1, 63, 1, 41, 1, 11, 1, 229, 0,
-187, 0, 143, 0, 100, 0, 62, 0, 27, 0, 254, 255, 236, 255, 227, 255, 226, 255, 238, 255, 1, 0, 24, 0, 58, 0, 96, 0, 137, 0, 187, 0, 231, 0, 18, 1, 59, 1, 87, 1, 109, 1, 124, 1, 121, 1, 109, 1, 88, 1, 50, 1, 6, 1, 210, 0, 149, 0, 84, 0, 16, 0, 203, 255,
-139, 255, 79, 255, 24, 255, 234, 254, 196, 254, 166, 254, 152, 254, 151, 254, 160, 254, 184, 254, 218, 254, 4, 255, 55, 255, 111, 255, 170, 255, 233, 255, 34, 0, 88, 0, 142, 0, 180, 0, 212, 0, 237, 0, 244, 0, 244, 0, 238, 0, 218, 0, 190, 0, 155, 0, 113, 0, 68, 0, 23, 0, 235, 255,
-195, 255, 159, 255, 127, 255, 105, 255, 92, 255, 89, 255, 100, 255, 120, 255, 147, 255, 185, 255, 230, 255, 22, 0, 76, 0, 131, 0, 184, 0, 234, 0, 17, 1, 49, 1, 73, 1, 77, 1, 71, 1, 56, 1, 28, 1, 246, 0, 200, 0, 145, 0, 80, 0, 10, 0, 193, 255, 120, 255, 49, 255, 237, 254,
-177, 254, 124, 254, 79, 254, 48, 254, 28, 254, 18, 254, 20, 254, 33, 254, 55, 254, 82, 254, 120, 254, 162, 254, 205, 254, 251, 254, 41, 255, 82, 255, 117, 255, 145, 255, 165, 255, 178, 255, 184, 255, 184, 255, 174, 255, 158, 255, 139, 255, 113, 255, 85, 255, 59, 255, 37, 255, 19, 255, 5, 255, 252, 254,
-254, 254, 8, 255, 27, 255, 61, 255, 105, 255, 157, 255, 219, 255, 30, 0, 100, 0, 175, 0, 250, 0, 68, 1, 140, 1, 206, 1, 8, 2, 55, 2, 86, 2, 106, 2, 115, 2, 110, 2, 93, 2, 67, 2, 26, 2, 233, 1, 177, 1, 115, 1, 54, 1, 249, 0, 189, 0, 134, 0, 84, 0, 39, 0,
-6, 0, 239, 255, 225, 255, 223, 255, 229, 255, 241, 255, 5, 0, 29, 0, 57, 0, 89, 0, 121, 0, 152, 0, 181, 0, 199, 0, 209, 0, 211, 0, 199, 0, 181, 0, 156, 0, 120, 0, 78, 0, 28, 0, 223, 255, 163, 255, 101, 255, 37, 255, 237, 254, 184, 254, 134, 254, 96, 254, 66, 254, 43, 254,
-37, 254, 40, 254, 53, 254, 76, 254, 109, 254, 147, 254, 191, 254, 242, 254, 40, 255, 95, 255, 149, 255, 198, 255, 243, 255, 19, 0, 48, 0, 72, 0, 83, 0, 88, 0, 88, 0, 72, 0, 51, 0, 26, 0, 251, 255, 222, 255, 193, 255, 166, 255, 140, 255, 119, 255, 101, 255, 91, 255, 91, 255, 98, 255,
-114, 255, 138, 255, 166, 255, 200, 255, 233, 255, 13, 0, 54, 0, 91, 0, 127, 0, 161, 0, 178, 0, 190, 0, 195, 0, 187, 0, 172, 0, 152, 0, 119, 0, 79, 0, 33, 0, 236, 255, 182, 255, 127, 255, 72, 255, 24, 255, 234, 254, 191, 254, 161, 254, 138, 254, 122, 254, 125, 254, 137, 254, 157, 254,
-190, 254, 229, 254, 16, 255, 65, 255, 122, 255, 182, 255, 242, 255, 46, 0, 102, 0, 152, 0, 192, 0, 227, 0, 1, 1, 21, 1, 33, 1, 38, 1, 32, 1, 15, 1, 251, 0, 229, 0, 201, 0, 175, 0, 152, 0, 127, 0, 107, 0, 92, 0, 82, 0, 80, 0, 84, 0, 95, 0, 113, 0, 135, 0,
-158, 0, 186, 0, 217, 0, 252, 0, 27, 1, 56, 1, 84, 1, 101, 1, 112, 1, 116, 1, 112, 1, 100, 1, 82, 1, 55, 1, 18, 1, 232, 0, 186, 0, 134, 0, 82, 0, 33, 0, 238, 255, 191, 255, 147, 255, 107, 255, 74, 255, 48, 255, 31, 255, 24, 255, 23, 255, 27, 255, 39, 255, 54, 255,
-70, 255, 95, 255, 121, 255, 146, 255, 170, 255, 186, 255, 198, 255, 202, 255, 201, 255, 196, 255, 184, 255, 162, 255, 135, 255, 104, 255, 66, 255, 29, 255, 250, 254, 215, 254, 182, 254, 153, 254, 128, 254, 109, 254, 95, 254, 90, 254, 97, 254, 112, 254, 135, 254, 170, 254, 210, 254, 251, 254, 45, 255, 98, 255,
-153, 255, 212, 255, 12, 0, 65, 0, 109, 0, 148, 0, 182, 0, 209, 0, 227, 0, 238, 0, 239, 0, 230, 0, 215, 0, 196, 0, 171, 0, 144, 0, 117, 0, 90, 0, 64, 0, 39, 0, 17, 0, 255, 255, 241, 255, 235, 255, 236, 255, 242, 255, 252, 255, 10, 0, 25, 0, 41, 0, 65, 0, 88, 0,
-110, 0, 133, 0, 146, 0, 153, 0, 160, 0, 160, 0, 156, 0, 151, 0, 133, 0, 113, 0, 94, 0, 66, 0, 40, 0, 15, 0, 244, 255, 220, 255, 199, 255, 180, 255, 167, 255, 159, 255, 157, 255, 164, 255, 178, 255, 198, 255, 222, 255, 248, 255, 21, 0, 52, 0, 85, 0, 120, 0, 153, 0, 182, 0,
-207, 0, 221, 0, 230, 0, 234, 0, 234, 0, 223, 0, 207, 0, 183, 0, 150, 0, 116, 0, 82, 0, 45, 0, 11, 0, 235, 255, 201, 255, 171, 255, 145, 255, 120, 255, 103, 255, 91, 255, 86, 255, 92, 255, 102, 255, 115, 255, 132, 255, 151, 255, 172, 255, 199, 255, 226, 255, 252, 255, 18, 0, 33, 0,
-43, 0, 50, 0, 52, 0, 50, 0, 44, 0, 28, 0, 5, 0, 236, 255, 206, 255, 177, 255, 147, 255, 120, 255, 95, 255, 72, 255, 51, 255, 34, 255, 20, 255, 11, 255, 9, 255, 11, 255, 20, 255, 33, 255, 47, 255, 62, 255, 81, 255, 101, 255, 123, 255, 144, 255, 162, 255, 177, 255, 185, 255, 190, 255,
-194, 255, 194, 255, 192, 255, 185, 255, 176, 255, 164, 255, 151, 255, 140, 255, 133, 255, 126, 255, 122, 255, 123, 255, 128, 255, 136, 255, 150, 255, 172, 255, 198, 255, 230, 255, 15, 0, 58, 0, 101, 0, 146, 0, 190, 0, 232, 0, 17, 1, 55, 1, 90, 1, 113, 1, 130, 1, 140, 1, 138, 1, 132, 1,
-120, 1, 99, 1, 68, 1, 34, 1, 249, 0, 209, 0, 168, 0, 129, 0, 91, 0, 57, 0, 26, 0, 253, 255, 232, 255, 214, 255, 201, 255, 198, 255, 201, 255, 210, 255, 224, 255, 240, 255, 3, 0, 22, 0, 45, 0, 67, 0, 85, 0, 100, 0, 112, 0, 118, 0, 121, 0, 122, 0, 120, 0, 111, 0,
-99, 0, 81, 0, 58, 0, 35, 0, 11, 0, 244, 255, 223, 255, 202, 255, 189, 255, 176, 255, 165, 255, 158, 255, 154, 255, 153, 255, 157, 255, 164, 255, 173, 255, 183, 255, 191, 255, 198, 255, 205, 255, 211, 255, 215, 255, 215, 255, 209, 255, 198, 255, 184, 255, 168, 255, 147, 255, 125, 255, 102, 255, 74, 255,
-49, 255, 26, 255, 3, 255, 242, 254, 227, 254, 218, 254, 215, 254, 217, 254, 224, 254, 237, 254, 255, 254, 26, 255, 56, 255, 91, 255, 131, 255, 171, 255, 210, 255, 249, 255, 25, 0, 56, 0, 83, 0, 103, 0, 115, 0, 122, 0, 121, 0, 111, 0, 95, 0, 74, 0, 46, 0, 14, 0, 233, 255, 196, 255,
-161, 255, 125, 255, 94, 255, 67, 255, 44, 255, 31, 255, 23, 255, 22, 255, 29, 255, 43, 255, 64, 255, 92, 255, 128, 255, 167, 255, 211, 255, 0, 0, 46, 0, 90, 0, 131, 0, 167, 0, 199, 0, 226, 0, 245, 0, 5, 1, 17, 1, 20, 1, 18, 1, 13, 1, 0, 1, 241, 0, 223, 0, 206, 0,
-188, 0, 171, 0, 156, 0, 146, 0, 138, 0, 136, 0, 137, 0, 141, 0, 146, 0, 157, 0, 166, 0, 175, 0, 190, 0, 200, 0, 207, 0, 213, 0, 211, 0, 205, 0, 197, 0, 178, 0, 155, 0, 128, 0, 96, 0, 61, 0, 22, 0, 237, 255, 195, 255, 154, 255, 118, 255, 85, 255, 55, 255, 33, 255,
-19, 255, 10, 255, 9, 255, 18, 255, 33, 255, 55, 255, 85, 255, 119, 255, 156, 255, 198, 255, 241, 255, 28, 0, 66, 0, 102, 0, 133, 0, 153, 0, 166, 0, 172, 0, 170, 0, 159, 0, 143, 0, 119, 0, 84, 0, 44, 0, 255, 255, 208, 255, 161, 255, 114, 255, 73, 255, 33, 255, 253, 254, 226, 254,
-207, 254, 193, 254, 189, 254, 195, 254, 206, 254, 222, 254, 247, 254, 20, 255, 51, 255, 90, 255, 129, 255, 169, 255, 206, 255, 238, 255, 7, 0, 27, 0, 42, 0, 52, 0, 55, 0, 51, 0, 42, 0, 26, 0, 6, 0, 240, 255, 216, 255, 193, 255, 171, 255, 150, 255, 133, 255, 121, 255, 113, 255, 113, 255,
-122, 255, 136, 255, 156, 255, 181, 255, 208, 255, 240, 255, 15, 0, 50, 0, 89, 0, 122, 0, 155, 0, 182, 0, 197, 0, 209, 0, 215, 0, 211, 0, 205, 0, 191, 0, 166, 0, 138, 0, 105, 0, 69, 0, 34, 0, 4, 0, 233, 255, 209, 255, 192, 255, 182, 255, 178, 255, 184, 255, 197, 255, 219, 255,
-251, 255, 31, 0, 70, 0, 116, 0, 163, 0, 210, 0, 6, 1, 54, 1, 98, 1, 133, 1, 154, 1, 166, 1, 167, 1, 157, 1, 139, 1, 113, 1, 73, 1, 24, 1, 223, 0, 161, 0, 97, 0, 31, 0, 226, 255, 167, 255, 111, 255, 62, 255, 21, 255, 242, 254, 217, 254, 207, 254, 204, 254, 207, 254,
-222, 254, 240, 254, 5, 255, 32, 255, 64, 255, 99, 255, 133, 255, 166, 255, 193, 255, 208, 255, 222, 255, 230, 255, 229, 255, 224, 255, 213, 255, 195, 255, 172, 255, 146, 255, 118, 255, 92, 255, 68, 255, 47, 255, 29, 255, 17, 255, 10, 255, 8, 255, 17, 255, 33, 255, 58, 255, 89, 255, 127, 255, 170, 255,
-208, 255, 253, 255, 44, 0, 87, 0, 130, 0, 168, 0, 197, 0, 212, 0, 220, 0, 220, 0, 209, 0, 191, 0, 166, 0, 128, 0, 82, 0, 32, 0, 236, 255, 184, 255, 133, 255, 89, 255, 50, 255, 17, 255, 247, 254, 235, 254, 231, 254, 235, 254, 1, 255, 32, 255, 70, 255, 118, 255, 171, 255, 229, 255,
-36, 0, 101, 0, 167, 0, 231, 0, 28, 1, 74, 1, 109, 1, 132, 1, 147, 1, 154, 1, 144, 1, 123, 1, 93, 1, 48, 1, 254, 0, 200, 0, 143, 0, 86, 0, 30, 0, 234, 255, 188, 255, 149, 255, 115, 255, 96, 255, 86, 255, 86, 255, 101, 255, 122, 255, 147, 255, 182, 255, 219, 255, 4, 0,
-53, 0, 98, 0, 140, 0, 178, 0, 203, 0, 224, 0, 240, 0, 244, 0, 243, 0, 235, 0, 213, 0, 186, 0, 157, 0, 121, 0, 87, 0, 53, 0, 21, 0, 248, 255, 223, 255, 203, 255, 188, 255, 181, 255, 182, 255, 195, 255, 213, 255, 235, 255, 7, 0, 36, 0, 66, 0, 95, 0, 124, 0, 151, 0,
-172, 0, 179, 0, 176, 0, 165, 0, 140, 0, 109, 0, 70, 0, 20, 0, 218, 255, 154, 255, 84, 255, 13, 255, 198, 254, 130, 254, 71, 254, 18, 254, 230, 253, 203, 253, 185, 253, 177, 253, 189, 253, 212, 253, 247, 253, 40, 254, 98, 254, 161, 254, 230, 254, 50, 255, 128, 255, 205, 255, 24, 0, 92, 0,
-151, 0, 195, 0, 232, 0, 5, 1, 15, 1, 14, 1, 4, 1, 231, 0, 195, 0, 151, 0, 100, 0, 46, 0, 247, 255, 195, 255, 146, 255, 101, 255, 62, 255, 37, 255, 20, 255, 12, 255, 23, 255, 43, 255, 70, 255, 110, 255, 156, 255, 206, 255, 10, 0, 69, 0, 128, 0, 187, 0, 235, 0, 22, 1,
-59, 1, 83, 1, 101, 1, 111, 1, 108, 1, 93, 1, 69, 1, 39, 1, 2, 1, 220, 0, 180, 0, 139, 0, 102, 0, 70, 0, 40, 0, 17, 0, 2, 0, 251, 255, 253, 255, 7, 0, 26, 0, 50, 0, 78, 0, 112, 0, 144, 0, 177, 0, 213, 0, 237, 0, 1, 1, 16, 1, 12, 1, 3, 1,
-243, 0, 209, 0, 168, 0, 121, 0, 61, 0, 254, 255, 189, 255, 122, 255, 58, 255, 254, 254, 200, 254, 157, 254, 123, 254, 100, 254, 93, 254, 99, 254, 115, 254, 146, 254, 190, 254, 242, 254, 46, 255, 114, 255, 186, 255, 5, 0, 79, 0, 149, 0, 216, 0, 15, 1, 60, 1, 96, 1, 116, 1, 121, 1,
-115, 1, 91, 1, 52, 1, 4, 1, 204, 0, 140, 0, 72, 0, 3, 0, 190, 255, 124, 255, 64, 255, 12, 255, 227, 254, 194, 254, 172, 254, 163, 254, 164, 254, 175, 254, 199, 254, 229, 254, 12, 255, 57, 255, 103, 255, 149, 255, 195, 255, 236, 255, 17, 0, 43, 0, 64, 0, 77, 0, 78, 0, 70, 0,
-55, 0, 30, 0, 253, 255, 217, 255, 176, 255, 136, 255, 97, 255, 60, 255, 29, 255, 4, 255, 243, 254, 237, 254, 241, 254, 254, 254, 19, 255, 52, 255, 92, 255, 141, 255, 196, 255, 255, 255, 60, 0, 122, 0, 179, 0, 230, 0, 20, 1, 56, 1, 82, 1, 97, 1, 98, 1, 88, 1, 67, 1, 33, 1,
-249, 0, 202, 0, 149, 0, 97, 0, 45, 0, 252, 255, 207, 255, 170, 255, 141, 255, 123, 255, 115, 255, 120, 255, 137, 255, 165, 255, 201, 255, 250, 255, 50, 0, 109, 0, 173, 0, 235, 0, 40, 1, 94, 1, 143, 1, 185, 1, 215, 1, 231, 1, 236, 1, 223, 1, 194, 1, 154, 1, 102, 1, 37, 1,
-222, 0, 145, 0, 66, 0, 243, 255, 163, 255, 93, 255, 28, 255, 226, 254, 181, 254, 149, 254, 125, 254, 113, 254, 114, 254, 125, 254, 147, 254, 179, 254, 217, 254, 3, 255, 45, 255, 86, 255, 126, 255, 162, 255, 191, 255, 212, 255, 227, 255, 231, 255, 228, 255, 217, 255, 198, 255, 174, 255, 146, 255, 112, 255,
-77, 255, 41, 255, 12, 255, 242, 254, 220, 254, 213, 254, 213, 254, 220, 254, 242, 254, 12, 255, 45, 255, 94, 255, 147, 255, 205, 255, 17, 0, 80, 0, 142, 0, 204, 0, 254, 0, 44, 1, 85, 1, 107, 1, 119, 1, 120, 1, 103, 1, 74, 1, 37, 1, 242, 0, 187, 0, 125, 0, 54, 0, 247, 255,
-181, 255, 115, 255, 63, 255, 16, 255, 230, 254, 207, 254, 195, 254, 193, 254, 207, 254, 233, 254, 14, 255, 64, 255, 123, 255, 186, 255, 252, 255, 61, 0, 127, 0, 192, 0, 248, 0, 44, 1, 89, 1, 118, 1, 134, 1, 140, 1, 132, 1, 111, 1, 79, 1, 38, 1, 242, 0, 187, 0, 127, 0, 67, 0,
-10, 0, 212, 255, 166, 255, 130, 255, 101, 255, 81, 255, 74, 255, 74, 255, 83, 255, 108, 255, 140, 255, 178, 255, 222, 255, 10, 0, 54, 0, 99, 0, 140, 0, 178, 0, 208, 0, 227, 0, 239, 0, 240, 0, 234, 0, 222, 0, 201, 0, 174, 0, 141, 0, 102, 0, 65, 0, 26, 0, 242, 255, 211, 255,
-186, 255, 168, 255, 157, 255, 157, 255, 163, 255, 173, 255, 196, 255, 223, 255, 255, 255, 39, 0, 78, 0, 117, 0, 150, 0, 180, 0, 206, 0, 220, 0, 226, 0, 222, 0, 199, 0, 165, 0, 123, 0, 68, 0, 4, 0, 191, 255, 118, 255, 39, 255, 218, 254, 145, 254, 77, 254, 17, 254, 221, 253, 181, 253,
-154, 253, 139, 253, 139, 253, 154, 253, 181, 253, 223, 253, 24, 254, 89, 254, 163, 254, 238, 254, 60, 255, 139, 255, 215, 255, 34, 0, 104, 0, 164, 0, 210, 0, 246, 0, 13, 1, 20, 1, 19, 1, 8, 1, 236, 0, 203, 0, 163, 0, 115, 0, 69, 0, 25, 0, 236, 255, 200, 255, 169, 255, 146, 255,
-131, 255, 125, 255, 127, 255, 142, 255, 165, 255, 198, 255, 240, 255, 29, 0, 78, 0, 126, 0, 176, 0, 226, 0, 14, 1, 51, 1, 82, 1, 100, 1, 109, 1, 110, 1, 104, 1, 89, 1, 68, 1, 41, 1, 1, 1, 217, 0, 176, 0, 130, 0, 90, 0, 54, 0, 22, 0, 1, 0, 241, 255, 229, 255,
-230, 255, 235, 255, 246, 255, 15, 0, 41, 0, 69, 0, 102, 0, 132, 0, 160, 0, 189, 0, 209, 0, 223, 0, 230, 0, 222, 0, 205, 0, 177, 0, 142, 0, 100, 0, 49, 0, 250, 255, 190, 255, 127, 255, 67, 255, 10, 255, 212, 254, 169, 254, 134, 254, 108, 254, 93, 254, 91, 254, 99, 254, 118, 254,
-155, 254, 200, 254, 255, 254, 64, 255, 131, 255, 198, 255, 13, 0, 82, 0, 148, 0, 208, 0, 3, 1, 45, 1, 71, 1, 87, 1, 92, 1, 84, 1, 64, 1, 33, 1, 250, 0, 199, 0, 145, 0, 87, 0, 28, 0, 229, 255, 177, 255, 130, 255, 91, 255, 57, 255, 30, 255, 15, 255, 8, 255, 10, 255,
-22, 255, 42, 255, 68, 255, 93, 255, 125, 255, 158, 255, 189, 255, 221, 255, 249, 255, 11, 0, 22, 0, 28, 0, 27, 0, 16, 0, 2, 0, 241, 255, 214, 255, 183, 255, 150, 255, 111, 255, 78, 255, 49, 255, 20, 255, 4, 255, 247, 254, 240, 254, 249, 254, 6, 255, 24, 255, 60, 255, 100, 255, 144, 255,
-197, 255, 251, 255, 50, 0, 106, 0, 162, 0, 215, 0, 5, 1, 44, 1, 74, 1, 92, 1, 100, 1, 100, 1, 91, 1, 71, 1, 45, 1, 12, 1, 227, 0, 185, 0, 141, 0, 97, 0, 59, 0, 25, 0, 251, 255, 229, 255, 213, 255, 205, 255, 210, 255, 224, 255, 245, 255, 23, 0, 59, 0, 99, 0,
-143, 0, 187, 0, 230, 0, 17, 1, 53, 1, 83, 1, 106, 1, 117, 1, 121, 1, 117, 1, 97, 1, 70, 1, 35, 1, 242, 0, 185, 0, 124, 0, 58, 0, 248, 255, 184, 255, 124, 255, 67, 255, 15, 255, 227, 254, 190, 254, 162, 254, 144, 254, 137, 254, 138, 254, 145, 254, 162, 254, 182, 254, 206, 254,
-236, 254, 11, 255, 41, 255, 71, 255, 94, 255, 113, 255, 127, 255, 134, 255, 138, 255, 139, 255, 134, 255, 124, 255, 110, 255, 92, 255, 72, 255, 52, 255, 35, 255, 23, 255, 16, 255, 14, 255, 21, 255, 34, 255, 52, 255, 84, 255, 121, 255, 163, 255, 212, 255, 8, 0, 62, 0, 117, 0, 173, 0, 226, 0,
-20, 1, 62, 1, 96, 1, 123, 1, 135, 1, 140, 1, 136, 1, 117, 1, 91, 1, 58, 1, 14, 1, 220, 0, 165, 0, 109, 0, 51, 0, 251, 255, 199, 255, 153, 255, 112, 255, 75, 255, 52, 255, 37, 255, 30, 255, 36, 255, 51, 255, 72, 255, 102, 255, 137, 255, 177, 255, 221, 255, 9, 0, 53, 0,
-94, 0, 131, 0, 162, 0, 189, 0, 207, 0, 219, 0, 224, 0, 221, 0, 209, 0, 191, 0, 169, 0, 138, 0, 105, 0, 74, 0, 42, 0, 12, 0, 241, 255, 216, 255, 198, 255, 186, 255, 182, 255, 184, 255, 191, 255, 205, 255, 223, 255, 246, 255, 18, 0, 49, 0, 80, 0, 111, 0, 136, 0, 159, 0,
-178, 0, 188, 0, 196, 0, 201, 0, 196, 0, 188, 0, 176, 0, 158, 0, 134, 0, 108, 0, 80, 0, 51, 0, 23, 0, 255, 255, 234, 255, 217, 255, 203, 255, 197, 255, 197, 255, 203, 255, 212, 255, 225, 255, 240, 255, 3, 0, 23, 0, 44, 0, 65, 0, 81, 0, 93, 0, 101, 0, 100, 0, 94, 0,
-82, 0, 60, 0, 28, 0, 245, 255, 202, 255, 152, 255, 99, 255, 42, 255, 241, 254, 186, 254, 132, 254, 86, 254, 45, 254, 9, 254, 237, 253, 220, 253, 211, 253, 216, 253, 232, 253, 1, 254, 35, 254, 78, 254, 128, 254, 186, 254, 246, 254, 53, 255, 119, 255, 178, 255, 237, 255, 41, 0, 88, 0, 133, 0,
-172, 0, 198, 0, 220, 0, 236, 0, 241, 0, 240, 0, 234, 0, 224, 0, 208, 0, 192, 0, 176, 0, 158, 0, 141, 0, 126, 0, 118, 0, 112, 0, 108, 0, 112, 0, 117, 0, 124, 0, 136, 0, 152, 0, 170, 0, 190, 0, 206, 0, 222, 0, 237, 0, 244, 0, 251, 0, 1, 1, 252, 0, 244, 0,
-233, 0, 219, 0, 199, 0, 176, 0, 150, 0, 121, 0, 92, 0, 64, 0, 35, 0, 10, 0, 243, 255, 223, 255, 209, 255, 202, 255, 200, 255, 201, 255, 205, 255, 215, 255, 226, 255, 240, 255, 4, 0, 24, 0, 42, 0, 59, 0, 73, 0, 82, 0, 88, 0, 92, 0, 88, 0, 79, 0, 64, 0, 44, 0,
-20, 0, 248, 255, 217, 255, 185, 255, 152, 255, 120, 255, 89, 255, 62, 255, 37, 255, 19, 255, 6, 255, 1, 255, 5, 255, 13, 255, 28, 255, 51, 255, 79, 255, 111, 255, 153, 255, 196, 255, 241, 255, 29, 0, 70, 0, 107, 0, 144, 0, 175, 0, 201, 0, 219, 0, 230, 0, 235, 0, 230, 0, 219, 0,
-204, 0, 182, 0, 154, 0, 123, 0, 91, 0, 53, 0, 16, 0, 236, 255, 203, 255, 171, 255, 144, 255, 122, 255, 103, 255, 86, 255, 74, 255, 69, 255, 68, 255, 70, 255, 80, 255, 87, 255, 92, 255, 103, 255, 110, 255, 115, 255, 127, 255, 132, 255, 135, 255, 137, 255, 135, 255, 131, 255, 128, 255, 123, 255,
-117, 255, 111, 255, 105, 255, 101, 255, 97, 255, 98, 255, 103, 255, 111, 255, 126, 255, 145, 255, 167, 255, 191, 255, 220, 255, 251, 255, 30, 0, 71, 0, 111, 0, 150, 0, 189, 0, 224, 0, 1, 1, 28, 1, 54, 1, 77, 1, 88, 1, 95, 1, 97, 1, 91, 1, 81, 1, 67, 1, 49, 1, 26, 1,
-2, 1, 234, 0, 201, 0, 174, 0, 149, 0, 122, 0, 103, 0, 88, 0, 75, 0, 64, 0, 57, 0, 54, 0, 56, 0, 61, 0, 70, 0, 80, 0, 88, 0, 95, 0, 101, 0, 107, 0, 112, 0, 115, 0, 113, 0, 108, 0, 98, 0, 83, 0, 66, 0, 45, 0, 21, 0, 251, 255, 221, 255, 189, 255,
-156, 255, 122, 255, 89, 255, 59, 255, 32, 255, 9, 255, 247, 254, 232, 254, 220, 254, 214, 254, 211, 254, 214, 254, 224, 254, 236, 254, 250, 254, 7, 255, 22, 255, 39, 255, 55, 255, 74, 255, 93, 255, 111, 255, 125, 255, 137, 255, 146, 255, 154, 255, 161, 255, 169, 255, 171, 255, 175, 255, 178, 255, 179, 255,
-181, 255, 187, 255, 195, 255, 207, 255, 221, 255, 235, 255, 255, 255, 18, 0, 37, 0, 65, 0, 93, 0, 119, 0, 148, 0, 171, 0, 192, 0, 212, 0, 227, 0, 241, 0, 0, 1, 4, 1, 6, 1, 5, 1, 248, 0, 232, 0, 216, 0, 193, 0, 168, 0, 141, 0, 107, 0, 72, 0, 38, 0, 4, 0,
-229, 255, 201, 255, 177, 255, 158, 255, 140, 255, 127, 255, 119, 255, 116, 255, 116, 255, 126, 255, 136, 255, 147, 255, 164, 255, 180, 255, 196, 255, 219, 255, 241, 255, 7, 0, 29, 0, 49, 0, 65, 0, 81, 0, 94, 0, 106, 0, 119, 0, 128, 0, 133, 0, 136, 0, 137, 0, 137, 0, 137, 0, 135, 0,
-138, 0, 140, 0, 139, 0, 142, 0, 144, 0, 146, 0, 151, 0, 156, 0, 159, 0, 163, 0, 166, 0, 165, 0, 163, 0, 161, 0, 159, 0, 157, 0, 154, 0, 147, 0, 138, 0, 125, 0, 110, 0, 95, 0, 79, 0, 63, 0, 46, 0, 24, 0, 5, 0, 241, 255, 219, 255, 203, 255, 189, 255, 175, 255,
-164, 255, 153, 255, 144, 255, 137, 255, 133, 255, 133, 255, 133, 255, 133, 255, 135, 255, 135, 255, 134, 255, 134, 255, 137, 255, 135, 255, 133, 255, 133, 255, 124, 255, 115, 255, 105, 255, 90, 255, 76, 255, 63, 255, 48, 255, 31, 255, 12, 255, 249, 254, 231, 254, 216, 254, 206, 254, 200, 254, 195, 254, 192, 254,
-194, 254, 199, 254, 209, 254, 227, 254, 248, 254, 17, 255, 48, 255, 79, 255, 112, 255, 149, 255, 185, 255, 224, 255, 10, 0, 49, 0, 87, 0, 124, 0, 156, 0, 184, 0, 211, 0, 238, 0, 5, 1, 23, 1, 37, 1, 46, 1, 51, 1, 54, 1, 53, 1, 50, 1, 46, 1, 36, 1, 25, 1, 13, 1,
-255, 0, 243, 0, 230, 0, 216, 0, 201, 0, 185, 0, 169, 0, 152, 0, 135, 0, 120, 0, 107, 0, 94, 0, 80, 0, 68, 0, 54, 0, 40, 0, 27, 0, 16, 0, 6, 0, 253, 255, 245, 255, 238, 255, 229, 255, 222, 255, 217, 255, 215, 255, 212, 255, 210, 255, 210, 255, 210, 255, 213, 255, 218, 255,
-225, 255, 234, 255, 243, 255, 248, 255, 255, 255, 7, 0, 13, 0, 21, 0, 29, 0, 36, 0, 42, 0, 48, 0, 50, 0, 49, 0, 48, 0, 46, 0, 42, 0, 38, 0, 33, 0, 22, 0, 12, 0, 1, 0, 245, 255, 235, 255, 226, 255, 218, 255, 208, 255, 200, 255, 193, 255, 188, 255, 186, 255, 187, 255,
-190, 255, 193, 255, 196, 255, 202, 255, 209, 255, 215, 255, 224, 255, 233, 255, 243, 255, 254, 255, 6, 0, 13, 0, 19, 0, 23, 0, 27, 0, 29, 0, 30, 0, 26, 0, 19, 0, 10, 0, 253, 255, 239, 255, 226, 255, 209, 255, 191, 255, 172, 255, 153, 255, 134, 255, 117, 255, 101, 255, 87, 255, 73, 255,
-61, 255, 51, 255, 43, 255, 37, 255, 37, 255, 39, 255, 42, 255, 51, 255, 63, 255, 75, 255, 88, 255, 104, 255, 122, 255, 142, 255, 163, 255, 187, 255, 211, 255, 232, 255, 253, 255, 21, 0, 40, 0, 60, 0, 80, 0, 96, 0, 114, 0, 132, 0, 148, 0, 166, 0, 182, 0, 195, 0, 206, 0, 217, 0,
-225, 0, 234, 0, 242, 0, 248, 0, 253, 0, 1, 1, 5, 1, 8, 1, 10, 1, 10, 1, 8, 1, 6, 1, 4, 1, 253, 0, 248, 0, 239, 0, 226, 0, 215, 0, 202, 0, 184, 0, 171, 0, 153, 0, 133, 0, 112, 0, 92, 0, 73, 0, 51, 0, 31, 0, 10, 0, 243, 255, 225, 255, 207, 255,
-188, 255, 173, 255, 160, 255, 149, 255, 138, 255, 131, 255, 128, 255, 122, 255, 120, 255, 121, 255, 119, 255, 120, 255, 122, 255, 124, 255, 124, 255, 123, 255, 123, 255, 124, 255, 123, 255, 121, 255, 115, 255, 110, 255, 107, 255, 104, 255, 101, 255, 98, 255, 92, 255, 88, 255, 84, 255, 81, 255, 83, 255, 86, 255,
-89, 255, 99, 255, 108, 255, 117, 255, 133, 255, 148, 255, 161, 255, 178, 255, 195, 255, 213, 255, 231, 255, 249, 255, 10, 0, 26, 0, 39, 0, 50, 0, 61, 0, 67, 0, 71, 0, 74, 0, 77, 0, 77, 0, 76, 0, 75, 0, 70, 0, 64, 0, 57, 0, 49, 0, 43, 0, 38, 0, 31, 0, 27, 0,
-25, 0, 22, 0, 24, 0, 29, 0, 30, 0, 36, 0, 43, 0, 48, 0, 54, 0, 60, 0, 66, 0, 71, 0, 74, 0, 76, 0, 76, 0, 72, 0, 66, 0, 60, 0, 50, 0, 40, 0, 31, 0, 19, 0, 7, 0, 250, 255, 237, 255, 226, 255, 215, 255, 209, 255, 204, 255, 200, 255, 201, 255, 204, 255,
-208, 255, 220, 255, 235, 255, 253, 255, 19, 0, 43, 0, 68, 0, 96, 0, 124, 0, 153, 0, 183, 0, 210, 0, 235, 0, 4, 1, 22, 1, 36, 1, 47, 1, 54, 1, 56, 1, 54, 1, 48, 1, 35, 1, 19, 1, 253, 0, 231, 0, 208, 0, 183, 0, 158, 0, 134, 0, 109, 0, 84, 0, 61, 0,
-41, 0, 21, 0, 5, 0, 246, 255, 231, 255, 219, 255, 209, 255, 199, 255, 193, 255, 186, 255, 179, 255, 170, 255, 160, 255, 148, 255, 135, 255, 123, 255, 111, 255, 99, 255, 86, 255, 71, 255, 52, 255, 38, 255, 21, 255, 2, 255, 250, 254, 239, 254, 227, 254, 225, 254, 222, 254, 222, 254, 228, 254, 238, 254,
-249, 254, 9, 255, 25, 255, 42, 255, 62, 255, 82, 255, 102, 255, 122, 255, 145, 255, 163, 255, 177, 255, 189, 255, 197, 255, 204, 255, 208, 255, 213, 255, 215, 255, 212, 255, 211, 255, 207, 255, 201, 255, 199, 255, 199, 255, 199, 255, 202, 255, 207, 255, 214, 255, 225, 255, 240, 255, 1, 0, 27, 0, 52, 0,
-81, 0, 115, 0, 145, 0, 178, 0, 214, 0, 246, 0, 22, 1, 52, 1, 74, 1, 91, 1, 104, 1, 109, 1, 109, 1, 106, 1, 95, 1, 78, 1, 55, 1, 25, 1, 247, 0, 209, 0, 170, 0, 132, 0, 93, 0, 54, 0, 19, 0, 241, 255, 209, 255, 182, 255, 163, 255, 147, 255, 136, 255, 132, 255,
-132, 255, 135, 255, 143, 255, 156, 255, 173, 255, 193, 255, 213, 255, 234, 255, 250, 255, 10, 0, 26, 0, 41, 0, 52, 0, 62, 0, 70, 0, 69, 0, 67, 0, 65, 0, 58, 0, 51, 0, 46, 0, 35, 0, 28, 0, 23, 0, 16, 0, 15, 0, 16, 0, 18, 0, 28, 0, 36, 0, 42, 0, 56, 0,
-67, 0, 76, 0, 94, 0, 108, 0, 118, 0, 132, 0, 135, 0, 134, 0, 133, 0, 125, 0, 114, 0, 104, 0, 83, 0, 59, 0, 35, 0, 2, 0, 228, 255, 198, 255, 168, 255, 139, 255, 113, 255, 91, 255, 71, 255, 54, 255, 42, 255, 38, 255, 38, 255, 41, 255, 53, 255, 64, 255, 72, 255, 95, 255,
-114, 255, 132, 255, 155, 255, 174, 255, 191, 255, 202, 255, 208, 255, 213, 255, 216, 255, 213, 255, 207, 255, 196, 255, 179, 255, 159, 255, 136, 255, 117, 255, 96, 255, 75, 255, 59, 255, 45, 255, 33, 255, 27, 255, 26, 255, 30, 255, 42, 255, 62, 255, 88, 255, 119, 255, 153, 255, 192, 255, 236, 255, 27, 0,
-78, 0, 130, 0, 175, 0, 220, 0, 4, 1, 33, 1, 66, 1, 91, 1, 107, 1, 120, 1, 124, 1, 120, 1, 111, 1, 97, 1, 79, 1, 56, 1, 31, 1, 4, 1, 234, 0, 207, 0, 182, 0, 163, 0, 144, 0, 132, 0, 127, 0, 120, 0, 118, 0, 121, 0, 123, 0, 131, 0, 143, 0, 152, 0,
-165, 0, 174, 0, 174, 0, 176, 0, 174, 0, 164, 0, 153, 0, 136, 0, 112, 0, 82, 0, 48, 0, 11, 0, 227, 255, 187, 255, 147, 255, 108, 255, 69, 255, 34, 255, 3, 255, 234, 254, 215, 254, 203, 254, 200, 254, 203, 254, 210, 254, 225, 254, 245, 254, 13, 255, 42, 255, 75, 255, 109, 255, 142, 255,
-173, 255, 202, 255, 228, 255, 249, 255, 11, 0, 26, 0, 30, 0, 29, 0, 24, 0, 13, 0, 0, 0, 242, 255, 225, 255, 207, 255, 189, 255, 171, 255, 158, 255, 146, 255, 138, 255, 138, 255, 141, 255, 147, 255, 164, 255, 181, 255, 200, 255, 224, 255, 250, 255, 21, 0, 52, 0, 79, 0, 103, 0, 125, 0,
-141, 0, 153, 0, 162, 0, 161, 0, 155, 0, 144, 0, 122, 0, 98, 0, 70, 0, 36, 0, 2, 0, 223, 255, 185, 255, 153, 255, 123, 255, 95, 255, 75, 255, 61, 255, 54, 255, 54, 255, 61, 255, 76, 255, 94, 255, 120, 255, 150, 255, 184, 255, 224, 255, 7, 0, 45, 0, 82, 0, 116, 0, 146, 0,
-169, 0, 188, 0, 202, 0, 205, 0, 200, 0, 190, 0, 172, 0, 150, 0, 125, 0, 97, 0, 67, 0, 38, 0, 11, 0, 243, 255, 223, 255, 207, 255, 203, 255, 204, 255, 209, 255, 230, 255, 253, 255, 25, 0, 65, 0, 108, 0, 154, 0, 204, 0, 253, 0, 44, 1, 91, 1, 131, 1, 166, 1, 193, 1,
-209, 1, 214, 1, 211, 1, 194, 1, 169, 1, 138, 1, 99, 1, 52, 1, 1, 1, 205, 0, 146, 0, 89, 0, 36, 0, 240, 255, 193, 255, 152, 255, 117, 255, 88, 255, 65, 255, 49, 255, 40, 255, 35, 255, 40, 255, 45, 255, 54, 255, 67, 255, 76, 255, 87, 255, 101, 255, 104, 255, 107, 255, 108, 255,
-99, 255, 85, 255, 69, 255, 49, 255, 25, 255, 255, 254, 230, 254, 202, 254, 176, 254, 154, 254, 136, 254, 124, 254, 117, 254, 120, 254, 130, 254, 144, 254, 168, 254, 199, 254, 236, 254, 24, 255, 73, 255, 125, 255, 177, 255, 229, 255, 22, 0, 70, 0, 113, 0, 151, 0, 184, 0, 207, 0, 220, 0, 225, 0,
-220, 0, 207, 0, 190, 0, 165, 0, 137, 0, 106, 0, 74, 0, 42, 0, 11, 0, 239, 255, 216, 255, 201, 255, 193, 255, 189, 255, 197, 255, 212, 255, 233, 255, 9, 0, 46, 0, 88, 0, 132, 0, 177, 0, 222, 0, 9, 1, 49, 1, 87, 1, 112, 1, 128, 1, 137, 1, 130, 1, 113, 1, 88, 1,
-53, 1, 8, 1, 213, 0, 158, 0, 96, 0, 34, 0, 228, 255, 170, 255, 116, 255, 67, 255, 28, 255, 253, 254, 229, 254, 218, 254, 217, 254, 225, 254, 246, 254, 21, 255, 58, 255, 100, 255, 147, 255, 196, 255, 247, 255, 42, 0, 91, 0, 136, 0, 173, 0, 202, 0, 224, 0, 236, 0, 241, 0, 240, 0,
-230, 0, 212, 0, 189, 0, 162, 0, 134, 0, 105, 0, 74, 0, 53, 0, 34, 0, 17, 0, 7, 0, 4, 0, 7, 0, 15, 0, 33, 0, 56, 0, 81, 0, 109, 0, 136, 0, 163, 0, 186, 0, 207, 0, 227, 0, 237, 0, 238, 0, 232, 0, 216, 0, 187, 0, 152, 0, 114, 0, 63, 0, 9, 0,
-209, 255, 146, 255, 86, 255, 28, 255, 228, 254, 179, 254, 135, 254, 101, 254, 77, 254, 60, 254, 53, 254, 59, 254, 74, 254, 97, 254, 133, 254, 173, 254, 213, 254, 5, 255, 52, 255, 99, 255, 146, 255, 188, 255, 226, 255, 254, 255, 17, 0, 29, 0, 31, 0, 26, 0, 14, 0, 251, 255, 228, 255, 200, 255,
-166, 255, 135, 255, 107, 255, 81, 255, 61, 255, 50, 255, 46, 255, 49, 255, 64, 255, 87, 255, 120, 255, 165, 255, 217, 255, 22, 0, 87, 0, 155, 0, 225, 0, 37, 1, 103, 1, 166, 1, 222, 1, 11, 2, 46, 2, 68, 2, 75, 2, 72, 2, 60, 2, 30, 2, 248, 1, 205, 1, 148, 1, 89, 1,
-29, 1, 223, 0, 164, 0, 108, 0, 58, 0, 17, 0, 237, 255, 209, 255, 195, 255, 188, 255, 190, 255, 204, 255, 223, 255, 247, 255, 15, 0, 42, 0, 72, 0, 96, 0, 120, 0, 141, 0, 151, 0, 151, 0, 144, 0, 128, 0, 99, 0, 64, 0, 23, 0, 229, 255, 177, 255, 121, 255, 63, 255, 9, 255,
-214, 254, 168, 254, 130, 254, 101, 254, 80, 254, 74, 254, 76, 254, 90, 254, 119, 254, 158, 254, 206, 254, 8, 255, 68, 255, 130, 255, 195, 255, 2, 0, 64, 0, 122, 0, 171, 0, 213, 0, 245, 0, 5, 1, 12, 1, 13, 1, 252, 0, 228, 0, 200, 0, 157, 0, 113, 0, 69, 0, 22, 0, 233, 255,
-192, 255, 158, 255, 130, 255, 107, 255, 94, 255, 89, 255, 93, 255, 106, 255, 128, 255, 157, 255, 192, 255, 228, 255, 9, 0, 46, 0, 82, 0, 113, 0, 140, 0, 161, 0, 167, 0, 166, 0, 155, 0, 132, 0, 102, 0, 65, 0, 18, 0, 223, 255, 168, 255, 109, 255, 55, 255, 2, 255, 209, 254, 171, 254,
-142, 254, 122, 254, 119, 254, 125, 254, 140, 254, 175, 254, 219, 254, 14, 255, 80, 255, 146, 255, 212, 255, 30, 0, 99, 0, 165, 0, 233, 0, 33, 1, 81, 1, 122, 1, 141, 1, 151, 1, 153, 1, 136, 1, 112, 1, 79, 1, 34, 1, 242, 0, 190, 0, 139, 0, 90, 0, 45, 0, 8, 0, 237, 255,
-219, 255, 212, 255, 221, 255, 239, 255, 11, 0, 58, 0, 111, 0, 170, 0, 235, 0, 42, 1, 104, 1, 160, 1, 214, 1, 6, 2, 43, 2, 64, 2, 71, 2, 65, 2, 37, 2, 254, 1, 205, 1, 139, 1, 66, 1, 242, 0, 154, 0, 66, 0, 234, 255, 148, 255, 71, 255, 1, 255, 197, 254, 148, 254,
-110, 254, 83, 254, 71, 254, 73, 254, 88, 254, 112, 254, 147, 254, 187, 254, 225, 254, 12, 255, 55, 255, 95, 255, 132, 255, 162, 255, 182, 255, 190, 255, 187, 255, 175, 255, 157, 255, 128, 255, 92, 255, 56, 255, 12, 255, 222, 254, 182, 254, 145, 254, 114, 254, 94, 254, 88, 254, 90, 254, 102, 254, 131, 254,
-168, 254, 214, 254, 22, 255, 92, 255, 166, 255, 247, 255, 67, 0, 141, 0, 215, 0, 24, 1, 84, 1, 137, 1, 168, 1, 187, 1, 191, 1, 171, 1, 143, 1, 104, 1, 54, 1, 250, 0, 184, 0, 114, 0, 43, 0, 229, 255, 166, 255, 115, 255, 72, 255, 40, 255, 26, 255, 22, 255, 29, 255, 54, 255,
-93, 255, 143, 255, 204, 255, 15, 0, 83, 0, 149, 0, 211, 0, 14, 1, 70, 1, 117, 1, 152, 1, 174, 1, 174, 1, 158, 1, 128, 1, 85, 1, 32, 1, 224, 0, 149, 0, 70, 0, 244, 255, 160, 255, 85, 255, 17, 255, 212, 254, 170, 254, 138, 254, 116, 254, 115, 254, 126, 254, 148, 254, 190, 254,
-246, 254, 55, 255, 129, 255, 201, 255, 19, 0, 93, 0, 162, 0, 230, 0, 41, 1, 87, 1, 122, 1, 147, 1, 148, 1, 141, 1, 127, 1, 102, 1, 65, 1, 20, 1, 224, 0, 170, 0, 116, 0, 65, 0, 26, 0, 249, 255, 221, 255, 209, 255, 203, 255, 205, 255, 218, 255, 241, 255, 14, 0, 51, 0,
-95, 0, 140, 0, 179, 0, 217, 0, 249, 0, 19, 1, 38, 1, 48, 1, 46, 1, 21, 1, 241, 0, 193, 0, 138, 0, 73, 0, 3, 0, 184, 255, 100, 255, 16, 255, 195, 254, 122, 254, 59, 254, 9, 254, 226, 253, 199, 253, 185, 253, 189, 253, 204, 253, 229, 253, 14, 254, 63, 254, 119, 254, 183, 254,
-246, 254, 54, 255, 117, 255, 174, 255, 228, 255, 24, 0, 63, 0, 88, 0, 101, 0, 102, 0, 91, 0, 74, 0, 54, 0, 22, 0, 241, 255, 199, 255, 157, 255, 118, 255, 88, 255, 66, 255, 52, 255, 46, 255, 53, 255, 73, 255, 102, 255, 145, 255, 197, 255, 255, 255, 65, 0, 138, 0, 215, 0, 38, 1,
-110, 1, 177, 1, 240, 1, 35, 2, 77, 2, 110, 2, 121, 2, 117, 2, 102, 2, 74, 2, 39, 2, 252, 1, 197, 1, 133, 1, 63, 1, 245, 0, 178, 0, 113, 0, 52, 0, 0, 0, 210, 255, 170, 255, 146, 255, 134, 255, 129, 255, 127, 255, 140, 255, 159, 255, 183, 255, 220, 255, 254, 255, 26, 0,
-54, 0, 76, 0, 93, 0, 105, 0, 106, 0, 99, 0, 73, 0, 42, 0, 6, 0, 218, 255, 172, 255, 121, 255, 62, 255, 9, 255, 216, 254, 170, 254, 137, 254, 109, 254, 84, 254, 78, 254, 85, 254, 101, 254, 132, 254, 170, 254, 212, 254, 5, 255, 67, 255, 134, 255, 208, 255, 21, 0, 87, 0, 149, 0,
-205, 0, 3, 1, 52, 1, 86, 1, 106, 1, 114, 1, 109, 1, 95, 1, 72, 1, 38, 1, 250, 0, 201, 0, 149, 0, 103, 0, 57, 0, 10, 0, 227, 255, 194, 255, 167, 255, 159, 255, 155, 255, 157, 255, 162, 255, 169, 255, 181, 255, 203, 255, 230, 255, 0, 0, 25, 0, 37, 0, 48, 0, 58, 0,
-63, 0, 63, 0, 57, 0, 36, 0, 11, 0, 237, 255, 203, 255, 163, 255, 120, 255, 73, 255, 24, 255, 236, 254, 196, 254, 159, 254, 128, 254, 102, 254, 88, 254, 91, 254, 105, 254, 127, 254, 158, 254, 192, 254, 233, 254, 34, 255, 99, 255, 173, 255, 244, 255, 54, 0, 116, 0, 172, 0, 226, 0, 20, 1,
-61, 1, 88, 1, 105, 1, 111, 1, 107, 1, 96, 1, 80, 1, 55, 1, 27, 1, 255, 0, 229, 0, 202, 0, 176, 0, 153, 0, 136, 0, 128, 0, 132, 0, 145, 0, 160, 0, 175, 0, 195, 0, 220, 0, 254, 0, 45, 1, 91, 1, 134, 1, 167, 1, 196, 1, 222, 1, 246, 1, 5, 2, 9, 2,
-254, 1, 225, 1, 187, 1, 138, 1, 80, 1, 14, 1, 197, 0, 123, 0, 47, 0, 227, 255, 152, 255, 78, 255, 7, 255, 205, 254, 161, 254, 125, 254, 101, 254, 79, 254, 61, 254, 47, 254, 52, 254, 68, 254, 93, 254, 120, 254, 145, 254, 168, 254, 189, 254, 216, 254, 246, 254, 15, 255, 37, 255, 55, 255,
-65, 255, 70, 255, 74, 255, 75, 255, 72, 255, 68, 255, 65, 255, 58, 255, 51, 255, 42, 255, 36, 255, 35, 255, 41, 255, 64, 255, 91, 255, 121, 255, 153, 255, 187, 255, 228, 255, 22, 0, 83, 0, 143, 0, 202, 0, 246, 0, 28, 1, 63, 1, 94, 1, 120, 1, 139, 1, 145, 1, 135, 1, 119, 1,
-93, 1, 61, 1, 25, 1, 243, 0, 203, 0, 161, 0, 116, 0, 67, 0, 17, 0, 226, 255, 187, 255, 162, 255, 144, 255, 132, 255, 123, 255, 116, 255, 113, 255, 127, 255, 151, 255, 182, 255, 217, 255, 248, 255, 20, 0, 42, 0, 68, 0, 95, 0, 117, 0, 133, 0, 140, 0, 135, 0, 116, 0, 92, 0,
-64, 0, 31, 0, 252, 255, 215, 255, 175, 255, 132, 255, 88, 255, 48, 255, 17, 255, 253, 254, 248, 254, 251, 254, 3, 255, 15, 255, 31, 255, 58, 255, 94, 255, 143, 255, 197, 255, 252, 255, 47, 0, 94, 0, 142, 0, 195, 0, 251, 0, 50, 1, 100, 1, 137, 1, 165, 1, 181, 1, 186, 1, 187, 1,
-184, 1, 173, 1, 153, 1, 125, 1, 85, 1, 43, 1, 1, 1, 223, 0, 195, 0, 171, 0, 155, 0, 133, 0, 112, 0, 93, 0, 84, 0, 81, 0, 84, 0, 87, 0, 86, 0, 81, 0, 69, 0, 60, 0, 52, 0, 46, 0, 36, 0, 21, 0, 255, 255, 219, 255, 180, 255, 138, 255, 101, 255, 62, 255,
-23, 255, 237, 254, 191, 254, 142, 254, 99, 254, 63, 254, 35, 254, 21, 254, 12, 254, 6, 254, 4, 254, 7, 254, 20, 254, 43, 254, 79, 254, 122, 254, 168, 254, 216, 254, 7, 255, 56, 255, 109, 255, 163, 255, 218, 255, 15, 0, 54, 0, 83, 0, 102, 0, 109, 0, 117, 0, 126, 0, 129, 0, 130, 0,
-126, 0, 114, 0, 101, 0, 92, 0, 90, 0, 96, 0, 105, 0, 118, 0, 126, 0, 135, 0, 148, 0, 165, 0, 191, 0, 221, 0, 254, 0, 30, 1, 60, 1, 86, 1, 113, 1, 141, 1, 170, 1, 196, 1, 215, 1, 224, 1, 213, 1, 192, 1, 165, 1, 137, 1, 105, 1, 69, 1, 25, 1, 226, 0,
-166, 0, 104, 0, 51, 0, 3, 0, 218, 255, 180, 255, 144, 255, 110, 255, 78, 255, 58, 255, 47, 255, 40, 255, 45, 255, 55, 255, 62, 255, 74, 255, 86, 255, 95, 255, 113, 255, 133, 255, 151, 255, 166, 255, 172, 255, 168, 255, 160, 255, 153, 255, 149, 255, 150, 255, 148, 255, 140, 255, 121, 255, 105, 255,
-89, 255, 76, 255, 75, 255, 73, 255, 72, 255, 74, 255, 78, 255, 86, 255, 105, 255, 134, 255, 169, 255, 211, 255, 1, 0, 48, 0, 96, 0, 141, 0, 186, 0, 230, 0, 20, 1, 58, 1, 89, 1, 99, 1, 100, 1, 94, 1, 82, 1, 74, 1, 63, 1, 39, 1, 6, 1, 221, 0, 173, 0, 129, 0,
-89, 0, 51, 0, 8, 0, 222, 255, 181, 255, 141, 255, 110, 255, 85, 255, 64, 255, 53, 255, 47, 255, 43, 255, 44, 255, 47, 255, 49, 255, 58, 255, 69, 255, 85, 255, 98, 255, 105, 255, 106, 255, 99, 255, 93, 255, 91, 255, 94, 255, 90, 255, 82, 255, 64, 255, 42, 255, 23, 255, 8, 255, 4, 255,
-0, 255, 252, 254, 254, 254, 5, 255, 18, 255, 43, 255, 73, 255, 106, 255, 148, 255, 190, 255, 234, 255, 25, 0, 66, 0, 108, 0, 152, 0, 198, 0, 244, 0, 33, 1, 65, 1, 89, 1, 108, 1, 127, 1, 145, 1, 161, 1, 172, 1, 163, 1, 146, 1, 123, 1, 100, 1, 80, 1, 61, 1, 38, 1,
-16, 1, 249, 0, 232, 0, 222, 0, 215, 0, 215, 0, 216, 0, 220, 0, 229, 0, 237, 0, 245, 0, 250, 0, 254, 0, 4, 1, 11, 1, 17, 1, 14, 1, 3, 1, 237, 0, 209, 0, 181, 0, 157, 0, 123, 0, 81, 0, 32, 0, 226, 255, 166, 255, 112, 255, 60, 255, 10, 255, 218, 254, 170, 254,
-128, 254, 93, 254, 71, 254, 51, 254, 36, 254, 31, 254, 32, 254, 42, 254, 61, 254, 83, 254, 110, 254, 142, 254, 183, 254, 230, 254, 23, 255, 69, 255, 106, 255, 140, 255, 173, 255, 205, 255, 234, 255, 3, 0, 14, 0, 19, 0, 18, 0, 18, 0, 22, 0, 28, 0, 29, 0, 31, 0, 34, 0, 40, 0,
-51, 0, 63, 0, 76, 0, 88, 0, 100, 0, 112, 0, 132, 0, 150, 0, 167, 0, 183, 0, 201, 0, 220, 0, 240, 0, 1, 1, 11, 1, 8, 1, 1, 1, 248, 0, 236, 0, 220, 0, 196, 0, 163, 0, 122, 0, 83, 0, 45, 0, 9, 0, 230, 255, 195, 255, 157, 255, 128, 255, 104, 255, 86, 255,
-73, 255, 62, 255, 53, 255, 53, 255, 58, 255, 71, 255, 90, 255, 108, 255, 127, 255, 154, 255, 181, 255, 207, 255, 235, 255, 251, 255, 5, 0, 12, 0, 19, 0, 22, 0, 21, 0, 15, 0, 4, 0, 241, 255, 233, 255, 222, 255, 209, 255, 198, 255, 184, 255, 171, 255, 164, 255, 163, 255, 166, 255, 172, 255,
-179, 255, 191, 255, 213, 255, 244, 255, 26, 0, 70, 0, 116, 0, 164, 0, 216, 0, 13, 1, 62, 1, 106, 1, 139, 1, 163, 1, 182, 1, 196, 1, 201, 1, 198, 1, 186, 1, 164, 1, 138, 1, 109, 1, 79, 1, 41, 1, 254, 0, 209, 0, 165, 0, 123, 0, 84, 0, 48, 0, 10, 0, 227, 255,
-196, 255, 173, 255, 157, 255, 148, 255, 142, 255, 137, 255, 132, 255, 132, 255, 134, 255, 133, 255, 131, 255, 125, 255, 112, 255, 105, 255, 95, 255, 78, 255, 63, 255, 43, 255, 20, 255, 0, 255, 235, 254, 212, 254, 188, 254, 163, 254, 139, 254, 125, 254, 119, 254, 119, 254, 123, 254, 131, 254, 145, 254, 166, 254,
-200, 254, 241, 254, 31, 255, 76, 255, 122, 255, 170, 255, 216, 255, 8, 0, 54, 0, 94, 0, 132, 0, 166, 0, 194, 0, 220, 0, 240, 0, 0, 1, 11, 1, 17, 1, 20, 1, 17, 1, 6, 1, 246, 0, 226, 0, 209, 0, 195, 0, 184, 0, 176, 0, 167, 0, 157, 0, 154, 0, 156, 0, 164, 0,
-182, 0, 197, 0, 210, 0, 224, 0, 236, 0, 247, 0, 3, 1, 12, 1, 18, 1, 19, 1, 16, 1, 8, 1, 250, 0, 231, 0, 207, 0, 179, 0, 147, 0, 109, 0, 66, 0, 18, 0, 223, 255, 175, 255, 134, 255, 99, 255, 69, 255, 46, 255, 18, 255, 253, 254, 240, 254, 236, 254, 241, 254, 253, 254,
-13, 255, 30, 255, 49, 255, 68, 255, 94, 255, 121, 255, 150, 255, 180, 255, 205, 255, 227, 255, 244, 255, 255, 255, 5, 0, 13, 0, 15, 0, 13, 0, 6, 0, 249, 255, 232, 255, 213, 255, 204, 255, 200, 255, 201, 255, 209, 255, 217, 255, 224, 255, 237, 255, 0, 0, 22, 0, 54, 0, 88, 0, 123, 0,
-153, 0, 183, 0, 213, 0, 243, 0, 16, 1, 44, 1, 69, 1, 79, 1, 81, 1, 76, 1, 59, 1, 38, 1, 13, 1, 238, 0, 198, 0, 153, 0, 100, 0, 44, 0, 247, 255, 199, 255, 157, 255, 122, 255, 92, 255, 54, 255, 22, 255, 250, 254, 230, 254, 220, 254, 218, 254, 220, 254, 226, 254, 235, 254,
-245, 254, 3, 255, 23, 255, 48, 255, 72, 255, 95, 255, 117, 255, 125, 255, 133, 255, 141, 255, 144, 255, 150, 255, 153, 255, 147, 255, 138, 255, 129, 255, 118, 255, 116, 255, 118, 255, 123, 255, 135, 255, 144, 255, 152, 255, 162, 255, 178, 255, 201, 255, 233, 255, 14, 0, 53, 0, 93, 0, 130, 0, 169, 0,
-213, 0, 1, 1, 47, 1, 93, 1, 123, 1, 146, 1, 160, 1, 163, 1, 166, 1, 167, 1, 159, 1, 146, 1, 126, 1, 93, 1, 62, 1, 30, 1, 255, 0, 232, 0, 209, 0, 185, 0, 158, 0, 133, 0, 111, 0, 93, 0, 86, 0, 85, 0, 87, 0, 95, 0, 101, 0, 101, 0, 107, 0, 115, 0,
-123, 0, 132, 0, 134, 0, 127, 0, 105, 0, 79, 0, 49, 0, 19, 0, 245, 255, 212, 255, 171, 255, 125, 255, 76, 255, 26, 255, 241, 254, 204, 254, 171, 254, 147, 254, 123, 254, 100, 254, 84, 254, 78, 254, 80, 254, 95, 254, 125, 254, 159, 254, 194, 254, 233, 254, 16, 255, 56, 255, 105, 255, 156, 255,
-207, 255, 248, 255, 26, 0, 53, 0, 70, 0, 94, 0, 117, 0, 135, 0, 147, 0, 151, 0, 144, 0, 138, 0, 131, 0, 123, 0, 121, 0, 117, 0, 112, 0, 106, 0, 100, 0, 95, 0, 92, 0, 100, 0, 113, 0, 129, 0, 148, 0, 162, 0, 171, 0, 179, 0, 188, 0, 198, 0, 211, 0, 216, 0,
-213, 0, 195, 0, 174, 0, 152, 0, 133, 0, 114, 0, 91, 0, 63, 0, 23, 0, 238, 255, 197, 255, 158, 255, 124, 255, 93, 255, 64, 255, 39, 255, 17, 255, 253, 254, 242, 254, 238, 254, 245, 254, 8, 255, 31, 255, 59, 255, 81, 255, 104, 255, 131, 255, 161, 255, 195, 255, 232, 255, 3, 0, 19, 0,
-30, 0, 36, 0, 45, 0, 54, 0, 62, 0, 59, 0, 49, 0, 32, 0, 13, 0, 252, 255, 238, 255, 230, 255, 222, 255, 216, 255, 215, 255, 218, 255, 222, 255, 231, 255, 254, 255, 28, 0, 64, 0, 104, 0, 141, 0, 174, 0, 206, 0, 241, 0, 23, 1, 62, 1, 95, 1, 120, 1, 128, 1, 130, 1,
-129, 1, 125, 1, 117, 1, 101, 1, 75, 1, 33, 1, 245, 0, 200, 0, 154, 0, 112, 0, 71, 0, 31, 0, 251, 255, 219, 255, 188, 255, 163, 255, 143, 255, 128, 255, 125, 255, 123, 255, 122, 255, 119, 255, 114, 255, 106, 255, 110, 255, 116, 255, 123, 255, 126, 255, 118, 255, 107, 255, 94, 255, 84, 255,
-77, 255, 70, 255, 53, 255, 34, 255, 11, 255, 245, 254, 227, 254, 212, 254, 203, 254, 198, 254, 197, 254, 203, 254, 213, 254, 227, 254, 247, 254, 19, 255, 52, 255, 94, 255, 143, 255, 187, 255, 228, 255, 14, 0, 57, 0, 103, 0, 157, 0, 200, 0, 236, 0, 5, 1, 22, 1, 37, 1, 52, 1, 61, 1,
-63, 1, 54, 1, 39, 1, 19, 1, 252, 0, 236, 0, 217, 0, 196, 0, 182, 0, 163, 0, 145, 0, 134, 0, 120, 0, 110, 0, 107, 0, 110, 0, 116, 0, 129, 0, 132, 0, 136, 0, 142, 0, 154, 0, 167, 0, 181, 0, 191, 0, 187, 0, 176, 0, 161, 0, 145, 0, 126, 0, 104, 0, 72, 0,
-33, 0, 244, 255, 204, 255, 164, 255, 127, 255, 95, 255, 66, 255, 40, 255, 20, 255, 7, 255, 253, 254, 245, 254, 249, 254, 2, 255, 15, 255, 39, 255, 63, 255, 84, 255, 105, 255, 130, 255, 161, 255, 193, 255, 220, 255, 243, 255, 1, 0, 8, 0, 15, 0, 24, 0, 29, 0, 29, 0, 24, 0, 15, 0,
-5, 0, 250, 255, 244, 255, 238, 255, 233, 255, 230, 255, 234, 255, 240, 255, 250, 255, 7, 0, 24, 0, 45, 0, 76, 0, 110, 0, 145, 0, 176, 0, 204, 0, 232, 0, 1, 1, 26, 1, 47, 1, 57, 1, 55, 1, 46, 1, 30, 1, 9, 1, 242, 0, 215, 0, 179, 0, 138, 0, 93, 0, 52, 0,
-10, 0, 225, 255, 186, 255, 147, 255, 111, 255, 80, 255, 51, 255, 26, 255, 6, 255, 246, 254, 238, 254, 238, 254, 242, 254, 251, 254, 7, 255, 18, 255, 34, 255, 53, 255, 77, 255, 98, 255, 113, 255, 124, 255, 133, 255, 141, 255, 148, 255, 154, 255, 156, 255, 154, 255, 148, 255, 144, 255, 142, 255, 140, 255,
-142, 255, 146, 255, 150, 255, 162, 255, 179, 255, 198, 255, 221, 255, 248, 255, 21, 0, 56, 0, 94, 0, 135, 0, 172, 0, 209, 0, 244, 0, 22, 1, 55, 1, 84, 1, 106, 1, 121, 1, 130, 1, 132, 1, 131, 1, 123, 1, 111, 1, 91, 1, 64, 1, 35, 1, 4, 1, 227, 0, 195, 0, 163, 0,
-130, 0, 101, 0, 78, 0, 60, 0, 47, 0, 38, 0, 35, 0, 36, 0, 41, 0, 50, 0, 62, 0, 73, 0, 79, 0, 87, 0, 93, 0, 92, 0, 88, 0, 80, 0, 64, 0, 45, 0, 22, 0, 251, 255, 219, 255, 185, 255, 149, 255, 110, 255, 75, 255, 42, 255, 10, 255, 237, 254, 211, 254, 188, 254,
-173, 254, 165, 254, 162, 254, 168, 254, 177, 254, 190, 254, 212, 254, 239, 254, 14, 255, 51, 255, 88, 255, 127, 255, 168, 255, 205, 255, 241, 255, 22, 0, 48, 0, 74, 0, 102, 0, 116, 0, 128, 0, 138, 0, 138, 0, 139, 0, 139, 0, 137, 0, 137, 0, 138, 0, 135, 0, 135, 0, 138, 0, 143, 0,
-152, 0, 163, 0, 174, 0, 184, 0, 195, 0, 206, 0, 213, 0, 223, 0, 232, 0, 236, 0, 238, 0, 237, 0, 229, 0, 217, 0, 201, 0, 184, 0, 162, 0, 136, 0, 105, 0, 67, 0, 27, 0, 242, 255, 199, 255, 160, 255, 122, 255, 84, 255, 49, 255, 17, 255, 242, 254, 225, 254, 212, 254, 205, 254,
-212, 254, 222, 254, 236, 254, 2, 255, 28, 255, 57, 255, 92, 255, 128, 255, 165, 255, 197, 255, 224, 255, 249, 255, 16, 0, 32, 0, 47, 0, 60, 0, 62, 0, 59, 0, 53, 0, 41, 0, 33, 0, 27, 0, 17, 0, 10, 0, 2, 0, 247, 255, 244, 255, 242, 255, 241, 255, 252, 255, 8, 0, 22, 0,
-44, 0, 66, 0, 89, 0, 118, 0, 149, 0, 181, 0, 219, 0, 248, 0, 17, 1, 38, 1, 47, 1, 55, 1, 61, 1, 59, 1, 50, 1, 35, 1, 7, 1, 233, 0, 202, 0, 171, 0, 142, 0, 113, 0, 83, 0, 51, 0, 23, 0, 1, 0, 235, 255, 219, 255, 209, 255, 200, 255, 196, 255, 193, 255,
-189, 255, 184, 255, 181, 255, 182, 255, 184, 255, 185, 255, 185, 255, 174, 255, 161, 255, 145, 255, 134, 255, 121, 255, 107, 255, 91, 255, 68, 255, 41, 255, 17, 255, 254, 254, 237, 254, 224, 254, 214, 254, 205, 254, 197, 254, 201, 254, 209, 254, 221, 254, 246, 254, 22, 255, 59, 255, 101, 255, 147, 255, 195, 255,
-240, 255, 36, 0, 90, 0, 142, 0, 189, 0, 228, 0, 2, 1, 22, 1, 42, 1, 61, 1, 77, 1, 84, 1, 82, 1, 70, 1, 54, 1, 36, 1, 20, 1, 4, 1, 240, 0, 215, 0, 191, 0, 166, 0, 142, 0, 124, 0, 109, 0, 96, 0, 91, 0, 89, 0, 88, 0, 89, 0, 90, 0, 95, 0,
-103, 0, 114, 0, 125, 0, 134, 0, 129, 0, 119, 0, 106, 0, 94, 0, 81, 0, 65, 0, 41, 0, 7, 0, 226, 255, 189, 255, 156, 255, 126, 255, 101, 255, 74, 255, 50, 255, 28, 255, 13, 255, 5, 255, 3, 255, 9, 255, 23, 255, 42, 255, 63, 255, 86, 255, 109, 255, 127, 255, 153, 255, 181, 255,
-209, 255, 234, 255, 252, 255, 6, 0, 12, 0, 18, 0, 25, 0, 33, 0, 35, 0, 30, 0, 15, 0, 255, 255, 240, 255, 226, 255, 219, 255, 211, 255, 201, 255, 197, 255, 196, 255, 198, 255, 211, 255, 230, 255, 254, 255, 29, 0, 64, 0, 102, 0, 137, 0, 171, 0, 204, 0, 238, 0, 15, 1, 43, 1,
-67, 1, 70, 1, 66, 1, 58, 1, 49, 1, 38, 1, 23, 1, 254, 0, 219, 0, 178, 0, 131, 0, 92, 0, 53, 0, 13, 0, 231, 255, 192, 255, 152, 255, 119, 255, 91, 255, 68, 255, 48, 255, 37, 255, 32, 255, 29, 255, 30, 255, 33, 255, 34, 255, 43, 255, 57, 255, 77, 255, 93, 255, 105, 255,
-113, 255, 116, 255, 120, 255, 126, 255, 133, 255, 134, 255, 131, 255, 119, 255, 107, 255, 98, 255, 95, 255, 100, 255, 105, 255, 111, 255, 123, 255, 138, 255, 158, 255, 187, 255, 219, 255, 254, 255, 40, 0, 81, 0, 122, 0, 161, 0, 196, 0, 231, 0, 10, 1, 47, 1, 80, 1, 107, 1, 120, 1, 124, 1,
-122, 1, 118, 1, 111, 1, 99, 1, 75, 1, 40, 1, 0, 1, 212, 0, 171, 0, 133, 0, 99, 0, 64, 0, 31, 0, 2, 0, 238, 255, 223, 255, 213, 255, 215, 255, 219, 255, 228, 255, 247, 255, 3, 0, 16, 0, 35, 0, 49, 0, 66, 0, 87, 0, 95, 0, 98, 0, 95, 0, 77, 0, 60, 0,
-43, 0, 25, 0, 255, 255, 223, 255, 185, 255, 144, 255, 105, 255, 72, 255, 44, 255, 18, 255, 249, 254, 229, 254, 213, 254, 201, 254, 200, 254, 202, 254, 209, 254, 225, 254, 247, 254, 15, 255, 43, 255, 73, 255, 106, 255, 141, 255, 183, 255, 223, 255, 5, 0, 32, 0, 54, 0, 72, 0, 90, 0, 104, 0,
-114, 0, 120, 0, 117, 0, 113, 0, 109, 0, 107, 0, 110, 0, 117, 0, 123, 0, 130, 0, 140, 0, 150, 0, 165, 0, 182, 0, 197, 0, 218, 0, 238, 0, 255, 0, 16, 1, 30, 1, 38, 1, 46, 1, 53, 1, 57, 1, 53, 1, 41, 1, 21, 1, 246, 0, 212, 0, 176, 0, 135, 0, 90, 0,
-40, 0, 240, 255, 185, 255, 133, 255, 82, 255, 38, 255, 254, 254, 220, 254, 191, 254, 169, 254, 153, 254, 149, 254, 155, 254, 168, 254, 188, 254, 219, 254, 254, 254, 34, 255, 74, 255, 116, 255, 158, 255, 199, 255, 236, 255, 13, 0, 35, 0, 51, 0, 63, 0, 69, 0, 73, 0, 73, 0, 67, 0, 58, 0,
-45, 0, 28, 0, 18, 0, 6, 0, 250, 255, 243, 255, 235, 255, 227, 255, 228, 255, 230, 255, 236, 255, 251, 255, 14, 0, 37, 0, 64, 0, 95, 0, 126, 0, 158, 0, 189, 0, 218, 0, 244, 0, 6, 1, 17, 1, 21, 1, 17, 1, 7, 1, 250, 0, 231, 0, 208, 0, 181, 0, 150, 0, 121, 0,
-91, 0, 61, 0, 36, 0, 13, 0, 247, 255, 230, 255, 216, 255, 205, 255, 198, 255, 199, 255, 202, 255, 207, 255, 217, 255, 226, 255, 234, 255, 243, 255, 251, 255, 0, 0, 3, 0, 1, 0, 251, 255, 239, 255, 223, 255, 204, 255, 181, 255, 155, 255, 127, 255, 99, 255, 69, 255, 39, 255, 8, 255, 239, 254,
-215, 254, 194, 254, 185, 254, 181, 254, 182, 254, 193, 254, 213, 254, 241, 254, 23, 255, 69, 255, 120, 255, 174, 255, 231, 255, 31, 0, 87, 0, 145, 0, 195, 0, 241, 0, 25, 1, 58, 1, 85, 1, 106, 1, 119, 1, 126, 1, 124, 1, 115, 1, 103, 1, 87, 1, 62, 1, 36, 1, 8, 1, 231, 0,
-200, 0, 171, 0, 145, 0, 121, 0, 100, 0, 85, 0, 76, 0, 71, 0, 71, 0, 74, 0, 79, 0, 86, 0, 94, 0, 101, 0, 108, 0, 110, 0, 107, 0, 102, 0, 92, 0, 79, 0, 62, 0, 41, 0, 11, 0, 235, 255, 201, 255, 167, 255, 133, 255, 100, 255, 68, 255, 39, 255, 13, 255, 250, 254,
-241, 254, 237, 254, 238, 254, 250, 254, 10, 255, 30, 255, 59, 255, 88, 255, 119, 255, 152, 255, 185, 255, 217, 255, 249, 255, 20, 0, 43, 0, 62, 0, 75, 0, 85, 0, 92, 0, 91, 0, 84, 0, 71, 0, 50, 0, 30, 0, 9, 0, 242, 255, 219, 255, 196, 255, 174, 255, 159, 255, 150, 255, 146, 255,
-156, 255, 170, 255, 187, 255, 216, 255, 248, 255, 26, 0, 67, 0, 106, 0, 146, 0, 187, 0, 228, 0, 10, 1, 36, 1, 58, 1, 75, 1, 82, 1, 87, 1, 85, 1, 74, 1, 51, 1, 21, 1, 240, 0, 203, 0, 163, 0, 120, 0, 76, 0, 30, 0, 239, 255, 198, 255, 161, 255, 128, 255, 100, 255,
-78, 255, 60, 255, 47, 255, 43, 255, 42, 255, 44, 255, 50, 255, 60, 255, 74, 255, 90, 255, 104, 255, 117, 255, 127, 255, 135, 255, 142, 255, 151, 255, 152, 255, 148, 255, 139, 255, 126, 255, 114, 255, 104, 255, 100, 255, 96, 255, 94, 255, 93, 255, 100, 255, 112, 255, 130, 255, 158, 255, 188, 255, 219, 255,
-1, 0, 42, 0, 84, 0, 125, 0, 168, 0, 212, 0, 254, 0, 40, 1, 79, 1, 110, 1, 130, 1, 143, 1, 149, 1, 150, 1, 143, 1, 126, 1, 94, 1, 55, 1, 9, 1, 222, 0, 177, 0, 133, 0, 90, 0, 45, 0, 1, 0, 223, 255, 194, 255, 173, 255, 160, 255, 153, 255, 152, 255, 158, 255,
-170, 255, 185, 255, 203, 255, 223, 255, 248, 255, 18, 0, 44, 0, 64, 0, 80, 0, 89, 0, 90, 0, 90, 0, 89, 0, 77, 0, 58, 0, 30, 0, 251, 255, 217, 255, 184, 255, 153, 255, 121, 255, 90, 255, 57, 255, 28, 255, 3, 255, 241, 254, 230, 254, 224, 254, 224, 254, 230, 254, 242, 254, 5, 255,
-30, 255, 57, 255, 88, 255, 128, 255, 167, 255, 205, 255, 243, 255, 15, 0, 40, 0, 64, 0, 88, 0, 107, 0, 120, 0, 124, 0, 122, 0, 115, 0, 115, 0, 115, 0, 117, 0, 120, 0, 117, 0, 114, 0, 117, 0, 122, 0, 130, 0, 145, 0, 158, 0, 174, 0, 193, 0, 213, 0, 233, 0, 251, 0,
-15, 1, 32, 1, 49, 1, 64, 1, 71, 1, 69, 1, 57, 1, 39, 1, 17, 1, 248, 0, 214, 0, 172, 0, 122, 0, 62, 0, 7, 0, 209, 255, 159, 255, 111, 255, 64, 255, 12, 255, 229, 254, 194, 254, 163, 254, 151, 254, 144, 254, 142, 254, 153, 254, 172, 254, 196, 254, 225, 254, 4, 255, 42, 255,
-84, 255, 129, 255, 172, 255, 210, 255, 239, 255, 7, 0, 30, 0, 50, 0, 67, 0, 80, 0, 81, 0, 73, 0, 61, 0, 53, 0, 42, 0, 32, 0, 25, 0, 9, 0, 250, 255, 238, 255, 227, 255, 223, 255, 226, 255, 232, 255, 244, 255, 4, 0, 26, 0, 48, 0, 73, 0, 103, 0, 130, 0, 159, 0,
-191, 0, 211, 0, 226, 0, 236, 0, 237, 0, 237, 0, 237, 0, 230, 0, 215, 0, 194, 0, 163, 0, 134, 0, 107, 0, 82, 0, 58, 0, 34, 0, 6, 0, 235, 255, 213, 255, 195, 255, 186, 255, 180, 255, 177, 255, 183, 255, 189, 255, 196, 255, 209, 255, 219, 255, 230, 255, 245, 255, 2, 0, 13, 0,
-20, 0, 16, 0, 9, 0, 0, 0, 247, 255, 235, 255, 220, 255, 193, 255, 162, 255, 130, 255, 96, 255, 68, 255, 42, 255, 20, 255, 253, 254, 233, 254, 217, 254, 213, 254, 217, 254, 227, 254, 247, 254, 20, 255, 55, 255, 92, 255, 137, 255, 184, 255, 230, 255, 26, 0, 80, 0, 134, 0, 180, 0, 222, 0,
-4, 1, 32, 1, 59, 1, 85, 1, 104, 1, 112, 1, 112, 1, 101, 1, 85, 1, 67, 1, 50, 1, 27, 1, 4, 1, 235, 0, 203, 0, 175, 0, 153, 0, 130, 0, 116, 0, 106, 0, 96, 0, 90, 0, 85, 0, 82, 0, 79, 0, 78, 0, 82, 0, 81, 0, 80, 0, 79, 0, 66, 0, 53, 0,
-39, 0, 23, 0, 6, 0, 243, 255, 216, 255, 184, 255, 150, 255, 116, 255, 89, 255, 64, 255, 41, 255, 22, 255, 6, 255, 246, 254, 240, 254, 240, 254, 247, 254, 5, 255, 26, 255, 50, 255, 75, 255, 103, 255, 131, 255, 161, 255, 193, 255, 225, 255, 2, 0, 29, 0, 51, 0, 68, 0, 80, 0, 89, 0,
-96, 0, 98, 0, 91, 0, 79, 0, 61, 0, 39, 0, 18, 0, 0, 0, 240, 255, 226, 255, 212, 255, 199, 255, 191, 255, 188, 255, 192, 255, 204, 255, 221, 255, 242, 255, 9, 0, 35, 0, 60, 0, 91, 0, 124, 0, 159, 0, 195, 0, 226, 0, 252, 0, 16, 1, 30, 1, 38, 1, 45, 1, 44, 1,
-37, 1, 24, 1, 0, 1, 227, 0, 195, 0, 161, 0, 126, 0, 94, 0, 58, 0, 23, 0, 244, 255, 209, 255, 178, 255, 151, 255, 132, 255, 116, 255, 102, 255, 92, 255, 83, 255, 77, 255, 76, 255, 80, 255, 86, 255, 93, 255, 100, 255, 104, 255, 107, 255, 109, 255, 112, 255, 115, 255, 118, 255, 116, 255,
-113, 255, 109, 255, 105, 255, 103, 255, 103, 255, 111, 255, 120, 255, 131, 255, 143, 255, 159, 255, 176, 255, 198, 255, 227, 255, 3, 0, 37, 0, 75, 0, 111, 0, 143, 0, 180, 0, 215, 0, 248, 0, 25, 1, 51, 1, 71, 1, 82, 1, 87, 1, 87, 1, 79, 1, 67, 1, 51, 1, 26, 1, 252, 0,
-220, 0, 186, 0, 149, 0, 116, 0, 85, 0, 54, 0, 26, 0, 0, 0, 230, 255, 211, 255, 196, 255, 189, 255, 186, 255, 185, 255, 190, 255, 192, 255, 198, 255, 211, 255, 223, 255, 238, 255, 254, 255, 8, 0, 16, 0, 20, 0, 23, 0, 20, 0, 15, 0, 10, 0, 251, 255, 235, 255, 220, 255, 197, 255,
-175, 255, 156, 255, 135, 255, 117, 255, 101, 255, 86, 255, 73, 255, 62, 255, 53, 255, 52, 255, 55, 255, 63, 255, 74, 255, 86, 255, 98, 255, 116, 255, 135, 255, 157, 255, 183, 255, 207, 255, 227, 255, 249, 255, 12, 0, 30, 0, 50, 0, 65, 0, 78, 0, 90, 0, 100, 0, 110, 0, 117, 0, 123, 0,
-130, 0, 139, 0, 147, 0, 157, 0, 167, 0, 173, 0, 182, 0, 192, 0, 205, 0, 221, 0, 236, 0, 248, 0, 2, 1, 10, 1, 16, 1, 21, 1, 24, 1, 22, 1, 16, 1, 1, 1, 238, 0, 220, 0, 195, 0, 167, 0, 136, 0, 101, 0, 63, 0, 26, 0, 246, 255, 208, 255, 168, 255, 139, 255,
-109, 255, 79, 255, 56, 255, 35, 255, 15, 255, 1, 255, 252, 254, 251, 254, 255, 254, 7, 255, 16, 255, 26, 255, 45, 255, 63, 255, 83, 255, 107, 255, 128, 255, 147, 255, 165, 255, 182, 255, 198, 255, 213, 255, 224, 255, 233, 255, 240, 255, 246, 255, 253, 255, 4, 0, 6, 0, 9, 0, 13, 0, 19, 0,
-26, 0, 33, 0, 41, 0, 48, 0, 56, 0, 68, 0, 80, 0, 93, 0, 107, 0, 115, 0, 124, 0, 133, 0, 143, 0, 150, 0, 156, 0, 160, 0, 159, 0, 157, 0, 157, 0, 152, 0, 145, 0, 135, 0, 123, 0, 111, 0, 100, 0, 86, 0, 73, 0, 62, 0, 47, 0, 36, 0, 27, 0, 20, 0,
-11, 0, 3, 0, 255, 255, 250, 255, 248, 255, 251, 255, 250, 255, 248, 255, 247, 255, 245, 255, 244, 255, 242, 255, 237, 255, 230, 255, 222, 255, 209, 255, 200, 255, 190, 255, 175, 255, 162, 255, 146, 255, 125, 255, 116, 255, 105, 255, 94, 255, 87, 255, 79, 255, 71, 255, 72, 255, 74, 255, 79, 255, 88, 255,
-97, 255, 110, 255, 125, 255, 146, 255, 168, 255, 191, 255, 213, 255, 239, 255, 10, 0, 38, 0, 66, 0, 93, 0, 116, 0, 138, 0, 160, 0, 182, 0, 199, 0, 213, 0, 223, 0, 227, 0, 232, 0, 241, 0, 246, 0, 252, 0, 1, 1, 0, 1, 255, 0, 255, 0, 0, 1, 253, 0, 249, 0, 242, 0,
-233, 0, 224, 0, 214, 0, 198, 0, 181, 0, 164, 0, 141, 0, 120, 0, 100, 0, 73, 0, 46, 0, 18, 0, 246, 255, 221, 255, 197, 255, 173, 255, 149, 255, 123, 255, 98, 255, 83, 255, 68, 255, 56, 255, 51, 255, 43, 255, 36, 255, 39, 255, 43, 255, 50, 255, 64, 255, 75, 255, 90, 255, 107, 255,
-125, 255, 142, 255, 159, 255, 175, 255, 190, 255, 205, 255, 218, 255, 228, 255, 235, 255, 237, 255, 238, 255, 239, 255, 243, 255, 243, 255, 242, 255, 240, 255, 235, 255, 234, 255, 237, 255, 242, 255, 248, 255, 254, 255, 3, 0, 10, 0, 18, 0, 27, 0, 40, 0, 53, 0, 65, 0, 79, 0, 92, 0, 102, 0,
-114, 0, 126, 0, 136, 0, 147, 0, 157, 0, 166, 0, 169, 0, 169, 0, 166, 0, 164, 0, 162, 0, 159, 0, 155, 0, 144, 0, 131, 0, 117, 0, 108, 0, 100, 0, 94, 0, 88, 0, 80, 0, 70, 0, 58, 0, 52, 0, 47, 0, 38, 0, 32, 0, 22, 0, 9, 0, 251, 255, 235, 255, 217, 255,
-198, 255, 179, 255, 161, 255, 140, 255, 118, 255, 97, 255, 73, 255, 54, 255, 38, 255, 26, 255, 21, 255, 16, 255, 10, 255, 8, 255, 12, 255, 21, 255, 39, 255, 61, 255, 85, 255, 109, 255, 136, 255, 165, 255, 200, 255, 238, 255, 21, 0, 60, 0, 96, 0, 131, 0, 163, 0, 189, 0, 215, 0, 238, 0,
-253, 0, 8, 1, 15, 1, 12, 1, 3, 1, 247, 0, 231, 0, 219, 0, 205, 0, 187, 0, 168, 0, 148, 0, 127, 0, 111, 0, 100, 0, 92, 0, 84, 0, 77, 0, 69, 0, 60, 0, 58, 0, 57, 0, 58, 0, 59, 0, 59, 0, 59, 0, 50, 0, 43, 0, 38, 0, 28, 0, 19, 0, 11, 0,
-255, 255, 241, 255, 224, 255, 203, 255, 186, 255, 169, 255, 155, 255, 144, 255, 130, 255, 114, 255, 98, 255, 88, 255, 83, 255, 85, 255, 91, 255, 98, 255, 105, 255, 113, 255, 123, 255, 138, 255, 157, 255, 177, 255, 199, 255, 212, 255, 223, 255, 231, 255, 235, 255, 238, 255, 241, 255, 244, 255, 243, 255, 239, 255,
-234, 255, 226, 255, 219, 255, 214, 255, 217, 255, 220, 255, 225, 255, 229, 255, 234, 255, 240, 255, 251, 255, 14, 0, 37, 0, 63, 0, 88, 0, 113, 0, 138, 0, 165, 0, 195, 0, 229, 0, 4, 1, 31, 1, 54, 1, 66, 1, 73, 1, 76, 1, 73, 1, 66, 1, 54, 1, 37, 1, 7, 1, 231, 0,
-194, 0, 153, 0, 115, 0, 82, 0, 46, 0, 9, 0, 229, 255, 197, 255, 167, 255, 142, 255, 131, 255, 121, 255, 112, 255, 110, 255, 107, 255, 107, 255, 111, 255, 121, 255, 132, 255, 145, 255, 154, 255, 160, 255, 162, 255, 163, 255, 165, 255, 166, 255, 167, 255, 167, 255, 163, 255, 154, 255, 144, 255, 134, 255,
-124, 255, 120, 255, 117, 255, 114, 255, 112, 255, 110, 255, 111, 255, 122, 255, 138, 255, 160, 255, 191, 255, 218, 255, 247, 255, 24, 0, 55, 0, 89, 0, 126, 0, 161, 0, 190, 0, 213, 0, 227, 0, 235, 0, 239, 0, 241, 0, 237, 0, 231, 0, 219, 0, 198, 0, 173, 0, 146, 0, 118, 0, 93, 0,
-69, 0, 47, 0, 24, 0, 0, 0, 236, 255, 220, 255, 209, 255, 208, 255, 212, 255, 218, 255, 226, 255, 234, 255, 244, 255, 3, 0, 19, 0, 38, 0, 57, 0, 70, 0, 77, 0, 81, 0, 79, 0, 75, 0, 69, 0, 60, 0, 45, 0, 24, 0, 253, 255, 221, 255, 190, 255, 159, 255, 132, 255, 107, 255,
-84, 255, 62, 255, 44, 255, 30, 255, 25, 255, 30, 255, 41, 255, 57, 255, 78, 255, 98, 255, 120, 255, 147, 255, 175, 255, 206, 255, 241, 255, 15, 0, 43, 0, 67, 0, 84, 0, 100, 0, 118, 0, 130, 0, 141, 0, 150, 0, 146, 0, 139, 0, 131, 0, 120, 0, 111, 0, 103, 0, 96, 0, 88, 0,
-81, 0, 78, 0, 78, 0, 84, 0, 99, 0, 118, 0, 140, 0, 165, 0, 187, 0, 209, 0, 231, 0, 254, 0, 18, 1, 36, 1, 48, 1, 47, 1, 40, 1, 27, 1, 6, 1, 238, 0, 214, 0, 177, 0, 135, 0, 91, 0, 37, 0, 243, 255, 197, 255, 150, 255, 110, 255, 72, 255, 36, 255, 7, 255,
-239, 254, 221, 254, 215, 254, 217, 254, 225, 254, 239, 254, 0, 255, 22, 255, 47, 255, 77, 255, 111, 255, 150, 255, 187, 255, 222, 255, 249, 255, 15, 0, 34, 0, 49, 0, 59, 0, 64, 0, 63, 0, 54, 0, 39, 0, 20, 0, 1, 0, 240, 255, 226, 255, 212, 255, 200, 255, 191, 255, 186, 255, 185, 255,
-190, 255, 202, 255, 219, 255, 237, 255, 4, 0, 27, 0, 50, 0, 75, 0, 103, 0, 131, 0, 159, 0, 188, 0, 205, 0, 218, 0, 229, 0, 230, 0, 229, 0, 230, 0, 216, 0, 198, 0, 176, 0, 147, 0, 116, 0, 87, 0, 60, 0, 33, 0, 8, 0, 241, 255, 219, 255, 202, 255, 192, 255, 188, 255,
-188, 255, 195, 255, 206, 255, 219, 255, 234, 255, 250, 255, 11, 0, 29, 0, 47, 0, 64, 0, 75, 0, 76, 0, 72, 0, 62, 0, 44, 0, 27, 0, 5, 0, 235, 255, 201, 255, 167, 255, 132, 255, 98, 255, 71, 255, 47, 255, 24, 255, 7, 255, 251, 254, 243, 254, 246, 254, 0, 255, 15, 255, 42, 255,
-74, 255, 112, 255, 155, 255, 202, 255, 251, 255, 47, 0, 99, 0, 150, 0, 203, 0, 244, 0, 23, 1, 49, 1, 65, 1, 75, 1, 79, 1, 73, 1, 59, 1, 37, 1, 6, 1, 230, 0, 198, 0, 167, 0, 134, 0, 101, 0, 72, 0, 43, 0, 19, 0, 1, 0, 244, 255, 235, 255, 233, 255, 236, 255,
-243, 255, 252, 255, 8, 0, 19, 0, 31, 0, 47, 0, 61, 0, 72, 0, 79, 0, 76, 0, 70, 0, 61, 0, 49, 0, 33, 0, 14, 0, 244, 255, 214, 255, 181, 255, 151, 255, 122, 255, 94, 255, 70, 255, 46, 255, 26, 255, 13, 255, 6, 255, 5, 255, 10, 255, 26, 255, 48, 255, 75, 255, 108, 255,
-142, 255, 177, 255, 212, 255, 248, 255, 27, 0, 62, 0, 87, 0, 106, 0, 120, 0, 124, 0, 127, 0, 128, 0, 121, 0, 110, 0, 96, 0, 77, 0, 56, 0, 37, 0, 20, 0, 4, 0, 244, 255, 230, 255, 221, 255, 217, 255, 218, 255, 225, 255, 239, 255, 3, 0, 28, 0, 58, 0, 91, 0, 124, 0,
-157, 0, 189, 0, 224, 0, 254, 0, 24, 1, 47, 1, 53, 1, 53, 1, 48, 1, 33, 1, 13, 1, 244, 0, 207, 0, 167, 0, 123, 0, 76, 0, 33, 0, 246, 255, 201, 255, 162, 255, 126, 255, 92, 255, 72, 255, 55, 255, 43, 255, 44, 255, 49, 255, 58, 255, 75, 255, 95, 255, 115, 255, 134, 255,
-159, 255, 184, 255, 206, 255, 230, 255, 248, 255, 2, 0, 10, 0, 15, 0, 17, 0, 15, 0, 6, 0, 249, 255, 230, 255, 212, 255, 193, 255, 175, 255, 159, 255, 145, 255, 132, 255, 129, 255, 130, 255, 135, 255, 151, 255, 170, 255, 193, 255, 227, 255, 5, 0, 41, 0, 80, 0, 114, 0, 148, 0, 183, 0,
-213, 0, 239, 0, 8, 1, 17, 1, 22, 1, 23, 1, 16, 1, 2, 1, 240, 0, 213, 0, 181, 0, 144, 0, 106, 0, 68, 0, 30, 0, 249, 255, 214, 255, 182, 255, 151, 255, 135, 255, 121, 255, 110, 255, 109, 255, 113, 255, 121, 255, 137, 255, 154, 255, 173, 255, 194, 255, 217, 255, 240, 255, 7, 0,
-26, 0, 43, 0, 56, 0, 56, 0, 56, 0, 53, 0, 39, 0, 22, 0, 1, 0, 229, 255, 204, 255, 178, 255, 150, 255, 128, 255, 108, 255, 87, 255, 76, 255, 69, 255, 67, 255, 74, 255, 86, 255, 101, 255, 123, 255, 149, 255, 178, 255, 210, 255, 241, 255, 18, 0, 54, 0, 86, 0, 119, 0, 153, 0,
-173, 0, 193, 0, 210, 0, 216, 0, 218, 0, 216, 0, 205, 0, 189, 0, 170, 0, 148, 0, 126, 0, 105, 0, 83, 0, 65, 0, 47, 0, 33, 0, 29, 0, 28, 0, 30, 0, 37, 0, 48, 0, 63, 0, 84, 0, 103, 0, 124, 0, 149, 0, 166, 0, 183, 0, 203, 0, 209, 0, 213, 0, 214, 0,
-200, 0, 183, 0, 163, 0, 134, 0, 99, 0, 61, 0, 21, 0, 234, 255, 192, 255, 153, 255, 114, 255, 78, 255, 46, 255, 16, 255, 251, 254, 237, 254, 229, 254, 229, 254, 235, 254, 245, 254, 9, 255, 34, 255, 62, 255, 99, 255, 135, 255, 170, 255, 212, 255, 249, 255, 26, 0, 60, 0, 85, 0, 104, 0,
-118, 0, 124, 0, 125, 0, 121, 0, 113, 0, 102, 0, 89, 0, 76, 0, 62, 0, 46, 0, 30, 0, 16, 0, 4, 0, 253, 255, 251, 255, 254, 255, 0, 0, 7, 0, 17, 0, 31, 0, 48, 0, 68, 0, 90, 0, 109, 0, 130, 0, 151, 0, 164, 0, 177, 0, 187, 0, 190, 0, 185, 0, 177, 0,
-163, 0, 142, 0, 118, 0, 91, 0, 64, 0, 35, 0, 6, 0, 235, 255, 207, 255, 179, 255, 156, 255, 139, 255, 126, 255, 120, 255, 117, 255, 118, 255, 123, 255, 134, 255, 147, 255, 166, 255, 188, 255, 209, 255, 228, 255, 248, 255, 8, 0, 22, 0, 35, 0, 43, 0, 46, 0, 45, 0, 37, 0, 27, 0,
-13, 0, 252, 255, 235, 255, 218, 255, 199, 255, 181, 255, 163, 255, 142, 255, 127, 255, 117, 255, 114, 255, 116, 255, 124, 255, 139, 255, 159, 255, 182, 255, 212, 255, 248, 255, 31, 0, 72, 0, 112, 0, 150, 0, 186, 0, 218, 0, 247, 0, 17, 1, 34, 1, 45, 1, 50, 1, 43, 1, 33, 1, 18, 1,
-252, 0, 230, 0, 205, 0, 175, 0, 144, 0, 110, 0, 76, 0, 42, 0, 15, 0, 247, 255, 227, 255, 212, 255, 199, 255, 188, 255, 183, 255, 182, 255, 186, 255, 194, 255, 203, 255, 212, 255, 219, 255, 228, 255, 236, 255, 245, 255, 252, 255, 0, 0, 1, 0, 252, 255, 243, 255, 231, 255, 216, 255, 201, 255,
-};
-
-const uint32_t s_buffer_size = sizeof(wave_array_32000_16_1);
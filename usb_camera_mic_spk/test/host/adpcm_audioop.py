@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+#
+# SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Checks the samples adpcm_test wrote against CPython's own IMA ADPCM
+# decoder, audioop.adpcm2lin(), which shares no code with adpcm.c. audioop
+# takes the high nibble first and no block header, so each block is fed its
+# nibbles swapped with the header's predictor and step index as the state.
+#
+# audioop left the standard library with Python 3.13; there the check is
+# skipped.
+#
+#   adpcm_audioop.py PROMPT.wav decoded.raw
+
+import struct
+import sys
+import warnings
+
+with warnings.catch_warnings():
+    warnings.simplefilter('ignore', DeprecationWarning)
+    try:
+        import audioop
+    except ImportError:
+        audioop = None
+
+
+def chunks(wav):
+    i = 12
+    while i + 8 <= len(wav):
+        cid, size = wav[i:i + 4], struct.unpack('<I', wav[i + 4:i + 8])[0]
+        yield cid, wav[i + 8:i + 8 + size]
+        i += 8 + size + (size & 1)
+
+
+def decode(wav):
+    parts = dict(chunks(wav))
+    block_align = struct.unpack('<H', parts[b'fmt '][12:14])[0]
+    samples = struct.unpack('<I', parts[b'fact'][:4])[0]
+    data, out = parts[b'data'], bytearray()
+    for o in range(0, len(data), block_align):
+        block = data[o:o + block_align]
+        predictor, index = struct.unpack('<hB', block[:3])
+        swapped = bytes(((b & 15) << 4) | (b >> 4) for b in block[4:])
+        pcm, _ = audioop.adpcm2lin(swapped, 2, (predictor, index))
+        out += struct.pack('<h', predictor) + pcm
+    return bytes(out[:samples * 2])
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit('usage: adpcm_audioop.py PROMPT.wav decoded.raw')
+    if audioop is None:
+        print('adpcm_audioop: skipped, no audioop in this Python')
+        return
+    with open(sys.argv[1], 'rb') as f:
+        expected = decode(f.read())
+    with open(sys.argv[2], 'rb') as f:
+        got = f.read()
+    same = got == expected
+    print('%d samples, %s' % (len(expected) // 2, 'identical to audioop' if same else 'DIFFER from audioop'))
+    print('adpcm_audioop: %s' % ('ok' if same else 'FAILED'))
+    sys.exit(0 if same else 1)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,223 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * adpcm.c and prompt_store.c against a textbook IMA ADPCM decoder
+ *
+ * The reference below is the decoder of the IMA recommendation, one branch
+ * per code bit, clamping the predictor and the step index after each
+ * sample. adpcm.c computes the same step without branches on the code.
+ *
+ * Checks:
+ * - every block of the prompt decodes to the same samples with both
+ * - 200000 random blocks of 5 to 1024 bytes do too, with any header,
+ *   step indexes past 88 included
+ * - 200 playbacks through prompt_read() in random piece sizes, 0 included,
+ *   give the whole-block decode and stop at the prompt's length
+ *
+ * Reports the decode cost per sample of the reference, adpcm_decode_block()
+ * and prompt_read() in 480-sample pieces, in ns and on x86 in TSC cycles.
+ *
+ * With a second argument, the decoded prompt is written there as raw 16-bit
+ * samples for adpcm_audioop.py, which checks it against CPython's decoder.
+ *
+ * Usage: adpcm_test PROMPT.wav [decoded.raw]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "prompt_store.h"
+#include "adpcm.h"
+#include "host_test.h"
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC 1
+#endif
+
+#define RANDOM_BLOCKS   200000
+#define PLAYBACKS       200
+#define PIECE           480
+#define PASSES          200
+
+static const int s_ref_step[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97,
+    107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724,
+    796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327, 3660, 4026,
+    4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500,
+    20350, 22385, 24623, 27086, 29794, 32767
+};
+static const int s_ref_index[16] = { -1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8 };
+
+static size_t ref_decode_block(const uint8_t *block, size_t block_align, int16_t *out)
+{
+    int predictor = (int16_t)(block[0] | block[1] << 8);
+    int index = block[2] > 88 ? 88 : block[2];
+    size_t n = 0;
+
+    out[n++] = predictor;
+    for (size_t i = ADPCM_HEADER_SIZE; i < block_align; i++) {
+        for (int high = 0; high < 2; high++) {
+            int code = high ? block[i] >> 4 : block[i] & 15;
+            int step = s_ref_step[index];
+            int diff = step >> 3;
+            if (code & 4) {
+                diff += step;
+            }
+            if (code & 2) {
+                diff += step >> 1;
+            }
+            if (code & 1) {
+                diff += step >> 2;
+            }
+            predictor += code & 8 ? -diff : diff;
+            predictor = predictor > 32767 ? 32767 : predictor < -32768 ? -32768 : predictor;
+            index += s_ref_index[code];
+            index = index < 0 ? 0 : index > 88 ? 88 : index;
+            out[n++] = predictor;
+        }
+    }
+    return n;
+}
+
+static uint8_t *load(const char *path, size_t *len)
+{
+    FILE *f = fopen(path, "rb");
+    uint8_t *buf = NULL;
+
+    if (f && fseek(f, 0, SEEK_END) == 0) {
+        *len = ftell(f);
+        rewind(f);
+        buf = malloc(*len);
+        if (fread(buf, 1, *len, f) != *len) {
+            free(buf);
+            buf = NULL;
+        }
+    }
+    if (f) {
+        fclose(f);
+    }
+    return buf;
+}
+
+static uint64_t ticks(void)
+{
+#ifdef HAVE_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+int main(int argc, char **argv)
+{
+    size_t len;
+    uint8_t *wav = argc > 1 ? load(argv[1], &len) : NULL;
+
+    if (!wav) {
+        printf("usage: adpcm_test PROMPT.wav [decoded.raw]\n");
+        return 2;
+    }
+    ESP_ERROR_CHECK(prompt_store_add("prompt", wav, len));
+    const prompt_t *p = prompt_store_find("prompt");
+    size_t blocks = (p->samples + p->block_samples - 1) / p->block_samples;
+    size_t total = blocks * p->block_samples;
+    int16_t *ref = malloc(total * sizeof(int16_t));
+    int16_t *dec = malloc(total * sizeof(int16_t));
+    int16_t *played = malloc((p->samples + 3000) * sizeof(int16_t));
+
+    printf("%u samples at %u Hz in %zu blocks of %u bytes\n", p->samples, p->sample_rate, blocks, p->block_align);
+    for (size_t i = 0; i < blocks; i++) {
+        const uint8_t *block = p->data + i * p->block_align;
+        TEST_CHECK(ref_decode_block(block, p->block_align, ref + i * p->block_samples) == p->block_samples);
+        TEST_CHECK(adpcm_decode_block(block, p->block_align, dec + i * p->block_samples) == p->block_samples);
+    }
+    TEST_CHECK(!memcmp(ref, dec, p->samples * sizeof(int16_t)));
+    if (argc > 2) {
+        FILE *f = fopen(argv[2], "wb");
+        TEST_CHECK(f && fwrite(dec, sizeof(int16_t), p->samples, f) == p->samples);
+        if (f) {
+            fclose(f);
+        }
+    }
+
+    static const size_t sizes[] = { 5, 6, 36, 256, 512, 1024 };
+    static uint8_t block[1024];
+    static int16_t x[2048], y[2048];
+    int differ = 0;
+    srand(5);
+    for (int t = 0; t < RANDOM_BLOCKS; t++) {
+        size_t size = sizes[t % 6];
+        for (size_t i = 0; i < size; i++) {
+            block[i] = rand();
+        }
+        size_t n = ref_decode_block(block, size, x);
+        differ += adpcm_decode_block(block, size, y) != n || memcmp(x, y, n * sizeof(int16_t));
+    }
+    printf("%d random blocks, %d differ\n", RANDOM_BLOCKS, differ);
+    TEST_CHECK(differ == 0);
+
+    /* small pieces in the first half, up to 3000 samples in the second */
+    differ = 0;
+    for (int t = 0; t < PLAYBACKS; t++) {
+        prompt_reader_t r;
+        size_t got = 0, n, want;
+        prompt_reader_init(&r, p);
+        do {
+            want = rand() % (t < PLAYBACKS / 2 ? 17 : 3000);
+            n = prompt_read(&r, played + got, want);
+            got += n;
+        } while (n || !want);
+        differ += got != p->samples || memcmp(ref, played, got * sizeof(int16_t));
+    }
+    printf("%d playbacks in random pieces, %d differ\n", PLAYBACKS, differ);
+    TEST_CHECK(differ == 0);
+
+    uint64_t best_ns[3] = { UINT64_MAX, UINT64_MAX, UINT64_MAX }, best_tsc[3] = { UINT64_MAX, UINT64_MAX, UINT64_MAX };
+    for (int pass = 0; pass < PASSES; pass++) {
+        uint64_t ns[4], tsc[4];
+        ns[0] = test_now_ns();
+        tsc[0] = ticks();
+        for (size_t i = 0; i < blocks; i++) {
+            ref_decode_block(p->data + i * p->block_align, p->block_align, ref + i * p->block_samples);
+        }
+        ns[1] = test_now_ns();
+        tsc[1] = ticks();
+        for (size_t i = 0; i < blocks; i++) {
+            adpcm_decode_block(p->data + i * p->block_align, p->block_align, dec + i * p->block_samples);
+        }
+        ns[2] = test_now_ns();
+        tsc[2] = ticks();
+        prompt_reader_t r;
+        size_t got = 0;
+        prompt_reader_init(&r, p);
+        while (got < p->samples) {
+            got += prompt_read(&r, played + got, PIECE);
+        }
+        ns[3] = test_now_ns();
+        tsc[3] = ticks();
+        for (int k = 0; k < 3; k++) {
+            best_ns[k] = ns[k + 1] - ns[k] < best_ns[k] ? ns[k + 1] - ns[k] : best_ns[k];
+            best_tsc[k] = tsc[k + 1] - tsc[k] < best_tsc[k] ? tsc[k + 1] - tsc[k] : best_tsc[k];
+        }
+    }
+    static const char *names[] = { "textbook reference", "adpcm_decode_block()", "prompt_read() in 480" };
+    const double samples[] = { total, total, p->samples };
+    printf("\n%-22s %10s %14s\n", "decode cost", "ns/sample", "TSC/sample");
+    for (int k = 0; k < 3; k++) {
+        printf("%-22s %10.2f", names[k], best_ns[k] / samples[k]);
+#ifdef HAVE_TSC
+        printf(" %14.2f", best_tsc[k] / samples[k]);
+#endif
+        printf("\n");
+    }
+
+    free(ref);
+    free(dec);
+    free(played);
+    free(wav);
+    return test_exit_code("adpcm_test");
+}
@@ -0,0 +1,181 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * /capture latency: cached and coalesced frames against a wait on each request
+ *
+ * A producer pushes a frame every 66 ms, as a 15 fps camera does. Eight
+ * clients take a frame the way capture_handler does, return it and pause
+ * 0 to 133 ms, so requests land anywhere between frames and often together.
+ * Each client takes its frame in three ways in turn:
+ *
+ * - forced wait: each request waits for the next frame on a reader of its
+ *   own, as esp_camera_fb_get() did before the cache
+ * - coalesced: frame_ring_get_fresh() with a 5 ms maximum age, so nearly
+ *   every request waits, but the requests that arrive during a wait share it
+ * - cached: esp_camera_fb_get(), the newest frame when it is at most
+ *   CONFIG_CAPTURE_MAX_AGE_MS old, a wait shared as above otherwise
+ *
+ * Sending the JPEG costs the same in all three ways and is left out.
+ *
+ * Reports per way the requests served, p50, p99 and highest latency, and
+ * how many requests the ring served from the newest frame and how many
+ * waited. Fails on a request that got no frame.
+ *
+ * Usage: capture_bench [seconds per way, default 5]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "esp_timer.h"
+#include "esp_camera.h"
+#include "frame_ring.h"
+#include "host_test.h"
+
+#define SLOT_NUM        3
+#define SLOT_SIZE       8192
+#define FRAME_LEN       4096
+#define FRAME_US        66667
+#define CLIENTS         8
+#define COALESCE_AGE_US 5000
+#define SAMPLES_MAX     20000
+
+typedef enum {
+    WAY_FORCED,
+    WAY_COALESCED,
+    WAY_CACHED,
+    WAY_NUM,
+} way_t;
+
+static const char *s_names[WAY_NUM] = { "forced wait", "coalesced", "cached" };
+
+typedef struct {
+    pthread_t thread;
+    way_t way;
+    frame_ring_reader_t *reader;
+    unsigned seed;
+    double lat_ms[SAMPLES_MAX];
+    size_t n;
+    uint32_t failed;
+} client_t;
+
+static atomic_bool s_stop;
+static atomic_bool s_producer_stop;    /* after the clients, so none waits for a frame that never comes */
+
+static void *producer_thread(void *arg)
+{
+    static uint8_t buf[FRAME_LEN];
+    uint32_t seq = 0;
+    int64_t next = esp_timer_get_time();
+
+    while (!atomic_load(&s_producer_stop)) {
+        frame_ring_push(buf, sizeof(buf), 640, 480, ++seq, esp_timer_get_time());
+        next += FRAME_US;
+        int64_t left = next - esp_timer_get_time();
+        if (left > 0) {
+            usleep(left);
+        }
+    }
+    return NULL;
+}
+
+static camera_fb_t *take(client_t *c)
+{
+    camera_fb_t *fb;
+
+    switch (c->way) {
+    case WAY_FORCED:
+        /* skip what was pushed before the request */
+        while ((fb = frame_ring_reader_get(c->reader, 0))) {
+            frame_ring_return(fb);
+        }
+        return frame_ring_reader_get(c->reader, pdMS_TO_TICKS(1000));
+    case WAY_COALESCED:
+        return frame_ring_get_fresh(COALESCE_AGE_US, pdMS_TO_TICKS(1000));
+    default:
+        return esp_camera_fb_get();
+    }
+}
+
+static void *client_thread(void *arg)
+{
+    client_t *c = (client_t *)arg;
+
+    while (!atomic_load(&s_stop) && c->n < SAMPLES_MAX) {
+        usleep(rand_r(&c->seed) % (2 * FRAME_US));
+        uint64_t t0 = test_now_ns();
+        camera_fb_t *fb = take(c);
+        uint64_t t1 = test_now_ns();
+        if (!fb) {
+            c->failed++;
+            continue;
+        }
+        esp_camera_fb_return(fb);
+        c->lat_ms[c->n++] = (t1 - t0) / 1e6;
+    }
+    return NULL;
+}
+
+static void run(way_t way, int seconds)
+{
+    static client_t clients[CLIENTS];
+    static double lat_ms[CLIENTS * SAMPLES_MAX];
+    frame_ring_stats_t before, after;
+    pthread_t producer;
+    size_t n = 0;
+    uint32_t failed = 0;
+
+    frame_ring_get_stats(&before);
+    atomic_store(&s_stop, false);
+    atomic_store(&s_producer_stop, false);
+    pthread_create(&producer, NULL, producer_thread, NULL);
+    for (int i = 0; i < CLIENTS; i++) {
+        client_t *c = &clients[i];
+        c->way = way;
+        c->reader = way == WAY_FORCED ? frame_ring_reader_open() : NULL;
+        c->seed = 1234 + i;
+        c->n = 0;
+        c->failed = 0;
+        pthread_create(&c->thread, NULL, client_thread, c);
+    }
+    sleep(seconds);
+    atomic_store(&s_stop, true);
+    for (int i = 0; i < CLIENTS; i++) {
+        client_t *c = &clients[i];
+        pthread_join(c->thread, NULL);
+        frame_ring_reader_close(c->reader);
+        for (size_t k = 0; k < c->n; k++) {
+            lat_ms[n++] = c->lat_ms[k];
+        }
+        failed += c->failed;
+    }
+    atomic_store(&s_producer_stop, true);
+    pthread_join(producer, NULL);
+    frame_ring_get_stats(&after);
+
+    double p50 = test_percentile(lat_ms, n, 50), p99 = test_percentile(lat_ms, n, 99);
+    printf("%-12s %8zu %8.3f %8.3f %8.3f %8u %8u %6u\n", s_names[way], n, p50, p99, n ? lat_ms[n - 1] : 0,
+           after.fresh_hits - before.fresh_hits, after.fresh_waits - before.fresh_waits, failed);
+    TEST_CHECK(failed == 0);
+}
+
+int main(int argc, char **argv)
+{
+    int seconds = argc > 1 ? atoi(argv[1]) : 5;
+
+    ESP_ERROR_CHECK(frame_ring_init(SLOT_NUM, SLOT_SIZE));
+    printf("%d s per way, a frame every %.1f ms, %d clients pausing 0 to %.0f ms, cached up to %d ms old\n", seconds,
+           FRAME_US / 1e3, CLIENTS, 2 * FRAME_US / 1e3, CONFIG_CAPTURE_MAX_AGE_MS);
+    printf("%-12s %8s %8s %8s %8s %8s %8s %6s\n", "way", "requests", "p50 ms", "p99 ms", "max ms", "hits", "waits",
+           "failed");
+    for (way_t way = 0; way < WAY_NUM; way++) {
+        run(way, seconds);
+    }
+    return test_exit_code("capture_bench");
+}
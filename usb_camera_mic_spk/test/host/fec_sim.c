@@ -0,0 +1,171 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Frame recovery of the RTP parity against its overhead
+ *
+ * A camera-like frame from test_jpeg.c is packetized by rtp_jpeg.c with
+ * the media packet size rtsp_server.c uses with FEC, followed by the parity
+ * of rtp_fec.c: none, XOR or Reed-Solomon at 10, 20 and 30 % of the media
+ * packets, capped at CONFIG_RTP_FEC_MAX_PARITY as on the target. Each frame
+ * then goes through a lossy channel many times and rtp_rx.c rebuilds what
+ * arrived.
+ *
+ * Two channels at 1, 2, 5 and 10 % packet loss: random loss, and bursty
+ * loss from a Gilbert model whose bursts are 3 packets long on average.
+ *
+ * Reports, per scheme and overhead, the parity bytes against the media
+ * bytes and the share of frames that rebuild. Checks that every frame that
+ * rebuilds has the scan of the original.
+ *
+ * Usage: fec_sim [frames per point, default 3000]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sdkconfig.h"
+#include "jpeg_parse.h"
+#include "rtp_jpeg.h"
+#include "rtp_fec.h"
+#include "host_test.h"
+#include "test_jpeg.h"
+#include "rtp_rx.h"
+
+#define FRAME_MAX       (128 * 1024)
+#define MEDIA_SIZE      (CONFIG_RTP_PACKET_SIZE - RTP_FEC_OVERHEAD)
+#define BURST_LEN       3.0
+
+typedef struct {
+    rtp_fec_t fec;
+    uint8_t pkt[RTP_RX_MAX_PACKETS][RTP_RX_PACKET_MAX];
+    size_t len[RTP_RX_MAX_PACKETS];
+    int num;
+} sent_t;
+
+static void on_packet(void *ctx, const uint8_t *pkt, size_t len)
+{
+    sent_t *s = (sent_t *)ctx;
+
+    memcpy(s->pkt[s->num], pkt, len);
+    s->len[s->num++] = len;
+}
+
+static void on_media(void *ctx, const uint8_t *pkt, size_t len)
+{
+    sent_t *s = (sent_t *)ctx;
+
+    rtp_fec_add(&s->fec, pkt, len);
+    on_packet(ctx, pkt, len);
+}
+
+static double uniform(uint32_t *state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state / 4294967296.0;
+}
+
+/* share of frames that rebuild, over a channel with the given loss */
+static double recovery(const sent_t *s, const jpeg_info_t *info, double loss, bool bursty, int frames)
+{
+    static rtp_rx_frame_t f;
+    static uint8_t jpeg[FRAME_MAX];
+    /* Gilbert: the bad state loses every packet and lasts BURST_LEN packets on average */
+    double leave = 1 / BURST_LEN, enter = loss * leave / (1 - loss);
+    uint32_t state = 0x9E3779B9u;
+    bool bad = false;
+    int ok = 0;
+
+    for (int t = 0; t < frames; t++) {
+        rtp_rx_reset(&f);
+        for (int i = 0; i < s->num; i++) {
+            bool lost;
+            if (bursty) {
+                bad = uniform(&state) < (bad ? 1 - leave : enter);
+                lost = bad;
+            } else {
+                lost = uniform(&state) < loss;
+            }
+            if (!lost) {
+                rtp_rx_add(&f, s->pkt[i], s->len[i]);
+            }
+        }
+        size_t len = rtp_rx_repair(&f) == 0 ? rtp_rx_jpeg(&f, jpeg, sizeof(jpeg)) : 0;
+        if (len) {
+            jpeg_info_t got;
+            TEST_CHECK(jpeg_parse(jpeg, len, &got) == ESP_OK && got.scan_len == info->scan_len
+                       && !memcmp(got.scan, info->scan, got.scan_len));
+            ok++;
+        }
+    }
+    return 100.0 * ok / frames;
+}
+
+int main(int argc, char **argv)
+{
+    int frames = argc > 1 ? atoi(argv[1]) : 3000;
+    static const test_jpeg_config_t sources[] = {
+        { 320, 240, 2, 1, 0, TEST_JPEG_NOISE, 1 },
+        { 640, 480, 2, 1, 0, TEST_JPEG_NOISE, 1 },
+    };
+    static const struct {
+        const char *name;
+        rtp_fec_scheme_t scheme;
+        int percent;
+    } modes[] = {
+        { "none", RTP_FEC_NONE, 0 },
+        { "XOR", RTP_FEC_XOR, 10 }, { "XOR", RTP_FEC_XOR, 20 }, { "XOR", RTP_FEC_XOR, 30 },
+        { "RS", RTP_FEC_RS, 10 }, { "RS", RTP_FEC_RS, 20 }, { "RS", RTP_FEC_RS, 30 },
+    };
+    static const double losses[] = { 0.01, 0.02, 0.05, 0.10 };
+    static uint8_t src[FRAME_MAX], buf[CONFIG_RTP_PACKET_SIZE];
+    static sent_t s;
+
+    printf("%d frames per point, %d byte packets, at most %d parity packets per frame\n", frames,
+           CONFIG_RTP_PACKET_SIZE, CONFIG_RTP_FEC_MAX_PARITY);
+    for (size_t n = 0; n < sizeof(sources) / sizeof(sources[0]); n++) {
+        jpeg_info_t info;
+        size_t src_len = test_jpeg_encode(&sources[n], src, sizeof(src));
+        TEST_CHECK(src_len && jpeg_parse(src, src_len, &info) == ESP_OK);
+        int k = rtp_jpeg_packet_count(&info, MEDIA_SIZE);
+
+        printf("\n%ux%u frame of %zu bytes in %d media packets\n", info.width, info.height, src_len, k);
+        printf("%-6s %3s %6s | %-27s | %s\n", "parity", "m", "bytes", "frames rebuilt, random loss",
+               "bursty loss (bursts of 3)");
+        printf("%-6s %3s %6s | %6s %6s %6s %6s | %6s %6s %6s %6s\n", "", "", "", "1%", "2%", "5%", "10%",
+               "1%", "2%", "5%", "10%");
+        for (size_t mo = 0; mo < sizeof(modes) / sizeof(modes[0]); mo++) {
+            rtp_jpeg_stream_t stream = { .ssrc = 0x1234, .sequence = 65530 };
+            size_t media_bytes = 0, parity_bytes = 0;
+
+            s.num = 0;
+            if (modes[mo].scheme != RTP_FEC_NONE) {
+                TEST_CHECK(rtp_fec_init(&s.fec, modes[mo].scheme, MEDIA_SIZE, CONFIG_RTP_FEC_MAX_PARITY) == ESP_OK);
+                s.fec.stream.ssrc = 0x5678;
+                rtp_fec_begin(&s.fec, stream.sequence, 90000, k, (k * modes[mo].percent + 99) / 100);
+            }
+            TEST_CHECK(rtp_jpeg_packetize(&stream, &info, 90000, buf, MEDIA_SIZE, on_media, &s) == ESP_OK);
+            rtp_fec_finish(&s.fec, buf, sizeof(buf), on_packet, &s);
+            for (int i = 0; i < s.num; i++) {
+                *(i < k ? &media_bytes : &parity_bytes) += s.len[i];
+            }
+
+            printf("%-6s %3d %5.1f%%", modes[mo].name, s.num - k, 100.0 * parity_bytes / media_bytes);
+            for (int bursty = 0; bursty < 2; bursty++) {
+                printf(" |");
+                for (size_t l = 0; l < sizeof(losses) / sizeof(losses[0]); l++) {
+                    printf(" %6.2f", recovery(&s, &info, losses[l], bursty, frames));
+                }
+            }
+            printf("\n");
+            free(s.fec.parity);
+            memset(&s.fec, 0, sizeof(s.fec));
+        }
+    }
+    return test_exit_code("fec_sim");
+}
@@ -0,0 +1,257 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Frame ring fan-out
+ *
+ * A synthetic UVC producer hands uvc_frame_t frames to a callback that
+ * pushes them like camera_frame_cb() in main.c, while 1 to 8 consumer
+ * threads read the ring through their own readers. Every frame is filled
+ * with its sequence number, so a consumer sees a torn or recycled frame as
+ * a word that does not match, and a stale one as a sequence that does not
+ * increase.
+ *
+ * Two scenarios:
+ * - flat out: the producer pushes as fast as it can, the consumers hold
+ *   each frame for a different time; frames delivered per second per
+ *   consumer and the cost of a push, of which the listener, an eventfd
+ *   write as stream_server.c wakes its select() loop with
+ * - 30 fps: one consumer holds every frame for 200 ms, the others must
+ *   still get nearly every frame and the producer must never wait
+ *
+ * Usage: frame_ring_fanout [seconds per run, default 0.5]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include "esp_timer.h"
+#include "usb_stream.h"
+#include "frame_ring.h"
+#include "host_test.h"
+
+#define SLOT_NUM        3
+#define SLOT_SIZE       16384
+#define CONSUMERS_MAX   8
+
+typedef struct {
+    pthread_t thread;
+    frame_ring_reader_t *reader;
+    uint32_t hold_us;           /* time a frame is held, as if it was being sent */
+    uint32_t delivered;
+    uint32_t torn;
+    uint32_t stale;
+    uint32_t last_seq;
+} consumer_t;
+
+static atomic_bool s_stop;
+static int s_wake_fd;
+static uint64_t s_wake_ns;
+static uint64_t s_wakes;
+
+/* Frame length follows the sequence so a frame of another sequence has the wrong length too */
+static size_t frame_len(uint32_t seq)
+{
+    return 4096 + (seq % 16) * 512;
+}
+
+/* the push listener of stream_server.c, timed here in ns, the ring counts whole us */
+static void wake_listener(void *arg)
+{
+    uint64_t one = 1, t0 = test_now_ns();
+
+    write(s_wake_fd, &one, sizeof(one));
+    s_wake_ns += test_now_ns() - t0;
+    s_wakes++;
+}
+
+static void camera_frame_cb(uvc_frame_t *frame, void *ptr)
+{
+    frame_ring_push(frame->data, frame->data_bytes, frame->width, frame->height, frame->sequence, esp_timer_get_time());
+}
+
+static void produce(uint32_t seq, uint32_t *buf)
+{
+    size_t len = frame_len(seq);
+
+    for (size_t i = 0; i < len / 4; i++) {
+        buf[i] = seq;
+    }
+    uvc_frame_t frame = {
+        .data = buf,
+        .data_bytes = len,
+        .width = 640,
+        .height = 480,
+        .frame_format = UVC_FRAME_FORMAT_MJPEG,
+        .sequence = seq,
+    };
+    camera_frame_cb(&frame, NULL);
+}
+
+/* Whether the frame is whole and still the one that was pushed with its sequence number */
+static bool frame_intact(const camera_fb_t *fb, uint32_t *seq)
+{
+    memcpy(seq, fb->buf, 4);
+    if (fb->len != frame_len(*seq) || frame_ring_meta(fb)->sequence != *seq) {
+        return false;
+    }
+    for (size_t i = 0; i < fb->len; i += 4) {
+        uint32_t word;
+        memcpy(&word, fb->buf + i, 4);
+        if (word != *seq) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void *consumer_thread(void *arg)
+{
+    consumer_t *c = (consumer_t *)arg;
+    uint32_t seq, seq_after;
+
+    while (!atomic_load(&s_stop)) {
+        camera_fb_t *fb = frame_ring_reader_get(c->reader, pdMS_TO_TICKS(100));
+        if (!fb) {
+            continue;
+        }
+        c->torn += !frame_intact(fb, &seq);
+        c->stale += seq <= c->last_seq;
+        c->last_seq = seq;
+        if (c->hold_us) {
+            usleep(c->hold_us);
+        }
+        /* the producer must not have recycled the slot while it was held */
+        c->torn += !frame_intact(fb, &seq_after) || seq_after != seq;
+        frame_ring_return(fb);
+        c->delivered++;
+    }
+    return NULL;
+}
+
+static void start_consumers(consumer_t *c, int n)
+{
+    atomic_store(&s_stop, false);
+    for (int i = 0; i < n; i++) {
+        c[i].reader = frame_ring_reader_open();
+        TEST_CHECK(c[i].reader != NULL);
+        pthread_create(&c[i].thread, NULL, consumer_thread, &c[i]);
+    }
+}
+
+static void stop_consumers(consumer_t *c, int n)
+{
+    atomic_store(&s_stop, true);
+    for (int i = 0; i < n; i++) {
+        pthread_join(c[i].thread, NULL);
+        frame_ring_reader_close(c[i].reader);
+        TEST_CHECK(c[i].torn == 0);
+        TEST_CHECK(c[i].stale == 0);
+    }
+}
+
+static void run_flat_out(int n, double seconds, uint32_t *buf, uint32_t *seq)
+{
+    consumer_t c[CONSUMERS_MAX] = { 0 };
+    frame_ring_stats_t before, after;
+
+    /* consumers from a tight loop up to 1.4 ms per frame, like clients of different speeds */
+    for (int i = 0; i < n; i++) {
+        c[i].hold_us = i * 200;
+    }
+    frame_ring_get_stats(&before);
+    start_consumers(c, n);
+    uint64_t start = test_now_ns(), end = start + (uint64_t)(seconds * 1e9);
+    uint64_t push_ns = 0, pushes = 0, wake_ns = s_wake_ns, wakes = s_wakes;
+    while (test_now_ns() < end) {
+        uint64_t t0 = test_thread_cpu_ns();
+        produce(++*seq, buf);
+        push_ns += test_thread_cpu_ns() - t0;
+        pushes++;
+    }
+    double elapsed = (test_now_ns() - start) / 1e9;
+    stop_consumers(c, n);
+    frame_ring_get_stats(&after);
+
+    printf("%d consumer%s %9.0f frames/s in, %5.1f%% dropped, push %5.2f us cpu, max %4lu us, listener %4.2f us, "
+           "max %3lu us | delivered/s:", n, n == 1 ? " " : "s", (after.frames_in - before.frames_in) / elapsed,
+           100.0 * (after.pool_exhausted - before.pool_exhausted) / pushes, push_ns / 1e3 / pushes,
+           (unsigned long)after.push_time_max_us, (s_wake_ns - wake_ns) / 1e3 / (s_wakes - wakes ? s_wakes - wakes : 1),
+           (unsigned long)after.listener_time_max_us[0]);
+    for (int i = 0; i < n; i++) {
+        printf(" %.0f", c[i].delivered / elapsed);
+        TEST_CHECK(c[i].delivered > 0);
+    }
+    printf("\n");
+}
+
+static void run_paced(double seconds, uint32_t *buf, uint32_t *seq)
+{
+    const int n = CONSUMERS_MAX, fps = 30;
+    consumer_t c[CONSUMERS_MAX] = { 0 };
+    frame_ring_stats_t before, after;
+
+    c[0].hold_us = 200000;
+    frame_ring_get_stats(&before);
+    start_consumers(c, n);
+    int frames = (int)(seconds * fps);
+    uint64_t next = test_now_ns(), worst_push = 0;
+    for (int f = 0; f < frames; f++) {
+        uint64_t t0 = test_now_ns();
+        produce(++*seq, buf);
+        uint64_t took = test_now_ns() - t0;
+        worst_push = took > worst_push ? took : worst_push;
+        next += 1000000000ull / fps;
+        struct timespec ts = { .tv_sec = next / 1000000000ull, .tv_nsec = next % 1000000000ull };
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+    }
+    usleep(300000);
+    stop_consumers(c, n);
+    frame_ring_get_stats(&after);
+
+    uint32_t in = after.frames_in - before.frames_in;
+    uint32_t fast_min = UINT32_MAX;
+    for (int i = 1; i < n; i++) {
+        fast_min = c[i].delivered < fast_min ? c[i].delivered : fast_min;
+    }
+    printf("30 fps, 8 consumers, one holding frames 200 ms: %u of %d frames published, slow consumer got %u, "
+           "the others at least %u, longest push %.1f us\n",
+           in, frames, c[0].delivered, fast_min, worst_push / 1e3);
+    TEST_CHECK(in == (uint32_t)frames);
+    TEST_CHECK(fast_min >= in * 95 / 100);
+    /* the slow one gets about one frame per 200 ms, the run plus the 300 ms drain */
+    TEST_CHECK(c[0].delivered >= (uint32_t)(seconds * 4) && c[0].delivered <= (uint32_t)((seconds + 0.3) * 5) + 1);
+    TEST_CHECK(worst_push < 5000000);
+}
+
+int main(int argc, char **argv)
+{
+    double seconds = argc > 1 ? atof(argv[1]) : 0.5;
+    static uint32_t buf[SLOT_SIZE / 4];
+    uint32_t seq = 0;
+    frame_ring_stats_t stats;
+
+    ESP_ERROR_CHECK(frame_ring_init(SLOT_NUM, SLOT_SIZE));
+    s_wake_fd = eventfd(0, EFD_NONBLOCK);
+    ESP_ERROR_CHECK(frame_ring_add_listener(wake_listener, NULL));
+
+    printf("flat out, %d slots, consumers hold frames 0, 0.2, 0.4 ... 1.4 ms\n", SLOT_NUM);
+    for (int n = 1; n <= CONSUMERS_MAX; n++) {
+        run_flat_out(n, seconds, buf, &seq);
+    }
+    run_paced(seconds * 3, buf, &seq);
+
+    frame_ring_get_stats(&stats);
+    TEST_CHECK(stats.pinned == 0);
+    TEST_CHECK(stats.bad_returns == 0);
+    TEST_CHECK(stats.frames_oversize == 0);
+    TEST_CHECK(stats.listener_num == 1 && s_wakes == stats.frames_in);
+    return test_exit_code("frame_ring_fanout");
+}
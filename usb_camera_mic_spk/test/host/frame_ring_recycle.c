@@ -0,0 +1,386 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Reference-counted frame pool: no use after recycle
+ *
+ * A pool that can not be allocated leaves the ring empty: pushes are
+ * refused and readers get nothing, and a later frame_ring_init() works.
+ *
+ * Then the pool rules one step at a time: a pinned slot is never
+ * rewritten, a push with every slot pinned is dropped and counted, bad and
+ * double returns are refused and counted, frame_ring_ref() adds a pin.
+ *
+ * Then every way of pinning a frame at once against a producer pushing flat
+ * out: esp_camera_fb_get(), frame_ring_get_latest(), readers, and a reader
+ * that shares each frame with a second thread through frame_ring_ref().
+ * Every frame is filled with its sequence number and checked when it is
+ * taken and again after it was held for a random time; a slot recycled
+ * while pinned shows up as a changed word.
+ *
+ * Last, bursts of captures at 30 fps through esp_camera_fb_get() must get a
+ * frame no older than CONFIG_CAPTURE_MAX_AGE_MS, set to 10 ms here so most
+ * bursts have to wait, and a burst must wait for one frame, not one each.
+ *
+ * Usage: frame_ring_recycle [seconds of stress, default 2]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "esp_timer.h"
+#include "esp_camera.h"
+#include "frame_ring.h"
+#include "host_test.h"
+
+#define SLOT_NUM        3
+#define SLOT_SIZE       8192
+#define HOLDERS         8
+
+static atomic_bool s_stop;
+static atomic_uint s_seq;
+static atomic_uint s_corrupt;
+static atomic_uint s_taken;
+
+static size_t frame_len(uint32_t seq)
+{
+    return 1024 + (seq % 8) * 512;
+}
+
+static esp_err_t push(uint32_t seq)
+{
+    static uint32_t buf[SLOT_SIZE / 4];
+    size_t len = frame_len(seq);
+
+    for (size_t i = 0; i < len / 4; i++) {
+        buf[i] = seq;
+    }
+    return frame_ring_push((const uint8_t *)buf, len, 640, 480, seq, esp_timer_get_time());
+}
+
+/* Sequence number the frame carries, 0 if it is not whole */
+static uint32_t frame_seq(const camera_fb_t *fb)
+{
+    uint32_t seq;
+
+    memcpy(&seq, fb->buf, 4);
+    if (fb->len != frame_len(seq) || frame_ring_meta(fb)->sequence != seq) {
+        return 0;
+    }
+    for (size_t i = 0; i < fb->len; i += 4) {
+        uint32_t word;
+        memcpy(&word, fb->buf + i, 4);
+        if (word != seq) {
+            return 0;
+        }
+    }
+    return seq;
+}
+
+/* Check the frame, hold it for up to max_hold_us, check that it did not change, return it */
+static void hold_and_return(camera_fb_t *fb, uint32_t max_hold_us)
+{
+    uint32_t seq = frame_seq(fb);
+
+    if (max_hold_us) {
+        usleep(rand() % max_hold_us);
+    }
+    if (seq == 0 || frame_seq(fb) != seq) {
+        atomic_fetch_add(&s_corrupt, 1);
+    }
+    atomic_fetch_add(&s_taken, 1);
+    frame_ring_return(fb);
+}
+
+static void test_pool_rules(void)
+{
+    frame_ring_stats_t st, st2;
+    camera_fb_t *a, *b, *c;
+
+    TEST_CHECK(frame_ring_get_latest() == NULL);
+
+    TEST_CHECK(push(1) == ESP_OK);
+    a = frame_ring_get_latest();
+    TEST_CHECK(push(2) == ESP_OK);
+    b = frame_ring_get_latest();
+    TEST_CHECK(push(3) == ESP_OK);
+    c = frame_ring_get_latest();
+    TEST_CHECK(a && b && c && a != b && b != c && a != c);
+
+    /* every slot pinned: the frame is dropped, nothing is overwritten */
+    frame_ring_get_stats(&st);
+    TEST_CHECK(st.pinned == 3);
+    TEST_CHECK(push(4) == ESP_ERR_NO_MEM);
+    frame_ring_get_stats(&st2);
+    TEST_CHECK(st2.pool_exhausted == st.pool_exhausted + 1);
+    TEST_CHECK(st2.frames_in == st.frames_in);
+    TEST_CHECK(frame_seq(a) == 1 && frame_seq(b) == 2 && frame_seq(c) == 3);
+
+    /* the slot returned first is the one reused */
+    frame_ring_return(a);
+    TEST_CHECK(push(5) == ESP_OK);
+    TEST_CHECK(frame_seq(b) == 2 && frame_seq(c) == 3);
+    a = frame_ring_get_latest();
+    TEST_CHECK(a && frame_seq(a) == 5);
+
+    /* a second pin from frame_ring_ref() keeps the slot until both are returned */
+    TEST_CHECK(frame_ring_ref(c) == c);
+    frame_ring_return(c);
+    frame_ring_return(b);
+    TEST_CHECK(push(6) == ESP_OK);
+    TEST_CHECK(frame_seq(c) == 3);
+    frame_ring_return(c);
+
+    /* double and foreign returns are refused and counted, the pin count stays right */
+    frame_ring_get_stats(&st);
+    frame_ring_return(c);
+    camera_fb_t foreign = { 0 };
+    frame_ring_return(&foreign);
+    frame_ring_get_stats(&st2);
+    TEST_CHECK(st2.bad_returns == st.bad_returns + 2);
+    TEST_CHECK(st2.pinned == st.pinned);
+
+    /* too large for a slot */
+    TEST_CHECK(frame_ring_push((const uint8_t *)"", SLOT_SIZE + 1, 1, 1, 0, 0) == ESP_ERR_INVALID_SIZE);
+    frame_ring_get_stats(&st);
+    TEST_CHECK(st.frames_oversize == 1);
+
+    frame_ring_return(a);
+    frame_ring_get_stats(&st);
+    TEST_CHECK(st.pinned == 0);
+    atomic_store(&s_seq, 6);
+    printf("pool rules: ok\n");
+}
+
+static void *producer_thread(void *arg)
+{
+    while (!atomic_load(&s_stop)) {
+        push(atomic_fetch_add(&s_seq, 1) + 1);
+    }
+    return NULL;
+}
+
+static void *capture_thread(void *arg)
+{
+    while (!atomic_load(&s_stop)) {
+        camera_fb_t *fb = esp_camera_fb_get();
+        if (fb) {
+            hold_and_return(fb, 300);
+        }
+    }
+    return NULL;
+}
+
+static void *latest_thread(void *arg)
+{
+    while (!atomic_load(&s_stop)) {
+        camera_fb_t *fb = frame_ring_get_latest();
+        if (fb) {
+            hold_and_return(fb, 100);
+        }
+    }
+    return NULL;
+}
+
+static void *reader_thread(void *arg)
+{
+    frame_ring_reader_t *reader = frame_ring_reader_open();
+
+    TEST_CHECK(reader != NULL);
+    while (!atomic_load(&s_stop)) {
+        camera_fb_t *fb = frame_ring_reader_get(reader, pdMS_TO_TICKS(100));
+        if (fb) {
+            hold_and_return(fb, 500);
+        }
+    }
+    frame_ring_reader_close(reader);
+    return NULL;
+}
+
+/* One reader, two consumers: the frame goes to a second thread with its own pin */
+static int s_share_pipe[2];
+
+static void *share_thread(void *arg)
+{
+    frame_ring_reader_t *reader = frame_ring_reader_open();
+
+    TEST_CHECK(reader != NULL);
+    while (!atomic_load(&s_stop)) {
+        camera_fb_t *fb = frame_ring_reader_get(reader, pdMS_TO_TICKS(100));
+        if (!fb) {
+            continue;
+        }
+        camera_fb_t *shared = frame_ring_ref(fb);
+        TEST_CHECK(shared == fb);
+        if (write(s_share_pipe[1], &shared, sizeof(shared)) != sizeof(shared)) {
+            frame_ring_return(shared);
+        }
+        hold_and_return(fb, 200);
+    }
+    camera_fb_t *end = NULL;
+    write(s_share_pipe[1], &end, sizeof(end));
+    frame_ring_reader_close(reader);
+    return NULL;
+}
+
+static void *shared_consumer_thread(void *arg)
+{
+    camera_fb_t *fb;
+
+    while (read(s_share_pipe[0], &fb, sizeof(fb)) == sizeof(fb) && fb) {
+        hold_and_return(fb, 400);
+    }
+    return NULL;
+}
+
+static void test_concurrent(double seconds)
+{
+    void *(*fns[HOLDERS])(void *) = {
+        capture_thread, capture_thread, capture_thread, latest_thread,
+        reader_thread, reader_thread, share_thread, shared_consumer_thread,
+    };
+    pthread_t threads[HOLDERS], producer;
+    frame_ring_stats_t st0, st;
+
+    TEST_CHECK(pipe(s_share_pipe) == 0);
+    frame_ring_get_stats(&st0);
+    atomic_store(&s_stop, false);
+    for (int i = 0; i < HOLDERS; i++) {
+        pthread_create(&threads[i], NULL, fns[i], NULL);
+    }
+    pthread_create(&producer, NULL, producer_thread, NULL);
+    usleep((useconds_t)(seconds * 1e6));
+    atomic_store(&s_stop, true);
+    pthread_join(producer, NULL);
+    for (int i = 0; i < HOLDERS; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    close(s_share_pipe[0]);
+    close(s_share_pipe[1]);
+    frame_ring_get_stats(&st);
+
+    printf("concurrent, %.1f s: %u frames in, %u dropped with every slot pinned, %u frames held, "
+           "%u changed while pinned, %u bad returns, at most %u pins at once\n",
+           seconds, st.frames_in - st0.frames_in, st.pool_exhausted - st0.pool_exhausted,
+           atomic_load(&s_taken), atomic_load(&s_corrupt), st.bad_returns - st0.bad_returns, st.pinned_max);
+    TEST_CHECK(atomic_load(&s_taken) > 1000);
+    TEST_CHECK(atomic_load(&s_corrupt) == 0);
+    TEST_CHECK(st.bad_returns == st0.bad_returns);
+    TEST_CHECK(st.pinned == 0);
+}
+
+/* Bursts of captures at 30 fps: fresh enough, and a burst waits for one frame, not one each */
+#define CAPTURE_THREADS 6
+#define CAPTURE_ROUNDS  20
+
+typedef struct {
+    int captures;
+    int timeouts;
+    double worst_age_ms;
+} capture_result_t;
+
+static pthread_barrier_t s_round;
+
+static void *burst_capture_thread(void *arg)
+{
+    capture_result_t *r = (capture_result_t *)arg;
+
+    for (int i = 0; i < CAPTURE_ROUNDS; i++) {
+        /* the producer starts the round, all threads capture at once */
+        pthread_barrier_wait(&s_round);
+        camera_fb_t *fb = esp_camera_fb_get();
+        if (!fb) {
+            r->timeouts++;
+        } else {
+            double age = (esp_timer_get_time() - frame_ring_meta(fb)->published_us) / 1e3;
+            r->worst_age_ms = age > r->worst_age_ms ? age : r->worst_age_ms;
+            r->captures++;
+            usleep(2000);
+            frame_ring_return(fb);
+        }
+    }
+    return NULL;
+}
+
+static void test_fresh_captures(void)
+{
+    pthread_t threads[CAPTURE_THREADS];
+    capture_result_t results[CAPTURE_THREADS];
+    frame_ring_stats_t st0, st;
+
+    memset(results, 0, sizeof(results));
+    pthread_barrier_init(&s_round, NULL, CAPTURE_THREADS + 1);
+    frame_ring_get_stats(&st0);
+    for (int i = 0; i < CAPTURE_THREADS; i++) {
+        pthread_create(&threads[i], NULL, burst_capture_thread, &results[i]);
+    }
+    /* 30 fps producer on this thread, a burst starts every 100 to 200 ms between frames; it
+       goes on for 100 ms after the last one so its captures get their frame */
+    int64_t next_round = esp_timer_get_time() + 100000, end = INT64_MAX;
+    int round = 0;
+    while (esp_timer_get_time() < end) {
+        push(atomic_fetch_add(&s_seq, 1) + 1);
+        int64_t next_frame = esp_timer_get_time() + 33333;
+        if (round < CAPTURE_ROUNDS && next_round < next_frame) {
+            usleep(next_round > esp_timer_get_time() ? next_round - esp_timer_get_time() : 0);
+            pthread_barrier_wait(&s_round);
+            round++;
+            next_round = next_frame + 100000 + rand() % 100000;
+            end = round == CAPTURE_ROUNDS ? esp_timer_get_time() + 100000 : end;
+        }
+        if (next_frame > esp_timer_get_time()) {
+            usleep(next_frame - esp_timer_get_time());
+        }
+    }
+    for (int i = 0; i < CAPTURE_THREADS; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    frame_ring_get_stats(&st);
+
+    int captures = 0, timeouts = 0;
+    double worst = 0;
+    for (int i = 0; i < CAPTURE_THREADS; i++) {
+        captures += results[i].captures;
+        timeouts += results[i].timeouts;
+        worst = results[i].worst_age_ms > worst ? results[i].worst_age_ms : worst;
+    }
+    uint32_t hits = st.fresh_hits - st0.fresh_hits, waits = st.fresh_waits - st0.fresh_waits;
+    printf("%d bursts of %d captures at 30 fps: %u from the newest frame, %u waited for the next one, "
+           "oldest frame handed out %.1f ms (limit %d ms)\n", CAPTURE_ROUNDS, CAPTURE_THREADS, hits, waits,
+           worst, CONFIG_CAPTURE_MAX_AGE_MS);
+    TEST_CHECK(timeouts == 0);
+    TEST_CHECK(captures == CAPTURE_THREADS * CAPTURE_ROUNDS);
+    TEST_CHECK(hits + waits == (uint32_t)captures);
+    TEST_CHECK(waits > 0 && waits <= CAPTURE_ROUNDS);
+    TEST_CHECK(worst <= CONFIG_CAPTURE_MAX_AGE_MS + 5);
+    TEST_CHECK(st.pinned == 0);
+    pthread_barrier_destroy(&s_round);
+}
+
+static void test_init_no_memory(void)
+{
+    TEST_CHECK(frame_ring_init(SLOT_NUM, (size_t)1 << 60) == ESP_ERR_NO_MEM);
+    TEST_CHECK(frame_ring_push((const uint8_t *)"", 1, 1, 1, 0, 0) == ESP_ERR_INVALID_STATE);
+    TEST_CHECK(frame_ring_reader_open() == NULL);
+    TEST_CHECK(frame_ring_get_latest() == NULL);
+    TEST_CHECK(esp_camera_fb_get() == NULL);
+}
+
+int main(int argc, char **argv)
+{
+    double seconds = argc > 1 ? atof(argv[1]) : 2.0;
+
+    srand(1);
+    test_init_no_memory();
+    ESP_ERROR_CHECK(frame_ring_init(SLOT_NUM, SLOT_SIZE));
+    test_pool_rules();
+    test_concurrent(seconds);
+    test_fresh_captures();
+    return test_exit_code("frame_ring_recycle");
+}
@@ -0,0 +1,140 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * The whole firmware on the host
+ *
+ * main.c and every component as they are, against the stand-ins: the
+ * simulated USB devices of usb_stream_host.c, the HTTP server of
+ * esp_http_server_host.c and lwIP sized socket buffers. app_main() runs in
+ * its own task as on the target. The network is the host's: the pages are
+ * served on HOST_HTTP_PORT (default 18080), /stream one port above.
+ *
+ * http_load.py drives it with clients and reads its CPU time from /proc.
+ *
+ * Usage: host_app [--fps N] [--size MIN[-MAX]] [--mic RATE/BITS/CH]
+ *                 [--spk RATE/BITS/CH] [--assets FILE] [--seconds S]
+ *
+ * It first prints where esp_timer time 0 is on CLOCK_MONOTONIC, so a client
+ * on the same host can tell how old a frame timestamp is. Without --seconds
+ * it runs until SIGINT or SIGTERM. On the way out it prints what the
+ * simulated devices did.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "usb_stream_host.h"
+#include "esp_partition_host.h"
+#include "esp_http_server.h"
+#include "app_wifi.h"
+#include "sdkconfig.h"
+
+static const char *TAG = "host_app";
+
+static volatile sig_atomic_t s_stop;
+
+void app_main(void);
+
+/* the host is already on the network */
+void app_wifi_main(void)
+{
+    ESP_LOGI(TAG, "network: host, HTTP on port %d", httpd_host_default_port());
+}
+
+static void app_main_task(void *arg)
+{
+    app_main();
+    vTaskDelete(NULL);
+}
+
+static void on_signal(int sig)
+{
+    s_stop = 1;
+}
+
+static void usage(const char *name)
+{
+    fprintf(stderr, "usage: %s [--fps N] [--size MIN[-MAX]] [--mic RATE/BITS/CH] [--spk RATE/BITS/CH] "
+            "[--assets FILE] [--seconds S]\n", name);
+    exit(2);
+}
+
+static void parse_format(const char *arg, uint32_t *rate, uint16_t *bits, uint8_t *channels)
+{
+    unsigned r, b, c;
+
+    if (sscanf(arg, "%u/%u/%u", &r, &b, &c) != 3) {
+        fprintf(stderr, "format is RATE/BITS/CHANNELS, e.g. 16000/16/1: %s\n", arg);
+        exit(2);
+    }
+    *rate = r;
+    *bits = b;
+    *channels = c;
+}
+
+int main(int argc, char **argv)
+{
+    usb_stream_host_config_t config = { 0 };
+    double seconds = 0;
+
+    for (int i = 1; i < argc; i++) {
+        const char *opt = argv[i];
+        if (i + 1 == argc) {
+            usage(argv[0]);
+        }
+        const char *arg = argv[++i];
+        if (!strcmp(opt, "--fps")) {
+            config.fps = atoi(arg);
+        } else if (!strcmp(opt, "--size")) {
+            unsigned min, max;
+            int n = sscanf(arg, "%u-%u", &min, &max);
+            config.frame_size_min = min;
+            config.frame_size_max = n == 2 ? max : min;
+        } else if (!strcmp(opt, "--mic")) {
+            parse_format(arg, &config.mic_rate, &config.mic_bits, &config.mic_channels);
+        } else if (!strcmp(opt, "--spk")) {
+            parse_format(arg, &config.spk_rate, &config.spk_bits, &config.spk_channels);
+        } else if (!strcmp(opt, "--assets")) {
+            if (esp_partition_host_add(CONFIG_PROMPT_ASSETS_PARTITION, arg) != ESP_OK) {
+                return 1;
+            }
+        } else if (!strcmp(opt, "--seconds")) {
+            seconds = atof(arg);
+        } else {
+            usage(argv[0]);
+        }
+    }
+    usb_stream_host_configure(&config);
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    printf("boot at %lld us monotonic\n", (long long)ts.tv_sec * 1000000 + ts.tv_nsec / 1000 - esp_timer_get_time());
+    fflush(stdout);
+    signal(SIGINT, on_signal);
+    signal(SIGTERM, on_signal);
+    signal(SIGPIPE, SIG_IGN);
+
+    xTaskCreate(app_main_task, "main", 3584, NULL, 1, NULL);
+    for (int ms = 0; !s_stop && (seconds <= 0 || ms < seconds * 1000); ms += 10) {
+        usleep(10000);
+    }
+
+    usb_stream_host_stats_t stats;
+    usb_stream_host_get_stats(&stats);
+    printf("camera frames %u, mic bytes %llu, speaker bytes written %llu played %llu, underrun %u ms, "
+           "write timeouts %u\n", stats.frames, (unsigned long long)stats.mic_bytes,
+           (unsigned long long)stats.spk_bytes_written, (unsigned long long)stats.spk_bytes_played,
+           stats.spk_underrun_ms, stats.spk_write_timeouts);
+    return 0;
+}
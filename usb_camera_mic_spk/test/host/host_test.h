@@ -0,0 +1,69 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Helpers shared by the host tests and benchmarks
+ *
+ * TEST_CHECK() records a failure and goes on, test_exit_code() reports and
+ * turns the count into the exit status make test looks at. Times are
+ * CLOCK_MONOTONIC nanoseconds, or thread CPU time for the cost of a call.
+ */
+
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+
+static int s_test_failures;
+
+#define TEST_CHECK(cond) do {                                                   \
+        if (!(cond)) {                                                          \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond);              \
+            s_test_failures++;                                                  \
+        }                                                                       \
+    } while (0)
+
+static inline int test_exit_code(const char *name)
+{
+    printf("%s: %s\n", name, s_test_failures ? "FAILED" : "ok");
+    return s_test_failures ? 1 : 0;
+}
+
+static inline uint64_t test_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static inline uint64_t test_thread_cpu_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static int test_cmp_double(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+
+    return x < y ? -1 : x > y;
+}
+
+/* Sorts v in place and returns its p-th percentile, p in [0, 100] */
+static inline double test_percentile(double *v, size_t n, double p)
+{
+    if (n == 0) {
+        return 0;
+    }
+    qsort(v, n, sizeof(double), test_cmp_double);
+    size_t i = (size_t)(p / 100.0 * (n - 1) + 0.5);
+    return v[i < n ? i : n - 1];
+}
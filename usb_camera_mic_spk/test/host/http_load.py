@@ -0,0 +1,430 @@
+#!/usr/bin/env python3
+#
+# SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Load generator for the camera's HTTP endpoints. Each scenario opens /stream
+# clients, /ws/video clients, back-to-back /capture clients and
+# /capture?after= long polls for a few seconds and reports per scenario:
+#
+#   fps        frames per second per /stream or /ws/video client, lowest and
+#              mean
+#   Mbit/s     JPEG bytes received by all clients
+#   latency    age p50/p99 of the frames /stream and /ws/video clients got,
+#              from the capture timestamp to the last byte, on the client
+#   capture    /capture requests and long polls per second and their latency
+#              p50/p99, as the client sees it
+#   server     capture to last byte p50/p99 of frames sent by /stream and the
+#              p99 time of /capture in microseconds, from the histograms of
+#              /metrics
+#   cpu        CPU time per frame sent of the tasks that serve frames, above
+#              what they spend with no client, and the CPU load of the whole
+#              server with clients and without
+#
+# By default every scenario gets a fresh build/host_app, so the histograms
+# and CPU time are its own. --host runs against a board instead, where CPU
+# time is not known and the histograms count from boot.
+#
+#   http_load.py                              the default scenarios
+#   http_load.py stream:8+capture:2 --fps 30  one scenario
+#   http_load.py stream:4 ws:4                 /stream against /ws/video
+#   http_load.py stream:1@10 ws:1@10           viewers showing 10 frames a second
+#   http_load.py --host 192.168.4.1 --port 80 stream:4
+#   http_load.py poll:4                        long polls, every other one at scale=2
+#   http_load.py --check stream:2+capture:1   exit 1 on a lost frame or a failed request
+
+import argparse
+import base64
+import http.client
+import os
+import re
+import socket
+import struct
+import subprocess
+import sys
+import threading
+import time
+
+DEFAULT_SCENARIOS = ['stream:1', 'stream:4', 'stream:16', 'ws:1', 'ws:4', 'capture:1', 'capture:4',
+                     'poll:4',
+                     'stream:1@10', 'ws:1@10', 'stream:8+capture:4']
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+
+def percentile(values, p):
+    if not values:
+        return 0
+    values = sorted(values)
+    return values[min(len(values) - 1, int(p / 100.0 * (len(values) - 1) + 0.5))]
+
+
+class StreamClient(threading.Thread):
+    """Reads multipart JPEG parts from /stream until stopped."""
+
+    def __init__(self, host, port, boot_us, fps=0):
+        super().__init__(daemon=True)
+        self.host, self.port = host, port
+        self.boot_us = boot_us  # esp_timer 0 on time.monotonic(), None if not known
+        self.period = 1.0 / fps if fps else 0
+        self.frames = 0
+        self.bytes = 0
+        self.gaps = []
+        self.latencies = []
+        self.lost = 0           # sequence numbers skipped by the server
+        self.error = None
+        self.stop = threading.Event()
+
+    def got_frame(self, seq, captured_us, size):
+        now = time.monotonic()
+        if self.boot_us is not None:
+            self.latencies.append(now - (self.boot_us + captured_us) / 1e6)
+        if self.frames:
+            self.gaps.append(now - self.last_time)
+            if seq > self.last_seq + 1:
+                self.lost += seq - self.last_seq - 1
+        self.last_time, self.last_seq = now, seq
+        self.frames += 1
+        self.bytes += size
+        if self.period:
+            # a viewer that shows at most fps frames a second
+            time.sleep(max(0, self.last_time + self.period - time.monotonic()))
+
+    def run(self):
+        try:
+            sock = socket.create_connection((self.host, self.port), timeout=5)
+            sock.sendall(b'GET /stream HTTP/1.1\r\nHost: %s\r\n\r\n' % self.host.encode())
+            f = sock.makefile('rb')
+            status = f.readline()
+            if b' 200 ' not in status:
+                raise RuntimeError('status %r' % status.strip())
+            while not self.stop.is_set():
+                headers = {}
+                line = f.readline()
+                while line and line.strip() != b'' or not headers:
+                    if not line:
+                        raise RuntimeError('closed by the server')
+                    name, _, value = line.decode('latin-1').partition(':')
+                    if value:
+                        headers[name.strip().lower()] = value.strip()
+                    line = f.readline()
+                if 'content-length' not in headers:
+                    continue    # the response head
+                body = f.read(int(headers['content-length']))
+                sec, _, usec = headers['x-timestamp'].partition('.')
+                self.got_frame(int(headers['x-sequence']), int(sec) * 1000000 + int(usec), len(body))
+            sock.close()
+        except Exception as e:  # reported with the results
+            self.error = str(e)
+
+
+class WsClient(StreamClient):
+    """Reads /ws/video messages, granting a credit for each frame it got."""
+
+    HEADER = struct.Struct('<IIq')      # ws_video_header_t
+
+    def send(self, sock, opcode, payload):
+        # client frames are masked, a zero mask leaves the payload as it is
+        sock.sendall(struct.pack('!BB4s', 0x80 | opcode, 0x80 | len(payload), bytes(4)) + payload)
+
+    def run(self):
+        try:
+            sock = socket.create_connection((self.host, self.port), timeout=5)
+            key = base64.b64encode(os.urandom(16))
+            sock.sendall(b'GET /ws/video HTTP/1.1\r\nHost: %s\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n'
+                         b'Sec-WebSocket-Key: %s\r\nSec-WebSocket-Version: 13\r\n\r\n' % (self.host.encode(), key))
+            f = sock.makefile('rb')
+            status = f.readline()
+            if b' 101 ' not in status:
+                raise RuntimeError('status %r' % status.strip())
+            while f.readline().strip():
+                pass
+            # a paced viewer wants the newest frame when it is ready, not one queued behind the last
+            self.send(sock, 0x1, b'1' if self.period else b'2')
+            while not self.stop.is_set():
+                b0, b1 = f.read(2)
+                length = b1 & 0x7f
+                if length == 126:
+                    length, = struct.unpack('!H', f.read(2))
+                elif length == 127:
+                    length, = struct.unpack('!Q', f.read(8))
+                payload = f.read(length)
+                opcode = b0 & 0x0f
+                if opcode == 0x8:
+                    raise RuntimeError('closed by the server')
+                if opcode == 0x9:
+                    self.send(sock, 0xa, payload)
+                if opcode != 0x2:
+                    continue
+                seq, size, captured_us = self.HEADER.unpack_from(payload)
+                if size != length - self.HEADER.size:
+                    raise RuntimeError('frame %d: %d bytes in a message of %d' % (seq, size, length))
+                self.got_frame(seq, captured_us, size)
+                self.send(sock, 0x1, b'1')
+            sock.close()
+        except Exception as e:
+            self.error = str(e)
+
+
+class CaptureClient(threading.Thread):
+    """Requests /capture back to back on one keep-alive connection."""
+
+    def __init__(self, host, port):
+        super().__init__(daemon=True)
+        self.host, self.port = host, port
+        self.frames = 0
+        self.bytes = 0
+        self.latencies = []
+        self.failed = 0
+        self.error = None
+        self.stop = threading.Event()
+
+    def run(self):
+        try:
+            conn = http.client.HTTPConnection(self.host, self.port, timeout=5)
+            while not self.stop.is_set():
+                start = time.monotonic()
+                conn.request('GET', '/capture')
+                resp = conn.getresponse()
+                body = resp.read()
+                self.latencies.append(time.monotonic() - start)
+                if resp.status != 200:
+                    self.failed += 1
+                    continue
+                self.frames += 1
+                self.bytes += len(body)
+            conn.close()
+        except Exception as e:
+            self.error = str(e)
+
+
+class PollClient(CaptureClient):
+    """Long polls /capture?after=SEQ on one keep-alive connection, for every frame in turn."""
+
+    def __init__(self, host, port, scale):
+        super().__init__(host, port)
+        self.scale = scale
+        self.lost = 0           # sequence numbers skipped between two answers
+
+    def run(self):
+        try:
+            conn = http.client.HTTPConnection(self.host, self.port, timeout=15)
+            after = None
+            while not self.stop.is_set():
+                start = time.monotonic()
+                conn.request('GET', '/capture?scale=%d&after=%d' % (self.scale, after or 0))
+                resp = conn.getresponse()
+                body = resp.read()
+                if resp.status == 304:
+                    continue
+                self.latencies.append(time.monotonic() - start)
+                if resp.status != 200 or int(resp.getheader('Content-Length')) != len(body):
+                    self.failed += 1
+                    continue
+                seq = int(resp.getheader('X-Sequence'))
+                if after is not None:
+                    self.lost += max(0, seq - after - 1)
+                after = seq
+                self.frames += 1
+                self.bytes += len(body)
+            conn.close()
+        except Exception as e:
+            self.error = str(e)
+
+
+def fetch_metrics(host, port):
+    conn = http.client.HTTPConnection(host, port, timeout=5)
+    conn.request('GET', '/metrics')
+    text = conn.getresponse().read().decode()
+    conn.close()
+    metrics = {}
+    for line in text.splitlines():
+        m = re.match(r'^(\w+)(\{quantile="([\d.]+)"\})? (\d+)$', line)
+        if m:
+            metrics[m.group(1) + ('@' + m.group(3) if m.group(3) else '')] = int(m.group(4))
+    return metrics
+
+
+# tasks that do not serve frames: the simulated USB devices and the speaker mixer
+OTHER_TASKS = re.compile(r'^(usb_|spk_mixer)')
+
+
+def cpu_seconds(pid, frames_only=False):
+    """CPU time of the live threads of the process, to the nanosecond.
+
+    /proc/PID/stat also counts exited threads but in 10 ms ticks, too coarse
+    for a few seconds at a few percent. The tasks serving clients live as
+    long as the server, only /audio starts one per stream.
+    """
+    if pid is None:
+        return 0
+    total = 0
+    for tid in os.listdir('/proc/%d/task' % pid):
+        try:
+            with open('/proc/%d/task/%s/comm' % (pid, tid)) as f:
+                if frames_only and OTHER_TASKS.match(f.read()):
+                    continue
+            with open('/proc/%d/task/%s/schedstat' % (pid, tid)) as f:
+                total += int(f.read().split()[0])
+        except OSError:
+            pass    # exited meanwhile
+    return total / 1e9
+
+
+def start_app(args):
+    cmd = [args.app, '--fps', str(args.fps), '--size', args.size]
+    env = dict(os.environ, HOST_HTTP_PORT=str(args.port))
+    log = os.path.join(os.path.dirname(args.app), 'host_app.log')
+    with open(log, 'w') as f:
+        app = subprocess.Popen(cmd, env=env, stdout=f, stderr=subprocess.STDOUT)
+    deadline = time.monotonic() + 5
+    while time.monotonic() < deadline:
+        try:
+            fetch_metrics(args.host, args.port)
+            with open(log) as f:
+                boot_us = int(re.search(r'boot at (\d+) us monotonic', f.read()).group(1))
+            return app, boot_us
+        except OSError:
+            time.sleep(0.05)
+    app.kill()
+    sys.exit('host_app did not come up, see %s' % log)
+
+
+def parse_scenario(text):
+    """[(kind, fps)] with one entry per client, fps 0 for as fast as it can."""
+    clients = []
+    for part in text.split('+'):
+        m = re.match(r'^(stream|ws|capture|poll):(\d+)(@(\d+))?$', part)
+        if not m or m.group(1) in ('capture', 'poll') and m.group(4):
+            sys.exit('%s: a scenario is stream:N[@FPS], ws:N[@FPS], capture:N, poll:N or several joined by +' % text)
+        clients += [(m.group(1), int(m.group(4) or 0))] * int(m.group(2))
+    return clients
+
+
+def run_scenario(args, name):
+    kinds = parse_scenario(name)
+    app, boot_us = start_app(args) if not args.host_given else (None, None)
+    pid = app.pid if app else None
+    try:
+        # what the server spends with no client
+        idle_start, idle_cpu, idle_frame_cpu = time.monotonic(), cpu_seconds(pid), cpu_seconds(pid, True)
+        time.sleep(args.idle)
+        idle_time = max(time.monotonic() - idle_start, 1e-6)
+        idle_rate = (cpu_seconds(pid) - idle_cpu) / idle_time
+        idle_frame_rate = (cpu_seconds(pid, True) - idle_frame_cpu) / idle_time
+
+        before = fetch_metrics(args.host, args.port)
+        streams = [StreamClient(args.host, args.port + 1, boot_us, fps) for kind, fps in kinds if kind == 'stream']
+        streams += [WsClient(args.host, args.port, boot_us, fps) for kind, fps in kinds if kind == 'ws']
+        captures = [CaptureClient(args.host, args.port) for kind, _ in kinds if kind == 'capture']
+        polls = [PollClient(args.host, args.port, 1 + i % 2) for i in range(sum(kind == 'poll' for kind, _ in kinds))]
+        captures += polls
+        clients = streams + captures
+        start, cpu_start, frame_cpu_start = time.monotonic(), cpu_seconds(pid), cpu_seconds(pid, True)
+        for c in clients:
+            c.start()
+        time.sleep(args.seconds)
+        elapsed, cpu = time.monotonic() - start, cpu_seconds(pid) - cpu_start
+        frame_cpu = cpu_seconds(pid, True) - frame_cpu_start
+        for c in clients:
+            c.stop.set()
+        for c in clients:
+            c.join(5)
+        after = fetch_metrics(args.host, args.port)
+    finally:
+        if app:
+            app.terminate()
+            app.wait()
+
+    frames_in = after['camera_frames_in_total'] - before['camera_frames_in_total']
+    sent = sum(after[k] - before[k] for k in ('stream_frames_out_total', 'ws_frames_out_total',
+                                             'capture_frames_total'))
+    fps = [c.frames / elapsed for c in streams]
+    latencies = [t for c in captures for t in c.latencies]
+    ages = [t for c in streams for t in c.latencies]
+    result = {
+        'name': name,
+        'fps_min': min(fps) if fps else 0,
+        'fps_mean': sum(fps) / len(fps) if fps else 0,
+        'mbps': sum(c.bytes for c in clients) * 8 / elapsed / 1e6,
+        'age_p50': percentile(ages, 50) * 1e3,
+        'age_p99': percentile(ages, 99) * 1e3,
+        'capture_rate': sum(c.frames for c in captures) / elapsed,
+        'capture_p50': percentile(latencies, 50) * 1e3,
+        'capture_p99': percentile(latencies, 99) * 1e3,
+        'frame_p50': after.get('frame_total_us@0.5', 0) / 1e3 if streams else 0,
+        'frame_p99': after.get('frame_total_us@0.99', 0) / 1e3 if streams else 0,
+        'server_capture_p99': after.get('capture_us@0.99', 0) if captures else 0,
+        'cpu_per_frame': (frame_cpu - idle_frame_rate * elapsed) / sent * 1e6 if sent and pid else 0,
+        'cpu_percent': cpu / elapsed * 100 if pid else 0,
+        'idle_percent': idle_rate * 100,
+        'frames_in': frames_in,
+        'camera_fps': frames_in / elapsed,
+        'errors': [c.error for c in clients if c.error],
+        'failed': sum(c.failed for c in captures),
+        'lost': sum(c.lost for c in streams),
+        'poll_min_frames': min((c.frames for c in polls), default=0),
+        'polls': len(polls),
+        'stream_min_frames': min((c.frames for c in streams if not c.period), default=0),
+        'streams': sum(not c.period for c in streams),
+    }
+    return result
+
+
+def check(args, r):
+    """Problems with a scenario, for --check."""
+    problems = list(r['errors'])
+    if r['failed']:
+        problems.append('%d /capture requests failed' % r['failed'])
+    # paced clients skip frames on purpose
+    if r['streams'] and r['stream_min_frames'] < r['frames_in'] * 0.9:
+        problems.append('a client got %d of %d frames' % (r['stream_min_frames'], r['frames_in']))
+    # an answer that does not wait goes out through httpd_resp_send(), head and body apart, and can sit out a
+    # delayed ACK, after which the next frame is already there; a long poll that is never woken gets 304s
+    if r['polls'] and r['poll_min_frames'] < r['frames_in'] * 0.5:
+        problems.append('a long poll got %d of %d frames' % (r['poll_min_frames'], r['frames_in']))
+    if r['camera_fps'] < args.fps * 0.9:
+        problems.append('camera at %.1f of %d fps' % (r['camera_fps'], args.fps))
+    return problems
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Load the camera HTTP endpoints, see the top of the file.')
+    parser.add_argument('scenarios', nargs='*',
+                        help='stream:N[@FPS], ws:N[@FPS], capture:N, poll:N or several joined by +')
+    parser.add_argument('--app', default=os.path.join(HERE, 'build', 'host_app'), help='host build to start')
+    parser.add_argument('--host', help='run against this server instead of starting the host build')
+    parser.add_argument('--port', type=int, default=18080, help='HTTP port, /stream is one above')
+    parser.add_argument('--seconds', type=float, default=5, help='length of each scenario')
+    parser.add_argument('--idle', type=float, default=1, help='seconds to measure the idle CPU time')
+    parser.add_argument('--fps', type=int, default=30, help='camera frame rate of the host build')
+    parser.add_argument('--size', default='20000-40000', help='JPEG size range of the host build')
+    parser.add_argument('--check', action='store_true', help='exit 1 on a lost frame or failed request')
+    args = parser.parse_args()
+    args.host_given = args.host is not None
+    args.host = args.host or '127.0.0.1'
+    if args.host_given:
+        args.idle = 0
+
+    print('%-20s %13s %7s %17s %22s %17s %8s %11s %12s' % (
+        'scenario', 'fps min/mean', 'Mbit/s', 'latency p50/p99', 'capture/s p50/p99 ms', 'server p50/p99 ms',
+        'cap us', 'cpu us/fr', 'cpu %/idle'))
+    failures = 0
+    for name in args.scenarios or DEFAULT_SCENARIOS:
+        r = run_scenario(args, name)
+        print('%-20s %6.1f/%6.1f %7.1f %8.2f/%8.2f %8.1f %6.1f/%6.1f %8.2f/%8.2f %8d %11.0f %5.0f/%5.0f' % (
+            r['name'], r['fps_min'], r['fps_mean'], r['mbps'], r['age_p50'], r['age_p99'], r['capture_rate'],
+            r['capture_p50'],
+            r['capture_p99'], r['frame_p50'], r['frame_p99'], r['server_capture_p99'], r['cpu_per_frame'],
+            r['cpu_percent'], r['idle_percent']))
+        problems = check(args, r) if args.check else r['errors']
+        for p in problems:
+            print('  %s: %s' % ('FAIL' if args.check else 'error', p))
+        failures += bool(problems) and args.check
+    if args.check:
+        print('http_load: %s' % ('FAILED' if failures else 'ok'))
+    return 1 if failures else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
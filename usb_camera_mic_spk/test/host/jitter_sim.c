@@ -0,0 +1,230 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Jitter buffer against network arrival traces
+ *
+ * A sender makes a 220 Hz sine at 48 kHz in 20 ms packets for 60 s. Each
+ * trace delays the packets its own way and they arrive in order, as over
+ * the one TCP connection of /ws/speaker. The player pulls a 10 ms period
+ * every 10 ms in 128-sample pieces, as the speaker mixer does. The buffer
+ * has the settings of speaker_ws.c.
+ *
+ * Traces:
+ * - steady: 2 ms on every packet
+ * - gauss 5 ms, gauss 15 ms: plus the magnitude of a normal deviate
+ * - wifi stalls: 1 % of the packets start a stall of 80 to 200 ms
+ * - sender +-1000 ppm: the sender's clock runs fast or slow
+ * - 1 s outage: nothing arrives for a second halfway, then all of it
+ *
+ * Checks that no two samples played in a row step further apart than the
+ * sine can, outside concealment and overflow, that every stream plays out to its end,
+ * and that the steady, gauss 5 ms and drifting traces never run dry.
+ *
+ * Reports per trace the final target, the mean and highest latency the
+ * buffer adds, underruns, time concealed, samples dropped to overflow and
+ * adjusted to follow the target. Then the cost of a push and of a pull,
+ * plain and through an underrun.
+ *
+ * Usage: jitter_sim [seconds per trace, default 60]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include "sdkconfig.h"
+#include "jitter_buffer.h"
+#include "host_test.h"
+
+#define RATE            48000
+#define PACKET_MS       20
+#define PACKET          (RATE * PACKET_MS / 1000)
+#define PERIOD          (RATE / 100)
+#define PIECE           128
+#define TONE_HZ         220
+#define AMPLITUDE       8000
+#define STEP_MAX        600         /* the sine moves at most 231 between two samples */
+#define RUNS            2000
+
+/* as speaker_ws.c sets it up */
+static const jitter_buffer_config_t s_config = {
+    .sample_rate = RATE,
+    .min_ms = CONFIG_SPEAKER_WS_MIN_MS,
+    .max_ms = CONFIG_SPEAKER_WS_MAX_MS,
+    .start_ms = 100,
+    .margin_ms = 10,
+};
+
+typedef enum {
+    TRACE_STEADY,
+    TRACE_GAUSS5,
+    TRACE_GAUSS15,
+    TRACE_WIFI,
+    TRACE_FAST,
+    TRACE_SLOW,
+    TRACE_OUTAGE,
+    TRACE_NUM,
+} trace_t;
+
+static const char *s_names[TRACE_NUM] = {
+    "steady", "gauss 5 ms", "gauss 15 ms", "wifi stalls", "sender +1000 ppm", "sender -1000 ppm", "1 s outage",
+};
+
+static double gauss(void)
+{
+    double u = (rand() + 1.0) / (RAND_MAX + 2.0), v = (rand() + 1.0) / (RAND_MAX + 2.0);
+
+    return sqrt(-2 * log(u)) * cos(2 * M_PI * v);
+}
+
+/* arrival time in us of each packet */
+static void make_trace(trace_t t, double *arrival, int packets)
+{
+    double ppm = t == TRACE_FAST ? 1000 : t == TRACE_SLOW ? -1000 : 0;
+    double prev = 0, stall_until = 0, half = packets * PACKET_MS * 500.0;
+
+    srand(1234 + t);
+    for (int k = 0; k < packets; k++) {
+        double send = k * PACKET_MS * 1000.0 / (1 + ppm * 1e-6), delay = 2000;
+        if (t == TRACE_GAUSS5 || t == TRACE_GAUSS15) {
+            delay += fabs(gauss() * (t == TRACE_GAUSS5 ? 5000 : 15000));
+        } else if (t == TRACE_WIFI) {
+            if (send >= stall_until && rand() % 100 == 0) {
+                stall_until = send + 80000 + rand() % 120000;
+            }
+            delay = (send < stall_until ? stall_until - send : 0) + rand() % 3000;
+        } else if (t == TRACE_OUTAGE && send >= half && send < half + 1e6) {
+            delay = half + 1e6 - send;
+        }
+        /* in order, one TCP connection */
+        prev = send + delay > prev ? send + delay : prev;
+        arrival[k] = prev;
+    }
+}
+
+static void run(trace_t t, int seconds)
+{
+    int packets = seconds * 1000 / PACKET_MS;
+    double *arrival = malloc(packets * sizeof(double));
+    int16_t pkt[PACKET], out[PERIOD];
+    jitter_buffer_stats_t st;
+    jitter_buffer_t *jb;
+    uint32_t steps = 0, lat_max = 0, periods = 0;
+    double lat_sum = 0;
+    int16_t last = 0;
+    bool playing = false;
+    int k = 0;
+
+    make_trace(t, arrival, packets);
+    ESP_ERROR_CHECK(jitter_buffer_create(&s_config, &jb));
+    for (double now = 0; now < (seconds + 2) * 1e6 && !jitter_buffer_done(jb); now += 10000) {
+        jitter_buffer_get_stats(jb, &st);
+        uint32_t concealed = st.concealed, dropped = st.dropped;
+        for (; k < packets && arrival[k] <= now; k++) {
+            for (int i = 0; i < PACKET; i++) {
+                pkt[i] = (int16_t)lrint(AMPLITUDE * sin(2 * M_PI * TONE_HZ * ((double)k * PACKET + i) / RATE));
+            }
+            jitter_buffer_push(jb, pkt, PACKET, (int64_t)now);
+        }
+        if (k == packets) {
+            jitter_buffer_end(jb);
+        }
+
+        size_t got = 0, n = PIECE;
+        while (got < PERIOD && n == PIECE) {
+            n = jitter_buffer_pull(jb, out + got, PERIOD - got < PIECE ? PERIOD - got : PIECE);
+            got += n;
+        }
+        jitter_buffer_get_stats(jb, &st);
+        for (size_t i = 0; i < got; i++) {
+            steps += playing && st.concealed == concealed && st.dropped == dropped && abs(out[i] - last) > STEP_MAX;
+            last = out[i];
+            playing = true;
+        }
+        if (got) {
+            lat_sum += st.latency_ms;
+            periods++;
+            /* after the first seconds, once the target settled */
+            lat_max = now > 5e6 && st.latency_ms > lat_max ? st.latency_ms : lat_max;
+        }
+    }
+    jitter_buffer_get_stats(jb, &st);
+    printf("%-17s %6u %6.1f %6u %9u %9.1f %8u %8u %6u\n", s_names[t], st.target_ms, lat_sum / (periods ? periods : 1),
+           lat_max, st.underruns, st.concealed * 1000.0 / RATE, st.dropped, st.adjusted, steps);
+
+    TEST_CHECK(steps == 0);
+    TEST_CHECK(jitter_buffer_done(jb));
+    if (t == TRACE_STEADY || t == TRACE_GAUSS5 || t == TRACE_FAST || t == TRACE_SLOW) {
+        TEST_CHECK(st.underruns == 0);
+    }
+    jitter_buffer_delete(jb);
+    free(arrival);
+}
+
+/* best time in us of a push of 20 ms, a pull of 10 ms and one that runs dry */
+static void cost(void)
+{
+    static int16_t pkt[PACKET], out[PERIOD];
+    uint64_t push = UINT64_MAX, pull = UINT64_MAX, dry = UINT64_MAX;
+    jitter_buffer_t *jb;
+
+    for (int i = 0; i < PACKET; i++) {
+        pkt[i] = i * 37;
+    }
+    ESP_ERROR_CHECK(jitter_buffer_create(&s_config, &jb));
+    for (int r = 0; r < RUNS * 10; r++) {
+        uint64_t t0 = test_now_ns();
+        jitter_buffer_push(jb, pkt, PACKET, (int64_t)r * PACKET_MS * 1000);
+        uint64_t t1 = test_now_ns();
+        push = t1 - t0 < push ? t1 - t0 : push;
+        for (int p = 0; p < 2; p++) {
+            t0 = test_now_ns();
+            jitter_buffer_pull(jb, out, PERIOD);
+            t1 = test_now_ns();
+            pull = r > 10 && t1 - t0 < pull ? t1 - t0 : pull;
+        }
+    }
+    jitter_buffer_delete(jb);
+
+    /* 100 ms buffered, the start target: 10 periods play, the 11th finds it dry and conceals */
+    for (int r = 0; r < RUNS; r++) {
+        jitter_buffer_stats_t st;
+        ESP_ERROR_CHECK(jitter_buffer_create(&s_config, &jb));
+        for (int k = 0; k < 5; k++) {
+            jitter_buffer_push(jb, pkt, PACKET, k * PACKET_MS * 1000);
+        }
+        for (int p = 0; p < 10; p++) {
+            jitter_buffer_pull(jb, out, PERIOD);
+        }
+        uint64_t t0 = test_now_ns();
+        jitter_buffer_pull(jb, out, PERIOD);
+        uint64_t t = test_now_ns() - t0;
+        jitter_buffer_get_stats(jb, &st);
+        TEST_CHECK(st.underruns == 1);
+        dry = t < dry ? t : dry;
+        jitter_buffer_delete(jb);
+    }
+    printf("\n%d Hz, best of runs: push of %d ms %.2f us, pull of 10 ms %.2f us, through an underrun %.2f us\n",
+           RATE, PACKET_MS, push / 1e3, pull / 1e3, dry / 1e3);
+}
+
+int main(int argc, char **argv)
+{
+    int seconds = argc > 1 ? atoi(argv[1]) : 60;
+
+    printf("%d s per trace at %d Hz, %d ms packets, 10 ms periods, target %d to %d ms\n", seconds, RATE, PACKET_MS,
+           s_config.min_ms, s_config.max_ms);
+    printf("%-17s %6s %6s %6s %9s %9s %8s %8s %6s\n", "trace", "target", "lat", "max", "underruns", "concealed",
+           "dropped", "adjusted", "steps");
+    printf("%-17s %6s %6s %6s %9s %9s %8s %8s %6s\n", "", "ms", "ms", "ms", "", "ms", "samples", "samples", "");
+    for (int t = 0; t < TRACE_NUM; t++) {
+        run(t, seconds);
+    }
+    cost();
+    return test_exit_code("jitter_sim");
+}
@@ -0,0 +1,74 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * jpeg_scale(): time per frame and output size against the scale
+ *
+ * The sources are camera-like frames from test_jpeg.c, about 40 KB at
+ * 640x480, one of them with restart markers every 40 MCUs. Each is scaled
+ * by 2, 4 and 8. Per scale: milliseconds and thread CPU time per frame,
+ * against the 66.7 ms a frame at 15 fps allows, and output bytes and share
+ * of the source. The result must parse with the size asked for and its
+ * scan must decode, which scaling it once more checks.
+ *
+ * Usage: jpeg_scale_bench [frames per run, default 50]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "host_test.h"
+#include "jpeg_scale.h"
+#include "jpeg_parse.h"
+#include "test_jpeg.h"
+
+#define SOURCE_MAX  (512 * 1024)
+
+typedef struct {
+    const char *name;
+    test_jpeg_config_t config;
+} source_t;
+
+int main(int argc, char **argv)
+{
+    int frames = argc > 1 ? atoi(argv[1]) : 50;
+    static const source_t sources[] = {
+        { "640x480 4:2:2", { 640, 480, 2, 1, 0, TEST_JPEG_NOISE } },
+        { "640x480 4:2:0", { 640, 480, 2, 2, 0, TEST_JPEG_NOISE } },
+        { "640x480 RST", { 640, 480, 2, 1, 40, TEST_JPEG_NOISE } },
+        { "1280x720 4:2:2", { 1280, 720, 2, 1, 0, TEST_JPEG_NOISE } },
+    };
+    static uint8_t src[SOURCE_MAX], dst[SOURCE_MAX], check[SOURCE_MAX];
+
+    printf("%d frames per run, 15 fps is %.1f ms per frame\n", frames, 1000.0 / 15);
+    printf("%-15s %8s %6s %10s %10s %10s %7s %7s\n", "source", "bytes", "scale", "output", "bytes", "share",
+           "ms", "cpu ms");
+    for (size_t s = 0; s < sizeof(sources) / sizeof(sources[0]); s++) {
+        size_t src_len = test_jpeg_encode(&sources[s].config, src, sizeof(src));
+        for (int scale = 2; scale <= 8; scale *= 2) {
+            size_t len = 0;
+            uint64_t t0 = test_now_ns(), c0 = test_thread_cpu_ns();
+            for (int i = 0; i < frames; i++) {
+                TEST_CHECK(jpeg_scale(src, src_len, scale, dst, sizeof(dst), &len) == ESP_OK);
+            }
+            double ms = (test_now_ns() - t0) / 1e6 / frames;
+            double cpu_ms = (test_thread_cpu_ns() - c0) / 1e6 / frames;
+
+            jpeg_info_t info;
+            size_t check_len;
+            TEST_CHECK(jpeg_parse(dst, len, &info) == ESP_OK);
+            TEST_CHECK(info.width == (sources[s].config.width + scale - 1) / scale);
+            TEST_CHECK(info.height == (sources[s].config.height + scale - 1) / scale);
+            TEST_CHECK(jpeg_scale(dst, len, 2, check, sizeof(check), &check_len) == ESP_OK);
+
+            char out[16];
+            snprintf(out, sizeof(out), "%ux%u", info.width, info.height);
+            printf("%-15s %8zu %6d %10s %10zu %9.1f%% %7.2f %7.2f\n", sources[s].name, src_len, scale, out, len,
+                   100.0 * len / src_len, ms, cpu_ms);
+        }
+    }
+    return test_exit_code("jpeg_scale_bench");
+}
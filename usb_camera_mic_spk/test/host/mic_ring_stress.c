@@ -0,0 +1,201 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Mic ring under a synthetic UAC microphone
+ *
+ * A writer thread plays the mic callback: 48 kHz 16-bit mono, one 96-byte
+ * packet every millisecond into a 16 KB ring, each sample the running
+ * sample count. Four readers drain it as the consumers of the firmware
+ * do: one reads 256 bytes at a time as fast as it can, one reads 10 ms
+ * blocks every 10 ms like /audio, one reads 15 samples at a time like a
+ * level meter, so its reads split the writer's packets, and one stalls
+ * 300 ms between reads.
+ *
+ * Checks:
+ * - the fast, the paced and the meter reader get every sample written
+ *   while they were open, in order, with no overrun
+ * - the stalled reader counts overruns and skips to the newest samples;
+ *   every sample written is read, counted as lost or still unread, and no
+ *   read has a break inside
+ * - the writer never waits for a reader: 99 % of the writes take less
+ *   than 50 us
+ *
+ * Reports the cost of mic_ring_write() in the paced run, which includes
+ * waking the sleeping readers, then back to back with no reader and with
+ * every reader open.
+ *
+ * Usage: mic_ring_stress [seconds, default 3]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "freertos/FreeRTOS.h"
+#include "mic_ring.h"
+#include "host_test.h"
+
+#define RATE            48000
+#define PACKET_SAMPLES  (RATE / 1000)
+#define RING_SIZE       16384
+#define TIGHT_WRITES    200000
+
+typedef struct {
+    const char *name;
+    size_t chunk;               /* bytes per read */
+    int sleep_ms;               /* between reads */
+    bool drains;                /* keeps up, must get every sample */
+    pthread_t thread;
+    mic_ring_reader_t *reader;
+    uint64_t samples;
+    uint64_t missed;            /* samples skipped over between reads */
+    uint32_t gaps;
+    uint32_t torn;              /* breaks inside one read */
+    uint16_t next;
+    bool started;
+} reader_t;
+
+static atomic_bool s_stop;
+
+static void *reader_thread(void *arg)
+{
+    reader_t *r = (reader_t *)arg;
+    uint16_t buf[4096];
+
+    while (!atomic_load(&s_stop)) {
+        size_t n = mic_ring_read(r->reader, buf, r->chunk, pdMS_TO_TICKS(20)) / 2;
+        for (size_t i = 0; i < n; i++) {
+            if (r->started && buf[i] != r->next) {
+                if (i) {
+                    r->torn++;
+                } else {
+                    r->gaps++;
+                    r->missed += (uint16_t)(buf[i] - r->next);
+                }
+            }
+            r->started = true;
+            r->next = buf[i] + 1;
+        }
+        r->samples += n;
+        if (r->sleep_ms) {
+            usleep(r->sleep_ms * 1000);
+        }
+    }
+    return NULL;
+}
+
+static void fill(uint16_t *pkt, uint32_t *count)
+{
+    for (int i = 0; i < PACKET_SAMPLES; i++) {
+        pkt[i] = (*count)++;
+    }
+}
+
+/* back to back writes, ns each */
+static double tight_write_ns(void)
+{
+    uint16_t pkt[PACKET_SAMPLES];
+    uint32_t count = 0;
+
+    fill(pkt, &count);
+    uint64_t t0 = test_now_ns();
+    for (int i = 0; i < TIGHT_WRITES; i++) {
+        mic_ring_write(pkt, sizeof(pkt));
+    }
+    return (double)(test_now_ns() - t0) / TIGHT_WRITES;
+}
+
+int main(int argc, char **argv)
+{
+    double seconds = argc > 1 ? atof(argv[1]) : 3.0;
+    int packets = (int)(seconds * 1000);
+    static reader_t readers[] = {
+        { "fast", 256, 0, true },
+        { "paced", RATE / 100 * 2, 10, true },
+        { "meter", 30, 0, true },
+        { "stalled", 1024, 300, false },
+    };
+    const int reader_num = sizeof(readers) / sizeof(readers[0]);
+    double *write_ns = malloc(packets * sizeof(double));
+    uint16_t pkt[PACKET_SAMPLES];
+    uint32_t count = 0;
+    mic_ring_stats_t stats;
+
+    ESP_ERROR_CHECK(mic_ring_init(RING_SIZE));
+    mic_ring_set_format(&(mic_ring_format_t) { RATE, 16, 1 });
+    for (int i = 0; i < reader_num; i++) {
+        readers[i].reader = mic_ring_reader_open();
+        TEST_CHECK(readers[i].reader != NULL);
+        pthread_create(&readers[i].thread, NULL, reader_thread, &readers[i]);
+    }
+
+    uint64_t next = test_now_ns();
+    for (int p = 0; p < packets; p++) {
+        fill(pkt, &count);
+        uint64_t t0 = test_now_ns();
+        mic_ring_write(pkt, sizeof(pkt));
+        write_ns[p] = test_now_ns() - t0;
+        next += 1000000;
+        struct timespec ts = { .tv_sec = next / 1000000000ull, .tv_nsec = next % 1000000000ull };
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+    }
+    /* let the readers catch up with the last packet, the stalled one wakes from its sleep */
+    usleep(400000);
+    atomic_store(&s_stop, true);
+    for (int i = 0; i < reader_num; i++) {
+        pthread_join(readers[i].thread, NULL);
+    }
+    mic_ring_get_stats(&stats);
+
+    double sum = 0;
+    for (int p = 0; p < packets; p++) {
+        sum += write_ns[p];
+    }
+    double avg = sum / packets, p50 = test_percentile(write_ns, packets, 50);
+    double p99 = test_percentile(write_ns, packets, 99), max = test_percentile(write_ns, packets, 100);
+    printf("%d packets of %d bytes at 1 ms, %u samples, %d byte ring\n", packets, (int)sizeof(pkt), count,
+           (int)stats.size);
+    printf("mic_ring_write paced: avg %.0f ns, p50 %.0f ns, p99 %.0f ns, max %.0f ns\n", avg, p50, p99, max);
+    for (int i = 0; i < reader_num; i++) {
+        reader_t *r = &readers[i];
+        mic_ring_reader_stats_t *s = &stats.readers[i];
+        printf("%-8s %4zu B every %3d ms: %6llu samples, %u gaps, %6llu missed, %2u overruns, %6u bytes lost, "
+               "%4u underruns\n", r->name, r->chunk, r->sleep_ms, (unsigned long long)r->samples, r->gaps,
+               (unsigned long long)r->missed, s->overruns, s->bytes_lost, s->underruns);
+        TEST_CHECK(r->torn == 0);
+    }
+
+    for (int i = 0; i < reader_num; i++) {
+        reader_t *r = &readers[i];
+        mic_ring_reader_stats_t *s = &stats.readers[i];
+        if (r->drains) {
+            TEST_CHECK(r->gaps == 0 && r->samples == count);
+            TEST_CHECK(s->overruns == 0);
+            continue;
+        }
+        /* an overrun before the first read or after the last one shows as no gap */
+        TEST_CHECK(s->overruns > 0 && r->gaps <= s->overruns);
+        TEST_CHECK(r->missed * 2 <= s->bytes_lost);
+        TEST_CHECK(r->samples * 2 + s->bytes_lost + s->fill == count * 2);
+    }
+    TEST_CHECK(p99 < 50000);
+
+    for (int i = 0; i < reader_num; i++) {
+        mic_ring_reader_close(readers[i].reader);
+    }
+    double idle = tight_write_ns();
+    for (int i = 0; i < MIC_RING_MAX_READERS; i++) {
+        TEST_CHECK(mic_ring_reader_open() != NULL);
+    }
+    double open = tight_write_ns();
+    printf("mic_ring_write back to back: %.0f ns with no reader, %.0f ns with %d readers open\n", idle, open,
+           MIC_RING_MAX_READERS);
+    free(write_ns);
+    return test_exit_code("mic_ring_stress");
+}
@@ -0,0 +1,426 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Speaker mixer: gains, clipping, ducking and its sources
+ *
+ * The mixer runs at 48 kHz stereo with a 10 ms attack and a 100 ms release,
+ * as speaker_mixer_task sets it up, on sources that replay a table of
+ * random frames or hold a constant.
+ *
+ * Checks:
+ * - one source at unity gain comes out bit-exact, silence with none
+ * - a gain change ramps down within the attack, then scales exactly
+ * - a sum past 16 bits saturates and is counted on the bus; a source over
+ *   its limit is clipped to it and counted on the source
+ * - a ducking source pulls a bed down to its ducking gain within the
+ *   attack and lets it back up within the release, with no step between
+ *   two frames larger than the ramp
+ * - the tone source has its frequency and level on every channel
+ * - the prompt player gives what decoding, resampling and spreading the
+ *   prompt by hand gives, at 4 rates and 1 to 8 channels, and loops after
+ *   its gap
+ *
+ * Reports the time to mix one 10 ms period with 1 to 8 sources in five
+ * ways, 10th percentile of 2000.
+ *
+ * Usage: mixer_test PROMPT.wav
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include "mixer.h"
+#include "mixer_sources.h"
+#include "prompt_store.h"
+#include "resampler.h"
+#include "host_test.h"
+
+#define RATE            48000
+#define CHANNELS        2
+#define PERIOD          (RATE / 100)
+#define TABLE_FRAMES    960
+#define RUNS            2000
+
+static const mixer_config_t s_config = {
+    .sample_rate = RATE, .channels = CHANNELS, .attack_ms = 10, .release_ms = 100,
+};
+
+/* stereo frames from a table, over and over */
+typedef struct {
+    const int16_t *data;
+    size_t pos;
+} table_src_t;
+
+static size_t table_read(void *ctx, int16_t *out, size_t frames)
+{
+    table_src_t *s = (table_src_t *)ctx;
+
+    for (size_t n = 0; n < frames;) {
+        size_t k = TABLE_FRAMES - s->pos < frames - n ? TABLE_FRAMES - s->pos : frames - n;
+        memcpy(out + n * CHANNELS, s->data + s->pos * CHANNELS, k * CHANNELS * sizeof(int16_t));
+        n += k;
+        s->pos = (s->pos + k) % TABLE_FRAMES;
+    }
+    return frames;
+}
+
+/* a constant between frames from and until, nothing elsewhere */
+typedef struct {
+    int16_t value;
+    size_t t;
+    size_t from;
+    size_t until;
+} const_src_t;
+
+static size_t const_read(void *ctx, int16_t *out, size_t frames)
+{
+    const_src_t *s = (const_src_t *)ctx;
+    size_t t = s->t;
+
+    s->t += frames;
+    if (t < s->from || t >= s->until) {
+        return 0;
+    }
+    for (size_t i = 0; i < frames * CHANNELS; i++) {
+        out[i] = s->value;
+    }
+    return frames;
+}
+
+/* silence for 30 ms, then nothing for 30 ms */
+static size_t toggle_read(void *ctx, int16_t *out, size_t frames)
+{
+    size_t *t = (size_t *)ctx, at = *t;
+
+    *t += frames;
+    if ((at / (3 * PERIOD)) & 1) {
+        return 0;
+    }
+    memset(out, 0, frames * CHANNELS * sizeof(int16_t));
+    return frames;
+}
+
+static uint8_t *load(const char *path, size_t *len)
+{
+    FILE *f = fopen(path, "rb");
+    uint8_t *buf = NULL;
+
+    if (f && fseek(f, 0, SEEK_END) == 0) {
+        *len = ftell(f);
+        rewind(f);
+        buf = malloc(*len);
+        if (fread(buf, 1, *len, f) != *len) {
+            free(buf);
+            buf = NULL;
+        }
+    }
+    if (f) {
+        fclose(f);
+    }
+    return buf;
+}
+
+static void check_gain_and_clipping(const int16_t *table)
+{
+    static int16_t out[TABLE_FRAMES * CHANNELS];
+    mixer_source_config_t sc = MIXER_SOURCE_CONFIG_DEFAULT();
+    table_src_t ts = { table, 0 };
+    mixer_source_t *a, *b;
+    mixer_stats_t st;
+    mixer_t *m;
+    bool ok;
+
+    ESP_ERROR_CHECK(mixer_create(&s_config, &m));
+    sc.name = "table";
+    sc.read = table_read;
+    sc.ctx = &ts;
+    ESP_ERROR_CHECK(mixer_add_source(m, &sc, &a));
+    TEST_CHECK(mixer_mix(m, out, PERIOD) == 1);
+    TEST_CHECK(!memcmp(out, table, PERIOD * CHANNELS * sizeof(int16_t)));
+
+    /* half gain: the first period ramps down, never above the input, the next is exact */
+    ESP_ERROR_CHECK(mixer_set_gain(m, a, MIXER_GAIN_UNITY / 2));
+    mixer_mix(m, out, PERIOD);
+    ok = true;
+    for (int i = 0; i < PERIOD * CHANNELS; i++) {
+        ok &= abs(out[i]) <= abs(table[PERIOD * CHANNELS + i]);
+    }
+    TEST_CHECK(ok);
+    mixer_mix(m, out, PERIOD);
+    ok = true;
+    for (int i = 0; i < PERIOD * CHANNELS; i++) {
+        ok &= out[i] == table[i] * (MIXER_GAIN_UNITY / 2) >> 15;
+    }
+    TEST_CHECK(ok);
+    mixer_remove_source(m, a);
+    TEST_CHECK(mixer_mix(m, out, PERIOD) == 0);
+    ok = true;
+    for (int i = 0; i < PERIOD * CHANNELS; i++) {
+        ok &= out[i] == 0;
+    }
+    TEST_CHECK(ok);
+
+    /* two loud sources saturate the bus */
+    const_src_t c1 = { 30000, 0, 0, SIZE_MAX }, c2 = { 30000, 0, 0, SIZE_MAX };
+    sc.name = "loud";
+    sc.read = const_read;
+    sc.ctx = &c1;
+    ESP_ERROR_CHECK(mixer_add_source(m, &sc, &a));
+    sc.ctx = &c2;
+    ESP_ERROR_CHECK(mixer_add_source(m, &sc, &b));
+    mixer_get_stats(m, &st);
+    uint32_t clipped = st.clipped;
+    mixer_mix(m, out, 100);
+    TEST_CHECK(out[0] == 32767 && out[199] == 32767);
+    mixer_get_stats(m, &st);
+    TEST_CHECK(st.clipped - clipped == 200);
+    mixer_remove_source(m, a);
+    mixer_remove_source(m, b);
+
+    /* +6 dB against a limit of half scale */
+    const_src_t c3 = { 12000, 0, 0, SIZE_MAX };
+    sc.name = "limited";
+    sc.ctx = &c3;
+    sc.gain = MIXER_GAIN_MAX;
+    sc.limit = 16384;
+    ESP_ERROR_CHECK(mixer_add_source(m, &sc, &a));
+    mixer_mix(m, out, 100);
+    TEST_CHECK(out[0] == 16384);
+    mixer_get_stats(m, &st);
+    int slot = -1;
+    for (int i = 0; i < MIXER_SOURCES_MAX; i++) {
+        slot = st.sources[i].name && !strcmp(st.sources[i].name, "limited") ? i : slot;
+    }
+    TEST_CHECK(slot >= 0 && st.sources[slot].frames == 100 && st.sources[slot].clipped == 200);
+    mixer_remove_source(m, a);
+
+    sc.limit = 0;
+    TEST_CHECK(mixer_add_source(m, &sc, NULL) == ESP_ERR_INVALID_ARG);
+    sc.limit = MIXER_LIMIT_NONE;
+    sc.gain = MIXER_GAIN_MAX + 1;
+    TEST_CHECK(mixer_add_source(m, &sc, NULL) == ESP_ERR_INVALID_ARG);
+    mixer_delete(m);
+}
+
+/* a bed at 10000 ducked by 12 dB while an announcer plays frames 4800 to 9600 */
+static void check_ducking(void)
+{
+    static int16_t trace[20000 * CHANNELS];
+    const_src_t bed = { 10000, 0, 0, SIZE_MAX }, ann = { 0, 0, 4800, 9600 };
+    mixer_source_config_t bc = MIXER_SOURCE_CONFIG_DEFAULT(), ac = MIXER_SOURCE_CONFIG_DEFAULT();
+    mixer_t *m;
+
+    ESP_ERROR_CHECK(mixer_create(&s_config, &m));
+    bc.read = const_read;
+    bc.ctx = &bed;
+    bc.duck_gain = mixer_gain_from_db(-12);
+    ac.read = const_read;
+    ac.ctx = &ann;
+    ac.ducks = true;
+    ESP_ERROR_CHECK(mixer_add_source(m, &bc, NULL));
+    ESP_ERROR_CHECK(mixer_add_source(m, &ac, NULL));
+    for (int p = 0; p < 20000 / 400; p++) {
+        mixer_mix(m, trace + p * 400 * CHANNELS, 400);
+    }
+    mixer_delete(m);
+
+    /* unity to 0 takes 480 frames, the 0.75 drop 360; 0.75 back up takes 3600 of 4800 */
+    int target = 10000 * mixer_gain_from_db(-12) >> 15;
+    TEST_CHECK(trace[0] == 10000 && trace[4799 * CHANNELS] == 10000);
+    TEST_CHECK(trace[4900 * CHANNELS] < 10000 && trace[4900 * CHANNELS] > target);
+    TEST_CHECK(abs(trace[5200 * CHANNELS] - target) <= 2);
+    TEST_CHECK(abs(trace[9599 * CHANNELS] - target) <= 2);
+    TEST_CHECK(trace[11400 * CHANNELS] > target + 100 && trace[11400 * CHANNELS] < 9900);
+    TEST_CHECK(abs(trace[13600 * CHANNELS] - 10000) <= 1);
+    int step = 0;
+    for (int i = 1; i < 20000; i++) {
+        int d = abs(trace[i * CHANNELS] - trace[(i - 1) * CHANNELS]);
+        step = d > step ? d : step;
+    }
+    printf("ducking: bed 10000 to %d, largest step between frames %d\n", target, step);
+    TEST_CHECK(step <= 10000 / 480 + 2);
+}
+
+static void check_tone(void)
+{
+    static int16_t t[RATE * CHANNELS];
+    mixer_tone_t tone;
+    int crossings = 0, peak = 0;
+    double err = 0;
+
+    mixer_tone_init(&tone, RATE, CHANNELS, 1000, 16384);
+    for (int i = 0; i < RATE; i += 128) {
+        mixer_tone_read(&tone, t + i * CHANNELS, 128);
+    }
+    bool same = true;
+    for (int i = 1; i < RATE; i++) {
+        int16_t v = t[i * CHANNELS];
+        crossings += t[(i - 1) * CHANNELS] < 0 && v >= 0;
+        peak = abs(v) > peak ? abs(v) : peak;
+        same &= v == t[i * CHANNELS + 1];
+        double e = v - 16384 * 32767.0 / 32768 * sin(2 * M_PI * 1000 * i / RATE);
+        err += e * e;
+    }
+    printf("tone: 1000 Hz gives %d rising zero crossings in 1 s, peak %d, rms error %.2f LSB\n", crossings, peak,
+           sqrt(err / RATE));
+    TEST_CHECK(same);
+    TEST_CHECK(crossings == 999 || crossings == 1000);
+    TEST_CHECK(peak >= 16380 && peak <= 16384);
+}
+
+/* the player against prompt_read() into the resampler, the loop it replaced */
+static void check_prompt(const prompt_t *pr)
+{
+    const uint32_t rates[] = { pr->sample_rate, 48000, 44100, 8000 };
+
+    for (int r = 0; r < 4; r++) {
+        size_t cap = (size_t)pr->samples * rates[r] / pr->sample_rate + 64, rn = 0;
+        int16_t *ref = calloc(cap, sizeof(int16_t)), dec[1024];
+        prompt_reader_t rd;
+
+        prompt_reader_init(&rd, pr);
+        if (rates[r] == pr->sample_rate) {
+            rn = prompt_read(&rd, ref, cap);
+        } else {
+            resampler_t *rs;
+            ESP_ERROR_CHECK(resampler_create(pr->sample_rate, rates[r], &rs));
+            for (size_t len; (len = prompt_read(&rd, dec, 1024));) {
+                for (size_t p = 0; p < len;) {
+                    size_t in_len = len - p;
+                    rn += resampler_process(rs, dec + p, &in_len, ref + rn, cap - rn);
+                    p += in_len;
+                }
+            }
+            resampler_delete(rs);
+        }
+
+        for (uint32_t ch = 1; ch <= 8; ch *= 2) {
+            mixer_prompt_config_t pc = { pr, rates[r], ch, false, 0 };
+            int16_t *got = calloc(cap * ch + MIXER_BLOCK_SAMPLES, sizeof(int16_t));
+            size_t block = MIXER_BLOCK_SAMPLES / ch, gn = 0, n;
+            mixer_prompt_t *pl;
+
+            ESP_ERROR_CHECK(mixer_prompt_create(&pc, &pl));
+            do {
+                n = mixer_prompt_read(pl, got + gn * ch, block);
+                gn += n;
+            } while (n == block);
+            TEST_CHECK(mixer_prompt_read(pl, got, 16) == 0);
+            bool same = gn == rn;
+            for (size_t i = 0; same && i < rn * ch; i++) {
+                same = got[i] == ref[i / ch];
+            }
+            if (!same) {
+                printf("prompt player at %u Hz, %u channels: %zu frames, %zu by hand\n", rates[r], ch, gn, rn);
+            }
+            TEST_CHECK(same);
+            mixer_prompt_delete(pl);
+            free(got);
+        }
+        free(ref);
+    }
+
+    /* looping with a 1 s gap */
+    mixer_prompt_config_t pc = { pr, RATE, CHANNELS, true, 1000 };
+    mixer_prompt_t *pl;
+    int16_t buf[128 * CHANNELS];
+    size_t t = 0, silent = 0, restart = 0;
+    ESP_ERROR_CHECK(mixer_prompt_create(&pc, &pl));
+    while (t < RATE * 10 && !restart) {
+        size_t n = mixer_prompt_read(pl, buf, 128);
+        silent += n ? 0 : 128;
+        restart = n && silent ? t : 0;
+        t += 128;
+    }
+    mixer_prompt_delete(pl);
+    size_t played = (uint64_t)pr->samples * RATE / pr->sample_rate;
+    printf("prompt player: %zu frames at %d Hz, loops again at frame %zu\n", played, RATE, restart);
+    TEST_CHECK(restart >= played + RATE - 128 && restart <= played + RATE + 128);
+}
+
+int main(int argc, char **argv)
+{
+    static int16_t tables[MIXER_SOURCES_MAX][TABLE_FRAMES * CHANNELS];
+    size_t wav_len;
+    uint8_t *wav = argc > 1 ? load(argv[1], &wav_len) : NULL;
+
+    if (!wav) {
+        printf("usage: mixer_test PROMPT.wav\n");
+        return 2;
+    }
+    srand(1);
+    for (int s = 0; s < MIXER_SOURCES_MAX; s++) {
+        for (int i = 0; i < TABLE_FRAMES * CHANNELS; i++) {
+            tables[s][i] = rand() - RAND_MAX / 2;
+        }
+    }
+    ESP_ERROR_CHECK(prompt_store_add("default", wav, wav_len));
+
+    check_gain_and_clipping(tables[0]);
+    check_ducking();
+    check_tone();
+    check_prompt(prompt_store_find("default"));
+
+    static const char *modes[] = { "unity", "gain -6 dB", "+3 dB with limit", "1 ducks, rest ramp", "tone sources" };
+    static double t[RUNS];
+    int16_t out[PERIOD * CHANNELS];
+    printf("\nmix time of one 10 ms period, %d Hz stereo, ns, 10th percentile of %d\n%-20s", RATE, RUNS, "sources");
+    for (int n = 1; n <= MIXER_SOURCES_MAX; n++) {
+        printf(" %6d", n);
+    }
+    printf("\n");
+    for (int mode = 0; mode < 5; mode++) {
+        printf("%-20s", modes[mode]);
+        for (int n = 1; n <= MIXER_SOURCES_MAX; n++) {
+            table_src_t ts[MIXER_SOURCES_MAX];
+            mixer_tone_t tones[MIXER_SOURCES_MAX];
+            size_t toggle = 0;
+            mixer_t *m;
+
+            ESP_ERROR_CHECK(mixer_create(&s_config, &m));
+            for (int s = 0; s < n; s++) {
+                mixer_source_config_t c = MIXER_SOURCE_CONFIG_DEFAULT();
+                ts[s] = (table_src_t) { tables[s], 0 };
+                c.read = table_read;
+                c.ctx = &ts[s];
+                if (mode == 1) {
+                    c.gain = mixer_gain_from_db(-6);
+                } else if (mode == 2) {
+                    c.gain = mixer_gain_from_db(3);
+                    c.limit = 24000;
+                } else if (mode == 3) {
+                    /* 30 ms on, 30 ms off: with a 100 ms release the others ramp most of the time */
+                    c.duck_gain = mixer_gain_from_db(-12);
+                    if (s == 0) {
+                        c.read = toggle_read;
+                        c.ctx = &toggle;
+                        c.ducks = true;
+                    }
+                } else if (mode == 4) {
+                    mixer_tone_init(&tones[s], RATE, CHANNELS, 300 + 100 * s, 4000);
+                    c.read = mixer_tone_read;
+                    c.ctx = &tones[s];
+                }
+                ESP_ERROR_CHECK(mixer_add_source(m, &c, NULL));
+            }
+            for (int i = -100; i < RUNS; i++) {
+                uint64_t t0 = test_now_ns();
+                mixer_mix(m, out, PERIOD);
+                if (i >= 0) {
+                    t[i] = test_now_ns() - t0;
+                }
+            }
+            printf(" %6.0f", test_percentile(t, RUNS, 10));
+            mixer_delete(m);
+        }
+        printf("\n");
+    }
+    free(wav);
+    return test_exit_code("mixer_test");
+}
@@ -0,0 +1,254 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * pcm_convert.c: word at a time kernels against their references
+ *
+ * Every kernel runs next to its *_ref version on the same random input, at
+ * each length from 0 to 39 samples, on word aligned buffers and on buffers
+ * two bytes off, with dither and without where the kernel takes it. The
+ * outputs, with what lies past their end, must be the same byte for byte.
+ * Then both run on 4096 samples, best of 300.
+ *
+ * Checks:
+ * - every kernel matches its reference
+ * - s16 mono to each of the 16 layouts of 8 to 32 bits, mono or stereo,
+ *   signed or unsigned, and back gives the input, 8-bit the input with its
+ *   low byte cleared
+ * - a constant input between two 8-bit codes comes back with its mean when
+ *   dithered, and on the lower code when truncated
+ *
+ * Reports Msamples/s of the reference and the word at a time kernel, and
+ * Mframes/s of pcm_convert() for what the speaker path does.
+ *
+ * The Makefile builds it with -fno-tree-vectorize, so the host compiler
+ * does not vectorise the references the way no target compiler would.
+ *
+ * Usage: pcm_convert_bench [passes of each timing, default 300]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include "pcm_convert.h"
+#include "host_test.h"
+
+#define BENCH_SAMPLES   4096
+#define CHECK_SAMPLES   40
+#define MULTI_CH        6
+#define BUF_SIZE        (BENCH_SAMPLES * MULTI_CH * 4 + 64)
+
+typedef void (*kernel_fn)(const uint8_t *in, uint8_t *out, size_t n, pcm_dither_t *dither);
+
+/* the kernels under one signature; flip_sign works in place, so it copies its input to out first */
+#define KERNEL(name, call) \
+    static void name(const uint8_t *in, uint8_t *out, size_t n, pcm_dither_t *dither) { (void)dither; call; }
+
+KERNEL(decode_8_ref, pcm_decode_8_ref(in, (int16_t *)out, n, false))
+KERNEL(decode_8, pcm_decode_8(in, (int16_t *)out, n, false))
+KERNEL(decode_24_ref, pcm_decode_24_ref(in, (int16_t *)out, n, dither))
+KERNEL(decode_24, pcm_decode_24(in, (int16_t *)out, n, dither))
+KERNEL(decode_32_ref, pcm_decode_32_ref((const int32_t *)in, (int16_t *)out, n, dither))
+KERNEL(decode_32, pcm_decode_32((const int32_t *)in, (int16_t *)out, n, dither))
+KERNEL(encode_8_ref, pcm_encode_8_ref((const int16_t *)in, out, n, true, dither))
+KERNEL(encode_8, pcm_encode_8((const int16_t *)in, out, n, true, dither))
+KERNEL(encode_24_ref, pcm_encode_24_ref((const int16_t *)in, out, n))
+KERNEL(encode_24, pcm_encode_24((const int16_t *)in, out, n))
+KERNEL(encode_32_ref, pcm_encode_32_ref((const int16_t *)in, (int32_t *)out, n))
+KERNEL(encode_32, pcm_encode_32((const int16_t *)in, (int32_t *)out, n))
+KERNEL(mono_to_stereo_ref, pcm_mono_to_stereo_ref((const int16_t *)in, (int16_t *)out, n))
+KERNEL(mono_to_stereo, pcm_mono_to_stereo((const int16_t *)in, (int16_t *)out, n))
+KERNEL(stereo_to_mono_ref, pcm_stereo_to_mono_ref((const int16_t *)in, (int16_t *)out, n))
+KERNEL(stereo_to_mono, pcm_stereo_to_mono((const int16_t *)in, (int16_t *)out, n))
+KERNEL(mono_to_multi_ref, pcm_mono_to_multi_ref((const int16_t *)in, (int16_t *)out, MULTI_CH, n))
+KERNEL(mono_to_multi, pcm_mono_to_multi((const int16_t *)in, (int16_t *)out, MULTI_CH, n))
+KERNEL(multi_to_mono_ref, pcm_multi_to_mono_ref((const int16_t *)in, (int16_t *)out, MULTI_CH, n))
+KERNEL(multi_to_mono, pcm_multi_to_mono((const int16_t *)in, (int16_t *)out, MULTI_CH, n))
+/* stereo onto three speaker pairs, then onto 5.1 with centre and LFE from the mix */
+static const uint8_t s_pairs[MULTI_CH] = { 0, 1, 0, 1, 0, 1 };
+static const uint8_t s_mix[MULTI_CH] = { 0, 1, PCM_CHANNEL_MIX, PCM_CHANNEL_MIX, 0, 1 };
+KERNEL(remap_pairs_ref, pcm_remap_ref((const int16_t *)in, 2, (int16_t *)out, MULTI_CH, s_pairs, n))
+KERNEL(remap_pairs, pcm_remap((const int16_t *)in, 2, (int16_t *)out, MULTI_CH, s_pairs, n))
+KERNEL(remap_mix_ref, pcm_remap_ref((const int16_t *)in, 2, (int16_t *)out, MULTI_CH, s_mix, n))
+KERNEL(remap_mix, pcm_remap((const int16_t *)in, 2, (int16_t *)out, MULTI_CH, s_mix, n))
+KERNEL(flip_sign_8_ref, (memcpy(out, in, n), pcm_flip_sign_ref(out, 8, n)))
+KERNEL(flip_sign_8, (memcpy(out, in, n), pcm_flip_sign(out, 8, n)))
+KERNEL(flip_sign_16_ref, (memcpy(out, in, n * 2), pcm_flip_sign_ref(out, 16, n)))
+KERNEL(flip_sign_16, (memcpy(out, in, n * 2), pcm_flip_sign(out, 16, n)))
+KERNEL(flip_sign_24_ref, (memcpy(out, in, n * 3), pcm_flip_sign_ref(out, 24, n)))
+KERNEL(flip_sign_24, (memcpy(out, in, n * 3), pcm_flip_sign(out, 24, n)))
+KERNEL(flip_sign_32_ref, (memcpy(out, in, n * 4), pcm_flip_sign_ref(out, 32, n)))
+KERNEL(flip_sign_32, (memcpy(out, in, n * 4), pcm_flip_sign(out, 32, n)))
+
+static const struct {
+    const char *name;
+    kernel_fn ref;
+    kernel_fn fast;
+    bool dither;
+} s_kernels[] = {
+    { "decode_8", decode_8_ref, decode_8, false },
+    { "decode_24", decode_24_ref, decode_24, false },
+    { "decode_24", decode_24_ref, decode_24, true },
+    { "decode_32", decode_32_ref, decode_32, false },
+    { "decode_32", decode_32_ref, decode_32, true },
+    { "encode_8", encode_8_ref, encode_8, false },
+    { "encode_8", encode_8_ref, encode_8, true },
+    { "encode_24", encode_24_ref, encode_24, false },
+    { "encode_32", encode_32_ref, encode_32, false },
+    { "mono_to_stereo", mono_to_stereo_ref, mono_to_stereo, false },
+    { "stereo_to_mono", stereo_to_mono_ref, stereo_to_mono, false },
+    { "mono_to_multi 6", mono_to_multi_ref, mono_to_multi, false },
+    { "multi_to_mono 6", multi_to_mono_ref, multi_to_mono, false },
+    { "remap 2 to 6", remap_pairs_ref, remap_pairs, false },
+    { "remap 2 to 6 mix", remap_mix_ref, remap_mix, false },
+    { "flip_sign_8", flip_sign_8_ref, flip_sign_8, false },
+    { "flip_sign_16", flip_sign_16_ref, flip_sign_16, false },
+    { "flip_sign_24", flip_sign_24_ref, flip_sign_24, false },
+    { "flip_sign_32", flip_sign_32_ref, flip_sign_32, false },
+};
+
+static uint8_t s_in[BUF_SIZE] __attribute__((aligned(16)));
+static uint8_t s_a[BUF_SIZE] __attribute__((aligned(16)));
+static uint8_t s_b[BUF_SIZE] __attribute__((aligned(16)));
+
+/* true when the kernel and its reference leave the same bytes at every length and offset */
+static bool same_output(kernel_fn ref, kernel_fn fast, bool dither)
+{
+    for (size_t off = 0; off < 4; off += 2) {
+        for (size_t n = 0; n < CHECK_SAMPLES; n++) {
+            pcm_dither_t da, db;
+            pcm_dither_init(&da, 7);
+            pcm_dither_init(&db, 7);
+            memset(s_a, 0x55, sizeof(s_a));
+            memset(s_b, 0x55, sizeof(s_b));
+            ref(s_in + off, s_a + off, n, dither ? &da : NULL);
+            fast(s_in + off, s_b + off, n, dither ? &db : NULL);
+            if (memcmp(s_a, s_b, sizeof(s_a))) {
+                printf("  differs at %zu samples, %zu bytes off\n", n, off);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/* Msamples/s, best of passes */
+static double rate(kernel_fn fn, bool dither, int passes)
+{
+    pcm_dither_t d;
+    uint64_t best = UINT64_MAX;
+
+    pcm_dither_init(&d, 7);
+    for (int p = 0; p < passes; p++) {
+        uint64_t t0 = test_now_ns();
+        fn(s_in, s_a, BENCH_SAMPLES, dither ? &d : NULL);
+        uint64_t t = test_now_ns() - t0;
+        best = t < best ? t : best;
+    }
+    return BENCH_SAMPLES * 1e3 / best;
+}
+
+/* s16 mono to fmt and back, samples that do not come back as expected */
+static size_t round_trip(const pcm_format_t *fmt)
+{
+    static const pcm_format_t s16 = { 16, 1, false };
+    static int16_t src[1001], back[1001];
+    static uint8_t mid[1001 * 8];
+    size_t bad = 0;
+
+    for (size_t i = 0; i < 1001; i++) {
+        src[i] = rand();
+    }
+    ESP_ERROR_CHECK(pcm_convert(src, &s16, mid, fmt, 1001, NULL));
+    ESP_ERROR_CHECK(pcm_convert(mid, fmt, back, &s16, 1001, NULL));
+    for (size_t i = 0; i < 1001; i++) {
+        int16_t expect = fmt->bits == 8 ? (int16_t)(src[i] & 0xff00) : src[i];
+        bad += back[i] != expect;
+    }
+    return bad;
+}
+
+/* Mframes/s of s16 mono to fmt, best of passes */
+static double convert_rate(const pcm_format_t *fmt, pcm_dither_t *dither, int passes)
+{
+    static const pcm_format_t s16 = { 16, 1, false };
+    uint64_t best = UINT64_MAX;
+
+    for (int p = 0; p < passes; p++) {
+        uint64_t t0 = test_now_ns();
+        ESP_ERROR_CHECK(pcm_convert(s_in, &s16, s_a, fmt, BENCH_SAMPLES, dither));
+        uint64_t t = test_now_ns() - t0;
+        best = t < best ? t : best;
+    }
+    return BENCH_SAMPLES * 1e3 / best;
+}
+
+int main(int argc, char **argv)
+{
+    int passes = argc > 1 ? atoi(argv[1]) : 300;
+    static const uint32_t bits[] = { 8, 16, 24, 32 };
+
+    srand(3);
+    for (size_t i = 0; i < sizeof(s_in); i++) {
+        s_in[i] = rand();
+    }
+
+    printf("%d samples, best of %d, Msamples/s\n", BENCH_SAMPLES, passes);
+    printf("%-24s %8s %8s %8s %s\n", "kernel", "ref", "word", "speedup", "same output");
+    for (size_t k = 0; k < sizeof(s_kernels) / sizeof(s_kernels[0]); k++) {
+        bool same = same_output(s_kernels[k].ref, s_kernels[k].fast, s_kernels[k].dither);
+        double ref = rate(s_kernels[k].ref, s_kernels[k].dither, passes);
+        double fast = rate(s_kernels[k].fast, s_kernels[k].dither, passes);
+        printf("%-16s %-7s %8.0f %8.0f %7.1fx %s\n", s_kernels[k].name, s_kernels[k].dither ? "dither" : "",
+               ref, fast, fast / ref, same ? "yes" : "NO");
+        TEST_CHECK(same);
+    }
+
+    for (size_t b = 0; b < sizeof(bits) / sizeof(bits[0]); b++) {
+        for (uint32_t ch = 1; ch <= 2; ch++) {
+            for (int u = 0; u < 2; u++) {
+                pcm_format_t fmt = { bits[b], ch, u };
+                size_t bad = round_trip(&fmt);
+                if (bad) {
+                    printf("round trip through %s%u %s: %zu samples differ\n", u ? "u" : "s", bits[b],
+                           ch == 1 ? "mono" : "stereo", bad);
+                }
+                TEST_CHECK(bad == 0);
+            }
+        }
+    }
+    printf("\nround trips through the 16 layouts done\n");
+
+    /* constant input between two 8-bit codes, 10 * 256 + offset */
+    static int16_t x[100000], y[100000];
+    static uint8_t q[100000];
+    const pcm_format_t s16 = { 16, 1, false }, s8 = { 8, 1, false };
+    pcm_dither_t d;
+    pcm_dither_init(&d, 1);
+    for (int v = 0; v < 256; v += 64) {
+        for (int i = 0; i < 100000; i++) {
+            x[i] = 10 * 256 + v;
+        }
+        ESP_ERROR_CHECK(pcm_convert(x, &s16, q, &s8, 100000, &d));
+        ESP_ERROR_CHECK(pcm_convert(q, &s8, y, &s16, 100000, NULL));
+        double mean = 0;
+        for (int i = 0; i < 100000; i++) {
+            mean += y[i] - 10 * 256;
+        }
+        mean /= 100000;
+        ESP_ERROR_CHECK(pcm_convert(x, &s16, q, &s8, 1, NULL));
+        int truncated = (int8_t)q[0] * 256 - 10 * 256;
+        printf("input +%3d LSB16: dithered mean %+7.2f, truncated %+d\n", v, mean, truncated);
+        TEST_CHECK(mean > v - 2 && mean < v + 2);
+        TEST_CHECK(truncated == 0);
+    }
+
+    const pcm_format_t s24_stereo = { 24, 2, false }, u8_stereo = { 8, 2, true };
+    printf("\npcm_convert from s16 mono: %.0f Mframes/s to s24 stereo, %.0f Mframes/s to u8 stereo dithered\n",
+           convert_rate(&s24_stereo, &d, passes), convert_rate(&u8_stereo, &d, passes));
+    return test_exit_code("pcm_convert_bench");
+}
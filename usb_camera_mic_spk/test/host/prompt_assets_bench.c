@@ -0,0 +1,307 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Prompts mapped from the assets partition: time to first sample
+ *
+ * An assets image of 32 prompts is built from a prompt WAV file in the
+ * layout of prompt_assets.h: 31 copies of it, clip0 to clip30, and "long",
+ * its blocks five times over. The image is written to a file of the size
+ * of the assets partition, which stubs/esp_partition_host.c maps as flash.
+ *
+ * Checks:
+ * - prompt_assets_load() adds the 32 prompts, each decoding through
+ *   prompt_read() in uneven pieces to the samples of the WAV file
+ * - an erased partition, an image of another version and one larger than
+ *   its partition are turned down, as is an index that does not fit
+ * - entries with an unterminated name, out of the image or not a WAV
+ *   file are skipped and the others added
+ *
+ * Reports the median and p99 time from nothing to the first sample of
+ * clip30 and of long, three ways:
+ * - play: the image was mapped at boot, find the prompt and decode
+ * - boot mmap: map the image, add its prompts, then play
+ * - boot copy: read the index and the clip into RAM, add it, then play,
+ *   as it would be without the mapping
+ * Boot runs with the file in the page cache and, cold, after dropping it.
+ *
+ * prompt_store.c is #included to empty the store between runs.
+ *
+ * Usage: prompt_assets_bench PROMPT.wav DIR [runs of each timing, default 2000]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "esp_partition_host.h"
+#include "prompt_store.c"
+#include "prompt_assets.h"
+#include "adpcm.h"
+#include "host_test.h"
+
+#define PART_SIZE       0x1F0000        /* the assets partition of partitions.csv */
+#define CLIPS           31
+#define LONG_COPIES     5
+#define IMAGE_MAX       (PART_SIZE)
+
+static uint8_t s_image[IMAGE_MAX];
+
+static uint8_t *load(const char *path, size_t *len)
+{
+    FILE *f = fopen(path, "rb");
+    uint8_t *buf = NULL;
+
+    if (f && fseek(f, 0, SEEK_END) == 0) {
+        *len = ftell(f);
+        rewind(f);
+        buf = malloc(*len);
+        if (fread(buf, 1, *len, f) != *len) {
+            free(buf);
+            buf = NULL;
+        }
+    }
+    if (f) {
+        fclose(f);
+    }
+    return buf;
+}
+
+static void put32(uint8_t *p, uint32_t v)
+{
+    memcpy(p, &v, 4);
+}
+
+/* the chunk of a WAV file with the given id, NULL if there is none */
+static uint8_t *chunk(uint8_t *wav, size_t len, const char *id)
+{
+    for (size_t i = 12; i + 8 <= len;) {
+        uint32_t size;
+        memcpy(&size, wav + i + 4, 4);
+        if (!memcmp(wav + i, id, 4)) {
+            return wav + i;
+        }
+        i += 8 + size + (size & 1);
+    }
+    return NULL;
+}
+
+/* the image of mkassets.py: header, index, files on 4 byte boundaries */
+static size_t build_image(const uint8_t *wav, size_t wav_len, const uint8_t *lng, size_t lng_len)
+{
+    size_t offset = sizeof(prompt_assets_header_t) + (CLIPS + 1) * sizeof(prompt_assets_entry_t);
+
+    memset(s_image, 0, sizeof(s_image));
+    for (int i = 0; i <= CLIPS; i++) {
+        prompt_assets_entry_t e = { 0 };
+        offset = (offset + 3) & ~3;
+        snprintf(e.name, sizeof(e.name), i < CLIPS ? "clip%d" : "long", i);
+        e.offset = offset;
+        e.length = i < CLIPS ? wav_len : lng_len;
+        memcpy(s_image + offset, i < CLIPS ? wav : lng, e.length);
+        memcpy(s_image + sizeof(prompt_assets_header_t) + i * sizeof(e), &e, sizeof(e));
+        offset += e.length;
+    }
+    prompt_assets_header_t h = { PROMPT_ASSETS_MAGIC, PROMPT_ASSETS_VERSION, CLIPS + 1, offset, 0 };
+    memcpy(s_image, &h, sizeof(h));
+    return offset;
+}
+
+/* a partition file holding len bytes of image, erased past them */
+static void write_partition(const char *path, const uint8_t *image, size_t len)
+{
+    uint8_t *buf = malloc(PART_SIZE);
+    FILE *f = fopen(path, "wb");
+
+    memset(buf, 0xFF, PART_SIZE);
+    if (len) {
+        memcpy(buf, image, len);
+    }
+    TEST_CHECK(f && fwrite(buf, 1, PART_SIZE, f) == PART_SIZE);
+    if (f) {
+        fclose(f);
+    }
+    free(buf);
+}
+
+static void drop_cache(const char *path)
+{
+    int fd = open(path, O_RDONLY);
+
+    if (fd >= 0) {
+        posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        close(fd);
+    }
+}
+
+static void reset(void)
+{
+    s_count = 0;
+    esp_partition_host_unmap_all();
+}
+
+/* what boot would do without the mapping: read the index and the clip into RAM */
+static const prompt_t *load_copy(const char *label, const char *name, uint8_t **ram)
+{
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+    prompt_assets_header_t h;
+    static prompt_assets_entry_t index[PROMPT_STORE_MAX];
+
+    ESP_ERROR_CHECK(esp_partition_read(part, 0, &h, sizeof(h)));
+    ESP_ERROR_CHECK(esp_partition_read(part, sizeof(h), index, h.count * sizeof(index[0])));
+    for (size_t i = 0; i < h.count; i++) {
+        if (!strcmp(index[i].name, name)) {
+            *ram = malloc(index[i].length);
+            ESP_ERROR_CHECK(esp_partition_read(part, index[i].offset, *ram, index[i].length));
+            ESP_ERROR_CHECK(prompt_store_add(name, *ram, index[i].length));
+            return prompt_store_find(name);
+        }
+    }
+    return NULL;
+}
+
+int main(int argc, char **argv)
+{
+    size_t wav_len, added;
+    uint8_t *wav = argc > 2 ? load(argv[1], &wav_len) : NULL;
+    int runs = argc > 3 ? atoi(argv[3]) : 2000;
+    char path[4][256];
+
+    if (!wav) {
+        printf("usage: prompt_assets_bench PROMPT.wav DIR [runs]\n");
+        return 2;
+    }
+    static const char *labels[] = { "assets", "erased", "version", "oversize" };
+    for (int i = 0; i < 4; i++) {
+        snprintf(path[i], sizeof(path[i]), "%s/prompt_assets_%s.img", argv[2], labels[i]);
+    }
+
+    /* the samples of every block of the WAV file, and "long" with them five times over */
+    ESP_ERROR_CHECK(prompt_store_add("wav", wav, wav_len));
+    prompt_t p = *prompt_store_find("wav");
+    size_t blocks = (p.samples + p.block_samples - 1) / p.block_samples;
+    size_t data_len = blocks * p.block_align, head_len = p.data - wav;
+    int16_t *expect = malloc(blocks * p.block_samples * sizeof(int16_t));
+    for (size_t i = 0; i < blocks; i++) {
+        adpcm_decode_block(p.data + i * p.block_align, p.block_align, expect + i * p.block_samples);
+    }
+    size_t lng_len = head_len + LONG_COPIES * data_len;
+    uint32_t lng_samples = (LONG_COPIES - 1) * blocks * p.block_samples + p.samples;
+    uint8_t *lng = malloc(lng_len);
+    memcpy(lng, wav, head_len);
+    for (int c = 0; c < LONG_COPIES; c++) {
+        memcpy(lng + head_len + c * data_len, p.data, data_len);
+    }
+    put32(lng + 4, lng_len - 8);
+    put32(lng + head_len - 4, LONG_COPIES * data_len);
+    uint8_t *fact = chunk(lng, lng_len, "fact");
+    TEST_CHECK(fact != NULL);
+    put32(fact + 8, lng_samples);
+    s_count = 0;
+
+    size_t image_len = build_image(wav, wav_len, lng, lng_len);
+    write_partition(path[0], s_image, image_len);
+    write_partition(path[1], NULL, 0);
+    s_image[4] = PROMPT_ASSETS_VERSION + 1;
+    write_partition(path[2], s_image, image_len);
+    s_image[4] = PROMPT_ASSETS_VERSION;
+    put32(s_image + 8, PART_SIZE + 1);
+    write_partition(path[3], s_image, image_len);
+    put32(s_image + 8, image_len);
+    for (int i = 0; i < 4; i++) {
+        ESP_ERROR_CHECK(esp_partition_host_add(labels[i], path[i]));
+    }
+    printf("image of %zu bytes: %d clips of %zu bytes and long of %zu bytes, %u samples\n", image_len, CLIPS,
+           wav_len, lng_len, lng_samples);
+
+    /* every prompt decodes from the mapping like the file does */
+    static int16_t out[LONG_COPIES * 70000];
+    int differ = 0;
+    TEST_CHECK(prompt_assets_load("assets", &added) == ESP_OK && added == CLIPS + 1);
+    for (size_t i = 0; i < prompt_store_count(); i++) {
+        const prompt_t *q = prompt_store_get(i);
+        bool is_long = !strcmp(q->name, "long");
+        prompt_reader_t r;
+        size_t got = 0, n;
+        prompt_reader_init(&r, q);
+        while ((n = prompt_read(&r, out + got, 1 + (got * 7 + i) % 997))) {
+            got += n;
+        }
+        differ += got != (is_long ? lng_samples : p.samples);
+        for (size_t k = 0; k < got; k++) {
+            differ += out[k] != expect[k % (blocks * p.block_samples)];
+        }
+    }
+    printf("%zu prompts mapped, %d samples differ\n", prompt_store_count(), differ);
+    TEST_CHECK(differ == 0);
+    reset();
+
+    /* damaged images and entries */
+    TEST_CHECK(prompt_assets_load("erased", &added) == ESP_ERR_NOT_FOUND && added == 0);
+    TEST_CHECK(prompt_assets_load("version", &added) == ESP_ERR_INVALID_VERSION);
+    TEST_CHECK(prompt_assets_load("oversize", &added) == ESP_ERR_INVALID_SIZE);
+    TEST_CHECK(prompt_assets_load("missing", &added) == ESP_ERR_NOT_FOUND);
+    TEST_CHECK(s_count == 0);
+    put32(s_image + 8, sizeof(prompt_assets_header_t) + CLIPS * sizeof(prompt_assets_entry_t));
+    TEST_CHECK(prompt_assets_add(s_image, image_len, &added) == ESP_ERR_INVALID_SIZE && s_count == 0);
+    put32(s_image + 8, image_len);
+    prompt_assets_entry_t *index = (prompt_assets_entry_t *)(s_image + sizeof(prompt_assets_header_t));
+    memset(index[0].name, 'x', sizeof(index[0].name));
+    index[1].length = image_len;
+    memcpy(s_image + index[2].offset, "JUNK", 4);
+    TEST_CHECK(prompt_assets_add(s_image, image_len, &added) == ESP_OK && added == CLIPS - 2);
+    TEST_CHECK(!prompt_store_find("clip1") && !prompt_store_find("clip2") && prompt_store_find("clip3"));
+    TEST_CHECK(prompt_store_find("long") && prompt_store_count() == CLIPS - 2);
+    reset();
+    printf("damaged images turned down, bad entries skipped\n");
+
+    /* time to first sample */
+    static const char *clips[] = { "clip30", "long" };
+    static const char *modes[] = { "play", "boot mmap", "boot copy" };
+    double *t = malloc(runs * sizeof(double));
+    printf("\n%-6s %-10s %-5s %10s %10s\n", "clip", "mode", "cache", "median us", "p99 us");
+    for (int c = 0; c < 2; c++) {
+        for (int mode = 0; mode < 3; mode++) {
+            for (int cold = 0; cold < (mode ? 2 : 1); cold++) {
+                for (int i = 0; i < runs; i++) {
+                    uint8_t *ram = NULL;
+                    const prompt_t *q;
+                    prompt_reader_t r;
+                    int16_t first = 0;
+
+                    reset();
+                    if (mode == 0) {
+                        prompt_assets_load("assets", NULL);
+                    }
+                    if (cold) {
+                        drop_cache(path[0]);
+                    }
+                    uint64_t t0 = test_now_ns();
+                    if (mode == 1) {
+                        prompt_assets_load("assets", NULL);
+                    }
+                    q = mode == 2 ? load_copy("assets", clips[c], &ram) : prompt_store_find(clips[c]);
+                    prompt_reader_init(&r, q);
+                    prompt_read(&r, &first, 1);
+                    t[i] = test_now_ns() - t0;
+                    TEST_CHECK(first == expect[0]);
+                    free(ram);
+                }
+                printf("%-6s %-10s %-5s %10.1f %10.1f\n", clips[c], modes[mode], cold ? "cold" : "warm",
+                       test_percentile(t, runs, 50) / 1e3, test_percentile(t, runs, 99) / 1e3);
+            }
+        }
+    }
+    reset();
+
+    free(t);
+    free(lng);
+    free(expect);
+    free(wav);
+    return test_exit_code("prompt_assets_bench");
+}
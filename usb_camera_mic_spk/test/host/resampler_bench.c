@@ -0,0 +1,158 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * resampler.c: quality and throughput from the 32 kHz prompt rate
+ *
+ * For each speaker rate a UAC speaker may negotiate, 2 s of a 0.9 full
+ * scale sine at 32 kHz go through the converter. A sine of the expected
+ * frequency is fitted to the output by least squares. What is left is
+ * noise and distortion, which gives the SINAD, and the fitted amplitude
+ * gives the passband gain. Tones above 0.35 of the lower rate are skipped.
+ *
+ * Then 3 s of noise are converted in one call and again in random pieces
+ * of input and output. The two outputs must be bit-identical, with
+ * in * out_rate / in_rate samples. Last, the throughput in ns per output
+ * sample and against real time.
+ *
+ * Fails on a SINAD below 75 dB, a gain off by more than 0.01 dB or a
+ * streaming difference.
+ *
+ * Usage: resampler_bench [passes of the throughput run, default 20]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include "resampler.h"
+#include "host_test.h"
+
+#define IN_RATE         32000
+#define AMPLITUDE       (0.9 * 32767)
+#define SETTLE          400     /* output samples skipped at each end, longer than the filter */
+
+static const uint32_t s_rates[] = { 8000, 11025, 16000, 22050, 24000, 44100, 48000, 96000 };
+static const double s_tones[] = { 100, 1000, 3000, 6000, 10000 };
+#define RATE_NUM (sizeof(s_rates) / sizeof(s_rates[0]))
+#define TONE_NUM (sizeof(s_tones) / sizeof(s_tones[0]))
+
+/* SINAD in dB of a tone through the converter, gain in dB */
+static double sinad(uint32_t out_rate, double f, double *gain_db)
+{
+    size_t n = IN_RATE * 2;
+    int16_t *in = malloc(n * sizeof(int16_t));
+    resampler_t *rs;
+
+    for (size_t i = 0; i < n; i++) {
+        in[i] = (int16_t)lrint(AMPLITUDE * sin(2 * M_PI * f * i / IN_RATE));
+    }
+    ESP_ERROR_CHECK(resampler_create(IN_RATE, out_rate, &rs));
+    size_t cap = resampler_out_len(rs, n), in_len = n;
+    int16_t *out = malloc(cap * sizeof(int16_t));
+    size_t m = resampler_process(rs, in, &in_len, out, cap);
+
+    /* least squares fit of A sin + B cos, the converter's delay shows as phase */
+    double ss = 0, cc = 0, sc = 0, ys = 0, yc = 0;
+    for (size_t i = SETTLE; i < m - SETTLE; i++) {
+        double s = sin(2 * M_PI * f * i / out_rate), c = cos(2 * M_PI * f * i / out_rate);
+        ss += s * s;
+        cc += c * c;
+        sc += s * c;
+        ys += out[i] * s;
+        yc += out[i] * c;
+    }
+    double det = ss * cc - sc * sc, a = (ys * cc - yc * sc) / det, b = (yc * ss - ys * sc) / det;
+    double signal = 0, noise = 0;
+    for (size_t i = SETTLE; i < m - SETTLE; i++) {
+        double fit = a * sin(2 * M_PI * f * i / out_rate) + b * cos(2 * M_PI * f * i / out_rate);
+        signal += fit * fit;
+        noise += (out[i] - fit) * (out[i] - fit);
+    }
+    *gain_db = 20 * log10(sqrt(a * a + b * b) / AMPLITUDE);
+
+    resampler_delete(rs);
+    free(in);
+    free(out);
+    return 10 * log10(signal / noise);
+}
+
+int main(int argc, char **argv)
+{
+    int passes = argc > 1 ? atoi(argv[1]) : 20;
+    size_t n = IN_RATE * 3;
+    int16_t *in = malloc(n * sizeof(int16_t));
+    double worst_gain = 0;
+
+    printf("SINAD in dB from %d Hz, 0.9 full scale\n%-6s", IN_RATE, "rate");
+    for (size_t t = 0; t < TONE_NUM; t++) {
+        printf(" %6.0f Hz", s_tones[t]);
+    }
+    printf("\n");
+    for (size_t r = 0; r < RATE_NUM; r++) {
+        uint32_t lower = s_rates[r] < IN_RATE ? s_rates[r] : IN_RATE;
+        printf("%-6u", s_rates[r]);
+        for (size_t t = 0; t < TONE_NUM; t++) {
+            if (s_tones[t] > 0.35 * lower) {
+                continue;
+            }
+            double gain, db = sinad(s_rates[r], s_tones[t], &gain);
+            printf(" %9.1f", db);
+            TEST_CHECK(db > 75);
+            if (fabs(gain) > fabs(worst_gain)) {
+                worst_gain = gain;
+            }
+        }
+        printf("\n");
+    }
+    printf("largest passband gain error %.4f dB\n\n", worst_gain);
+    TEST_CHECK(fabs(worst_gain) < 0.01);
+
+    srand(1);
+    for (size_t i = 0; i < n; i++) {
+        in[i] = rand();
+    }
+    printf("%-6s %9s %9s %7s %12s %9s\n", "rate", "out", "expected", "pieces", "ns/sample", "realtime");
+    for (size_t r = 0; r < RATE_NUM; r++) {
+        resampler_t *whole, *pieces;
+        ESP_ERROR_CHECK(resampler_create(IN_RATE, s_rates[r], &whole));
+        ESP_ERROR_CHECK(resampler_create(IN_RATE, s_rates[r], &pieces));
+        size_t cap = resampler_out_len(whole, n), in_len = n;
+        int16_t *a = malloc(cap * sizeof(int16_t)), *b = malloc(cap * sizeof(int16_t));
+        size_t ma = resampler_process(whole, in, &in_len, a, cap);
+
+        /* random input and output sizes, output room 0 included */
+        size_t used = 0, mb = 0;
+        while (used < n) {
+            size_t chunk_in = 1 + rand() % 700, chunk_out = rand() % 900;
+            chunk_in = chunk_in < n - used ? chunk_in : n - used;
+            chunk_out = chunk_out < cap - mb ? chunk_out : cap - mb;
+            mb += resampler_process(pieces, in + used, &chunk_in, b + mb, chunk_out);
+            used += chunk_in;
+        }
+        bool same = ma == mb && !memcmp(a, b, ma * sizeof(int16_t));
+        TEST_CHECK(same);
+        TEST_CHECK(ma == (uint64_t)n * s_rates[r] / IN_RATE);
+
+        resampler_reset(whole);
+        uint64_t t0 = test_now_ns(), total = 0;
+        for (int p = 0; p < passes; p++) {
+            in_len = n;
+            total += resampler_process(whole, in, &in_len, a, cap);
+        }
+        double ns = (double)(test_now_ns() - t0) / total;
+        printf("%-6u %9zu %9.1f %7s %12.1f %8.0fx\n", s_rates[r], ma, (double)n * s_rates[r] / IN_RATE,
+               same ? "equal" : "DIFFER", ns, 1e9 / ns / s_rates[r]);
+
+        free(a);
+        free(b);
+        resampler_delete(whole);
+        resampler_delete(pieces);
+    }
+    free(in);
+    return test_exit_code("resampler_bench");
+}
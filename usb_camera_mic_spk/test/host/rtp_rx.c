@@ -0,0 +1,418 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "rtp_jpeg.h"
+#include "jpeg_parse.h"
+#include "rtp_rx.h"
+
+#define RTP_HEADER_SIZE     12
+#define JPEG_HEADER_SIZE    8
+#define JPEG_TYPE_RESTART   64
+
+static uint8_t s_exp[512];
+static uint8_t s_log[256];
+
+static void gf_init(void)
+{
+    if (s_exp[0]) {
+        return;
+    }
+    unsigned x = 1;
+    for (int i = 0; i < 255; i++) {
+        s_exp[i] = s_exp[i + 255] = x;
+        s_log[x] = i;
+        x <<= 1;
+        if (x & 0x100) {
+            x ^= 0x11D;
+        }
+    }
+}
+
+static uint8_t gf_mul(uint8_t a, uint8_t b)
+{
+    return a && b ? s_exp[s_log[a] + s_log[b]] : 0;
+}
+
+static uint8_t gf_inv(uint8_t a)
+{
+    return s_exp[255 - s_log[a]];
+}
+
+static uint16_t be16(const uint8_t *p)
+{
+    return p[0] << 8 | p[1];
+}
+
+static uint32_t be32(const uint8_t *p)
+{
+    return (uint32_t)p[0] << 24 | p[1] << 16 | p[2] << 8 | p[3];
+}
+
+/* weight of media packet i in parity j */
+static uint8_t coef(int scheme, int m, int i, int j)
+{
+    if (scheme == RTP_FEC_XOR) {
+        return i % m == j;
+    }
+    return gf_inv((128 + j) ^ i);
+}
+
+/* dst ^= c * data over n bytes */
+static void mul_add(uint8_t *dst, const uint8_t *data, size_t n, uint8_t c)
+{
+    for (size_t i = 0; i < n; i++) {
+        dst[i] ^= gf_mul(c, data[i]);
+    }
+}
+
+void rtp_rx_reset(rtp_rx_frame_t *f)
+{
+    f->num = 0;
+    f->k = 0;
+    f->repaired = 0;
+}
+
+bool rtp_rx_add(rtp_rx_frame_t *f, const uint8_t *pkt, size_t len)
+{
+    if (len < RTP_HEADER_SIZE || len > RTP_RX_PACKET_MAX || (pkt[0] & 0xC0) != 0x80) {
+        return true;
+    }
+    int pt = pkt[1] & 0x7F;
+    if (pt != RTP_JPEG_PAYLOAD_TYPE && pt != RTP_FEC_PAYLOAD_TYPE) {
+        return true;
+    }
+    uint32_t timestamp = be32(pkt + 4);
+    if (f->num && timestamp != f->timestamp) {
+        return false;
+    }
+    if (f->num == RTP_RX_MAX_PACKETS) {
+        return true;
+    }
+    f->timestamp = timestamp;
+    if (pt == RTP_JPEG_PAYLOAD_TYPE) {
+        f->ssrc = be32(pkt + 8);
+    }
+    memcpy(f->pkt[f->num], pkt, len);
+    f->len[f->num++] = len;
+    return true;
+}
+
+/* solves the missing symbols from the parity symbols in place, false if they do not determine them */
+static bool solve(uint8_t *a, int rows, int cols, uint8_t **rhs, size_t symbol_len)
+{
+    for (int c = 0; c < cols; c++) {
+        int pivot = c;
+        while (pivot < rows && !a[pivot * cols + c]) {
+            pivot++;
+        }
+        if (pivot == rows) {
+            return false;
+        }
+        if (pivot != c) {
+            for (int x = 0; x < cols; x++) {
+                uint8_t t = a[c * cols + x];
+                a[c * cols + x] = a[pivot * cols + x];
+                a[pivot * cols + x] = t;
+            }
+            uint8_t *t = rhs[c];
+            rhs[c] = rhs[pivot];
+            rhs[pivot] = t;
+        }
+        uint8_t inv = gf_inv(a[c * cols + c]);
+        for (int x = 0; x < cols; x++) {
+            a[c * cols + x] = gf_mul(inv, a[c * cols + x]);
+        }
+        for (size_t n = 0; n < symbol_len; n++) {
+            rhs[c][n] = gf_mul(inv, rhs[c][n]);
+        }
+        for (int r = 0; r < rows; r++) {
+            uint8_t factor = a[r * cols + c];
+            if (r == c || !factor) {
+                continue;
+            }
+            mul_add(a + r * cols, a + c * cols, cols, factor);
+            mul_add(rhs[r], rhs[c], symbol_len, factor);
+        }
+    }
+    return true;
+}
+
+int rtp_rx_repair(rtp_rx_frame_t *f)
+{
+    const uint8_t *parity[256] = { NULL };
+    int m = 0, scheme = 0, k = 0;
+    size_t symbol_len = 0;
+    uint16_t base = 0;
+
+    gf_init();
+    for (int n = 0; n < f->num; n++) {
+        const uint8_t *p = f->pkt[n] + RTP_HEADER_SIZE;
+        if ((f->pkt[n][1] & 0x7F) != RTP_FEC_PAYLOAD_TYPE || f->len[n] < RTP_HEADER_SIZE + RTP_FEC_HEADER_SIZE
+                || f->len[n] < RTP_HEADER_SIZE + RTP_FEC_HEADER_SIZE + be16(p + 6) || p[4] >= p[3]) {
+            continue;
+        }
+        base = be16(p);
+        k = p[2];
+        m = p[3];
+        scheme = p[5];
+        symbol_len = be16(p + 6);
+        parity[p[4]] = p + RTP_FEC_HEADER_SIZE;
+    }
+    if (!k) {
+        /* no parity: the frame runs from the packet at fragment offset 0 to the marked one */
+        bool first = false, last = false;
+        uint16_t end = 0;
+        for (int n = 0; n < f->num; n++) {
+            const uint8_t *pkt = f->pkt[n];
+            if ((pkt[1] & 0x7F) != RTP_JPEG_PAYLOAD_TYPE || f->len[n] < RTP_HEADER_SIZE + JPEG_HEADER_SIZE) {
+                continue;
+            }
+            if (!(be32(pkt + RTP_HEADER_SIZE) & 0xFFFFFF)) {
+                base = be16(pkt + 2);
+                first = true;
+            }
+            if (pkt[1] & 0x80) {
+                end = be16(pkt + 2);
+                last = true;
+            }
+        }
+        if (first && last) {
+            k = (uint16_t)(end - base) + 1;
+        }
+    }
+    if (!k || k > RTP_FEC_MAX_MEDIA) {
+        return -1;
+    }
+
+    f->k = k;
+    memset(f->media, 0, sizeof(f->media));
+    for (int n = 0; n < f->num; n++) {
+        uint16_t i = be16(f->pkt[n] + 2) - base;
+        if ((f->pkt[n][1] & 0x7F) == RTP_JPEG_PAYLOAD_TYPE && i < k) {
+            f->media[i] = f->pkt[n];
+            f->media_len[i] = f->len[n];
+        }
+    }
+    int missing[RTP_FEC_MAX_MEDIA], e = 0;
+    for (int i = 0; i < k; i++) {
+        if (!f->media[i]) {
+            missing[e++] = i;
+        }
+    }
+    if (!e || !m || (scheme != RTP_FEC_XOR && scheme != RTP_FEC_RS) || f->num + e > RTP_RX_MAX_PACKETS) {
+        return e;
+    }
+
+    /* one equation per parity packet received: the missing symbols weighted as in parity j */
+    uint8_t *rhs[256], *a = calloc(m * e, 1), *buf = calloc(m, symbol_len);
+    int rows = 0;
+    bool ok = true;
+    for (int j = 0; j < m && ok; j++) {
+        if (!parity[j]) {
+            continue;
+        }
+        rhs[rows] = buf + rows * symbol_len;
+        memcpy(rhs[rows], parity[j], symbol_len);
+        for (int i = 0; i < k; i++) {
+            uint8_t c = coef(scheme, m, i, j);
+            if (!f->media[i] || !c) {
+                continue;
+            }
+            size_t payload_len = f->media_len[i] - RTP_HEADER_SIZE;
+            uint8_t length[2] = { payload_len >> 8, payload_len & 0xFF };
+            if (payload_len + 2 > symbol_len) {
+                ok = false;
+                break;
+            }
+            mul_add(rhs[rows], length, 2, c);
+            mul_add(rhs[rows] + 2, f->media[i] + RTP_HEADER_SIZE, payload_len, c);
+        }
+        for (int c = 0; c < e; c++) {
+            a[rows * e + c] = coef(scheme, m, missing[c], j);
+        }
+        rows++;
+    }
+    if (ok && solve(a, rows, e, rhs, symbol_len)) {
+        for (int c = 0; c < e; c++) {
+            int i = missing[c];
+            size_t payload_len = be16(rhs[c]);
+            if (payload_len + 2 > symbol_len || RTP_HEADER_SIZE + payload_len > RTP_RX_PACKET_MAX) {
+                break;
+            }
+            uint8_t *pkt = f->pkt[f->num];
+            uint16_t sequence = base + i;
+            pkt[0] = 0x80;
+            pkt[1] = (i == k - 1 ? 0x80 : 0) | RTP_JPEG_PAYLOAD_TYPE;
+            pkt[2] = sequence >> 8;
+            pkt[3] = sequence;
+            for (int b = 0; b < 4; b++) {
+                pkt[4 + b] = f->timestamp >> (24 - 8 * b);
+                pkt[8 + b] = f->ssrc >> (24 - 8 * b);
+            }
+            memcpy(pkt + RTP_HEADER_SIZE, rhs[c] + 2, payload_len);
+            f->len[f->num] = RTP_HEADER_SIZE + payload_len;
+            f->media[i] = pkt;
+            f->media_len[i] = f->len[f->num++];
+            f->repaired++;
+        }
+    }
+    free(a);
+    free(buf);
+    return e - f->repaired;
+}
+
+/* RFC 2435 headers of one packet */
+typedef struct {
+    uint32_t offset;
+    uint8_t type;
+    uint8_t width;              /* in 8 pixel units */
+    uint8_t height;
+    uint16_t restart_interval;
+    uint8_t precision;          /* bit t set when table t has 16-bit entries */
+    const uint8_t *qt;          /* luminance then chrominance table, first packet only */
+    const uint8_t *data;
+    size_t data_len;
+} jpeg_packet_t;
+
+static bool parse_packet(const uint8_t *pkt, size_t len, jpeg_packet_t *jp)
+{
+    const uint8_t *p = pkt + RTP_HEADER_SIZE, *end = pkt + len;
+
+    if (end - p < JPEG_HEADER_SIZE) {
+        return false;
+    }
+    jp->offset = be32(p) & 0xFFFFFF;
+    jp->type = p[4];
+    jp->width = p[6];
+    jp->height = p[7];
+    /* only tables in-band: Q below 128 would need the scaled tables of the RFC */
+    if ((jp->type & ~(JPEG_TYPE_RESTART | 1)) || p[5] != 255) {
+        return false;
+    }
+    p += JPEG_HEADER_SIZE;
+    jp->restart_interval = 0;
+    if (jp->type & JPEG_TYPE_RESTART) {
+        if (end - p < 4) {
+            return false;
+        }
+        jp->restart_interval = be16(p);
+        p += 4;
+    }
+    jp->qt = NULL;
+    if (!jp->offset) {
+        if (end - p < 4) {
+            return false;
+        }
+        jp->precision = p[1];
+        size_t qt_len = be16(p + 2);
+        p += 4;
+        if (qt_len != (jp->precision & 1 ? 128u : 64u) + (jp->precision & 2 ? 128u : 64u) || (size_t)(end - p) < qt_len) {
+            return false;
+        }
+        jp->qt = p;
+        p += qt_len;
+    }
+    jp->data = p;
+    jp->data_len = end - p;
+    return true;
+}
+
+typedef struct {
+    uint8_t *p;
+    uint8_t *end;
+} writer_t;
+
+static void put(writer_t *w, const void *data, size_t len)
+{
+    if (w->end - w->p < (ptrdiff_t)len) {
+        w->end = w->p = NULL;
+        return;
+    }
+    memcpy(w->p, data, len);
+    w->p += len;
+}
+
+static void put_marker(writer_t *w, uint8_t marker, size_t len)
+{
+    uint8_t head[4] = { 0xFF, marker, len >> 8, len & 0xFF };
+
+    put(w, head, marker == 0xD8 || marker == 0xD9 ? 2 : 4);
+}
+
+static void put_headers(writer_t *w, const jpeg_packet_t *jp)
+{
+    const uint8_t *qt = jp->qt;
+
+    put_marker(w, 0xD8, 0);
+    for (int t = 0; t < 2; t++) {
+        bool wide = jp->precision & (1 << t);
+        uint8_t pq_tq = wide << 4 | t;
+        put_marker(w, 0xDB, 3 + (wide ? 128 : 64));
+        put(w, &pq_tq, 1);
+        put(w, qt, wide ? 128 : 64);
+        qt += wide ? 128 : 64;
+    }
+    if (jp->restart_interval) {
+        uint8_t dri[2] = { jp->restart_interval >> 8, jp->restart_interval & 0xFF };
+        put_marker(w, 0xDD, 4);
+        put(w, dri, 2);
+    }
+
+    /* component 0 is luma, 2x1 for type 0 and 2x2 for type 1, with tables 0; chroma 1x1 with tables 1 */
+    uint16_t width = jp->width * 8, height = jp->height * 8;
+    uint8_t sof[15] = {
+        8, height >> 8, height & 0xFF, width >> 8, width & 0xFF, 3,
+        1, jp->type & 1 ? 0x22 : 0x21, 0, 2, 0x11, 1, 3, 0x11, 1,
+    };
+    put_marker(w, 0xC0, 2 + sizeof(sof));
+    put(w, sof, sizeof(sof));
+
+    for (int chroma = 0; chroma < 2; chroma++) {
+        for (int ac = 0; ac < 2; ac++) {
+            jpeg_huff_table_t table;
+            uint8_t tc_th = ac << 4 | chroma;
+            size_t count = 0;
+            jpeg_huff_std(&table, ac, chroma);
+            for (int i = 0; i < 16; i++) {
+                count += table.bits[i];
+            }
+            put_marker(w, 0xC4, 3 + 16 + count);
+            put(w, &tc_th, 1);
+            put(w, table.bits, 16);
+            put(w, table.vals, count);
+        }
+    }
+
+    static const uint8_t sos[10] = { 3, 1, 0x00, 2, 0x11, 3, 0x11, 0, 63, 0 };
+    put_marker(w, 0xDA, 2 + sizeof(sos));
+    put(w, sos, sizeof(sos));
+}
+
+size_t rtp_rx_jpeg(const rtp_rx_frame_t *f, uint8_t *out, size_t size)
+{
+    writer_t w = { .p = out, .end = out + size };
+    jpeg_packet_t first, jp;
+    uint32_t offset = 0;
+
+    if (!f->k || !f->media[0] || !parse_packet(f->media[0], f->media_len[0], &first) || !first.qt) {
+        return 0;
+    }
+    put_headers(&w, &first);
+    for (int i = 0; i < f->k; i++) {
+        /* every fragment of the frame, back to back, the marker on the last one only */
+        if (!f->media[i] || !parse_packet(f->media[i], f->media_len[i], &jp) || jp.offset != offset
+                || jp.type != first.type || jp.width != first.width || jp.height != first.height
+                || jp.restart_interval != first.restart_interval || !(f->media[i][1] & 0x80) != (i < f->k - 1)) {
+            return 0;
+        }
+        put(&w, jp.data, jp.data_len);
+        offset += jp.data_len;
+    }
+    put_marker(&w, 0xD9, 0);
+    return w.p ? (size_t)(w.p - out) : 0;
+}
@@ -0,0 +1,81 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * The receiving end of rtp_jpeg.c and rtp_fec.c, for the host programs
+ *
+ * Collects the media and parity packets of one frame in any order, repairs
+ * lost media packets from the parity as rtp_fec.h describes it, and rebuilds
+ * the JPEG from the RFC 2435 headers as a player does: quantization tables
+ * from the first packet, sampling from the type, the standard Huffman
+ * tables. It shares no code with the sender, so a mistake in the packet
+ * format on either side shows as a frame that does not rebuild.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "rtp_fec.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RTP_RX_PACKET_MAX   2048
+#define RTP_RX_MAX_PACKETS  (2 * RTP_FEC_MAX_MEDIA)
+
+/**
+ * @brief Packets of the frame being received
+ */
+typedef struct {
+    uint32_t timestamp;
+    uint32_t ssrc;              /*!< Of the media packets */
+    int num;                    /*!< Packets held, received and repaired */
+    uint8_t pkt[RTP_RX_MAX_PACKETS][RTP_RX_PACKET_MAX];
+    uint16_t len[RTP_RX_MAX_PACKETS];
+    /* filled in by rtp_rx_repair() */
+    int k;                      /*!< Media packets of the frame, 0 while unknown */
+    int repaired;               /*!< Media packets rebuilt from parity */
+    const uint8_t *media[RTP_FEC_MAX_MEDIA];    /*!< In sequence order, NULL if missing */
+    uint16_t media_len[RTP_FEC_MAX_MEDIA];
+} rtp_rx_frame_t;
+
+/**
+ * @brief Empty the frame for the next one.
+ */
+void rtp_rx_reset(rtp_rx_frame_t *f);
+
+/**
+ * @brief Add a media or parity packet.
+ *
+ * Packets that are not RTP or of an unknown payload type are ignored.
+ *
+ * @return false if the packet belongs to another frame and was not added
+ */
+bool rtp_rx_add(rtp_rx_frame_t *f, const uint8_t *pkt, size_t len);
+
+/**
+ * @brief Put the media packets in order and rebuild the missing ones the parity allows.
+ *
+ * The frame layout comes from a parity packet, or else from the first and
+ * the marked media packet.
+ *
+ * @return Media packets still missing, -1 if the layout is unknown
+ */
+int rtp_rx_repair(rtp_rx_frame_t *f);
+
+/**
+ * @brief Rebuild the JPEG of a frame rtp_rx_repair() completed.
+ *
+ * @return Length of the JPEG, 0 if the headers are inconsistent or it did not fit
+ */
+size_t rtp_rx_jpeg(const rtp_rx_frame_t *f, uint8_t *out, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
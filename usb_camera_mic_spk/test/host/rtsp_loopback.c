@@ -0,0 +1,385 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * RTSP session and RTP/JPEG delivery over loopback
+ *
+ * rtsp_server.c serves a 30 fps producer of camera-like 640x480 frames
+ * from test_jpeg.c, 4:2:2 and 4:2:0, with and without restart markers, to
+ * one client. The client goes through OPTIONS, DESCRIBE, SETUP and PLAY,
+ * receives the RTP packets on a UDP port of its own, and rebuilds every
+ * frame with rtp_rx.c as a player would.
+ *
+ * Checks:
+ * - the SDP announces payload type 26, and 127 when the build has FEC, with
+ *   a control URL under the Content-Base
+ * - SETUP over TCP gets 461, PLAY and TEARDOWN with a wrong session 454
+ * - every frame rebuilds into a JPEG whose tables, size and scan equal
+ *   those of the frame pushed with its timestamp
+ * - no packet is lost on loopback and nothing arrives after TEARDOWN
+ *
+ * With a loss percentage the client drops that share of the packets it
+ * receives, media and parity alike, at random. Built with CONFIG_RTP_FEC_RS
+ * it must then still rebuild 95 % of the frames from the parity.
+ *
+ * Reports frames received, complete, repaired and lost, packet loss from
+ * the sequence numbers, RFC 3550 interarrival jitter and the latency from
+ * capture to the last packet of a frame.
+ *
+ * Usage: rtsp_loopback [seconds, default 3] [loss %, default 0]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include "esp_timer.h"
+#include "sdkconfig.h"
+#include "frame_ring.h"
+#include "jpeg_parse.h"
+#include "rtp_jpeg.h"
+#include "rtsp_server.h"
+#include "host_test.h"
+#include "test_jpeg.h"
+#include "rtp_rx.h"
+
+#define FPS             30
+#define FRAME_MAX       CONFIG_CAMERA_FB_BUF_SIZE
+#define PUSH_MAX        4096
+#define LAT_MAX         4096
+#define RESP_MAX        2048
+
+#if CONFIG_RTP_FEC_XOR || CONFIG_RTP_FEC_RS
+#define FEC             1
+#else
+#define FEC             0
+#endif
+
+static const test_jpeg_config_t s_sources[] = {
+    { 640, 480, 2, 1, 0, TEST_JPEG_NOISE, 1 },
+    { 640, 480, 2, 2, 0, TEST_JPEG_NOISE, 2 },
+    { 640, 480, 2, 1, 40, TEST_JPEG_NOISE, 3 },
+    { 640, 480, 2, 2, 20, TEST_JPEG_NOISE, 4 },
+};
+#define SOURCE_NUM (sizeof(s_sources) / sizeof(s_sources[0]))
+
+static uint8_t s_frame[SOURCE_NUM][FRAME_MAX];
+static size_t s_frame_len[SOURCE_NUM];
+static uint32_t s_pushed_ts[PUSH_MAX];  /* RTP timestamp of push n, which sent source n % SOURCE_NUM */
+static atomic_int s_pushed;
+static atomic_bool s_stop;
+
+typedef struct {
+    bool started;
+    uint16_t first;
+    uint16_t last;
+    uint32_t received;
+} seq_track_t;
+
+typedef struct {
+    int fd;
+    double loss;
+    uint32_t rand;
+    seq_track_t media;
+    seq_track_t parity;
+    atomic_uint packets;
+    uint32_t dropped;
+    double jitter;              /* RFC 3550, in timestamp units */
+    int64_t last_transit;
+    uint32_t frames;
+    uint32_t complete;
+    uint32_t repaired;
+    uint32_t lost;
+    uint32_t bad;
+    uint32_t last_ts;
+    uint32_t arrival;           /* of the last packet of the frame, in timestamp units */
+    double latency_ms[LAT_MAX];
+    rtp_rx_frame_t frame;
+    uint8_t jpeg[FRAME_MAX];
+} receiver_t;
+
+static void *producer_thread(void *arg)
+{
+    uint64_t next = test_now_ns();
+
+    for (int n = 0; !atomic_load(&s_stop) && n < PUSH_MAX; n++) {
+        int64_t captured_us = esp_timer_get_time();
+        s_pushed_ts[n] = captured_us * (RTP_JPEG_CLOCK_RATE / 1000) / 1000;
+        atomic_store(&s_pushed, n + 1);
+        frame_ring_push(s_frame[n % SOURCE_NUM], s_frame_len[n % SOURCE_NUM], 640, 480, n, captured_us);
+        next += 1000000000ull / FPS;
+        struct timespec ts = { .tv_sec = next / 1000000000ull, .tv_nsec = next % 1000000000ull };
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+    }
+    return NULL;
+}
+
+/* the rebuilt frame must be the pushed one, headers aside */
+static bool frame_matches(const uint8_t *jpeg, size_t len, uint32_t timestamp)
+{
+    int pushed = atomic_load(&s_pushed);
+    jpeg_info_t got, want;
+
+    for (int n = pushed - 1; n >= 0; n--) {
+        if (s_pushed_ts[n] != timestamp) {
+            continue;
+        }
+        int s = n % SOURCE_NUM;
+        if (jpeg_parse(jpeg, len, &got) != ESP_OK || jpeg_parse(s_frame[s], s_frame_len[s], &want) != ESP_OK) {
+            return false;
+        }
+        return got.width == want.width && got.height == want.height && got.comp[0].v == want.comp[0].v
+               && got.restart_interval == want.restart_interval
+               && !memcmp(got.qt[got.comp[0].tq], want.qt[want.comp[0].tq], sizeof(got.qt[0]))
+               && !memcmp(got.qt[got.comp[1].tq], want.qt[want.comp[1].tq], sizeof(got.qt[0]))
+               && got.scan_len == want.scan_len && !memcmp(got.scan, want.scan, got.scan_len);
+    }
+    return false;
+}
+
+static void frame_done(receiver_t *r)
+{
+    rtp_rx_frame_t *f = &r->frame;
+
+    if (!f->num) {
+        return;
+    }
+    r->frames++;
+    int missing = rtp_rx_repair(f);
+    size_t len = missing == 0 ? rtp_rx_jpeg(f, r->jpeg, sizeof(r->jpeg)) : 0;
+    if (len) {
+        r->bad += !frame_matches(r->jpeg, len, f->timestamp);
+        r->bad += r->complete + r->repaired && (int32_t)(f->timestamp - r->last_ts) <= 0;
+        r->last_ts = f->timestamp;
+        if (r->complete + r->repaired < LAT_MAX) {
+            r->latency_ms[r->complete + r->repaired] = (uint32_t)(r->arrival - f->timestamp) / 90.0;
+        }
+        if (f->repaired) {
+            r->repaired++;
+        } else {
+            r->complete++;
+        }
+    } else {
+        r->lost++;
+    }
+    rtp_rx_reset(f);
+}
+
+static void track(seq_track_t *t, uint16_t seq)
+{
+    if (!t->started) {
+        t->started = true;
+        t->first = seq;
+    }
+    t->last = seq;
+    t->received++;
+}
+
+static uint32_t track_lost(const seq_track_t *t)
+{
+    return t->started ? (uint16_t)(t->last - t->first) + 1 - t->received : 0;
+}
+
+static void *receiver_thread(void *arg)
+{
+    receiver_t *r = (receiver_t *)arg;
+    uint8_t pkt[RTP_RX_PACKET_MAX];
+
+    while (!atomic_load(&s_stop)) {
+        ssize_t len = recv(r->fd, pkt, sizeof(pkt), 0);
+        if (len < RTP_RX_PACKET_MAX && len >= 12) {
+            uint32_t now = esp_timer_get_time() * (RTP_JPEG_CLOCK_RATE / 1000) / 1000;
+            uint16_t seq = pkt[2] << 8 | pkt[3];
+            uint32_t timestamp = (uint32_t)pkt[4] << 24 | pkt[5] << 16 | pkt[6] << 8 | pkt[7];
+            bool parity = (pkt[1] & 0x7F) == RTP_FEC_PAYLOAD_TYPE;
+
+            atomic_fetch_add(&r->packets, 1);
+            track(parity ? &r->parity : &r->media, seq);
+            if (!parity) {
+                /* RFC 3550 A.8: smoothed difference of the transit times */
+                int64_t transit = (int32_t)(now - timestamp);
+                if (r->media.received > 1) {
+                    int64_t d = transit - r->last_transit;
+                    r->jitter += ((d < 0 ? -d : d) - r->jitter) / 16;
+                }
+                r->last_transit = transit;
+            }
+
+            r->rand ^= r->rand << 13;
+            r->rand ^= r->rand >> 17;
+            r->rand ^= r->rand << 5;
+            if (r->rand % 10000 < r->loss * 100) {
+                r->dropped++;
+                continue;
+            }
+            if (!rtp_rx_add(&r->frame, pkt, len)) {
+                frame_done(r);
+                rtp_rx_add(&r->frame, pkt, len);
+            }
+            r->arrival = now;
+            /* the marker ends the frame: on the last parity packet with FEC, else on the last media packet */
+            if ((pkt[1] & 0x80) && parity == FEC) {
+                frame_done(r);
+            }
+        }
+    }
+    frame_done(r);
+    return NULL;
+}
+
+/* sends a request and reads the response, body included, into resp; returns the status code */
+static int rtsp_request(int fd, const char *method, const char *url, int cseq, const char *headers, char *resp)
+{
+    char req[512];
+    int len = snprintf(req, sizeof(req), "%s %s RTSP/1.0\r\nCSeq: %d\r\n%s\r\n", method, url, cseq, headers);
+    size_t n = 0;
+    int status = 0;
+
+    resp[0] = '\0';
+    if (send(fd, req, len, MSG_NOSIGNAL) != len) {
+        return -1;
+    }
+    while (n < RESP_MAX - 1) {
+        ssize_t got = recv(fd, resp + n, RESP_MAX - 1 - n, 0);
+        if (got <= 0) {
+            return -1;
+        }
+        n += got;
+        resp[n] = '\0';
+        char *end = strstr(resp, "\r\n\r\n");
+        const char *length = strstr(resp, "Content-Length:");
+        if (end && n >= (size_t)(end + 4 - resp) + (length && length < end ? atoi(length + 15) : 0)) {
+            break;
+        }
+    }
+    char want[32];
+    snprintf(want, sizeof(want), "CSeq: %d\r\n", cseq);
+    if (sscanf(resp, "RTSP/1.0 %d", &status) != 1 || !strstr(resp, want)) {
+        return -1;
+    }
+    return status;
+}
+
+int main(int argc, char **argv)
+{
+    double seconds = argc > 1 ? atof(argv[1]) : 3.0;
+    static receiver_t r;
+    static char resp[RESP_MAX];
+    char url[64], headers[128];
+    pthread_t producer, receiver;
+    int cseq = 1;
+
+    for (size_t s = 0; s < SOURCE_NUM; s++) {
+        s_frame_len[s] = test_jpeg_encode(&s_sources[s], s_frame[s], sizeof(s_frame[s]));
+        TEST_CHECK(s_frame_len[s] > 0);
+    }
+    r.loss = argc > 2 ? atof(argv[2]) : 0;
+    r.rand = 2463534242u;
+    rtp_rx_reset(&r.frame);
+
+    ESP_ERROR_CHECK(frame_ring_init(CONFIG_CAMERA_FB_POOL_SIZE, CONFIG_CAMERA_FB_BUF_SIZE));
+    ESP_ERROR_CHECK(rtsp_server_start());
+    pthread_create(&producer, NULL, producer_thread, NULL);
+
+    struct sockaddr_in addr = {
+        .sin_family = AF_INET,
+        .sin_port = htons(CONFIG_RTSP_SERVER_PORT),
+        .sin_addr.s_addr = htonl(INADDR_LOOPBACK),
+    };
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    TEST_CHECK(connect(fd, (struct sockaddr *)&addr, sizeof(addr)) == 0);
+    struct timeval tv = { .tv_sec = 2 };
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+
+    /* the RTP port, with room for a few frames in case the receiver is descheduled */
+    int rcvbuf = 4 * 1024 * 1024;
+    socklen_t addr_len = sizeof(addr);
+    r.fd = socket(AF_INET, SOCK_DGRAM, 0);
+    setsockopt(r.fd, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+    tv.tv_sec = 0;
+    tv.tv_usec = 100000;
+    setsockopt(r.fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    addr.sin_port = 0;
+    TEST_CHECK(bind(r.fd, (struct sockaddr *)&addr, sizeof(addr)) == 0);
+    getsockname(r.fd, (struct sockaddr *)&addr, &addr_len);
+    int rtp_port = ntohs(addr.sin_port);
+    pthread_create(&receiver, NULL, receiver_thread, &r);
+
+    snprintf(url, sizeof(url), "rtsp://127.0.0.1:%d/", CONFIG_RTSP_SERVER_PORT);
+    TEST_CHECK(rtsp_request(fd, "OPTIONS", url, cseq++, "", resp) == 200);
+    TEST_CHECK(strstr(resp, "PLAY") && strstr(resp, "TEARDOWN"));
+    TEST_CHECK(rtsp_request(fd, "DESCRIBE", url, cseq++, "Accept: application/sdp\r\n", resp) == 200);
+    TEST_CHECK(strstr(resp, FEC ? "m=video 0 RTP/AVP 26 127\r\n" : "m=video 0 RTP/AVP 26\r\n") != NULL);
+    TEST_CHECK(strstr(resp, "a=rtpmap:26 JPEG/90000\r\n") && strstr(resp, "a=control:track0\r\n"));
+    snprintf(headers, sizeof(headers), "Content-Base: %s\r\n", url);
+    TEST_CHECK(strstr(resp, headers) != NULL);
+
+    snprintf(url, sizeof(url), "rtsp://127.0.0.1:%d/track0", CONFIG_RTSP_SERVER_PORT);
+    TEST_CHECK(rtsp_request(fd, "SETUP", url, cseq++, "Transport: RTP/AVP/TCP;unicast;interleaved=0-1\r\n", resp) == 461);
+    snprintf(headers, sizeof(headers), "Transport: RTP/AVP;unicast;client_port=%d-%d\r\n", rtp_port, rtp_port + 1);
+    TEST_CHECK(rtsp_request(fd, "SETUP", url, cseq++, headers, resp) == 200);
+    const char *session = strstr(resp, "Session: ");
+    unsigned long id = session ? strtoul(session + 9, NULL, 16) : 0;
+    TEST_CHECK(id != 0);
+    snprintf(headers, sizeof(headers), "server_port=%d-%d", CONFIG_RTP_SERVER_PORT, CONFIG_RTP_SERVER_PORT + 1);
+    TEST_CHECK(strstr(resp, headers) != NULL);
+
+    snprintf(url, sizeof(url), "rtsp://127.0.0.1:%d/", CONFIG_RTSP_SERVER_PORT);
+    snprintf(headers, sizeof(headers), "Session: %08lX\r\n", id ^ 0x10);
+    TEST_CHECK(rtsp_request(fd, "PLAY", url, cseq++, headers, resp) == 454);
+    snprintf(headers, sizeof(headers), "Session: %08lX\r\n", id);
+    TEST_CHECK(rtsp_request(fd, "PLAY", url, cseq++, headers, resp) == 200);
+
+    int pushed_at_play = atomic_load(&s_pushed);
+    usleep(seconds * 1e6 / 2);
+    TEST_CHECK(rtsp_request(fd, "GET_PARAMETER", url, cseq++, headers, resp) == 200);
+    usleep(seconds * 1e6 / 2);
+
+    snprintf(headers, sizeof(headers), "Session: %08lX\r\n", id ^ 0x10);
+    TEST_CHECK(rtsp_request(fd, "TEARDOWN", url, cseq++, headers, resp) == 454);
+    snprintf(headers, sizeof(headers), "Session: %08lX\r\n", id);
+    TEST_CHECK(rtsp_request(fd, "TEARDOWN", url, cseq++, headers, resp) == 200);
+    int pushed = atomic_load(&s_pushed) - pushed_at_play;
+    /* a frame already being sent goes out whole */
+    usleep(100000);
+    unsigned packets = atomic_load(&r.packets);
+    usleep(300000);
+    TEST_CHECK(atomic_load(&r.packets) == packets);
+
+    atomic_store(&s_stop, true);
+    pthread_join(producer, NULL);
+    pthread_join(receiver, NULL);
+    close(fd);
+    close(r.fd);
+
+    uint32_t delivered = r.complete + r.repaired;
+    uint32_t media_lost = track_lost(&r.media), parity_lost = track_lost(&r.parity);
+    printf("%d frames pushed while playing, %u received: %u complete, %u repaired, %u lost (%.1f%% of the "
+           "packets dropped on purpose)\n", pushed, r.frames, r.complete, r.repaired, r.lost, r.loss);
+    printf("media packets %u, %u lost on the way; parity packets %u, %u lost; jitter %.3f ms\n", r.media.received,
+           media_lost, r.parity.received, parity_lost, r.jitter / 90);
+    printf("latency capture to last packet p50 %.2f ms, p99 %.2f ms, max %.2f ms\n",
+           test_percentile(r.latency_ms, delivered < LAT_MAX ? delivered : LAT_MAX, 50),
+           test_percentile(r.latency_ms, delivered < LAT_MAX ? delivered : LAT_MAX, 99),
+           test_percentile(r.latency_ms, delivered < LAT_MAX ? delivered : LAT_MAX, 100));
+
+    TEST_CHECK(r.bad == 0);
+    TEST_CHECK(media_lost == 0 && parity_lost == 0);
+    TEST_CHECK(FEC ? r.parity.received > 0 : r.parity.received == 0);
+    /* PLAY may land in the middle of a frame, which then arrives without its start */
+    TEST_CHECK(r.frames >= (uint32_t)pushed * 9 / 10);
+    if (!r.loss) {
+        TEST_CHECK(r.repaired == 0 && r.lost <= 1);
+    } else if (FEC) {
+        TEST_CHECK(delivered >= r.frames * 95 / 100);
+    }
+    return test_exit_code(FEC ? "rtsp_loopback_fec" : "rtsp_loopback");
+}
@@ -0,0 +1,327 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * /ws/speaker over loopback WebSocket clients
+ *
+ * speaker_ws.c is registered on the host httpd and played by a thread that
+ * takes a 10 ms period of 48 kHz stereo every 10 ms in 128-frame pieces, as
+ * the speaker mixer does. The clients do the WebSocket handshake and send
+ * masked frames in real time.
+ *
+ * Checks:
+ * - a second output is turned down, and so are a client before there is an
+ *   output, one at 4 kHz and one with 9 channels
+ * - 2 s of a 440 Hz tone sent as 16 kHz stereo in 20 ms messages, then
+ *   "end", plays as 2 s of 440 Hz with both channels equal and no underrun;
+ *   a second client is turned away while it plays
+ * - a client that closes its socket after 200 ms of audio is played out
+ * - a client that sent "end" is cut short by the next one, which holds the
+ *   stream against a third, and deleting the output closes its session
+ * - the counters of streams and messages
+ *
+ * Reports what each stream played and the jitter buffer figures.
+ *
+ * Usage: speaker_ws_loopback
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include "esp_http_server.h"
+#include "esp_random.h"
+#include "metrics.h"
+#include "speaker_ws.h"
+#include "host_test.h"
+
+#define HTTP_PORT       18281
+#define CTRL_PORT       18283
+#define RATE            48000
+#define PERIOD          (RATE / 100)
+#define PIECE           128
+#define TONE_HZ         440
+#define TONE_RATE       16000
+#define TONE_MS         2000
+#define MSG_MS          20
+
+/* what the player got since player_take() */
+typedef struct {
+    uint32_t frames;
+    uint32_t mismatched;        /* frames whose two channels differ */
+    uint32_t crossings;         /* sign changes of the left channel */
+} played_t;
+
+static pthread_mutex_t s_lock = PTHREAD_MUTEX_INITIALIZER;
+static speaker_ws_output_t *s_out;
+static volatile bool s_stop;
+static played_t s_played;
+
+static void *player_thread(void *arg)
+{
+    static int16_t period[PERIOD * 2];
+    int16_t prev = 0;
+    uint64_t next = test_now_ns();
+
+    while (!s_stop) {
+        size_t got = 0, n = PIECE;
+        while (got < PERIOD && n == PIECE) {
+            n = speaker_ws_read(s_out, period + 2 * got, PERIOD - got < PIECE ? PERIOD - got : PIECE);
+            got += n;
+        }
+        pthread_mutex_lock(&s_lock);
+        for (size_t i = 0; i < got; i++) {
+            s_played.mismatched += period[2 * i] != period[2 * i + 1];
+            s_played.crossings += (prev < 0) != (period[2 * i] < 0);
+            prev = period[2 * i];
+        }
+        s_played.frames += got;
+        pthread_mutex_unlock(&s_lock);
+
+        next += 10000000;
+        uint64_t now = test_now_ns();
+        if (next > now) {
+            usleep((next - now) / 1000);
+        }
+    }
+    return NULL;
+}
+
+/* once the player has played nothing for 200 ms */
+static played_t player_take(void)
+{
+    played_t p;
+    uint32_t last = UINT32_MAX;
+
+    for (int i = 0; i < 50; i++) {
+        pthread_mutex_lock(&s_lock);
+        p = s_played;
+        pthread_mutex_unlock(&s_lock);
+        if (p.frames == last) {
+            break;
+        }
+        last = p.frames;
+        usleep(200000);
+    }
+    pthread_mutex_lock(&s_lock);
+    memset(&s_played, 0, sizeof(s_played));
+    pthread_mutex_unlock(&s_lock);
+    return p;
+}
+
+typedef struct {
+    const char *name;
+    int value;
+} metric_t;
+
+static esp_err_t metric_line(void *ctx, const char *text)
+{
+    metric_t *m = (metric_t *)ctx;
+    size_t len = strlen(m->name);
+
+    if (!strncmp(text, m->name, len) && text[len] == ' ') {
+        m->value = atoi(text + len + 1);
+    }
+    return ESP_OK;
+}
+
+static int metric(const char *name)
+{
+    metric_t m = { .name = name, .value = -1 };
+
+    metrics_write(metric_line, &m);
+    return m.value;
+}
+
+/* server closed the connection, within the receive timeout */
+static bool closed_by_server(int fd)
+{
+    uint8_t b;
+
+    return recv(fd, &b, 1, 0) == 0;
+}
+
+/* a connected WebSocket client on /ws/speaker?query, -1 if the upgrade failed */
+static int ws_connect(const char *query)
+{
+    struct sockaddr_in addr = {
+        .sin_family = AF_INET,
+        .sin_port = htons(HTTP_PORT),
+        .sin_addr.s_addr = htonl(INADDR_LOOPBACK),
+    };
+    struct timeval tv = { .tv_sec = 2 };
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    char req[256], head[512];
+    size_t len = 0;
+
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        close(fd);
+        return -1;
+    }
+    int n = snprintf(req, sizeof(req), "GET /ws/speaker%s%s HTTP/1.1\r\nHost: localhost\r\nUpgrade: websocket\r\n"
+                     "Connection: Upgrade\r\nSec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n"
+                     "Sec-WebSocket-Version: 13\r\n\r\n", query ? "?" : "", query ? query : "");
+    send(fd, req, n, MSG_NOSIGNAL);
+    /* byte by byte, so nothing after the head is taken */
+    while (len < sizeof(head) - 1 && recv(fd, head + len, 1, 0) == 1) {
+        head[++len] = '\0';
+        if (len >= 4 && !memcmp(head + len - 4, "\r\n\r\n", 4)) {
+            break;
+        }
+    }
+    if (len < 12 || strncmp(head, "HTTP/1.1 101", 12)) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+/* a client that is refused gets the upgrade, then the handler closes its session */
+static bool ws_refused(const char *query)
+{
+    int fd = ws_connect(query);
+    bool refused = fd < 0 || closed_by_server(fd);
+
+    if (fd >= 0) {
+        close(fd);
+    }
+    return refused;
+}
+
+/* one masked frame, FIN set */
+static bool ws_send(int fd, httpd_ws_type_t type, const void *payload, size_t len)
+{
+    uint8_t frame[8 + SPEAKER_WS_MSG_MAX];
+    uint32_t key = esp_random();
+    uint8_t *mask = (uint8_t *)&key;
+    size_t pos = 0;
+
+    frame[pos++] = 0x80 | type;
+    if (len < 126) {
+        frame[pos++] = 0x80 | len;
+    } else {
+        frame[pos++] = 0x80 | 126;
+        frame[pos++] = len >> 8;
+        frame[pos++] = len & 0xFF;
+    }
+    memcpy(frame + pos, mask, 4);
+    pos += 4;
+    for (size_t i = 0; i < len; i++) {
+        frame[pos++] = ((const uint8_t *)payload)[i] ^ mask[i % 4];
+    }
+    return send(fd, frame, pos, MSG_NOSIGNAL) == (ssize_t)pos;
+}
+
+static bool ws_end(int fd)
+{
+    return ws_send(fd, HTTPD_WS_TYPE_TEXT, "end", 3);
+}
+
+static double tone_hz(const played_t *p)
+{
+    return p->frames ? p->crossings / 2.0 / (p->frames / (double)RATE) : 0;
+}
+
+int main(void)
+{
+    httpd_config_t config = HTTPD_DEFAULT_CONFIG();
+    httpd_handle_t server;
+    speaker_ws_output_t *second;
+    pthread_t player;
+
+    config.server_port = HTTP_PORT;
+    config.ctrl_port = CTRL_PORT;
+    TEST_CHECK(speaker_ws_output_create(RATE, 2, &s_out) == ESP_ERR_INVALID_STATE);
+    ESP_ERROR_CHECK(httpd_start(&server, &config));
+    ESP_ERROR_CHECK(speaker_ws_register(server));
+
+    /* no speaker playing */
+    TEST_CHECK(ws_refused("rate=16000&channels=2"));
+    ESP_ERROR_CHECK(speaker_ws_output_create(RATE, 2, &s_out));
+    TEST_CHECK(speaker_ws_output_create(RATE, 2, &second) == ESP_ERR_INVALID_STATE);
+    pthread_create(&player, NULL, player_thread, NULL);
+    TEST_CHECK(ws_refused("rate=4000"));
+    TEST_CHECK(ws_refused("rate=16000&channels=9"));
+
+    /* a tone in real time */
+    static int16_t msg[TONE_RATE * MSG_MS / 1000 * 2];
+    const size_t frames = TONE_RATE * MSG_MS / 1000;
+    int fd = ws_connect("rate=16000&channels=2");
+    TEST_CHECK(fd >= 0);
+    TEST_CHECK(ws_refused(NULL));
+    uint64_t start = test_now_ns();
+    for (int k = 0; k < TONE_MS / MSG_MS; k++) {
+        for (size_t i = 0; i < frames; i++) {
+            msg[2 * i] = msg[2 * i + 1] = (int16_t)lrint(10000 * sin(2 * M_PI * TONE_HZ * (k * frames + i) / TONE_RATE));
+        }
+        TEST_CHECK(ws_send(fd, HTTPD_WS_TYPE_BINARY, msg, sizeof(msg)));
+        uint64_t next = start + (k + 1) * MSG_MS * 1000000ull, now = test_now_ns();
+        if (next > now) {
+            usleep((next - now) / 1000);
+        }
+    }
+    TEST_CHECK(ws_end(fd));
+    played_t p = player_take();
+    printf("tone: played %u frames, %.1f Hz, %u with unequal channels\n", p.frames, tone_hz(&p), p.mismatched);
+    printf("      target %d ms, jitter %d ms, latency %d ms, %d underruns, %d packets\n",
+           metric("speaker_net_target_ms"), metric("speaker_net_jitter_ms"), metric("speaker_net_latency_ms"),
+           metric("speaker_net_underruns_total"), metric("speaker_net_packets_total"));
+    TEST_CHECK(p.frames >= RATE * TONE_MS / 1000 && p.frames <= RATE * TONE_MS / 1000 + 1440);
+    TEST_CHECK(p.mismatched == 0);
+    TEST_CHECK(fabs(tone_hz(&p) - TONE_HZ) < 5);
+    TEST_CHECK(metric("speaker_net_underruns_total") == 0);
+    TEST_CHECK(metric("speaker_net_packets_total") == TONE_MS / MSG_MS);
+    TEST_CHECK(metric("speaker_net_depth_ms") == 0);
+    close(fd);
+
+    /* 200 ms at the speaker rate at once, then the client goes away */
+    fd = ws_connect("rate=48000");
+    TEST_CHECK(fd >= 0);
+    for (int i = 0; i < 480; i++) {
+        msg[i] = 1000;
+    }
+    for (int k = 0; k < 20; k++) {
+        TEST_CHECK(ws_send(fd, HTTPD_WS_TYPE_BINARY, msg, 960));
+    }
+    close(fd);
+    p = player_take();
+    printf("gone: played %u of 9600 frames\n", p.frames);
+    TEST_CHECK(p.frames > 9000 && p.frames <= 9600);
+
+    /* an ended stream gives way to the next client, which holds it */
+    fd = ws_connect("rate=8000");
+    TEST_CHECK(fd >= 0);
+    TEST_CHECK(ws_send(fd, HTTPD_WS_TYPE_BINARY, msg, 960));
+    TEST_CHECK(ws_end(fd));
+    usleep(50000);
+    int next = ws_connect("rate=8000");
+    TEST_CHECK(next >= 0);
+    TEST_CHECK(ws_refused("rate=8000"));
+    TEST_CHECK(ws_send(next, HTTPD_WS_TYPE_BINARY, msg, 960));
+    usleep(50000);
+
+    /* the output goes, and the session of its stream with it */
+    s_stop = true;
+    pthread_join(player, NULL);
+    speaker_ws_output_delete(s_out);
+    TEST_CHECK(closed_by_server(next));
+    close(fd);
+    close(next);
+
+    printf("streams %d, packets %d, concealed %d, dropped %d\n", metric("speaker_net_streams_total"),
+           metric("speaker_net_packets_total"), metric("speaker_net_concealed_total"),
+           metric("speaker_net_dropped_total"));
+    TEST_CHECK(metric("speaker_net_streams_total") == 4);
+    TEST_CHECK(metric("speaker_net_packets_total") == TONE_MS / MSG_MS + 22);
+    return test_exit_code("speaker_ws_loopback");
+}
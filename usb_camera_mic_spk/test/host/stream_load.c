@@ -0,0 +1,430 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * /stream fan-out server under 16 loopback clients
+ *
+ * stream_server.c serves a 30 fps producer of 30 KB frames to as many
+ * clients as it takes: 14 that read as fast as they can, one that reads at
+ * 200 KB/s, less than the stream needs, and one that sends its request and
+ * then never reads. Every client parses the multipart stream and checks each
+ * part against the sequence number the frame was filled with.
+ *
+ * Checks:
+ * - the fast clients get nearly every frame, in order and intact, and the
+ *   slow and stalled ones do not hold them back
+ * - the slow client skips frames but keeps streaming
+ * - the stalled client is evicted once its socket took nothing for
+ *   CONFIG_STREAM_CLIENT_STALL_TIMEOUT_MS, set to 1 s here
+ * - a 17th client is turned away, a request for another path gets a 404
+ * - a client that connects and sends nothing is evicted after the same
+ *   timeout
+ *
+ * Reports frames per second, frame latency percentiles (capture to last
+ * byte) per kind of client, the server's counters and the push time with
+ * the share of the server's eventfd wake in it.
+ *
+ * Usage: stream_load [seconds, default 3]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include "esp_timer.h"
+#include "frame_ring.h"
+#include "stream_server.h"
+#include "host_test.h"
+
+#define STREAM_PORT     18181
+#define FPS             30
+#define FRAME_BYTES     (30 * 1024)
+#define FAST_CLIENTS    14
+#define SLOW_RATE       (200 * 1024)
+#define LAT_MAX         4096
+
+typedef enum {
+    CLIENT_FAST,
+    CLIENT_SLOW,
+    CLIENT_STALLED,
+} client_kind_t;
+
+typedef struct {
+    pthread_t thread;
+    client_kind_t kind;
+    int fd;
+    uint32_t frames;
+    uint32_t skipped;           /* sequence numbers jumped over */
+    uint32_t bad;               /* parts that were torn, out of order or malformed */
+    uint32_t first_seq;
+    uint32_t last_seq;
+    bool closed_by_server;
+    double latency_ms[LAT_MAX];
+} client_t;
+
+static atomic_bool s_stop;
+
+/* Frame length follows the sequence so a frame of another sequence has the wrong length too */
+static size_t frame_len(uint32_t seq)
+{
+    return FRAME_BYTES + (seq % 16) * 64;
+}
+
+static int client_connect(int rcvbuf)
+{
+    struct sockaddr_in addr = {
+        .sin_family = AF_INET,
+        .sin_port = htons(STREAM_PORT),
+        .sin_addr.s_addr = htonl(INADDR_LOOPBACK),
+    };
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+
+    if (rcvbuf) {
+        setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+    }
+    if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static int send_request(int fd, const char *path)
+{
+    char req[128];
+    int len = snprintf(req, sizeof(req), "GET %s HTTP/1.1\r\nHost: localhost\r\n\r\n", path);
+
+    return send(fd, req, len, MSG_NOSIGNAL) == len ? 0 : -1;
+}
+
+/*
+ * Buffered reader over the client socket, throttled to a byte rate if one
+ * is set. Returns false once the server closed the connection.
+ */
+typedef struct {
+    int fd;
+    uint32_t rate;
+    uint8_t buf[8192];
+    size_t len;
+    size_t pos;
+    uint64_t total;
+    uint64_t start_ns;
+} reader_t;
+
+static bool reader_fill(reader_t *r)
+{
+    size_t want = sizeof(r->buf);
+
+    if (r->rate) {
+        /* never get ahead of the rate, read in 2 KB steps */
+        uint64_t allowed = (test_now_ns() - r->start_ns) * r->rate / 1000000000ull;
+        while (allowed < r->total + 2048 && !atomic_load(&s_stop)) {
+            usleep(2000);
+            allowed = (test_now_ns() - r->start_ns) * r->rate / 1000000000ull;
+        }
+        want = 2048;
+    }
+    ssize_t len = recv(r->fd, r->buf, want, 0);
+    if (len <= 0) {
+        return false;
+    }
+    r->len = len;
+    r->pos = 0;
+    r->total += len;
+    return true;
+}
+
+/* reads up to and including the first CRLF CRLF into out */
+static bool read_headers(reader_t *r, char *out, size_t size)
+{
+    size_t n = 0;
+
+    while (n < size - 1) {
+        if (r->pos == r->len && !reader_fill(r)) {
+            return false;
+        }
+        out[n++] = r->buf[r->pos++];
+        out[n] = '\0';
+        if (n >= 4 && memcmp(out + n - 4, "\r\n\r\n", 4) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool read_body(reader_t *r, uint32_t seq, size_t len, bool *intact)
+{
+    size_t off = 0;
+
+    *intact = true;
+    while (off < len) {
+        if (r->pos == r->len && !reader_fill(r)) {
+            return false;
+        }
+        size_t n = r->len - r->pos < len - off ? r->len - r->pos : len - off;
+        for (size_t i = 0; i < n; i++) {
+            /* byte k of the frame is byte k % 4 of the little-endian sequence word */
+            *intact &= r->buf[r->pos + i] == (uint8_t)(seq >> (8 * ((off + i) % 4)));
+        }
+        r->pos += n;
+        off += n;
+    }
+    return true;
+}
+
+static void *stream_client_thread(void *arg)
+{
+    client_t *c = (client_t *)arg;
+    static __thread reader_t r;
+    char head[512];
+
+    memset(&r, 0, sizeof(r));
+    r.fd = c->fd;
+    r.rate = c->kind == CLIENT_SLOW ? SLOW_RATE : 0;
+    r.start_ns = test_now_ns();
+    if (send_request(c->fd, "/stream") < 0) {
+        c->bad++;
+        return NULL;
+    }
+    if (c->kind == CLIENT_STALLED) {
+        /* the server must give up on us; its close shows as EOF once we look again */
+        while (!atomic_load(&s_stop)) {
+            usleep(10000);
+        }
+        char discard[4096];
+        ssize_t len;
+        while ((len = recv(c->fd, discard, sizeof(discard), MSG_DONTWAIT)) > 0) {
+        }
+        c->closed_by_server = len == 0;
+        return NULL;
+    }
+
+    if (!read_headers(&r, head, sizeof(head)) || strncmp(head, "HTTP/1.1 200 OK", 15) != 0
+            || !strstr(head, "multipart/x-mixed-replace")) {
+        c->bad++;
+        return NULL;
+    }
+    while (!atomic_load(&s_stop)) {
+        unsigned len = 0, seq = 0;
+        int sec = 0, usec = 0;
+        bool intact;
+
+        if (!read_headers(&r, head, sizeof(head))) {
+            c->closed_by_server = true;
+            break;
+        }
+        const char *part = strstr(head, "Content-Type: image/jpeg");
+        if (!part || sscanf(part, "Content-Type: image/jpeg\r\nContent-Length: %u\r\nX-Timestamp: %d.%d\r\nX-Sequence: %u",
+                            &len, &sec, &usec, &seq) != 4) {
+            c->bad++;
+            break;
+        }
+        if (!read_body(&r, seq, len, &intact)) {
+            c->closed_by_server = true;
+            break;
+        }
+        int64_t captured = (int64_t)sec * 1000000 + usec;
+        if (c->frames < LAT_MAX) {
+            c->latency_ms[c->frames] = (esp_timer_get_time() - captured) / 1e3;
+        }
+        c->bad += !intact || len != frame_len(seq) || (c->frames && seq <= c->last_seq);
+        if (c->frames) {
+            c->skipped += seq - c->last_seq - 1;
+        } else {
+            c->first_seq = seq;
+        }
+        c->last_seq = seq;
+        c->frames++;
+    }
+    return NULL;
+}
+
+static void start_client(client_t *c, client_kind_t kind)
+{
+    c->kind = kind;
+    c->fd = client_connect(kind == CLIENT_STALLED ? 4096 : 0);
+    TEST_CHECK(c->fd >= 0);
+    pthread_create(&c->thread, NULL, stream_client_thread, c);
+}
+
+/* seconds until the server closes a connection that sends nothing, -1 if it is still open after timeout_ms */
+static double idle_evicted_after(int timeout_ms)
+{
+    int fd = client_connect(0);
+    char c;
+
+    if (fd < 0) {
+        return -1;
+    }
+    struct timeval tv = { .tv_sec = timeout_ms / 1000, .tv_usec = timeout_ms % 1000 * 1000 };
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    uint64_t t0 = test_now_ns();
+    ssize_t len = recv(fd, &c, 1, 0);
+    double elapsed = (test_now_ns() - t0) / 1e9;
+    close(fd);
+    return len == 0 ? elapsed : -1;
+}
+
+/* what a client that does not get in, or asks for something else, reads before the server closes */
+static void read_rejected(const char *path, char *out, size_t size)
+{
+    int fd = client_connect(0);
+    size_t n = 0;
+    ssize_t len;
+
+    out[0] = '\0';
+    if (fd < 0) {
+        return;
+    }
+    struct timeval tv = { .tv_sec = 2 };
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    send_request(fd, path);
+    while (n < size - 1 && (len = recv(fd, out + n, size - 1 - n, 0)) > 0) {
+        n += len;
+    }
+    out[n] = '\0';
+    close(fd);
+}
+
+static void produce(uint32_t seq, uint32_t *buf)
+{
+    size_t len = frame_len(seq);
+
+    for (size_t i = 0; i < len / 4; i++) {
+        buf[i] = seq;
+    }
+    frame_ring_push((const uint8_t *)buf, len, 640, 480, seq, esp_timer_get_time());
+}
+
+static void report(const char *name, client_t *c, int n, double seconds, double *p50, double *p99)
+{
+    static double lat[LAT_MAX * FAST_CLIENTS];
+    size_t cnt = 0;
+    uint32_t frames = 0, skipped = 0;
+
+    for (int i = 0; i < n; i++) {
+        frames += c[i].frames;
+        skipped += c[i].skipped;
+        for (uint32_t j = 0; j < c[i].frames && j < LAT_MAX; j++) {
+            lat[cnt++] = c[i].latency_ms[j];
+        }
+    }
+    *p50 = test_percentile(lat, cnt, 50);
+    *p99 = test_percentile(lat, cnt, 99);
+    printf("%-8s %2d client%s %6.1f fps each, %5.1f skipped/s, latency p50 %6.1f ms, p99 %6.1f ms, max %6.1f ms\n",
+           name, n, n == 1 ? " " : "s", frames / seconds / n, skipped / seconds / n, *p50, *p99,
+           test_percentile(lat, cnt, 100));
+}
+
+int main(int argc, char **argv)
+{
+    double seconds = argc > 1 ? atof(argv[1]) : 3.0;
+    static uint32_t buf[(FRAME_BYTES + 16 * 64) / 4];
+    static client_t fast[FAST_CLIENTS], slow, stalled;
+    stream_server_stats_t stats = { 0 };
+    frame_ring_stats_t ring;
+    char resp[256];
+    double p50, p99;
+
+    ESP_ERROR_CHECK(frame_ring_init(CONFIG_CAMERA_FB_POOL_SIZE, CONFIG_CAMERA_FB_BUF_SIZE));
+    ESP_ERROR_CHECK(stream_server_start(STREAM_PORT));
+
+    for (int i = 0; i < FAST_CLIENTS; i++) {
+        start_client(&fast[i], CLIENT_FAST);
+    }
+    start_client(&slow, CLIENT_SLOW);
+    start_client(&stalled, CLIENT_STALLED);
+
+    /* every slot is taken once all requests are in, a 17th client is turned away */
+    for (int i = 0; i < 100 && stats.client_num < FAST_CLIENTS + 2; i++) {
+        usleep(10000);
+        stream_server_get_stats(&stats);
+    }
+    TEST_CHECK(stats.client_num == FAST_CLIENTS + 2);
+    read_rejected("/stream", resp, sizeof(resp));
+    TEST_CHECK(resp[0] == '\0');
+
+    int frames = (int)(seconds * FPS);
+    uint64_t next = test_now_ns();
+    int64_t evicted_at = 0, start = esp_timer_get_time();
+    for (int f = 1; f <= frames; f++) {
+        produce(f, buf);
+        next += 1000000000ull / FPS;
+        struct timespec ts = { .tv_sec = next / 1000000000ull, .tv_nsec = next % 1000000000ull };
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+
+        stream_server_get_stats(&stats);
+        if (!evicted_at && stats.evicted) {
+            evicted_at = esp_timer_get_time();
+        }
+    }
+    stream_server_get_stats(&stats);
+    frame_ring_get_stats(&ring);
+    atomic_store(&s_stop, true);
+
+    read_rejected("/nothing", resp, sizeof(resp));
+    TEST_CHECK(strncmp(resp, "HTTP/1.1 404", 12) == 0);
+
+    for (int i = 0; i < FAST_CLIENTS; i++) {
+        shutdown(fast[i].fd, SHUT_RD);
+    }
+    shutdown(slow.fd, SHUT_RD);
+    for (int i = 0; i < FAST_CLIENTS; i++) {
+        pthread_join(fast[i].thread, NULL);
+    }
+    pthread_join(slow.thread, NULL);
+    pthread_join(stalled.thread, NULL);
+
+    /* the others leave rather than stall while the idle client waits in the stalled one's slot */
+    for (int i = 0; i < FAST_CLIENTS; i++) {
+        close(fast[i].fd);
+    }
+    close(slow.fd);
+    double idle_s = idle_evicted_after(CONFIG_STREAM_CLIENT_STALL_TIMEOUT_MS + 1000);
+    stream_server_stats_t idle_stats;
+    stream_server_get_stats(&idle_stats);
+
+    printf("%d frames of %d KB at %d fps, %lu dropped with all %d slots pinned\n", frames, FRAME_BYTES / 1024, FPS,
+           (unsigned long)ring.pool_exhausted, CONFIG_CAMERA_FB_POOL_SIZE);
+    printf("push %lu us, max %lu us, of which the wake of the server's select() %lu us, max %lu us\n",
+           (unsigned long)ring.push_time_avg_us, (unsigned long)ring.push_time_max_us,
+           (unsigned long)ring.listener_time_avg_us[0], (unsigned long)ring.listener_time_max_us[0]);
+    report("fast", fast, FAST_CLIENTS, seconds, &p50, &p99);
+    TEST_CHECK(p99 < 100);
+    report("slow", &slow, 1, seconds, &p50, &p99);
+    printf("stalled  evicted %s %.2f s after the start (limit %d ms), %lu evicted in all\n",
+           evicted_at ? "at" : "not by", (evicted_at ? evicted_at - start : esp_timer_get_time() - start) / 1e6,
+           CONFIG_STREAM_CLIENT_STALL_TIMEOUT_MS, (unsigned long)stats.evicted);
+    printf("idle     evicted %s %.2f s after it connected without a request\n", idle_s >= 0 ? "at" : "not by",
+           idle_s >= 0 ? idle_s : (CONFIG_STREAM_CLIENT_STALL_TIMEOUT_MS + 1000) / 1e3);
+
+    /*
+     * The stalled client pins its frame until it is evicted. While the slow
+     * one pins another, the newest frame takes the last slot and the camera's
+     * frames are dropped, for every client alike. Of the frames that made it
+     * into the ring the fast clients must miss none.
+     */
+    for (int i = 0; i < FAST_CLIENTS; i++) {
+        TEST_CHECK(fast[i].bad == 0);
+        TEST_CHECK(fast[i].frames >= ring.frames_in * 95 / 100);
+    }
+    TEST_CHECK(ring.frames_in + ring.pool_exhausted == (uint32_t)frames);
+    TEST_CHECK(ring.listener_num == 1);
+    /* 200 KB/s takes about 6 of the 30 frames a second, whatever it gets it keeps getting */
+    TEST_CHECK(slow.bad == 0);
+    TEST_CHECK(!slow.closed_by_server);
+    TEST_CHECK(slow.frames >= (uint32_t)(seconds * 3) && slow.skipped > slow.frames);
+    TEST_CHECK(stats.evicted == 1 && stalled.closed_by_server);
+    TEST_CHECK(evicted_at && evicted_at - start < (CONFIG_STREAM_CLIENT_STALL_TIMEOUT_MS + 1000) * 1000LL);
+    TEST_CHECK(idle_s >= CONFIG_STREAM_CLIENT_STALL_TIMEOUT_MS * 0.9e-3 && idle_stats.evicted == 2);
+    TEST_CHECK(stats.client_num == FAST_CLIENTS + 1);
+    return test_exit_code("stream_load");
+}
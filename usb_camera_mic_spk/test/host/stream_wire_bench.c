@@ -0,0 +1,252 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * MJPEG part on the wire: chunked sends against one gathered sendmsg()
+ *
+ * The same frames go to a loopback client two ways:
+ * - chunked: the stream_handler of app_httpd.c before the fan-out server,
+ *   boundary, part header and JPEG as three httpd_resp_send_chunk() calls,
+ *   each framed the way esp_http_server does it: size line, data and CRLF,
+ *   one send each
+ * - gather: stream_server.c as it is, boundary, part header and the pinned
+ *   frame in one sendmsg() from client_start_frame() and client_flush()
+ *
+ * The MSS is set to 1460 as on WiFi. Each part is sent once the client has
+ * read the previous one, as at 30 fps where the link idles between frames.
+ * Per part: bytes on the wire, TCP segments, send calls and the sender's CPU
+ * time.
+ *
+ * Usage: stream_wire_bench [parts per run, default 2000]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include "host_test.h"
+
+/* count the sendmsg() calls of stream_server.c, compiled in to reach its client functions */
+static ssize_t bench_sendmsg(int fd, const struct msghdr *msg, int flags);
+#define sendmsg bench_sendmsg
+#include "stream_server.c"
+#undef sendmsg
+
+#define SLOT_NUM        3
+#define SLOT_SIZE       (96 * 1024)
+#define WIFI_MSS        1460
+
+/* struct tcp_info of glibc stops short of the segment counters the kernel fills in after it */
+typedef struct {
+    struct tcp_info info;
+    uint64_t pacing_rate;
+    uint64_t max_pacing_rate;
+    uint64_t bytes_acked;
+    uint64_t bytes_received;
+    uint32_t segs_out;
+    uint32_t segs_in;
+} tcp_info_ext_t;
+
+typedef struct {
+    uint64_t bytes;
+    uint64_t segments;
+    uint64_t calls;
+    uint64_t cpu_ns;
+} wire_cost_t;
+
+static atomic_ullong s_received;
+static uint64_t s_sent;
+static uint64_t s_send_calls;
+
+static ssize_t bench_sendmsg(int fd, const struct msghdr *msg, int flags)
+{
+    ssize_t sent = sendmsg(fd, msg, flags);
+
+    s_send_calls++;
+    s_sent += sent > 0 ? sent : 0;
+    return sent;
+}
+
+static void *receiver_thread(void *arg)
+{
+    int fd = *(int *)arg;
+    static uint8_t buf[64 * 1024];
+    ssize_t len;
+
+    while ((len = recv(fd, buf, sizeof(buf), 0)) > 0) {
+        atomic_fetch_add(&s_received, len);
+    }
+    return NULL;
+}
+
+static uint32_t segs_out(int fd)
+{
+    tcp_info_ext_t ti = { 0 };
+    socklen_t len = sizeof(ti);
+
+    getsockopt(fd, IPPROTO_TCP, TCP_INFO, &ti, &len);
+    return ti.segs_out;
+}
+
+/* a connected pair over loopback with the WiFi MSS, the receiving end read by its own thread */
+static int connect_pair(int *rx_fd, pthread_t *rx_thread)
+{
+    struct sockaddr_in addr = { .sin_family = AF_INET, .sin_addr.s_addr = htonl(INADDR_LOOPBACK) };
+    socklen_t addr_len = sizeof(addr);
+    int mss = WIFI_MSS;
+    int lfd = socket(AF_INET, SOCK_STREAM, 0);
+
+    setsockopt(lfd, IPPROTO_TCP, TCP_MAXSEG, &mss, sizeof(mss));
+    bind(lfd, (struct sockaddr *)&addr, sizeof(addr));
+    listen(lfd, 1);
+    getsockname(lfd, (struct sockaddr *)&addr, &addr_len);
+    *rx_fd = socket(AF_INET, SOCK_STREAM, 0);
+    setsockopt(*rx_fd, IPPROTO_TCP, TCP_MAXSEG, &mss, sizeof(mss));
+    if (connect(*rx_fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        perror("connect");
+        exit(1);
+    }
+    int fd = accept(lfd, NULL, NULL);
+    close(lfd);
+    pthread_create(rx_thread, NULL, receiver_thread, rx_fd);
+    return fd;
+}
+
+static void wait_received(uint64_t total)
+{
+    while (atomic_load(&s_received) < total) {
+        usleep(20);
+    }
+}
+
+static int send_all(int fd, const void *buf, size_t len)
+{
+    const uint8_t *p = (const uint8_t *)buf;
+
+    while (len) {
+        ssize_t sent = send(fd, p, len, MSG_NOSIGNAL);
+        s_send_calls++;
+        if (sent < 0) {
+            return -1;
+        }
+        s_sent += sent;
+        p += sent;
+        len -= sent;
+    }
+    return 0;
+}
+
+/* what httpd_resp_send_chunk() writes: the size line, the data and a CRLF, one send each */
+static int send_chunk(int fd, const void *buf, size_t len)
+{
+    char size_line[12];
+    int n = snprintf(size_line, sizeof(size_line), "%x\r\n", (unsigned)len);
+
+    if (send_all(fd, size_line, n) < 0 || send_all(fd, buf, len) < 0) {
+        return -1;
+    }
+    return send_all(fd, "\r\n", 2);
+}
+
+static void chunked_part(int fd, camera_fb_t *fb)
+{
+    static const char *part_fmt = "Content-Type: image/jpeg\r\nContent-Length: %u\r\nX-Timestamp: %d.%06d\r\n\r\n";
+    char part[128];
+
+    size_t hlen = snprintf(part, sizeof(part), part_fmt, fb->len, (int)fb->timestamp.tv_sec, (int)fb->timestamp.tv_usec);
+    send_chunk(fd, _STREAM_BOUNDARY, strlen(_STREAM_BOUNDARY));
+    send_chunk(fd, part, hlen);
+    send_chunk(fd, fb->buf, fb->len);
+}
+
+static void gather_part(stream_client_t *c, camera_fb_t *fb)
+{
+    /* the server's own pin on the newest frame, as server_new_frame() holds it */
+    s_current = fb;
+    s_current_id++;
+    client_start_frame(c);
+    while (client_flush(c) == 1) {
+        struct pollfd pfd = { .fd = c->fd, .events = POLLOUT };
+        poll(&pfd, 1, 100);
+    }
+    s_current = NULL;
+}
+
+static camera_fb_t *next_frame(frame_ring_reader_t *reader, uint8_t *buf, size_t len, uint32_t seq)
+{
+    memset(buf, seq, len);
+    frame_ring_push(buf, len, 640, 480, seq, esp_timer_get_time());
+    return frame_ring_reader_get(reader, 0);
+}
+
+static wire_cost_t run(bool gather, size_t len, int parts, uint8_t *buf, uint32_t *seq)
+{
+    frame_ring_reader_t *reader = frame_ring_reader_open();
+    pthread_t rx_thread;
+    int rx_fd;
+    int fd = connect_pair(&rx_fd, &rx_thread);
+    stream_client_t c = { .state = CLIENT_STREAMING, .fd = fd };
+    wire_cost_t cost = { 0 };
+
+    if (gather) {
+        int nodelay = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+        set_nonblocking(fd);
+    }
+    atomic_store(&s_received, 0);
+    s_sent = 0;
+    s_send_calls = 0;
+    uint32_t segs_before = segs_out(fd);
+    for (int i = 0; i < parts; i++) {
+        camera_fb_t *fb = next_frame(reader, buf, len, ++*seq);
+        uint64_t t0 = test_thread_cpu_ns();
+        if (gather) {
+            gather_part(&c, fb);
+        } else {
+            chunked_part(fd, fb);
+        }
+        cost.cpu_ns += test_thread_cpu_ns() - t0;
+        frame_ring_return(fb);
+        wait_received(s_sent);
+    }
+    cost.segments = segs_out(fd) - segs_before;
+    cost.bytes = atomic_load(&s_received);
+    cost.calls = s_send_calls;
+    close(fd);
+    pthread_join(rx_thread, NULL);
+    close(rx_fd);
+    frame_ring_reader_close(reader);
+    return cost;
+}
+
+int main(int argc, char **argv)
+{
+    int parts = argc > 1 ? atoi(argv[1]) : 2000;
+    static const size_t sizes[] = { 4220, 30 * 1024, 90 * 1024 };
+    static uint8_t buf[SLOT_SIZE];
+    uint32_t seq = 0;
+
+    ESP_ERROR_CHECK(frame_ring_init(SLOT_NUM, SLOT_SIZE));
+    printf("%d parts per run, MSS %d, each part sent once the previous one was read\n", parts, WIFI_MSS);
+    printf("%8s %-8s %12s %10s %10s %10s %10s\n", "jpeg", "path", "wire B/part", "overhead", "segs/part",
+           "sends/part", "cpu us/part");
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        for (int gather = 0; gather < 2; gather++) {
+            wire_cost_t cost = run(gather, sizes[i], parts, buf, &seq);
+            printf("%8zu %-8s %12.1f %10.1f %10.2f %10.2f %10.2f\n", sizes[i], gather ? "gather" : "chunked",
+                   (double)cost.bytes / parts, (double)cost.bytes / parts - sizes[i], (double)cost.segments / parts,
+                   (double)cost.calls / parts, cost.cpu_ns / 1e3 / parts);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,11 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Host stand-in for the Arduino log header, CONFIG_ARDUHAL_ESP_LOG is never set on the host */
+
+#pragma once
+
+#include "esp_log.h"
@@ -0,0 +1,264 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * ESP-IDF system services on the host: esp_timer, esp_random, esp_log,
+ * esp_err_to_name, the heap queries and the eventfd VFS.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <malloc.h>
+#include <pthread.h>
+#include <sys/random.h>
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_random.h"
+#include "esp_system.h"
+#include "esp_heap_caps.h"
+#include "esp_vfs_eventfd.h"
+
+/* esp_timer: microseconds since start-up, so ticks and timestamps start near 0 like after boot */
+
+static int64_t s_boot_us;
+
+static int64_t monotonic_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+__attribute__((constructor)) static void esp_timer_boot(void)
+{
+    s_boot_us = monotonic_us() - 1;
+}
+
+int64_t esp_timer_get_time(void)
+{
+    return monotonic_us() - s_boot_us;
+}
+
+/* esp_random: xorshift64*, seeded from getrandom() or HOST_SEED */
+
+static _Atomic uint64_t s_random_state;
+
+uint32_t esp_random(void)
+{
+    uint64_t x = atomic_load(&s_random_state);
+    uint64_t next;
+
+    /* seeded on first use, by whichever caller gets there first */
+    while (x == 0) {
+        const char *env = getenv("HOST_SEED");
+        uint64_t seed;
+        if (env) {
+            seed = strtoull(env, NULL, 0);
+        } else if (getrandom(&seed, sizeof(seed), 0) != sizeof(seed)) {
+            seed = (uint64_t)time(NULL);
+        }
+        atomic_compare_exchange_strong(&s_random_state, &x, seed | 1);
+        x = atomic_load(&s_random_state);
+    }
+    do {
+        next = x;
+        next ^= next >> 12;
+        next ^= next << 25;
+        next ^= next >> 27;
+    } while (!atomic_compare_exchange_weak(&s_random_state, &x, next));
+    return (uint32_t)((next * 0x2545F4914F6CDD1DULL) >> 32);
+}
+
+void esp_fill_random(void *buf, size_t len)
+{
+    uint8_t *p = (uint8_t *)buf;
+
+    for (size_t i = 0; i < len; i += 4) {
+        uint32_t r = esp_random();
+        memcpy(p + i, &r, len - i < 4 ? len - i : 4);
+    }
+}
+
+/* esp_err_to_name */
+
+const char *esp_err_to_name(esp_err_t code)
+{
+    switch (code) {
+    case ESP_OK: return "ESP_OK";
+    case ESP_FAIL: return "ESP_FAIL";
+    case ESP_ERR_NO_MEM: return "ESP_ERR_NO_MEM";
+    case ESP_ERR_INVALID_ARG: return "ESP_ERR_INVALID_ARG";
+    case ESP_ERR_INVALID_STATE: return "ESP_ERR_INVALID_STATE";
+    case ESP_ERR_INVALID_SIZE: return "ESP_ERR_INVALID_SIZE";
+    case ESP_ERR_NOT_FOUND: return "ESP_ERR_NOT_FOUND";
+    case ESP_ERR_NOT_SUPPORTED: return "ESP_ERR_NOT_SUPPORTED";
+    case ESP_ERR_TIMEOUT: return "ESP_ERR_TIMEOUT";
+    case ESP_ERR_INVALID_RESPONSE: return "ESP_ERR_INVALID_RESPONSE";
+    case ESP_ERR_INVALID_CRC: return "ESP_ERR_INVALID_CRC";
+    case ESP_ERR_INVALID_VERSION: return "ESP_ERR_INVALID_VERSION";
+    case ESP_ERR_INVALID_MAC: return "ESP_ERR_INVALID_MAC";
+    case ESP_ERR_NOT_FINISHED: return "ESP_ERR_NOT_FINISHED";
+    case ESP_ERR_NOT_ALLOWED: return "ESP_ERR_NOT_ALLOWED";
+    default: return "UNKNOWN ERROR";
+    }
+}
+
+/* esp_log: a default level and a few per-tag overrides */
+
+#define LOG_TAGS_MAX    16
+
+static pthread_mutex_t s_log_lock = PTHREAD_MUTEX_INITIALIZER;
+static int s_log_default = -1;
+static struct {
+    char tag[24];
+    esp_log_level_t level;
+} s_log_tags[LOG_TAGS_MAX];
+static int s_log_tag_count;
+
+static esp_log_level_t log_level_from_env(void)
+{
+    const char *env = getenv("HOST_LOG");
+
+    switch (env ? env[0] : 'W') {
+    case 'N': case 'n': return ESP_LOG_NONE;
+    case 'E': case 'e': return ESP_LOG_ERROR;
+    case 'I': case 'i': return ESP_LOG_INFO;
+    case 'D': case 'd': return ESP_LOG_DEBUG;
+    case 'V': case 'v': return ESP_LOG_VERBOSE;
+    default: return ESP_LOG_WARN;
+    }
+}
+
+void esp_log_level_set(const char *tag, esp_log_level_t level)
+{
+    pthread_mutex_lock(&s_log_lock);
+    if (strcmp(tag, "*") == 0) {
+        /* HOST_LOG wins over the application, it is how a run asks for more or less */
+        s_log_default = getenv("HOST_LOG") ? log_level_from_env() : level;
+        s_log_tag_count = 0;
+    } else {
+        int i;
+        for (i = 0; i < s_log_tag_count && strcmp(s_log_tags[i].tag, tag); i++) {
+        }
+        if (i < LOG_TAGS_MAX) {
+            snprintf(s_log_tags[i].tag, sizeof(s_log_tags[i].tag), "%s", tag);
+            s_log_tags[i].level = level;
+            s_log_tag_count += i == s_log_tag_count;
+        }
+    }
+    pthread_mutex_unlock(&s_log_lock);
+}
+
+esp_log_level_t esp_log_level_get(const char *tag)
+{
+    esp_log_level_t level;
+
+    pthread_mutex_lock(&s_log_lock);
+    if (s_log_default < 0) {
+        s_log_default = log_level_from_env();
+    }
+    level = (esp_log_level_t)s_log_default;
+    for (int i = 0; i < s_log_tag_count; i++) {
+        if (strcmp(s_log_tags[i].tag, tag) == 0) {
+            level = s_log_tags[i].level;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&s_log_lock);
+    return level;
+}
+
+uint32_t esp_log_timestamp(void)
+{
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+void esp_log_write(esp_log_level_t level, const char *tag, const char *format, ...)
+{
+    static const char letters[] = "NEWIDV";
+    char line[512];
+    va_list ap;
+
+    int n = snprintf(line, sizeof(line), "%c (%lu) %s: ", letters[level], (unsigned long)esp_log_timestamp(), tag);
+    va_start(ap, format);
+    vsnprintf(line + n, sizeof(line) - n, format, ap);
+    va_end(ap);
+    fprintf(stderr, "%s\n", line);
+}
+
+/* Heap: the C library allocator, there is no PSRAM */
+
+static bool caps_supported(uint32_t caps)
+{
+    return (caps & MALLOC_CAP_SPIRAM) == 0;
+}
+
+void *heap_caps_malloc(size_t size, uint32_t caps)
+{
+    return caps_supported(caps) ? malloc(size) : NULL;
+}
+
+void *heap_caps_calloc(size_t n, size_t size, uint32_t caps)
+{
+    return caps_supported(caps) ? calloc(n, size) : NULL;
+}
+
+void heap_caps_free(void *ptr)
+{
+    free(ptr);
+}
+
+static size_t heap_free(void)
+{
+    struct mallinfo2 info = mallinfo2();
+
+    return info.fordblks;
+}
+
+size_t heap_caps_get_free_size(uint32_t caps)
+{
+    return caps_supported(caps) ? heap_free() : 0;
+}
+
+size_t heap_caps_get_minimum_free_size(uint32_t caps)
+{
+    return heap_caps_get_free_size(caps);
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t caps)
+{
+    return heap_caps_get_free_size(caps);
+}
+
+uint32_t esp_get_free_heap_size(void)
+{
+    return (uint32_t)heap_free();
+}
+
+uint32_t esp_get_minimum_free_heap_size(void)
+{
+    return (uint32_t)heap_free();
+}
+
+void esp_restart(void)
+{
+    fprintf(stderr, "esp_restart()\n");
+    exit(1);
+}
+
+/* eventfd: native on Linux */
+
+esp_err_t esp_vfs_eventfd_register(const esp_vfs_eventfd_config_t *config)
+{
+    return ESP_OK;
+}
@@ -0,0 +1,1059 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * esp_http_server on the host
+ *
+ * One task selects on the listening socket, a UDP control socket on
+ * ctrl_port and every session that is not held by an async request, and
+ * runs the handlers itself, as httpd does. Sessions are blocking sockets
+ * with send_wait_timeout and recv_wait_timeout, kept open between requests.
+ * A handler error closes its session through close_fn. When all
+ * max_open_sockets are taken, lru_purge_enable closes the least recently
+ * used session that no async request holds.
+ *
+ * WebSocket: the upgrade is answered before the handler is called with
+ * HTTP_GET. Every frame after that has its header read by the server, then
+ * goes to the handler, which reads the payload with httpd_ws_recv_frame().
+ * Ping and close are answered here unless handle_ws_control_frames is set.
+ *
+ * Not implemented: request bodies beyond discarding them, URI wildcards,
+ * fragmented WebSocket messages, httpd_stop().
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <errno.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/select.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_http_server.h"
+
+static const char *TAG = "httpd";
+
+#define WS_GUID             "258EAFA5-E914-47DA-95CA-C5AB0DC85B11"
+#define WS_OPCODE_MASK      0x0F
+#define WS_FIN              0x80
+#define WS_MASK             0x80
+
+typedef enum {
+    CTRL_CLOSE,                 /* httpd_sess_trigger_close() */
+    CTRL_WAKE,                  /* an async request let go of its session */
+} ctrl_type_t;
+
+typedef struct {
+    ctrl_type_t type;
+    int fd;
+} ctrl_msg_t;
+
+typedef struct {
+    int fd;                     /* -1 when the slot is free */
+    bool busy;                  /* held by an async request */
+    const httpd_uri_t *ws_uri;  /* set once upgraded to WebSocket */
+    uint64_t lru;
+    void *ctx;
+    httpd_free_ctx_fn_t free_ctx;
+    char buf[HTTPD_MAX_REQ_HDR_LEN];
+    size_t buf_len;             /* received and not yet parsed */
+} session_t;
+
+typedef struct {
+    httpd_config_t config;
+    int listen_fd;
+    int ctrl_fd;
+    httpd_uri_t *uris;
+    size_t uri_num;
+    session_t *sessions;
+    pthread_mutex_t lock;
+    uint64_t lru_counter;
+} server_t;
+
+typedef struct {
+    const char *field;
+    const char *value;
+} resp_hdr_t;
+
+/* req->aux: the parsed request and the response being built */
+typedef struct {
+    server_t *server;
+    session_t *sess;
+    int fd;
+    char head[HTTPD_MAX_REQ_HDR_LEN + 1];   /* the request head, NUL at the end of every line */
+    size_t head_len;
+    const char *query;          /* inside the URI, NULL without one */
+    const char *status;
+    const char *type;
+    resp_hdr_t *hdrs;
+    size_t hdr_num;
+    bool chunked;               /* chunked response header sent */
+    /* WebSocket frame being received */
+    httpd_ws_type_t ws_type;
+    bool ws_final;
+    bool ws_masked;
+    uint8_t ws_mask[4];
+    size_t ws_len;
+    size_t ws_read;
+} req_aux_t;
+
+uint16_t httpd_host_default_port(void)
+{
+    const char *env = getenv("HOST_HTTP_PORT");
+
+    return env && atoi(env) > 0 ? atoi(env) : CONFIG_HOST_HTTP_PORT;
+}
+
+/* Sockets */
+
+static int send_all(int fd, const void *buf, size_t len)
+{
+    const uint8_t *p = (const uint8_t *)buf;
+
+    while (len) {
+        ssize_t sent = send(fd, p, len, MSG_NOSIGNAL);
+        if (sent < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            ESP_LOGW(TAG, "send on %d: %s", fd, strerror(errno));
+            return -1;
+        }
+        p += sent;
+        len -= sent;
+    }
+    return 0;
+}
+
+/* Read exactly len bytes, first from what the session already buffered */
+static int recv_all(session_t *s, int fd, void *buf, size_t len)
+{
+    uint8_t *p = (uint8_t *)buf;
+    size_t n = s->buf_len < len ? s->buf_len : len;
+
+    memcpy(p, s->buf, n);
+    memmove(s->buf, s->buf + n, s->buf_len - n);
+    s->buf_len -= n;
+    p += n;
+    len -= n;
+    while (len) {
+        ssize_t got = recv(fd, p, len, 0);
+        if (got <= 0) {
+            if (got < 0 && errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+        p += got;
+        len -= got;
+    }
+    return 0;
+}
+
+static void ctrl_send(server_t *server, ctrl_type_t type, int fd)
+{
+    struct sockaddr_in addr = {
+        .sin_family = AF_INET,
+        .sin_port = htons(server->config.ctrl_port),
+        .sin_addr.s_addr = htonl(INADDR_LOOPBACK),
+    };
+    ctrl_msg_t msg = { .type = type, .fd = fd };
+    int sock = socket(AF_INET, SOCK_DGRAM, 0);
+
+    sendto(sock, &msg, sizeof(msg), 0, (struct sockaddr *)&addr, sizeof(addr));
+    close(sock);
+}
+
+/* Sessions */
+
+static session_t *session_find(server_t *server, int fd)
+{
+    for (size_t i = 0; i < server->config.max_open_sockets; i++) {
+        if (server->sessions[i].fd == fd && fd >= 0) {
+            return &server->sessions[i];
+        }
+    }
+    return NULL;
+}
+
+/* The slot is freed under the lock, close_fn runs outside it since it may call into the components */
+static void session_close(server_t *server, session_t *s)
+{
+    pthread_mutex_lock(&server->lock);
+    int fd = s->fd;
+    void *ctx = s->ctx;
+    httpd_free_ctx_fn_t free_ctx = s->free_ctx;
+    s->fd = -1;
+    s->ctx = NULL;
+    pthread_mutex_unlock(&server->lock);
+    if (fd < 0) {
+        return;
+    }
+
+    ESP_LOGD(TAG, "closing %d", fd);
+    if (ctx) {
+        free_ctx ? free_ctx(ctx) : free(ctx);
+    }
+    if (server->config.close_fn) {
+        server->config.close_fn(server, fd);
+    } else {
+        close(fd);
+    }
+}
+
+static void session_accept(server_t *server)
+{
+    int fd = accept(server->listen_fd, NULL, NULL);
+    if (fd < 0) {
+        return;
+    }
+
+    session_t *free_slot = NULL, *lru = NULL;
+    pthread_mutex_lock(&server->lock);
+    for (size_t i = 0; i < server->config.max_open_sockets; i++) {
+        session_t *s = &server->sessions[i];
+        if (s->fd < 0) {
+            free_slot = free_slot ? free_slot : s;
+        } else if (!s->busy && (!lru || s->lru < lru->lru)) {
+            lru = s;
+        }
+    }
+    pthread_mutex_unlock(&server->lock);
+    if (!free_slot && server->config.lru_purge_enable && lru) {
+        ESP_LOGD(TAG, "all sessions taken, closing the least recently used %d", lru->fd);
+        session_close(server, lru);
+        free_slot = lru;
+    }
+    if (!free_slot) {
+        ESP_LOGW(TAG, "all %u sessions taken, refusing %d", server->config.max_open_sockets, fd);
+        close(fd);
+        return;
+    }
+
+    struct timeval snd = { .tv_sec = server->config.send_wait_timeout };
+    struct timeval rcv = { .tv_sec = server->config.recv_wait_timeout };
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &snd, sizeof(snd));
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &rcv, sizeof(rcv));
+
+    pthread_mutex_lock(&server->lock);
+    free_slot->busy = false;
+    free_slot->ws_uri = NULL;
+    free_slot->buf_len = 0;
+    free_slot->lru = ++server->lru_counter;
+    free_slot->fd = fd;
+    pthread_mutex_unlock(&server->lock);
+    ESP_LOGD(TAG, "new session %d", fd);
+}
+
+/* Request head */
+
+static char *head_end(char *buf, size_t len)
+{
+    for (size_t i = 3; i < len; i++) {
+        if (!memcmp(buf + i - 3, "\r\n\r\n", 4)) {
+            return buf + i + 1;
+        }
+    }
+    return NULL;
+}
+
+/* Receive up to the blank line; 1 when the peer closed or the head is too long, -1 on error */
+static int read_head(session_t *s, req_aux_t *aux)
+{
+    char *end;
+
+    while (!(end = head_end(s->buf, s->buf_len))) {
+        if (s->buf_len == sizeof(s->buf)) {
+            ESP_LOGW(TAG, "request head on %d over %u bytes", s->fd, (unsigned)sizeof(s->buf));
+            return 1;
+        }
+        ssize_t got = recv(s->fd, s->buf + s->buf_len, sizeof(s->buf) - s->buf_len, 0);
+        if (got <= 0) {
+            if (got < 0 && errno == EINTR) {
+                continue;
+            }
+            return got == 0 ? 1 : -1;
+        }
+        s->buf_len += got;
+    }
+
+    aux->head_len = end - s->buf;
+    memcpy(aux->head, s->buf, aux->head_len);
+    aux->head[aux->head_len] = '\0';
+    memmove(s->buf, end, s->buf_len - aux->head_len);
+    s->buf_len -= aux->head_len;
+    for (size_t i = 0; i + 1 < aux->head_len; i++) {
+        if (aux->head[i] == '\r' && aux->head[i + 1] == '\n') {
+            aux->head[i] = aux->head[i + 1] = '\0';
+        }
+    }
+    return 0;
+}
+
+static const char *head_value(const req_aux_t *aux, const char *field)
+{
+    size_t field_len = strlen(field);
+    const char *line = aux->head + strlen(aux->head) + 2;      /* past the request line */
+
+    while (line < aux->head + aux->head_len && *line) {
+        if (!strncasecmp(line, field, field_len) && line[field_len] == ':') {
+            const char *value = line + field_len + 1;
+            while (*value == ' ') {
+                value++;
+            }
+            return value;
+        }
+        line += strlen(line) + 2;
+    }
+    return NULL;
+}
+
+static int parse_method(const char *name)
+{
+    static const struct {
+        const char *name;
+        int method;
+    } methods[] = {
+        { "GET", HTTP_GET }, { "HEAD", HTTP_HEAD }, { "POST", HTTP_POST }, { "PUT", HTTP_PUT }, { "DELETE", HTTP_DELETE },
+    };
+
+    for (size_t i = 0; i < sizeof(methods) / sizeof(methods[0]); i++) {
+        if (!strcmp(name, methods[i].name)) {
+            return methods[i].method;
+        }
+    }
+    return -1;
+}
+
+/* Responses */
+
+static esp_err_t send_head(httpd_req_t *r, const char *length_hdr)
+{
+    req_aux_t *aux = (req_aux_t *)r->aux;
+    char head[HTTPD_MAX_REQ_HDR_LEN];
+    int len = snprintf(head, sizeof(head), "HTTP/1.1 %s\r\nContent-Type: %s\r\n%s\r\n",
+                       aux->status ? aux->status : HTTPD_200, aux->type ? aux->type : HTTPD_TYPE_TEXT, length_hdr);
+
+    for (size_t i = 0; i < aux->hdr_num && len < (int)sizeof(head); i++) {
+        len += snprintf(head + len, sizeof(head) - len, "%s: %s\r\n", aux->hdrs[i].field, aux->hdrs[i].value);
+    }
+    len += snprintf(head + len, len < (int)sizeof(head) ? sizeof(head) - len : 0, "\r\n");
+    if (len >= (int)sizeof(head)) {
+        return ESP_ERR_HTTPD_RESP_HDR;
+    }
+    return send_all(aux->fd, head, len) ? ESP_ERR_HTTPD_RESP_SEND : ESP_OK;
+}
+
+esp_err_t httpd_resp_set_status(httpd_req_t *r, const char *status)
+{
+    ((req_aux_t *)r->aux)->status = status;
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_set_type(httpd_req_t *r, const char *type)
+{
+    ((req_aux_t *)r->aux)->type = type;
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_set_hdr(httpd_req_t *r, const char *field, const char *value)
+{
+    req_aux_t *aux = (req_aux_t *)r->aux;
+
+    if (aux->hdr_num >= aux->server->config.max_resp_headers) {
+        return ESP_ERR_HTTPD_RESP_HDR;
+    }
+    aux->hdrs[aux->hdr_num].field = field;
+    aux->hdrs[aux->hdr_num].value = value;
+    aux->hdr_num++;
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_send(httpd_req_t *r, const char *buf, ssize_t buf_len)
+{
+    req_aux_t *aux = (req_aux_t *)r->aux;
+    char length_hdr[40];
+
+    if (buf_len == HTTPD_RESP_USE_STRLEN) {
+        buf_len = buf ? strlen(buf) : 0;
+    }
+    snprintf(length_hdr, sizeof(length_hdr), "Content-Length: %d", (int)buf_len);
+    esp_err_t ret = send_head(r, length_hdr);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    if (buf_len && send_all(aux->fd, buf, buf_len)) {
+        return ESP_ERR_HTTPD_RESP_SEND;
+    }
+    return ESP_OK;
+}
+
+/* The head on the first call, then the size line, the data and a CRLF, one send each as httpd does */
+esp_err_t httpd_resp_send_chunk(httpd_req_t *r, const char *buf, ssize_t buf_len)
+{
+    req_aux_t *aux = (req_aux_t *)r->aux;
+    char size_line[12];
+
+    if (buf_len == HTTPD_RESP_USE_STRLEN) {
+        buf_len = buf ? strlen(buf) : 0;
+    }
+    if (!aux->chunked) {
+        esp_err_t ret = send_head(r, "Transfer-Encoding: chunked");
+        if (ret != ESP_OK) {
+            return ret;
+        }
+        aux->chunked = true;
+    }
+    int n = snprintf(size_line, sizeof(size_line), "%x\r\n", (unsigned)buf_len);
+    if (send_all(aux->fd, size_line, n) || (buf_len && send_all(aux->fd, buf, buf_len))
+            || send_all(aux->fd, "\r\n", 2)) {
+        return ESP_ERR_HTTPD_RESP_SEND;
+    }
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_send_err(httpd_req_t *req, httpd_err_code_t error, const char *msg)
+{
+    static const struct {
+        const char *status;
+        const char *msg;
+    } errors[HTTPD_ERR_CODE_MAX] = {
+        [HTTPD_500_INTERNAL_SERVER_ERROR] = { HTTPD_500, "Server has encountered an unexpected error" },
+        [HTTPD_501_METHOD_NOT_IMPLEMENTED] = { "501 Method Not Implemented", "Request method is not supported by server" },
+        [HTTPD_505_VERSION_NOT_SUPPORTED] = { "505 Version Not Supported", "HTTP version not supported by server" },
+        [HTTPD_400_BAD_REQUEST] = { "400 Bad Request", "Bad request syntax" },
+        [HTTPD_401_UNAUTHORIZED] = { "401 Unauthorized", "No permission -- see authorization schemes" },
+        [HTTPD_403_FORBIDDEN] = { "403 Forbidden", "Request forbidden -- authorization will not help" },
+        [HTTPD_404_NOT_FOUND] = { HTTPD_404, "Nothing matches the given URI" },
+        [HTTPD_405_METHOD_NOT_ALLOWED] = { "405 Method Not Allowed", "Specified method is invalid for this resource" },
+        [HTTPD_408_REQ_TIMEOUT] = { "408 Request Timeout", "Server closed this connection" },
+        [HTTPD_411_LENGTH_REQUIRED] = { "411 Length Required", "Client must specify Content-Length" },
+        [HTTPD_414_URI_TOO_LONG] = { "414 URI Too Long", "URI is too long" },
+        [HTTPD_431_REQ_HDR_FIELDS_TOO_LARGE] = { "431 Request Header Fields Too Large", "Header fields are too long" },
+    };
+
+    if (error >= HTTPD_ERR_CODE_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    httpd_resp_set_status(req, errors[error].status);
+    httpd_resp_set_type(req, HTTPD_TYPE_TEXT);
+    return httpd_resp_sendstr(req, msg ? msg : errors[error].msg);
+}
+
+/* Requests */
+
+int httpd_req_to_sockfd(httpd_req_t *r)
+{
+    return r && r->aux ? ((req_aux_t *)r->aux)->fd : -1;
+}
+
+esp_err_t httpd_req_get_hdr_value_str(httpd_req_t *r, const char *field, char *val, size_t val_size)
+{
+    const char *value = head_value((req_aux_t *)r->aux, field);
+
+    if (!value) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    snprintf(val, val_size, "%s", value);
+    return strlen(value) < val_size ? ESP_OK : ESP_ERR_HTTPD_RESULT_TRUNC;
+}
+
+esp_err_t httpd_req_get_url_query_str(httpd_req_t *r, char *buf, size_t buf_len)
+{
+    const char *query = ((req_aux_t *)r->aux)->query;
+
+    if (!query) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    snprintf(buf, buf_len, "%s", query);
+    return strlen(query) < buf_len ? ESP_OK : ESP_ERR_HTTPD_RESULT_TRUNC;
+}
+
+esp_err_t httpd_query_key_value(const char *qry, const char *key, char *val, size_t val_size)
+{
+    size_t key_len = strlen(key);
+
+    while (qry && *qry) {
+        const char *end = strchr(qry, '&');
+        size_t len = end ? (size_t)(end - qry) : strlen(qry);
+        if (len > key_len && !strncmp(qry, key, key_len) && qry[key_len] == '=') {
+            size_t value_len = len - key_len - 1;
+            snprintf(val, val_size, "%.*s", (int)value_len, qry + key_len + 1);
+            return value_len < val_size ? ESP_OK : ESP_ERR_HTTPD_RESULT_TRUNC;
+        }
+        qry = end ? end + 1 : NULL;
+    }
+    return ESP_ERR_NOT_FOUND;
+}
+
+/* The copy and its session belong to the caller until httpd_req_async_handler_complete() */
+esp_err_t httpd_req_async_handler_begin(httpd_req_t *r, httpd_req_t **out)
+{
+    req_aux_t *aux = (req_aux_t *)r->aux;
+    httpd_req_t *copy = (httpd_req_t *)malloc(sizeof(httpd_req_t));
+    req_aux_t *aux_copy = (req_aux_t *)malloc(sizeof(req_aux_t));
+    resp_hdr_t *hdrs = (resp_hdr_t *)calloc(aux->server->config.max_resp_headers, sizeof(resp_hdr_t));
+
+    if (!copy || !aux_copy || !hdrs) {
+        free(copy);
+        free(aux_copy);
+        free(hdrs);
+        return ESP_ERR_NO_MEM;
+    }
+    memcpy(copy, r, sizeof(httpd_req_t));
+    memcpy(aux_copy, aux, sizeof(req_aux_t));
+    memcpy(hdrs, aux->hdrs, aux->hdr_num * sizeof(resp_hdr_t));
+    if (aux->query) {
+        aux_copy->query = aux_copy->head + (aux->query - aux->head);
+    }
+    aux_copy->hdrs = hdrs;
+    copy->aux = aux_copy;
+
+    pthread_mutex_lock(&aux->server->lock);
+    aux->sess->busy = true;
+    pthread_mutex_unlock(&aux->server->lock);
+    *out = copy;
+    return ESP_OK;
+}
+
+esp_err_t httpd_req_async_handler_complete(httpd_req_t *r)
+{
+    req_aux_t *aux = (req_aux_t *)r->aux;
+    server_t *server = aux->server;
+
+    pthread_mutex_lock(&server->lock);
+    if (aux->sess->fd == aux->fd) {
+        aux->sess->busy = false;
+        aux->sess->lru = ++server->lru_counter;
+    }
+    pthread_mutex_unlock(&server->lock);
+    ctrl_send(server, CTRL_WAKE, aux->fd);
+    free(aux->hdrs);
+    free(aux);
+    free(r);
+    return ESP_OK;
+}
+
+/* WebSocket */
+
+typedef struct {
+    uint32_t h[5];
+    uint64_t len;
+    uint8_t block[64];
+} sha1_t;
+
+static uint32_t rol32(uint32_t x, int n)
+{
+    return (x << n) | (x >> (32 - n));
+}
+
+static void sha1_block(sha1_t *c)
+{
+    uint32_t w[80], a = c->h[0], b = c->h[1], d = c->h[3], e = c->h[4], cc = c->h[2];
+
+    for (int i = 0; i < 16; i++) {
+        w[i] = (uint32_t)c->block[i * 4] << 24 | c->block[i * 4 + 1] << 16 | c->block[i * 4 + 2] << 8 | c->block[i * 4 + 3];
+    }
+    for (int i = 16; i < 80; i++) {
+        w[i] = rol32(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+    }
+    for (int i = 0; i < 80; i++) {
+        uint32_t f, k;
+        if (i < 20) {
+            f = (b & cc) | (~b & d);
+            k = 0x5A827999;
+        } else if (i < 40) {
+            f = b ^ cc ^ d;
+            k = 0x6ED9EBA1;
+        } else if (i < 60) {
+            f = (b & cc) | (b & d) | (cc & d);
+            k = 0x8F1BBCDC;
+        } else {
+            f = b ^ cc ^ d;
+            k = 0xCA62C1D6;
+        }
+        uint32_t t = rol32(a, 5) + f + e + k + w[i];
+        e = d;
+        d = cc;
+        cc = rol32(b, 30);
+        b = a;
+        a = t;
+    }
+    c->h[0] += a;
+    c->h[1] += b;
+    c->h[2] += cc;
+    c->h[3] += d;
+    c->h[4] += e;
+}
+
+static void sha1(const char *msg, size_t len, uint8_t digest[20])
+{
+    sha1_t c = { .h = { 0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0 } };
+    size_t used = 0;
+
+    for (size_t i = 0; i < len; i++) {
+        c.block[used++] = msg[i];
+        if (used == 64) {
+            sha1_block(&c);
+            used = 0;
+        }
+    }
+    c.block[used++] = 0x80;
+    if (used > 56) {
+        memset(c.block + used, 0, 64 - used);
+        sha1_block(&c);
+        used = 0;
+    }
+    memset(c.block + used, 0, 56 - used);
+    for (int i = 0; i < 8; i++) {
+        c.block[56 + i] = (uint64_t)len * 8 >> (56 - i * 8);
+    }
+    sha1_block(&c);
+    for (int i = 0; i < 20; i++) {
+        digest[i] = c.h[i / 4] >> (24 - (i % 4) * 8);
+    }
+}
+
+static void base64(const uint8_t *in, size_t len, char *out)
+{
+    static const char table[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    for (size_t i = 0; i < len; i += 3) {
+        uint32_t v = in[i] << 16 | (i + 1 < len ? in[i + 1] << 8 : 0) | (i + 2 < len ? in[i + 2] : 0);
+        *out++ = table[v >> 18 & 63];
+        *out++ = table[v >> 12 & 63];
+        *out++ = i + 1 < len ? table[v >> 6 & 63] : '=';
+        *out++ = i + 2 < len ? table[v & 63] : '=';
+    }
+    *out = '\0';
+}
+
+static esp_err_t ws_handshake(req_aux_t *aux)
+{
+    const char *key = head_value(aux, "Sec-WebSocket-Key");
+    char accept_src[64 + sizeof(WS_GUID)];
+    uint8_t digest[20];
+    char accept[32];
+    char resp[160];
+
+    if (!key || strlen(key) > 64) {
+        return ESP_FAIL;
+    }
+    snprintf(accept_src, sizeof(accept_src), "%s%s", key, WS_GUID);
+    sha1(accept_src, strlen(accept_src), digest);
+    base64(digest, sizeof(digest), accept);
+    int len = snprintf(resp, sizeof(resp), "HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\n"
+                       "Connection: Upgrade\r\nSec-WebSocket-Accept: %s\r\n\r\n", accept);
+    return send_all(aux->fd, resp, len) ? ESP_FAIL : ESP_OK;
+}
+
+static int ws_send(int fd, httpd_ws_type_t type, const uint8_t *payload, size_t len)
+{
+    uint8_t head[10] = { WS_FIN | type };
+    size_t head_len = 2;
+
+    if (len < 126) {
+        head[1] = len;
+    } else if (len < 65536) {
+        head[1] = 126;
+        head[2] = len >> 8;
+        head[3] = len;
+        head_len = 4;
+    } else {
+        head[1] = 127;
+        for (int i = 0; i < 8; i++) {
+            head[2 + i] = (uint64_t)len >> (56 - i * 8);
+        }
+        head_len = 10;
+    }
+    return send_all(fd, head, head_len) || (len && send_all(fd, payload, len)) ? -1 : 0;
+}
+
+static int ws_read_header(session_t *s, req_aux_t *aux)
+{
+    uint8_t head[2], ext[8];
+
+    if (recv_all(s, aux->fd, head, 2)) {
+        return -1;
+    }
+    aux->ws_final = head[0] & WS_FIN;
+    aux->ws_type = (httpd_ws_type_t)(head[0] & WS_OPCODE_MASK);
+    aux->ws_masked = head[1] & WS_MASK;
+    aux->ws_len = head[1] & 0x7F;
+    aux->ws_read = 0;
+    if (aux->ws_len == 126) {
+        if (recv_all(s, aux->fd, ext, 2)) {
+            return -1;
+        }
+        aux->ws_len = ext[0] << 8 | ext[1];
+    } else if (aux->ws_len == 127) {
+        if (recv_all(s, aux->fd, ext, 8)) {
+            return -1;
+        }
+        aux->ws_len = 0;
+        for (int i = 0; i < 8; i++) {
+            aux->ws_len = aux->ws_len << 8 | ext[i];
+        }
+    }
+    return aux->ws_masked ? recv_all(s, aux->fd, aux->ws_mask, 4) : 0;
+}
+
+esp_err_t httpd_ws_recv_frame(httpd_req_t *req, httpd_ws_frame_t *pkt, size_t max_len)
+{
+    req_aux_t *aux = (req_aux_t *)req->aux;
+
+    pkt->type = aux->ws_type;
+    pkt->final = aux->ws_final;
+    pkt->fragmented = false;
+    if (max_len == 0) {
+        pkt->len = aux->ws_len;
+        return ESP_OK;
+    }
+    size_t n = aux->ws_len - aux->ws_read;
+    n = n < max_len ? n : max_len;
+    if (recv_all(aux->sess, aux->fd, pkt->payload, n)) {
+        return ESP_FAIL;
+    }
+    for (size_t i = 0; aux->ws_masked && i < n; i++) {
+        pkt->payload[i] ^= aux->ws_mask[(aux->ws_read + i) % 4];
+    }
+    aux->ws_read += n;
+    pkt->len = n;
+    return ESP_OK;
+}
+
+httpd_ws_client_info_t httpd_ws_get_fd_info(httpd_handle_t hd, int fd)
+{
+    server_t *server = (server_t *)hd;
+
+    pthread_mutex_lock(&server->lock);
+    session_t *s = session_find(server, fd);
+    httpd_ws_client_info_t info = !s ? HTTPD_WS_CLIENT_INVALID
+                                  : s->ws_uri ? HTTPD_WS_CLIENT_WEBSOCKET : HTTPD_WS_CLIENT_HTTP;
+    pthread_mutex_unlock(&server->lock);
+    return info;
+}
+
+/* Serving */
+
+static void req_init(httpd_req_t *r, req_aux_t *aux, server_t *server, session_t *s, resp_hdr_t *hdrs)
+{
+    memset(r, 0, sizeof(*r));
+    memset(aux, 0, sizeof(*aux));
+    aux->server = server;
+    aux->sess = s;
+    aux->fd = s->fd;
+    aux->hdrs = hdrs;
+    r->handle = server;
+    r->aux = aux;
+    r->sess_ctx = s->ctx;
+    r->free_ctx = s->free_ctx;
+}
+
+static void req_done(httpd_req_t *r, session_t *s)
+{
+    s->ctx = r->sess_ctx;
+    s->free_ctx = r->free_ctx;
+}
+
+/* A frame on an upgraded session; false to close it */
+static bool serve_ws_frame(server_t *server, session_t *s, httpd_req_t *r, req_aux_t *aux)
+{
+    const httpd_uri_t *uri = s->ws_uri;
+
+    if (ws_read_header(s, aux)) {
+        return false;
+    }
+    bool control = aux->ws_type == HTTPD_WS_TYPE_CLOSE || aux->ws_type == HTTPD_WS_TYPE_PING
+                   || aux->ws_type == HTTPD_WS_TYPE_PONG;
+    if (control && !uri->handle_ws_control_frames) {
+        uint8_t payload[125];
+        httpd_ws_frame_t pkt = { .payload = payload };
+        if (aux->ws_len > sizeof(payload) || httpd_ws_recv_frame(r, &pkt, sizeof(payload)) != ESP_OK) {
+            return false;
+        }
+        if (aux->ws_type == HTTPD_WS_TYPE_PING) {
+            return ws_send(aux->fd, HTTPD_WS_TYPE_PONG, payload, pkt.len) == 0;
+        }
+        if (aux->ws_type == HTTPD_WS_TYPE_CLOSE) {
+            ws_send(aux->fd, HTTPD_WS_TYPE_CLOSE, NULL, 0);
+            return false;
+        }
+        return true;
+    }
+
+    /* a frame carries no method of its own, handlers tell it from the handshake by HTTP_GET */
+    r->method = HTTP_DELETE;
+    strncpy((char *)r->uri, uri->uri, HTTPD_MAX_URI_LEN);
+    r->user_ctx = uri->user_ctx;
+    esp_err_t ret = uri->handler(r);
+    req_done(r, s);
+    if (ret != ESP_OK) {
+        return false;
+    }
+    /* whatever the handler left of the payload */
+    uint8_t rest[256];
+    while (aux->ws_read < aux->ws_len) {
+        size_t n = aux->ws_len - aux->ws_read < sizeof(rest) ? aux->ws_len - aux->ws_read : sizeof(rest);
+        if (recv_all(s, aux->fd, rest, n)) {
+            return false;
+        }
+        aux->ws_read += n;
+    }
+    return true;
+}
+
+/* One request on a session; false to close it */
+static bool serve_request(server_t *server, session_t *s, httpd_req_t *r, req_aux_t *aux)
+{
+    int ret = read_head(s, aux);
+    if (ret) {
+        return false;
+    }
+
+    char *method_name = aux->head;
+    char *path = strchr(method_name, ' ');
+    if (!path) {
+        httpd_resp_send_err(r, HTTPD_400_BAD_REQUEST, NULL);
+        return false;
+    }
+    *path++ = '\0';
+    char *version = strchr(path, ' ');
+    if (version) {
+        *version = '\0';
+    }
+    if (strlen(path) > HTTPD_MAX_URI_LEN) {
+        httpd_resp_send_err(r, HTTPD_414_URI_TOO_LONG, NULL);
+        return false;
+    }
+    strcpy((char *)r->uri, path);
+    char *query = strchr(path, '?');
+    size_t path_len = query ? (size_t)(query - path) : strlen(path);
+    aux->query = query ? query + 1 : NULL;
+    r->method = parse_method(method_name);
+    const char *length = head_value(aux, "Content-Length");
+    r->content_len = length ? strtoul(length, NULL, 10) : 0;
+
+    const httpd_uri_t *uri = NULL;
+    bool path_found = false;
+    for (size_t i = 0; i < server->uri_num; i++) {
+        if (strlen(server->uris[i].uri) == path_len && !strncmp(server->uris[i].uri, path, path_len)) {
+            path_found = true;
+            if ((int)server->uris[i].method == r->method) {
+                uri = &server->uris[i];
+                break;
+            }
+        }
+    }
+    if (!uri) {
+        ESP_LOGD(TAG, "no handler for %s %s", method_name, path);
+        return httpd_resp_send_err(r, path_found ? HTTPD_405_METHOD_NOT_ALLOWED : HTTPD_404_NOT_FOUND, NULL) == ESP_OK;
+    }
+
+    r->user_ctx = uri->user_ctx;
+    const char *upgrade = head_value(aux, "Upgrade");
+    if (uri->is_websocket && upgrade && !strcasecmp(upgrade, "websocket")) {
+        if (ws_handshake(aux) != ESP_OK) {
+            return false;
+        }
+        pthread_mutex_lock(&server->lock);
+        s->ws_uri = uri;
+        pthread_mutex_unlock(&server->lock);
+    }
+
+    esp_err_t err = uri->handler(r);
+    req_done(r, s);
+    if (err != ESP_OK) {
+        ESP_LOGD(TAG, "handler of %s failed on %d", path, aux->fd);
+        return false;
+    }
+
+    /* the body no handler read, unless an async request now holds the session */
+    pthread_mutex_lock(&server->lock);
+    bool busy = s->busy;
+    pthread_mutex_unlock(&server->lock);
+    size_t left = r->content_len;
+    char discard[256];
+    while (!busy && left) {
+        size_t n = left < sizeof(discard) ? left : sizeof(discard);
+        if (recv_all(s, aux->fd, discard, n)) {
+            return false;
+        }
+        left -= n;
+    }
+    return true;
+}
+
+static void serve_session(server_t *server, session_t *s, resp_hdr_t *hdrs)
+{
+    static httpd_req_t r;
+    static req_aux_t aux;
+
+    req_init(&r, &aux, server, s, hdrs);
+    pthread_mutex_lock(&server->lock);
+    s->lru = ++server->lru_counter;
+    pthread_mutex_unlock(&server->lock);
+    bool keep = s->ws_uri ? serve_ws_frame(server, s, &r, &aux) : serve_request(server, s, &r, &aux);
+    if (!keep) {
+        session_close(server, s);
+    }
+}
+
+static void ctrl_handle(server_t *server)
+{
+    ctrl_msg_t msg;
+
+    while (recv(server->ctrl_fd, &msg, sizeof(msg), MSG_DONTWAIT) == sizeof(msg)) {
+        if (msg.type == CTRL_CLOSE) {
+            session_t *s = NULL;
+            pthread_mutex_lock(&server->lock);
+            s = session_find(server, msg.fd);
+            pthread_mutex_unlock(&server->lock);
+            if (s) {
+                session_close(server, s);
+            }
+        }
+    }
+}
+
+static void server_task(void *arg)
+{
+    server_t *server = (server_t *)arg;
+    resp_hdr_t *hdrs = (resp_hdr_t *)calloc(server->config.max_resp_headers, sizeof(resp_hdr_t));
+
+    while (1) {
+        fd_set readable;
+        int max_fd = server->listen_fd > server->ctrl_fd ? server->listen_fd : server->ctrl_fd;
+
+        FD_ZERO(&readable);
+        FD_SET(server->listen_fd, &readable);
+        FD_SET(server->ctrl_fd, &readable);
+        pthread_mutex_lock(&server->lock);
+        for (size_t i = 0; i < server->config.max_open_sockets; i++) {
+            session_t *s = &server->sessions[i];
+            if (s->fd >= 0 && !s->busy) {
+                FD_SET(s->fd, &readable);
+                max_fd = s->fd > max_fd ? s->fd : max_fd;
+            }
+        }
+        pthread_mutex_unlock(&server->lock);
+
+        if (select(max_fd + 1, &readable, NULL, NULL, NULL) < 0) {
+            if (errno != EINTR && errno != EBADF) {
+                ESP_LOGE(TAG, "select: %s", strerror(errno));
+                vTaskDelay(pdMS_TO_TICKS(10));
+            }
+            continue;
+        }
+        if (FD_ISSET(server->ctrl_fd, &readable)) {
+            ctrl_handle(server);
+            continue;           /* the sessions may have changed under the fd set */
+        }
+        for (size_t i = 0; i < server->config.max_open_sockets; i++) {
+            session_t *s = &server->sessions[i];
+            if (s->fd >= 0 && !s->busy && FD_ISSET(s->fd, &readable)) {
+                serve_session(server, s, hdrs);
+            }
+        }
+        if (FD_ISSET(server->listen_fd, &readable)) {
+            session_accept(server);
+        }
+    }
+}
+
+static int bind_socket(int type, uint16_t port, int backlog)
+{
+    struct sockaddr_in addr = {
+        .sin_family = AF_INET,
+        .sin_port = htons(port),
+        .sin_addr.s_addr = htonl(type == SOCK_STREAM ? INADDR_ANY : INADDR_LOOPBACK),
+    };
+    int fd = socket(AF_INET, type, 0);
+    int reuse = 1;
+
+    if (fd < 0) {
+        return -1;
+    }
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0 || (type == SOCK_STREAM && listen(fd, backlog) < 0)) {
+        ESP_LOGE(TAG, "port %u: %s", port, strerror(errno));
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+esp_err_t httpd_start(httpd_handle_t *handle, const httpd_config_t *config)
+{
+    server_t *server = (server_t *)calloc(1, sizeof(server_t));
+
+    if (!server) {
+        return ESP_ERR_HTTPD_ALLOC_MEM;
+    }
+    server->config = *config;
+    server->uris = (httpd_uri_t *)calloc(config->max_uri_handlers, sizeof(httpd_uri_t));
+    server->sessions = (session_t *)calloc(config->max_open_sockets, sizeof(session_t));
+    pthread_mutex_init(&server->lock, NULL);
+    for (size_t i = 0; server->sessions && i < config->max_open_sockets; i++) {
+        server->sessions[i].fd = -1;
+    }
+    server->listen_fd = bind_socket(SOCK_STREAM, config->server_port, config->backlog_conn);
+    server->ctrl_fd = bind_socket(SOCK_DGRAM, config->ctrl_port, 0);
+    if (!server->uris || !server->sessions || server->listen_fd < 0 || server->ctrl_fd < 0) {
+        goto fail;
+    }
+    if (xTaskCreate(server_task, "httpd", config->stack_size, server, config->task_priority, NULL) != pdPASS) {
+        goto fail;
+    }
+    *handle = server;
+    return ESP_OK;
+
+fail:
+    if (server->listen_fd >= 0) {
+        close(server->listen_fd);
+    }
+    if (server->ctrl_fd >= 0) {
+        close(server->ctrl_fd);
+    }
+    free(server->uris);
+    free(server->sessions);
+    free(server);
+    return ESP_ERR_HTTPD_TASK;
+}
+
+esp_err_t httpd_register_uri_handler(httpd_handle_t handle, const httpd_uri_t *uri_handler)
+{
+    server_t *server = (server_t *)handle;
+
+    for (size_t i = 0; i < server->uri_num; i++) {
+        if (!strcmp(server->uris[i].uri, uri_handler->uri) && server->uris[i].method == uri_handler->method) {
+            return ESP_ERR_HTTPD_HANDLER_EXISTS;
+        }
+    }
+    if (server->uri_num == server->config.max_uri_handlers) {
+        return ESP_ERR_HTTPD_HANDLERS_FULL;
+    }
+    /* registered before the first request, the server task reads the table without the lock */
+    server->uris[server->uri_num] = *uri_handler;
+    server->uris[server->uri_num].uri = strdup(uri_handler->uri);
+    server->uri_num++;
+    return ESP_OK;
+}
+
+esp_err_t httpd_sess_trigger_close(httpd_handle_t handle, int sockfd)
+{
+    if (httpd_ws_get_fd_info(handle, sockfd) == HTTPD_WS_CLIENT_INVALID) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    ctrl_send((server_t *)handle, CTRL_CLOSE, sockfd);
+    return ESP_OK;
+}
@@ -0,0 +1,160 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* esp_partition on the host: data partitions backed by files, see esp_partition_host.h */
+
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "esp_partition_host.h"
+
+static const char *TAG = "esp_partition_host";
+
+#define PARTITIONS_MAX      4
+#define MAPPINGS_MAX        8
+
+typedef struct {
+    esp_partition_t part;
+    int fd;
+} host_partition_t;
+
+typedef struct {
+    void *addr;                 /* NULL when the slot is free */
+    size_t len;
+} mapping_t;
+
+static host_partition_t s_partitions[PARTITIONS_MAX];
+static size_t s_partition_num;
+static mapping_t s_mappings[MAPPINGS_MAX];
+static pthread_mutex_t s_lock = PTHREAD_MUTEX_INITIALIZER;
+
+esp_err_t esp_partition_host_add(const char *label, const char *path)
+{
+    struct stat st;
+
+    if (s_partition_num == PARTITIONS_MAX) {
+        return ESP_ERR_NO_MEM;
+    }
+    int fd = open(path, O_RDONLY);
+    if (fd < 0 || fstat(fd, &st) < 0) {
+        ESP_LOGE(TAG, "%s: cannot open %s", label, path);
+        if (fd >= 0) {
+            close(fd);
+        }
+        return ESP_ERR_NOT_FOUND;
+    }
+    host_partition_t *p = &s_partitions[s_partition_num++];
+    p->fd = fd;
+    p->part.type = ESP_PARTITION_TYPE_DATA;
+    p->part.subtype = ESP_PARTITION_SUBTYPE_DATA_UNDEFINED;
+    p->part.size = st.st_size;
+    p->part.erase_size = 4096;
+    p->part.readonly = true;
+    snprintf(p->part.label, sizeof(p->part.label), "%s", label);
+    ESP_LOGI(TAG, "partition %s: %s, %u bytes", p->part.label, path, p->part.size);
+    return ESP_OK;
+}
+
+static host_partition_t *host_partition(const esp_partition_t *partition)
+{
+    for (size_t i = 0; i < s_partition_num; i++) {
+        if (&s_partitions[i].part == partition) {
+            return &s_partitions[i];
+        }
+    }
+    return NULL;
+}
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype,
+                                                const char *label)
+{
+    for (size_t i = 0; i < s_partition_num; i++) {
+        const esp_partition_t *p = &s_partitions[i].part;
+        if ((type == ESP_PARTITION_TYPE_ANY || type == p->type)
+                && (subtype == ESP_PARTITION_SUBTYPE_ANY || subtype == p->subtype)
+                && (!label || !strcmp(label, p->label))) {
+            return p;
+        }
+    }
+    return NULL;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t *partition, size_t src_offset, void *dst, size_t size)
+{
+    host_partition_t *p = host_partition(partition);
+
+    if (!p || !dst) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (src_offset > p->part.size || size > p->part.size - src_offset) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    return pread(p->fd, dst, size, src_offset) == (ssize_t)size ? ESP_OK : ESP_FAIL;
+}
+
+/* Offsets are page aligned by the caller on the target (64 KB MMU pages), any offset works here */
+esp_err_t esp_partition_mmap(const esp_partition_t *partition, size_t offset, size_t size,
+                             esp_partition_mmap_memory_t memory, const void **out_ptr,
+                             esp_partition_mmap_handle_t *out_handle)
+{
+    host_partition_t *p = host_partition(partition);
+    size_t page = sysconf(_SC_PAGESIZE);
+
+    if (!p || !out_ptr || !out_handle) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (offset > p->part.size || size > p->part.size - offset) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    size_t base = offset / page * page;
+    size_t len = offset - base + size;
+    void *addr = mmap(NULL, len, PROT_READ, MAP_PRIVATE, p->fd, base);
+    if (addr == MAP_FAILED) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    pthread_mutex_lock(&s_lock);
+    for (uint32_t i = 0; i < MAPPINGS_MAX; i++) {
+        if (!s_mappings[i].addr) {
+            s_mappings[i].addr = addr;
+            s_mappings[i].len = len;
+            pthread_mutex_unlock(&s_lock);
+            *out_ptr = (const uint8_t *)addr + (offset - base);
+            *out_handle = i;
+            return ESP_OK;
+        }
+    }
+    pthread_mutex_unlock(&s_lock);
+    munmap(addr, len);
+    return ESP_ERR_NO_MEM;
+}
+
+void esp_partition_munmap(esp_partition_mmap_handle_t handle)
+{
+    if (handle >= MAPPINGS_MAX) {
+        return;
+    }
+    pthread_mutex_lock(&s_lock);
+    mapping_t m = s_mappings[handle];
+    s_mappings[handle].addr = NULL;
+    pthread_mutex_unlock(&s_lock);
+    if (m.addr) {
+        munmap(m.addr, m.len);
+    }
+}
+
+void esp_partition_host_unmap_all(void)
+{
+    for (uint32_t i = 0; i < MAPPINGS_MAX; i++) {
+        esp_partition_munmap(i);
+    }
+}
@@ -0,0 +1,45 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Data partitions backed by files
+ *
+ * A registered file is found by its label like a partition of the table,
+ * read with pread() and mapped read-only with mmap(), so a consumer that
+ * maps flash sees pages come in from the file on first touch as they would
+ * through the MMU cache.
+ */
+
+#pragma once
+
+#include "esp_err.h"
+#include "esp_partition.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Add a data partition backed by a file, before anything looks it up.
+ *
+ * @param label Partition label, at most 16 characters
+ * @param path  File with the partition contents, its size is the partition size
+ *
+ * @return
+ *     - ESP_OK on success
+ *     - ESP_ERR_NOT_FOUND if the file cannot be opened
+ *     - ESP_ERR_NO_MEM if no partition slot is left
+ */
+esp_err_t esp_partition_host_add(const char *label, const char *path);
+
+/**
+ * @brief Release every mapping, for tests that map the same partition again and again.
+ */
+void esp_partition_host_unmap_all(void);
+
+#ifdef __cplusplus
+}
+#endif
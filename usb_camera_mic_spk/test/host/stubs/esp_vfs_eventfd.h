@@ -0,0 +1,31 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Host stand-in for esp_vfs_eventfd.h: Linux has eventfd() itself, registering does nothing */
+
+#pragma once
+
+#include <stddef.h>
+#include <sys/eventfd.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define EFD_SUPPORT_ISR 0
+
+typedef struct {
+    size_t max_fds;
+} esp_vfs_eventfd_config_t;
+
+#define ESP_VFS_EVENTD_CONFIG_DEFAULT() (esp_vfs_eventfd_config_t) { .max_fds = 5 }
+
+esp_err_t esp_vfs_eventfd_register(const esp_vfs_eventfd_config_t *config);
+
+#ifdef __cplusplus
+}
+#endif
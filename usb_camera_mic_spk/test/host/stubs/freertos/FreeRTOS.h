@@ -0,0 +1,45 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Host stand-in for FreeRTOS: tasks are pthreads, the tick is 1 ms like
+ * CONFIG_FREERTOS_HZ=1000 in sdkconfig.defaults, see freertos_host.c.
+ * Priorities, stack sizes and core affinity are accepted and ignored.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define configTICK_RATE_HZ          1000
+#define configMAX_PRIORITIES        25
+#define portMAX_DELAY               ((TickType_t)0xffffffffUL)
+#define portTICK_PERIOD_MS          ((TickType_t)1000 / configTICK_RATE_HZ)
+#define pdMS_TO_TICKS(ms)           ((TickType_t)(((uint64_t)(ms) * configTICK_RATE_HZ) / 1000U))
+#define pdTICKS_TO_MS(ticks)        ((TickType_t)(((uint64_t)(ticks) * 1000U) / configTICK_RATE_HZ))
+
+#define pdFALSE                     ((BaseType_t)0)
+#define pdTRUE                      ((BaseType_t)1)
+#define pdPASS                      pdTRUE
+#define pdFAIL                      pdFALSE
+#define tskNO_AFFINITY              ((BaseType_t)0x7FFFFFFF)
+
+#define IRAM_ATTR
+
+#ifdef __cplusplus
+}
+#endif
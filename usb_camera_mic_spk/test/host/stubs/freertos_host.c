@@ -0,0 +1,449 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * FreeRTOS on pthreads
+ *
+ * Just enough of the kernel for the components to run on a Linux host:
+ * detached threads for tasks, semaphores, queues and event groups on a
+ * mutex and a condition variable each, timeouts on CLOCK_MONOTONIC. Ticks
+ * are milliseconds since the first call.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "freertos/queue.h"
+#include "freertos/event_groups.h"
+#include "esp_timer.h"
+
+/* A mutex and a condition variable that waits on CLOCK_MONOTONIC */
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+} waitable_t;
+
+static void waitable_init(waitable_t *w)
+{
+    pthread_condattr_t attr;
+
+    pthread_mutex_init(&w->lock, NULL);
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&w->cond, &attr);
+    pthread_condattr_destroy(&attr);
+}
+
+static void waitable_destroy(waitable_t *w)
+{
+    pthread_cond_destroy(&w->cond);
+    pthread_mutex_destroy(&w->lock);
+}
+
+static struct timespec deadline_after(TickType_t ticks)
+{
+    struct timespec ts;
+    uint64_t ms = pdTICKS_TO_MS(ticks);
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    ts.tv_sec += ms / 1000;
+    ts.tv_nsec += (ms % 1000) * 1000000L;
+    if (ts.tv_nsec >= 1000000000L) {
+        ts.tv_sec++;
+        ts.tv_nsec -= 1000000000L;
+    }
+    return ts;
+}
+
+/* Wait on w, locked by the caller, until signalled or the deadline; false on timeout */
+static bool waitable_wait(waitable_t *w, TickType_t ticks, const struct timespec *deadline)
+{
+    if (ticks == 0) {
+        return false;
+    }
+    if (ticks == portMAX_DELAY) {
+        pthread_cond_wait(&w->cond, &w->lock);
+        return true;
+    }
+    return pthread_cond_timedwait(&w->cond, &w->lock, deadline) != ETIMEDOUT;
+}
+
+/* Tasks */
+
+struct host_task {
+    TaskFunction_t fn;
+    void *arg;
+    char name[16];
+};
+
+static __thread struct host_task *s_current;
+
+static void *task_entry(void *arg)
+{
+    s_current = (struct host_task *)arg;
+    pthread_setname_np(pthread_self(), s_current->name);
+    s_current->fn(s_current->arg);
+    fprintf(stderr, "task %s returned without vTaskDelete(NULL)\n", s_current->name);
+    abort();
+    return NULL;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack_depth, void *arg,
+                       UBaseType_t priority, TaskHandle_t *created)
+{
+    pthread_t thread;
+    pthread_attr_t attr;
+    struct host_task *task = calloc(1, sizeof(struct host_task));
+
+    if (task == NULL) {
+        return pdFAIL;
+    }
+    task->fn = fn;
+    task->arg = arg;
+    snprintf(task->name, sizeof(task->name), "%s", name ? name : "task");
+
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    int ret = pthread_create(&thread, &attr, task_entry, task);
+    pthread_attr_destroy(&attr);
+    if (ret != 0) {
+        free(task);
+        return pdFAIL;
+    }
+    if (created) {
+        *created = task;
+    }
+    return pdPASS;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack_depth, void *arg,
+                                   UBaseType_t priority, TaskHandle_t *created, BaseType_t core_id)
+{
+    return xTaskCreate(fn, name, stack_depth, arg, priority, created);
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+    if (task != NULL && task != s_current) {
+        fprintf(stderr, "vTaskDelete of another task is not supported on the host\n");
+        abort();
+    }
+    free(s_current);
+    s_current = NULL;
+    pthread_exit(NULL);
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    return (TickType_t)(esp_timer_get_time() / (1000000 / configTICK_RATE_HZ));
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    struct timespec deadline = deadline_after(ticks);
+
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR) {
+    }
+}
+
+void vTaskDelayUntil(TickType_t *previous_wake, TickType_t increment)
+{
+    TickType_t now = xTaskGetTickCount();
+
+    *previous_wake += increment;
+    if ((int32_t)(*previous_wake - now) > 0) {
+        vTaskDelay(*previous_wake - now);
+    }
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    return s_current;
+}
+
+const char *pcTaskGetName(TaskHandle_t task)
+{
+    task = task ? task : s_current;
+    return task ? task->name : "main";
+}
+
+/* Semaphores: a count up to a maximum; a mutex is a binary semaphore given at creation */
+
+struct host_semaphore {
+    waitable_t w;
+    UBaseType_t count;
+    UBaseType_t max;
+};
+
+static SemaphoreHandle_t semaphore_create(UBaseType_t max, UBaseType_t initial)
+{
+    struct host_semaphore *sem = calloc(1, sizeof(struct host_semaphore));
+
+    if (sem == NULL) {
+        return NULL;
+    }
+    waitable_init(&sem->w);
+    sem->count = initial;
+    sem->max = max;
+    return sem;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void)
+{
+    return semaphore_create(1, 0);
+}
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max_count, UBaseType_t initial_count)
+{
+    return semaphore_create(max_count, initial_count);
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    return semaphore_create(1, 1);
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks)
+{
+    struct timespec deadline = deadline_after(ticks == portMAX_DELAY ? 0 : ticks);
+    BaseType_t ret = pdTRUE;
+
+    pthread_mutex_lock(&sem->w.lock);
+    while (sem->count == 0) {
+        if (!waitable_wait(&sem->w, ticks, &deadline) && sem->count == 0) {
+            ret = pdFALSE;
+            break;
+        }
+    }
+    if (ret) {
+        sem->count--;
+    }
+    pthread_mutex_unlock(&sem->w.lock);
+    return ret;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem)
+{
+    BaseType_t ret = pdFALSE;
+
+    pthread_mutex_lock(&sem->w.lock);
+    if (sem->count < sem->max) {
+        sem->count++;
+        pthread_cond_signal(&sem->w.cond);
+        ret = pdTRUE;
+    }
+    pthread_mutex_unlock(&sem->w.lock);
+    return ret;
+}
+
+UBaseType_t uxSemaphoreGetCount(SemaphoreHandle_t sem)
+{
+    pthread_mutex_lock(&sem->w.lock);
+    UBaseType_t count = sem->count;
+    pthread_mutex_unlock(&sem->w.lock);
+    return count;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem)
+{
+    if (sem) {
+        waitable_destroy(&sem->w);
+        free(sem);
+    }
+}
+
+/* Queues: a ring of fixed size items; senders and receivers share one condition */
+
+struct host_queue {
+    waitable_t w;
+    UBaseType_t length;
+    UBaseType_t item_size;
+    UBaseType_t head;
+    UBaseType_t count;
+    uint8_t items[];
+};
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size)
+{
+    struct host_queue *queue;
+
+    if (length == 0) {
+        return NULL;
+    }
+    queue = calloc(1, sizeof(struct host_queue) + (size_t)length * item_size);
+    if (queue == NULL) {
+        return NULL;
+    }
+    waitable_init(&queue->w);
+    queue->length = length;
+    queue->item_size = item_size;
+    return queue;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticks)
+{
+    struct timespec deadline = deadline_after(ticks == portMAX_DELAY ? 0 : ticks);
+    BaseType_t ret = pdTRUE;
+
+    pthread_mutex_lock(&queue->w.lock);
+    while (queue->count == queue->length) {
+        if (!waitable_wait(&queue->w, ticks, &deadline) && queue->count == queue->length) {
+            ret = pdFALSE;
+            break;
+        }
+    }
+    if (ret) {
+        UBaseType_t tail = (queue->head + queue->count) % queue->length;
+        memcpy(queue->items + (size_t)tail * queue->item_size, item, queue->item_size);
+        queue->count++;
+        pthread_cond_broadcast(&queue->w.cond);
+    }
+    pthread_mutex_unlock(&queue->w.lock);
+    return ret;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticks)
+{
+    struct timespec deadline = deadline_after(ticks == portMAX_DELAY ? 0 : ticks);
+    BaseType_t ret = pdTRUE;
+
+    pthread_mutex_lock(&queue->w.lock);
+    while (queue->count == 0) {
+        if (!waitable_wait(&queue->w, ticks, &deadline) && queue->count == 0) {
+            ret = pdFALSE;
+            break;
+        }
+    }
+    if (ret) {
+        memcpy(item, queue->items + (size_t)queue->head * queue->item_size, queue->item_size);
+        queue->head = (queue->head + 1) % queue->length;
+        queue->count--;
+        pthread_cond_broadcast(&queue->w.cond);
+    }
+    pthread_mutex_unlock(&queue->w.lock);
+    return ret;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue)
+{
+    pthread_mutex_lock(&queue->w.lock);
+    UBaseType_t count = queue->count;
+    pthread_mutex_unlock(&queue->w.lock);
+    return count;
+}
+
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t queue)
+{
+    return queue->length - uxQueueMessagesWaiting(queue);
+}
+
+void vQueueDelete(QueueHandle_t queue)
+{
+    if (queue) {
+        waitable_destroy(&queue->w);
+        free(queue);
+    }
+}
+
+/*
+ * Event groups. Every set bumps a generation and records the bits it left,
+ * so a waiter woken by it sees them even when another waiter cleared them
+ * before this one got the lock.
+ */
+
+struct host_event_group {
+    waitable_t w;
+    EventBits_t bits;
+    uint32_t generation;
+    EventBits_t generation_bits;
+};
+
+static bool bits_match(EventBits_t have, EventBits_t want, BaseType_t wait_for_all)
+{
+    return wait_for_all ? (have & want) == want : (have & want) != 0;
+}
+
+EventGroupHandle_t xEventGroupCreate(void)
+{
+    struct host_event_group *group = calloc(1, sizeof(struct host_event_group));
+
+    if (group) {
+        waitable_init(&group->w);
+    }
+    return group;
+}
+
+EventBits_t xEventGroupSetBits(EventGroupHandle_t group, EventBits_t bits)
+{
+    pthread_mutex_lock(&group->w.lock);
+    group->bits |= bits;
+    group->generation++;
+    group->generation_bits = group->bits;
+    EventBits_t ret = group->bits;
+    pthread_cond_broadcast(&group->w.cond);
+    pthread_mutex_unlock(&group->w.lock);
+    return ret;
+}
+
+EventBits_t xEventGroupClearBits(EventGroupHandle_t group, EventBits_t bits)
+{
+    pthread_mutex_lock(&group->w.lock);
+    EventBits_t ret = group->bits;
+    group->bits &= ~bits;
+    pthread_mutex_unlock(&group->w.lock);
+    return ret;
+}
+
+EventBits_t xEventGroupGetBits(EventGroupHandle_t group)
+{
+    pthread_mutex_lock(&group->w.lock);
+    EventBits_t ret = group->bits;
+    pthread_mutex_unlock(&group->w.lock);
+    return ret;
+}
+
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t group, EventBits_t bits, BaseType_t clear_on_exit,
+                                BaseType_t wait_for_all, TickType_t ticks)
+{
+    struct timespec deadline = deadline_after(ticks == portMAX_DELAY ? 0 : ticks);
+    EventBits_t seen;
+
+    pthread_mutex_lock(&group->w.lock);
+    uint32_t generation = group->generation;
+    while (1) {
+        seen = group->bits;
+        if (bits_match(seen, bits, wait_for_all)) {
+            break;
+        }
+        if (group->generation != generation && bits_match(group->generation_bits, bits, wait_for_all)) {
+            seen = group->generation_bits;
+            break;
+        }
+        if (!waitable_wait(&group->w, ticks, &deadline)) {
+            seen = group->bits;
+            break;
+        }
+    }
+    if (clear_on_exit && bits_match(seen, bits, wait_for_all)) {
+        group->bits &= ~bits;
+    }
+    pthread_mutex_unlock(&group->w.lock);
+    return seen;
+}
+
+void vEventGroupDelete(EventGroupHandle_t group)
+{
+    if (group) {
+        waitable_destroy(&group->w);
+        free(group);
+    }
+}
@@ -0,0 +1,36 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * lwIP socket buffers on the host
+ *
+ * Linux grows the send buffer of a TCP socket to megabytes, lwIP gives each
+ * one CONFIG_LWIP_TCP_SND_BUF_DEFAULT bytes. A server tested with the Linux
+ * default would never see a slow client push back. Programs that serve
+ * sockets link with -Wl,--wrap=accept, so every accepted socket gets the
+ * lwIP send buffer and MSS.
+ */
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include "sdkconfig.h"
+
+int __real_accept(int fd, struct sockaddr *addr, socklen_t *addr_len);
+
+int __wrap_accept(int fd, struct sockaddr *addr, socklen_t *addr_len)
+{
+    int client = __real_accept(fd, addr, addr_len);
+    /* the kernel doubles the size asked for, to make room for its bookkeeping */
+    int sndbuf = CONFIG_LWIP_TCP_SND_BUF_DEFAULT / 2;
+    int mss = CONFIG_LWIP_TCP_MSS;
+
+    if (client >= 0) {
+        setsockopt(client, SOL_SOCKET, SO_SNDBUF, &sndbuf, sizeof(sndbuf));
+        setsockopt(client, IPPROTO_TCP, TCP_MAXSEG, &mss, sizeof(mss));
+    }
+    return client;
+}
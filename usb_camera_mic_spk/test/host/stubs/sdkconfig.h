@@ -0,0 +1,136 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Configuration of the host build
+ *
+ * The Kconfig defaults of the components, with the optional features the
+ * tests exercise turned on and the ports moved above 1024. A program
+ * overrides any of them with -D, see the Makefile.
+ */
+
+#pragma once
+
+#define CONFIG_IDF_TARGET_ESP32S3               1
+#define CONFIG_FREERTOS_HZ                      1000
+
+#ifndef CONFIG_LWIP_MAX_SOCKETS
+#define CONFIG_LWIP_MAX_SOCKETS                 44
+#endif
+#ifndef CONFIG_LWIP_TCP_MSS
+#define CONFIG_LWIP_TCP_MSS                     1440
+#endif
+#ifndef CONFIG_LWIP_TCP_SND_BUF_DEFAULT
+#define CONFIG_LWIP_TCP_SND_BUF_DEFAULT         5760
+#endif
+
+/* esp_http_server, the port stands in for 80 and HOST_HTTP_PORT overrides it at run time */
+#ifndef CONFIG_HOST_HTTP_PORT
+#define CONFIG_HOST_HTTP_PORT                   18080
+#endif
+#ifndef CONFIG_HTTPD_WS_SUPPORT
+#define CONFIG_HTTPD_WS_SUPPORT                 1
+#endif
+
+/* xfer_http */
+#ifndef CONFIG_CAMERA_FB_POOL_SIZE
+#define CONFIG_CAMERA_FB_POOL_SIZE              3
+#endif
+#ifndef CONFIG_CAMERA_FB_BUF_SIZE
+#define CONFIG_CAMERA_FB_BUF_SIZE               40960
+#endif
+#ifndef CONFIG_CAMERA_FB_MAX_READERS
+#define CONFIG_CAMERA_FB_MAX_READERS            8
+#endif
+#ifndef CONFIG_CAPTURE_MAX_AGE_MS
+#define CONFIG_CAPTURE_MAX_AGE_MS               100
+#endif
+#ifndef CONFIG_CAPTURE_LONG_POLL_MAX
+#define CONFIG_CAPTURE_LONG_POLL_MAX            4
+#endif
+#ifndef CONFIG_CAPTURE_LONG_POLL_TIMEOUT_MS
+#define CONFIG_CAPTURE_LONG_POLL_TIMEOUT_MS     10000
+#endif
+#ifndef CONFIG_STREAM_SERVER_MAX_CLIENTS
+#define CONFIG_STREAM_SERVER_MAX_CLIENTS        16
+#endif
+#ifndef CONFIG_STREAM_CLIENT_STALL_TIMEOUT_MS
+#define CONFIG_STREAM_CLIENT_STALL_TIMEOUT_MS   5000
+#endif
+#ifndef CONFIG_WS_VIDEO_MAX_CLIENTS
+#define CONFIG_WS_VIDEO_MAX_CLIENTS             4
+#endif
+#ifndef CONFIG_RTSP_SERVER_ENABLE
+#define CONFIG_RTSP_SERVER_ENABLE               0
+#endif
+#ifndef CONFIG_RTSP_SERVER_PORT
+#define CONFIG_RTSP_SERVER_PORT                 18554
+#endif
+#ifndef CONFIG_RTP_SERVER_PORT
+#define CONFIG_RTP_SERVER_PORT                  16970
+#endif
+#ifndef CONFIG_RTSP_MAX_SESSIONS
+#define CONFIG_RTSP_MAX_SESSIONS                2
+#endif
+#ifndef CONFIG_RTP_PACKET_SIZE
+#define CONFIG_RTP_PACKET_SIZE                  1400
+#endif
+#if !defined(CONFIG_RTP_FEC_XOR) && !defined(CONFIG_RTP_FEC_RS) && !defined(CONFIG_RTP_FEC_NONE)
+#define CONFIG_RTP_FEC_NONE                     1
+#endif
+#ifndef CONFIG_RTP_FEC_OVERHEAD_PERCENT
+#define CONFIG_RTP_FEC_OVERHEAD_PERCENT         20
+#endif
+#ifndef CONFIG_RTP_FEC_MAX_PARITY
+#define CONFIG_RTP_FEC_MAX_PARITY               8
+#endif
+#ifndef CONFIG_FRAME_HISTORY_ENABLE
+#define CONFIG_FRAME_HISTORY_ENABLE             1
+#endif
+#ifndef CONFIG_FRAME_HISTORY_SIZE
+#define CONFIG_FRAME_HISTORY_SIZE               131072
+#endif
+#ifndef CONFIG_FRAME_HISTORY_MAX_FRAMES
+#define CONFIG_FRAME_HISTORY_MAX_FRAMES         300
+#endif
+#ifndef CONFIG_MIC_RING_SIZE
+#define CONFIG_MIC_RING_SIZE                    16384
+#endif
+#ifndef CONFIG_MIC_RING_MAX_READERS
+#define CONFIG_MIC_RING_MAX_READERS             4
+#endif
+#ifndef CONFIG_SPEAKER_WS_MIN_MS
+#define CONFIG_SPEAKER_WS_MIN_MS                40
+#endif
+#ifndef CONFIG_SPEAKER_WS_MAX_MS
+#define CONFIG_SPEAKER_WS_MAX_MS                300
+#endif
+#ifndef CONFIG_FRAME_LOG_ENABLE
+#define CONFIG_FRAME_LOG_ENABLE                 0
+#endif
+
+/* main */
+#ifndef CONFIG_FRAME_REPLAY_ENABLE
+#define CONFIG_FRAME_REPLAY_ENABLE              0
+#endif
+#ifndef CONFIG_FRAME_REPLAY_FPS
+#define CONFIG_FRAME_REPLAY_FPS                 15
+#endif
+#ifndef CONFIG_FRAME_REPLAY_SIZE_MIN
+#define CONFIG_FRAME_REPLAY_SIZE_MIN            20000
+#endif
+#ifndef CONFIG_FRAME_REPLAY_SIZE_MAX
+#define CONFIG_FRAME_REPLAY_SIZE_MAX            40000
+#endif
+#ifndef CONFIG_PROMPT_ASSETS_PARTITION
+#define CONFIG_PROMPT_ASSETS_PARTITION          "assets"
+#endif
+#ifndef CONFIG_PROMPT_PLAY_NAME
+#define CONFIG_PROMPT_PLAY_NAME                 "default"
+#endif
+#ifndef CONFIG_SPK_TONE_FREQ
+#define CONFIG_SPK_TONE_FREQ                    0
+#endif
@@ -0,0 +1,156 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Host stand-in for the usb_stream component
+ *
+ * The types and calls of usb_stream 1.2 that main.c uses. usb_stream_host.c
+ * implements them with a simulated camera, microphone and speaker, see
+ * usb_stream_host.h for how a test sets them up.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <sys/time.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum uvc_frame_format {
+    UVC_FRAME_FORMAT_UNKNOWN = 0,
+    UVC_FRAME_FORMAT_ANY = 0,
+    UVC_FRAME_FORMAT_UNCOMPRESSED,
+    UVC_FRAME_FORMAT_COMPRESSED,
+    UVC_FRAME_FORMAT_YUYV,
+    UVC_FRAME_FORMAT_UYVY,
+    UVC_FRAME_FORMAT_RGB,
+    UVC_FRAME_FORMAT_BGR,
+    UVC_FRAME_FORMAT_MJPEG,
+    UVC_FRAME_FORMAT_GRAY8,
+    UVC_FRAME_FORMAT_COUNT,
+};
+
+typedef struct uvc_frame {
+    void *data;
+    size_t data_bytes;
+    uint32_t width;
+    uint32_t height;
+    enum uvc_frame_format frame_format;
+    size_t step;
+    uint32_t sequence;
+    struct timeval capture_time;
+    struct timespec capture_time_finished;
+    void *source;
+    uint8_t library_owns_data;
+} uvc_frame_t;
+
+typedef struct {
+    void *data;
+    uint32_t data_bytes;
+    uint16_t bit_resolution;
+    uint32_t samples_frequence;
+} mic_frame_t;
+
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    uint32_t interval;
+    uint32_t interval_min;
+    uint32_t interval_max;
+    uint32_t interval_step;
+} uvc_frame_size_t;
+
+typedef struct {
+    uint8_t ch_num;
+    uint16_t bit_resolution;
+    uint32_t samples_frequence;
+    uint32_t samples_frequence_min;
+    uint32_t samples_frequence_max;
+} uac_frame_size_t;
+
+typedef void(uvc_frame_callback_t)(uvc_frame_t *frame, void *user_ptr);
+typedef void(mic_callback_t)(mic_frame_t *frame, void *user_ptr);
+
+typedef enum {
+    STREAM_UVC = 0,
+    STREAM_UAC_SPK,
+    STREAM_UAC_MIC,
+    STREAM_MAX,
+} usb_stream_t;
+
+typedef enum {
+    CTRL_NONE = 0,
+    CTRL_SUSPEND,
+    CTRL_RESUME,
+    CTRL_UAC_MUTE,
+    CTRL_UAC_VOLUME,
+    CTRL_MAX,
+} stream_ctrl_t;
+
+typedef enum {
+    STREAM_CONNECTED = 0,
+    STREAM_DISCONNECTED,
+} usb_stream_state_t;
+
+typedef void (*state_callback_t)(usb_stream_state_t state, void *arg);
+
+#define FRAME_RESOLUTION_ANY                0
+#define UAC_CH_ANY                          0
+#define UAC_BITS_ANY                        0
+#define UAC_FREQUENCY_ANY                   0
+#define FPS2INTERVAL(fps)                   (10000000ul / (fps))
+
+#define FLAG_UVC_SUSPEND_AFTER_START        (1 << 0)
+#define FLAG_UAC_SPK_SUSPEND_AFTER_START    (1 << 1)
+#define FLAG_UAC_MIC_SUSPEND_AFTER_START    (1 << 2)
+
+typedef struct {
+    uint16_t frame_width;
+    uint16_t frame_height;
+    uint32_t frame_interval;
+    uint32_t xfer_buffer_size;
+    uint8_t *xfer_buffer_a;
+    uint8_t *xfer_buffer_b;
+    uint32_t frame_buffer_size;
+    uint8_t *frame_buffer;
+    uvc_frame_callback_t *frame_cb;
+    void *frame_cb_arg;
+    int flags;
+} uvc_config_t;
+
+typedef struct {
+    uint8_t spk_ch_num;
+    uint8_t mic_ch_num;
+    uint16_t mic_bit_resolution;
+    uint32_t mic_samples_frequence;
+    uint16_t spk_bit_resolution;
+    uint32_t spk_samples_frequence;
+    uint32_t spk_buf_size;
+    uint32_t mic_buf_size;
+    mic_callback_t *mic_cb;
+    void *mic_cb_arg;
+    int flags;
+} uac_config_t;
+
+esp_err_t uvc_streaming_config(const uvc_config_t *config);
+esp_err_t uac_streaming_config(const uac_config_t *config);
+esp_err_t usb_streaming_start(void);
+esp_err_t usb_streaming_stop(void);
+esp_err_t usb_streaming_connect_wait(size_t timeout_ms);
+esp_err_t usb_streaming_state_register(state_callback_t cb, void *user_data);
+esp_err_t usb_streaming_control(usb_stream_t stream, stream_ctrl_t ctrl_type, void *ctrl_value);
+esp_err_t uac_spk_streaming_write(void *data, size_t data_bytes, size_t timeout_ms);
+esp_err_t uac_mic_streaming_read(void *buf, size_t buf_size, size_t *data_bytes, size_t timeout_ms);
+esp_err_t uvc_frame_size_list_get(uvc_frame_size_t *frame_list, size_t *list_size, size_t *cur_index);
+esp_err_t uac_frame_size_list_get(usb_stream_t stream, uac_frame_size_t *frame_list, size_t *list_size, size_t *cur_index);
+
+#ifdef __cplusplus
+}
+#endif
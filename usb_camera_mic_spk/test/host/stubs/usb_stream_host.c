@@ -0,0 +1,462 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * usb_stream on the host: a simulated camera, microphone and speaker, see
+ * usb_stream_host.h. Each device runs in its own task on the FreeRTOS
+ * stand-in and keeps its pace with vTaskDelayUntil().
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <assert.h>
+#include <time.h>
+#include <sys/time.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/event_groups.h"
+#include "esp_log.h"
+#include "esp_random.h"
+#include "usb_stream.h"
+#include "usb_stream_host.h"
+
+static const char *TAG = "usb_stream_host";
+
+#define CAMERA_WIDTH        320
+#define CAMERA_HEIGHT       240
+#define COM_PAYLOAD_MAX     (0xFFFF - 2)
+#define COM_HEADER_SIZE     4
+#define CONNECT_DELAY_MS    50
+#define TONE_FREQ           1000
+#define TONE_AMPLITUDE      0.1         /* -20 dBFS */
+#define CONNECTED_BIT       (1 << 0)
+
+extern const uint8_t replay_jpeg_320_240[];
+extern const uint32_t replay_jpeg_size;
+
+static usb_stream_host_config_t s_config = {
+    .frame_size_min = 20000,
+    .frame_size_max = 40000,
+    .mic_rate = 16000,
+    .mic_bits = 16,
+    .mic_channels = 1,
+    .mic_period_ms = 10,
+    .spk_rate = 48000,
+    .spk_bits = 16,
+    .spk_channels = 2,
+};
+
+static uvc_config_t s_uvc;
+static uac_config_t s_uac;
+static bool s_uvc_configured;
+static bool s_uac_configured;
+static state_callback_t s_state_cb;
+static void *s_state_cb_arg;
+static EventGroupHandle_t s_events;
+static atomic_bool s_suspended[STREAM_MAX];
+
+static atomic_uint s_frames;
+static atomic_ullong s_mic_bytes;
+static atomic_ullong s_spk_written;
+static atomic_ullong s_spk_played;
+static atomic_uint s_spk_underrun_ms;
+static atomic_uint s_spk_write_timeouts;
+
+/* the speaker's buffer, filled by writes and drained by the speaker task */
+static struct {
+    pthread_mutex_t lock;
+    pthread_cond_t drained;
+    uint8_t *buf;
+    size_t size;
+    size_t head;
+    size_t level;
+    bool fed;                   /* written to since it was resumed */
+} s_spk = { .lock = PTHREAD_MUTEX_INITIALIZER, .drained = PTHREAD_COND_INITIALIZER };
+
+void usb_stream_host_configure(const usb_stream_host_config_t *config)
+{
+    if (!config) {
+        return;
+    }
+#define TAKE(field) if (config->field) s_config.field = config->field
+    TAKE(fps);
+    TAKE(frame_size_min);
+    TAKE(frame_size_max);
+    TAKE(mic_rate);
+    TAKE(mic_bits);
+    TAKE(mic_channels);
+    TAKE(mic_period_ms);
+    TAKE(spk_rate);
+    TAKE(spk_bits);
+    TAKE(spk_channels);
+#undef TAKE
+    if (s_config.frame_size_max < s_config.frame_size_min) {
+        s_config.frame_size_max = s_config.frame_size_min;
+    }
+}
+
+void usb_stream_host_get_stats(usb_stream_host_stats_t *stats)
+{
+    stats->frames = atomic_load(&s_frames);
+    stats->mic_bytes = atomic_load(&s_mic_bytes);
+    stats->spk_bytes_written = atomic_load(&s_spk_written);
+    stats->spk_bytes_played = atomic_load(&s_spk_played);
+    stats->spk_underrun_ms = atomic_load(&s_spk_underrun_ms);
+    stats->spk_write_timeouts = atomic_load(&s_spk_write_timeouts);
+}
+
+/* Camera */
+
+static size_t put_com(uint8_t *p, const char *text, size_t len)
+{
+    p[0] = 0xFF;
+    p[1] = 0xFE;
+    p[2] = (len + 2) >> 8;
+    p[3] = (len + 2) & 0xFF;
+    if (text) {
+        memcpy(p + COM_HEADER_SIZE, text, len);
+    } else {
+        memset(p + COM_HEADER_SIZE, 0, len);
+    }
+    return COM_HEADER_SIZE + len;
+}
+
+/* SOI, a COM with the sequence number, COM padding up to the target size, then the rest of the JPEG */
+static size_t build_frame(uint8_t *buf, uint32_t seq, size_t target)
+{
+    uint8_t *p = buf;
+    char text[24];
+    size_t text_len = snprintf(text, sizeof(text), "seq=%u", (unsigned)seq);
+
+    p[0] = 0xFF;
+    p[1] = 0xD8;
+    p += 2;
+    p += put_com(p, text, text_len);
+    size_t len = (p - buf) + replay_jpeg_size - 2;
+    while (len + COM_HEADER_SIZE < target) {
+        size_t pad = target - len - COM_HEADER_SIZE;
+        pad = pad > COM_PAYLOAD_MAX ? COM_PAYLOAD_MAX : pad;
+        p += put_com(p, NULL, pad);
+        len += COM_HEADER_SIZE + pad;
+    }
+    memcpy(p, replay_jpeg_320_240 + 2, replay_jpeg_size - 2);
+    return len;
+}
+
+static void camera_task(void *arg)
+{
+    uint32_t fps = s_config.fps ? s_config.fps : 10000000ul / (s_uvc.frame_interval ? s_uvc.frame_interval : FPS2INTERVAL(15));
+    uint32_t span = s_config.frame_size_max - s_config.frame_size_min + 1;
+    uint8_t *buf = (uint8_t *)malloc(s_config.frame_size_max + replay_jpeg_size + 3 * COM_HEADER_SIZE + 24);
+    TickType_t last_wake = xTaskGetTickCount();
+    uint64_t due_us = 0;
+    uint32_t seq = 0;
+
+    assert(buf);
+    ESP_LOGI(TAG, "camera: %ux%u MJPEG at %u fps, %u..%u bytes", CAMERA_WIDTH, CAMERA_HEIGHT, fps,
+             s_config.frame_size_min, s_config.frame_size_max);
+    while (1) {
+        if (!atomic_load(&s_suspended[STREAM_UVC])) {
+            uvc_frame_t frame = {
+                .data = buf,
+                .data_bytes = build_frame(buf, seq, s_config.frame_size_min + esp_random() % span),
+                .width = CAMERA_WIDTH,
+                .height = CAMERA_HEIGHT,
+                .frame_format = UVC_FRAME_FORMAT_MJPEG,
+                .sequence = seq++,
+            };
+            gettimeofday(&frame.capture_time, NULL);
+            s_uvc.frame_cb(&frame, s_uvc.frame_cb_arg);
+            atomic_fetch_add(&s_frames, 1);
+        }
+        /* whole ticks between frames, the remainder carried so the rate is kept on average */
+        due_us += 1000000 / fps;
+        TickType_t ticks = due_us / 1000;
+        due_us -= ticks * 1000;
+        vTaskDelayUntil(&last_wake, ticks);
+    }
+}
+
+/* Microphone */
+
+static void put_sample(uint8_t *p, int bits, double value)
+{
+    int32_t s = (int32_t)lrint(value * ((1u << (bits - 1)) - 1));
+
+    for (int i = 0; i < bits / 8; i++) {
+        p[i] = s >> (i * 8);
+    }
+}
+
+static void mic_task(void *arg)
+{
+    size_t frame_bytes = s_config.mic_channels * s_config.mic_bits / 8;
+    size_t frames = s_config.mic_rate * s_config.mic_period_ms / 1000;
+    uint8_t *buf = (uint8_t *)malloc(frames * frame_bytes);
+    TickType_t last_wake = xTaskGetTickCount();
+    uint64_t n = 0;
+
+    assert(buf);
+    while (1) {
+        if (!atomic_load(&s_suspended[STREAM_UAC_MIC])) {
+            for (size_t i = 0; i < frames; i++, n++) {
+                double v = TONE_AMPLITUDE * sin(2 * M_PI * TONE_FREQ * n / s_config.mic_rate);
+                for (int c = 0; c < s_config.mic_channels; c++) {
+                    put_sample(buf + i * frame_bytes + c * s_config.mic_bits / 8, s_config.mic_bits, v);
+                }
+            }
+            mic_frame_t frame = {
+                .data = buf,
+                .data_bytes = frames * frame_bytes,
+                .bit_resolution = s_config.mic_bits,
+                .samples_frequence = s_config.mic_rate,
+            };
+            s_uac.mic_cb(&frame, s_uac.mic_cb_arg);
+            atomic_fetch_add(&s_mic_bytes, frame.data_bytes);
+        }
+        vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(s_config.mic_period_ms));
+    }
+}
+
+/* Speaker */
+
+static void spk_task(void *arg)
+{
+    size_t frame_bytes = s_config.spk_channels * s_config.spk_bits / 8;
+    TickType_t last_wake = xTaskGetTickCount();
+    uint64_t ms = 0, drained_frames = 0;
+
+    while (1) {
+        vTaskDelayUntil(&last_wake, 1);
+        ms++;
+        /* this millisecond's share of the sample rate, 44.1 kHz alternating between 44 and 45 frames */
+        size_t want = (s_config.spk_rate * ms / 1000 - drained_frames) * frame_bytes;
+        drained_frames = s_config.spk_rate * ms / 1000;
+        if (atomic_load(&s_suspended[STREAM_UAC_SPK])) {
+            continue;
+        }
+        pthread_mutex_lock(&s_spk.lock);
+        size_t n = want < s_spk.level ? want : s_spk.level;
+        s_spk.head = (s_spk.head + n) % s_spk.size;
+        s_spk.level -= n;
+        if (n < want && s_spk.fed) {
+            atomic_fetch_add(&s_spk_underrun_ms, 1);
+        }
+        pthread_cond_broadcast(&s_spk.drained);
+        pthread_mutex_unlock(&s_spk.lock);
+        atomic_fetch_add(&s_spk_played, n);
+    }
+}
+
+esp_err_t uac_spk_streaming_write(void *data, size_t data_bytes, size_t timeout_ms)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    struct timespec deadline;
+
+    if (!s_uac_configured || !s_spk.buf) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (atomic_load(&s_suspended[STREAM_UAC_SPK])) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += timeout_ms / 1000;
+    deadline.tv_nsec += (timeout_ms % 1000) * 1000000L;
+    if (deadline.tv_nsec >= 1000000000L) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000L;
+    }
+
+    pthread_mutex_lock(&s_spk.lock);
+    s_spk.fed = true;
+    while (data_bytes) {
+        while (s_spk.level == s_spk.size) {
+            if (pthread_cond_timedwait(&s_spk.drained, &s_spk.lock, &deadline)) {
+                pthread_mutex_unlock(&s_spk.lock);
+                atomic_fetch_add(&s_spk_write_timeouts, 1);
+                return ESP_ERR_TIMEOUT;
+            }
+        }
+        size_t tail = (s_spk.head + s_spk.level) % s_spk.size;
+        size_t n = s_spk.size - s_spk.level;
+        n = n < s_spk.size - tail ? n : s_spk.size - tail;
+        n = n < data_bytes ? n : data_bytes;
+        memcpy(s_spk.buf + tail, p, n);
+        s_spk.level += n;
+        p += n;
+        data_bytes -= n;
+        atomic_fetch_add(&s_spk_written, n);
+    }
+    pthread_mutex_unlock(&s_spk.lock);
+    return ESP_OK;
+}
+
+esp_err_t uac_mic_streaming_read(void *buf, size_t buf_size, size_t *data_bytes, size_t timeout_ms)
+{
+    /* the microphone is read through mic_cb here, as main.c does */
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+/* Streaming */
+
+esp_err_t uvc_streaming_config(const uvc_config_t *config)
+{
+    if (!config || !config->frame_cb) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    s_uvc = *config;
+    s_uvc_configured = true;
+    atomic_store(&s_suspended[STREAM_UVC], config->flags & FLAG_UVC_SUSPEND_AFTER_START);
+    return ESP_OK;
+}
+
+esp_err_t uac_streaming_config(const uac_config_t *config)
+{
+    if (!config) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    s_uac = *config;
+    s_uac_configured = true;
+    atomic_store(&s_suspended[STREAM_UAC_SPK], config->flags & FLAG_UAC_SPK_SUSPEND_AFTER_START);
+    atomic_store(&s_suspended[STREAM_UAC_MIC], config->flags & FLAG_UAC_MIC_SUSPEND_AFTER_START);
+    return ESP_OK;
+}
+
+esp_err_t usb_streaming_state_register(state_callback_t cb, void *user_data)
+{
+    s_state_cb = cb;
+    s_state_cb_arg = user_data;
+    return ESP_OK;
+}
+
+static void connect_task(void *arg)
+{
+    vTaskDelay(pdMS_TO_TICKS(CONNECT_DELAY_MS));
+    if (s_uvc_configured) {
+        xTaskCreate(camera_task, "usb_camera", 4096, NULL, 5, NULL);
+    }
+    if (s_uac_configured) {
+        s_spk.size = s_uac.spk_buf_size ? s_uac.spk_buf_size : 16000;
+        s_spk.buf = (uint8_t *)malloc(s_spk.size);
+        assert(s_spk.buf);
+        xTaskCreate(spk_task, "usb_speaker", 4096, NULL, 5, NULL);
+        if (s_uac.mic_cb) {
+            xTaskCreate(mic_task, "usb_mic", 4096, NULL, 5, NULL);
+        }
+    }
+    if (s_state_cb) {
+        s_state_cb(STREAM_CONNECTED, s_state_cb_arg);
+    }
+    xEventGroupSetBits(s_events, CONNECTED_BIT);
+    vTaskDelete(NULL);
+}
+
+esp_err_t usb_streaming_start(void)
+{
+    if (!s_uvc_configured && !s_uac_configured) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    s_events = xEventGroupCreate();
+    if (!s_events || xTaskCreate(connect_task, "usb_connect", 4096, NULL, 5, NULL) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+esp_err_t usb_streaming_stop(void)
+{
+    /* the devices stay on the bus for the life of the process */
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t usb_streaming_connect_wait(size_t timeout_ms)
+{
+    if (!s_events) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    TickType_t ticks = timeout_ms == portMAX_DELAY ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+    EventBits_t bits = xEventGroupWaitBits(s_events, CONNECTED_BIT, false, false, ticks);
+    return bits & CONNECTED_BIT ? ESP_OK : ESP_ERR_TIMEOUT;
+}
+
+esp_err_t usb_streaming_control(usb_stream_t stream, stream_ctrl_t ctrl_type, void *ctrl_value)
+{
+    if (stream >= STREAM_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    switch (ctrl_type) {
+    case CTRL_SUSPEND:
+        atomic_store(&s_suspended[stream], true);
+        break;
+    case CTRL_RESUME:
+        if (stream == STREAM_UAC_SPK) {
+            pthread_mutex_lock(&s_spk.lock);
+            s_spk.fed = false;
+            pthread_mutex_unlock(&s_spk.lock);
+        }
+        atomic_store(&s_suspended[stream], false);
+        break;
+    case CTRL_UAC_MUTE:
+    case CTRL_UAC_VOLUME:
+        if (stream == STREAM_UVC) {
+            return ESP_ERR_INVALID_ARG;
+        }
+        break;
+    default:
+        return ESP_ERR_INVALID_ARG;
+    }
+    return ESP_OK;
+}
+
+esp_err_t uvc_frame_size_list_get(uvc_frame_size_t *frame_list, size_t *list_size, size_t *cur_index)
+{
+    if (list_size) {
+        *list_size = 1;
+    }
+    if (cur_index) {
+        *cur_index = 0;
+    }
+    if (frame_list) {
+        uint32_t fps = s_config.fps ? s_config.fps : 15;
+        frame_list[0] = (uvc_frame_size_t) {
+            .width = CAMERA_WIDTH,
+            .height = CAMERA_HEIGHT,
+            .interval = FPS2INTERVAL(fps),
+            .interval_min = FPS2INTERVAL(fps),
+            .interval_max = FPS2INTERVAL(fps),
+        };
+    }
+    return ESP_OK;
+}
+
+esp_err_t uac_frame_size_list_get(usb_stream_t stream, uac_frame_size_t *frame_list, size_t *list_size, size_t *cur_index)
+{
+    if (stream != STREAM_UAC_MIC && stream != STREAM_UAC_SPK) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    bool mic = stream == STREAM_UAC_MIC;
+    if (list_size) {
+        *list_size = 1;
+    }
+    if (cur_index) {
+        *cur_index = 0;
+    }
+    if (frame_list) {
+        uint32_t rate = mic ? s_config.mic_rate : s_config.spk_rate;
+        frame_list[0] = (uac_frame_size_t) {
+            .ch_num = mic ? s_config.mic_channels : s_config.spk_channels,
+            .bit_resolution = mic ? s_config.mic_bits : s_config.spk_bits,
+            .samples_frequence = rate,
+            .samples_frequence_min = rate,
+            .samples_frequence_max = rate,
+        };
+    }
+    return ESP_OK;
+}
@@ -0,0 +1,74 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Simulated USB devices behind the usb_stream stand-in
+ *
+ * A camera, a microphone and a speaker that keep the pace of the real ones:
+ * - camera: a task calls frame_cb at the frame rate with a valid 320x240
+ *   MJPEG frame, padded with COM segments to a size drawn uniformly from
+ *   [frame_size_min, frame_size_max], like main/frame_replay.c
+ * - microphone: a task calls mic_cb every mic_period_ms with a 1 kHz tone
+ *   at -20 dBFS in the configured format
+ * - speaker: uac_spk_streaming_write() fills a spk_buf_size buffer that a
+ *   task drains every millisecond at the sample rate, as the isochronous
+ *   transfers do; a write blocks while the buffer is full, and a
+ *   millisecond with less than its share in the buffer is an underrun
+ *
+ * usb_streaming_start() connects the devices 50 ms later, then calls the
+ * state callback with STREAM_CONNECTED from the connect task.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "usb_stream.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Zero in any field keeps the default, or for the frame rate what uvc_config_t asked for */
+typedef struct {
+    uint32_t fps;
+    uint32_t frame_size_min;
+    uint32_t frame_size_max;
+    uint32_t mic_rate;              /* 16000 Hz by default */
+    uint16_t mic_bits;              /* 16 */
+    uint8_t mic_channels;           /* 1 */
+    uint32_t mic_period_ms;         /* 10 */
+    uint32_t spk_rate;              /* 48000 Hz */
+    uint16_t spk_bits;              /* 16 */
+    uint8_t spk_channels;           /* 2 */
+} usb_stream_host_config_t;
+
+typedef struct {
+    uint32_t frames;                /* passed to frame_cb */
+    uint64_t mic_bytes;             /* passed to mic_cb */
+    uint64_t spk_bytes_written;     /* accepted by uac_spk_streaming_write() */
+    uint64_t spk_bytes_played;      /* drained by the speaker */
+    uint32_t spk_underrun_ms;       /* milliseconds short of samples while resumed and fed */
+    uint32_t spk_write_timeouts;
+} usb_stream_host_stats_t;
+
+/**
+ * @brief Set up the simulated devices, before usb_streaming_start().
+ *
+ * @param config Device settings, NULL for the defaults
+ */
+void usb_stream_host_configure(const usb_stream_host_config_t *config);
+
+/**
+ * @brief Read the device counters.
+ *
+ * @param stats Filled in
+ */
+void usb_stream_host_get_stats(usb_stream_host_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
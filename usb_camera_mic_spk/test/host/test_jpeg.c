@@ -0,0 +1,128 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "test_jpeg.h"
+
+/* compiled in to reach its encoder */
+#include "jpeg_scale.c"
+
+extern const uint8_t replay_jpeg_320_240[];
+extern const uint32_t replay_jpeg_size;
+
+static int noise(uint32_t *state, int peak)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return peak ? (int)(*state % (2 * peak + 1)) - peak : 0;
+}
+
+static uint8_t clamp8(int v)
+{
+    return v < 0 ? 0 : (v > 255 ? 255 : v);
+}
+
+/* the scene in YCbCr at plane resolution: eight soft bars over a gradient, noise on luma */
+static void draw(uint8_t *plane, int w, int h, int ci, int peak, uint32_t *state)
+{
+    static const uint8_t bars[8][3] = {
+        { 235, 128, 128 }, { 210, 16, 146 }, { 170, 166, 16 }, { 145, 54, 34 },
+        { 106, 202, 222 }, { 81, 90, 240 }, { 41, 240, 110 }, { 16, 128, 128 },
+    };
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            int bar = bars[x * 8 / w][ci];
+            int ramp = ci == 0 ? y * 64 / h - 32 : (x + y) * 32 / (w + h) - 16;
+            plane[y * w + x] = clamp8((bar * 3 + 128 + ramp * 4) / 4 + (ci == 0 ? noise(state, peak) : 0));
+        }
+    }
+}
+
+/* DRI goes in front of SOS, which write_headers() puts last */
+static void insert_dri(bit_writer_t *bw, int nc, uint16_t interval)
+{
+    const size_t sos_len = 2 + 6 + 2 * nc;
+    uint8_t *sos = bw->p - sos_len;
+
+    if (bw->end - bw->p < 6) {
+        bw->overflow = true;
+        return;
+    }
+    memmove(sos + 6, sos, sos_len);
+    sos[0] = 0xFF;
+    sos[1] = 0xDD;
+    sos[2] = 0;
+    sos[3] = 4;
+    sos[4] = interval >> 8;
+    sos[5] = interval & 0xFF;
+    bw->p += 6;
+}
+
+size_t test_jpeg_encode(const test_jpeg_config_t *config, uint8_t *out, size_t size)
+{
+    scale_ctx_t *ctx = calloc(1, sizeof(scale_ctx_t));
+    bit_writer_t bw = { .p = out, .end = out + size };
+    uint32_t state = config->seed * 2654435761u + 1;
+    uint8_t *planes[3];
+    int pw[3], pred[3] = { 0 };
+
+    if (jpeg_parse(replay_jpeg_320_240, replay_jpeg_size, &ctx->info) != ESP_OK) {
+        abort();
+    }
+    ctx->info.width = config->width;
+    ctx->info.height = config->height;
+    ctx->info.comp[0].h = ctx->info.h_max = config->h;
+    ctx->info.comp[0].v = ctx->info.v_max = config->v;
+    if (ctx_init(ctx, 2) != ESP_OK) {
+        abort();
+    }
+    ctx->out_w = config->width;
+    ctx->out_h = config->height;
+    for (int i = 0; i < 3; i++) {
+        const jpeg_component_t *c = &ctx->info.comp[i];
+        int ph = config->height * c->v / config->v;
+        pw[i] = config->width * c->h / config->h;
+        planes[i] = malloc(pw[i] * ph);
+        draw(planes[i], pw[i], ph, i, config->noise, &state);
+    }
+
+    write_headers(ctx, &bw);
+    if (config->restart_interval) {
+        insert_dri(&bw, 3, config->restart_interval);
+    }
+    uint32_t mcu = 0;
+    for (int my = 0; my < config->height / (8 * config->v); my++) {
+        for (int mx = 0; mx < config->width / (8 * config->h); mx++, mcu++) {
+            if (config->restart_interval && mcu && mcu % config->restart_interval == 0) {
+                bw_flush(&bw);
+                bw_byte(&bw, 0xFF);
+                bw_byte(&bw, 0xD0 + (mcu / config->restart_interval - 1) % 8);
+                memset(pred, 0, sizeof(pred));
+            }
+            for (int i = 0; i < 3; i++) {
+                const jpeg_component_t *c = &ctx->info.comp[i];
+                for (int bv = 0; bv < c->v; bv++) {
+                    for (int bh = 0; bh < c->h; bh++) {
+                        const uint8_t *pix = planes[i] + ((my * c->v + bv) * 8) * pw[i] + (mx * c->h + bh) * 8;
+                        encode_block(ctx, &bw, pix, pw[i], i, &pred[i]);
+                    }
+                }
+            }
+        }
+    }
+    bw_flush(&bw);
+    bw_byte(&bw, 0xFF);
+    bw_byte(&bw, 0xD9);
+
+    for (int i = 0; i < 3; i++) {
+        free(planes[i]);
+        free(ctx->plane[i]);
+    }
+    free(ctx);
+    return bw.overflow ? 0 : (size_t)(bw.p - out);
+}
@@ -0,0 +1,52 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Camera-like JPEG frames for the host programs
+ *
+ * A scene of soft colour bars over gradients with sensor noise on luma,
+ * encoded as baseline JPEG by the encoder of jpeg_scale.c with the
+ * quantization tables of the replay frame (quality 75) and the standard
+ * Huffman tables, like the frames of a UVC camera. About 40 KB at 640x480
+ * with the default noise. test_jpeg.c includes jpeg_scale.c, so a program
+ * linking it has jpeg_scale() too.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TEST_JPEG_NOISE 10      /* peak luma noise giving camera-like sizes */
+
+typedef struct {
+    uint16_t width;             /* multiple of the MCU size */
+    uint16_t height;
+    uint8_t h;                  /* luma sampling: 2x1 for 4:2:2, 2x2 for 4:2:0; chroma is 1x1 */
+    uint8_t v;
+    uint16_t restart_interval;  /* MCUs between RST markers, 0 for none */
+    int noise;                  /* peak luma noise */
+    uint32_t seed;              /* noise pattern, so frames differ */
+} test_jpeg_config_t;
+
+/**
+ * @brief Encode a frame.
+ *
+ * @param config Frame layout and content
+ * @param out    Buffer for the JPEG
+ * @param size   Size of out
+ *
+ * @return Length of the JPEG, 0 if it did not fit
+ */
+size_t test_jpeg_encode(const test_jpeg_config_t *config, uint8_t *out, size_t size);
+
+#ifdef __cplusplus
+}
+#endif